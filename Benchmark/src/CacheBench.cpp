@@ -0,0 +1,172 @@
+//
+// CacheBench.cpp
+//
+// Benchmarks for LRUCache, AccessExpireLRUCache and the sharded caches
+//
+// Copyright (c) 2004-2024, Applied Informatics Software Engineering GmbH.,
+// Aleph ONE Software Engineering LLC
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/LRUCache.h"
+#include "Poco/AccessExpireLRUCache.h"
+#include "Poco/ShardedLRUCache.h"
+#include "Poco/ShardedAccessExpireLRUCache.h"
+#include "Poco/Types.h"
+#include <functional>
+#include <thread>
+
+
+using Poco::LRUCache;
+using Poco::AccessExpireLRUCache;
+using Poco::ShardedLRUCache;
+using Poco::ShardedAccessExpireLRUCache;
+
+
+namespace {
+
+
+//
+// All caches hold CACHE_SIZE entries and are shared by all
+// benchmark threads, like a session cache in a server.
+//
+// Naming: Cache_<Implementation>_<Test>
+//
+
+const int CACHE_SIZE = 4096;
+
+
+class KeyGenerator
+	/// A per-thread xorshift generator for cache keys.
+{
+public:
+	KeyGenerator():
+		_state(static_cast<Poco::UInt64>(std::hash<std::thread::id>()(std::this_thread::get_id())) | 1)
+	{
+	}
+
+	int next(int range)
+	{
+		_state ^= _state << 13;
+		_state ^= _state >> 7;
+		_state ^= _state << 17;
+		return static_cast<int>(_state % static_cast<Poco::UInt64>(range));
+	}
+
+private:
+	Poco::UInt64 _state;
+};
+
+
+template <class C>
+C& populatedCache()
+{
+	static C* pCache = []()
+	{
+		C* p = new C(CACHE_SIZE);
+		for (int i = 0; i < CACHE_SIZE; i++) p->add(i, i);
+		return p;
+	}();
+	return *pCache;
+}
+
+
+template <class C>
+void getHit(benchmark::State& state)
+{
+	C& cache = populatedCache<C>();
+	KeyGenerator gen;
+	for (auto _ : state)
+	{
+		// stay well below the cache size, so that all lookups hit
+		benchmark::DoNotOptimize(cache.get(gen.next(CACHE_SIZE/2)));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+
+template <class C>
+void getMiss(benchmark::State& state)
+{
+	// Key range is twice the cache size, so about half of the
+	// lookups miss and insert a new entry, forcing replacement.
+	C& cache = populatedCache<C>();
+	KeyGenerator gen;
+	for (auto _ : state)
+	{
+		int key = gen.next(2*CACHE_SIZE);
+		Poco::SharedPtr<int> val = cache.get(key);
+		if (val.isNull()) cache.add(key, key);
+		benchmark::DoNotOptimize(val);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+
+using IntLRUCache = LRUCache<int, int>;
+using IntAccessExpireLRUCache = AccessExpireLRUCache<int, int>;
+using IntShardedLRUCache = ShardedLRUCache<int, int>;
+using IntShardedAccessExpireLRUCache = ShardedAccessExpireLRUCache<int, int>;
+
+
+static void Cache_LRUCache_GetHit(benchmark::State& state)
+{
+	getHit<IntLRUCache>(state);
+}
+BENCHMARK(Cache_LRUCache_GetHit)->ThreadRange(1, 64)->UseRealTime();
+
+
+static void Cache_ShardedLRUCache_GetHit(benchmark::State& state)
+{
+	getHit<IntShardedLRUCache>(state);
+}
+BENCHMARK(Cache_ShardedLRUCache_GetHit)->ThreadRange(1, 64)->UseRealTime();
+
+
+static void Cache_AccessExpireLRUCache_GetHit(benchmark::State& state)
+{
+	getHit<IntAccessExpireLRUCache>(state);
+}
+BENCHMARK(Cache_AccessExpireLRUCache_GetHit)->ThreadRange(1, 64)->UseRealTime();
+
+
+static void Cache_ShardedAccessExpireLRUCache_GetHit(benchmark::State& state)
+{
+	getHit<IntShardedAccessExpireLRUCache>(state);
+}
+BENCHMARK(Cache_ShardedAccessExpireLRUCache_GetHit)->ThreadRange(1, 64)->UseRealTime();
+
+
+static void Cache_LRUCache_GetMiss(benchmark::State& state)
+{
+	getMiss<IntLRUCache>(state);
+}
+BENCHMARK(Cache_LRUCache_GetMiss)->ThreadRange(1, 64)->UseRealTime();
+
+
+static void Cache_ShardedLRUCache_GetMiss(benchmark::State& state)
+{
+	getMiss<IntShardedLRUCache>(state);
+}
+BENCHMARK(Cache_ShardedLRUCache_GetMiss)->ThreadRange(1, 64)->UseRealTime();
+
+
+static void Cache_AccessExpireLRUCache_GetMiss(benchmark::State& state)
+{
+	getMiss<IntAccessExpireLRUCache>(state);
+}
+BENCHMARK(Cache_AccessExpireLRUCache_GetMiss)->ThreadRange(1, 64)->UseRealTime();
+
+
+static void Cache_ShardedAccessExpireLRUCache_GetMiss(benchmark::State& state)
+{
+	getMiss<IntShardedAccessExpireLRUCache>(state);
+}
+BENCHMARK(Cache_ShardedAccessExpireLRUCache_GetMiss)->ThreadRange(1, 64)->UseRealTime();
+
+
+} // namespace
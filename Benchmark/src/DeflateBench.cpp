@@ -0,0 +1,88 @@
+//
+// DeflateBench.cpp
+//
+// Benchmarks for serial and parallel compression with DeflatingOutputStream
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/DeflatingStream.h"
+#include "Poco/NullStream.h"
+#include <string>
+
+
+using Poco::DeflatingOutputStream;
+using Poco::DeflatingStreamBuf;
+
+
+namespace {
+
+
+//
+// Naming: Deflate_<StreamType>/<threads>
+//
+// Compresses 16 MB of log-like text. Threads is the number of
+// blocks compressed concurrently (1 = serial compression on the
+// calling thread); the effective parallelism is limited by the
+// number of processors.
+//
+
+
+const std::string& testData()
+{
+	static const std::string data = []()
+	{
+		std::string d;
+		d.reserve(16 << 20);
+		Poco::UInt32 x = 1;
+		while (d.size() < (16 << 20))
+		{
+			x = x*1103515245 + 12345;
+			d += "2025-01-01 12:00:00.";
+			d += std::to_string((x >> 8) % 1000);
+			d += " [Information] Request ";
+			d += std::to_string(x >> 12);
+			d += (x & 0x100) ? " completed successfully\n" : " failed: connection reset by peer\n";
+		}
+		d.resize(16 << 20);
+		return d;
+	}();
+	return data;
+}
+
+
+void deflate(benchmark::State& state, DeflatingStreamBuf::StreamType type)
+{
+	const std::string& data = testData();
+	const int threads = static_cast<int>(state.range(0));
+	for (auto _ : state)
+	{
+		Poco::NullOutputStream ostr;
+		DeflatingOutputStream deflater(ostr, type, DeflatingStreamBuf::DEFAULT_COMPRESSION, threads);
+		deflater.write(data.data(), static_cast<std::streamsize>(data.size()));
+		deflater.close();
+	}
+	state.SetBytesProcessed(state.iterations()*static_cast<int64_t>(data.size()));
+}
+
+
+static void Deflate_Gzip(benchmark::State& state)
+{
+	deflate(state, DeflatingStreamBuf::STREAM_GZIP);
+}
+BENCHMARK(Deflate_Gzip)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+
+static void Deflate_Zlib(benchmark::State& state)
+{
+	deflate(state, DeflatingStreamBuf::STREAM_ZLIB);
+}
+BENCHMARK(Deflate_Zlib)->Arg(1)->Arg(4)->Arg(16)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+
+} // namespace
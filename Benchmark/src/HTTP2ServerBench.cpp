@@ -0,0 +1,288 @@
+//
+// HTTP2ServerBench.cpp
+//
+// Benchmarks comparing HTTP/1.1 and HTTP/2 request throughput of HTTPServer
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/HTTP2Frame.h"
+#include "Poco/Net/HPACK.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/Thread.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/NullStream.h"
+#include <cstdlib>
+#include <string>
+
+
+using Poco::Net::HTTPServer;
+using Poco::Net::HTTPServerParams;
+using Poco::Net::HTTPRequestHandler;
+using Poco::Net::HTTPRequestHandlerFactory;
+using Poco::Net::HTTPServerRequest;
+using Poco::Net::HTTPServerResponse;
+using Poco::Net::HTTPClientSession;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::HTTP2Frame;
+using Poco::Net::HPACKEncoder;
+using Poco::Net::HPACKDecoder;
+using Poco::Net::HPACKHeaderList;
+using Poco::Net::ServerSocket;
+using Poco::Net::StreamSocket;
+using Poco::Net::SocketAddress;
+
+
+namespace {
+
+
+//
+// The request handler returns a fixed response body after an optional
+// delay, which simulates a handler waiting for a backend (e.g., a database).
+// The delay in milliseconds is given in the request path ("/<delay>").
+//
+
+class BenchRequestHandler: public HTTPRequestHandler
+{
+public:
+	void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+	{
+		int delay = std::atoi(request.getURI().c_str() + 1);
+		if (delay > 0) Poco::Thread::sleep(delay);
+
+		static const std::string body(1024, 'x');
+		response.setContentType("text/plain");
+		response.sendBuffer(body.data(), body.size());
+	}
+};
+
+
+class BenchRequestHandlerFactory: public HTTPRequestHandlerFactory
+{
+public:
+	HTTPRequestHandler* createRequestHandler(const HTTPServerRequest&)
+	{
+		return new BenchRequestHandler;
+	}
+};
+
+
+class BenchServer
+{
+public:
+	BenchServer():
+		_socket(SocketAddress("127.0.0.1", 0)),
+		_server(new BenchRequestHandlerFactory, _socket, createParams())
+	{
+		_server.start();
+	}
+
+	~BenchServer()
+	{
+		_server.stopAll(true);
+	}
+
+	SocketAddress address() const
+	{
+		return SocketAddress("127.0.0.1", _socket.address().port());
+	}
+
+private:
+	static HTTPServerParams::Ptr createParams()
+	{
+		HTTPServerParams::Ptr pParams = new HTTPServerParams;
+		pParams->setHTTP2Enabled(true);
+		pParams->setMaxThreads(64);
+		pParams->setMaxQueued(256);
+		pParams->setKeepAlive(true);
+		pParams->setMaxKeepAliveRequests(0);
+		return pParams;
+	}
+
+	ServerSocket _socket;
+	HTTPServer _server;
+};
+
+
+class HTTP2BenchClient
+	/// A minimal HTTP/2 client sending GET requests concurrently
+	/// on a single connection.
+{
+public:
+	HTTP2BenchClient(const SocketAddress& address):
+		_socket(address),
+		_nextStreamId(1)
+	{
+		_socket.setNoDelay(true);
+		std::string data(HTTP2Frame::CONNECTION_PREFACE);
+		HTTP2Frame(0, HTTP2Frame::FRAME_SETTINGS, 0, 0).append(data);
+		send(data);
+	}
+
+	void request(int streams, const std::string& path)
+		/// Sends the given number of requests at once, then
+		/// waits until all responses have been received.
+	{
+		std::string data;
+		for (int i = 0; i < streams; i++)
+		{
+			HPACKHeaderList headers = {{":method", "GET"}, {":scheme", "http"}, {":path", path}, {":authority", "localhost"}};
+			std::string block;
+			_encoder.encode(headers, block);
+			HTTP2Frame(static_cast<Poco::UInt32>(block.size()), HTTP2Frame::FRAME_HEADERS, HTTP2Frame::FLAG_END_HEADERS | HTTP2Frame::FLAG_END_STREAM, _nextStreamId).append(data);
+			data += block;
+			_nextStreamId += 2;
+		}
+		send(data);
+
+		int completed = 0;
+		while (completed < streams)
+		{
+			completed += readFrame();
+		}
+	}
+
+private:
+	int readFrame()
+		/// Reads and processes a frame. Returns 1 if the
+		/// frame ends a response, otherwise 0.
+	{
+		char header[HTTP2Frame::HEADER_SIZE];
+		receive(header, HTTP2Frame::HEADER_SIZE);
+		HTTP2Frame frame;
+		frame.read(header);
+		_payload.resize(frame.length());
+		if (frame.length() > 0) receive(&_payload[0], frame.length());
+
+		switch (frame.type())
+		{
+		case HTTP2Frame::FRAME_HEADERS:
+			{
+				HPACKHeaderList headers;
+				_decoder.decode(_payload.data(), _payload.size(), headers);
+			}
+			break;
+		case HTTP2Frame::FRAME_DATA:
+			if (frame.length() > 0)
+			{
+				std::string data;
+				HTTP2Frame(4, HTTP2Frame::FRAME_WINDOW_UPDATE, 0, 0).append(data);
+				HTTP2Frame::appendUInt32(data, frame.length());
+				send(data);
+			}
+			break;
+		case HTTP2Frame::FRAME_SETTINGS:
+			if (!frame.hasFlag(HTTP2Frame::FLAG_ACK))
+			{
+				std::string data;
+				HTTP2Frame(0, HTTP2Frame::FRAME_SETTINGS, HTTP2Frame::FLAG_ACK, 0).append(data);
+				send(data);
+			}
+			break;
+		case HTTP2Frame::FRAME_RST_STREAM:
+		case HTTP2Frame::FRAME_GOAWAY:
+			throw Poco::Net::HTTP2Exception("stream reset by server");
+		default:
+			break;
+		}
+		bool ends = (frame.type() == HTTP2Frame::FRAME_HEADERS || frame.type() == HTTP2Frame::FRAME_DATA) && frame.hasFlag(HTTP2Frame::FLAG_END_STREAM);
+		return ends ? 1 : 0;
+	}
+
+	void send(const std::string& data)
+	{
+		_socket.sendBytes(data.data(), static_cast<int>(data.size()));
+	}
+
+	void receive(char* buffer, std::size_t length)
+	{
+		std::size_t received = 0;
+		while (received < length)
+		{
+			int n = _socket.receiveBytes(buffer + received, static_cast<int>(length - received));
+			if (n <= 0) throw Poco::Net::ConnectionResetException("connection closed by server");
+			received += n;
+		}
+	}
+
+	StreamSocket _socket;
+	HPACKEncoder _encoder;
+	HPACKDecoder _decoder;
+	Poco::UInt32 _nextStreamId;
+	std::string _payload;
+};
+
+
+//
+// Each iteration issues a batch of requests (first argument) over a single
+// connection, with a handler delay in milliseconds (second argument).
+// HTTP/1.1 sends the requests one after another on a persistent connection,
+// HTTP/2 sends all requests of the batch as concurrent streams.
+//
+
+static void HTTPServer_HTTP11_Sequential(benchmark::State& state)
+{
+	BenchServer server;
+	HTTPClientSession session(server.address());
+	session.setKeepAlive(true);
+	const int requests = static_cast<int>(state.range(0));
+	const std::string path = "/" + std::to_string(state.range(1));
+
+	for (auto _ : state)
+	{
+		for (int i = 0; i < requests; i++)
+		{
+			HTTPRequest request(HTTPRequest::HTTP_GET, path, HTTPRequest::HTTP_1_1);
+			session.sendRequest(request);
+			HTTPResponse response;
+			std::istream& rs = session.receiveResponse(response);
+			Poco::NullOutputStream ostr;
+			Poco::StreamCopier::copyStream(rs, ostr);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * requests);
+}
+BENCHMARK(HTTPServer_HTTP11_Sequential)
+	->Args({1, 0})->Args({16, 0})->Args({64, 0})
+	->Args({16, 1})
+	->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+
+static void HTTPServer_HTTP2_Multiplexed(benchmark::State& state)
+{
+	BenchServer server;
+	HTTP2BenchClient client(server.address());
+	const int requests = static_cast<int>(state.range(0));
+	const std::string path = "/" + std::to_string(state.range(1));
+
+	for (auto _ : state)
+	{
+		client.request(requests, path);
+	}
+	state.SetItemsProcessed(state.iterations() * requests);
+}
+BENCHMARK(HTTPServer_HTTP2_Multiplexed)
+	->Args({1, 0})->Args({16, 0})->Args({64, 0})
+	->Args({16, 1})
+	->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+
+} // namespace
@@ -0,0 +1,138 @@
+//
+// HTTPHeaderParseBench.cpp
+//
+// Benchmarks comparing stream-based and in-memory parsing of HTTP message headers
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/MessageHeaderScanner.h"
+#include <sstream>
+#include <string>
+
+
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::MessageHeaderScanner;
+
+
+namespace {
+
+
+//
+// A request header as sent by a typical web browser.
+//
+
+const std::string REQUEST_HEADER(
+	"GET /products/catalog/items?category=books&sort=price&page=3 HTTP/1.1\r\n"
+	"Host: www.example.com\r\n"
+	"User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/124.0.0.0 Safari/537.36\r\n"
+	"Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,image/webp,*/*;q=0.8\r\n"
+	"Accept-Language: en-US,en;q=0.9,de;q=0.8\r\n"
+	"Accept-Encoding: gzip, deflate, br\r\n"
+	"Referer: https://www.example.com/products/catalog\r\n"
+	"Cookie: session=3f2a9c1e7b6d4e8f; theme=dark; tracking=abcdef0123456789\r\n"
+	"Cache-Control: max-age=0\r\n"
+	"Sec-Fetch-Dest: document\r\n"
+	"Sec-Fetch-Mode: navigate\r\n"
+	"Sec-Fetch-Site: same-origin\r\n"
+	"Upgrade-Insecure-Requests: 1\r\n"
+	"Connection: keep-alive\r\n"
+	"\r\n");
+
+
+const std::string RESPONSE_HEADER(
+	"HTTP/1.1 200 OK\r\n"
+	"Date: Mon, 06 Jan 2025 10:15:30 GMT\r\n"
+	"Server: Poco/1.14\r\n"
+	"Content-Type: text/html; charset=utf-8\r\n"
+	"Content-Length: 18342\r\n"
+	"Cache-Control: private, max-age=60\r\n"
+	"ETag: \"5f3a-1b2c3d4e\"\r\n"
+	"Last-Modified: Sun, 05 Jan 2025 22:01:12 GMT\r\n"
+	"Vary: Accept-Encoding\r\n"
+	"Set-Cookie: session=3f2a9c1e7b6d4e8f; Path=/; HttpOnly\r\n"
+	"Connection: keep-alive\r\n"
+	"\r\n");
+
+
+static void HTTPRequest_Read(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		std::istringstream istr(REQUEST_HEADER);
+		HTTPRequest request;
+		request.read(istr);
+		benchmark::DoNotOptimize(request);
+	}
+	state.SetBytesProcessed(state.iterations() * REQUEST_HEADER.size());
+}
+BENCHMARK(HTTPRequest_Read);
+
+
+static void HTTPRequest_Parse(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		HTTPRequest request;
+		request.parse(REQUEST_HEADER.data(), REQUEST_HEADER.data() + REQUEST_HEADER.size());
+		benchmark::DoNotOptimize(request);
+	}
+	state.SetBytesProcessed(state.iterations() * REQUEST_HEADER.size());
+}
+BENCHMARK(HTTPRequest_Parse);
+
+
+static void HTTPResponse_Read(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		std::istringstream istr(RESPONSE_HEADER);
+		HTTPResponse response;
+		response.read(istr);
+		benchmark::DoNotOptimize(response);
+	}
+	state.SetBytesProcessed(state.iterations() * RESPONSE_HEADER.size());
+}
+BENCHMARK(HTTPResponse_Read);
+
+
+static void HTTPResponse_Parse(benchmark::State& state)
+{
+	for (auto _ : state)
+	{
+		HTTPResponse response;
+		response.parse(RESPONSE_HEADER.data(), RESPONSE_HEADER.data() + RESPONSE_HEADER.size());
+		benchmark::DoNotOptimize(response);
+	}
+	state.SetBytesProcessed(state.iterations() * RESPONSE_HEADER.size());
+}
+BENCHMARK(HTTPResponse_Parse);
+
+
+//
+// Locating the end of the header, as done by HTTPSession before parsing.
+//
+
+static void MessageHeaderScanner_FindHeaderEnd(benchmark::State& state)
+{
+	const char* pBegin = REQUEST_HEADER.data();
+	const char* pEnd = pBegin + REQUEST_HEADER.size();
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(MessageHeaderScanner::findHeaderEnd(pBegin, pEnd));
+	}
+	state.SetBytesProcessed(state.iterations() * REQUEST_HEADER.size());
+	state.SetLabel(MessageHeaderScanner::implementation());
+}
+BENCHMARK(MessageHeaderScanner_FindHeaderEnd);
+
+
+} // namespace
@@ -0,0 +1,216 @@
+//
+// HashBench.cpp
+//
+// Benchmarks for checksums (CRC-32, CRC-32C, Adler-32) and hash functions
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/Checksum.h"
+#include "Poco/CRC.h"
+#include "Poco/XXH3.h"
+#include "Poco/Hash.h"
+#include "Poco/HashMap.h"
+#include "Poco/MD5Engine.h"
+#include "Poco/NumberFormatter.h"
+#include <functional>
+#include <string>
+#include <vector>
+#if __has_include(<zlib.h>)
+#include <zlib.h>
+#define POCO_BENCH_HAVE_ZLIB 1
+#endif
+
+
+using Poco::Checksum;
+using Poco::CRC;
+using Poco::XXH3;
+using Poco::XXH3Hash;
+
+
+namespace {
+
+
+//
+// Naming: Checksum_<Implementation>/<bytes>, Hash_<Implementation>/<bytes>,
+// HashMap_<HashFunction>_Find
+//
+
+
+const std::vector<char>& testData()
+{
+	static const std::vector<char> data = []()
+	{
+		std::vector<char> d(1 << 20);
+		Poco::UInt32 x = 1;
+		for (auto& c: d)
+		{
+			x = x*1103515245 + 12345;
+			c = static_cast<char>(x >> 16);
+		}
+		return d;
+	}();
+	return data;
+}
+
+
+void checksum(benchmark::State& state, Checksum::Type type)
+{
+	const char* data = testData().data();
+	const unsigned length = static_cast<unsigned>(state.range(0));
+	for (auto _ : state)
+	{
+		Checksum cs(type);
+		cs.update(data, length);
+		benchmark::DoNotOptimize(cs.checksum());
+	}
+	state.SetBytesProcessed(state.iterations()*state.range(0));
+}
+
+
+#if defined(POCO_BENCH_HAVE_ZLIB)
+
+
+static void Checksum_ZlibCRC32(benchmark::State& state)
+{
+	// Checksum::TYPE_CRC32 used zlib's crc32() before.
+	const Bytef* data = reinterpret_cast<const Bytef*>(testData().data());
+	const uInt length = static_cast<uInt>(state.range(0));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(crc32(0, data, length));
+	}
+	state.SetBytesProcessed(state.iterations()*state.range(0));
+}
+BENCHMARK(Checksum_ZlibCRC32)->RangeMultiplier(8)->Range(64, 1 << 20);
+
+
+#endif
+
+
+static void Checksum_CRC32(benchmark::State& state)
+{
+	checksum(state, Checksum::TYPE_CRC32);
+}
+BENCHMARK(Checksum_CRC32)->RangeMultiplier(8)->Range(64, 1 << 20);
+
+
+static void Checksum_CRC32C(benchmark::State& state)
+{
+	checksum(state, Checksum::TYPE_CRC32C);
+}
+BENCHMARK(Checksum_CRC32C)->RangeMultiplier(8)->Range(64, 1 << 20);
+
+
+static void Checksum_Adler32(benchmark::State& state)
+{
+	checksum(state, Checksum::TYPE_ADLER32);
+}
+BENCHMARK(Checksum_Adler32)->RangeMultiplier(8)->Range(64, 1 << 20);
+
+
+static void Hash_PocoHash(benchmark::State& state)
+{
+	const std::string str(testData().data(), static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(Poco::hash(str));
+	}
+	state.SetBytesProcessed(state.iterations()*state.range(0));
+}
+BENCHMARK(Hash_PocoHash)->RangeMultiplier(4)->Range(8, 1 << 16);
+
+
+static void Hash_StdHash(benchmark::State& state)
+{
+	const std::string str(testData().data(), static_cast<std::size_t>(state.range(0)));
+	std::hash<std::string> hasher;
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(hasher(str));
+	}
+	state.SetBytesProcessed(state.iterations()*state.range(0));
+}
+BENCHMARK(Hash_StdHash)->RangeMultiplier(4)->Range(8, 1 << 16);
+
+
+static void Hash_XXH3(benchmark::State& state)
+{
+	const std::string str(testData().data(), static_cast<std::size_t>(state.range(0)));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(XXH3::hash(str));
+	}
+	state.SetBytesProcessed(state.iterations()*state.range(0));
+}
+BENCHMARK(Hash_XXH3)->RangeMultiplier(4)->Range(8, 1 << 16);
+
+
+static void Hash_MD5(benchmark::State& state)
+{
+	// for comparison with the previous approach to content fingerprints
+	const char* data = testData().data();
+	const std::size_t length = static_cast<std::size_t>(state.range(0));
+	Poco::MD5Engine engine;
+	for (auto _ : state)
+	{
+		engine.update(data, length);
+		benchmark::DoNotOptimize(engine.digest());
+	}
+	state.SetBytesProcessed(state.iterations()*state.range(0));
+}
+BENCHMARK(Hash_MD5)->RangeMultiplier(16)->Range(64, 1 << 20);
+
+
+template <class H>
+void hashMapFind(benchmark::State& state)
+{
+	const int COUNT = 100000;
+	std::vector<std::string> keys;
+	keys.reserve(COUNT);
+	Poco::HashMap<std::string, int, H> map;
+	for (int i = 0; i < COUNT; i++)
+	{
+		// session-id-like keys
+		keys.push_back("session-" + Poco::NumberFormatter::formatHex(static_cast<unsigned>(i)*2654435761U, 16));
+		map[keys.back()] = i;
+	}
+	std::size_t i = 0;
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(map.find(keys[i]));
+		if (++i == keys.size()) i = 0;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+
+struct PocoStringHash
+{
+	std::size_t operator () (const std::string& value) const
+	{
+		return Poco::hash(value);
+	}
+};
+
+
+static void HashMap_PocoHash_Find(benchmark::State& state)
+{
+	hashMapFind<PocoStringHash>(state);
+}
+BENCHMARK(HashMap_PocoHash_Find);
+
+
+static void HashMap_XXH3Hash_Find(benchmark::State& state)
+{
+	hashMapFind<XXH3Hash<std::string>>(state);
+}
+BENCHMARK(HashMap_XXH3Hash_Find);
+
+
+} // namespace
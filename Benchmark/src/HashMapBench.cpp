@@ -0,0 +1,266 @@
+//
+// HashMapBench.cpp
+//
+// Benchmarks for HashMap (FlatHashTable) compared to LinearHashTable,
+// SimpleHashTable, OrderedMap (tsl::ordered_map) and std::unordered_map
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/HashMap.h"
+#include "Poco/LinearHashTable.h"
+#include "Poco/SimpleHashTable.h"
+#include "Poco/OrderedMap.h"
+#include "Poco/Hash.h"
+#include "Poco/NumberFormatter.h"
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+
+namespace {
+
+
+//
+// Naming: <Container>_<Operation>/<entries>
+//
+// HashMap is the FlatHashTable-based Poco::HashMap.
+// LinearHashTable is the previous implementation of Poco::HashMap
+// (LinearHashTable with HashMapEntry values).
+//
+
+
+using StringHashMap = Poco::HashMap<std::string, int>;
+using StringEntry = Poco::HashMapEntry<std::string, int>;
+using StringLinearHashTable = Poco::LinearHashTable<StringEntry, Poco::HashMapEntryHash<StringEntry, Poco::Hash<std::string>>>;
+using StringSimpleHashTable = Poco::SimpleHashTable<std::string, int>;
+using StringOrderedMap = Poco::OrderedMap<std::string, int>;
+using StringUnorderedMap = std::unordered_map<std::string, int>;
+
+
+std::vector<std::string> makeKeys(std::size_t count, unsigned salt = 0)
+{
+	// session-id-like keys
+	std::vector<std::string> keys;
+	keys.reserve(count);
+	for (std::size_t i = 0; i < count; i++)
+	{
+		keys.push_back("session-" + Poco::NumberFormatter::formatHex((static_cast<unsigned>(i) + salt)*2654435761U, 16));
+	}
+	return keys;
+}
+
+
+template <class M>
+void insertKey(M& map, const std::string& key, int value)
+{
+	map[key] = value;
+}
+
+
+void insertKey(StringLinearHashTable& table, const std::string& key, int value)
+{
+	table.insert(StringEntry(key, value));
+}
+
+
+void insertKey(StringSimpleHashTable& table, const std::string& key, int value)
+{
+	table.insert(key, value);
+}
+
+
+template <class M>
+bool findKey(const M& map, const std::string& key)
+{
+	return map.find(key) != map.end();
+}
+
+
+bool findKey(const StringLinearHashTable& table, const std::string& key)
+{
+	return table.find(StringEntry(key)) != table.end();
+}
+
+
+bool findKey(const StringSimpleHashTable& table, const std::string& key)
+{
+	return table.exists(key);
+}
+
+
+template <class M>
+M makeMap(std::size_t count)
+{
+	if constexpr (std::is_same_v<M, StringSimpleHashTable>)
+	{
+		// SimpleHashTable cannot grow automatically
+		return StringSimpleHashTable(static_cast<Poco::UInt32>(2*count + 1));
+	}
+	else
+	{
+		return M();
+	}
+}
+
+
+template <class M>
+void benchInsert(benchmark::State& state)
+{
+	const std::size_t count = static_cast<std::size_t>(state.range(0));
+	const std::vector<std::string> keys = makeKeys(count);
+	for (auto _ : state)
+	{
+		M map = makeMap<M>(count);
+		int i = 0;
+		for (const auto& key: keys)
+		{
+			insertKey(map, key, i++);
+		}
+		benchmark::DoNotOptimize(map);
+	}
+	state.SetItemsProcessed(state.iterations()*state.range(0));
+}
+
+
+template <class M>
+void benchFind(benchmark::State& state, bool hit)
+{
+	const std::size_t count = static_cast<std::size_t>(state.range(0));
+	const std::vector<std::string> keys = makeKeys(count);
+	const std::vector<std::string> lookups = hit ? keys : makeKeys(count, 0x10000000);
+	M map = makeMap<M>(count);
+	int n = 0;
+	for (const auto& key: keys)
+	{
+		insertKey(map, key, n++);
+	}
+	std::size_t i = 0;
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(findKey(map, lookups[i]));
+		if (++i == lookups.size()) i = 0;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+
+template <class M>
+void benchFindHit(benchmark::State& state)
+{
+	benchFind<M>(state, true);
+}
+
+
+template <class M>
+void benchFindMiss(benchmark::State& state)
+{
+	benchFind<M>(state, false);
+}
+
+
+template <class M>
+void benchIterate(benchmark::State& state)
+{
+	const std::size_t count = static_cast<std::size_t>(state.range(0));
+	M map;
+	int n = 0;
+	for (const auto& key: makeKeys(count))
+	{
+		insertKey(map, key, n++);
+	}
+	for (auto _ : state)
+	{
+		long sum = 0;
+		for (const auto& entry: map)
+		{
+			sum += entry.second;
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetItemsProcessed(state.iterations()*state.range(0));
+}
+
+
+#define HASHMAP_BENCHMARKS(name, type) \
+	static void name##_Insert(benchmark::State& state) { benchInsert<type>(state); } \
+	BENCHMARK(name##_Insert)->RangeMultiplier(16)->Range(16, 1 << 16); \
+	static void name##_FindHit(benchmark::State& state) { benchFindHit<type>(state); } \
+	BENCHMARK(name##_FindHit)->RangeMultiplier(16)->Range(16, 1 << 20); \
+	static void name##_FindMiss(benchmark::State& state) { benchFindMiss<type>(state); } \
+	BENCHMARK(name##_FindMiss)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+
+HASHMAP_BENCHMARKS(HashMap, StringHashMap)
+HASHMAP_BENCHMARKS(LinearHashTable, StringLinearHashTable)
+HASHMAP_BENCHMARKS(SimpleHashTable, StringSimpleHashTable)
+HASHMAP_BENCHMARKS(OrderedMap, StringOrderedMap)
+HASHMAP_BENCHMARKS(StdUnorderedMap, StringUnorderedMap)
+
+
+static void HashMap_Iterate(benchmark::State& state)
+{
+	benchIterate<StringHashMap>(state);
+}
+BENCHMARK(HashMap_Iterate)->Arg(1 << 16);
+
+
+static void OrderedMap_Iterate(benchmark::State& state)
+{
+	benchIterate<StringOrderedMap>(state);
+}
+BENCHMARK(OrderedMap_Iterate)->Arg(1 << 16);
+
+
+static void HashMap_FindStringView(benchmark::State& state)
+{
+	// heterogeneous lookup, no temporary std::string
+	const std::size_t count = static_cast<std::size_t>(state.range(0));
+	const std::vector<std::string> keys = makeKeys(count);
+	const std::string text = keys[count/2] + ";";
+	StringHashMap map;
+	int n = 0;
+	for (const auto& key: keys)
+	{
+		insertKey(map, key, n++);
+	}
+	for (auto _ : state)
+	{
+		std::string_view sv(text.data(), text.size() - 1);
+		benchmark::DoNotOptimize(map.find(sv));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(HashMap_FindStringView)->Arg(1 << 16);
+
+
+static void LinearHashTable_FindStringView(benchmark::State& state)
+{
+	// string_view lookups require a temporary std::string
+	const std::size_t count = static_cast<std::size_t>(state.range(0));
+	const std::vector<std::string> keys = makeKeys(count);
+	const std::string text = keys[count/2] + ";";
+	StringLinearHashTable table;
+	int n = 0;
+	for (const auto& key: keys)
+	{
+		insertKey(table, key, n++);
+	}
+	for (auto _ : state)
+	{
+		std::string_view sv(text.data(), text.size() - 1);
+		benchmark::DoNotOptimize(table.find(StringEntry(std::string(sv))));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(LinearHashTable_FindStringView)->Arg(1 << 16);
+
+
+} // namespace
@@ -0,0 +1,157 @@
+//
+// JSONBench.cpp
+//
+// Benchmarks for JSON::Parser and JSON::Document
+//
+// Copyright (c) 2004-2024, Applied Informatics Software Engineering GmbH.,
+// Aleph ONE Software Engineering LLC
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/JSON/Parser.h"
+#include "Poco/JSON/Document.h"
+#include "Poco/JSON/Object.h"
+#include "Poco/JSON/Array.h"
+#include "Poco/NumberFormatter.h"
+#include <string>
+
+
+using Poco::JSON::Parser;
+using Poco::JSON::Document;
+using Poco::JSON::Object;
+using Poco::JSON::Array;
+
+
+namespace {
+
+
+//
+// The payload resembles a typical API response: an array of
+// records with strings (some containing escape sequences),
+// integers, floating-point numbers, booleans and nested
+// objects and arrays.
+//
+// Naming: JSON_<Implementation>_<Test>
+//
+
+std::string makePayload(int records)
+{
+	std::string json("{\"status\":\"ok\",\"count\":");
+	Poco::NumberFormatter::append(json, records);
+	json += ",\"items\":[";
+	for (int i = 0; i < records; i++)
+	{
+		if (i > 0) json += ',';
+		json += "{\"id\":";
+		Poco::NumberFormatter::append(json, i);
+		json += ",\"name\":\"item-";
+		Poco::NumberFormatter::append(json, i);
+		json += "\",\"description\":\"A \\\"quoted\\\" description\\nwith two lines\",\"price\":";
+		Poco::NumberFormatter::append(json, i*0.25 + 1.5);
+		json += ",\"active\":";
+		json += (i % 3) ? "true" : "false";
+		json += ",\"tags\":[\"alpha\",\"beta\",\"gamma\"],\"owner\":{\"id\":";
+		Poco::NumberFormatter::append(json, i % 97);
+		json += ",\"email\":\"owner@example.com\",\"roles\":[\"admin\",\"user\"]},\"parent\":null}";
+	}
+	json += "]}";
+	return json;
+}
+
+
+const std::string& payload()
+{
+	static const std::string json = makePayload(10000);
+	return json;
+}
+
+
+static void JSON_Parser_Parse(benchmark::State& state)
+{
+	const std::string& json = payload();
+	for (auto _ : state)
+	{
+		Parser parser;
+		benchmark::DoNotOptimize(parser.parse(json));
+	}
+	state.SetBytesProcessed(state.iterations()*json.size());
+}
+BENCHMARK(JSON_Parser_Parse)->Unit(benchmark::kMillisecond);
+
+
+static void JSON_Document_Parse(benchmark::State& state)
+{
+	const std::string& json = payload();
+	Document doc;
+	for (auto _ : state)
+	{
+		doc.parse(json);
+		benchmark::DoNotOptimize(doc.root());
+	}
+	state.SetBytesProcessed(state.iterations()*json.size());
+}
+BENCHMARK(JSON_Document_Parse)->Unit(benchmark::kMillisecond);
+
+
+static void JSON_Parser_Query(benchmark::State& state)
+{
+	// Parse and sum up one field of every record.
+	const std::string& json = payload();
+	for (auto _ : state)
+	{
+		Parser parser;
+		Object::Ptr pRoot = parser.parse(json).extract<Object::Ptr>();
+		Array::Ptr pItems = pRoot->getArray("items");
+		double sum = 0;
+		for (std::size_t i = 0; i < pItems->size(); i++)
+		{
+			sum += pItems->getObject(static_cast<unsigned>(i))->getValue<double>("price");
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetBytesProcessed(state.iterations()*json.size());
+}
+BENCHMARK(JSON_Parser_Query)->Unit(benchmark::kMillisecond);
+
+
+static void JSON_Document_Query(benchmark::State& state)
+{
+	// Parse and sum up one field of every record.
+	const std::string& json = payload();
+	Document doc;
+	for (auto _ : state)
+	{
+		doc.parse(json);
+		double sum = 0;
+		for (Document::Value item: doc.root()["items"])
+		{
+			sum += item["price"].getDouble();
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+	state.SetBytesProcessed(state.iterations()*json.size());
+}
+BENCHMARK(JSON_Document_Query)->Unit(benchmark::kMillisecond);
+
+
+static void JSON_Document_ToVar(benchmark::State& state)
+{
+	// Parse and convert the complete document into Object/Array
+	// instances, i.e. the worst case for on-demand conversion.
+	const std::string& json = payload();
+	Document doc;
+	for (auto _ : state)
+	{
+		doc.parse(json);
+		benchmark::DoNotOptimize(doc.toVar());
+	}
+	state.SetBytesProcessed(state.iterations()*json.size());
+}
+BENCHMARK(JSON_Document_ToVar)->Unit(benchmark::kMillisecond);
+
+
+} // namespace
@@ -822,6 +822,136 @@ static void Logger_AsyncChannel_ToFile(benchmark::State& state)
 BENCHMARK(Logger_AsyncChannel_ToFile);
 
 
+//
+// AsyncChannel ring buffer benchmarks - AsyncChannel with the
+// "ringBufferSize" property set
+//
+// In ring buffer mode, log() moves the Message into a preallocated
+// slot of a lock-free ring buffer (one per processor) instead of
+// allocating a MessageNotification and locking the NotificationQueue.
+// The background thread forwards messages in batches.
+//
+// The _Threads variants log from several threads into the same
+// channel, which is where the single NotificationQueue mutex hurts
+// most. Compare Logger_AsyncChannel_Threads with Logger_AsyncRing_Threads.
+//
+
+static AutoPtr<AsyncChannel> createAsyncChannel(Channel::Ptr pChannel, const std::string& ringBufferSize, const std::string& overflowPolicy = "block")
+{
+	AutoPtr<AsyncChannel> pAsyncChannel(new AsyncChannel(pChannel));
+	pAsyncChannel->setProperty("ringBufferSize", ringBufferSize);
+	pAsyncChannel->setProperty("overflowPolicy", overflowPolicy);
+	pAsyncChannel->open();
+	return pAsyncChannel;
+}
+
+
+static void Logger_AsyncRing_NullChannel(benchmark::State& state)
+{
+	AutoPtr<NullChannel> pNullChannel(new NullChannel);
+	AutoPtr<AsyncChannel> pAsyncChannel = createAsyncChannel(pNullChannel, "8192");
+
+	Logger& logger = Logger::get("BenchLogger.AsyncRing.NullChannel");
+	logger.setChannel(pAsyncChannel);
+	logger.setLevel(Message::PRIO_TRACE);
+
+	for (auto _ : state)
+	{
+		logger.information("This is a test log message");
+	}
+
+	pAsyncChannel->close();
+}
+BENCHMARK(Logger_AsyncRing_NullChannel);
+
+
+static void Logger_AsyncRing_WithFormat(benchmark::State& state)
+{
+	AutoPtr<NullChannel> pNullChannel(new NullChannel);
+	AutoPtr<PatternFormatter> pFormatter(new PatternFormatter("%Y-%m-%d %H:%M:%S.%i [%p] %s: %t"));
+	AutoPtr<FormattingChannel> pFormattingChannel(new FormattingChannel(pFormatter, pNullChannel));
+	AutoPtr<AsyncChannel> pAsyncChannel = createAsyncChannel(pFormattingChannel, "8192");
+
+	Logger& logger = Logger::get("BenchLogger.AsyncRing.WithFormat");
+	logger.setChannel(pAsyncChannel);
+	logger.setLevel(Message::PRIO_TRACE);
+
+	for (auto _ : state)
+	{
+		logger.information("This is a test log message");
+	}
+
+	pAsyncChannel->close();
+}
+BENCHMARK(Logger_AsyncRing_WithFormat);
+
+
+static void Logger_AsyncRing_Drop(benchmark::State& state)
+{
+	// With the drop policy, the logging thread never waits for
+	// the background thread, even if it cannot keep up.
+	AutoPtr<NullChannel> pNullChannel(new NullChannel);
+	AutoPtr<PatternFormatter> pFormatter(new PatternFormatter("%Y-%m-%d %H:%M:%S.%i [%p] %s: %t"));
+	AutoPtr<FormattingChannel> pFormattingChannel(new FormattingChannel(pFormatter, pNullChannel));
+	AutoPtr<AsyncChannel> pAsyncChannel = createAsyncChannel(pFormattingChannel, "8192", "drop");
+
+	Logger& logger = Logger::get("BenchLogger.AsyncRing.Drop");
+	logger.setChannel(pAsyncChannel);
+	logger.setLevel(Message::PRIO_TRACE);
+
+	for (auto _ : state)
+	{
+		logger.information("This is a test log message");
+	}
+
+	pAsyncChannel->close();
+}
+BENCHMARK(Logger_AsyncRing_Drop);
+
+
+static AutoPtr<AsyncChannel> pSharedAsyncChannel;
+
+
+static void logThreads(benchmark::State& state, const std::string& ringBufferSize)
+{
+	Logger& logger = Logger::get("BenchLogger.AsyncThreads");
+	if (state.thread_index() == 0)
+	{
+		AutoPtr<NullChannel> pNullChannel(new NullChannel);
+		pSharedAsyncChannel = createAsyncChannel(pNullChannel, ringBufferSize);
+		logger.setChannel(pSharedAsyncChannel);
+		logger.setLevel(Message::PRIO_TRACE);
+	}
+
+	for (auto _ : state)
+	{
+		logger.information("This is a test log message");
+	}
+	state.SetItemsProcessed(state.iterations());
+
+	if (state.thread_index() == 0)
+	{
+		pSharedAsyncChannel->close();
+		logger.setChannel(nullptr);
+		pSharedAsyncChannel.reset();
+	}
+}
+
+
+static void Logger_AsyncChannel_Threads(benchmark::State& state)
+{
+	logThreads(state, "none");
+}
+BENCHMARK(Logger_AsyncChannel_Threads)->ThreadRange(1, 8)->UseRealTime();
+
+
+static void Logger_AsyncRing_Threads(benchmark::State& state)
+{
+	logThreads(state, "8192");
+}
+BENCHMARK(Logger_AsyncRing_Threads)->ThreadRange(1, 8)->UseRealTime();
+
+
 #ifdef POCO_ENABLE_FASTLOGGER
 
 //
@@ -1,7 +1,8 @@
 //
 // NotificationQueueBench.cpp
 //
-// Benchmarks for NotificationQueue, SPSCQueue, and MPSCQueue
+// Benchmarks for NotificationQueue, SPSCQueue, MPSCQueue,
+// NotificationCenter and AsyncNotificationCenter
 //
 // Copyright (c) 2004-2024, Applied Informatics Software Engineering GmbH.,
 // Aleph ONE Software Engineering LLC
@@ -16,18 +17,27 @@
 #include "Poco/SPSCQueue.h"
 #include "Poco/MPSCQueue.h"
 #include "Poco/Notification.h"
+#include "Poco/NotificationCenter.h"
+#include "Poco/AsyncNotificationCenter.h"
+#include "Poco/NObserver.h"
 #include "Poco/Message.h"
 #include "Poco/Thread.h"
 #include "Poco/Runnable.h"
 #include "Poco/Event.h"
 #include <atomic>
 #include <string>
+#include <vector>
+#include <memory>
 
 
 using Poco::NotificationQueue;
 using Poco::SPSCQueue;
 using Poco::MPSCQueue;
 using Poco::Notification;
+using Poco::NotificationCenter;
+using Poco::AsyncNotificationCenter;
+using Poco::NObserver;
+using Poco::AutoPtr;
 using Poco::Message;
 using Poco::Thread;
 using Poco::Event;
@@ -435,4 +445,135 @@ static void Queues_MPSCQueue_MessageMove(benchmark::State& state)
 BENCHMARK(Queues_MPSCQueue_MessageMove);
 
 
+//
+// NotificationCenter benchmarks
+// Posting to a static set of observers, from one or more threads
+//
+// Naming: NotificationCenter_<Test>/<observers>, AsyncNotificationCenter_<Mode>/<observers>
+//
+
+class BenchObserver
+{
+public:
+	void handle(const AutoPtr<BenchNotification>& /*pNf*/)
+	{
+		count.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	std::atomic<int64_t> count{0};
+};
+
+
+class ObserverSet
+	/// Registers a number of observers with a notification
+	/// center and removes them again.
+{
+public:
+	ObserverSet(NotificationCenter& nc, int count):
+		_nc(nc)
+	{
+		for (int i = 0; i < count; ++i)
+		{
+			_observers.push_back(std::make_unique<BenchObserver>());
+			_nc.addObserver(NObserver<BenchObserver, BenchNotification>(*_observers.back(), &BenchObserver::handle));
+		}
+	}
+
+	~ObserverSet()
+	{
+		for (auto& pObserver: _observers)
+		{
+			_nc.removeObserver(NObserver<BenchObserver, BenchNotification>(*pObserver, &BenchObserver::handle));
+		}
+	}
+
+	int64_t delivered() const
+	{
+		int64_t n = 0;
+		for (const auto& pObserver: _observers)
+		{
+			n += pObserver->count.load(std::memory_order_relaxed);
+		}
+		return n;
+	}
+
+private:
+	NotificationCenter& _nc;
+	std::vector<std::unique_ptr<BenchObserver>> _observers;
+};
+
+
+static void NotificationCenter_Post(benchmark::State& state)
+{
+	NotificationCenter nc;
+	ObserverSet observers(nc, static_cast<int>(state.range(0)));
+	Notification::Ptr pNf = new BenchNotification(42);
+
+	for (auto _ : state)
+	{
+		nc.postNotification(pNf);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(NotificationCenter_Post)->Arg(1)->Arg(4)->Arg(16);
+
+
+static void NotificationCenter_PostThreaded(benchmark::State& state)
+{
+	// All threads post to the same center; posting does not lock.
+	static NotificationCenter nc;
+	static ObserverSet observers(nc, 4);
+	Notification::Ptr pNf = new BenchNotification(42);
+
+	for (auto _ : state)
+	{
+		nc.postNotification(pNf);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(NotificationCenter_PostThreaded)->ThreadRange(1, 8)->UseRealTime();
+
+
+static void asyncNotificationCenter(benchmark::State& state, AsyncNotificationCenter& nc)
+{
+	// Measures posting and delivery of all notifications.
+	const int observerCount = static_cast<int>(state.range(0));
+	ObserverSet observers(nc, observerCount);
+	Notification::Ptr pNf = new BenchNotification(42);
+
+	for (auto _ : state)
+	{
+		nc.postNotification(pNf);
+	}
+	while (observers.delivered() < state.iterations()*observerCount)
+	{
+		Thread::yield();
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+
+static void AsyncNotificationCenter_Enqueue(benchmark::State& state)
+{
+	AsyncNotificationCenter nc;
+	asyncNotificationCenter(state, nc);
+}
+BENCHMARK(AsyncNotificationCenter_Enqueue)->Arg(1)->Arg(4)->UseRealTime();
+
+
+#if (POCO_HAVE_JTHREAD)
+
+
+static void AsyncNotificationCenter_Notify(benchmark::State& state)
+{
+	// per-observer queues, dispatched in batches by the worker threads
+	AsyncNotificationCenter nc(AsyncNotificationCenter::AsyncMode::NOTIFY);
+	asyncNotificationCenter(state, nc);
+}
+BENCHMARK(AsyncNotificationCenter_Notify)->Arg(1)->Arg(4)->Arg(16)->UseRealTime();
+
+
+#endif
+
+
 } // namespace
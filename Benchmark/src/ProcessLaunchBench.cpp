@@ -0,0 +1,124 @@
+//
+// ProcessLaunchBench.cpp
+//
+// Benchmarks for process launch latency with a large parent process
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/Process.h"
+#include "Poco/ProcessZygote.h"
+#include <cstring>
+#include <memory>
+#if defined(POCO_OS_FAMILY_UNIX)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+
+using Poco::Process;
+using Poco::ProcessHandle;
+using Poco::ProcessZygote;
+
+
+namespace {
+
+
+//
+// Naming: Launch_<Method>/<MB>
+//
+// Launches "true" and waits for it to terminate, after the benchmark
+// process has allocated and touched <MB> megabytes of memory.
+//
+// Methods:
+//   - ForkExec: fork() + execvp(), as Process::launch() did before
+//     posix_spawn() was used (baseline; Unix only).
+//   - Process: Process::launch().
+//   - Zygote: ProcessZygote::launch(), with the helper process
+//     created before any memory has been allocated.
+//
+
+
+ProcessZygote& zygote()
+{
+	static ProcessZygote z;
+	return z;
+}
+
+
+void allocate(std::size_t mb)
+{
+	// create the zygote while the process is still small
+	zygote();
+
+	static std::unique_ptr<char[]> pBallast;
+	static std::size_t ballastSize = 0;
+	if (ballastSize != mb)
+	{
+		pBallast.reset();
+		ballastSize = mb;
+		if (mb > 0)
+		{
+			pBallast.reset(new char[mb << 20]);
+			std::memset(pBallast.get(), 1, mb << 20);
+		}
+	}
+}
+
+
+static void Launch_ForkExec(benchmark::State& state)
+{
+#if defined(POCO_OS_FAMILY_UNIX)
+	allocate(static_cast<std::size_t>(state.range(0)));
+	char cmd[] = "true";
+	char* argv[] = {cmd, nullptr};
+	for (auto _ : state)
+	{
+		pid_t pid = fork();
+		if (pid == 0)
+		{
+			execvp(argv[0], argv);
+			_exit(72);
+		}
+		int status;
+		waitpid(pid, &status, 0);
+	}
+#else
+	state.SkipWithError("fork() not available");
+#endif
+}
+BENCHMARK(Launch_ForkExec)->Arg(0)->Arg(512)->Arg(2048)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+
+static void Launch_Process(benchmark::State& state)
+{
+	allocate(static_cast<std::size_t>(state.range(0)));
+	Process::Args args;
+	for (auto _ : state)
+	{
+		ProcessHandle ph = Process::launch("true", args);
+		ph.wait();
+	}
+}
+BENCHMARK(Launch_Process)->Arg(0)->Arg(512)->Arg(2048)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+
+static void Launch_Zygote(benchmark::State& state)
+{
+	allocate(static_cast<std::size_t>(state.range(0)));
+	Process::Args args;
+	for (auto _ : state)
+	{
+		ProcessHandle ph = zygote().launch("true", args);
+		ph.wait();
+	}
+}
+BENCHMARK(Launch_Zygote)->Arg(0)->Arg(512)->Arg(2048)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+
+} // namespace
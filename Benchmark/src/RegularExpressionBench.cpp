@@ -0,0 +1,135 @@
+//
+// RegularExpressionBench.cpp
+//
+// Benchmarks for RegularExpression matching
+//
+// Copyright (c) 2004-2024, Applied Informatics Software Engineering GmbH.,
+// Aleph ONE Software Engineering LLC
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/RegularExpression.h"
+#include <string>
+#include <string_view>
+
+
+using Poco::RegularExpression;
+
+
+namespace {
+
+
+//
+// Two typical workloads: extracting fields from a log line, and
+// matching a request line against a route.
+//
+// The JIT variants only differ from the interpreter variants if
+// POCO has been built against a PCRE2 library with JIT support
+// (see RegularExpression::isJIT()).
+//
+// Naming: RegularExpression_<Workload>_<Variant>
+//
+
+const std::string LOG_PATTERN("^(\\S+) (\\S+) \\[([^\\]]+)\\] \"(GET|POST|PUT|DELETE) ([^ ]+) HTTP/1\\.[01]\" ([0-9]{3}) ([0-9]+)$");
+const std::string LOG_LINE("10.0.0.17 - [16/Oct/2026:10:15:32 +0200] \"GET /api/v1/users/4711/orders?limit=20 HTTP/1.1\" 200 5123");
+
+const std::string ROUTE_PATTERN("^/api/v[0-9]+/users/([0-9]+)/orders(?:\\?.*)?$");
+const std::string REQUEST_LINE("GET /api/v1/users/4711/orders?limit=20 HTTP/1.1");
+
+
+void matchLog(benchmark::State& state, int options)
+{
+	RegularExpression re(LOG_PATTERN, options);
+	RegularExpression::MatchVec matches;
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(re.match(LOG_LINE, 0, matches));
+	}
+	state.SetBytesProcessed(state.iterations()*LOG_LINE.size());
+	state.SetLabel(re.isJIT() ? "jit" : "interpreter");
+}
+
+
+void matchRouteCopy(benchmark::State& state, int options)
+{
+	// The path is part of a larger buffer and must be
+	// copied into a std::string to be matched.
+	RegularExpression re(ROUTE_PATTERN, options);
+	RegularExpression::Match mtch;
+	for (auto _ : state)
+	{
+		std::string path(REQUEST_LINE, 4, REQUEST_LINE.size() - 13);
+		benchmark::DoNotOptimize(re.match(path, 0, mtch));
+	}
+	state.SetLabel(re.isJIT() ? "jit" : "interpreter");
+}
+
+
+void matchRouteView(benchmark::State& state, int options)
+{
+	// The path is matched in place.
+	RegularExpression re(ROUTE_PATTERN, options);
+	RegularExpression::Match mtch;
+	for (auto _ : state)
+	{
+		std::string_view path(REQUEST_LINE.data() + 4, REQUEST_LINE.size() - 13);
+		benchmark::DoNotOptimize(re.match(path, 0, mtch));
+	}
+	state.SetLabel(re.isJIT() ? "jit" : "interpreter");
+}
+
+
+static void RegularExpression_Log_Interpreter(benchmark::State& state)
+{
+	matchLog(state, 0);
+}
+BENCHMARK(RegularExpression_Log_Interpreter);
+
+
+static void RegularExpression_Log_JIT(benchmark::State& state)
+{
+	matchLog(state, RegularExpression::RE_JIT);
+}
+BENCHMARK(RegularExpression_Log_JIT);
+
+
+static void RegularExpression_Route_Interpreter_Copy(benchmark::State& state)
+{
+	matchRouteCopy(state, 0);
+}
+BENCHMARK(RegularExpression_Route_Interpreter_Copy);
+
+
+static void RegularExpression_Route_Interpreter_View(benchmark::State& state)
+{
+	matchRouteView(state, 0);
+}
+BENCHMARK(RegularExpression_Route_Interpreter_View);
+
+
+static void RegularExpression_Route_JIT_View(benchmark::State& state)
+{
+	matchRouteView(state, RegularExpression::RE_JIT);
+}
+BENCHMARK(RegularExpression_Route_JIT_View);
+
+
+static void RegularExpression_Route_Interpreter_View_Threads(benchmark::State& state)
+{
+	static RegularExpression re(ROUTE_PATTERN);
+	RegularExpression::Match mtch;
+	for (auto _ : state)
+	{
+		std::string_view path(REQUEST_LINE.data() + 4, REQUEST_LINE.size() - 13);
+		benchmark::DoNotOptimize(re.match(path, 0, mtch));
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(RegularExpression_Route_Interpreter_View_Threads)->ThreadRange(1, 16)->UseRealTime();
+
+
+} // namespace
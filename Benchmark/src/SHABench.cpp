@@ -0,0 +1,129 @@
+//
+// SHABench.cpp
+//
+// Benchmarks for SHA1Engine and SHA2Engine
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include <benchmark/benchmark.h>
+#include "Poco/SHA1Engine.h"
+#include "Poco/SHA2Engine.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+using Poco::SHA1Engine;
+using Poco::SHA2Engine;
+
+
+namespace {
+
+
+//
+// Naming: <Engine>_Update/<size>
+//
+// Hashes a single buffer of <size> bytes, including digest()
+// finalization. Uses SHA-NI or ARMv8 crypto extensions if the
+// processor supports them (see isAccelerated()).
+//
+// Naming: SHA256_DigestAll/<count>, SHA256_Sequential/<count>
+//
+// Hashes <count> independent 64 byte messages, either with
+// SHA2Engine::digestAll() or one after the other with a single
+// engine.
+//
+
+
+std::string testData(std::size_t size)
+{
+	std::string data(size, '\0');
+	for (std::size_t i = 0; i < size; i++) data[i] = static_cast<char>((i*7) % 251);
+	return data;
+}
+
+
+static void SHA1_Update(benchmark::State& state)
+{
+	const std::string data = testData(static_cast<std::size_t>(state.range(0)));
+	SHA1Engine engine;
+	for (auto _ : state)
+	{
+		engine.update(data);
+		benchmark::DoNotOptimize(engine.digest());
+	}
+	state.SetBytesProcessed(state.iterations()*static_cast<int64_t>(data.size()));
+	state.SetLabel(SHA1Engine::isAccelerated() ? "accelerated" : "generic");
+}
+BENCHMARK(SHA1_Update)->Arg(64)->Arg(1024)->Arg(65536);
+
+
+static void SHA256_Update(benchmark::State& state)
+{
+	const std::string data = testData(static_cast<std::size_t>(state.range(0)));
+	SHA2Engine engine(SHA2Engine::SHA_256);
+	for (auto _ : state)
+	{
+		engine.update(data);
+		benchmark::DoNotOptimize(engine.digest());
+	}
+	state.SetBytesProcessed(state.iterations()*static_cast<int64_t>(data.size()));
+	state.SetLabel(SHA2Engine::isAccelerated() ? "accelerated" : "generic");
+}
+BENCHMARK(SHA256_Update)->Arg(64)->Arg(1024)->Arg(65536);
+
+
+static void SHA512_Update(benchmark::State& state)
+{
+	const std::string data = testData(static_cast<std::size_t>(state.range(0)));
+	SHA2Engine engine(SHA2Engine::SHA_512);
+	for (auto _ : state)
+	{
+		engine.update(data);
+		benchmark::DoNotOptimize(engine.digest());
+	}
+	state.SetBytesProcessed(state.iterations()*static_cast<int64_t>(data.size()));
+}
+BENCHMARK(SHA512_Update)->Arg(64)->Arg(1024)->Arg(65536);
+
+
+static void SHA256_DigestAll(benchmark::State& state)
+{
+	const std::size_t count = static_cast<std::size_t>(state.range(0));
+	const std::string data = testData(64*count);
+	std::vector<std::string_view> messages;
+	for (std::size_t i = 0; i < count; i++) messages.push_back(std::string_view(data.data() + 64*i, 64));
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(SHA2Engine::digestAll(messages));
+	}
+	state.SetItemsProcessed(state.iterations()*static_cast<int64_t>(count));
+	state.SetLabel(SHA2Engine::isMultiBufferAccelerated() ? "multi-buffer" : "sequential");
+}
+BENCHMARK(SHA256_DigestAll)->Arg(8)->Arg(64)->Arg(1024);
+
+
+static void SHA256_Sequential(benchmark::State& state)
+{
+	const std::size_t count = static_cast<std::size_t>(state.range(0));
+	const std::string data = testData(64*count);
+	SHA2Engine engine(SHA2Engine::SHA_256);
+	for (auto _ : state)
+	{
+		for (std::size_t i = 0; i < count; i++)
+		{
+			engine.update(data.data() + 64*i, 64);
+			benchmark::DoNotOptimize(engine.digest());
+		}
+	}
+	state.SetItemsProcessed(state.iterations()*static_cast<int64_t>(count));
+}
+BENCHMARK(SHA256_Sequential)->Arg(8)->Arg(64)->Arg(1024);
+
+
+} // namespace
@@ -0,0 +1,187 @@
+//
+// CopyIn.h
+//
+// Library: Data/PostgreSQL
+// Package: PostgreSQL
+// Module:  CopyIn
+//
+// Definition of the CopyIn class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef SQL_PostgreSQL_CopyIn_INCLUDED
+#define SQL_PostgreSQL_CopyIn_INCLUDED
+
+
+#include "Poco/Data/PostgreSQL/PostgreSQL.h"
+#include "Poco/Data/PostgreSQL/SessionHandle.h"
+#include "Poco/Data/Session.h"
+#include "Poco/Data/LOB.h"
+#include "Poco/Data/Date.h"
+#include "Poco/Data/Time.h"
+#include "Poco/DateTime.h"
+#include "Poco/Nullable.h"
+#include "Poco/UUID.h"
+#include <string>
+#include <vector>
+
+
+namespace Poco {
+namespace Data {
+namespace PostgreSQL {
+
+
+class PostgreSQL_API CopyIn
+	/// Bulk loads rows into a table with COPY ... FROM STDIN, using
+	/// the binary COPY format. This is considerably faster than executing
+	/// an INSERT statement for every row, even with pipelining, as the
+	/// rows are streamed to the server without any per-row round trip
+	/// or statement execution.
+	///
+	/// The rows are given column-wise, as one std::vector per column:
+	///
+	///     std::vector<Int32> ids = ...;
+	///     std::vector<std::string> names = ...;
+	///     std::vector<Nullable<DateTime>> born = ...;
+	///
+	///     CopyIn copy(session, "Person", {"Id", "Name", "Born"});
+	///     copy.copy(ids, names, born);
+	///     std::size_t rows = copy.finish();
+	///
+	/// copy() can be called any number of times before finish(), e.g.
+	/// for data produced in batches. The rows are written to the server
+	/// while they are copied, without waiting for it to process them.
+	///
+	/// In the binary format, the server does not convert values, so the
+	/// C++ type of a column must match the type of the table column:
+	///
+	///   - Int16: smallint
+	///   - Int32: integer
+	///   - Int64: bigint
+	///   - float: real
+	///   - double: double precision
+	///   - bool: boolean
+	///   - std::string, CLOB: text, varchar, char
+	///   - BLOB: bytea
+	///   - Date: date
+	///   - Time: time
+	///   - DateTime: timestamp
+	///   - UUID: uuid
+	///   - Nullable<T>: the type of T, or NULL.
+	///
+	/// While the copy is in progress, the session cannot be used for
+	/// anything else. If the CopyIn is destroyed without finish() having
+	/// been called, the copy is aborted and no rows are inserted.
+{
+public:
+	CopyIn(Session& session, const std::string& table, const std::vector<std::string>& columns);
+		/// Starts copying rows into the given columns of the table.
+		/// Table and column names are inserted into the COPY statement
+		/// as given, so names needing quotes must be quoted by the caller.
+		///
+		/// Throws a PostgreSQLException if the COPY cannot be started,
+		/// e.g. because the table does not exist.
+
+	~CopyIn();
+		/// Aborts the copy if finish() has not been called.
+
+	template <typename... T>
+	void copy(const std::vector<T>&... columns)
+		/// Copies the rows given by the column vectors, which must
+		/// all have the same size, one vector for each column given
+		/// to the constructor.
+	{
+		static_assert(sizeof...(T) > 0, "at least one column is required");
+
+		const std::size_t sizes[] = { columns.size()... };
+		checkColumns(sizeof...(T), sizes);
+
+		for (std::size_t row = 0; row < sizes[0]; ++row)
+		{
+			writeInt16(static_cast<Poco::Int16>(sizeof...(T)));
+			(writeValue(columns[row]), ...);
+			if (_buffer.size() >= FLUSH_SIZE) flush();
+		}
+		_rows += sizes[0];
+	}
+
+	std::size_t finish();
+		/// Ends the copy, waits for the server to complete it, and
+		/// returns the number of inserted rows.
+		///
+		/// Throws a PostgreSQLException if the copy failed, e.g.
+		/// because a value violates a constraint. In this case,
+		/// no rows are inserted.
+
+	void abort(const std::string& message = "aborted by client");
+		/// Aborts the copy. No rows are inserted.
+
+	std::size_t rows() const;
+		/// Returns the number of rows copied so far.
+
+private:
+	static const std::size_t FLUSH_SIZE = 65536;
+
+	void checkColumns(std::size_t count, const std::size_t* sizes) const;
+	void flush();
+
+	void writeInt16(Poco::Int16 value);
+	void writeInt32(Poco::Int32 value);
+	void writeInt64(Poco::Int64 value);
+	void writeNull();
+	void writeField(const void* data, std::size_t size);
+
+	void writeValue(Poco::Int16 value);
+	void writeValue(Poco::Int32 value);
+	void writeValue(Poco::Int64 value);
+	void writeValue(float value);
+	void writeValue(double value);
+	void writeValue(bool value);
+	void writeValue(const std::string& value);
+	void writeValue(const CLOB& value);
+	void writeValue(const BLOB& value);
+	void writeValue(const Date& value);
+	void writeValue(const Time& value);
+	void writeValue(const DateTime& value);
+	void writeValue(const UUID& value);
+
+	template <typename T>
+	void writeValue(const Nullable<T>& value)
+	{
+		if (value.isNull())
+			writeNull();
+		else
+			writeValue(value.value());
+	}
+
+	CopyIn(const CopyIn&) = delete;
+	CopyIn& operator = (const CopyIn&) = delete;
+
+	SessionHandle& _sessionHandle;
+	std::size_t _columns;
+	std::size_t _rows;
+	bool _active;
+	std::string _buffer;
+};
+
+
+//
+// inlines
+//
+
+
+inline std::size_t CopyIn::rows() const
+{
+	return _rows;
+}
+
+
+} } } // namespace Poco::Data::PostgreSQL
+
+
+#endif // SQL_PostgreSQL_CopyIn_INCLUDED
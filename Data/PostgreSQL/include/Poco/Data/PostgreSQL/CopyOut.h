@@ -0,0 +1,97 @@
+//
+// CopyOut.h
+//
+// Library: Data/PostgreSQL
+// Package: PostgreSQL
+// Module:  CopyOut
+//
+// Definition of the CopyOut class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef SQL_PostgreSQL_CopyOut_INCLUDED
+#define SQL_PostgreSQL_CopyOut_INCLUDED
+
+
+#include "Poco/Data/PostgreSQL/PostgreSQL.h"
+#include "Poco/Data/PostgreSQL/SessionHandle.h"
+#include "Poco/Data/Session.h"
+#include <ostream>
+#include <string>
+
+
+namespace Poco {
+namespace Data {
+namespace PostgreSQL {
+
+
+class PostgreSQL_API CopyOut
+	/// Exports a table or the result of a query with COPY ... TO STDOUT.
+	///
+	/// The data is streamed from the server row by row, in the
+	/// text or CSV format produced by the server, without creating
+	/// a RecordSet:
+	///
+	///     CopyOut copy(session, "(SELECT * FROM Person WHERE Age > 30)");
+	///     copy.copyTo(ostr);
+	///
+	/// While the copy is in progress, the session cannot be used for
+	/// anything else. If the CopyOut is destroyed before all data has
+	/// been read, the copy is cancelled.
+{
+public:
+	CopyOut(Session& session, const std::string& source, const std::string& options = "FORMAT csv");
+		/// Starts copying from the given source, which is either a table
+		/// name, optionally followed by a list of columns, or a query
+		/// in parentheses. The options are inserted into the COPY statement
+		/// as given, e.g. "FORMAT csv, HEADER" or "FORMAT text, NULL ''".
+		///
+		/// Throws a PostgreSQLException if the COPY cannot be started.
+
+	~CopyOut();
+		/// Cancels the copy if not all data has been read.
+
+	bool read(std::string& row);
+		/// Reads the next row, including the line terminator, into row.
+		/// Returns false if all rows have been read.
+
+	std::streamsize copyTo(std::ostream& ostr);
+		/// Writes all remaining rows to the given stream.
+		/// Returns the number of bytes written.
+
+	std::size_t rows() const;
+		/// Returns the number of rows read so far.
+
+private:
+	void finish();
+	void cancel();
+
+	CopyOut(const CopyOut&) = delete;
+	CopyOut& operator = (const CopyOut&) = delete;
+
+	SessionHandle& _sessionHandle;
+	std::size_t _rows;
+	bool _active;
+};
+
+
+//
+// inlines
+//
+
+
+inline std::size_t CopyOut::rows() const
+{
+	return _rows;
+}
+
+
+} } } // namespace Poco::Data::PostgreSQL
+
+
+#endif // SQL_PostgreSQL_CopyOut_INCLUDED
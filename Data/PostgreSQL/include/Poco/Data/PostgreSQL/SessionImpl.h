@@ -124,6 +124,49 @@ public:
 		/// Returns true if binary extraction is enabled, otherwise false.
 		/// See setBinaryExtraction() for more information.
 
+	void setPipelining(const std::string& feature, bool enabled);
+		/// Sets the "pipelining" feature (default: disabled). If set, the
+		/// repeated executions of a statement that does not return rows,
+		/// e.g. an INSERT with bound std::vector values, are sent to the
+		/// server in libpq pipeline mode, without waiting for the result
+		/// of each execution. See StatementExecutor::executePipelined().
+		///
+		/// Note that this changes the error handling and transaction
+		/// semantics of such statements. The executions are sent in batches
+		/// of pipelineBatchSize, each ending with a synchronization point.
+		/// Outside of an explicit transaction, every batch is executed as
+		/// one implicit transaction. If an execution fails, the preceding
+		/// executions of its batch are rolled back, the following ones
+		/// are skipped, and the error is only reported when the whole
+		/// batch has been processed. Batches that have already been
+		/// completed stay committed, and later batches are not sent.
+
+	bool isPipelining(const std::string& feature = std::string()) const;
+		/// Returns true if pipelining is enabled.
+
+	void setPipelineBatchSize(const std::string& property, const Poco::Any& value);
+		/// Sets the "pipelineBatchSize" property (std::size_t, default: 1000),
+		/// the maximum number of pipelined executions sent to the server
+		/// before their results are received.
+
+	Poco::Any getPipelineBatchSize(const std::string& property = std::string()) const;
+		/// Returns the pipeline batch size.
+
+	void setFetchChunkSize(const std::string& property, const Poco::Any& value);
+		/// Sets the "fetchChunkSize" property (std::size_t, default: 0).
+		/// If not 0, the rows of a result are received from the server in
+		/// chunks of the given number of rows while they are fetched,
+		/// instead of all at once when the statement is executed, so that
+		/// large results can be processed without holding them in memory.
+		/// Chunks larger than one row require libpq 17; with older versions,
+		/// rows are received one at a time.
+		///
+		/// While the rows of a statement are being received, the session
+		/// cannot be used by other statements.
+
+	Poco::Any getFetchChunkSize(const std::string& property = std::string()) const;
+		/// Returns the fetch chunk size.
+
 	SessionHandle& handle();
 		/// Get handle
 
@@ -137,6 +180,9 @@ private:
 	mutable SessionHandle _sessionHandle;
 	std::size_t           _timeout = 0;
 	bool                  _binaryExtraction = false;
+	bool                  _pipelining = false;
+	std::size_t           _pipelineBatchSize = 1000;
+	std::size_t           _fetchChunkSize = 0;
 };
 
 
@@ -181,6 +227,36 @@ inline bool SessionImpl::isBinaryExtraction(const std::string&) const
 }
 
 
+inline void SessionImpl::setPipelining(const std::string&, bool enabled)
+{
+	_pipelining = enabled;
+}
+
+
+inline bool SessionImpl::isPipelining(const std::string&) const
+{
+	return _pipelining;
+}
+
+
+inline Poco::Any SessionImpl::getPipelineBatchSize(const std::string&) const
+{
+	return _pipelineBatchSize;
+}
+
+
+inline void SessionImpl::setFetchChunkSize(const std::string&, const Poco::Any& value)
+{
+	_fetchChunkSize = Poco::AnyCast<std::size_t>(value);
+}
+
+
+inline Poco::Any SessionImpl::getFetchChunkSize(const std::string&) const
+{
+	return _fetchChunkSize;
+}
+
+
 } } } // namespace Poco::Data::PostgreSQL
 
 
@@ -62,9 +62,52 @@ public:
 	void execute();
 		/// Executes the statement.
 
+	void executePipelined(bool last);
+		/// Executes the statement with the currently bound parameters
+		/// in libpq pipeline mode. The execution is queued without waiting
+		/// for its result, which saves a network round trip per execution
+		/// when a statement is executed repeatedly, e.g. for the elements
+		/// of bound containers.
+		///
+		/// The queued executions are sent to the server and their results
+		/// collected after every pipelineBatchSize executions, and when last
+		/// is true, which ends the pipeline. The affected row count is the
+		/// sum over all executions of the pipeline.
+		///
+		/// Each batch ends with a synchronization point. If an execution
+		/// fails, the remaining executions of its batch are skipped by the
+		/// server, and the error is thrown after the batch has been completed.
+		/// In autocommit mode, every batch is committed as one transaction.
+		///
+		/// If libpq has been built without pipeline support (before
+		/// PostgreSQL 14), the statement is executed with execute().
+
 	bool fetch();
 		/// Fetches the data for the current row
 
+	void setPipelining(bool enabled, std::size_t batchSize);
+		/// Enables or disables pipelined execution (see executePipelined()),
+		/// and sets the number of executions sent to the server at once.
+
+	bool isPipelining() const;
+		/// Returns true if pipelined execution is enabled.
+
+	bool inPipeline() const;
+		/// Returns true if a pipeline has been started by
+		/// executePipelined() and not finished yet.
+
+	void setFetchChunkSize(std::size_t chunkSize);
+		/// Sets the number of rows received from the server at once
+		/// for statements returning rows. If 0 (the default), the
+		/// complete result is received by execute(). Otherwise, rows
+		/// are received while they are fetched, so that large results
+		/// can be processed with constant memory. A chunk size of 1
+		/// uses single-row mode. Larger chunks need libpq 17 or newer;
+		/// with older versions, single-row mode is used instead.
+		///
+		/// The affected row count of a statement received in chunks
+		/// is the number of rows fetched so far.
+
 	std::size_t getAffectedRowCount() const;
 		/// get the count of rows affected by the statement
 
@@ -82,6 +125,10 @@ public:
 
 private:
 	void clearResults();
+	void buildParameters();
+	void syncPipeline(bool last);
+	bool nextResult();
+	void abortStream();
 
 	StatementExecutor(const StatementExecutor&) = delete;
 	StatementExecutor& operator= (const StatementExecutor&) = delete;
@@ -102,6 +149,20 @@ private:
 	OutputParameterVector _outputParameterVector;
 	std::size_t           _currentRow;			// current row of the result
 	std::size_t           _affectedRowCount;
+
+	std::vector<const char*> _parameterValues;	// parameters in the format required by libpq
+	std::vector<int>         _parameterLengths;
+	std::vector<int>         _parameterFormats;
+
+	bool        _pipelining;
+	std::size_t _pipelineBatchSize;
+	std::size_t _pipelineQueued;			// executions queued since the last synchronization point
+	bool        _inPipeline;
+
+	std::size_t _fetchChunkSize;
+	bool        _streaming;					// result is received in chunks
+	std::size_t _resultRow;					// current row of the current chunk
+	std::size_t _resultRowCount;				// rows of the current chunk
 };
 
 
@@ -116,6 +177,18 @@ inline StatementExecutor::operator PGresult* ()
 }
 
 
+inline bool StatementExecutor::isPipelining() const
+{
+	return _pipelining;
+}
+
+
+inline bool StatementExecutor::inPipeline() const
+{
+	return _inPipeline;
+}
+
+
 } } } // namespace Poco::Data::PostgreSQL
 
 
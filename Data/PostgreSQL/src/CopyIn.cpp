@@ -0,0 +1,315 @@
+//
+// CopyIn.cpp
+//
+// Library: Data/PostgreSQL
+// Package: PostgreSQL
+// Module:  CopyIn
+//
+// Implementation of the CopyIn class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/PostgreSQL/CopyIn.h"
+#include "Poco/Data/PostgreSQL/PostgreSQLException.h"
+#include "Poco/Data/PostgreSQL/PostgreSQLTypes.h"
+#include "Poco/Data/PostgreSQL/Utility.h"
+#include "Poco/NumberParser.h"
+#include "Poco/ByteOrder.h"
+#include <cstring>
+#include <limits>
+
+
+namespace
+{
+	// Signature, flags and header extension length of the binary COPY format.
+	const char COPY_HEADER[] = "PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0";
+	const std::size_t COPY_HEADER_SIZE = 19;
+
+	// Timestamps and dates are relative to 2000-01-01 in the binary format.
+	const Poco::Int64 POSTGRES_EPOCH_MICROSECONDS = Poco::Int64(946684800)*1000000;
+	const Poco::Int64 MICROSECONDS_PER_DAY = Poco::Int64(86400)*1000000;
+}
+
+
+namespace Poco {
+namespace Data {
+namespace PostgreSQL {
+
+
+CopyIn::CopyIn(Session& session, const std::string& table, const std::vector<std::string>& columns):
+	_sessionHandle(*Utility::handle(session)),
+	_columns(columns.size()),
+	_rows(0),
+	_active(false)
+{
+	if (columns.empty()) throw InvalidArgumentException("CopyIn requires at least one column");
+	if (!_sessionHandle.isConnected()) throw NotConnectedException();
+
+	std::string sql("COPY ");
+	sql += table;
+	sql += " (";
+	for (std::size_t i = 0; i < columns.size(); ++i)
+	{
+		if (i > 0) sql += ", ";
+		sql += columns[i];
+	}
+	sql += ") FROM STDIN (FORMAT binary)";
+
+	PGresult* pResult = nullptr;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		pResult = PQexec(_sessionHandle, sql.c_str());
+	}
+	PQResultClear resultClearer(pResult);
+	if (!pResult || PQresultStatus(pResult) != PGRES_COPY_IN)
+	{
+		const char* pSQLState = PQresultErrorField(pResult, PG_DIAG_SQLSTATE);
+		throw StatementException(std::string("postgresql_copy_in error: ") + (pResult ? PQresultErrorMessage(pResult) : _sessionHandle.lastError()) + " " + sql, pSQLState);
+	}
+
+	_active = true;
+	_buffer.reserve(FLUSH_SIZE + 4096);
+	_buffer.append(COPY_HEADER, COPY_HEADER_SIZE);
+}
+
+
+CopyIn::~CopyIn()
+{
+	try
+	{
+		if (_active) abort();
+	}
+	catch (...)
+	{
+	}
+}
+
+
+std::size_t CopyIn::finish()
+{
+	if (!_active) throw InvalidAccessException("COPY is not in progress");
+
+	writeInt16(-1); // file trailer
+	flush();
+	_active = false;
+
+	int ended = 0;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		ended = PQputCopyEnd(_sessionHandle, nullptr);
+	}
+	if (ended != 1)
+	{
+		throw PostgreSQLException(std::string("postgresql_copy_in error: ") + _sessionHandle.lastError());
+	}
+
+	std::size_t rows = 0;
+	std::string error;
+	std::string sqlState;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		while (PGresult* pResult = PQgetResult(_sessionHandle))
+		{
+			PQResultClear resultClearer(pResult);
+			if (PQresultStatus(pResult) == PGRES_COMMAND_OK)
+			{
+				int count = 0;
+				if (Poco::NumberParser::tryParse(PQcmdTuples(pResult), count) && count >= 0)
+					rows = static_cast<std::size_t>(count);
+			}
+			else if (error.empty())
+			{
+				error = PQresultErrorMessage(pResult);
+				const char* pSQLState = PQresultErrorField(pResult, PG_DIAG_SQLSTATE);
+				if (pSQLState) sqlState = pSQLState;
+			}
+		}
+	}
+	if (!error.empty())
+	{
+		throw StatementException(std::string("postgresql_copy_in error: ") + error, sqlState.empty() ? nullptr : sqlState.c_str());
+	}
+	return rows;
+}
+
+
+void CopyIn::abort(const std::string& message)
+{
+	if (!_active) return;
+
+	_active = false;
+	_buffer.clear();
+
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+	if (PQputCopyEnd(_sessionHandle, message.c_str()) == 1)
+	{
+		while (PGresult* pResult = PQgetResult(_sessionHandle))
+		{
+			PQclear(pResult);
+		}
+	}
+}
+
+
+void CopyIn::checkColumns(std::size_t count, const std::size_t* sizes) const
+{
+	if (!_active) throw InvalidAccessException("COPY is not in progress");
+	if (count != _columns) throw InvalidArgumentException("CopyIn: number of column vectors does not match number of columns");
+	for (std::size_t i = 1; i < count; ++i)
+	{
+		if (sizes[i] != sizes[0]) throw InvalidArgumentException("CopyIn: column vectors must have the same size");
+	}
+}
+
+
+void CopyIn::flush()
+{
+	if (_buffer.empty()) return;
+
+	int result = 0;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		result = PQputCopyData(_sessionHandle, _buffer.data(), static_cast<int>(_buffer.size()));
+	}
+	_buffer.clear();
+	if (result != 1)
+	{
+		std::string error = _sessionHandle.lastError();
+		abort();
+		throw PostgreSQLException(std::string("postgresql_copy_in error: ") + error);
+	}
+}
+
+
+void CopyIn::writeInt16(Poco::Int16 value)
+{
+	value = ByteOrder::toNetwork(value);
+	_buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+
+void CopyIn::writeInt32(Poco::Int32 value)
+{
+	value = ByteOrder::toNetwork(value);
+	_buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+
+void CopyIn::writeInt64(Poco::Int64 value)
+{
+	value = ByteOrder::toNetwork(value);
+	_buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+
+void CopyIn::writeNull()
+{
+	writeInt32(-1);
+}
+
+
+void CopyIn::writeField(const void* data, std::size_t size)
+{
+	if (size > static_cast<std::size_t>(std::numeric_limits<Poco::Int32>::max()))
+		throw InvalidArgumentException("CopyIn: value too large");
+
+	writeInt32(static_cast<Poco::Int32>(size));
+	_buffer.append(static_cast<const char*>(data), size);
+}
+
+
+void CopyIn::writeValue(Poco::Int16 value)
+{
+	writeInt32(sizeof(value));
+	writeInt16(value);
+}
+
+
+void CopyIn::writeValue(Poco::Int32 value)
+{
+	writeInt32(sizeof(value));
+	writeInt32(value);
+}
+
+
+void CopyIn::writeValue(Poco::Int64 value)
+{
+	writeInt32(sizeof(value));
+	writeInt64(value);
+}
+
+
+void CopyIn::writeValue(float value)
+{
+	Poco::Int32 bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	writeValue(bits);
+}
+
+
+void CopyIn::writeValue(double value)
+{
+	Poco::Int64 bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	writeValue(bits);
+}
+
+
+void CopyIn::writeValue(bool value)
+{
+	writeInt32(1);
+	_buffer += value ? '\1' : '\0';
+}
+
+
+void CopyIn::writeValue(const std::string& value)
+{
+	writeField(value.data(), value.size());
+}
+
+
+void CopyIn::writeValue(const CLOB& value)
+{
+	writeField(value.rawContent(), value.size());
+}
+
+
+void CopyIn::writeValue(const BLOB& value)
+{
+	writeField(value.rawContent(), value.size());
+}
+
+
+void CopyIn::writeValue(const Date& value)
+{
+	const Poco::Int64 days = DateTime(value.year(), value.month(), value.day()).timestamp().epochMicroseconds()/MICROSECONDS_PER_DAY;
+	writeValue(static_cast<Poco::Int32>(days - POSTGRES_EPOCH_MICROSECONDS/MICROSECONDS_PER_DAY));
+}
+
+
+void CopyIn::writeValue(const Time& value)
+{
+	writeValue(((value.hour()*Poco::Int64(60) + value.minute())*60 + value.second())*1000000);
+}
+
+
+void CopyIn::writeValue(const DateTime& value)
+{
+	writeValue(value.timestamp().epochMicroseconds() - POSTGRES_EPOCH_MICROSECONDS);
+}
+
+
+void CopyIn::writeValue(const UUID& value)
+{
+	char bytes[16];
+	value.copyTo(bytes);
+	writeField(bytes, sizeof(bytes));
+}
+
+
+} } } // namespace Poco::Data::PostgreSQL
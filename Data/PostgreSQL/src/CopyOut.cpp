@@ -0,0 +1,172 @@
+//
+// CopyOut.cpp
+//
+// Library: Data/PostgreSQL
+// Package: PostgreSQL
+// Module:  CopyOut
+//
+// Implementation of the CopyOut class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Data/PostgreSQL/CopyOut.h"
+#include "Poco/Data/PostgreSQL/PostgreSQLException.h"
+#include "Poco/Data/PostgreSQL/PostgreSQLTypes.h"
+#include "Poco/Data/PostgreSQL/Utility.h"
+
+
+namespace Poco {
+namespace Data {
+namespace PostgreSQL {
+
+
+CopyOut::CopyOut(Session& session, const std::string& source, const std::string& options):
+	_sessionHandle(*Utility::handle(session)),
+	_rows(0),
+	_active(false)
+{
+	if (!_sessionHandle.isConnected()) throw NotConnectedException();
+
+	std::string sql("COPY ");
+	sql += source;
+	sql += " TO STDOUT";
+	if (!options.empty())
+	{
+		sql += " (";
+		sql += options;
+		sql += ")";
+	}
+
+	PGresult* pResult = nullptr;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		pResult = PQexec(_sessionHandle, sql.c_str());
+	}
+	PQResultClear resultClearer(pResult);
+	if (!pResult || PQresultStatus(pResult) != PGRES_COPY_OUT)
+	{
+		const char* pSQLState = PQresultErrorField(pResult, PG_DIAG_SQLSTATE);
+		throw StatementException(std::string("postgresql_copy_out error: ") + (pResult ? PQresultErrorMessage(pResult) : _sessionHandle.lastError()) + " " + sql, pSQLState);
+	}
+	_active = true;
+}
+
+
+CopyOut::~CopyOut()
+{
+	try
+	{
+		if (_active) cancel();
+	}
+	catch (...)
+	{
+	}
+}
+
+
+bool CopyOut::read(std::string& row)
+{
+	if (!_active) return false;
+
+	char* pBuffer = nullptr;
+	int length = 0;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		length = PQgetCopyData(_sessionHandle, &pBuffer, 0);
+	}
+	if (length > 0)
+	{
+		row.assign(pBuffer, length);
+		PQfreemem(pBuffer);
+		++_rows;
+		return true;
+	}
+	else if (length == -1)
+	{
+		finish();
+		return false;
+	}
+	else
+	{
+		std::string error = _sessionHandle.lastError();
+		cancel();
+		throw PostgreSQLException(std::string("postgresql_copy_out error: ") + error);
+	}
+}
+
+
+std::streamsize CopyOut::copyTo(std::ostream& ostr)
+{
+	std::streamsize bytes = 0;
+	std::string row;
+	while (read(row))
+	{
+		ostr.write(row.data(), row.size());
+		bytes += static_cast<std::streamsize>(row.size());
+	}
+	return bytes;
+}
+
+
+void CopyOut::finish()
+{
+	// Receives the final result of the COPY command,
+	// which reports errors that occurred while copying.
+
+	_active = false;
+
+	std::string error;
+	std::string sqlState;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		while (PGresult* pResult = PQgetResult(_sessionHandle))
+		{
+			PQResultClear resultClearer(pResult);
+			if (PQresultStatus(pResult) != PGRES_COMMAND_OK && error.empty())
+			{
+				error = PQresultErrorMessage(pResult);
+				const char* pSQLState = PQresultErrorField(pResult, PG_DIAG_SQLSTATE);
+				if (pSQLState) sqlState = pSQLState;
+			}
+		}
+	}
+	if (!error.empty())
+	{
+		throw StatementException(std::string("postgresql_copy_out error: ") + error, sqlState.empty() ? nullptr : sqlState.c_str());
+	}
+}
+
+
+void CopyOut::cancel()
+{
+	_active = false;
+	if (!_sessionHandle.isConnected()) return;
+
+	try
+	{
+		_sessionHandle.cancel();
+	}
+	catch (...)
+	{
+	}
+
+	// Discard the remaining data and results.
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+	char* pBuffer = nullptr;
+	while (PQgetCopyData(_sessionHandle, &pBuffer, 0) > 0)
+	{
+		PQfreemem(pBuffer);
+	}
+	while (PGresult* pResult = PQgetResult(_sessionHandle))
+	{
+		PQclear(pResult);
+	}
+}
+
+
+} } } // namespace Poco::Data::PostgreSQL
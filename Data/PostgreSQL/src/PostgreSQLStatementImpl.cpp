@@ -27,6 +27,9 @@ PostgreSQLStatementImpl::PostgreSQLStatementImpl(SessionImpl& aSessionImpl):
 	_pBinder(new Binder),
 	_hasNext(NEXT_DONTKNOW)
 {
+	_statementExecutor.setPipelining(aSessionImpl.isPipelining(), Poco::AnyCast<std::size_t>(aSessionImpl.getPipelineBatchSize()));
+	_statementExecutor.setFetchChunkSize(Poco::AnyCast<std::size_t>(aSessionImpl.getFetchChunkSize()));
+
 	if (aSessionImpl.isBinaryExtraction())
 		_pExtractor = new BinaryExtractor(_statementExecutor);
 	else
@@ -151,7 +154,17 @@ void PostgreSQLStatementImpl::bindImpl()
 
 	_statementExecutor.bindParams(_pBinder->bindVector());
 
-	_statementExecutor.execute();
+	// Bound containers are executed once per element. Unless the
+	// statement returns rows, the executions are pipelined.
+	if (_statementExecutor.isPipelining() && columnsReturned() == 0 &&
+		(canBind() || _statementExecutor.inPipeline()))
+	{
+		_statementExecutor.executePipelined(!canBind());
+	}
+	else
+	{
+		_statementExecutor.execute();
+	}
 
 	_hasNext = NEXT_DONTKNOW;
 }
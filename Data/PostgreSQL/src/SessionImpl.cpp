@@ -152,6 +152,18 @@ void SessionImpl::open(const std::string& aConnectionString)
 		&SessionImpl::setBinaryExtraction,
 		&SessionImpl::isBinaryExtraction);
 
+	addFeature("pipelining",
+		&SessionImpl::setPipelining,
+		&SessionImpl::isPipelining);
+
+	addProperty("pipelineBatchSize",
+		&SessionImpl::setPipelineBatchSize,
+		&SessionImpl::getPipelineBatchSize);
+
+	addProperty("fetchChunkSize",
+		&SessionImpl::setFetchChunkSize,
+		&SessionImpl::getFetchChunkSize);
+
 	setName();
 }
 
@@ -260,7 +272,7 @@ bool SessionImpl::hasTransactionIsolation(Poco::UInt32 aTI) const
 }
 
 
-void SessionImpl::setBinaryExtraction(const std::string& feature, bool enabled)
+void SessionImpl::setBinaryExtraction(const std::string&, bool enabled)
 {
 	if (enabled && _sessionHandle.parameterStatus("integer_datetimes") != "on")
 		throw PostgreSQLException("binary extraction is not supported with this server (ingeger_datetimes must be enabled on the server)");
@@ -269,4 +281,13 @@ void SessionImpl::setBinaryExtraction(const std::string& feature, bool enabled)
 }
 
 
+void SessionImpl::setPipelineBatchSize(const std::string&, const Poco::Any& value)
+{
+	std::size_t batchSize = Poco::AnyCast<std::size_t>(value);
+	if (batchSize == 0) throw Poco::InvalidArgumentException("pipelineBatchSize must not be 0");
+
+	_pipelineBatchSize = batchSize;
+}
+
+
 } } } // namespace Poco::Data::PostgreSQL
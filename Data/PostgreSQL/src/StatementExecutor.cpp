@@ -64,6 +64,42 @@ namespace
 
 		return placeholderSet.size();
 	}
+
+
+	[[noreturn]] void throwExecuteError(PGresult* pResult)
+	{
+		Poco::Data::PostgreSQL::PQResultClear resultClearer(pResult);
+
+		const char* pSeverity	= PQresultErrorField(pResult, PG_DIAG_SEVERITY);
+		const char* pSQLState	= PQresultErrorField(pResult, PG_DIAG_SQLSTATE);
+		const char* pDetail		= PQresultErrorField(pResult, PG_DIAG_MESSAGE_DETAIL);
+		const char* pHint		= PQresultErrorField(pResult, PG_DIAG_MESSAGE_HINT);
+		const char* pConstraint	= PQresultErrorField(pResult, PG_DIAG_CONSTRAINT_NAME);
+
+		throw Poco::Data::PostgreSQL::StatementException(std::string("postgresql_stmt_execute error: ")
+			+ PQresultErrorMessage (pResult)
+			+ " Severity: " + (pSeverity   ? pSeverity   : "N/A")
+			+ " State: " + (pSQLState   ? pSQLState   : "N/A")
+			+ " Detail: " + (pDetail ? pDetail : "N/A")
+			+ " Hint: " + (pHint   ? pHint   : "N/A")
+			+ " Constraint: " + (pConstraint ? pConstraint : "N/A"),pSQLState);
+	}
+
+
+	std::size_t commandRowCount(PGresult* pResult)
+	{
+		// non Select DML statments also have an affected row count.
+		// unfortunately PostgreSQL offers up this count as a char * - go figure!
+		int affectedRowCount = 0;
+		const char* pNonSelectAffectedRowCountString = PQcmdTuples(pResult);
+		if (nullptr != pNonSelectAffectedRowCountString
+			&& Poco::NumberParser::tryParse(pNonSelectAffectedRowCountString, affectedRowCount)
+			&& affectedRowCount >= 0)
+		{
+			return static_cast<std::size_t>(affectedRowCount);
+		}
+		return 0;
+	}
 } // namespace
 
 
@@ -79,7 +115,15 @@ StatementExecutor::StatementExecutor(SessionHandle& sessionHandle, bool binaryEx
 	_pResultHandle(nullptr),
 	_countPlaceholdersInSQLStatement(0),
 	_currentRow(0),
-	_affectedRowCount(0)
+	_affectedRowCount(0),
+	_pipelining(false),
+	_pipelineBatchSize(1000),
+	_pipelineQueued(0),
+	_inPipeline(false),
+	_fetchChunkSize(0),
+	_streaming(false),
+	_resultRow(0),
+	_resultRowCount(0)
 {
 }
 
@@ -88,13 +132,14 @@ StatementExecutor::~StatementExecutor()
 {
 	try
 	{
+		// a pending result must be received before the connection can be used again
+		clearResults();
+
 		// remove the prepared statement from the session
 		if(_sessionHandle.isConnected() && _state >= STMT_COMPILED)
 		{
 			_sessionHandle.deallocatePreparedStatement(_preparedStatementName);
 		}
-
-		PQResultClear resultClearer(_pResultHandle);
 	}
 	catch (...)
 	{
@@ -222,37 +267,45 @@ void StatementExecutor::execute()
 		throw StatementException("Count of Parameters in Statement different than supplied parameters");
 	}
 
-	// "transmogrify" the _inputParameterVector to the C format required by PQexecPrepared
-
-	/* - from example
-		const char *paramValues[1];
-		int paramLengths[1];
-		int paramFormats[1];
-	*/
-
-	std::vector<const char *> pParameterVector;
-	std::vector<int>  parameterLengthVector;
-	std::vector<int>  parameterFormatVector;
+	buildParameters();
 
-	InputParameterVector::const_iterator cItr    = _inputParameterVector.begin();
-	InputParameterVector::const_iterator cItrEnd = _inputParameterVector.end();
+	// clear out any result data.  One way or another it is now obsolete.
+	clearResults();
 
-	for (; cItr != cItrEnd; ++cItr)
+	if (_fetchChunkSize > 0 && columnsReturned() > 0)
 	{
-		try
+		// Receive the rows while they are fetched.
+		int sent = 0;
 		{
-			pParameterVector.push_back  (static_cast<const char*>(cItr->pInternalRepresentation()));
-			parameterLengthVector.push_back((int)cItr->size());
-			parameterFormatVector.push_back((int)cItr->isBinary() ? 1 : 0);
+			Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+
+			sent = PQsendQueryPrepared(_sessionHandle,
+				_preparedStatementName.c_str(), (int)_countPlaceholdersInSQLStatement,
+				_parameterValues.empty() ? nullptr : &_parameterValues[0],
+				_parameterLengths.empty() ? nullptr : &_parameterLengths[0],
+				_parameterFormats.empty() ? nullptr : &_parameterFormats[0],
+				_binaryExtraction ? 1 : 0);
+
+			if (sent)
+			{
+#ifdef LIBPQ_HAS_CHUNK_MODE
+				if (_fetchChunkSize > 1)
+					PQsetChunkedRowsMode(_sessionHandle, static_cast<int>(_fetchChunkSize));
+				else
+#endif
+					PQsetSingleRowMode(_sessionHandle);
+			}
 		}
-		catch (std::bad_alloc&)
+		if (!sent)
 		{
-			throw StatementException("Memory Allocation Error");
+			throw StatementException(std::string("postgresql_stmt_execute error: ") + _sessionHandle.lastError());
 		}
-	}
 
-	// clear out any result data.  One way or another it is now obsolete.
-	clearResults();
+		_streaming = true;
+		nextResult(); // reports errors detected before the first row
+		_state = STMT_EXECUTED;
+		return;
+	}
 
 	PGresult* ptrPGResult = nullptr;
 	{
@@ -260,9 +313,9 @@ void StatementExecutor::execute()
 
 		ptrPGResult = PQexecPrepared(_sessionHandle,
 			_preparedStatementName.c_str(), (int)_countPlaceholdersInSQLStatement,
-			_inputParameterVector.size() != 0 ? &pParameterVector[ 0 ] : nullptr,
-			_inputParameterVector.size() != 0 ? &parameterLengthVector[ 0 ] : nullptr,
-			_inputParameterVector.size() != 0 ? &parameterFormatVector[ 0 ] : nullptr,
+			_parameterValues.empty() ? nullptr : &_parameterValues[0],
+			_parameterLengths.empty() ? nullptr : &_parameterLengths[0],
+			_parameterFormats.empty() ? nullptr : &_parameterFormats[0],
 			_binaryExtraction ? 1 : 0);
 	}
 
@@ -271,33 +324,16 @@ void StatementExecutor::execute()
 	if (!ptrPGResult || (PQresultStatus(ptrPGResult) != PGRES_COMMAND_OK &&
 		PQresultStatus(ptrPGResult) != PGRES_TUPLES_OK))
 	{
-		PQResultClear resultClearer(ptrPGResult);
-
-		const char* pSeverity	= PQresultErrorField(ptrPGResult, PG_DIAG_SEVERITY);
-		const char* pSQLState	= PQresultErrorField(ptrPGResult, PG_DIAG_SQLSTATE);
-		const char* pDetail		= PQresultErrorField(ptrPGResult, PG_DIAG_MESSAGE_DETAIL);
-		const char* pHint		= PQresultErrorField(ptrPGResult, PG_DIAG_MESSAGE_HINT);
-		const char* pConstraint	= PQresultErrorField(ptrPGResult, PG_DIAG_CONSTRAINT_NAME);
-
-				
-		throw StatementException(std::string("postgresql_stmt_execute error: ")
-			+ PQresultErrorMessage (ptrPGResult)
-			+ " Severity: " + (pSeverity   ? pSeverity   : "N/A")
-			+ " State: " + (pSQLState   ? pSQLState   : "N/A")
-			+ " Detail: " + (pDetail ? pDetail : "N/A")
-			+ " Hint: " + (pHint   ? pHint   : "N/A")
-			+ " Constraint: " + (pConstraint ? pConstraint : "N/A"),pSQLState);
+		throwExecuteError(ptrPGResult);
 	}
 
 	_pResultHandle = ptrPGResult;
 
 	// are there any results?
 
-	int affectedRowCount = 0;
-
 	if (PGRES_TUPLES_OK == PQresultStatus(_pResultHandle))
 	{
-		affectedRowCount = PQntuples(_pResultHandle);
+		int affectedRowCount = PQntuples(_pResultHandle);
 
 		if (affectedRowCount >= 0)
 		{
@@ -305,22 +341,149 @@ void StatementExecutor::execute()
 		}
 	}
 	else
-	{	// non Select DML statments also have an affected row count.
-		// unfortunately PostgreSQL offers up this count as a char * - go figure!
-		const char * pNonSelectAffectedRowCountString = PQcmdTuples(_pResultHandle);
-		if (nullptr != pNonSelectAffectedRowCountString)
+	{
+		_affectedRowCount = commandRowCount(_pResultHandle);
+		_currentRow = _affectedRowCount;  // no fetching on these statements!
+	}
+
+	_state = STMT_EXECUTED;
+}
+
+
+void StatementExecutor::executePipelined(bool last)
+{
+#ifdef LIBPQ_HAS_PIPELINING
+	if (!_sessionHandle.isConnected()) throw NotConnectedException();
+
+	if (_state < STMT_COMPILED) throw StatementException("Statement is not compiled yet");
+
+	if (_countPlaceholdersInSQLStatement != 0 &&
+		_inputParameterVector.size() != _countPlaceholdersInSQLStatement)
+	{
+		throw StatementException("Count of Parameters in Statement different than supplied parameters");
+	}
+
+	buildParameters();
+
+	if (!_inPipeline)
+	{
+		clearResults();
+
+		int entered = 0;
+		{
+			Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+			entered = PQenterPipelineMode(_sessionHandle);
+		}
+		if (!entered)
 		{
-			if	(	Poco::NumberParser::tryParse(pNonSelectAffectedRowCountString, affectedRowCount)
-				 && affectedRowCount >= 0
-				)
+			throw StatementException(std::string("postgresql_stmt_execute error: ") + _sessionHandle.lastError());
+		}
+		_inPipeline = true;
+		_pipelineQueued = 0;
+	}
+
+	int sent = 0;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+
+		sent = PQsendQueryPrepared(_sessionHandle,
+			_preparedStatementName.c_str(), (int)_countPlaceholdersInSQLStatement,
+			_parameterValues.empty() ? nullptr : &_parameterValues[0],
+			_parameterLengths.empty() ? nullptr : &_parameterLengths[0],
+			_parameterFormats.empty() ? nullptr : &_parameterFormats[0],
+			_binaryExtraction ? 1 : 0);
+	}
+	if (!sent)
+	{
+		std::string error = _sessionHandle.lastError();
+		try
+		{
+			syncPipeline(true);
+		}
+		catch (...)
+		{
+		}
+		throw StatementException(std::string("postgresql_stmt_execute error: ") + error);
+	}
+
+	_state = STMT_EXECUTED;
+	if (last || ++_pipelineQueued >= _pipelineBatchSize)
+	{
+		syncPipeline(last);
+	}
+#else
+	execute();
+#endif
+}
+
+
+void StatementExecutor::syncPipeline(bool last)
+{
+#ifdef LIBPQ_HAS_PIPELINING
+	// Sends the queued executions, and receives their results
+	// up to and including the synchronization point.
+
+	PGresult* pError = nullptr;
+	std::size_t affectedRowCount = 0;
+	bool synced = false;
+	{
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+
+		if (PQpipelineSync(_sessionHandle))
+		{
+			// Every result of the pipeline is followed by a null result.
+			// Two null results in a row mean that nothing more will
+			// be received, e.g. because the connection has been lost.
+			int nullResults = 0;
+			while (nullResults < 2)
 			{
-				_affectedRowCount = static_cast<std::size_t>(affectedRowCount);
-				_currentRow = _affectedRowCount;  // no fetching on these statements!
+				PGresult* pResult = PQgetResult(_sessionHandle);
+				if (!pResult)
+				{
+					++nullResults;
+					continue;
+				}
+				nullResults = 0;
+
+				ExecStatusType status = PQresultStatus(pResult);
+				if (status == PGRES_PIPELINE_SYNC)
+				{
+					PQclear(pResult);
+					synced = true;
+					break;
+				}
+				else if (status == PGRES_COMMAND_OK)
+				{
+					affectedRowCount += commandRowCount(pResult);
+				}
+				else if (status != PGRES_TUPLES_OK && status != PGRES_PIPELINE_ABORTED && !pError)
+				{
+					pError = pResult;
+					continue;
+				}
+				PQclear(pResult);
 			}
 		}
+		_pipelineQueued = 0;
+		if (last || !synced || pError)
+		{
+			PQexitPipelineMode(_sessionHandle);
+			_inPipeline = false;
+		}
 	}
 
-	_state = STMT_EXECUTED;
+	_affectedRowCount += affectedRowCount;
+	_currentRow = _affectedRowCount;  // no fetching on these statements!
+
+	if (pError)
+	{
+		throwExecuteError(pError);
+	}
+	if (!synced)
+	{
+		throw StatementException(std::string("postgresql_stmt_execute error: ") + _sessionHandle.lastError());
+	}
+#endif
 }
 
 
@@ -345,29 +508,43 @@ bool StatementExecutor::fetch()
 		_outputParameterVector.resize(countColumns);
 	}
 
-	// already retrieved last row?
-	if (_currentRow == getAffectedRowCount())
+	std::size_t row = _currentRow;
+	if (_streaming)
 	{
-		return false;
+		// next chunk needed?
+		if (_resultRow == _resultRowCount && !nextResult())
+		{
+			return false;
+		}
+		row = _resultRow++;
+		++_affectedRowCount;
 	}
-
-	if	(0 == countColumns || PGRES_TUPLES_OK != PQresultStatus(_pResultHandle))
+	else
 	{
-		return false;
+		// already retrieved last row?
+		if (_currentRow == getAffectedRowCount())
+		{
+			return false;
+		}
+
+		if	(0 == countColumns || PGRES_TUPLES_OK != PQresultStatus(_pResultHandle))
+		{
+			return false;
+		}
 	}
 
-	for (int i = 0; i < countColumns; ++i)
+	for (int i = 0; i < static_cast<int>(countColumns); ++i)
 	{
-		int fieldLength = PQgetlength(_pResultHandle, static_cast<int> (_currentRow), static_cast<int> (i));
+		int fieldLength = PQgetlength(_pResultHandle, static_cast<int> (row), static_cast<int> (i));
 
 		Oid columnInternalDataType = PQftype(_pResultHandle, i);  // Oid of column
 
 		_outputParameterVector.at(i).setValues(oidToColumnDataType(columnInternalDataType), // Poco::Data::MetaData version of the Column Data Type
 			columnInternalDataType, // Postgres Version
 			_currentRow, // the row number of the result
-			PQgetvalue(_pResultHandle, (int)_currentRow, i), // a pointer to the data
+			PQgetvalue(_pResultHandle, (int)row, i), // a pointer to the data
 			(-1 == fieldLength ? 0 : fieldLength), // the length of the data returned
-			PQgetisnull(_pResultHandle, (int)_currentRow, i) == 1 ? true : false); // is the column value null?
+			PQgetisnull(_pResultHandle, (int)row, i) == 1 ? true : false); // is the column value null?
 	}
 
 	++_currentRow;
@@ -375,6 +552,21 @@ bool StatementExecutor::fetch()
 }
 
 
+void StatementExecutor::setPipelining(bool enabled, std::size_t batchSize)
+{
+	if (batchSize == 0) throw InvalidArgumentException("pipeline batch size must not be 0");
+
+	_pipelining = enabled;
+	_pipelineBatchSize = batchSize;
+}
+
+
+void StatementExecutor::setFetchChunkSize(std::size_t chunkSize)
+{
+	_fetchChunkSize = chunkSize;
+}
+
+
 std::size_t StatementExecutor::getAffectedRowCount() const
 {
 	return _affectedRowCount;
@@ -411,14 +603,143 @@ const OutputParameter& StatementExecutor::resultColumn(std::size_t aPosition) co
 
 void StatementExecutor::clearResults()
 {
+	if (_inPipeline)
+	{
+		try
+		{
+			syncPipeline(true);
+		}
+		catch (...)
+		{
+		}
+	}
+
 	// clear out any old result first
 	{
 		PQResultClear resultClearer(_pResultHandle);
 	}
+	_pResultHandle = nullptr;
+
+	if (_streaming)
+	{
+		abortStream();
+	}
 
 	_outputParameterVector.clear();
 	_affectedRowCount	= 0;
 	_currentRow			= 0;
+	_resultRow			= 0;
+	_resultRowCount		= 0;
+}
+
+
+void StatementExecutor::buildParameters()
+{
+	// "transmogrify" the _inputParameterVector to the C format required by PQexecPrepared
+	// The vectors are kept to avoid allocations for repeated executions.
+
+	_parameterValues.clear();
+	_parameterLengths.clear();
+	_parameterFormats.clear();
+
+	try
+	{
+		for (const auto& parameter: _inputParameterVector)
+		{
+			_parameterValues.push_back(static_cast<const char*>(parameter.pInternalRepresentation()));
+			_parameterLengths.push_back(static_cast<int>(parameter.size()));
+			_parameterFormats.push_back(parameter.isBinary() ? 1 : 0);
+		}
+	}
+	catch (std::bad_alloc&)
+	{
+		throw StatementException("Memory Allocation Error");
+	}
+}
+
+
+bool StatementExecutor::nextResult()
+{
+	// Receives the next chunk of a result in single-row or chunked mode.
+	// Returns false at the end of the result.
+
+	{
+		PQResultClear resultClearer(_pResultHandle);
+	}
+	_pResultHandle = nullptr;
+	_resultRow = 0;
+	_resultRowCount = 0;
+
+	for (;;)
+	{
+		PGresult* pResult = nullptr;
+		{
+			Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+			pResult = PQgetResult(_sessionHandle);
+		}
+		if (!pResult) break;
+
+		ExecStatusType status = PQresultStatus(pResult);
+		if (status == PGRES_SINGLE_TUPLE
+#ifdef LIBPQ_HAS_CHUNK_MODE
+			|| status == PGRES_TUPLES_CHUNK
+#endif
+			)
+		{
+			_pResultHandle = pResult;
+			_resultRowCount = static_cast<std::size_t>(PQntuples(pResult));
+			return true;
+		}
+		else if (status == PGRES_TUPLES_OK)
+		{
+			// the (empty) final result, followed by a null result
+			PQclear(pResult);
+		}
+		else
+		{
+			// An error may also occur after some rows have been received.
+			abortStream();
+			throwExecuteError(pResult);
+		}
+	}
+	_streaming = false;
+	return false;
+}
+
+
+void StatementExecutor::abortStream()
+{
+	// Cancels a partially received result, and discards
+	// the remaining rows, so that the connection can be used again.
+
+	_streaming = false;
+	if (!_sessionHandle.isConnected()) return;
+
+	{
+		// Discard the rows received already. If the end of
+		// the result has been received, no cancel is needed.
+		Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+		while (!PQisBusy(_sessionHandle))
+		{
+			PGresult* pResult = PQgetResult(_sessionHandle);
+			if (!pResult) return;
+			PQclear(pResult);
+		}
+	}
+
+	try
+	{
+		_sessionHandle.cancel();
+	}
+	catch (...)
+	{
+	}
+
+	Poco::FastMutex::ScopedLock mutexLocker(_sessionHandle.mutex());
+	while (PGresult* pResult = PQgetResult(_sessionHandle))
+	{
+		PQclear(pResult);
+	}
 }
 
 
@@ -22,9 +22,12 @@
 #include "Poco/Data/PostgreSQL/Connector.h"
 #include "Poco/Data/PostgreSQL/Utility.h"
 #include "Poco/Data/PostgreSQL/PostgreSQLException.h"
+#include "Poco/Data/PostgreSQL/CopyIn.h"
+#include "Poco/Data/PostgreSQL/CopyOut.h"
 #include "Poco/Nullable.h"
 #include "Poco/Data/DataException.h"
 #include <iostream>
+#include <sstream>
 
 #include "Poco/Data/Transaction.h"
 
@@ -33,6 +36,8 @@ using namespace Poco::Data::Keywords;
 using Poco::Data::PostgreSQL::ConnectionException;
 using Poco::Data::PostgreSQL::Utility;
 using Poco::Data::PostgreSQL::StatementException;
+using Poco::Data::PostgreSQL::CopyIn;
+using Poco::Data::PostgreSQL::CopyOut;
 using Poco::format;
 using Poco::NotFoundException;
 using Poco::Int32;
@@ -840,6 +845,220 @@ void PostgreSQLTest::testSqlState()
 	}
 }
 
+
+void PostgreSQLTest::testPipelining()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreateIntsTable();
+	assertTrue (!_pSession->getFeature("pipelining"));
+	_pSession->setFeature("pipelining", true);
+	_pSession->setProperty("pipelineBatchSize", std::size_t(100));
+
+	std::vector<int> data;
+	for (int i = 0; i < 1050; ++i) data.push_back(i);
+
+	Statement stmt = (*_pSession << "INSERT INTO Strings VALUES ($1)", use(data));
+	assertTrue (stmt.execute() == 1050);
+
+	int count = 0;
+	int sum = 0;
+	*_pSession << "SELECT COUNT(*), SUM(str) FROM Strings", into(count), into(sum), now;
+	assertTrue (count == 1050);
+	assertTrue (sum == 1049*1050/2);
+
+	// the statement can be executed again after a pipeline
+	*_pSession << "DELETE FROM Strings", now;
+	assertTrue (stmt.execute() == 1050);
+
+	// an error ends the pipeline and is reported
+	*_pSession << "ALTER TABLE Strings ADD CONSTRAINT Positive CHECK (str < 500)", now;
+	try
+	{
+		*_pSession << "INSERT INTO Strings VALUES ($1)", use(data), now;
+		fail ("must fail");
+	}
+	catch (StatementException&)
+	{
+	}
+
+	// the session is usable after the error
+	*_pSession << "SELECT COUNT(*) FROM Strings", into(count), now;
+	assertTrue (count >= 1050);
+}
+
+
+void PostgreSQLTest::testPipelineBatchAbort()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreateIntsTable();
+	_pSession->setFeature("pipelining", true);
+	_pSession->setProperty("pipelineBatchSize", std::size_t(100));
+	*_pSession << "ALTER TABLE Strings ADD CONSTRAINT NotOneFifty CHECK (str <> 150)", now;
+
+	std::vector<int> data;
+	for (int i = 0; i < 250; ++i) data.push_back(i);
+
+	try
+	{
+		*_pSession << "INSERT INTO Strings VALUES ($1)", use(data), now;
+		fail ("must fail");
+	}
+	catch (StatementException&)
+	{
+	}
+
+	// the first batch has been committed, the rows of the second batch
+	// before the failing one have been rolled back, and the third batch
+	// has not been sent
+	int count = 0;
+	int maxValue = 0;
+	*_pSession << "SELECT COUNT(*), MAX(str) FROM Strings", into(count), into(maxValue), now;
+	assertTrue (count == 100);
+	assertTrue (maxValue == 99);
+}
+
+
+void PostgreSQLTest::testFetchChunked()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreateIntsTable();
+	std::vector<int> data;
+	for (int i = 0; i < 1000; ++i) data.push_back(i);
+	*_pSession << "INSERT INTO Strings VALUES ($1)", use(data), now;
+
+	for (std::size_t chunkSize: {1, 64})
+	{
+		_pSession->setProperty("fetchChunkSize", chunkSize);
+
+		std::vector<int> result;
+		*_pSession << "SELECT str FROM Strings ORDER BY str", into(result), now;
+		assertTrue (result == data);
+
+		// fetch in steps, and abandon the result before all rows have been fetched
+		Statement stmt = (*_pSession << "SELECT str FROM Strings ORDER BY str", into(result), limit(100));
+		result.clear();
+		stmt.execute();
+		assertTrue (result.size() == 100);
+		stmt.execute();
+		assertTrue (result.size() == 200);
+		stmt.reset(*_pSession);
+
+		int count = 0;
+		*_pSession << "SELECT COUNT(*) FROM Strings", into(count), now;
+		assertTrue (count == 1000);
+
+		try
+		{
+			*_pSession << "SELECT 100/(500 - str) FROM Strings ORDER BY str", into(result), now;
+			fail ("must fail");
+		}
+		catch (StatementException&)
+		{
+		}
+		*_pSession << "SELECT COUNT(*) FROM Strings", into(count), now;
+		assertTrue (count == 1000);
+	}
+
+	_pSession->setProperty("fetchChunkSize", std::size_t(0));
+}
+
+
+void PostgreSQLTest::testCopyIn()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	dropTable("CopyTest");
+	*_pSession << "CREATE TABLE CopyTest (i INTEGER, b BIGINT, d DOUBLE PRECISION, s VARCHAR(30), t TIMESTAMP, n INTEGER, f BOOLEAN)", now;
+
+	std::vector<Int32> ints;
+	std::vector<Poco::Int64> bigints;
+	std::vector<double> doubles;
+	std::vector<std::string> strings;
+	std::vector<Poco::DateTime> timestamps;
+	std::vector<Nullable<Int32>> nullables;
+	std::vector<bool> bools;
+	for (int i = 0; i < 10000; ++i)
+	{
+		ints.push_back(i);
+		bigints.push_back(Poco::Int64(i)*10000000000);
+		doubles.push_back(i*0.5);
+		strings.push_back(format("row %d", i));
+		timestamps.push_back(Poco::DateTime(2020, 1, 1, 12, 0, i % 60));
+		nullables.push_back(i % 2 ? Nullable<Int32>(i) : Nullable<Int32>());
+		bools.push_back(i % 3 == 0);
+	}
+
+	CopyIn copy(*_pSession, "CopyTest", {"i", "b", "d", "s", "t", "n", "f"});
+	copy.copy(ints, bigints, doubles, strings, timestamps, nullables, bools);
+	copy.copy(ints, bigints, doubles, strings, timestamps, nullables, bools);
+	assertTrue (copy.rows() == 20000);
+	assertTrue (copy.finish() == 20000);
+
+	int count = 0;
+	int nulls = 0;
+	*_pSession << "SELECT COUNT(*), COUNT(*) - COUNT(n) FROM CopyTest", into(count), into(nulls), now;
+	assertTrue (count == 20000);
+	assertTrue (nulls == 10000);
+
+	Poco::Int64 b = 0;
+	double d = 0;
+	std::string s;
+	Poco::DateTime t;
+	bool f = false;
+	*_pSession << "SELECT b, d, s, t, f FROM CopyTest WHERE i = 4321 LIMIT 1", into(b), into(d), into(s), into(t), into(f), now;
+	assertTrue (b == bigints[4321]);
+	assertTrue (d == doubles[4321]);
+	assertTrue (s == "row 4321");
+	assertTrue (t == timestamps[4321]);
+	assertTrue (!f);
+
+	// an unfinished copy is aborted
+	{
+		CopyIn aborted(*_pSession, "CopyTest", {"i"});
+		aborted.copy(ints);
+	}
+	*_pSession << "SELECT COUNT(*) FROM CopyTest", into(count), now;
+	assertTrue (count == 20000);
+
+	try
+	{
+		CopyIn copy2(*_pSession, "NoSuchTable", {"i"});
+		fail ("must fail");
+	}
+	catch (StatementException&)
+	{
+	}
+}
+
+
+void PostgreSQLTest::testCopyOut()
+{
+	if (!_pSession) fail ("Test not available.");
+
+	recreatePersonTable();
+	*_pSession << "INSERT INTO Person VALUES ('Simpson', 'Bart', 'Springfield', 10)", now;
+	*_pSession << "INSERT INTO Person VALUES ('Simpson', 'Lisa', 'Springfield', 8)", now;
+
+	std::ostringstream ostr;
+	CopyOut copy(*_pSession, "(SELECT FirstName, Age FROM Person ORDER BY Age)", "FORMAT csv, HEADER");
+	copy.copyTo(ostr);
+	assertTrue (ostr.str() == "firstname,age\nLisa,8\nBart,10\n");
+	assertTrue (copy.rows() == 3);
+
+	// abandoned copy
+	{
+		CopyOut partial(*_pSession, "Person");
+		std::string row;
+		assertTrue (partial.read(row));
+	}
+	int count = 0;
+	*_pSession << "SELECT COUNT(*) FROM Person", into(count), now;
+	assertTrue (count == 2);
+}
+
 void PostgreSQLTest::testNullableInt()
 {
 	if (!_pSession) fail ("Test not available.");
@@ -1294,6 +1513,8 @@ void PostgreSQLTest::tearDown()
 	dropTable("Person");
 	dropTable("Strings");
 	_pSession->setFeature("binaryExtraction", false);
+	_pSession->setFeature("pipelining", false);
+	_pSession->setProperty("pipelineBatchSize", std::size_t(1000));
 }
 
 
@@ -1378,6 +1599,11 @@ CppUnit::Test* PostgreSQLTest::suite()
 	CppUnit_addTest(pSuite, PostgreSQLTest, testTupleWithNullable);
 	CppUnit_addTest(pSuite, PostgreSQLTest, testStdTupleWithOptional);
 	CppUnit_addTest(pSuite, PostgreSQLTest, testSqlState);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testPipelining);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testPipelineBatchAbort);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testFetchChunked);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testCopyIn);
+	CppUnit_addTest(pSuite, PostgreSQLTest, testCopyOut);
 
 	CppUnit_addTest(pSuite, PostgreSQLTest, testBinarySimpleAccess);
 	CppUnit_addTest(pSuite, PostgreSQLTest, testBinaryComplexType);
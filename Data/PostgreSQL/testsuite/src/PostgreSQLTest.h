@@ -117,6 +117,11 @@ public:
 	void testReconnect();
     void testTransactionWithReconnect();
 	void testSqlState();
+	void testPipelining();
+	void testPipelineBatchAbort();
+	void testFetchChunked();
+	void testCopyIn();
+	void testCopyOut();
 
 	void setUp();
 	void tearDown();
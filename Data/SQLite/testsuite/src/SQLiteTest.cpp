@@ -16,6 +16,8 @@
 #include "Poco/Data/LOB.h"
 #include "Poco/Data/Statement.h"
 #include "Poco/Data/RecordSet.h"
+#include "Poco/Data/JSONRowFormatter.h"
+#include "Poco/Data/SimpleRowFormatter.h"
 #include "Poco/Data/SQLChannel.h"
 #include "Poco/Data/SessionFactory.h"
 #include "Poco/Data/SQLite/Connector.h"
@@ -51,6 +53,8 @@ using Poco::Data::Session;
 using Poco::Data::Statement;
 using Poco::Data::RecordSet;
 using Poco::Data::Column;
+using Poco::Data::ColumnSpan;
+using Poco::Data::JSONRowFormatter;
 using Poco::Data::Row;
 using Poco::Data::SQLChannel;
 using Poco::Data::LimitException;
@@ -2524,6 +2528,86 @@ void SQLiteTest::testRowIterator()
 }
 
 
+void SQLiteTest::testColumnSpan()
+{
+	Session ses (Poco::Data::SQLite::Connector::KEY, "dummy.db");
+	ses << "DROP TABLE IF EXISTS Vectors", now;
+	ses << "CREATE TABLE Vectors (int0 INTEGER, flt0 REAL, str0 VARCHAR)", now;
+	ses << "INSERT INTO Vectors VALUES (1, 1.5, 'a')", now;
+	ses << "INSERT INTO Vectors VALUES (-2, NULL, 'b')", now;
+	ses << "INSERT INTO Vectors VALUES (3, 3.5, NULL)", now;
+	ses << "INSERT INTO Vectors VALUES (NULL, 4.5, 'd')", now;
+
+	Statement stmt = (ses << "SELECT * FROM Vectors", Poco::Data::Keywords::vector, now);
+	RecordSet rset(stmt);
+	assertTrue (rset.storage() == Statement::STORAGE_VECTOR);
+
+	ColumnSpan<Int64> ints = rset.columnSpan<Int64>(0);
+	assertTrue (ints.size() == 4);
+	assertTrue (ints.nullCount() == 1);
+	assertTrue (ints.isNull(3));
+	assertTrue (ints[1] == -2);
+	assertTrue (ints.sum() == 2);
+	assertTrue (ints.min().value() == -2);
+	assertTrue (ints.max().value() == 3);
+
+	ColumnSpan<double> doubles = rset.columnSpan<double>("flt0");
+	assertTrue (doubles.count() == 3);
+	assertEqualDelta (9.5, doubles.sum(), 0.0001);
+	assertEqualDelta (4.5, doubles.max().value(), 0.0001);
+
+	ColumnSpan<std::string> strings = rset.columnSpan<std::string>("str0");
+	assertTrue (strings.isNull(2));
+	assertTrue (strings[3] == "d");
+
+	try
+	{
+		rset.columnSpan<double>(0);
+		fail ("must throw");
+	}
+	catch (BadCastException&)
+	{
+	}
+
+	rset.setRowFormatter(new JSONRowFormatter(JSONRowFormatter::JSON_FMT_MODE_FULL));
+	std::ostringstream json;
+	rset.copy(json);
+	assertTrue (json.str() == "{\"count\":4,[{\"int0\":1,\"flt0\":1.5,\"str0\":\"a\"},"
+		"{\"int0\":-2,\"flt0\":null,\"str0\":\"b\"},"
+		"{\"int0\":3,\"flt0\":3.5,\"str0\":null},"
+		"{\"int0\":null,\"flt0\":4.5,\"str0\":\"d\"}]}");
+
+	RecordSet deques(ses, "SELECT * FROM Vectors");
+	try
+	{
+		deques.columnSpan<Int64>(0);
+		fail ("must throw");
+	}
+	catch (InvalidAccessException&)
+	{
+	}
+
+	std::ostringstream rows;
+	for (RecordSet::ConstIterator it = deques.begin(); it != deques.end(); ++it) rows << *it;
+	std::ostringstream fields;
+	deques.copyValues(fields);
+	assertTrue (fields.str() == rows.str());
+
+	std::ostringstream page;
+	deques.copyValues(page, 1, 2);
+	assertTrue (page.str() == rows.str().substr(rows.str().find('\n') + 1, 2*rows.str().find('\n') + 2));
+
+	try
+	{
+		deques.copyValues(page, 3, 2);
+		fail ("must throw");
+	}
+	catch (RangeException&)
+	{
+	}
+}
+
+
 void SQLiteTest::testAsync()
 {
 	Session tmp (Poco::Data::SQLite::Connector::KEY, "dummy.db");
@@ -4078,6 +4162,7 @@ CppUnit::Test* SQLiteTest::suite()
 	CppUnit_addTest(pSuite, SQLiteTest, testNullableVector);
 	CppUnit_addTest(pSuite, SQLiteTest, testNulls);
 	CppUnit_addTest(pSuite, SQLiteTest, testRowIterator);
+	CppUnit_addTest(pSuite, SQLiteTest, testColumnSpan);
 	CppUnit_addTest(pSuite, SQLiteTest, testAsync);
 	CppUnit_addTest(pSuite, SQLiteTest, testAny);
 	CppUnit_addTest(pSuite, SQLiteTest, testDynamicAny);
@@ -128,6 +128,11 @@ protected:
 		return _rResult;
 	}
 
+	const std::deque<bool>& nulls() const
+	{
+		return _nulls;
+	}
+
 private:
 	C&               _rResult;
 	CValType         _default;
@@ -197,6 +202,12 @@ public:
 		return *_pColumn;
 	}
 
+	const std::deque<bool>& nulls() const
+		/// Returns the null flags of the extracted rows.
+	{
+		return BulkExtraction<C>::nulls();
+	}
+
 	InternalBulkExtraction() = delete;
 	InternalBulkExtraction(const InternalBulkExtraction&) = delete;
 	InternalBulkExtraction& operator = (const InternalBulkExtraction&) = delete;
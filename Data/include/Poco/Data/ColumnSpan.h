@@ -0,0 +1,235 @@
+//
+// ColumnSpan.h
+//
+// Library: Data
+// Package: DataCore
+// Module:  ColumnSpan
+//
+// Definition of the ColumnSpan class template.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Data_ColumnSpan_INCLUDED
+#define Data_ColumnSpan_INCLUDED
+
+
+#include "Poco/Data/Data.h"
+#include "Poco/Nullable.h"
+#include "Poco/Exception.h"
+#include "Poco/Types.h"
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <type_traits>
+
+
+namespace Poco {
+namespace Data {
+
+
+template <typename T>
+class ColumnSpan
+	/// ColumnSpan is a read-only view of the values of a RecordSet column
+	/// kept in contiguous memory, together with the column's null flags.
+	/// A ColumnSpan is obtained from RecordSet::columnSpan() and does not
+	/// copy any data. It is valid as long as the RecordSet it has been
+	/// obtained from is neither reset nor destroyed.
+	///
+	/// Values can be accessed through a plain pointer, so that loops over
+	/// a ColumnSpan can be optimized (and vectorized) by the compiler:
+	///
+	///     ColumnSpan<double> prices = rs.columnSpan<double>("Price");
+	///     for (std::size_t i = 0; i < prices.size(); ++i)
+	///     {
+	///         if (!prices.isNull(i)) total += prices[i]*rate;
+	///     }
+	///
+	/// The value of a null field is the default value of T.
+	///
+	/// The aggregate functions sum(), min() and max() skip null fields.
+	/// They run over the plain values if the column has no null fields.
+{
+	static_assert(!std::is_same<T, bool>::value, "std::vector<bool> does not store its values contiguously");
+
+public:
+	using ValueType = T;
+	using Iterator = const T*;
+	using SumType = typename std::conditional<std::is_floating_point<T>::value, double,
+		typename std::conditional<std::is_signed<T>::value, Poco::Int64, Poco::UInt64>::type>::type;
+		/// The type of the sum of the values: double for floating point
+		/// values, Int64 or UInt64 for integer values.
+
+	ColumnSpan():
+		_pData(nullptr),
+		_size(0),
+		_pNulls(nullptr),
+		_nullCount(0)
+		/// Creates an empty ColumnSpan.
+	{
+	}
+
+	ColumnSpan(const T* pData, std::size_t size, const std::deque<bool>* pNulls = nullptr):
+		_pData(pData),
+		_size(size),
+		_pNulls(pNulls),
+		_nullCount(0)
+		/// Creates a ColumnSpan for the given values and null flags.
+		/// If given, pNulls must have at least size elements.
+	{
+		if (_pNulls)
+		{
+			poco_assert (_pNulls->size() >= _size);
+			_nullCount = static_cast<std::size_t>(std::count(_pNulls->begin(), _pNulls->begin() + _size, true));
+		}
+	}
+
+	const T* data() const
+		/// Returns a pointer to the first value.
+	{
+		return _pData;
+	}
+
+	std::size_t size() const
+		/// Returns the number of rows.
+	{
+		return _size;
+	}
+
+	bool empty() const
+		/// Returns true if the span has no rows.
+	{
+		return _size == 0;
+	}
+
+	Iterator begin() const
+		/// Returns an iterator to the first value.
+	{
+		return _pData;
+	}
+
+	Iterator end() const
+		/// Returns an iterator past the last value.
+	{
+		return _pData + _size;
+	}
+
+	const T& operator [] (std::size_t row) const
+		/// Returns the value in the given row, without range check.
+	{
+		return _pData[row];
+	}
+
+	const T& at(std::size_t row) const
+		/// Returns the value in the given row.
+		/// Throws a RangeException if row is out of range.
+	{
+		if (row >= _size) throw RangeException("ColumnSpan row out of range");
+		return _pData[row];
+	}
+
+	bool isNull(std::size_t row) const
+		/// Returns true if the field in the given row is null.
+	{
+		return _nullCount > 0 && (*_pNulls)[row];
+	}
+
+	std::size_t nullCount() const
+		/// Returns the number of null fields.
+	{
+		return _nullCount;
+	}
+
+	std::size_t count() const
+		/// Returns the number of fields that are not null.
+	{
+		return _size - _nullCount;
+	}
+
+	SumType sum() const
+		/// Returns the sum of all values that are not null,
+		/// or zero if there are none.
+	{
+		static_assert(std::is_arithmetic<T>::value, "ColumnSpan::sum() requires an arithmetic type");
+
+		if (_nullCount == 0)
+		{
+			// Four independent partial sums allow the compiler to keep
+			// several additions in flight (and to vectorize the loop).
+			SumType s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+			std::size_t i = 0;
+			for (; i + 4 <= _size; i += 4)
+			{
+				s0 += static_cast<SumType>(_pData[i]);
+				s1 += static_cast<SumType>(_pData[i + 1]);
+				s2 += static_cast<SumType>(_pData[i + 2]);
+				s3 += static_cast<SumType>(_pData[i + 3]);
+			}
+			for (; i < _size; ++i) s0 += static_cast<SumType>(_pData[i]);
+			return (s0 + s1) + (s2 + s3);
+		}
+		else
+		{
+			SumType s = 0;
+			for (std::size_t i = 0; i < _size; ++i)
+			{
+				if (!(*_pNulls)[i]) s += static_cast<SumType>(_pData[i]);
+			}
+			return s;
+		}
+	}
+
+	Nullable<T> min() const
+		/// Returns the smallest value that is not null,
+		/// or null if all fields are null.
+	{
+		return extreme([](const T& a, const T& b) { return a < b; });
+	}
+
+	Nullable<T> max() const
+		/// Returns the largest value that is not null,
+		/// or null if all fields are null.
+	{
+		return extreme([](const T& a, const T& b) { return b < a; });
+	}
+
+private:
+	template <typename Less>
+	Nullable<T> extreme(Less less) const
+	{
+		if (_nullCount == 0)
+		{
+			if (_size == 0) return Nullable<T>();
+			const T* pResult = _pData;
+			for (const T* p = _pData + 1; p < _pData + _size; ++p)
+			{
+				if (less(*p, *pResult)) pResult = p;
+			}
+			return Nullable<T>(*pResult);
+		}
+		else
+		{
+			const T* pResult = nullptr;
+			for (std::size_t i = 0; i < _size; ++i)
+			{
+				if (!(*_pNulls)[i] && (!pResult || less(_pData[i], *pResult))) pResult = _pData + i;
+			}
+			return pResult ? Nullable<T>(*pResult) : Nullable<T>();
+		}
+	}
+
+	const T* _pData;
+	std::size_t _size;
+	const std::deque<bool>* _pNulls;
+	std::size_t _nullCount;
+};
+
+
+} } // namespace Poco::Data
+
+
+#endif // Data_ColumnSpan_INCLUDED
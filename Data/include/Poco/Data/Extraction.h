@@ -207,6 +207,11 @@ protected:
 		return _rResult;
 	}
 
+	const std::deque<bool>& nulls() const
+	{
+		return _nulls;
+	}
+
 private:
 	std::vector<T>&  _rResult;
 	T                _default;
@@ -297,6 +302,11 @@ protected:
 		return _rResult;
 	}
 
+	const std::deque<bool>& nulls() const
+	{
+		return _nulls;
+	}
+
 private:
 	std::vector<bool>& _rResult;
 	bool               _default;
@@ -385,6 +395,11 @@ protected:
 		return _rResult;
 	}
 
+	const std::deque<bool>& nulls() const
+	{
+		return _nulls;
+	}
+
 private:
 	std::list<T>&    _rResult;
 	T                _default;
@@ -473,6 +488,11 @@ protected:
 		return _rResult;
 	}
 
+	const std::deque<bool>& nulls() const
+	{
+		return _nulls;
+	}
+
 private:
 	std::deque<T>&   _rResult;
 	T                _default;
@@ -541,6 +561,12 @@ public:
 		return *_pColumn;
 	}
 
+	const std::deque<bool>& nulls() const
+		/// Returns the null flags of the extracted rows.
+	{
+		return Extraction<C>::nulls();
+	}
+
 private:
 	Column<C>* _pColumn;
 };
@@ -91,6 +91,12 @@ public:
 	std::string& formatValues(const ValueVec& vals, std::string& formattedValues);
 		// Formats values.
 
+	bool canFormatFields() const;
+		/// Returns true.
+
+	std::string& formatFields(const FieldVec& fields, std::string& formattedValues);
+		/// Formats the fields and appends them to formattedValues.
+
 	void setJSONMode(int mode);
 		/// Sets the mode. Valid mode values are:
 		///   JSON_FMT_MODE_SMALL
@@ -117,6 +123,7 @@ public:
 
 private:
 	void adjustPrefix() const;
+	static void appendField(const Field& field, std::string& str);
 
 	NameVecPtr _pNames;
 	int        _mode;
@@ -129,6 +136,12 @@ private:
 //
 
 
+inline bool JSONRowFormatter::canFormatFields() const
+{
+	return true;
+}
+
+
 inline bool JSONRowFormatter::printRowCount() const
 {
 	return (_mode & JSON_FMT_MODE_ROW_COUNT) != 0;
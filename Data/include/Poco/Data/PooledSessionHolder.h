@@ -23,6 +23,7 @@
 #include "Poco/AutoPtr.h"
 #include "Poco/Timestamp.h"
 #include "Poco/Mutex.h"
+#include <thread>
 
 
 namespace Poco {
@@ -54,10 +55,20 @@ public:
 	int idle() const;
 		/// Returns the number of seconds the session has not been used.
 
+	void setLastThread(std::thread::id id);
+		/// Sets the ID of the thread that has used the session last.
+		///
+		/// Used by SessionPool for thread affinity. Must only be
+		/// called while the session is not in use.
+
+	std::thread::id lastThread() const;
+		/// Returns the ID of the thread that has used the session last.
+
 private:
 	SessionPool& _owner;
 	Poco::AutoPtr<SessionImpl> _pImpl;
 	Poco::Timestamp _lastUsed;
+	std::thread::id _lastThread;
 	mutable Poco::FastMutex _mutex;
 };
 
@@ -93,6 +104,18 @@ inline int PooledSessionHolder::idle() const
 }
 
 
+inline void PooledSessionHolder::setLastThread(std::thread::id id)
+{
+	_lastThread = id;
+}
+
+
+inline std::thread::id PooledSessionHolder::lastThread() const
+{
+	return _lastThread;
+}
+
+
 } } // namespace Poco::Data
 
 
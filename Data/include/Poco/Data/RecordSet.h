@@ -23,6 +23,7 @@
 #include "Poco/Data/Statement.h"
 #include "Poco/Data/RowIterator.h"
 #include "Poco/Data/RowFilter.h"
+#include "Poco/Data/ColumnSpan.h"
 #include "Poco/String.h"
 #include "Poco/Dynamic/Var.h"
 #include "Poco/Exception.h"
@@ -71,6 +72,7 @@ public:
 
 	using Statement::isNull;
 	using Statement::subTotalRowCount;
+	using Statement::storage;
 
 	static const std::size_t UNKNOWN_TOTAL_ROW_COUNT;
 
@@ -169,6 +171,30 @@ public:
 	template <class C>
 	const Column<C>& column(std::size_t pos) const;
 
+	template <class T>
+	ColumnSpan<T> columnSpan(std::size_t pos) const;
+		/// Returns a ColumnSpan giving direct access to the values
+		/// and null flags of the column at the given position,
+		/// without copying or converting them.
+		///
+		/// The values must have been extracted into vector storage
+		/// (see Keywords::vector and the "storage" session property),
+		/// otherwise an InvalidAccessException is thrown. The span
+		/// covers all extracted rows of the current data set and
+		/// ignores the row filter.
+		///
+		/// T must be the type the column has been extracted as (see
+		/// column()); supported types are UInt8, Int16, UInt16, Int32,
+		/// UInt32, Int64, UInt64, float, double and std::string.
+
+	template <class T>
+	ColumnSpan<T> columnSpan(const std::string& name) const
+		/// Returns a ColumnSpan for the column with the given name.
+		/// See columnSpan(std::size_t) for details.
+	{
+		return columnSpan<T>(metaColumn(name).position());
+	}
+
 	Row& row(std::size_t pos);
 		/// Returns reference to row at position pos.
 		/// Rows are lazy-created and cached.
@@ -311,6 +337,11 @@ public:
 		/// An invalid combination of offset/length arguments shall
 		/// cause RangeException to be thrown.
 		/// Copied string is formatted by the current RowFormatter.
+		///
+		/// If the RowFormatter supports RowFormatter::formatFields(), and
+		/// the recordset is neither filtered nor uses list storage, the
+		/// values are formatted directly from the extracted columns,
+		/// without creating a Row for every row.
 
 	void formatValues(std::size_t offset, std::size_t length) const;
 		/// Formats values using the current RowFormatter.
@@ -372,6 +403,13 @@ private:
 	template <class C, class E>
 	const Column<C>& columnImpl(std::size_t pos) const
 		/// Returns the reference to column at specified position.
+	{
+		return extractionImpl<C,E>(pos).column();
+	}
+
+	template <class C, class E>
+	const E& extractionImpl(std::size_t pos) const
+		/// Returns the reference to the extraction at specified position.
 	{
 		const AbstractExtractionVec& rExtractions = extractions();
 
@@ -388,9 +426,12 @@ private:
 				rExtractions[pos]->getHeldType(),
 				poco_src_loc));
 		}
-		return pExtraction->column();
+		return *pExtraction;
 	}
 
+	std::ostream& copyFields(std::ostream& os, RowFormatter& formatter, std::size_t offset, std::size_t length) const;
+		/// Copies the data values using RowFormatter::formatFields().
+
 	bool isAllowed(std::size_t row) const;
 		/// Returns true if the specified row is allowed by the
 		/// currently active filter.
@@ -23,6 +23,7 @@
 #include "Poco/RefCountedObject.h"
 #include "Poco/Dynamic/Var.h"
 #include <sstream>
+#include <string_view>
 #include <vector>
 
 
@@ -66,6 +67,13 @@ class Data_API RowFormatter
 	/// to the formater mode are expected to be implemented. If a call is propagated to this parent
 	/// class, the functions do nothing or silently return empty string respectively.
 	///
+	/// Formatters operating in progressive mode can additionally implement
+	/// formatFields(), which receives the row fields as text instead of
+	/// Poco::Dynamic::Var values. If canFormatFields() returns true,
+	/// RecordSet::copyValues() converts the fields directly from the
+	/// extracted columns and passes them to formatFields(), without
+	/// creating Row objects for the copied rows.
+	///
 {
 public:
 	using Ptr = SharedPtr<RowFormatter>;
@@ -73,6 +81,27 @@ public:
 	using NameVecPtr = SharedPtr<std::vector<std::string>>;
 	using ValueVec = std::vector<Poco::Dynamic::Var>;
 
+	struct Field
+		/// A field value in text form, as passed to formatFields().
+	{
+		std::string_view text;
+			/// The field value converted to string, as returned by
+			/// Poco::Dynamic::Var::convert<std::string>().
+			/// Empty for null fields.
+
+		bool isNull = false;
+			/// True if the field is null.
+
+		bool isNumeric = false;
+			/// True if the value is numeric (including bool),
+			/// see Poco::Dynamic::Var::isNumeric().
+
+		bool isString = false;
+			/// True if the value is a string, a date or a time.
+	};
+
+	using FieldVec = std::vector<Field>;
+
 	static const int INVALID_ROW_COUNT = -1;
 
 	enum Mode
@@ -105,6 +134,17 @@ public:
 		/// Should be implemented to format the row fields values.
 		/// The default implementation does nothing.
 
+	virtual bool canFormatFields() const;
+		/// Returns true if the formatter implements formatFields().
+		/// The default implementation returns false.
+
+	virtual std::string& formatFields(const FieldVec& fields, std::string& formattedValues);
+		/// Formats the row fields given in text form, appends the
+		/// result to formattedValues and returns it. Must produce the
+		/// same output as formatValues() for the corresponding values.
+		///
+		/// The default implementation throws a NotImplementedException.
+
 	virtual const std::string& toString();
 		/// Throws NotImplementedException. Formatters operating in bulk mode should
 		/// implement this member function to return valid pointer to the formatted result.
@@ -168,6 +208,12 @@ inline int RowFormatter::rowCount() const
 }
 
 
+inline bool RowFormatter::canFormatFields() const
+{
+	return false;
+}
+
+
 inline int RowFormatter::getTotalRowCount() const
 {
 	return _totalRowCount;
@@ -26,7 +26,14 @@
 #include "Poco/Any.h"
 #include "Poco/Timer.h"
 #include "Poco/Mutex.h"
-#include <list>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
 
 
 namespace Poco {
@@ -54,10 +61,29 @@ class Data_API SessionPool: public RefCountedObject
 	/// from the pool whenever one of the following events occurs:
 	///
 	///   - JanitorTimer event
-	///   - get() request
+	///   - get() request (only the session to be handed out is checked)
 	///   - putBack() request
 	///
-	/// Not connected idle sessions can not exist.
+	/// Idle sessions are kept in several stacks (shards), each one
+	/// protected by its own mutex. A thread takes sessions from and
+	/// returns sessions to the shard selected by its thread ID, and
+	/// only looks into the other shards if its own one is empty. Thus,
+	/// threads rarely contend for the same lock, even if many threads
+	/// use the pool. Within a shard, the most recently used session
+	/// is handed out first.
+	///
+	/// If thread affinity is enabled (see setThreadAffinity()), a thread
+	/// preferably gets back the session it has used last, which keeps
+	/// the session's caches (e.g. prepared statements) warm.
+	///
+	/// get() throws a SessionPoolExhaustedException if no session is
+	/// available. get(timeout) and getAsync() instead wait for a session
+	/// to become available. Waiting requests are served in FIFO order;
+	/// a session returned to the pool is handed directly to the
+	/// longest-waiting request.
+	///
+	/// Usage statistics, including a histogram of the wait times,
+	/// are available via statistics().
 	///
 	/// Usage example:
 	///
@@ -67,6 +93,54 @@ class Data_API SessionPool: public RefCountedObject
 	///     ...
 {
 public:
+	struct Statistics
+		/// Usage statistics of a SessionPool.
+		///
+		/// All counters are cumulative since the creation of the pool, so
+		/// they can be exported as Prometheus counters, e.g. with a
+		/// Poco::Prometheus::CallbackIntCounter. The checkout rate is then
+		/// obtained with rate(). The wait time histogram follows the
+		/// Prometheus conventions as well: bucket counts are cumulative,
+		/// and times are given in seconds.
+	{
+		static const int WAIT_TIME_BUCKETS = 10;
+			/// The number of histogram buckets, including the +Inf bucket.
+
+		static constexpr double WAIT_TIME_BOUNDS[WAIT_TIME_BUCKETS - 1] = {0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1, 5, 10};
+			/// The upper bounds of the histogram buckets in seconds,
+			/// excluding the +Inf bucket.
+
+		Poco::UInt64 checkouts = 0;
+			/// The number of sessions handed out.
+
+		Poco::UInt64 created = 0;
+			/// The number of sessions created.
+
+		Poco::UInt64 discarded = 0;
+			/// The number of sessions closed because they were idle
+			/// for too long or no longer connected.
+
+		Poco::UInt64 affinityHits = 0;
+			/// The number of checkouts that returned the session the
+			/// requesting thread had used last (see setThreadAffinity()).
+
+		Poco::UInt64 waits = 0;
+			/// The number of requests that had to wait for a session
+			/// and have been completed, either by getting a session,
+			/// or with an error.
+
+		Poco::UInt64 timeouts = 0;
+			/// The number of waiting requests that timed out.
+
+		Poco::UInt64 waitTimeBuckets[WAIT_TIME_BUCKETS] = {};
+			/// The number of waiting requests that completed within
+			/// the bounds given in WAIT_TIME_BOUNDS (cumulative).
+			/// The last bucket (+Inf) equals waits.
+
+		double waitTimeSum = 0;
+			/// The sum of all wait times in seconds.
+	};
+
 	SessionPool(const std::string& connector,
 		const std::string& connectionString,
 		int minSessions = 1,
@@ -94,6 +168,31 @@ public:
 		/// already been created, a SessionPoolExhaustedException
 		/// is thrown.
 
+	Session get(long timeoutMilliseconds);
+		/// Returns a Session.
+		///
+		/// If the maximum number of sessions for this pool has
+		/// already been created, waits up to the given time for
+		/// a session to be returned to the pool. Requests waiting for
+		/// a session are served in the order they have been made.
+		///
+		/// Throws a SessionPoolExhaustedException if no session
+		/// becomes available within the given time.
+
+	std::future<Session> getAsync(long timeoutMilliseconds);
+		/// Requests a Session and returns a future for it.
+		///
+		/// If a session is available, the future is ready immediately.
+		/// Otherwise, the request waits for a session in the same queue
+		/// as get(long). If no session becomes available within the given
+		/// time, the future is completed with a SessionPoolExhaustedException.
+		/// Such a timeout is detected when a session is returned to the pool,
+		/// or at the latest with the next run of the janitor timer, which
+		/// runs every idleTime/4 seconds.
+		///
+		/// If the pool is shut down, waiting requests are completed
+		/// with an InvalidAccessException.
+
 	template <typename T>
 	Session get(const std::string& name, const T& value)
 		/// Returns a Session with requested property set.
@@ -102,8 +201,14 @@ public:
 		/// value when the session is reclaimed by the pool.
 	{
 		Session s = get();
-		_addPropertyMap.insert(AddPropertyMap::value_type(s.impl(),
-			std::make_pair(name, s.getProperty(name))));
+		{
+			Poco::Mutex::ScopedLock lock(_mutex);
+			if (_addPropertyMap.insert(AddPropertyMap::value_type(s.impl(),
+				std::make_pair(name, s.getProperty(name)))).second)
+			{
+				++_nOverrides;
+			}
+		}
 		s.setProperty(name, value);
 
 		return s;
@@ -161,6 +266,22 @@ public:
 	bool isActive() const;
 		/// Returns true if session pool is active (not shut down).
 
+	void setThreadAffinity(bool flag);
+		/// Enables or disables thread affinity.
+		///
+		/// If enabled, get() preferably returns the session that has
+		/// been returned to the pool by the calling thread most recently.
+		/// Thread affinity is disabled by default.
+
+	bool getThreadAffinity() const;
+		/// Returns true if thread affinity is enabled.
+
+	int waiting() const;
+		/// Returns the number of requests waiting for a session.
+
+	Statistics statistics() const;
+		/// Returns the usage statistics of the pool.
+
 protected:
 	virtual void customizeSession(Session& session);
 		/// Can be overridden by subclass to perform custom initialization
@@ -170,12 +291,10 @@ protected:
 
 	typedef Poco::AutoPtr<PooledSessionHolder>    PooledSessionHolderPtr;
 	typedef Poco::AutoPtr<PooledSessionImpl>      PooledSessionImplPtr;
-	typedef std::list<PooledSessionHolderPtr>     SessionList;
 	typedef Poco::HashMap<std::string, bool>      FeatureMap;
 	typedef Poco::HashMap<std::string, Poco::Any> PropertyMap;
 
 	void purgeDeadSessions();
-	int deadImpl(SessionList& rSessions);
 	void applySettings(SessionImpl* pImpl);
 	void putBack(PooledSessionHolderPtr pHolder);
 	void onJanitorTimer(Poco::Timer&);
@@ -185,11 +304,47 @@ private:
 	typedef std::pair<std::string, bool> FeaturePair;
 	typedef std::map<SessionImpl*, PropertyPair> AddPropertyMap;
 	typedef std::map<SessionImpl*, FeaturePair> AddFeatureMap;
+	typedef std::chrono::steady_clock Clock;
+
+	static const std::size_t MAX_SHARDS = 16;
+
+	struct alignas(64) Shard
+		/// A stack of idle sessions. The most recently
+		/// returned session is at the back.
+	{
+		Poco::FastMutex mutex;
+		std::vector<PooledSessionHolderPtr> sessions;
+	};
+
+	struct Waiter
+		/// A request waiting for a session.
+	{
+		std::promise<Session> promise;
+		Clock::time_point enqueued;
+		Clock::time_point deadline;
+	};
+
+	typedef std::shared_ptr<Waiter> WaiterPtr;
 
 	SessionPool(const SessionPool&);
 	SessionPool& operator = (const SessionPool&);
 
-	void closeAll(SessionList& sessionList);
+	Shard& homeShard() const;
+	PooledSessionHolderPtr popIdle();
+	PooledSessionHolderPtr popIdle(Shard& shard, bool preferOwn);
+	void pushIdle(PooledSessionHolderPtr pHolder);
+	bool reserve();
+	PooledSessionHolderPtr create();
+	PooledSessionHolderPtr acquire();
+	Session checkout(PooledSessionHolderPtr pHolder);
+	void discard(PooledSessionHolderPtr pHolder);
+	void enqueue(const WaiterPtr& pWaiter, long timeoutMilliseconds);
+	bool cancel(const WaiterPtr& pWaiter);
+	void serveWaiters();
+	void expireWaiters();
+	void fail(const WaiterPtr& pWaiter, std::exception_ptr pException, bool timeout);
+	void restoreSettings(SessionImpl* pImpl);
+	void recordWait(Clock::duration waitTime);
 
 	std::string       _connector;
 	std::string       _connectionString;
@@ -198,16 +353,35 @@ private:
 	std::atomic<int>  _idleTime;
 	std::atomic<int>  _connTimeout;
 	std::atomic<int>  _nSessions;
-	SessionList       _idleSessions;
-	SessionList       _activeSessions;
+	std::atomic<int>  _nIdle;
+	std::atomic<int>  _nActive;
+	std::atomic<int>  _nWaiters;
+	std::atomic<int>  _nOverrides;
+	std::atomic<bool> _threadAffinity;
+	std::size_t       _shardMask;
+	std::unique_ptr<Shard[]> _pShards;
+	std::set<PooledSessionHolderPtr> _sessions;
+	std::deque<WaiterPtr> _waiters;
 	Poco::Timer       _janitorTimer;
 	FeatureMap        _featureMap;
 	PropertyMap       _propertyMap;
 	std::atomic<bool> _shutdown;
 	AddPropertyMap    _addPropertyMap;
 	AddFeatureMap     _addFeatureMap;
+
+	std::atomic<Poco::UInt64> _checkouts;
+	std::atomic<Poco::UInt64> _created;
+	std::atomic<Poco::UInt64> _discarded;
+	std::atomic<Poco::UInt64> _affinityHits;
+	std::atomic<Poco::UInt64> _waits;
+	std::atomic<Poco::UInt64> _timeouts;
+	std::atomic<Poco::UInt64> _waitTimeBuckets[Statistics::WAIT_TIME_BUCKETS];
+	std::atomic<Poco::UInt64> _waitTimeSum; // in microseconds
+
 	mutable
 	Poco::Mutex _mutex;
+	mutable
+	Poco::FastMutex _waitMutex;
 
 	friend class PooledSessionImpl;
 };
@@ -232,6 +406,24 @@ inline bool SessionPool::isActive() const
 }
 
 
+inline void SessionPool::setThreadAffinity(bool flag)
+{
+	_threadAffinity = flag;
+}
+
+
+inline bool SessionPool::getThreadAffinity() const
+{
+	return _threadAffinity;
+}
+
+
+inline int SessionPool::waiting() const
+{
+	return _nWaiters;
+}
+
+
 } } // namespace Poco::Data
 
 
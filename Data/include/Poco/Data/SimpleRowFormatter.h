@@ -58,6 +58,12 @@ public:
 	std::string& formatValues(const ValueVec& vals, std::string& formattedValues);
 		/// Formats the row values.
 
+	bool canFormatFields() const;
+		/// Returns true.
+
+	std::string& formatFields(const FieldVec& fields, std::string& formattedValues);
+		/// Formats the row fields and appends them to formattedValues.
+
 	int rowCount() const;
 		/// Returns row count.
 
@@ -86,6 +92,12 @@ inline int SimpleRowFormatter::rowCount() const
 }
 
 
+inline bool SimpleRowFormatter::canFormatFields() const
+{
+	return true;
+}
+
+
 inline void SimpleRowFormatter::setColumnWidth(std::streamsize columnWidth)
 {
 	_colWidth = columnWidth;
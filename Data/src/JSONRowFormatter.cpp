@@ -13,12 +13,11 @@
 
 
 #include "Poco/Data/JSONRowFormatter.h"
-#include "Poco/String.h"
+#include "Poco/Ascii.h"
 #include "Poco/JSONString.h"
 #include "Poco/Format.h"
 
 
-using Poco::trimInPlace;
 using Poco::format;
 using Poco::toJSON;
 
@@ -88,73 +87,101 @@ void JSONRowFormatter::setJSONMode(int mode)
 
 std::string& JSONRowFormatter::formatValues(const ValueVec& vals, std::string& formattedValues)
 {
-	std::ostringstream str;
-	if (!_firstTime) str << ',';
+	std::vector<std::string> strings(vals.size());
+	FieldVec fields(vals.size());
+	for (std::size_t i = 0; i < vals.size(); ++i)
+	{
+		const Poco::Dynamic::Var& val = vals[i];
+		if (!val.isEmpty())
+		{
+			strings[i] = val.convert<std::string>();
+			fields[i].text = strings[i];
+			fields[i].isString = val.isString() || val.isDate() || val.isTime();
+		}
+		else fields[i].isNull = true;
+	}
+
+	formattedValues.clear();
+	return formatFields(fields, formattedValues);
+}
+
+
+std::string& JSONRowFormatter::formatFields(const FieldVec& fields, std::string& formattedValues)
+{
+	if (!_firstTime) formattedValues += ',';
 	if (isSmall())
 	{
 		if (_firstTime)
 		{
 			if (printColumnNames())
-				str << ",\"values\":";
+				formattedValues += ",\"values\":";
 
-			str << '[';
+			formattedValues += '[';
 		}
 
-		str << '[';
-		ValueVec::const_iterator it = vals.begin();
-		ValueVec::const_iterator end = vals.end();
-		for (; it != end;)
+		formattedValues += '[';
+		for (FieldVec::const_iterator it = fields.begin(); it != fields.end(); ++it)
 		{
-			if (!it->isEmpty())
-			{
-				if (it->isString() || it->isDate() || it->isTime())
-				{
-					std::string val = it->convert<std::string>();
-					trimInPlace(val);
-					str << toJSON(val);
-				}
-				else
-					str << it->convert<std::string>();
-			}
-			else
-				str << "null";
-
-			if (++it == end) break;
-			
-			str << ',';
+			if (it != fields.begin()) formattedValues += ',';
+			appendField(*it, formattedValues);
 		}
-		str << ']';
+		formattedValues += ']';
 	}
 	else if (isFull())
 	{
-		str << '{';
-		ValueVec::const_iterator it = vals.begin();
-		ValueVec::const_iterator end = vals.end();
-		NameVec::iterator nIt = _pNames->begin();
-		NameVec::iterator nEnd = _pNames->end();
+		formattedValues += '{';
+		FieldVec::const_iterator it = fields.begin();
+		FieldVec::const_iterator end = fields.end();
+		NameVec::const_iterator nIt = _pNames->begin();
+		NameVec::const_iterator nEnd = _pNames->end();
 		for (; it != end && nIt != nEnd; ++nIt)
 		{
-			if (!it->isEmpty())
-			{
-				if (it->isString() || it->isDate() || it->isTime())
-				{
-					std::string val = it->convert<std::string>();
-					trimInPlace(val);
-					str << '"' << *nIt << "\":" << toJSON(val);
-				}
-				else
-					str << '"' << *nIt << "\":" << it->convert<std::string>();
-			}
-			else
-				str << '"' << *nIt << "\":null";
+			formattedValues += '"';
+			formattedValues += *nIt;
+			formattedValues += "\":";
+			appendField(*it, formattedValues);
 
-			if (++it != end) str << ',';
+			if (++it != end) formattedValues += ',';
 		}
-		str << '}';
+		formattedValues += '}';
 	}
 
 	_firstTime = false;
-	return formattedValues = str.str();
+	return formattedValues;
+}
+
+
+void JSONRowFormatter::appendField(const Field& field, std::string& str)
+{
+	if (field.isNull)
+	{
+		str += "null";
+	}
+	else if (field.isString)
+	{
+		std::string_view text = field.text;
+		while (!text.empty() && Poco::Ascii::isSpace(text.front())) text.remove_prefix(1);
+		while (!text.empty() && Poco::Ascii::isSpace(text.back())) text.remove_suffix(1);
+
+		// Most values need no escaping and can be copied as they are.
+		bool plain = true;
+		for (char c: text)
+		{
+			if (static_cast<unsigned char>(c) <= 31 || c == '"' || c == '\\')
+			{
+				plain = false;
+				break;
+			}
+		}
+		if (plain)
+		{
+			str += '"';
+			str += text;
+			str += '"';
+		}
+		else str += toJSON(std::string(text));
+	}
+	else str += field.text;
 }
 
 
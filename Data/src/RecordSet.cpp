@@ -14,12 +14,16 @@
 
 #include "Poco/Data/RecordSet.h"
 #include "Poco/Data/Extraction.h"
+#include "Poco/Data/BulkExtraction.h"
 #include "Poco/Data/RowFilter.h"
 #include "Poco/Data/Date.h"
 #include "Poco/Data/Time.h"
 #include "Poco/Data/DataException.h"
 #include "Poco/DateTime.h"
+#include "Poco/NumberFormatter.h"
 #include "Poco/UTFString.h"
+#include <memory>
+#include <type_traits>
 
 
 using namespace Poco::Data::Keywords;
@@ -31,6 +35,129 @@ namespace Poco {
 namespace Data {
 
 
+namespace {
+
+
+class FieldReader
+	/// Converts the fields of a column to text for RowFormatter::formatFields().
+{
+public:
+	virtual ~FieldReader() = default;
+
+	virtual void read(std::size_t row, RowFormatter::Field& field) = 0;
+		/// Sets the text and flags of the field with the value in
+		/// the given row, which must not be null.
+};
+
+
+template <class C>
+class ColumnFieldReader: public FieldReader
+	/// Reads the fields of a column of numbers, booleans or strings
+	/// directly from the column container. Numbers are formatted as
+	/// by Poco::Dynamic::Var, strings are referenced without copying.
+{
+public:
+	using T = typename C::value_type;
+
+	explicit ColumnFieldReader(const C& data):
+		_data(data)
+	{
+	}
+
+	void read(std::size_t row, RowFormatter::Field& field) override
+	{
+		const T& value = _data[row];
+		if constexpr (std::is_same<T, std::string>::value)
+		{
+			field.text = value;
+			field.isString = true;
+		}
+		else if constexpr (std::is_same<T, bool>::value)
+		{
+			field.text = value ? "true" : "false";
+			field.isNumeric = true;
+		}
+		else
+		{
+			_text.clear();
+			if constexpr (std::is_floating_point<T>::value)
+				NumberFormatter::append(_text, value);
+			else if constexpr (std::is_signed<T>::value)
+				NumberFormatter::append(_text, static_cast<Int64>(value));
+			else
+				NumberFormatter::append(_text, static_cast<UInt64>(value));
+			field.text = _text;
+			field.isNumeric = true;
+		}
+	}
+
+private:
+	const C& _data;
+	std::string _text;
+};
+
+
+class VarFieldReader: public FieldReader
+	/// Reads the fields of any column through Poco::Dynamic::Var.
+{
+public:
+	VarFieldReader(const RecordSet& recordSet, std::size_t col):
+		_recordSet(recordSet),
+		_col(col)
+	{
+	}
+
+	void read(std::size_t row, RowFormatter::Field& field) override
+	{
+		Poco::Dynamic::Var value = _recordSet.value(_col, row, false);
+		_text = value.convert<std::string>();
+		field.text = _text;
+		field.isNumeric = value.isNumeric();
+		field.isString = value.isString() || value.isDate() || value.isTime();
+	}
+
+private:
+	const RecordSet& _recordSet;
+	std::size_t _col;
+	std::string _text;
+};
+
+
+template <typename T>
+std::unique_ptr<FieldReader> createColumnFieldReader(const RecordSet& recordSet, std::size_t col, Statement::Storage storage)
+{
+	if (Statement::STORAGE_VECTOR == storage)
+		return std::make_unique<ColumnFieldReader<std::vector<T>>>(recordSet.column<std::vector<T>>(col).data());
+	else
+		return std::make_unique<ColumnFieldReader<std::deque<T>>>(recordSet.column<std::deque<T>>(col).data());
+}
+
+
+std::unique_ptr<FieldReader> createFieldReader(const RecordSet& recordSet, std::size_t col, Statement::Storage storage)
+{
+	switch (recordSet.columnType(col))
+	{
+	case MetaColumn::FDT_BOOL:   return createColumnFieldReader<bool>(recordSet, col, storage);
+	case MetaColumn::FDT_UINT8:  return createColumnFieldReader<UInt8>(recordSet, col, storage);
+	case MetaColumn::FDT_INT16:  return createColumnFieldReader<Int16>(recordSet, col, storage);
+	case MetaColumn::FDT_UINT16: return createColumnFieldReader<UInt16>(recordSet, col, storage);
+	case MetaColumn::FDT_INT32:  return createColumnFieldReader<Int32>(recordSet, col, storage);
+	case MetaColumn::FDT_UINT32: return createColumnFieldReader<UInt32>(recordSet, col, storage);
+	case MetaColumn::FDT_INT64:  return createColumnFieldReader<Int64>(recordSet, col, storage);
+	case MetaColumn::FDT_UINT64: return createColumnFieldReader<UInt64>(recordSet, col, storage);
+	case MetaColumn::FDT_FLOAT:  return createColumnFieldReader<float>(recordSet, col, storage);
+	case MetaColumn::FDT_DOUBLE: return createColumnFieldReader<double>(recordSet, col, storage);
+	case MetaColumn::FDT_STRING:
+	case MetaColumn::FDT_JSON:   return createColumnFieldReader<std::string>(recordSet, col, storage);
+	default:
+		return std::make_unique<VarFieldReader>(recordSet, col);
+	}
+}
+
+
+} // namespace
+
+
 const std::size_t RecordSet::UNKNOWN_TOTAL_ROW_COUNT = std::numeric_limits<std::size_t>::max();
 
 
@@ -295,6 +422,40 @@ template Data_API const Column<std::deque<DateTime>>& RecordSet::column<std::deq
 template Data_API const Column<std::deque<UUID>>& RecordSet::column<std::deque<UUID>>(std::size_t pos) const;
 
 
+template <class T>
+ColumnSpan<T> RecordSet::columnSpan(std::size_t pos) const
+{
+	if (STORAGE_VECTOR != storage())
+		throw InvalidAccessException("Column spans require vector storage.");
+
+	using C = std::vector<T>;
+	if (isBulkExtraction())
+	{
+		const InternalBulkExtraction<C>& rExtraction = extractionImpl<C, InternalBulkExtraction<C>>(pos);
+		const C& rData = rExtraction.column().data();
+		return ColumnSpan<T>(rData.data(), rData.size(), &rExtraction.nulls());
+	}
+	else
+	{
+		const InternalExtraction<C>& rExtraction = extractionImpl<C, InternalExtraction<C>>(pos);
+		const C& rData = rExtraction.column().data();
+		return ColumnSpan<T>(rData.data(), rData.size(), &rExtraction.nulls());
+	}
+}
+
+
+template Data_API ColumnSpan<UInt8> RecordSet::columnSpan<UInt8>(std::size_t pos) const;
+template Data_API ColumnSpan<Int16> RecordSet::columnSpan<Int16>(std::size_t pos) const;
+template Data_API ColumnSpan<UInt16> RecordSet::columnSpan<UInt16>(std::size_t pos) const;
+template Data_API ColumnSpan<Int32> RecordSet::columnSpan<Int32>(std::size_t pos) const;
+template Data_API ColumnSpan<UInt32> RecordSet::columnSpan<UInt32>(std::size_t pos) const;
+template Data_API ColumnSpan<Int64> RecordSet::columnSpan<Int64>(std::size_t pos) const;
+template Data_API ColumnSpan<UInt64> RecordSet::columnSpan<UInt64>(std::size_t pos) const;
+template Data_API ColumnSpan<float> RecordSet::columnSpan<float>(std::size_t pos) const;
+template Data_API ColumnSpan<double> RecordSet::columnSpan<double>(std::size_t pos) const;
+template Data_API ColumnSpan<std::string> RecordSet::columnSpan<std::string>(std::size_t pos) const;
+
+
 template <class T>
 const T& RecordSet::value(std::size_t col, std::size_t row, bool useFilter) const
 	/// Returns the reference to data value at [col, row] location.
@@ -633,6 +794,13 @@ std::ostream& RecordSet::copyNames(std::ostream& os) const
 
 std::ostream& RecordSet::copyValues(std::ostream& os, std::size_t offset, std::size_t length) const
 {
+	RowFormatter::Ptr pFormatter = const_cast<RecordSet*>(this)->getRowFormatter();
+	if (pFormatter->canFormatFields() && RowFormatter::FORMAT_PROGRESSIVE == pFormatter->getMode() &&
+		!isFiltered() && STORAGE_LIST != storage())
+	{
+		return copyFields(os, *pFormatter, offset, length);
+	}
+
 	RowIterator it = *_pBegin + offset;
 	RowIterator end = (RowIterator::POSITION_END != length) ? it + length : *_pEnd;
 	std::copy(it, end, std::ostream_iterator<Row>(os));
@@ -640,6 +808,48 @@ std::ostream& RecordSet::copyValues(std::ostream& os, std::size_t offset, std::s
 }
 
 
+std::ostream& RecordSet::copyFields(std::ostream& os, RowFormatter& formatter, std::size_t offset, std::size_t length) const
+{
+	static const std::size_t FLUSH_SIZE = 16384;
+
+	std::size_t rows = (impl() && !extractions().empty()) ? subTotalRowCount() : 0;
+	if (offset > rows || (RowIterator::POSITION_END != length && length > rows - offset))
+		throw RangeException("Invalid recordset offset or length.");
+	std::size_t endRow = (RowIterator::POSITION_END != length) ? offset + length : rows;
+	if (offset == endRow) return os;
+
+	const AbstractExtractionVec& rExtractions = extractions();
+	std::size_t columns = rExtractions.size();
+	std::vector<std::unique_ptr<FieldReader>> readers;
+	readers.reserve(columns);
+	for (std::size_t col = 0; col < columns; ++col)
+		readers.push_back(createFieldReader(*this, col, storage()));
+
+	RowFormatter::FieldVec fields(columns);
+	std::string formatted;
+	for (std::size_t row = offset; row < endRow; ++row)
+	{
+		for (std::size_t col = 0; col < columns; ++col)
+		{
+			RowFormatter::Field& field = fields[col];
+			field = RowFormatter::Field();
+			if (rExtractions[col]->isNull(row))
+				field.isNull = true;
+			else
+				readers[col]->read(row, field);
+		}
+		formatter.formatFields(fields, formatted);
+		if (formatted.size() >= FLUSH_SIZE)
+		{
+			os.write(formatted.data(), static_cast<std::streamsize>(formatted.size()));
+			formatted.clear();
+		}
+	}
+	os.write(formatted.data(), static_cast<std::streamsize>(formatted.size()));
+	return os;
+}
+
+
 void RecordSet::formatValues(std::size_t offset, std::size_t length) const
 {
 	RowIterator it = *_pBegin + offset;
@@ -63,6 +63,12 @@ void RowFormatter::formatValues(const ValueVec& vals)
 }
 
 
+std::string& RowFormatter::formatFields(const FieldVec& /*fields*/, std::string& /*formattedValues*/)
+{
+	throw NotImplementedException("RowFormatter::formatFields()");
+}
+
+
 const std::string& RowFormatter::toString()
 {
 	throw NotImplementedException("RowFormatter::toString()");
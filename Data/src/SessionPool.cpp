@@ -15,7 +15,10 @@
 #include "Poco/Data/SessionPool.h"
 #include "Poco/Data/SessionFactory.h"
 #include "Poco/Data/DataException.h"
+#include "Poco/Environment.h"
 #include <algorithm>
+#include <functional>
+#include <thread>
 
 
 namespace Poco {
@@ -30,9 +33,33 @@ SessionPool::SessionPool(const std::string& connector, const std::string& connec
 	_idleTime(idleTime),
 	_connTimeout(connTimeout),
 	_nSessions(0),
+	_nIdle(0),
+	_nActive(0),
+	_nWaiters(0),
+	_nOverrides(0),
+	_threadAffinity(false),
+	_shardMask(0),
 	_janitorTimer(1000*idleTime, 1000*idleTime/4),
-	_shutdown(false)
+	_shutdown(false),
+	_checkouts(0),
+	_created(0),
+	_discarded(0),
+	_affinityHits(0),
+	_waits(0),
+	_timeouts(0),
+	_waitTimeSum(0)
 {
+	// Use one shard per processor, but not more shards than
+	// sessions, so that the sessions are not spread too thinly.
+	std::size_t nShards = 1;
+	const std::size_t nProcessors = Environment::processorCount();
+	while (nShards*2 <= nProcessors && nShards*2 <= MAX_SHARDS && nShards*2 <= static_cast<std::size_t>(maxSessions))
+		nShards *= 2;
+	_shardMask = nShards - 1;
+	_pShards.reset(new Shard[nShards]);
+
+	for (auto& bucket: _waitTimeBuckets) bucket = 0;
+
 	Poco::TimerCallback<SessionPool> callback(*this, &SessionPool::onJanitorTimer);
 	_janitorTimer.start(callback);
 }
@@ -54,8 +81,14 @@ SessionPool::~SessionPool()
 Session SessionPool::get(const std::string& name, bool value)
 {
 	Session s = get();
-	_addFeatureMap.insert(AddFeatureMap::value_type(s.impl(),
-		std::make_pair(name, s.getFeature(name))));
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		if (_addFeatureMap.insert(AddFeatureMap::value_type(s.impl(),
+			std::make_pair(name, s.getFeature(name)))).second)
+		{
+			++_nOverrides;
+		}
+	}
 	s.setFeature(name, value);
 
 	return s;
@@ -66,46 +99,383 @@ Session SessionPool::get()
 {
 	if (_shutdown) throw InvalidAccessException("Session pool has been shut down.");
 
-	Poco::Mutex::ScopedLock lock(_mutex);
-	purgeDeadSessions();
+	PooledSessionHolderPtr pHolder = acquire();
+	if (!pHolder) throw SessionPoolExhaustedException(_connector);
+
+	return checkout(pHolder);
+}
+
+
+Session SessionPool::get(long timeoutMilliseconds)
+{
+	if (_shutdown) throw InvalidAccessException("Session pool has been shut down.");
 
-	if (_idleSessions.empty())
+	// Do not overtake requests that are already waiting.
+	if (_nWaiters == 0)
 	{
-		if (_nSessions < _maxSessions)
+		PooledSessionHolderPtr pHolder = acquire();
+		if (pHolder) return checkout(pHolder);
+	}
+
+	WaiterPtr pWaiter = std::make_shared<Waiter>();
+	std::future<Session> future = pWaiter->promise.get_future();
+	enqueue(pWaiter, timeoutMilliseconds);
+	serveWaiters();
+
+	if (future.wait_until(pWaiter->deadline) == std::future_status::timeout && cancel(pWaiter))
+	{
+		throw SessionPoolExhaustedException(_connector);
+	}
+	return future.get();
+}
+
+
+std::future<Session> SessionPool::getAsync(long timeoutMilliseconds)
+{
+	if (_shutdown) throw InvalidAccessException("Session pool has been shut down.");
+
+	WaiterPtr pWaiter = std::make_shared<Waiter>();
+	std::future<Session> future = pWaiter->promise.get_future();
+	if (_nWaiters == 0)
+	{
+		PooledSessionHolderPtr pHolder = acquire();
+		if (pHolder)
 		{
-			Session newSession(SessionFactory::instance().create(_connector, _connectionString, static_cast<std::size_t>(_connTimeout)));
-			applySettings(newSession.impl());
-			customizeSession(newSession);
+			pWaiter->promise.set_value(checkout(pHolder));
+			return future;
+		}
+	}
+
+	enqueue(pWaiter, timeoutMilliseconds);
+	serveWaiters();
+	return future;
+}
+
+
+SessionPool::Shard& SessionPool::homeShard() const
+{
+	// Thread IDs are often addresses with many zero low-order bits,
+	// so the hash value is mixed before selecting the shard.
+	const Poco::UInt64 h = std::hash<std::thread::id>()(std::this_thread::get_id());
+	return _pShards[((h*0x9E3779B97F4A7C15ULL) >> 32) & _shardMask];
+}
+
+
+SessionPool::PooledSessionHolderPtr SessionPool::popIdle()
+{
+	Shard& home = homeShard();
+	PooledSessionHolderPtr pHolder = popIdle(home, _threadAffinity);
+	for (std::size_t i = 0; !pHolder && i <= _shardMask; ++i)
+	{
+		if (&_pShards[i] != &home) pHolder = popIdle(_pShards[i], false);
+	}
+	return pHolder;
+}
+
 
-			PooledSessionHolderPtr pHolder(new PooledSessionHolder(*this, newSession.impl()));
-			_idleSessions.push_back(pHolder);
-			++_nSessions;
+SessionPool::PooledSessionHolderPtr SessionPool::popIdle(Shard& shard, bool preferOwn)
+{
+	Poco::FastMutex::ScopedLock lock(shard.mutex);
+
+	if (shard.sessions.empty()) return PooledSessionHolderPtr();
+
+	std::vector<PooledSessionHolderPtr>::iterator it = shard.sessions.end() - 1;
+	if (preferOwn)
+	{
+		const std::thread::id self = std::this_thread::get_id();
+		for (std::vector<PooledSessionHolderPtr>::iterator own = shard.sessions.end(); own != shard.sessions.begin();)
+		{
+			--own;
+			if ((*own)->lastThread() == self)
+			{
+				it = own;
+				++_affinityHits;
+				break;
+			}
 		}
-		else throw SessionPoolExhaustedException(_connector);
 	}
+	PooledSessionHolderPtr pHolder(*it);
+	shard.sessions.erase(it);
+	--_nIdle;
+	return pHolder;
+}
+
+
+void SessionPool::pushIdle(PooledSessionHolderPtr pHolder)
+{
+	Shard& shard = homeShard();
+	Poco::FastMutex::ScopedLock lock(shard.mutex);
+	shard.sessions.push_back(pHolder);
+	++_nIdle;
+}
 
-	PooledSessionHolderPtr pHolder(_idleSessions.front());
-	PooledSessionImplPtr pPSI(new PooledSessionImpl(pHolder));
 
-	_activeSessions.push_front(pHolder);
-	_idleSessions.pop_front();
+bool SessionPool::reserve()
+{
+	int n = _nSessions;
+	while (n < _maxSessions)
+	{
+		if (_nSessions.compare_exchange_weak(n, n + 1)) return true;
+	}
+	return false;
+}
+
+
+SessionPool::PooledSessionHolderPtr SessionPool::create()
+{
+	try
+	{
+		Session newSession(SessionFactory::instance().create(_connector, _connectionString, static_cast<std::size_t>(_connTimeout)));
+		applySettings(newSession.impl());
+		customizeSession(newSession);
+
+		PooledSessionHolderPtr pHolder(new PooledSessionHolder(*this, newSession.impl()));
+		{
+			Poco::Mutex::ScopedLock lock(_mutex);
+			_sessions.insert(pHolder);
+		}
+		++_created;
+		return pHolder;
+	}
+	catch (...)
+	{
+		--_nSessions;
+		throw;
+	}
+}
+
+
+SessionPool::PooledSessionHolderPtr SessionPool::acquire()
+{
+	// Only the sessions handed out are checked; other dead
+	// idle sessions are purged by the janitor timer.
+	while (PooledSessionHolderPtr pHolder = popIdle())
+	{
+		bool good = false;
+		try
+		{
+			good = pHolder->session()->isGood();
+		}
+		catch (...)
+		{
+		}
+		if (good) return pHolder;
+		discard(pHolder);
+	}
+
+	if (reserve()) return create();
+	return PooledSessionHolderPtr();
+}
+
+
+Session SessionPool::checkout(PooledSessionHolderPtr pHolder)
+{
+	PooledSessionImplPtr pPSI(new PooledSessionImpl(pHolder));
+	++_nActive;
+	++_checkouts;
 	return Session(pPSI);
 }
 
 
+void SessionPool::discard(PooledSessionHolderPtr pHolder)
+{
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		if (_sessions.erase(pHolder) == 0) return; // already closed by shutdown()
+	}
+	try
+	{
+		pHolder->session()->close();
+	}
+	catch (...)
+	{
+	}
+	--_nSessions;
+	++_discarded;
+}
+
+
+void SessionPool::enqueue(const WaiterPtr& pWaiter, long timeoutMilliseconds)
+{
+	pWaiter->enqueued = Clock::now();
+	pWaiter->deadline = pWaiter->enqueued + std::chrono::milliseconds(timeoutMilliseconds > 0 ? timeoutMilliseconds : 0);
+
+	Poco::FastMutex::ScopedLock lock(_waitMutex);
+	_waiters.push_back(pWaiter);
+	++_nWaiters;
+}
+
+
+bool SessionPool::cancel(const WaiterPtr& pWaiter)
+{
+	{
+		Poco::FastMutex::ScopedLock lock(_waitMutex);
+		std::deque<WaiterPtr>::iterator it = std::find(_waiters.begin(), _waiters.end(), pWaiter);
+		if (it == _waiters.end()) return false; // being served
+		_waiters.erase(it);
+		--_nWaiters;
+	}
+	recordWait(Clock::now() - pWaiter->enqueued);
+	++_timeouts;
+	return true;
+}
+
+
+void SessionPool::serveWaiters()
+{
+	// A waiter is owned by whoever removes it from the queue. The
+	// promise is always fulfilled after releasing the lock, as this
+	// may destroy a Session, which puts its session back to the pool.
+	while (_nWaiters > 0 && !_shutdown)
+	{
+		WaiterPtr pWaiter;
+		PooledSessionHolderPtr pHolder;
+		std::vector<WaiterPtr> expired;
+		{
+			Poco::FastMutex::ScopedLock lock(_waitMutex);
+			const Clock::time_point now = Clock::now();
+			while (!_waiters.empty() && _waiters.front()->deadline <= now)
+			{
+				expired.push_back(_waiters.front());
+				_waiters.pop_front();
+				--_nWaiters;
+			}
+			if (!_waiters.empty())
+			{
+				pHolder = popIdle();
+				if (pHolder || reserve())
+				{
+					pWaiter = _waiters.front();
+					_waiters.pop_front();
+					--_nWaiters;
+				}
+			}
+		}
+
+		for (const auto& pExpired: expired)
+		{
+			fail(pExpired, std::make_exception_ptr(SessionPoolExhaustedException(_connector)), true);
+		}
+		if (!pWaiter)
+		{
+			if (expired.empty()) break;
+			continue;
+		}
+
+		try
+		{
+			if (pHolder && !pHolder->session()->isGood())
+			{
+				discard(pHolder);
+				pHolder = nullptr;
+				if (!reserve())
+				{
+					Poco::FastMutex::ScopedLock lock(_waitMutex);
+					_waiters.push_front(pWaiter);
+					++_nWaiters;
+					continue;
+				}
+			}
+			if (!pHolder) pHolder = create();
+		}
+		catch (...)
+		{
+			fail(pWaiter, std::current_exception(), false);
+			continue;
+		}
+		recordWait(Clock::now() - pWaiter->enqueued);
+		pWaiter->promise.set_value(checkout(pHolder));
+	}
+}
+
+
+void SessionPool::expireWaiters()
+{
+	std::vector<WaiterPtr> expired;
+	{
+		Poco::FastMutex::ScopedLock lock(_waitMutex);
+		const Clock::time_point now = Clock::now();
+		for (std::deque<WaiterPtr>::iterator it = _waiters.begin(); it != _waiters.end();)
+		{
+			if ((*it)->deadline <= now)
+			{
+				expired.push_back(*it);
+				it = _waiters.erase(it);
+				--_nWaiters;
+			}
+			else ++it;
+		}
+	}
+	for (const auto& pWaiter: expired)
+	{
+		fail(pWaiter, std::make_exception_ptr(SessionPoolExhaustedException(_connector)), true);
+	}
+}
+
+
+void SessionPool::fail(const WaiterPtr& pWaiter, std::exception_ptr pException, bool timeout)
+{
+	recordWait(Clock::now() - pWaiter->enqueued);
+	if (timeout) ++_timeouts;
+	pWaiter->promise.set_exception(pException);
+}
+
+
+void SessionPool::recordWait(Clock::duration waitTime)
+{
+	const Poco::Int64 us = std::chrono::duration_cast<std::chrono::microseconds>(waitTime).count();
+	const double seconds = us/1000000.0;
+	int bucket = 0;
+	while (bucket < Statistics::WAIT_TIME_BUCKETS - 1 && seconds > Statistics::WAIT_TIME_BOUNDS[bucket]) ++bucket;
+	++_waitTimeBuckets[bucket];
+	_waitTimeSum += static_cast<Poco::UInt64>(us);
+	++_waits;
+}
+
+
+SessionPool::Statistics SessionPool::statistics() const
+{
+	Statistics stats;
+	stats.checkouts = _checkouts;
+	stats.created = _created;
+	stats.discarded = _discarded;
+	stats.affinityHits = _affinityHits;
+	stats.waits = _waits;
+	stats.timeouts = _timeouts;
+	Poco::UInt64 count = 0;
+	for (int i = 0; i < Statistics::WAIT_TIME_BUCKETS; ++i)
+	{
+		count += _waitTimeBuckets[i];
+		stats.waitTimeBuckets[i] = count;
+	}
+	stats.waitTimeSum = _waitTimeSum/1000000.0;
+	return stats;
+}
+
+
 void SessionPool::purgeDeadSessions()
 {
 	if (_shutdown) return;
 
-	SessionList::iterator it = _idleSessions.begin();
-	for (; it != _idleSessions.end(); )
+	for (std::size_t i = 0; i <= _shardMask; ++i)
 	{
-		if (!(*it)->session()->isGood())
+		std::vector<PooledSessionHolderPtr> dead;
 		{
-			it = _idleSessions.erase(it);
-			--_nSessions;
+			Shard& shard = _pShards[i];
+			Poco::FastMutex::ScopedLock lock(shard.mutex);
+			std::vector<PooledSessionHolderPtr>::iterator it = shard.sessions.begin();
+			while (it != shard.sessions.end())
+			{
+				if (!(*it)->session()->isGood())
+				{
+					dead.push_back(*it);
+					it = shard.sessions.erase(it);
+					--_nIdle;
+				}
+				else ++it;
+			}
 		}
-		else ++it;
+		for (auto& pHolder: dead) discard(pHolder);
 	}
 }
 
@@ -118,15 +488,13 @@ int SessionPool::capacity() const
 
 int SessionPool::used() const
 {
-	Poco::Mutex::ScopedLock lock(_mutex);
-	return (int) _activeSessions.size();
+	return _nActive;
 }
 
 
 int SessionPool::idle() const
 {
-	Poco::Mutex::ScopedLock lock(_mutex);
-	return (int) _idleSessions.size();
+	return _nIdle;
 }
 
 
@@ -140,13 +508,15 @@ int SessionPool::dead()
 {
 	int count = 0;
 
-	Poco::Mutex::ScopedLock lock(_mutex);
-	SessionList::iterator it = _idleSessions.begin();
-	SessionList::iterator itEnd = _idleSessions.end();
-	for (; it != itEnd; ++it)
+	for (std::size_t i = 0; i <= _shardMask; ++i)
 	{
-		if (!(*it)->session()->isGood())
-			++count;
+		Shard& shard = _pShards[i];
+		Poco::FastMutex::ScopedLock lock(shard.mutex);
+		for (auto& pHolder: shard.sessions)
+		{
+			if (!pHolder->session()->isGood())
+				++count;
+		}
 	}
 
 	return count;
@@ -219,6 +589,8 @@ Poco::Any SessionPool::getProperty(const std::string& name) const
 
 void SessionPool::applySettings(SessionImpl* pImpl)
 {
+	// The settings can no longer be changed once a session
+	// has been created, so they are read without locking.
 	FeatureMap::Iterator fmIt = _featureMap.begin();
 	FeatureMap::Iterator fmEnd = _featureMap.end();
 	for (; fmIt != fmEnd; ++fmIt) pImpl->setFeature(fmIt->first, fmIt->second);
@@ -229,6 +601,29 @@ void SessionPool::applySettings(SessionImpl* pImpl)
 }
 
 
+void SessionPool::restoreSettings(SessionImpl* pImpl)
+{
+	if (_nOverrides == 0) return;
+
+	Poco::Mutex::ScopedLock lock(_mutex);
+	AddPropertyMap::iterator pIt = _addPropertyMap.find(pImpl);
+	if (pIt != _addPropertyMap.end())
+	{
+		pImpl->setProperty(pIt->second.first, pIt->second.second);
+		_addPropertyMap.erase(pIt);
+		--_nOverrides;
+	}
+
+	AddFeatureMap::iterator fIt = _addFeatureMap.find(pImpl);
+	if (fIt != _addFeatureMap.end())
+	{
+		pImpl->setFeature(fIt->second.first, fIt->second.second);
+		_addFeatureMap.erase(fIt);
+		--_nOverrides;
+	}
+}
+
+
 void SessionPool::customizeSession(Session&)
 {
 }
@@ -238,52 +633,41 @@ void SessionPool::putBack(PooledSessionHolderPtr pHolder)
 {
 	if (_shutdown) return;
 
-	Poco::Mutex::ScopedLock lock(_mutex);
-	SessionList::iterator it = std::find(_activeSessions.begin(), _activeSessions.end(), pHolder);
-	if (it != _activeSessions.end())
+	poco_assert (&pHolder->owner() == this);
+
+	--_nActive;
+	try
 	{
-		try
+		if (pHolder->session()->isGood())
 		{
-			if (pHolder->session()->isGood())
-			{
-				pHolder->session()->reset();
+			pHolder->session()->reset();
 
-				// reverse settings applied at acquisition time, if any
-				AddPropertyMap::iterator pIt = _addPropertyMap.find(pHolder->session());
-				if (pIt != _addPropertyMap.end())
-					pHolder->session()->setProperty(pIt->second.first, pIt->second.second);
+			// reverse settings applied at acquisition time, if any
+			restoreSettings(pHolder->session());
 
-				AddFeatureMap::iterator fIt = _addFeatureMap.find(pHolder->session());
-				if (fIt != _addFeatureMap.end())
-					pHolder->session()->setFeature(fIt->second.first, fIt->second.second);
-
-				// re-apply the default pool settings
-				applySettings(pHolder->session());
-
-				pHolder->access();
-				_idleSessions.push_back(pHolder);
-			}
-			else --_nSessions;
+			// re-apply the default pool settings
+			applySettings(pHolder->session());
 
-			_activeSessions.erase(it);
-		}
-		catch (const Poco::Exception& e)
-		{
-			--_nSessions;
-			_activeSessions.erase(it);
-			poco_bugcheck_msg(format("Exception in SessionPool::putBack(): %s", e.displayText()).c_str());
-		}
-		catch (...)
-		{
-			--_nSessions;
-			_activeSessions.erase(it);
-			poco_bugcheck_msg("Unknown exception in SessionPool::putBack()");
+			pHolder->access();
+			pHolder->setLastThread(std::this_thread::get_id());
+			pushIdle(pHolder);
 		}
+		else discard(pHolder);
+	}
+	catch (const Poco::Exception& e)
+	{
+		discard(pHolder);
+		poco_bugcheck_msg(format("Exception in SessionPool::putBack(): %s", e.displayText()).c_str());
 	}
-	else
+	catch (...)
 	{
-		poco_bugcheck_msg("Unknown session passed to SessionPool::putBack()");
+		discard(pHolder);
+		poco_bugcheck_msg("Unknown exception in SessionPool::putBack()");
 	}
+
+	// Checked after the session has been made available, so that a
+	// request that has been enqueued concurrently cannot be missed.
+	if (_nWaiters > 0) serveWaiters();
 }
 
 
@@ -291,54 +675,75 @@ void SessionPool::onJanitorTimer(Poco::Timer&)
 {
 	if (_shutdown) return;
 
-	Poco::Mutex::ScopedLock lock(_mutex);
-	SessionList::iterator it = _idleSessions.begin();
-	while (_nSessions > _minSessions && it != _idleSessions.end())
+	purgeDeadSessions();
+
+	std::vector<PooledSessionHolderPtr> expired;
+	for (std::size_t i = 0; i <= _shardMask; ++i)
 	{
-		if ((*it)->idle() > _idleTime || !(*it)->session()->isGood())
+		Shard& shard = _pShards[i];
+		Poco::FastMutex::ScopedLock lock(shard.mutex);
+
+		// the least recently used sessions are at the front
+		std::vector<PooledSessionHolderPtr>::iterator it = shard.sessions.begin();
+		while (_nSessions - static_cast<int>(expired.size()) > _minSessions && it != shard.sessions.end())
 		{
-			try
+			if ((*it)->idle() > _idleTime)
 			{
-				(*it)->session()->close();
+				expired.push_back(*it);
+				it = shard.sessions.erase(it);
+				--_nIdle;
 			}
-			catch (...)
-			{
-			}
-			it = _idleSessions.erase(it);
-			--_nSessions;
+			else ++it;
 		}
-		else ++it;
 	}
+	for (auto& pHolder: expired) discard(pHolder);
+
+	expireWaiters();
+	if (_nWaiters > 0) serveWaiters();
 }
 
 
 void SessionPool::shutdown()
 {
 	if (_shutdown.exchange(true)) return;
-	_shutdown = true;
 	_janitorTimer.stop();
 
-	Poco::Mutex::ScopedLock lock(_mutex);
-	closeAll(_idleSessions);
-	closeAll(_activeSessions);
-}
+	std::deque<WaiterPtr> waiters;
+	{
+		Poco::FastMutex::ScopedLock lock(_waitMutex);
+		waiters.swap(_waiters);
+		_nWaiters = 0;
+	}
+	for (const auto& pWaiter: waiters)
+	{
+		fail(pWaiter, std::make_exception_ptr(InvalidAccessException("Session pool has been shut down.")), false);
+	}
 
+	for (std::size_t i = 0; i <= _shardMask; ++i)
+	{
+		Shard& shard = _pShards[i];
+		Poco::FastMutex::ScopedLock lock(shard.mutex);
+		shard.sessions.clear();
+	}
 
-void SessionPool::closeAll(SessionList& sessionList)
-{
-	SessionList::iterator it = sessionList.begin();
-	for (; it != sessionList.end();)
+	std::set<PooledSessionHolderPtr> sessions;
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		sessions.swap(_sessions);
+	}
+	for (auto pHolder: sessions)
 	{
 		try
 		{
-			(*it)->session()->close();
+			pHolder->session()->close();
 		}
 		catch (...)
 		{
 		}
-		it = sessionList.erase(it);
-		if (_nSessions > 0) --_nSessions;
 	}
+	_nIdle = 0;
+	_nActive = 0;
+	_nSessions = 0;
 }
 
 
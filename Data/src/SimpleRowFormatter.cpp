@@ -15,6 +15,7 @@
 #include "Poco/Data/SimpleRowFormatter.h"
 #include "Poco/Exception.h"
 #include <iomanip>
+#include <string_view>
 
 
 namespace Poco {
@@ -82,31 +83,51 @@ std::string& SimpleRowFormatter::formatNames(const NameVecPtr pNames, std::strin
 
 std::string& SimpleRowFormatter::formatValues(const ValueVec& vals, std::string& formattedValues)
 {
-	std::ostringstream str;
-	std::string space(_spacing, ' ');
-	ValueVec::const_iterator it = vals.begin();
-	ValueVec::const_iterator end = vals.end();
-	for (; it != end; ++it)
+	std::vector<std::string> strings(vals.size());
+	FieldVec fields(vals.size());
+	for (std::size_t i = 0; i < vals.size(); ++i)
 	{
-		if (it != vals.begin()) str << space;
-		if (it->isNumeric())
+		const Poco::Dynamic::Var& val = vals[i];
+		if (!val.isEmpty())
 		{
-			str << std::right
-				<< std::fixed
-				<< std::setprecision(2);
+			strings[i] = val.convert<std::string>();
+			fields[i].text = strings[i];
+			fields[i].isNumeric = val.isNumeric();
 		}
-		else str << std::left;
+		else fields[i].isNull = true;
+	}
+
+	formattedValues.clear();
+	return formatFields(fields, formattedValues);
+}
+
 
-		if (!it->isEmpty())
-			str << std::setw(_colWidth) << it->convert<std::string>();
+std::string& SimpleRowFormatter::formatFields(const FieldVec& fields, std::string& formattedValues)
+{
+	const std::size_t width = _colWidth > 0 ? static_cast<std::size_t>(_colWidth) : 0;
+	const std::size_t spacing = _spacing > 0 ? static_cast<std::size_t>(_spacing) : 0;
+	for (FieldVec::const_iterator it = fields.begin(); it != fields.end(); ++it)
+	{
+		if (it != fields.begin()) formattedValues.append(spacing, ' ');
+
+		std::string_view text = it->isNull ? std::string_view("null") : it->text;
+		std::size_t padding = text.size() < width ? width - text.size() : 0;
+		if (it->isNumeric && !it->isNull)
+		{
+			formattedValues.append(padding, ' ');
+			formattedValues += text;
+		}
 		else
-			str << std::setw(_colWidth) << "null";
+		{
+			formattedValues += text;
+			formattedValues.append(padding, ' ');
+		}
 	}
-	str << std::endl;
+	formattedValues += '\n';
 
 	++_rowCount;
 
-	return formattedValues = str.str();
+	return formattedValues;
 }
 
 
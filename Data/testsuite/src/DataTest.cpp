@@ -18,6 +18,7 @@
 #include "Poco/Data/LOBStream.h"
 #include "Poco/Data/MetaColumn.h"
 #include "Poco/Data/Column.h"
+#include "Poco/Data/ColumnSpan.h"
 #include "Poco/Data/Date.h"
 #include "Poco/Data/Time.h"
 #include "Poco/Data/SQLChannel.h"
@@ -1284,6 +1285,119 @@ void DataTest::testJSONRowFormatter()
 }
 
 
+void DataTest::testFormatFields()
+{
+	RowFormatter::FieldVec fields(4);
+	fields[0].text = "12";
+	fields[0].isNumeric = true;
+	fields[1].text = " Bart ";
+	fields[1].isString = true;
+	fields[2].isNull = true;
+	fields[3].text = "say \"hi\"";
+	fields[3].isString = true;
+
+	std::string formatted;
+	SimpleRowFormatter srf(6, 2);
+	assertTrue (srf.canFormatFields());
+	srf.formatFields(fields, formatted);
+	assertTrue (formatted == "    12   Bart   null    say \"hi\"\n");
+	assertTrue (srf.rowCount() == 1);
+
+	Row row;
+	row.append("field0", 12);
+	row.append("field1", " Bart "s);
+	row.append("field2", Var());
+	row.append("field3", "say \"hi\""s);
+	row.setFormatter(new SimpleRowFormatter(6, 2));
+	assertTrue (row.valuesToString() == formatted);
+
+	JSONRowFormatter jrf;
+	assertTrue (jrf.canFormatFields());
+	formatted.clear();
+	jrf.formatFields(fields, formatted);
+	assertTrue (formatted == ",\"values\":[[12,\"Bart\",null,\"say \\\"hi\\\"\"]");
+	jrf.formatFields(fields, formatted);
+	assertTrue (formatted == ",\"values\":[[12,\"Bart\",null,\"say \\\"hi\\\"\"],[12,\"Bart\",null,\"say \\\"hi\\\"\"]");
+
+	row.setFormatter(new JSONRowFormatter);
+	assertTrue (row.valuesToString() == ",\"values\":[[12,\"Bart\",null,\"say \\\"hi\\\"\"]");
+
+	JSONRowFormatter full(JSONRowFormatter::JSON_FMT_MODE_FULL);
+	RowFormatter::NameVecPtr pNames = new RowFormatter::NameVec{"a", "b", "c", "d"};
+	std::string names;
+	full.formatNames(pNames, names);
+	formatted.clear();
+	full.formatFields(fields, formatted);
+	assertTrue (formatted == "{\"a\":12,\"b\":\"Bart\",\"c\":null,\"d\":\"say \\\"hi\\\"\"}");
+
+	try
+	{
+		RowFormatter rf;
+		rf.formatFields(fields, formatted);
+		fail ("must throw");
+	}
+	catch (NotImplementedException&)
+	{
+	}
+}
+
+
+void DataTest::testColumnSpan()
+{
+	ColumnSpan<int> empty;
+	assertTrue (empty.empty());
+	assertTrue (empty.sum() == 0);
+	assertTrue (empty.min().isNull());
+	assertTrue (empty.max().isNull());
+
+	std::vector<int> ints = {5, -3, 8, 1, 7, 2, 9};
+	ColumnSpan<int> intSpan(ints.data(), ints.size());
+	assertTrue (intSpan.size() == 7);
+	assertTrue (intSpan.nullCount() == 0);
+	assertTrue (intSpan.count() == 7);
+	assertTrue (intSpan.sum() == 29);
+	assertTrue (intSpan.min().value() == -3);
+	assertTrue (intSpan.max().value() == 9);
+	assertTrue (intSpan[2] == 8);
+	assertTrue (intSpan.at(6) == 9);
+	assertTrue (std::vector<int>(intSpan.begin(), intSpan.end()) == ints);
+	try
+	{
+		intSpan.at(7);
+		fail ("must throw");
+	}
+	catch (RangeException&)
+	{
+	}
+
+	std::vector<double> doubles = {1.5, 100.0, 2.5, -50.0, 4.0};
+	std::deque<bool> nulls = {false, true, false, true, false};
+	ColumnSpan<double> doubleSpan(doubles.data(), doubles.size(), &nulls);
+	assertTrue (doubleSpan.nullCount() == 2);
+	assertTrue (doubleSpan.count() == 3);
+	assertTrue (doubleSpan.isNull(1));
+	assertTrue (!doubleSpan.isNull(2));
+	assertEqualDelta (8.0, doubleSpan.sum(), 0.0001);
+	assertEqualDelta (1.5, doubleSpan.min().value(), 0.0001);
+	assertEqualDelta (4.0, doubleSpan.max().value(), 0.0001);
+
+	std::deque<bool> allNull(doubles.size(), true);
+	ColumnSpan<double> nullSpan(doubles.data(), doubles.size(), &allNull);
+	assertTrue (nullSpan.count() == 0);
+	assertTrue (nullSpan.sum() == 0);
+	assertTrue (nullSpan.min().isNull());
+
+	std::vector<UInt32> large(1000, 0xFFFFFFFF);
+	ColumnSpan<UInt32> largeSpan(large.data(), large.size());
+	assertTrue (largeSpan.sum() == UInt64(1000)*0xFFFFFFFF);
+
+	std::vector<std::string> strings = {"pear", "apple", "plum"};
+	ColumnSpan<std::string> stringSpan(strings.data(), strings.size());
+	assertTrue (stringSpan.min().value() == "apple");
+	assertTrue (stringSpan.max().value() == "plum");
+}
+
+
 void DataTest::testDateAndTime()
 {
 	DateTime dt;
@@ -1655,6 +1769,8 @@ CppUnit::Test* DataTest::suite()
 	CppUnit_addTest(pSuite, DataTest, testRowSort);
 	CppUnit_addTest(pSuite, DataTest, testSimpleRowFormatter);
 	CppUnit_addTest(pSuite, DataTest, testJSONRowFormatter);
+	CppUnit_addTest(pSuite, DataTest, testFormatFields);
+	CppUnit_addTest(pSuite, DataTest, testColumnSpan);
 	CppUnit_addTest(pSuite, DataTest, testDateAndTime);
 	CppUnit_addTest(pSuite, DataTest, testExternalBindingAndExtraction);
 	CppUnit_addTest(pSuite, DataTest, testTranscode);
@@ -42,6 +42,8 @@ public:
 	void testRowSort();
 	void testSimpleRowFormatter();
 	void testJSONRowFormatter();
+	void testFormatFields();
+	void testColumnSpan();
 	void testDateAndTime();
 	void testExternalBindingAndExtraction();
 	void testTranscode();
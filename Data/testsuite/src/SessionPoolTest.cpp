@@ -14,6 +14,8 @@
 #include "Poco/Data/SessionPool.h"
 #include "Poco/Data/SessionPoolContainer.h"
 #include "Poco/Thread.h"
+#include "Poco/Event.h"
+#include "Poco/Stopwatch.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/Exception.h"
 #include "Connector.h"
@@ -21,6 +23,8 @@
 
 using namespace Poco::Data::Keywords;
 using Poco::Thread;
+using Poco::Event;
+using Poco::Stopwatch;
 using Poco::AutoPtr;
 using Poco::NotFoundException;
 using Poco::InvalidAccessException;
@@ -263,6 +267,181 @@ void SessionPoolTest::testSessionPoolContainer()
 }
 
 
+void SessionPoolTest::testSessionPoolWait()
+{
+	SessionPool pool("test", "cs", 1, 2, 60, 10);
+	Session s1(pool.get());
+	Session s2(pool.get(1000));
+	assertTrue (pool.allocated() == 2);
+	assertTrue (pool.waiting() == 0);
+
+	Stopwatch sw;
+	sw.start();
+	try
+	{
+		Session s3(pool.get(100));
+		fail("pool exhausted - must throw");
+	}
+	catch (SessionPoolExhaustedException&) { }
+	sw.stop();
+	assertTrue (sw.elapsed() >= 90000);
+	assertTrue (pool.waiting() == 0);
+
+	Thread thread;
+	thread.startFunc([&s1]()
+	{
+		Thread::sleep(200);
+		s1.close();
+	});
+	Session s3(pool.get(10000));
+	thread.join();
+	assertTrue (pool.allocated() == 2);
+	assertTrue (pool.used() == 2);
+	assertTrue (pool.idle() == 0);
+	assertTrue (pool.waiting() == 0);
+
+	// a session that has been discarded makes room for a new one
+	s3.setFeature("connected", false);
+	thread.startFunc([&s3]()
+	{
+		Thread::sleep(200);
+		s3.close();
+	});
+	Session s4(pool.get(10000));
+	thread.join();
+	assertTrue (s4.isGood());
+	assertTrue (pool.allocated() == 2);
+
+	SessionPool::Statistics stats = pool.statistics();
+	assertTrue (stats.checkouts == 4);
+	assertTrue (stats.created == 3);
+	assertTrue (stats.discarded == 1);
+	assertTrue (stats.waits == 3);
+	assertTrue (stats.timeouts == 1);
+	assertTrue (stats.waitTimeBuckets[SessionPool::Statistics::WAIT_TIME_BUCKETS - 1] == 3);
+	assertTrue (stats.waitTimeBuckets[0] == 0); // all waits took more than 1 ms
+	for (int i = 1; i < SessionPool::Statistics::WAIT_TIME_BUCKETS; ++i)
+	{
+		assertTrue (stats.waitTimeBuckets[i] >= stats.waitTimeBuckets[i - 1]);
+	}
+	assertTrue (stats.waitTimeSum >= 0.45);
+}
+
+
+void SessionPoolTest::testSessionPoolAsync()
+{
+	SessionPool pool("test", "cs", 1, 1, 60, 10);
+
+	std::future<Session> f1 = pool.getAsync(1000);
+	assertTrue (f1.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+	Session s1 = f1.get();
+	assertTrue (pool.used() == 1);
+
+	std::future<Session> f2 = pool.getAsync(10000);
+	std::future<Session> f3 = pool.getAsync(10000);
+	assertTrue (pool.waiting() == 2);
+	assertTrue (f2.wait_for(std::chrono::milliseconds(50)) == std::future_status::timeout);
+
+	// requests are served in FIFO order
+	s1.close();
+	assertTrue (f2.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+	assertTrue (f3.wait_for(std::chrono::seconds(0)) == std::future_status::timeout);
+	assertTrue (pool.waiting() == 1);
+	Session s2 = f2.get();
+	s2.close();
+	assertTrue (f3.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+	Session s3 = f3.get();
+	assertTrue (s3.isGood());
+	assertTrue (pool.waiting() == 0);
+
+	// a synchronous request does not overtake waiting requests
+	std::future<Session> f4 = pool.getAsync(10000);
+	std::unique_ptr<Session> pS4;
+	Thread thread;
+	thread.startFunc([&pool, &pS4]()
+	{
+		pS4.reset(new Session(pool.get(10000)));
+	});
+	while (pool.waiting() < 2) Thread::sleep(10);
+	s3.close();
+	assertTrue (f4.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+	f4.get().close();
+	thread.join();
+	assertTrue (pS4->isGood());
+
+	// an abandoned request returns its session to the pool
+	{
+		std::future<Session> f5 = pool.getAsync(10000);
+	}
+	pS4->close();
+	assertTrue (pool.idle() == 1);
+	assertTrue (pool.used() == 0);
+	assertTrue (pool.waiting() == 0);
+
+	Session s6 = pool.get();
+	std::future<Session> f6 = pool.getAsync(10000);
+	pool.shutdown();
+	try
+	{
+		f6.get();
+		fail("pool shut down - must throw");
+	}
+	catch (InvalidAccessException&) { }
+	assertTrue (pool.waiting() == 0);
+}
+
+
+void SessionPoolTest::testSessionPoolAffinity()
+{
+	SessionPool pool("test", "cs", 1, 2, 60, 10);
+	assertTrue (!pool.getThreadAffinity());
+
+	Event acquired;
+	Event release;
+	Event released;
+	Thread thread;
+	auto useOther = [&]()
+	{
+		thread.startFunc([&]()
+		{
+			Session s = pool.get();
+			s.setProperty("p3", 2);
+			acquired.set();
+			release.wait();
+			s.close();
+			released.set();
+		});
+		acquired.wait();
+	};
+
+	// without affinity, the most recently returned session is handed out
+	Session s1 = pool.get();
+	s1.setProperty("p3", 1);
+	useOther();
+	s1.close();
+	release.set();
+	released.wait();
+	thread.join();
+	Session s2 = pool.get();
+	assertTrue (Poco::AnyCast<int>(s2.getProperty("p3")) == 2);
+	s2.close();
+
+	// with affinity, a thread gets back its own session
+	pool.setThreadAffinity(true);
+	assertTrue (pool.getThreadAffinity());
+	Session s3 = pool.get();
+	s3.setProperty("p3", 1);
+	useOther();
+	s3.close();
+	release.set();
+	released.wait();
+	thread.join();
+	Session s4 = pool.get();
+	assertTrue (Poco::AnyCast<int>(s4.getProperty("p3")) == 1);
+	assertTrue (pool.statistics().affinityHits >= 1);
+}
+
+
 void SessionPoolTest::setUp()
 {
 }
@@ -279,6 +458,9 @@ CppUnit::Test* SessionPoolTest::suite()
 
 	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPool);
 	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPoolContainer);
+	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPoolWait);
+	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPoolAsync);
+	CppUnit_addTest(pSuite, SessionPoolTest, testSessionPoolAffinity);
 
 	return pSuite;
 }
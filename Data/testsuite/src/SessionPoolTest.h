@@ -26,6 +26,9 @@ public:
 
 	void testSessionPool();
 	void testSessionPoolContainer();
+	void testSessionPoolWait();
+	void testSessionPoolAsync();
+	void testSessionPoolAffinity();
 
 	void setUp();
 	void tearDown();
@@ -20,6 +20,7 @@
 
 #include "Poco/Foundation.h"
 #include "Poco/ActiveThreadPool.h"
+#include "Poco/WorkStealingThreadPool.h"
 #include "Poco/ActiveRunnable.h"
 
 
@@ -42,6 +43,27 @@ public:
 };
 
 
+template <class OwnerType>
+class WorkStealingStarter
+	/// An alternative implementation of the StarterType
+	/// policy for ActiveMethod. It starts the method
+	/// in the default WorkStealingThreadPool, which scales
+	/// better than the default ActiveThreadPool if many
+	/// short active methods are started concurrently.
+	///
+	/// Usage:
+	///     ActiveMethod<std::string, std::string, MyActiveObject,
+	///         WorkStealingStarter<MyActiveObject>> exampleActiveMethod;
+{
+public:
+	static void start(OwnerType* /*pOwner*/, ActiveRunnableBase::Ptr pRunnable)
+	{
+		WorkStealingThreadPool::defaultPool().start(*pRunnable);
+		pRunnable->duplicate(); // The runnable will release itself.
+	}
+};
+
+
 } // namespace Poco
 
 
@@ -61,6 +61,12 @@ public:
 	void compress(bool flag = true);
 		/// Enables or disables compression of archived files.
 
+	void compressThreads(int threads);
+		/// Sets the number of threads used for compressing an
+		/// archived file. If greater than one (or zero, for one
+		/// thread per processor), the file is compressed in parallel.
+		/// See DeflatingStreamBuf for details. The default is one.
+
 	void setPurgeCallback(PurgeCallback callback);
 		/// Sets a callback to be invoked after compression completes.
 		/// Used by FileChannel to trigger purging at the right time.
@@ -85,6 +91,7 @@ private:
 	void compressFile(const std::string& path);
 
 	std::atomic<bool> _compress;
+	std::atomic<int> _compressThreads;
 	std::atomic<ArchiveCompressor*> _pCompressor;
 
 protected:
@@ -25,7 +25,12 @@
 #include "Poco/Runnable.h"
 #include "Poco/AutoPtr.h"
 #include "Poco/NotificationQueue.h"
+#include "Poco/MPSCQueue.h"
+#include "Poco/Event.h"
+#include "Poco/Message.h"
 #include <atomic>
+#include <memory>
+#include <vector>
 
 
 namespace Poco {
@@ -40,6 +45,20 @@ class Foundation_API AsyncChannel: public Channel, public Runnable
 	///
 	/// All log messages are put into a queue and this queue is
 	/// then processed by a separate thread.
+	///
+	/// By default, the queue is a NotificationQueue, which allocates
+	/// a notification for every message and serializes all logging
+	/// threads on a mutex. Setting the "ringBufferSize" property
+	/// switches the channel to a set of lock-free ring buffers
+	/// (MPSCQueue) instead, each with a fixed number of preallocated
+	/// message slots. Logging threads are distributed over the ring
+	/// buffers, so that they rarely contend for the same one, and the
+	/// background thread forwards messages to the target channel in
+	/// batches. Messages logged by the same thread are always
+	/// delivered in order, but messages logged by different threads
+	/// may be delivered in a slightly different order than they were
+	/// logged. What happens when a ring buffer is full is controlled
+	/// by the "overflowPolicy" property.
 {
 public:
 	using Ptr = AutoPtr<AsyncChannel>;
@@ -109,6 +128,30 @@ public:
 	/// Only supported on Linux and Windows.
 	///
 	/// The "enableCpuAffinity" property is set-only.
+	///
+	/// The "ringBufferSize" property enables the ring buffer mode
+	/// and specifies the number of message slots of each ring buffer.
+	/// One ring buffer is created for every processor (rounded up to a
+	/// power of two, but not more than 16). A value of 0 or "none"
+	/// selects the NotificationQueue (default).
+	///
+	/// The "overflowPolicy" property specifies what happens if a
+	/// message is logged while its ring buffer is full:
+	///    * block: the logging thread waits until a slot becomes
+	///      available (default).
+	///    * drop: the message is dropped.
+	///    * sample: as with drop, but in addition, as soon as a ring
+	///      buffer is half full, only every n-th message with a
+	///      priority lower than error is queued, where n is given
+	///      by the "sampleRate" property (default 10).
+	/// As with "queueSize", a message indicating the number of
+	/// dropped messages is logged by the background thread.
+	///
+	/// The "batchSize" property specifies the maximum number of
+	/// messages the background thread takes from a ring buffer at
+	/// once (default 64).
+	///
+	/// These properties cannot be changed once the channel is open.
 
 protected:
 	~AsyncChannel() override;
@@ -116,9 +159,27 @@ protected:
 	void setPriority(const std::string& value);
 
 private:
+	using RingBuffer = MPSCQueue<Message>;
+
+	enum OverflowPolicy
+	{
+		OVERFLOW_BLOCK,
+		OVERFLOW_DROP,
+		OVERFLOW_SAMPLE
+	};
+
 	template <typename M>
 	void logImpl(M&& msg);
 
+	template <typename M>
+	void logToRing(M&& msg);
+
+	void runRing();
+	std::size_t drainRings();
+	bool ringsEmpty() const;
+	void wakeUpRing();
+	void setRingProperty(const std::string& name, const std::string& value);
+
 	Channel::Ptr _pChannel;
 	Thread    _thread;
 	FastMutex _threadMutex;
@@ -128,6 +189,17 @@ private:
 	std::size_t _dropCount = 0;
 	std::atomic<bool> _closed;
 	bool _enableCpuAffinity = false;
+
+	std::vector<std::unique_ptr<RingBuffer>> _rings;
+	std::atomic<bool> _ringsReady;
+	std::size_t _ringSize = 0;
+	std::size_t _batchSize = 64;
+	std::size_t _sampleRate = 10;
+	OverflowPolicy _overflowPolicy = OVERFLOW_BLOCK;
+	std::atomic<std::size_t> _ringDropCount;
+	std::atomic<std::size_t> _sampleCount;
+	std::atomic<bool> _ringIdle;
+	Event _ringEvent;
 };
 
 
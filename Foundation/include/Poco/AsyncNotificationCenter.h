@@ -23,6 +23,8 @@
 #include "Poco/Thread.h"
 #include "Poco/RunnableAdapter.h"
 #include "Poco/NotificationQueue.h"
+#include "Poco/MPSCQueue.h"
+#include "Poco/RCUPtr.h"
 #include "Poco/AsyncObserver.h"
 
 #if (POCO_HAVE_CPP20_COMPILER)
@@ -35,9 +37,8 @@
 #include <mutex>
 #include <condition_variable>
 #include <vector>
-#include <list>
-#include <map>
-#include <optional>
+#include <deque>
+#include <atomic>
 
 namespace Poco {
 
@@ -52,7 +53,7 @@ class Foundation_API AsyncNotificationCenter: public NotificationCenter
 	/// - ENQUEUE: Notifications are added to a queue, separate single thread
 	///            asynchronously dispatches them to observers sequentially
 	///
-	/// - NOTIFY: Notifications are added to a list for each observer, multiple
+	/// - NOTIFY: Notifications are added to a queue for each observer, multiple
 	///           worker threads process notifications in parallel
 	///
 	/// - BOTH: Combination of both modes, notifications are enqueued and worker
@@ -62,10 +63,19 @@ class Foundation_API AsyncNotificationCenter: public NotificationCenter
 	///
 	/// These modes are only available if the compiler supports C++20 std::jthread.
 	///
-	/// Notifications can be delivered to observers in a different order than they
-	/// were posted, as they are processed by multiple worker threads. Observer
-	/// handlers must also be thread-safe as multiple notifications can be dispatched
-	/// to the same observer in parallel.
+	/// Every observer has its own lock-free queue (see MPSCQueue) of pending
+	/// notifications. Posting a notification adds it to the queues of all
+	/// observers accepting it, without taking a lock. An observer with pending
+	/// notifications is scheduled to a worker thread, which then delivers a
+	/// batch of up to 64 notifications to the observer before moving on to the
+	/// next observer. Therefore, an observer receives notifications from one
+	/// worker thread at a time, normally in the order they were posted.
+	/// Different observers are notified in parallel, so observer handlers
+	/// shared by several observers must be thread-safe.
+	///
+	/// If the queue of an observer is full (the observer cannot keep up),
+	/// further notifications are kept in an overflow list until the
+	/// observer has caught up.
 	///
 	/// Note about using AsyncObserver
 	///
@@ -168,11 +178,61 @@ private:
 #if (POCO_HAVE_JTHREAD)
 	// Async notification dispatching
 
-	using NotificationList = std::list<Notification::Ptr>;
-	using ObserversMap = std::map<AbstractObserverPtr, NotificationList>;
-	using NotificationTuple = std::tuple<AbstractObserverPtr, Notification::Ptr>;
+	enum
+	{
+		OBSERVER_QUEUE_CAPACITY = 1024,
+		DISPATCH_BATCH_SIZE = 64
+	};
+
+	class ObserverQueue: public RefCountedObject
+		/// The pending notifications of an observer.
+	{
+	public:
+		explicit ObserverQueue(const AbstractObserverPtr& pObs):
+			pObserver(pObs),
+			queue(OBSERVER_QUEUE_CAPACITY)
+		{
+		}
+
+		bool pending() const
+		{
+			return !queue.empty() || overflowed.load();
+		}
+
+		const AbstractObserverPtr pObserver;
+		MPSCQueue<Notification::Ptr> queue;
+		std::mutex overflowMutex;
+		std::deque<Notification::Ptr> overflow;
+		std::atomic<bool> overflowed { false };
+		std::atomic<bool> scheduled { false };
+			/// True while the queue is in the ready list or being
+			/// dispatched, which ensures that there is only one
+			/// consumer of the queue.
+	};
+
+	using ObserverQueuePtr = AutoPtr<ObserverQueue>;
+
+	class QueueSnapshot: public RefCountedObject
+		/// The queues of all observers, in the same
+		/// order as in the observer snapshot.
+	{
+	public:
+		ObserverSnapshotPtr pObservers;
+		std::vector<ObserverQueuePtr> queues;
+	};
+
+	void observersChanged(const ObserverSnapshotPtr& pObservers) override;
+		/// Creates the queues for new observers.
+
+	void enqueue(ObserverQueue& queue, const Notification::Ptr& pNotification);
+		/// Adds the notification to the observer's queue and
+		/// schedules the queue, if necessary.
 
-	std::optional<NotificationTuple> nextNotification();
+	void schedule(const ObserverQueuePtr& pQueue);
+		/// Adds the queue to the ready list.
+
+	void dispatchBatch(ObserverQueue& queue);
+		/// Delivers up to DISPATCH_BATCH_SIZE notifications from the queue.
 
 	void dispatchNotifications(std::stop_token& stopToken, std::size_t workerId);
 		/// Dispatching function executed by each worker thread.
@@ -182,26 +242,19 @@ private:
 		/// This can be configured to a different value if needed.
 
 	std::vector<std::jthread> _workers;
-		/// Workers pop notifications from the lists and call the observers' notification handlers.
-		/// If an observer is not registered anymore (hasObserver), it is removed from the map.
-		/// Workers pick observers in a round robin fashion.
-
-	ObserversMap _lists;
-		/// Each observer has its own list of pending notifications.
-		/// Observers are identifed by their pointers.
-		/// When adding to the queue, observersToNotify is used to get the observers
-		/// that are registered for such notification.
-
-	ObserversMap::iterator _workerIterator;
-		/// Iterator to the current observer list being processed by the worker threads.
-		/// It is used to ensure that workers process observers in a round robin fashion.
-
-	std::mutex _listsMutex;
-		/// Mutex to protect access to the lists of notifications.
-		/// It is used to ensure that workers can safely access the lists.
-	std::atomic<bool> _listsEmpty { true };
-	std::condition_variable	_listsEmptyCondition;
-		// Condition variable to notify workers when new notifications are added to lists.
+		/// Workers take observer queues from the ready list and deliver
+		/// pending notifications to the observers.
+
+	RCUPtr<QueueSnapshot> _queues;
+		/// The queues of the registered observers, replaced
+		/// whenever an observer is added or removed.
+
+	std::deque<ObserverQueuePtr> _ready;
+		/// Queues with pending notifications, in the order they became ready.
+
+	std::mutex _readyMutex;
+	std::condition_variable _readyCondition;
+		// Condition variable to notify workers when queues become ready.
 
 #endif
 };
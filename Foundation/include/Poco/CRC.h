@@ -0,0 +1,74 @@
+//
+// CRC.h
+//
+// Library: Foundation
+// Package: Core
+// Module:  CRC
+//
+// Definition of the CRC class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_CRC_INCLUDED
+#define Foundation_CRC_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <cstddef>
+
+
+namespace Poco {
+
+
+class Foundation_API CRC
+	/// This class provides fast implementations of the
+	/// CRC-32 (ISO-HDLC, as used by zlib, Zip and Ethernet)
+	/// and CRC-32C (Castagnoli, as used by iSCSI, SCTP, ext4
+	/// and many storage and messaging protocols) checksums.
+	///
+	/// The implementation is selected at runtime, based on the
+	/// features of the CPU:
+	///   - On x86/x64 CPUs supporting SSE 4.2, CRC-32C is computed
+	///     with the CRC32 instruction.
+	///   - On x86/x64 CPUs supporting PCLMULQDQ, CRC-32 is computed
+	///     by folding 64 byte blocks with carry-less multiplication.
+	///   - On ARMv8 CPUs with the CRC extension, both checksums are
+	///     computed with the CRC32 instructions (if enabled at compile
+	///     time, e.g. with -march=armv8-a+crc).
+	/// Otherwise, a table-driven (slicing-by-8) implementation is used.
+	///
+	/// Both functions use the same conventions as zlib's crc32():
+	/// the initial value is 0, and the result of a previous call
+	/// can be passed as crc to continue the computation.
+	///
+	/// Usually, the Checksum class is used to compute checksums.
+{
+public:
+	static UInt32 crc32(UInt32 crc, const void* data, std::size_t length);
+		/// Updates the given CRC-32 with the given data and
+		/// returns the updated CRC-32. The result is identical to
+		/// the result of zlib's crc32().
+
+	static UInt32 crc32c(UInt32 crc, const void* data, std::size_t length);
+		/// Updates the given CRC-32C with the given data and
+		/// returns the updated CRC-32C.
+
+	static bool isCRC32Accelerated();
+		/// Returns true if CRC-32 is computed using
+		/// special CPU instructions.
+
+	static bool isCRC32CAccelerated();
+		/// Returns true if CRC-32C is computed using
+		/// special CPU instructions.
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_CRC_INCLUDED
@@ -25,7 +25,7 @@ namespace Poco {
 
 
 class Foundation_API Checksum
-	/// This class calculates CRC-32 or Adler-32 checksums
+	/// This class calculates CRC-32, CRC-32C or Adler-32 checksums
 	/// for arbitrary data.
 	///
 	/// A cyclic redundancy check (CRC) is a type of hash function, which is used to produce a
@@ -36,13 +36,20 @@ class Foundation_API Checksum
 	/// It is almost as reliable as a 32-bit cyclic redundancy check for protecting against
 	/// accidental modification of data, such as distortions occurring during a transmission,
 	/// but is significantly faster to calculate in software.
+	///
+	/// CRC-32C uses the Castagnoli polynomial, which has better error detection
+	/// properties than CRC-32 and is used by iSCSI, SCTP and many storage formats.
+	///
+	/// CRC-32 and CRC-32C are computed using special CPU instructions
+	/// if available (see the CRC class).
 
 {
 public:
 	enum Type
 	{
 		TYPE_ADLER32 = 0,
-		TYPE_CRC32
+		TYPE_CRC32,
+		TYPE_CRC32C
 	};
 
 	Checksum();
@@ -69,6 +76,9 @@ public:
 	Type type() const;
 		/// Which type of checksum are we calulcating
 
+	void reset();
+		/// Resets the checksum to its initial value.
+
 private:
 	Type         _type;
 	Poco::UInt32 _value;
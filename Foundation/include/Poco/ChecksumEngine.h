@@ -0,0 +1,81 @@
+//
+// ChecksumEngine.h
+//
+// Library: Foundation
+// Package: Crypt
+// Module:  ChecksumEngine
+//
+// Definition of class ChecksumEngine.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ChecksumEngine_INCLUDED
+#define Foundation_ChecksumEngine_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/DigestEngine.h"
+#include "Poco/Checksum.h"
+
+
+namespace Poco {
+
+
+class Foundation_API ChecksumEngine: public DigestEngine
+	/// This class adapts Checksum to the DigestEngine interface,
+	/// so that CRC-32, CRC-32C and Adler-32 checksums can be used
+	/// wherever a DigestEngine is expected, e.g. with DigestOutputStream.
+	///
+	/// The digest consists of the four bytes of the checksum, in
+	/// big-endian byte order. Note that checksums are not suitable for
+	/// cryptographic purposes.
+{
+public:
+	enum
+	{
+		DIGEST_SIZE = 4
+	};
+
+	explicit ChecksumEngine(Checksum::Type type = Checksum::TYPE_CRC32C);
+		/// Creates the ChecksumEngine, using the given checksum type.
+
+	~ChecksumEngine() override;
+		/// Destroys the ChecksumEngine.
+
+	Checksum::Type type() const;
+		/// Returns the checksum type.
+
+	std::size_t digestLength() const override;
+	void reset() override;
+	const DigestEngine::Digest& digest() override;
+
+protected:
+	void updateImpl(const void* data, std::size_t length) override;
+
+private:
+	Checksum _checksum;
+	DigestEngine::Digest _digest;
+
+	ChecksumEngine(const ChecksumEngine&);
+	ChecksumEngine& operator = (const ChecksumEngine&);
+};
+
+
+//
+// inlines
+//
+inline Checksum::Type ChecksumEngine::type() const
+{
+	return _checksum.type();
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ChecksumEngine_INCLUDED
@@ -36,6 +36,18 @@ class Foundation_API DeflatingStreamBuf: public BufferedStreamBuf
 	/// Output streams should always call close() to ensure
 	/// proper completion of compression.
 	/// A compression level (0 to 9) can be specified in the constructor.
+	///
+	/// When deflating to an output stream, compression can optionally
+	/// be performed in parallel, similar to pigz (see http://zlib.net/pigz/).
+	/// The data is split into blocks, which are compressed concurrently
+	/// in the default WorkStealingThreadPool. Each block is compressed
+	/// as a raw deflate stream, primed with the last 32 KB of the previous
+	/// block as dictionary, and ends on a byte boundary (Z_SYNC_FLUSH).
+	/// The compressed blocks are written in order, enclosed in a zlib or
+	/// gzip header and trailer, with the checksums of the blocks combined.
+	/// The result is a single, standard-compliant zlib or gzip stream that
+	/// can be decompressed by any inflater. It is slightly larger (by a few
+	/// bytes per block) than the output of serial compression.
 {
 public:
 	enum StreamType
@@ -55,6 +67,12 @@ public:
 		BEST_COMPRESSION    =  9
 	};
 
+	enum
+	{
+		PARALLEL_BLOCK_SIZE = 131072
+			/// Default block size for parallel compression.
+	};
+
 	DeflatingStreamBuf(std::istream& istr, StreamType type, int level);
 		/// Creates a DeflatingStreamBuf for compressing data read
 		/// from the given input stream.
@@ -77,6 +95,22 @@ public:
 		/// Please refer to the zlib documentation of deflateInit2() for a description
 		/// of the windowBits parameter.
 
+	DeflatingStreamBuf(std::ostream& ostr, StreamType type, int level, int threads, std::size_t blockSize = PARALLEL_BLOCK_SIZE);
+		/// Creates a DeflatingStreamBuf for compressing data passed
+		/// through and forwarding it to the given output stream,
+		/// using parallel compression.
+		///
+		/// threads specifies the maximum number of blocks of blockSize
+		/// bytes being compressed concurrently. If zero, the number of
+		/// processors is used. If one, the data is compressed serially
+		/// on the calling thread, as with the other constructors.
+		/// The effective parallelism is also limited by the capacity
+		/// of WorkStealingThreadPool::defaultPool().
+		///
+		/// Parallel compression should not be used from a task running
+		/// in the default WorkStealingThreadPool, as waiting for the
+		/// compressed blocks blocks a worker thread.
+
 	~DeflatingStreamBuf() override;
 	/// Destroys the DeflatingStreamBuf.
 
@@ -85,6 +119,10 @@ public:
 		///
 		/// Must be called when deflating to an output stream.
 
+	int threads() const;
+		/// Returns the maximum number of blocks compressed concurrently,
+		/// or 1 if the data is compressed serially.
+
 protected:
 	std::streamsize readFromDevice(char* buffer, std::streamsize length) override;
 	std::streamsize writeToDevice(const char* buffer, std::streamsize length) override;
@@ -97,11 +135,14 @@ private:
 		DEFLATE_BUFFER_SIZE = 32768
 	};
 
+	class ParallelDeflater;
+
 	std::istream*	_pIstr;
 	std::ostream*	_pOstr;
 	char*			_buffer;
 	z_stream_s*		_pZstr;
 	bool			_eof;
+	ParallelDeflater* _pParallel;
 };
 
 
@@ -123,6 +164,14 @@ public:
 		/// Please refer to the zlib documentation of deflateInit2() for a description
 		/// of the windowBits parameter.
 
+	DeflatingIOS(std::ostream& ostr, DeflatingStreamBuf::StreamType type, int level, int threads, std::size_t blockSize = DeflatingStreamBuf::PARALLEL_BLOCK_SIZE);
+		/// Creates a DeflatingIOS for compressing data passed
+		/// through and forwarding it to the given output stream,
+		/// using parallel compression.
+		///
+		/// See DeflatingStreamBuf for a description of the
+		/// threads and blockSize parameters.
+
 	DeflatingIOS(std::istream& istr, DeflatingStreamBuf::StreamType type = DeflatingStreamBuf::STREAM_ZLIB, int level = DeflatingStreamBuf::DEFAULT_COMPRESSION);
 		/// Creates a DeflatingIOS for compressing data read
 		/// from the given input stream.
@@ -169,6 +218,14 @@ public:
 		/// Please refer to the zlib documentation of deflateInit2() for a description
 		/// of the windowBits parameter.
 
+	DeflatingOutputStream(std::ostream& ostr, DeflatingStreamBuf::StreamType type, int level, int threads, std::size_t blockSize = DeflatingStreamBuf::PARALLEL_BLOCK_SIZE);
+		/// Creates a DeflatingOutputStream for compressing data passed
+		/// through and forwarding it to the given output stream,
+		/// compressing blocks of blockSize bytes on up to the given
+		/// number of threads in parallel.
+		///
+		/// See DeflatingStreamBuf for more information.
+
 	~DeflatingOutputStream() override;
 	/// Destroys the DeflatingOutputStream.
 
@@ -126,6 +126,11 @@ class Foundation_API FileChannel: public Channel
 	///   * true:       Compress archived log files.
 	///   * false:      Do not compress archived log files.
 	///
+	/// Large archived log files can be compressed using multiple
+	/// threads in parallel. The number of threads is specified with the
+	/// "compressThreads" property. The default is 1 (no parallel
+	/// compression); 0 uses one thread per processor.
+	///
 	/// Archived log files can be automatically purged, either if
 	/// they reach a certain age, or if the number of archived
 	/// log files reaches a given maximum number. This is
@@ -194,6 +199,9 @@ public:
 		///   * compress:     Enable or disable compression of
 		///                   archived files. See the FileChannel class
 		///                   for details.
+		///   * compressThreads: Number of threads used for compressing
+		///                   archived files. See the FileChannel class
+		///                   for details.
 		///   * purgeAge:     Maximum age of an archived log file before
 		///                   it is purged. See the FileChannel class for
 		///                   details.
@@ -237,6 +245,7 @@ public:
 	static const std::string PROP_ARCHIVE;
 	static const std::string PROP_TIMES;
 	static const std::string PROP_COMPRESS;
+	static const std::string PROP_COMPRESSTHREADS;
 	static const std::string PROP_PURGEAGE;
 	static const std::string PROP_PURGECOUNT;
 	static const std::string PROP_FLUSH;
@@ -248,6 +257,7 @@ protected:
 	void setRotation(const std::string& rotation);
 	void setArchive(const std::string& archive);
 	void setCompress(const std::string& compress);
+	void setCompressThreads(const std::string& threads);
 	void setPurgeAge(const std::string& age);
 	void setPurgeCount(const std::string& count);
 	void setFlush(const std::string& flush);
@@ -267,6 +277,7 @@ private:
 	std::string      _rotation;
 	std::string      _archive;
 	bool             _compress;
+	int              _compressThreads;
 	std::string      _purgeAge;
 	std::string      _purgeCount;
 	bool             _flush;
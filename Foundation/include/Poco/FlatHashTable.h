@@ -0,0 +1,777 @@
+//
+// FlatHashTable.h
+//
+// Library: Foundation
+// Package: Hashing
+// Module:  FlatHashTable
+//
+// Definition of the FlatHashTable class template.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_FlatHashTable_INCLUDED
+#define Foundation_FlatHashTable_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Types.h"
+#include "Poco/Hash.h"
+#include "Poco/XXH3.h"
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define POCO_FLAT_HASH_SSE2 1
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+namespace Poco {
+
+
+namespace Impl {
+
+
+class FlatHashGroup
+	/// A group of control bytes of a FlatHashTable.
+	///
+	/// A control byte is either EMPTY, DELETED or, for a slot
+	/// holding an element, the 7 lower bits (H2) of the element's hash.
+	/// All bytes of a group are compared at once, using SSE2
+	/// if available. The result of a match is a bit mask, with
+	/// bit i set if byte i matches.
+{
+public:
+	enum
+	{
+		WIDTH = 16
+	};
+
+	static constexpr Int8 EMPTY = -128;
+	static constexpr Int8 DELETED = -2;
+
+	explicit FlatHashGroup(const Int8* pCtrl)
+	{
+#if defined(POCO_FLAT_HASH_SSE2)
+		_ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pCtrl));
+#else
+		std::memcpy(_ctrl, pCtrl, WIDTH);
+#endif
+	}
+
+	UInt32 match(Int8 h2) const
+		/// Returns the bit mask of all slots with the given H2.
+	{
+#if defined(POCO_FLAT_HASH_SSE2)
+		return static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), _ctrl)));
+#else
+		UInt32 mask = 0;
+		for (int i = 0; i < WIDTH; i++)
+		{
+			if (_ctrl[i] == h2) mask |= 1U << i;
+		}
+		return mask;
+#endif
+	}
+
+	UInt32 matchEmpty() const
+		/// Returns the bit mask of all empty slots.
+	{
+		return match(EMPTY);
+	}
+
+	UInt32 matchEmptyOrDeleted() const
+		/// Returns the bit mask of all slots not holding an element.
+		/// These are the slots with the sign bit set in their control byte.
+	{
+#if defined(POCO_FLAT_HASH_SSE2)
+		return static_cast<UInt32>(_mm_movemask_epi8(_ctrl));
+#else
+		UInt32 mask = 0;
+		for (int i = 0; i < WIDTH; i++)
+		{
+			if (_ctrl[i] < 0) mask |= 1U << i;
+		}
+		return mask;
+#endif
+	}
+
+	static int lowestBit(UInt32 mask)
+		/// Returns the index of the lowest bit set in mask,
+		/// which must not be 0.
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return static_cast<int>(index);
+#else
+		return __builtin_ctz(mask);
+#endif
+	}
+
+private:
+#if defined(POCO_FLAT_HASH_SSE2)
+	__m128i _ctrl;
+#else
+	Int8 _ctrl[WIDTH];
+#endif
+};
+
+
+template <class H, class = void>
+struct IsTransparentHash: std::false_type
+	/// Tells whether the hash function H accepts other
+	/// types than the key type (e.g., std::string_view for
+	/// std::string keys), indicated by a nested is_transparent type.
+{
+};
+
+
+template <class H>
+struct IsTransparentHash<H, std::void_t<typename H::is_transparent>>: std::true_type
+{
+};
+
+
+template <class T>
+struct DefaultHash
+	/// Selects the default hash function of HashMap and HashSet
+	/// for the key type T, which is Poco::Hash<T>.
+{
+	using Type = Hash<T>;
+};
+
+
+template <>
+struct DefaultHash<std::string>
+	/// Strings are hashed with XXH3Hash, which is considerably faster
+	/// than Poco::hash() for all but the shortest strings, and allows
+	/// heterogeneous lookups with std::string_view.
+{
+	using Type = XXH3Hash<std::string>;
+};
+
+
+} // namespace Impl
+
+
+template <class Value, class KeyOf, class HashFunc>
+class FlatHashTable
+	/// This class implements an open addressing hash table
+	/// in the style of Google's SwissTable (Abseil flat_hash_map).
+	///
+	/// Elements are stored directly in a single array of slots.
+	/// A separate array holds one control byte per slot, which
+	/// is either EMPTY, DELETED (a tombstone left behind by erase())
+	/// or holds the lower 7 bits (H2) of the hash of the element
+	/// in the slot. The remaining bits of the hash (H1) select
+	/// a group of 16 slots where probing starts. All 16 control
+	/// bytes of a group are compared against H2 with a single
+	/// SIMD instruction, so a lookup usually touches one group of
+	/// control bytes and a single slot, and most non-matching
+	/// slots are never looked at. Groups are probed quadratically
+	/// until a group with an empty slot is found.
+	///
+	/// The table is grown (doubling the capacity) when it is
+	/// filled to 7/8. Tombstones are removed when the table is
+	/// rehashed.
+	///
+	/// KeyOf is a class with a static key() member function that
+	/// returns the key of a value, e.g. the value itself for a set.
+	/// Keys are compared with operator ==. The result of HashFunc
+	/// is mixed before use, so simple hash functions (such as
+	/// Poco::hash() for integers) work fine.
+	///
+	/// Insertions may move elements and invalidate iterators as well
+	/// as pointers and references to elements. erase() only
+	/// invalidates iterators to the erased element.
+	///
+	/// This class is used by HashMap and HashSet, which should
+	/// normally be used instead.
+	///
+	/// This class is NOT thread safe.
+{
+public:
+	using ValueType = Value;
+	using Reference = Value&;
+	using ConstReference = const Value&;
+	using Pointer = Value*;
+	using ConstPointer = const Value*;
+	using Hash = HashFunc;
+
+	template <class V>
+	class BasicIterator
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = std::remove_const_t<V>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = V*;
+		using reference = V&;
+
+		BasicIterator():
+			_pCtrl(nullptr),
+			_pSlot(nullptr),
+			_pEnd(nullptr)
+		{
+		}
+
+		BasicIterator(const Int8* pCtrl, V* pSlot, const Int8* pEnd):
+			_pCtrl(pCtrl),
+			_pSlot(pSlot),
+			_pEnd(pEnd)
+		{
+		}
+
+		template <class U, class = std::enable_if_t<std::is_const_v<V> && !std::is_const_v<U>>>
+		BasicIterator(const BasicIterator<U>& it):
+			_pCtrl(it._pCtrl),
+			_pSlot(it._pSlot),
+			_pEnd(it._pEnd)
+		{
+		}
+
+		BasicIterator& operator ++ () // prefix
+		{
+			++_pCtrl;
+			++_pSlot;
+			skipFree();
+			return *this;
+		}
+
+		BasicIterator operator ++ (int) // postfix
+		{
+			BasicIterator tmp(*this);
+			++*this;
+			return tmp;
+		}
+
+		V& operator * () const
+		{
+			return *_pSlot;
+		}
+
+		V* operator -> () const
+		{
+			return _pSlot;
+		}
+
+		bool operator == (const BasicIterator& it) const
+		{
+			return _pCtrl == it._pCtrl;
+		}
+
+		bool operator != (const BasicIterator& it) const
+		{
+			return _pCtrl != it._pCtrl;
+		}
+
+	private:
+		void skipFree()
+		{
+			while (_pCtrl != _pEnd && *_pCtrl < 0)
+			{
+				++_pCtrl;
+				++_pSlot;
+			}
+		}
+
+		const Int8* _pCtrl;
+		V* _pSlot;
+		const Int8* _pEnd;
+
+		template <class> friend class BasicIterator;
+		friend class FlatHashTable;
+	};
+
+	using Iterator = BasicIterator<Value>;
+	using ConstIterator = BasicIterator<const Value>;
+
+	FlatHashTable():
+		_pCtrl(nullptr),
+		_pSlots(nullptr),
+		_capacity(0),
+		_size(0),
+		_growthLeft(0)
+		/// Creates an empty FlatHashTable. No memory is allocated
+		/// until the first element is inserted.
+	{
+	}
+
+	explicit FlatHashTable(std::size_t initialReserve):
+		FlatHashTable()
+		/// Creates the FlatHashTable with room for initialReserve elements.
+	{
+		reserve(initialReserve);
+	}
+
+	FlatHashTable(const FlatHashTable& table):
+		FlatHashTable()
+		/// Creates the FlatHashTable by copying another one.
+	{
+		if (table._size == 0) return;
+		allocate(table._capacity);
+		try
+		{
+			for (std::size_t i = 0; i < table._capacity; i++)
+			{
+				if (table._pCtrl[i] >= 0)
+				{
+					new (_pSlots + i) Value(table._pSlots[i]);
+					_pCtrl[i] = table._pCtrl[i];
+					_size++;
+				}
+				else if (table._pCtrl[i] == Group::DELETED)
+				{
+					// Tombstones must be kept, as probing for keys
+					// inserted after them stops at EMPTY slots only.
+					_pCtrl[i] = Group::DELETED;
+				}
+			}
+		}
+		catch (...)
+		{
+			destroy();
+			throw;
+		}
+		_growthLeft = table._growthLeft;
+	}
+
+	FlatHashTable(FlatHashTable&& table) noexcept:
+		_pCtrl(table._pCtrl),
+		_pSlots(table._pSlots),
+		_capacity(table._capacity),
+		_size(table._size),
+		_growthLeft(table._growthLeft),
+		_hash(std::move(table._hash))
+		/// Creates the FlatHashTable by moving another one.
+	{
+		table._pCtrl = nullptr;
+		table._pSlots = nullptr;
+		table._capacity = 0;
+		table._size = 0;
+		table._growthLeft = 0;
+	}
+
+	~FlatHashTable()
+		/// Destroys the FlatHashTable.
+	{
+		destroy();
+	}
+
+	FlatHashTable& operator = (const FlatHashTable& table)
+		/// Assigns another FlatHashTable.
+	{
+		FlatHashTable tmp(table);
+		swap(tmp);
+		return *this;
+	}
+
+	FlatHashTable& operator = (FlatHashTable&& table) noexcept
+		/// Assigns another FlatHashTable by moving it.
+	{
+		FlatHashTable tmp(std::move(table));
+		swap(tmp);
+		return *this;
+	}
+
+	void swap(FlatHashTable& table) noexcept
+		/// Swaps the FlatHashTable with another one.
+	{
+		using std::swap;
+		swap(_pCtrl, table._pCtrl);
+		swap(_pSlots, table._pSlots);
+		swap(_capacity, table._capacity);
+		swap(_size, table._size);
+		swap(_growthLeft, table._growthLeft);
+		swap(_hash, table._hash);
+	}
+
+	ConstIterator begin() const
+		/// Returns an iterator pointing to the first element, if one exists.
+	{
+		ConstIterator it(_pCtrl, _pSlots, _pCtrl + _capacity);
+		it.skipFree();
+		return it;
+	}
+
+	ConstIterator end() const
+		/// Returns an iterator pointing to the end of the table.
+	{
+		return ConstIterator(_pCtrl + _capacity, _pSlots + _capacity, _pCtrl + _capacity);
+	}
+
+	Iterator begin()
+		/// Returns an iterator pointing to the first element, if one exists.
+	{
+		Iterator it(_pCtrl, _pSlots, _pCtrl + _capacity);
+		it.skipFree();
+		return it;
+	}
+
+	Iterator end()
+		/// Returns an iterator pointing to the end of the table.
+	{
+		return Iterator(_pCtrl + _capacity, _pSlots + _capacity, _pCtrl + _capacity);
+	}
+
+	template <class K>
+	ConstIterator find(const K& key) const
+		/// Finds the element with the given key.
+		/// K is either the key type, or a type accepted by
+		/// the hash function that can be compared to keys.
+	{
+		return iteratorAt(findIndex(key));
+	}
+
+	template <class K>
+	Iterator find(const K& key)
+		/// Finds the element with the given key.
+		/// K is either the key type, or a type accepted by
+		/// the hash function that can be compared to keys.
+	{
+		return iteratorAt(findIndex(key));
+	}
+
+	template <class K>
+	std::size_t count(const K& key) const
+		/// Returns the number of elements with the given
+		/// key, which is either 1 or 0.
+	{
+		return findIndex(key) != _capacity ? 1 : 0;
+	}
+
+	std::pair<Iterator, bool> insert(const Value& value)
+		/// Inserts an element into the table.
+		///
+		/// If an element with the same key already exists in the table,
+		/// a pair(iterator, false) with iterator pointing to the
+		/// existing element is returned.
+		/// Otherwise, the element is inserted and a
+		/// pair(iterator, true) with iterator
+		/// pointing to the new element is returned.
+	{
+		return emplaceKey(KeyOf::key(value), value);
+	}
+
+	std::pair<Iterator, bool> insert(Value&& value)
+		/// Inserts an element into the table, by moving it.
+		/// See insert(const Value&).
+	{
+		return emplaceKey(KeyOf::key(value), std::move(value));
+	}
+
+	template <class K, class... Args>
+	std::pair<Iterator, bool> emplaceKey(const K& key, Args&&... args)
+		/// Inserts an element constructed from args into the table,
+		/// unless the table already contains an element with the given key.
+		/// The key must be equal to the key of the constructed element.
+		/// See insert() for the return value.
+	{
+		std::size_t h = hashOf(key);
+		std::size_t index = findIndex(key, h);
+		if (index != _capacity) return std::make_pair(iteratorAt(index), false);
+
+		if (_growthLeft == 0)
+		{
+			// key or args may refer to an element of this table,
+			// so construct the element before rehashing.
+			Value value(std::forward<Args>(args)...);
+			rehashForInsert();
+			index = findFreeIndex(h);
+			new (_pSlots + index) Value(std::move(value));
+		}
+		else
+		{
+			index = findFreeIndex(h);
+			new (_pSlots + index) Value(std::forward<Args>(args)...);
+		}
+		if (_pCtrl[index] == Impl::FlatHashGroup::EMPTY) _growthLeft--;
+		_pCtrl[index] = h2(h);
+		_size++;
+		return std::make_pair(iteratorAt(index), true);
+	}
+
+	void erase(Iterator it)
+		/// Erases the element pointed to by it.
+	{
+		if (it != end()) eraseAt(static_cast<std::size_t>(it._pCtrl - _pCtrl));
+	}
+
+	template <class K>
+	std::size_t erase(const K& key)
+		/// Erases the element with the given key, if it exists,
+		/// and returns the number of erased elements.
+	{
+		std::size_t index = findIndex(key);
+		if (index == _capacity) return 0;
+		eraseAt(index);
+		return 1;
+	}
+
+	void clear()
+		/// Erases all elements. The capacity of the table
+		/// remains unchanged.
+	{
+		destroyElements();
+		if (_capacity > 0) std::memset(_pCtrl, Impl::FlatHashGroup::EMPTY, _capacity);
+		_size = 0;
+		_growthLeft = maxLoad(_capacity);
+	}
+
+	void reserve(std::size_t size)
+		/// Makes sure that the table can hold the given number of
+		/// elements without being rehashed.
+	{
+		std::size_t capacity = capacityFor(size);
+		if (capacity > _capacity || _size + _growthLeft < size) resize(capacity);
+	}
+
+	std::size_t size() const
+		/// Returns the number of elements in the table.
+	{
+		return _size;
+	}
+
+	bool empty() const
+		/// Returns true iff the table is empty.
+	{
+		return _size == 0;
+	}
+
+	std::size_t capacity() const
+		/// Returns the number of slots in the table.
+	{
+		return _capacity;
+	}
+
+private:
+	using Group = Impl::FlatHashGroup;
+
+	enum
+	{
+		WIDTH = Group::WIDTH
+	};
+
+	template <class K>
+	std::size_t hashOf(const K& key) const
+	{
+		std::size_t h = _hash(key);
+		if constexpr (sizeof(std::size_t) == 8)
+		{
+			UInt64 x = h;
+			x ^= x >> 33;
+			x *= 0xFF51AFD7ED558CCDULL;
+			x ^= x >> 33;
+			return static_cast<std::size_t>(x);
+		}
+		else
+		{
+			UInt32 x = static_cast<UInt32>(h);
+			x ^= x >> 16;
+			x *= 0x85EBCA6BU;
+			x ^= x >> 13;
+			return x;
+		}
+	}
+
+	static Int8 h2(std::size_t h)
+	{
+		return static_cast<Int8>(h & 0x7F);
+	}
+
+	static std::size_t maxLoad(std::size_t capacity)
+	{
+		return capacity - capacity/8;
+	}
+
+	static std::size_t capacityFor(std::size_t size)
+	{
+		std::size_t capacity = WIDTH;
+		while (maxLoad(capacity) < size) capacity *= 2;
+		return capacity;
+	}
+
+	template <class K>
+	std::size_t findIndex(const K& key) const
+	{
+		if (_size == 0) return _capacity;
+		return findIndex(key, hashOf(key));
+	}
+
+	template <class K>
+	std::size_t findIndex(const K& key, std::size_t h) const
+		/// Returns the index of the slot holding the element
+		/// with the given key, or _capacity if not found.
+	{
+		if (_capacity == 0) return 0;
+		const std::size_t groupMask = _capacity/WIDTH - 1;
+		const Int8 tag = h2(h);
+		std::size_t group = (h >> 7) & groupMask;
+		for (std::size_t probe = 1; ; probe++)
+		{
+			Group g(_pCtrl + group*WIDTH);
+			for (UInt32 mask = g.match(tag); mask != 0; mask &= mask - 1)
+			{
+				std::size_t index = group*WIDTH + Group::lowestBit(mask);
+				if (KeyOf::key(_pSlots[index]) == key) return index;
+			}
+			if (g.matchEmpty() != 0) return _capacity;
+			group = (group + probe) & groupMask;
+		}
+	}
+
+	std::size_t findFreeIndex(std::size_t h) const
+		/// Returns the index of the first empty or deleted slot
+		/// in the probe sequence for the given hash.
+		/// The table must not be full.
+	{
+		const std::size_t groupMask = _capacity/WIDTH - 1;
+		std::size_t group = (h >> 7) & groupMask;
+		for (std::size_t probe = 1; ; probe++)
+		{
+			UInt32 mask = Group(_pCtrl + group*WIDTH).matchEmptyOrDeleted();
+			if (mask != 0) return group*WIDTH + Group::lowestBit(mask);
+			group = (group + probe) & groupMask;
+		}
+	}
+
+	void eraseAt(std::size_t index)
+	{
+		_pSlots[index].~Value();
+		_size--;
+		// If the group still has an empty slot, no probe sequence
+		// continues past this group, so the slot can be marked empty
+		// instead of leaving a tombstone.
+		const Int8* pGroup = _pCtrl + (index & ~static_cast<std::size_t>(WIDTH - 1));
+		if (Group(pGroup).matchEmpty() != 0)
+		{
+			_pCtrl[index] = Group::EMPTY;
+			_growthLeft++;
+		}
+		else
+		{
+			_pCtrl[index] = Group::DELETED;
+		}
+	}
+
+	void rehashForInsert()
+	{
+		if (_capacity == 0)
+			resize(WIDTH);
+		else if (_size <= maxLoad(_capacity)/2)
+			resize(_capacity); // many tombstones - just clean up
+		else
+			resize(_capacity*2);
+	}
+
+	void resize(std::size_t capacity)
+	{
+		Int8* pOldCtrl = _pCtrl;
+		Value* pOldSlots = _pSlots;
+		std::size_t oldCapacity = _capacity;
+
+		allocate(capacity);
+		for (std::size_t i = 0; i < oldCapacity; i++)
+		{
+			if (pOldCtrl[i] >= 0)
+			{
+				std::size_t h = hashOf(KeyOf::key(pOldSlots[i]));
+				std::size_t index = findFreeIndex(h);
+				new (_pSlots + index) Value(std::move(pOldSlots[i]));
+				_pCtrl[index] = h2(h);
+				pOldSlots[i].~Value();
+			}
+		}
+		_growthLeft = maxLoad(_capacity) - _size;
+		deallocate(pOldCtrl, pOldSlots, oldCapacity);
+	}
+
+	void allocate(std::size_t capacity)
+		/// Allocates control bytes and slots for the given capacity,
+		/// with all slots empty. Elements are not touched.
+	{
+		Value* pSlots = std::allocator<Value>().allocate(capacity);
+		Int8* pCtrl;
+		try
+		{
+			pCtrl = std::allocator<Int8>().allocate(capacity);
+		}
+		catch (...)
+		{
+			std::allocator<Value>().deallocate(pSlots, capacity);
+			throw;
+		}
+		std::memset(pCtrl, Group::EMPTY, capacity);
+		_pCtrl = pCtrl;
+		_pSlots = pSlots;
+		_capacity = capacity;
+		_growthLeft = maxLoad(capacity) - _size;
+	}
+
+	static void deallocate(Int8* pCtrl, Value* pSlots, std::size_t capacity)
+	{
+		if (capacity > 0)
+		{
+			std::allocator<Int8>().deallocate(pCtrl, capacity);
+			std::allocator<Value>().deallocate(pSlots, capacity);
+		}
+	}
+
+	void destroyElements()
+	{
+		if constexpr (!std::is_trivially_destructible_v<Value>)
+		{
+			for (std::size_t i = 0; i < _capacity; i++)
+			{
+				if (_pCtrl[i] >= 0) _pSlots[i].~Value();
+			}
+		}
+	}
+
+	void destroy()
+	{
+		destroyElements();
+		deallocate(_pCtrl, _pSlots, _capacity);
+		_pCtrl = nullptr;
+		_pSlots = nullptr;
+		_capacity = 0;
+		_size = 0;
+		_growthLeft = 0;
+	}
+
+	ConstIterator iteratorAt(std::size_t index) const
+	{
+		return ConstIterator(_pCtrl + index, _pSlots + index, _pCtrl + _capacity);
+	}
+
+	Iterator iteratorAt(std::size_t index)
+	{
+		return Iterator(_pCtrl + index, _pSlots + index, _pCtrl + _capacity);
+	}
+
+	Int8* _pCtrl;
+	Value* _pSlots;
+	std::size_t _capacity;
+	std::size_t _size;
+	std::size_t _growthLeft;
+	HashFunc _hash;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_FlatHashTable_INCLUDED
@@ -0,0 +1,407 @@
+//
+// Future.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  WorkStealingThreadPool
+//
+// Definition of the Future and Promise class templates.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_Future_INCLUDED
+#define Foundation_Future_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Exception.h"
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+
+namespace Poco {
+
+
+class WorkStealingThreadPool;
+
+
+template <class T> class Future;
+template <class T> class Promise;
+
+
+namespace Impl {
+
+
+class Foundation_API FutureStateBase
+	/// The shared state of a Future and its Promise,
+	/// independent of the result type.
+{
+public:
+	using Continuation = std::function<void()>;
+
+	explicit FutureStateBase(WorkStealingThreadPool* pPool);
+	virtual ~FutureStateBase();
+
+	bool isReady() const;
+	void wait() const;
+	bool tryWait(long milliseconds) const;
+	void setException(std::exception_ptr pException);
+	std::exception_ptr exception() const;
+	void rethrow() const;
+	void onReady(Continuation&& continuation);
+		/// Invokes the continuation in the completing thread as soon as
+		/// the state is ready, or immediately if it is ready already.
+	void dispatch(Continuation&& continuation);
+		/// Invokes the continuation in the thread pool associated
+		/// with the state, or directly if there is none.
+	WorkStealingThreadPool* pool() const;
+
+protected:
+	void ready(std::unique_lock<std::mutex>& lock);
+		/// Marks the state as ready, releases the lock
+		/// and invokes the continuations.
+
+	mutable std::mutex _mutex;
+	bool _isReady;
+
+private:
+	mutable std::condition_variable _readyCondition;
+	std::exception_ptr _pException;
+	std::vector<Continuation> _continuations;
+	WorkStealingThreadPool* _pPool;
+};
+
+
+template <class T>
+class FutureState: public FutureStateBase
+{
+public:
+	explicit FutureState(WorkStealingThreadPool* pPool):
+		FutureStateBase(pPool)
+	{
+	}
+
+	template <class V>
+	void set(V&& value)
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		if (_isReady) throw IllegalStateException("Promise already satisfied");
+		_value.emplace(std::forward<V>(value));
+		ready(lock);
+	}
+
+	const T& value() const
+	{
+		return *_value;
+	}
+
+private:
+	std::optional<T> _value;
+};
+
+
+template <>
+class FutureState<void>: public FutureStateBase
+{
+public:
+	explicit FutureState(WorkStealingThreadPool* pPool):
+		FutureStateBase(pPool)
+	{
+	}
+
+	void set()
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		if (_isReady) throw IllegalStateException("Promise already satisfied");
+		ready(lock);
+	}
+};
+
+
+template <class T, class F>
+struct ThenResult
+{
+	using Type = std::invoke_result_t<F, const T&>;
+};
+
+
+template <class F>
+struct ThenResult<void, F>
+{
+	using Type = std::invoke_result_t<F>;
+};
+
+
+template <class R, class F, class... Args>
+void invokeInto(FutureState<R>& state, F& fn, Args&&... args)
+	/// Invokes fn with the given arguments and stores its result,
+	/// or the exception it throws, in the given state.
+{
+	try
+	{
+		if constexpr (std::is_void_v<R>)
+		{
+			fn(std::forward<Args>(args)...);
+			state.set();
+		}
+		else
+		{
+			state.set(fn(std::forward<Args>(args)...));
+		}
+	}
+	catch (...)
+	{
+		state.setException(std::current_exception());
+	}
+}
+
+
+} // namespace Impl
+
+
+template <class T>
+class Future
+	/// A Future holds the result of an asynchronous computation,
+	/// usually a task submitted to a WorkStealingThreadPool with
+	/// WorkStealingThreadPool::submit(), or set by a Promise.
+	///
+	/// Unlike ActiveResult, a Future supports continuations:
+	/// then() returns a new Future for the result of a function
+	/// that is invoked with the result of this Future, as soon as
+	/// it is available. If the Future has been obtained from a
+	/// WorkStealingThreadPool, the continuation runs as a task in
+	/// the same pool; otherwise it runs in the thread that sets the
+	/// result. whenAll() combines several Futures into one.
+	///
+	/// Futures are cheap to copy; all copies share the same result.
+{
+public:
+	using ValueType = T;
+
+	Future() = default;
+		/// Creates an invalid Future.
+
+	bool valid() const
+		/// Returns true if the Future refers to a shared state.
+	{
+		return _pState != nullptr;
+	}
+
+	bool isReady() const
+		/// Returns true if the result or an exception is available.
+	{
+		return state().isReady();
+	}
+
+	void wait() const
+		/// Waits until the result or an exception is available.
+	{
+		state().wait();
+	}
+
+	bool tryWait(long milliseconds) const
+		/// Waits up to the given interval for the result or an exception
+		/// to become available. Returns true if it is available.
+	{
+		return state().tryWait(milliseconds);
+	}
+
+	bool failed() const
+		/// Returns true if the asynchronous computation has
+		/// failed with an exception. Does not wait.
+	{
+		return state().isReady() && state().exception() != nullptr;
+	}
+
+	decltype(auto) get() const
+		/// Waits for the result and returns it (as a const reference,
+		/// unless T is void). If the computation has failed, the
+		/// exception is rethrown.
+	{
+		state().wait();
+		state().rethrow();
+		if constexpr (!std::is_void_v<T>)
+		{
+			return static_cast<const T&>(_pState->value());
+		}
+	}
+
+	template <class F>
+	Future<typename Impl::ThenResult<T, std::decay_t<F>>::Type> then(F&& fn) const
+		/// Registers a continuation and returns a Future for its result.
+		///
+		/// The continuation is invoked with the result of this
+		/// Future (const T&), or without arguments if T is void.
+		/// If this Future fails, the continuation is not invoked
+		/// and the returned Future fails with the same exception.
+	{
+		using R = typename Impl::ThenResult<T, std::decay_t<F>>::Type;
+
+		std::shared_ptr<Impl::FutureState<T>> pPrev = _pState;
+		auto pNext = std::make_shared<Impl::FutureState<R>>(state().pool());
+		auto pFn = std::make_shared<std::decay_t<F>>(std::forward<F>(fn));
+		pPrev->onReady([pPrev, pNext, pFn]()
+			{
+				if (pPrev->exception())
+				{
+					pNext->setException(pPrev->exception());
+					return;
+				}
+				pPrev->dispatch([pPrev, pNext, pFn]()
+					{
+						if constexpr (std::is_void_v<T>)
+							Impl::invokeInto(*pNext, *pFn);
+						else
+							Impl::invokeInto(*pNext, *pFn, pPrev->value());
+					});
+			});
+		return Future<R>(pNext);
+	}
+
+private:
+	explicit Future(std::shared_ptr<Impl::FutureState<T>> pState):
+		_pState(std::move(pState))
+	{
+	}
+
+	Impl::FutureStateBase& state() const
+	{
+		if (!_pState) throw InvalidAccessException("Invalid Future");
+		return *_pState;
+	}
+
+	std::shared_ptr<Impl::FutureState<T>> _pState;
+
+	template <class U> friend class Future;
+	template <class U> friend class Promise;
+	template <class U> friend Future<std::vector<U>> whenAll(const std::vector<Future<U>>& futures);
+	friend Foundation_API Future<void> whenAll(const std::vector<Future<void>>& futures);
+};
+
+
+template <class T>
+class Promise
+	/// A Promise is used to set the result of a Future.
+	///
+	/// The result can be set exactly once, either with set()
+	/// or with setException().
+{
+public:
+	Promise():
+		_pState(std::make_shared<Impl::FutureState<T>>(nullptr))
+		/// Creates a Promise. Continuations registered with
+		/// then() run in the thread that sets the result.
+	{
+	}
+
+	explicit Promise(WorkStealingThreadPool& pool):
+		_pState(std::make_shared<Impl::FutureState<T>>(&pool))
+		/// Creates a Promise. Continuations registered with
+		/// then() run as tasks in the given pool.
+	{
+	}
+
+	Future<T> future() const
+		/// Returns the Future for this Promise.
+	{
+		return Future<T>(_pState);
+	}
+
+	template <class V, class U = T, class = std::enable_if_t<!std::is_void_v<U>>>
+	void set(V&& value) const
+		/// Sets the result. Throws an IllegalStateException
+		/// if the result has already been set.
+	{
+		_pState->set(std::forward<V>(value));
+	}
+
+	template <class U = T, class = std::enable_if_t<std::is_void_v<U>>>
+	void set() const
+		/// Marks the Future as ready. Throws an IllegalStateException
+		/// if the result has already been set.
+	{
+		_pState->set();
+	}
+
+	void setException(std::exception_ptr pException) const
+		/// Sets the exception to be thrown by Future::get().
+	{
+		_pState->setException(pException);
+	}
+
+	template <class F, class... Args>
+	void setFrom(F& fn, Args&&... args) const
+		/// Invokes fn with the given arguments and sets its
+		/// result, or the exception it throws.
+	{
+		Impl::invokeInto(*_pState, fn, std::forward<Args>(args)...);
+	}
+
+private:
+	std::shared_ptr<Impl::FutureState<T>> _pState;
+};
+
+
+template <class T>
+Future<std::vector<T>> whenAll(const std::vector<Future<T>>& futures)
+	/// Returns a Future that becomes ready when all given Futures
+	/// are ready. Its result is the vector of their results, in the
+	/// same order. If any of the Futures fails, the returned Future
+	/// fails with the exception of the first failed Future in the vector.
+{
+	WorkStealingThreadPool* pPool = futures.empty() ? nullptr : futures.front().state().pool();
+	auto pResult = std::make_shared<Impl::FutureState<std::vector<T>>>(pPool);
+	if (futures.empty())
+	{
+		pResult->set(std::vector<T>());
+		return Future<std::vector<T>>(pResult);
+	}
+
+	auto pFutures = std::make_shared<std::vector<Future<T>>>(futures);
+	auto pRemaining = std::make_shared<std::atomic<std::size_t>>(futures.size());
+	for (const auto& future: *pFutures)
+	{
+		future.state().onReady([pResult, pFutures, pRemaining]()
+			{
+				if (pRemaining->fetch_sub(1) != 1) return;
+
+				std::vector<T> values;
+				values.reserve(pFutures->size());
+				for (const auto& f: *pFutures)
+				{
+					if (f._pState->exception())
+					{
+						pResult->setException(f._pState->exception());
+						return;
+					}
+					values.push_back(f._pState->value());
+				}
+				pResult->set(std::move(values));
+			});
+	}
+	return Future<std::vector<T>>(pResult);
+}
+
+
+Foundation_API Future<void> whenAll(const std::vector<Future<void>>& futures);
+	/// Returns a Future that becomes ready when all given Futures
+	/// are ready. If any of the Futures fails, the returned Future
+	/// fails with the exception of the first failed Future in the vector.
+
+
+} // namespace Poco
+
+
+#endif // Foundation_Future_INCLUDED
@@ -19,7 +19,8 @@
 
 
 #include "Poco/Foundation.h"
-#include "Poco/LinearHashTable.h"
+#include "Poco/FlatHashTable.h"
+#include "Poco/Hash.h"
 #include "Poco/Exception.h"
 #include <utility>
 
@@ -52,6 +53,12 @@ struct HashMapEntry
 	{
 	}
 
+	HashMapEntry(Key&& key, Value&& value):
+		first(std::move(key)),
+		second(std::move(value))
+	{
+	}
+
 	bool operator == (const HashMapEntry& entry) const
 	{
 		return first == entry.first;
@@ -78,11 +85,36 @@ private:
 };
 
 
-template <class Key, class Mapped, class HashFunc = Hash<Key>>
+template <class HME>
+struct HashMapEntryKey
+	/// This class template is used internally by HashMap.
+{
+	static const auto& key(const HME& entry)
+	{
+		return entry.first;
+	}
+};
+
+
+template <class Key, class Mapped, class HashFunc = typename Impl::DefaultHash<Key>::Type>
 class HashMap
-	/// This class implements a map using a LinearHashTable.
+	/// This class implements a map using a FlatHashTable, an
+	/// open addressing hash table that stores all entries in a single
+	/// array and uses SIMD instructions to probe groups of slots.
 	///
 	/// A HashMap can be used just like a std::map.
+	///
+	/// The default hash function is Poco::Hash<Key>, except for
+	/// std::string keys, which are hashed with XXH3Hash<std::string>.
+	///
+	/// If HashFunc is transparent (has a nested is_transparent type,
+	/// like XXH3Hash<std::string>), find(), count(), contains() and
+	/// erase() also accept other key types, e.g. std::string_view or
+	/// const char* for a map with std::string keys. This avoids
+	/// creating a temporary std::string for a lookup.
+	///
+	/// Inserting an entry may invalidate iterators, pointers and
+	/// references to other entries.
 {
 public:
 	using KeyType = Key;
@@ -95,8 +127,8 @@ public:
 	using ValueType = HashMapEntry<Key, Mapped>;
 	using PairType = std::pair<KeyType, MappedType>;
 
-	using HashType = HashMapEntryHash<ValueType, HashFunc>;
-	using HashTable = LinearHashTable<ValueType, HashType>;
+	using HashType = HashFunc;
+	using HashTable = FlatHashTable<ValueType, HashMapEntryKey<ValueType>, HashFunc>;
 
 	using Iterator = typename HashTable::Iterator;
 	using ConstIterator = typename HashTable::ConstIterator;
@@ -145,26 +177,61 @@ public:
 
 	ConstIterator find(const KeyType& key) const
 	{
-		ValueType value(key);
-		return _table.find(value);
+		return _table.find(key);
 	}
 
 	Iterator find(const KeyType& key)
 	{
-		ValueType value(key);
-		return _table.find(value);
+		return _table.find(key);
+	}
+
+	template <class K, class H = HashFunc, class = std::enable_if_t<Impl::IsTransparentHash<H>::value>>
+	ConstIterator find(const K& key) const
+		/// Heterogeneous lookup, see class description.
+	{
+		return _table.find(key);
+	}
+
+	template <class K, class H = HashFunc, class = std::enable_if_t<Impl::IsTransparentHash<H>::value>>
+	Iterator find(const K& key)
+		/// Heterogeneous lookup, see class description.
+	{
+		return _table.find(key);
 	}
 
 	std::size_t count(const KeyType& key) const
 	{
-		ValueType value(key);
-		return _table.find(value) != _table.end() ? 1 : 0;
+		return _table.count(key);
+	}
+
+	template <class K, class H = HashFunc, class = std::enable_if_t<Impl::IsTransparentHash<H>::value>>
+	std::size_t count(const K& key) const
+		/// Heterogeneous lookup, see class description.
+	{
+		return _table.count(key);
+	}
+
+	bool contains(const KeyType& key) const
+		/// Returns true iff the map contains an entry with the given key.
+	{
+		return _table.count(key) != 0;
+	}
+
+	template <class K, class H = HashFunc, class = std::enable_if_t<Impl::IsTransparentHash<H>::value>>
+	bool contains(const K& key) const
+		/// Heterogeneous lookup, see class description.
+	{
+		return _table.count(key) != 0;
 	}
 
 	std::pair<Iterator, bool> insert(const PairType& pair)
 	{
-		ValueType value(pair.first, pair.second);
-		return _table.insert(value);
+		return _table.emplaceKey(pair.first, pair.first, pair.second);
+	}
+
+	std::pair<Iterator, bool> insert(PairType&& pair)
+	{
+		return _table.emplaceKey(pair.first, std::move(pair.first), std::move(pair.second));
 	}
 
 	std::pair<Iterator, bool> insert(const ValueType& value)
@@ -172,6 +239,11 @@ public:
 		return _table.insert(value);
 	}
 
+	std::pair<Iterator, bool> insert(ValueType&& value)
+	{
+		return _table.insert(std::move(value));
+	}
+
 	void erase(Iterator it)
 	{
 		_table.erase(it);
@@ -179,8 +251,14 @@ public:
 
 	void erase(const KeyType& key)
 	{
-		Iterator it = find(key);
-		_table.erase(it);
+		_table.erase(key);
+	}
+
+	template <class K, class H = HashFunc, class = std::enable_if_t<Impl::IsTransparentHash<H>::value>>
+	void erase(const K& key)
+		/// Heterogeneous lookup, see class description.
+	{
+		_table.erase(key);
 	}
 
 	void clear()
@@ -188,6 +266,13 @@ public:
 		_table.clear();
 	}
 
+	void reserve(std::size_t size)
+		/// Makes sure that the map can hold the given number
+		/// of entries without rehashing.
+	{
+		_table.reserve(size);
+	}
+
 	std::size_t size() const
 	{
 		return _table.size();
@@ -209,9 +294,7 @@ public:
 
 	Reference operator [] (const KeyType& key)
 	{
-		ValueType value(key);
-		std::pair<Iterator, bool> res = _table.insert(value);
-		return res.first->second;
+		return _table.emplaceKey(key, key).first->second;
 	}
 
 private:
@@ -19,17 +19,43 @@
 
 
 #include "Poco/Foundation.h"
-#include "Poco/LinearHashTable.h"
+#include "Poco/FlatHashTable.h"
+#include "Poco/Hash.h"
+#include <utility>
 
 
 namespace Poco {
 
 
-template <class Value, class HashFunc = Hash<Value>>
+template <class Value>
+struct HashSetKey
+	/// This class template is used internally by HashSet.
+{
+	static const Value& key(const Value& value)
+	{
+		return value;
+	}
+};
+
+
+template <class Value, class HashFunc = typename Impl::DefaultHash<Value>::Type>
 class HashSet
-	/// This class implements a set using a LinearHashTable.
+	/// This class implements a set using a FlatHashTable, an
+	/// open addressing hash table that stores all elements in a single
+	/// array and uses SIMD instructions to probe groups of slots.
 	///
 	/// A HashSet can be used just like a std::set.
+	///
+	/// The default hash function is Poco::Hash<Value>, except for
+	/// std::string elements, which are hashed with XXH3Hash<std::string>.
+	///
+	/// If HashFunc is transparent (has a nested is_transparent type,
+	/// like XXH3Hash<std::string>), find(), count(), contains() and
+	/// erase() also accept other types that can be compared with
+	/// the elements, e.g. std::string_view for a set of std::string.
+	///
+	/// Inserting an element may invalidate iterators, pointers and
+	/// references to other elements.
 {
 public:
 	using ValueType = Value;
@@ -39,7 +65,7 @@ public:
 	using ConstPointer = const Value *;
 	using Hash = HashFunc;
 
-	using HashTable = LinearHashTable<ValueType, Hash>;
+	using HashTable = FlatHashTable<ValueType, HashSetKey<ValueType>, Hash>;
 
 	using Iterator = typename HashTable::Iterator;
 	using ConstIterator = typename HashTable::ConstIterator;
@@ -112,6 +138,20 @@ public:
 		return _table.find(value);
 	}
 
+	template <class K, class H = HashFunc, class = std::enable_if_t<Impl::IsTransparentHash<H>::value>>
+	ConstIterator find(const K& value) const
+		/// Heterogeneous lookup, see class description.
+	{
+		return _table.find(value);
+	}
+
+	template <class K, class H = HashFunc, class = std::enable_if_t<Impl::IsTransparentHash<H>::value>>
+	Iterator find(const K& value)
+		/// Heterogeneous lookup, see class description.
+	{
+		return _table.find(value);
+	}
+
 	std::size_t count(const ValueType& value) const
 		/// Returns the number of elements with the given
 		/// value, with is either 1 or 0.
@@ -119,6 +159,26 @@ public:
 		return _table.count(value);
 	}
 
+	template <class K, class H = HashFunc, class = std::enable_if_t<Impl::IsTransparentHash<H>::value>>
+	std::size_t count(const K& value) const
+		/// Heterogeneous lookup, see class description.
+	{
+		return _table.count(value);
+	}
+
+	bool contains(const ValueType& value) const
+		/// Returns true iff the set contains the given value.
+	{
+		return _table.count(value) != 0;
+	}
+
+	template <class K, class H = HashFunc, class = std::enable_if_t<Impl::IsTransparentHash<H>::value>>
+	bool contains(const K& value) const
+		/// Heterogeneous lookup, see class description.
+	{
+		return _table.count(value) != 0;
+	}
+
 	std::pair<Iterator, bool> insert(const ValueType& value)
 		/// Inserts an element into the set.
 		///
@@ -132,6 +192,13 @@ public:
 		return _table.insert(value);
 	}
 
+	std::pair<Iterator, bool> insert(ValueType&& value)
+		/// Inserts an element into the set, by moving it.
+		/// See insert(const ValueType&).
+	{
+		return _table.insert(std::move(value));
+	}
+
 	void erase(Iterator it)
 		/// Erases the element pointed to by it.
 	{
@@ -144,12 +211,26 @@ public:
 		_table.erase(value);
 	}
 
+	template <class K, class H = HashFunc, class = std::enable_if_t<Impl::IsTransparentHash<H>::value>>
+	void erase(const K& value)
+		/// Heterogeneous lookup, see class description.
+	{
+		_table.erase(value);
+	}
+
 	void clear()
 		/// Erases all elements.
 	{
 		_table.clear();
 	}
 
+	void reserve(std::size_t size)
+		/// Makes sure that the set can hold the given number
+		/// of elements without rehashing.
+	{
+		_table.reserve(size);
+	}
+
 	std::size_t size() const
 		/// Returns the number of elements in the table.
 	{
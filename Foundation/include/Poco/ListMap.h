@@ -157,6 +157,15 @@ public:
 		return _container.insert(it, val);
 	}
 
+	Iterator insert(ValueType&& val)
+		/// Inserts the value into the map by moving it.
+		/// See insert(const ValueType&) for details.
+	{
+		Iterator it = find(val.first);
+		while (it != _container.end() && isEqual(it->first, val.first)) ++it;
+		return _container.insert(it, std::move(val));
+	}
+
 	void erase(Iterator it)
 	{
 		_container.erase(it);
@@ -199,6 +208,12 @@ public:
 		return _container.empty();
 	}
 
+	void reserve(std::size_t size)
+		/// Reserves room for the given number of entries.
+	{
+		_container.reserve(size);
+	}
+
 	ConstReference operator [] (const KeyType& key) const
 	{
 		ConstIterator it = find(key);
@@ -233,7 +248,7 @@ private:
 	bool isEqual(const std::string& s1, const std::string& s2) const
 	{
 		if (!CaseSensitive)
-			return Poco::icompare(s1, s2) == 0;
+			return s1.size() == s2.size() && Poco::icompare(s1, s2) == 0;
 		else
 			return s1 == s2;
 	}
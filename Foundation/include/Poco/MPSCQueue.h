@@ -63,11 +63,10 @@ class MPSCQueue
 	/// behavior, combine with a semaphore or condition variable.
 {
 public:
-#ifdef __cpp_lib_hardware_interference_size
-	static constexpr std::size_t CACHE_LINE_SIZE = std::hardware_destructive_interference_size;
-#else
 	static constexpr std::size_t CACHE_LINE_SIZE = 64;
-#endif
+		/// A fixed value is used instead of std::hardware_destructive_interference_size,
+		/// which GCC warns about (-Winterference-size) in headers, as it may differ
+		/// between compilation units and thus break the ABI.
 
 	explicit MPSCQueue(std::size_t capacity):
 		/// Creates the queue with the given capacity.
@@ -196,6 +195,40 @@ public:
 		return false;
 	}
 
+	template <typename F>
+	std::size_t consume(F&& func, std::size_t maxItems)
+		/// Removes up to maxItems items from the queue, calling
+		/// func(T&) for every item while it is still in its slot,
+		/// which saves moving the item out of the queue.
+		/// Returns the number of items removed.
+		///
+		/// If func throws, the item it was called for is removed
+		/// and the exception is propagated.
+		/// Must be called from exactly one thread (the consumer).
+	{
+		std::size_t tail = _tail.load(std::memory_order_relaxed);
+		std::size_t count = 0;
+		while (count < maxItems)
+		{
+			Slot& slot = _slots[index(tail)];
+			if (slot.sequence.load(std::memory_order_acquire) != tail + 1) break;
+
+			try
+			{
+				func(*slot.ptr());
+			}
+			catch (...)
+			{
+				release(slot, tail);
+				throw;
+			}
+			release(slot, tail);
+			++tail;
+			++count;
+		}
+		return count;
+	}
+
 	std::size_t size() const
 		/// Returns an approximate count of items in the queue.
 		/// This is approximate because producers may be modifying
@@ -250,6 +283,14 @@ private:
 		return pos & _mask;
 	}
 
+	void release(Slot& slot, std::size_t tail)
+		/// Destroys the item at tail and hands its slot back to the producers.
+	{
+		slot.ptr()->~T();
+		slot.sequence.store(tail + _capacity, std::memory_order_release);
+		_tail.store(tail + 1, std::memory_order_relaxed);
+	}
+
 	const std::size_t _capacity;
 	const std::size_t _mask;
 	Slot* const _slots;
@@ -21,6 +21,9 @@
 #include "Poco/Foundation.h"
 #include "Poco/Notification.h"
 #include "Poco/RWLock.h"
+#include "Poco/RCUPtr.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/AutoPtr.h"
 #include "Poco/SharedPtr.h"
 #include "Poco/Observer.h"
 #include "Poco/NObserver.h"
@@ -55,6 +58,12 @@ class Foundation_API NotificationCenter
 	/// In a multithreaded scenario, notifications are always delivered in the thread in which the
 	/// notification was posted, which may not be the same thread in which an observer registered itself.
 	///
+	/// Posting a notification does not take a lock. The list of observers is
+	/// an immutable snapshot, which is replaced (copy-on-write) when an observer
+	/// is added or removed (see RCUPtr). Therefore, posting notifications scales
+	/// well to many threads, while adding and removing observers is relatively
+	/// expensive.
+	///
 	/// The NotificationCenter class is basically a C++ implementation of the NSNotificationCenter class
 	/// found in Apple's Cocoa (or OpenStep).
 	///
@@ -197,17 +206,49 @@ protected:
 	using AbstractObserverPtr = SharedPtr<AbstractObserver>;
 	using ObserverList = std::vector<AbstractObserverPtr>;
 
+	class ObserverSnapshot: public RefCountedObject
+		/// An immutable list of the registered observers.
+	{
+	public:
+		ObserverSnapshot() = default;
+
+		explicit ObserverSnapshot(const ObserverList& list):
+			observers(list)
+		{
+		}
+
+		ObserverList observers;
+			/// Must not be modified after the snapshot has been published.
+	};
+
+	using ObserverSnapshotPtr = AutoPtr<ObserverSnapshot>;
+
 	RWLock& mutex()
+		/// Returns the mutex that serializes changes to the
+		/// list of observers.
 	{
 		return _mutex;
 	}
 
+	ObserverSnapshotPtr observerSnapshot() const;
+		/// Returns the current list of observers. Does not block.
+
 	ObserverList observersToNotify(const Notification::Ptr& pNotification) const;
+		/// Returns the observers accepting the given notification.
+
 	virtual void notifyObservers(Notification::Ptr& pNotification);
+		/// Delivers the notification to all observers accepting it.
+
+	virtual void observersChanged(const ObserverSnapshotPtr& pObservers);
+		/// Called after the list of observers has been changed,
+		/// with the mutex locked for writing.
+		///
+		/// The default implementation does nothing.
 
 private:
+	void publish(const ObserverList& observers);
 
-	ObserverList   _observers;
+	RCUPtr<ObserverSnapshot> _observers;
 	mutable RWLock _mutex;
 };
 } // namespace Poco
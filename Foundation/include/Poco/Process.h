@@ -76,11 +76,20 @@ private:
 	ProcessHandleImpl* _pImpl;
 
 	friend class Process;
+	friend class ProcessZygote;
 };
 
 
 class Foundation_API Process: public ProcessImpl
 	/// This class provides methods for working with processes.
+	///
+	/// On Linux (glibc 2.34 or newer), launch() creates the new
+	/// process with posix_spawn(), which does not copy the page
+	/// tables of the calling process, so the cost of launching
+	/// a process does not grow with the size of the caller.
+	/// If the command cannot be started this way, or the given
+	/// environment changes PATH, and on other Unix platforms,
+	/// fork() and exec() are used. See also ProcessZygote.
 {
 public:
 	using PID = PIDImpl;
@@ -33,6 +33,9 @@
 namespace Poco {
 
 
+class ProcessZygote;
+
+
 class Foundation_API ProcessRunner: public Poco::Runnable
 	/// ProcessRunner is a wrapper class for `Poco::ProcessHandle.
 	/// It starts and terminates a process with enabled or disabled (default)
@@ -57,7 +60,8 @@ public:
 		int options = NO_OUT,
 		int timeout = 10, /*seconds*/
 		bool startProcess = true,
-		const Args& pidArgFmt = pidArgFormat());
+		const Args& pidArgFmt = pidArgFormat(),
+		ProcessZygote* pZygote = nullptr);
 		/// Creates the ProcessRunner.
 		///
 		/// If `pidFile` is not empty, the starting of the process waits
@@ -80,6 +84,12 @@ public:
 		/// case a TimeoutException is thrown).
 		///
 		/// If `startProcess` is true, the process is started on object creation.
+		///
+		/// If `pZygote` is not null, the process is launched through the
+		/// given ProcessZygote, which must outlive the ProcessRunner.
+		/// This keeps the cost of (re)starting the process independent of
+		/// the size of the calling process on platforms where
+		/// Process::launch() has to fork() it.
 
 	~ProcessRunner() override;
 		/// Destroys the ProcessRunner.
@@ -171,6 +181,7 @@ private:
 	std::string _pidFile;
 	int _options;
 	int _timeout;
+	ProcessZygote* _pZygote;
 	std::atomic<Poco::ProcessHandle*> _pPH;
 	std::atomic<bool> _started;
 	std::atomic<int> _rc;
@@ -0,0 +1,122 @@
+//
+// ProcessZygote.h
+//
+// Library: Foundation
+// Package: Processes
+// Module:  ProcessZygote
+//
+// Definition of the ProcessZygote class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ProcessZygote_INCLUDED
+#define Foundation_ProcessZygote_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Process.h"
+#include "Poco/Mutex.h"
+
+
+namespace Poco {
+
+
+class Pipe;
+
+
+class Foundation_API ProcessZygote
+	/// A ProcessZygote is a small helper process that launches
+	/// processes on behalf of the process that created it.
+	///
+	/// The helper is forked when the ProcessZygote is created.
+	/// It should therefore be created early, e.g. at the start of
+	/// main(), while the address space of the application is still
+	/// small. Every launch() request is then forked from the helper,
+	/// so its cost does not depend on the memory the application
+	/// has allocated since, even in cases where Process::launch()
+	/// has to fall back to fork() and exec().
+	///
+	/// On Linux, the helper creates processes with clone(CLONE_PARENT),
+	/// so that they become children of the application, not of the helper.
+	/// The returned ProcessHandle can be used exactly like one returned
+	/// by Process::launch(). The environment variables and the current
+	/// working directory of the application are passed to the helper
+	/// with every request. Signal dispositions and the signal mask are
+	/// those of the thread that created the ProcessZygote.
+	///
+	/// On other platforms, launch() calls Process::launch().
+	///
+	/// A ProcessZygote can be used by multiple threads concurrently.
+	/// Requests are serialized.
+{
+public:
+	using Args = Process::Args;
+	using Env = Process::Env;
+	using PID = Process::PID;
+
+	ProcessZygote();
+		/// Creates the ProcessZygote and starts the helper process.
+		///
+		/// Throws a SystemException if the helper process
+		/// cannot be created.
+
+	~ProcessZygote();
+		/// Stops the helper process.
+		///
+		/// Processes launched through the ProcessZygote are not affected.
+
+	ProcessHandle launch(const std::string& command, const Args& args, int options = 0);
+		/// Creates a new process for the given command and returns
+		/// a ProcessHandle of the new process. See Process::launch().
+
+	ProcessHandle launch(
+		const std::string& command,
+		const Args& args,
+		const std::string& initialDirectory,
+		Pipe* inPipe,
+		Pipe* outPipe,
+		Pipe* errPipe,
+		const Env& env,
+		int options = 0);
+		/// Creates a new process for the given command and returns
+		/// a ProcessHandle of the new process. See Process::launch().
+		///
+		/// Throws a SystemException if the process cannot be created,
+		/// or if the helper process is no longer running.
+
+	PID id() const;
+		/// Returns the process ID of the helper process,
+		/// or 0 if no helper process is used.
+
+	static bool isSupported();
+		/// Returns true if processes are launched through a helper
+		/// process on this platform (Linux), false otherwise.
+
+private:
+	ProcessZygote(const ProcessZygote&) = delete;
+	ProcessZygote& operator = (const ProcessZygote&) = delete;
+
+	int _fd;
+	PID _pid;
+	FastMutex _mutex;
+};
+
+
+//
+// inlines
+//
+inline ProcessZygote::PID ProcessZygote::id() const
+{
+	return _pid;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ProcessZygote_INCLUDED
@@ -73,6 +73,22 @@ public:
 	static void requestTerminationImpl(PIDImpl pid);
 
 private:
+	static ProcessHandleImpl* launchBySpawnImpl(
+		const std::string& command,
+		const ArgsImpl& args,
+		const std::string& initialDirectory,
+		Pipe* inPipe,
+		Pipe* outPipe,
+		Pipe* errPipe,
+		const EnvImpl& env,
+		int options = 0);
+		/// Launches the process with posix_spawnp(), which does not copy
+		/// the address space of the calling process.
+		///
+		/// Returns nullptr if posix_spawnp() is not available, or
+		/// cannot provide the semantics of launchByForkExecImpl()
+		/// for the given arguments.
+
 	static ProcessHandleImpl* launchByForkExecImpl(
 		const std::string& command,
 		const ArgsImpl& args,
@@ -0,0 +1,142 @@
+//
+// RCUPtr.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  RCUPtr
+//
+// Definition of the RCUPtr class template.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_RCUPtr_INCLUDED
+#define Foundation_RCUPtr_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/AutoPtr.h"
+#include <atomic>
+#include <thread>
+
+
+namespace Poco {
+
+
+template <class C>
+class RCUPtr
+	/// RCUPtr holds a pointer to a reference counted object that
+	/// is read very often by many threads and replaced rarely,
+	/// using read-copy-update (RCU).
+	///
+	/// Readers obtain the current object with get(), which does not
+	/// take a lock and never blocks. Writers never modify the current
+	/// object. Instead, they create a modified copy and publish
+	/// it with assign() or exchange(). Readers that obtained the
+	/// previous object can continue to use it; it is released
+	/// when the last reader releases its AutoPtr.
+	///
+	/// To make sure that the previous object is not released while a
+	/// reader is about to duplicate it, readers register themselves
+	/// in one of two counters, selected by the current epoch, for the
+	/// few instructions between loading the pointer and duplicating
+	/// the object. A writer advances the epoch after publishing the new
+	/// object and waits until all readers registered in the previous
+	/// epoch are done before it releases the previous object.
+	///
+	/// The class C must be reference counted, like the classes
+	/// used with AutoPtr (e.g., a subclass of RefCountedObject),
+	/// and should be treated as immutable once it has been published.
+	///
+	/// get() may be called concurrently from any number of threads.
+	/// Calls to assign() and exchange() must be serialized by the
+	/// caller, e.g. with a mutex.
+{
+public:
+	using Ptr = AutoPtr<C>;
+
+	RCUPtr():
+		_ptr(nullptr)
+		/// Creates an RCUPtr holding a null pointer.
+	{
+	}
+
+	explicit RCUPtr(const Ptr& ptr):
+		_ptr(Ptr(ptr).duplicate())
+		/// Creates an RCUPtr holding the given object.
+	{
+	}
+
+	~RCUPtr()
+		/// Destroys the RCUPtr and releases the object.
+	{
+		C* ptr = _ptr.load(std::memory_order_relaxed);
+		if (ptr) ptr->release();
+	}
+
+	RCUPtr(const RCUPtr&) = delete;
+	RCUPtr& operator = (const RCUPtr&) = delete;
+
+	Ptr get() const
+		/// Returns the current object. Does not block.
+	{
+		for (;;)
+		{
+			unsigned epoch = _epoch.load();
+			std::atomic<int>& readers = _readers[epoch & 1].count;
+			readers.fetch_add(1);
+			if (_epoch.load() == epoch)
+			{
+				Ptr ptr(_ptr.load(), true);
+				readers.fetch_sub(1);
+				return ptr;
+			}
+			// A writer advanced the epoch in the meantime, so it may not
+			// wait for us. Retry with the current epoch.
+			readers.fetch_sub(1);
+		}
+	}
+
+	Ptr exchange(const Ptr& ptr)
+		/// Publishes the given object and returns the previous one.
+		///
+		/// Waits until all readers that may have loaded the pointer
+		/// to the previous object have duplicated it, which usually
+		/// takes only a few nanoseconds.
+	{
+		C* pOld = _ptr.exchange(Ptr(ptr).duplicate());
+		unsigned epoch = _epoch.fetch_add(1);
+		while (_readers[epoch & 1].count.load() != 0)
+		{
+			std::this_thread::yield();
+		}
+		return Ptr(pOld);
+	}
+
+	void assign(const Ptr& ptr)
+		/// Publishes the given object and releases the previous one.
+		/// See exchange().
+	{
+		exchange(ptr);
+	}
+
+private:
+	struct alignas(64) ReaderCount
+	{
+		std::atomic<int> count{0};
+	};
+
+	std::atomic<C*> _ptr;
+	std::atomic<unsigned> _epoch{0};
+	mutable ReaderCount _readers[2];
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_RCUPtr_INCLUDED
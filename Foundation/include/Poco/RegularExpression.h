@@ -24,6 +24,7 @@
 #include "Poco/Foundation.h"
 #include <vector>
 #include <map>
+#include <string_view>
 
 
 namespace Poco {
@@ -70,6 +71,7 @@ public:
 		RE_NEWLINE_CRLF    = 0x00300000, /// assume newline is CRLF ("\r\n") [ctor]
 		RE_NEWLINE_ANY     = 0x00400000, /// assume newline is any valid Unicode newline character [ctor]
 		RE_NEWLINE_ANYCRLF = 0x00500000, /// assume newline is any of CR, LF, CRLF [ctor]
+		RE_JIT             = 0x01000000, /// compile pattern to machine code, if supported by PCRE2 [ctor]
 		RE_GLOBAL          = 0x10000000, /// replace all occurences (/g) [subst]
 		RE_NO_VARS         = 0x20000000  /// treat dollar in replacement string as ordinary character [subst]
 	};
@@ -109,6 +111,16 @@ public:
 		/// Throws a RegularExpressionException in case of an error.
 		/// Returns the number of matches.
 
+	int match(std::string_view subject, std::string::size_type offset, Match& mtch, int options = 0) const;
+		/// Matches the given subject, starting at offset, against the pattern.
+		/// Same as match(const std::string&, std::string::size_type, Match&, int),
+		/// but does not require the subject to be a std::string. To match a range
+		/// of characters, pass std::string_view(begin, length).
+
+	int match(const char* subject, std::string::size_type offset, Match& mtch, int options = 0) const;
+		/// Matches the given zero-terminated subject, starting at offset, against the pattern.
+		/// Same as match(const std::string&, std::string::size_type, Match&, int).
+
 	int match(const std::string& subject, std::string::size_type offset, MatchVec& matches, int options = 0) const;
 		/// Matches the given subject string against the pattern.
 		/// The first entry in matches contains the position of the captured substring.
@@ -118,6 +130,15 @@ public:
 		/// Throws a RegularExpressionException in case of an error.
 		/// Returns the number of matches.
 
+	int match(std::string_view subject, std::string::size_type offset, MatchVec& matches, int options = 0) const;
+		/// Matches the given subject, starting at offset, against the pattern.
+		/// Same as match(const std::string&, std::string::size_type, MatchVec&, int),
+		/// but does not require the subject to be a std::string.
+
+	int match(const char* subject, std::string::size_type offset, MatchVec& matches, int options = 0) const;
+		/// Matches the given zero-terminated subject, starting at offset, against the pattern.
+		/// Same as match(const std::string&, std::string::size_type, MatchVec&, int).
+
 	bool match(const std::string& subject, std::string::size_type offset = 0) const;
 		/// Returns true if and only if the subject matches the regular expression.
 		///
@@ -128,6 +149,13 @@ public:
 	bool match(const std::string& subject, std::string::size_type offset, int options) const;
 		/// Returns true if and only if the subject matches the regular expression.
 
+	bool match(std::string_view subject, std::string::size_type offset, int options) const;
+		/// Returns true if and only if the subject matches the regular expression.
+
+	bool match(const char* subject, std::string::size_type offset, int options) const;
+		/// Returns true if and only if the given zero-terminated subject
+		/// matches the regular expression.
+
 	bool operator == (const std::string& subject) const;
 		/// Returns true if and only if the subject matches the regular expression.
 		///
@@ -194,6 +222,16 @@ public:
 		/// Matches the given subject string against the regular expression given in pattern,
 		/// using the given options.
 
+	bool isJIT() const;
+		/// Returns true if the pattern has been compiled to machine
+		/// code (see RE_JIT).
+		///
+		/// JIT compilation requires a PCRE2 library built with JIT support.
+		/// The PCRE2 library bundled with POCO is built without JIT support,
+		/// so RE_JIT only has an effect if POCO is built against an external
+		/// PCRE2 library (POCO_UNBUNDLED). If JIT compilation is not
+		/// available, the interpreter is used.
+
 protected:
 	std::string::size_type substOne(std::string& subject, std::string::size_type offset, const std::string& replacement, int options) const;
 	static int compileOptions(int options);
@@ -205,6 +243,8 @@ private:
 	void* _pcre;  // Actual type is pcre2_code_8*
 
 	GroupMap _groups;
+	UInt32 _ovecPairs;
+	bool _jit;
 
 	RegularExpression();
 	RegularExpression(const RegularExpression&);
@@ -221,6 +261,48 @@ inline int RegularExpression::match(const std::string& subject, Match& mtch, int
 }
 
 
+inline int RegularExpression::match(const std::string& subject, std::string::size_type offset, Match& mtch, int options) const
+{
+	return match(std::string_view(subject), offset, mtch, options);
+}
+
+
+inline int RegularExpression::match(const char* subject, std::string::size_type offset, Match& mtch, int options) const
+{
+	return match(std::string_view(subject), offset, mtch, options);
+}
+
+
+inline int RegularExpression::match(const std::string& subject, std::string::size_type offset, MatchVec& matches, int options) const
+{
+	return match(std::string_view(subject), offset, matches, options);
+}
+
+
+inline int RegularExpression::match(const char* subject, std::string::size_type offset, MatchVec& matches, int options) const
+{
+	return match(std::string_view(subject), offset, matches, options);
+}
+
+
+inline bool RegularExpression::match(const std::string& subject, std::string::size_type offset, int options) const
+{
+	return match(std::string_view(subject), offset, options);
+}
+
+
+inline bool RegularExpression::match(const char* subject, std::string::size_type offset, int options) const
+{
+	return match(std::string_view(subject), offset, options);
+}
+
+
+inline bool RegularExpression::isJIT() const
+{
+	return _jit;
+}
+
+
 inline int RegularExpression::split(const std::string& subject, std::vector<std::string>& strings, int options) const
 {
 	return split(subject, 0, strings, options);
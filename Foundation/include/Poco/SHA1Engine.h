@@ -34,6 +34,17 @@ namespace Poco {
 class Foundation_API SHA1Engine: public DigestEngine
 	/// This class implements the SHA-1 message digest algorithm.
 	/// (FIPS 180-1, see http://www.itl.nist.gov/fipspubs/fip180-1.htm)
+	///
+	/// The implementation is selected at runtime, based on the
+	/// features of the CPU:
+	///   - On x86/x64 CPUs supporting the SHA extensions (SHA-NI),
+	///     the SHA1RNDS4 and related instructions are used.
+	///   - On ARMv8 CPUs with the cryptography extensions, the
+	///     SHA1C/SHA1P/SHA1M instructions are used (if enabled at
+	///     compile time, e.g. with -march=armv8-a+crypto).
+	/// Otherwise, a portable implementation is used.
+	///
+	/// For testing, the implementation can be selected with setKernel().
 {
 public:
 	enum
@@ -42,6 +53,14 @@ public:
 		DIGEST_SIZE = 20
 	};
 
+	enum Kernel
+	{
+		KERNEL_AUTO,
+			/// Use the fastest implementation supported by the CPU (default).
+		KERNEL_GENERIC
+			/// Use the portable implementation only.
+	};
+
 	SHA1Engine();
 	~SHA1Engine() override;
 
@@ -49,12 +68,24 @@ public:
 	void reset() override;
 	const DigestEngine::Digest& digest() override;
 
+	static bool isAccelerated();
+		/// Returns true if SHA-1 is computed using
+		/// special CPU instructions.
+
+	static void setKernel(Kernel kernel);
+		/// Selects the implementation used by all SHA1Engine instances.
+		///
+		/// This is intended for testing, so that every implementation
+		/// supported by the CPU can be verified. All implementations
+		/// compute the same results, so the kernel can be changed at any time.
+
+	static Kernel getKernel();
+		/// Returns the implementation selected with setKernel().
+
 protected:
 	void updateImpl(const void *data, std::size_t length) override;
 
 private:
-	void transform();
-	static void byteReverse(UInt32* buffer, int byteCount);
 
 	using BYTE = UInt8;
 
@@ -63,7 +94,7 @@ private:
 		UInt32 digest[5]; // Message digest
 		UInt32 countLo;   // 64-bit bit count
 		UInt32 countHi;
-		UInt32 data[16];  // SHA data buffer
+		UInt32 data[16];  // SHA data buffer (partial block)
 		UInt32 slop;      // # of bytes saved in data[]
 	};
 
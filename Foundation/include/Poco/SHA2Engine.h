@@ -26,6 +26,8 @@
 
 #include "Poco/Foundation.h"
 #include "Poco/DigestEngine.h"
+#include <string_view>
+#include <vector>
 
 
 namespace Poco {
@@ -34,6 +36,22 @@ namespace Poco {
 class Foundation_API SHA2Engine: public DigestEngine
 	/// This class implements the SHA-2 message digest algorithm.
 	/// (FIPS 180-4, see http://nvlpubs.nist.gov/nistpubs/FIPS/NIST.FIPS.180-4.pdf)
+	///
+	/// For SHA-224 and SHA-256, the implementation is selected
+	/// at runtime, based on the features of the CPU:
+	///   - On x86/x64 CPUs supporting the SHA extensions (SHA-NI),
+	///     the SHA256RNDS2 and related instructions are used.
+	///   - On ARMv8 CPUs with the cryptography extensions, the
+	///     SHA256H/SHA256H2 instructions are used (if enabled at
+	///     compile time, e.g. with -march=armv8-a+crypto).
+	/// Otherwise, and for the SHA-512 based algorithms, a portable
+	/// implementation is used.
+	///
+	/// Many independent messages can be hashed with digestAll(),
+	/// which, on x86/x64 CPUs supporting AVX2 but not the SHA
+	/// extensions, computes eight SHA-224 or SHA-256 digests in parallel.
+	///
+	/// For testing, the implementation can be selected with setKernel().
 {
 public:
 	enum ALGORITHM
@@ -46,6 +64,18 @@ public:
 		SHA_512_256
 	};
 
+	enum Kernel
+	{
+		KERNEL_AUTO,
+			/// Use the fastest implementation supported by the CPU (default).
+		KERNEL_GENERIC,
+			/// Use the portable implementation only, also in digestAll().
+		KERNEL_MULTI_BUFFER
+			/// Like KERNEL_AUTO, but digestAll() uses the AVX2 multi-buffer
+			/// implementation whenever the CPU supports AVX2, even if
+			/// it also supports the SHA extensions.
+	};
+
 	SHA2Engine(ALGORITHM algorithm = SHA_256);
 	~SHA2Engine() override;
 
@@ -53,6 +83,37 @@ public:
 	void reset() override;
 	const DigestEngine::Digest& digest() override;
 
+	static std::vector<DigestEngine::Digest> digestAll(const std::vector<std::string_view>& messages, ALGORITHM algorithm = SHA_256);
+		/// Computes the digests of the given messages, using the given
+		/// algorithm, and returns them in the same order.
+		///
+		/// For SHA-224 and SHA-256, if the CPU supports AVX2 but not the
+		/// SHA extensions, the messages are hashed in parallel, eight at
+		/// a time (see isMultiBufferAccelerated()).
+		/// This is considerably faster than hashing the messages one by one
+		/// with the portable implementation, especially for many small
+		/// messages of similar size.
+
+	static bool isAccelerated();
+		/// Returns true if SHA-224 and SHA-256 are computed
+		/// using special CPU instructions.
+
+	static bool isMultiBufferAccelerated();
+		/// Returns true if digestAll() computes SHA-224 and
+		/// SHA-256 digests of multiple messages in parallel.
+
+	static void setKernel(Kernel kernel);
+		/// Selects the implementation used for SHA-224 and SHA-256
+		/// by all SHA2Engine instances and by digestAll().
+		/// Implementations not supported by the CPU are never used.
+		///
+		/// This is intended for testing, so that every implementation
+		/// supported by the CPU can be verified. All implementations
+		/// compute the same results, so the kernel can be changed at any time.
+
+	static Kernel getKernel();
+		/// Returns the implementation selected with setKernel().
+
 protected:
 	void updateImpl(const void *data, std::size_t length) override;
 
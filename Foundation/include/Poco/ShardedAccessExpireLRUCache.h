@@ -0,0 +1,64 @@
+//
+// ShardedAccessExpireLRUCache.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  ShardedAccessExpireLRUCache
+//
+// Definition of the ShardedAccessExpireLRUCache class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ShardedAccessExpireLRUCache_INCLUDED
+#define Foundation_ShardedAccessExpireLRUCache_INCLUDED
+
+
+#include "Poco/ShardedCache.h"
+#include "Poco/Exception.h"
+
+
+namespace Poco {
+
+
+template <
+	class TKey,
+	class TValue,
+	class THash = std::hash<TKey>,
+	class TMutex = FastMutex
+>
+class ShardedAccessExpireLRUCache: public ShardedCache<TKey, TValue, THash, TMutex>
+	/// A ShardedAccessExpireLRUCache combines approximate LRU caching and time
+	/// based expire caching, using independent shards and the CLOCK replacement
+	/// algorithm (see ShardedCache). It can be used instead of AccessExpireLRUCache
+	/// if lock contention is an issue and events are not needed.
+	///
+	/// Entries are cached for a fixed time period (per default 10 minutes)
+	/// after they have last been accessed, and the size of the cache is
+	/// limited (per default: 1024).
+{
+public:
+	ShardedAccessExpireLRUCache(std::size_t cacheSize = 1024, Timestamp::TimeDiff expire = 600000, std::size_t shards = 0):
+		ShardedCache<TKey, TValue, THash, TMutex>(cacheSize, shards, expire, true)
+		/// Creates the ShardedAccessExpireLRUCache. The expire time is given in
+		/// milliseconds and must be at least 25 ms. If shards is 0,
+		/// the number of shards is chosen automatically.
+	{
+		if (expire < 25) throw InvalidArgumentException("expireTime must be at least 25 ms");
+	}
+
+	~ShardedAccessExpireLRUCache() = default;
+
+	ShardedAccessExpireLRUCache(const ShardedAccessExpireLRUCache& aCache) = delete;
+	ShardedAccessExpireLRUCache& operator=(const ShardedAccessExpireLRUCache& aCache) = delete;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ShardedAccessExpireLRUCache_INCLUDED
@@ -0,0 +1,441 @@
+//
+// ShardedCache.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  ShardedCache
+//
+// Definition of the ShardedCache class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ShardedCache_INCLUDED
+#define Foundation_ShardedCache_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Mutex.h"
+#include "Poco/Exception.h"
+#include "Poco/SharedPtr.h"
+#include "Poco/Timestamp.h"
+#include "Poco/Environment.h"
+#include <unordered_map>
+#include <vector>
+#include <set>
+#include <memory>
+#include <functional>
+#include <cstddef>
+
+
+namespace Poco {
+
+
+template <
+	class TKey,
+	class TValue,
+	class THash = std::hash<TKey>,
+	class TMutex = FastMutex
+>
+class ShardedCache
+	/// A ShardedCache is a size-limited, optionally time-limited cache
+	/// intended for heavily concurrent read access.
+	///
+	/// In contrast to AbstractCache, which protects all entries with a
+	/// single mutex and notifies its strategies through events on every
+	/// operation, a ShardedCache splits its entries into a number of
+	/// independent shards, selected by the hash of the key. Each shard has
+	/// its own mutex, hash table and a fixed number of entry slots, so
+	/// threads accessing different keys rarely contend for the same lock,
+	/// and a cache hit costs one hash lookup under a shard lock.
+	///
+	/// Replacement uses the CLOCK algorithm, an approximation of LRU:
+	/// a get() only sets a reference bit on the entry. When a new entry
+	/// must be stored in a full shard, a clock hand sweeps over the shard's
+	/// slots, clearing reference bits, and replaces the first entry that
+	/// has not been referenced since the hand last passed it. Expired
+	/// entries are replaced first.
+	///
+	/// The size limit is enforced per shard (each shard holds size / shards
+	/// entries, rounded up), so the cache as a whole may start replacing
+	/// entries before it holds exactly size entries if keys are not evenly
+	/// distributed.
+	///
+	/// If an expiration time is given, entries expire after that time.
+	/// If accessExpire is true, each get() restarts the expiration period
+	/// of the entry (see AccessExpireLRUCache), otherwise entries expire
+	/// after the given time since they were added (see ExpireLRUCache).
+	///
+	/// ShardedCache has the same key/value interface as AbstractCache,
+	/// but does not provide events.
+{
+public:
+	using ValuePtr = SharedPtr<TValue>;
+	using KeySet = std::set<TKey>;
+
+	ShardedCache(std::size_t size, std::size_t shards = 0, Timestamp::TimeDiff expire = 0, bool accessExpire = false):
+		_expire(expire*1000),
+		_accessExpire(accessExpire)
+		/// Creates the ShardedCache for (at least) size entries, using the
+		/// given number of shards, rounded up to a power of two. If shards
+		/// is 0, four shards per processor are used. The number of shards is
+		/// reduced if size is too small to give every shard a few entries.
+		///
+		/// If expire (given in milliseconds) is greater than 0, entries expire
+		/// after that time.
+	{
+		if (size < 1) throw InvalidArgumentException("size must be > 0");
+
+		if (shards == 0) shards = 4*Environment::processorCount();
+		std::size_t maxShards = size/MIN_SHARD_CAPACITY > 0 ? size/MIN_SHARD_CAPACITY : 1;
+		if (shards > maxShards) shards = maxShards;
+		std::size_t n = 1;
+		while (n < shards) n <<= 1;
+		if (n > maxShards && n > 1) n >>= 1;
+
+		_mask = n - 1;
+		_shards.reset(new Shard[n]);
+		std::size_t capacity = (size + n - 1)/n;
+		for (std::size_t i = 0; i < n; i++)
+		{
+			_shards[i].init(capacity);
+		}
+	}
+
+	~ShardedCache() = default;
+
+	ShardedCache(const ShardedCache& aCache) = delete;
+	ShardedCache& operator = (const ShardedCache& aCache) = delete;
+
+	void add(const TKey& key, const TValue& val)
+		/// Adds the key value pair to the cache.
+		/// If for the key already an entry exists, it will be overwritten.
+	{
+		add(key, ValuePtr(new TValue(val)));
+	}
+
+	void add(const TKey& key, ValuePtr val)
+		/// Adds the key value pair to the cache. Note that adding a nullptr SharedPtr will fail!
+		/// If for the key already an entry exists, it will be overwritten.
+	{
+		poco_check_ptr (val.get());
+
+		Shard& shard = shardFor(key);
+		Timestamp::TimeVal now = currentTime();
+		ValuePtr old;
+		{
+			typename TMutex::ScopedLock lock(shard.mutex);
+			old = shard.insert(key, val, now, _expire);
+		}
+	}
+
+	void update(const TKey& key, const TValue& val)
+		/// Same as add(). Provided for compatibility with AbstractCache.
+	{
+		add(key, val);
+	}
+
+	void update(const TKey& key, ValuePtr val)
+		/// Same as add(). Provided for compatibility with AbstractCache.
+	{
+		add(key, val);
+	}
+
+	void remove(const TKey& key)
+		/// Removes an entry from the cache. If the entry is not found,
+		/// the remove is ignored.
+	{
+		Shard& shard = shardFor(key);
+		ValuePtr old;
+		{
+			typename TMutex::ScopedLock lock(shard.mutex);
+			auto it = shard.index.find(key);
+			if (it != shard.index.end()) old = shard.evict(it->second);
+		}
+	}
+
+	bool has(const TKey& key) const
+		/// Returns true if the cache contains a valid value for the key.
+	{
+		const Shard& shard = shardFor(key);
+		Timestamp::TimeVal now = currentTime();
+
+		typename TMutex::ScopedLock lock(shard.mutex);
+		auto it = shard.index.find(key);
+		return it != shard.index.end() && !shard.isExpired(it->second, now);
+	}
+
+	ValuePtr get(const TKey& key)
+		/// Returns a SharedPtr of the value. The SharedPointer will remain valid
+		/// even when cache replacement removes the element.
+		/// If for the key no value exists, an empty SharedPtr is returned.
+	{
+		Shard& shard = shardFor(key);
+		Timestamp::TimeVal now = currentTime();
+		ValuePtr result;
+		ValuePtr expired;
+		{
+			typename TMutex::ScopedLock lock(shard.mutex);
+			auto it = shard.index.find(key);
+			if (it != shard.index.end())
+			{
+				Slot& slot = shard.slots[it->second];
+				if (shard.isExpired(it->second, now))
+				{
+					expired = shard.evict(it->second);
+				}
+				else
+				{
+					slot.referenced = true;
+					if (_accessExpire) slot.expires = now + _expire;
+					result = slot.value;
+				}
+			}
+		}
+		return result;
+	}
+
+	void clear()
+		/// Removes all elements from the cache.
+	{
+		for (std::size_t i = 0; i <= _mask; i++)
+		{
+			Shard& shard = _shards[i];
+			typename TMutex::ScopedLock lock(shard.mutex);
+			shard.clear();
+		}
+	}
+
+	std::size_t size()
+		/// Returns the number of cached elements.
+	{
+		forceReplace();
+		std::size_t n = 0;
+		for (std::size_t i = 0; i <= _mask; i++)
+		{
+			Shard& shard = _shards[i];
+			typename TMutex::ScopedLock lock(shard.mutex);
+			n += shard.index.size();
+		}
+		return n;
+	}
+
+	void forceReplace()
+		/// Removes all expired entries.
+		///
+		/// Expired entries are otherwise only removed when they are
+		/// accessed, or when their slot is needed for a new entry.
+	{
+		if (_expire == 0) return;
+
+		Timestamp::TimeVal now = currentTime();
+		for (std::size_t i = 0; i <= _mask; i++)
+		{
+			Shard& shard = _shards[i];
+			typename TMutex::ScopedLock lock(shard.mutex);
+			for (std::size_t k = 0; k < shard.slots.size(); k++)
+			{
+				if (shard.slots[k].pKey && shard.isExpired(k, now)) shard.evict(k);
+			}
+		}
+	}
+
+	KeySet getAllKeys()
+		/// Returns a copy of all keys stored in the cache.
+	{
+		forceReplace();
+		KeySet result;
+		for (std::size_t i = 0; i <= _mask; i++)
+		{
+			Shard& shard = _shards[i];
+			typename TMutex::ScopedLock lock(shard.mutex);
+			for (const auto& p: shard.index)
+			{
+				result.insert(p.first);
+			}
+		}
+		return result;
+	}
+
+	template <typename Fn>
+	void forEach(Fn&& fn) const
+		/// Iterates over all key-value pairs in the
+		/// cache, using a functor or lambda expression.
+		///
+		/// The given functor must take the key and value
+		/// as parameters. Note that the value is passed
+		/// as the actual value (or reference),
+		/// not a Poco::SharedPtr.
+		///
+		/// Shards are locked one after another, so the
+		/// iteration is not an atomic snapshot of the cache.
+	{
+		for (std::size_t i = 0; i <= _mask; i++)
+		{
+			const Shard& shard = _shards[i];
+			typename TMutex::ScopedLock lock(shard.mutex);
+			for (const auto& p: shard.index)
+			{
+				fn(p.first, *shard.slots[p.second].value);
+			}
+		}
+	}
+
+	std::size_t shards() const
+		/// Returns the number of shards.
+	{
+		return _mask + 1;
+	}
+
+	std::size_t capacity() const
+		/// Returns the maximum number of entries the cache can hold.
+	{
+		return shards()*_shards[0].slots.size();
+	}
+
+private:
+	enum
+	{
+		MIN_SHARD_CAPACITY = 8
+	};
+
+	struct Slot
+	{
+		const TKey*        pKey = nullptr;
+		ValuePtr           value;
+		Timestamp::TimeVal expires = 0;
+		bool               referenced = false;
+	};
+
+	using Index = std::unordered_map<TKey, std::size_t, THash>;
+
+	struct alignas(64) Shard
+	{
+		mutable TMutex           mutex;
+		Index                    index;
+		std::vector<Slot>        slots;
+		std::vector<std::size_t> free;
+		std::size_t              hand = 0;
+
+		void init(std::size_t capacity)
+		{
+			slots.resize(capacity);
+			free.reserve(capacity);
+			for (std::size_t i = capacity; i > 0; i--) free.push_back(i - 1);
+			index.reserve(capacity);
+		}
+
+		bool isExpired(std::size_t i, Timestamp::TimeVal now) const
+		{
+			return slots[i].expires != 0 && slots[i].expires <= now;
+		}
+
+		ValuePtr insert(const TKey& key, const ValuePtr& val, Timestamp::TimeVal now, Timestamp::TimeDiff expire)
+			/// Inserts or replaces the entry and returns the value
+			/// that has been replaced, so that it can be released
+			/// outside the lock.
+		{
+			ValuePtr old;
+			Timestamp::TimeVal expires = expire > 0 ? now + expire : 0;
+			auto it = index.find(key);
+			if (it != index.end())
+			{
+				Slot& slot = slots[it->second];
+				old = slot.value;
+				slot.value = val;
+				slot.expires = expires;
+			}
+			else
+			{
+				std::size_t i;
+				if (free.empty())
+				{
+					i = victim(now);
+					old = evict(i);
+				}
+				i = free.back();
+				free.pop_back();
+				auto res = index.emplace(key, i);
+				Slot& slot = slots[i];
+				slot.pKey = &res.first->first;
+				slot.value = val;
+				slot.expires = expires;
+				slot.referenced = false;
+			}
+			return old;
+		}
+
+		std::size_t victim(Timestamp::TimeVal now)
+			/// Advances the clock hand to the next entry to replace.
+			/// Terminates after at most two rounds, since the first
+			/// round clears all reference bits.
+		{
+			while (true)
+			{
+				std::size_t i = hand;
+				if (++hand == slots.size()) hand = 0;
+				Slot& slot = slots[i];
+				if (isExpired(i, now) || !slot.referenced) return i;
+				slot.referenced = false;
+			}
+		}
+
+		ValuePtr evict(std::size_t i)
+		{
+			Slot& slot = slots[i];
+			ValuePtr old;
+			old.swap(slot.value);
+			index.erase(*slot.pKey);
+			slot.pKey = nullptr;
+			slot.expires = 0;
+			slot.referenced = false;
+			free.push_back(i);
+			return old;
+		}
+
+		void clear()
+		{
+			index.clear();
+			free.clear();
+			for (std::size_t i = slots.size(); i > 0; i--)
+			{
+				Slot& slot = slots[i - 1];
+				slot.pKey = nullptr;
+				slot.value.reset();
+				slot.expires = 0;
+				slot.referenced = false;
+				free.push_back(i - 1);
+			}
+			hand = 0;
+		}
+	};
+
+	Shard& shardFor(const TKey& key) const
+	{
+		// Fibonacci hashing spreads poorly distributed hash
+		// values (e.g., std::hash for integers) over the shards.
+		Poco::UInt64 h = static_cast<Poco::UInt64>(_hash(key))*0x9E3779B97F4A7C15ULL;
+		return _shards[static_cast<std::size_t>(h >> 40) & _mask];
+	}
+
+	Timestamp::TimeVal currentTime() const
+	{
+		return _expire > 0 ? Timestamp().epochMicroseconds() : 0;
+	}
+
+	THash                    _hash;
+	std::size_t              _mask;
+	std::unique_ptr<Shard[]> _shards;
+	Timestamp::TimeDiff      _expire;
+	bool                     _accessExpire;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ShardedCache_INCLUDED
@@ -0,0 +1,64 @@
+//
+// ShardedExpireLRUCache.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  ShardedExpireLRUCache
+//
+// Definition of the ShardedExpireLRUCache class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ShardedExpireLRUCache_INCLUDED
+#define Foundation_ShardedExpireLRUCache_INCLUDED
+
+
+#include "Poco/ShardedCache.h"
+#include "Poco/Exception.h"
+
+
+namespace Poco {
+
+
+template <
+	class TKey,
+	class TValue,
+	class THash = std::hash<TKey>,
+	class TMutex = FastMutex
+>
+class ShardedExpireLRUCache: public ShardedCache<TKey, TValue, THash, TMutex>
+	/// A ShardedExpireLRUCache combines approximate LRU caching and time based
+	/// expire caching, using independent shards and the CLOCK replacement
+	/// algorithm (see ShardedCache). It can be used instead of ExpireLRUCache
+	/// if lock contention is an issue and events are not needed.
+	///
+	/// Entries are cached for a fixed time period (per default 10 minutes)
+	/// after they have been added, and the size of the cache is limited
+	/// (per default: 1024).
+{
+public:
+	ShardedExpireLRUCache(std::size_t cacheSize = 1024, Timestamp::TimeDiff expire = 600000, std::size_t shards = 0):
+		ShardedCache<TKey, TValue, THash, TMutex>(cacheSize, shards, expire, false)
+		/// Creates the ShardedExpireLRUCache. The expire time is given in
+		/// milliseconds and must be at least 25 ms. If shards is 0,
+		/// the number of shards is chosen automatically.
+	{
+		if (expire < 25) throw InvalidArgumentException("expireTime must be at least 25 ms");
+	}
+
+	~ShardedExpireLRUCache() = default;
+
+	ShardedExpireLRUCache(const ShardedExpireLRUCache& aCache) = delete;
+	ShardedExpireLRUCache& operator=(const ShardedExpireLRUCache& aCache) = delete;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ShardedExpireLRUCache_INCLUDED
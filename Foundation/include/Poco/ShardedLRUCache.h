@@ -0,0 +1,58 @@
+//
+// ShardedLRUCache.h
+//
+// Library: Foundation
+// Package: Cache
+// Module:  ShardedLRUCache
+//
+// Definition of the ShardedLRUCache class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_ShardedLRUCache_INCLUDED
+#define Foundation_ShardedLRUCache_INCLUDED
+
+
+#include "Poco/ShardedCache.h"
+
+
+namespace Poco {
+
+
+template <
+	class TKey,
+	class TValue,
+	class THash = std::hash<TKey>,
+	class TMutex = FastMutex
+>
+class ShardedLRUCache: public ShardedCache<TKey, TValue, THash, TMutex>
+	/// A ShardedLRUCache implements approximate Least Recently Used caching
+	/// for concurrent access, using independent shards and the CLOCK
+	/// replacement algorithm (see ShardedCache). It can be used instead of
+	/// LRUCache if lock contention is an issue and events are not needed.
+	/// The default size for a cache is 1024 entries.
+{
+public:
+	ShardedLRUCache(std::size_t size = 1024, std::size_t shards = 0):
+		ShardedCache<TKey, TValue, THash, TMutex>(size, shards)
+		/// Creates the ShardedLRUCache. If shards is 0,
+		/// the number of shards is chosen automatically.
+	{
+	}
+
+	~ShardedLRUCache() = default;
+
+	ShardedLRUCache(const ShardedLRUCache& aCache) = delete;
+	ShardedLRUCache& operator=(const ShardedLRUCache& aCache) = delete;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_ShardedLRUCache_INCLUDED
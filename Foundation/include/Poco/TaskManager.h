@@ -32,6 +32,7 @@ namespace Poco {
 
 class Notification;
 class ThreadPool;
+class WorkStealingThreadPool;
 class Exception;
 
 
@@ -62,6 +63,18 @@ public:
 		/// given ThreadPool (should be used
 		/// by this TaskManager exclusively).
 
+	TaskManager(WorkStealingThreadPool& pool);
+		/// Creates the TaskManager, using the
+		/// given WorkStealingThreadPool, which may
+		/// be shared with other users.
+		///
+		/// With a WorkStealingThreadPool, start() never
+		/// fails due to a lack of available threads; tasks
+		/// are queued until a worker thread becomes available.
+		/// joinAll() waits until all tasks in the pool,
+		/// including tasks not started by this TaskManager,
+		/// have completed.
+
 	~TaskManager();
 		/// Destroys the TaskManager.
 
@@ -124,12 +137,13 @@ private:
 	using MutexT = FastMutex;
 	using ScopedLockT = MutexT::ScopedLock;
 
-	ThreadPool&        _threadPool;
-	bool               _ownPool;
-	TaskList           _taskList;
-	Timestamp          _lastProgressNotification;
-	NotificationCenter _nc;
-	mutable MutexT     _mutex;
+	ThreadPool*             _pThreadPool;
+	WorkStealingThreadPool* _pWorkStealingPool;
+	bool                    _ownPool;
+	TaskList                _taskList;
+	Timestamp               _lastProgressNotification;
+	NotificationCenter      _nc;
+	mutable MutexT          _mutex;
 
 	friend class Task;
 };
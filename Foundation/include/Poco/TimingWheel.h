@@ -0,0 +1,265 @@
+//
+// TimingWheel.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  TimingWheel
+//
+// Definition of the TimingWheel class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_TimingWheel_INCLUDED
+#define Foundation_TimingWheel_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Clock.h"
+#include "Poco/Timespan.h"
+#include "Poco/Mutex.h"
+#include <functional>
+#include <vector>
+
+
+namespace Poco {
+
+
+class Foundation_API TimingWheel
+	/// A hashed hierarchical timing wheel, as described by
+	/// Varghese and Lauck ("Hashed and Hierarchical Timing Wheels",
+	/// 1987) and used by the Linux kernel for its timers.
+	///
+	/// Timers are kept in four wheels of 256 slots each. The first
+	/// wheel has one slot per tick (the resolution given in the
+	/// constructor, 1 millisecond by default), each slot of the next
+	/// wheel covers a full turn of the previous one. When the first wheel
+	/// completes a turn, the timers of the next slot of the second wheel
+	/// are redistributed ("cascaded") into the first one, and so on.
+	/// With a resolution of 1 millisecond, timers can be scheduled up
+	/// to about 49 days into the future; timers with longer delays are
+	/// cascaded again until they are due.
+	///
+	/// Scheduling, rescheduling and cancelling a timer are O(1). Timers
+	/// are stored in a pool of nodes that is reused, so that, apart
+	/// from the callback object, they do not allocate memory once the
+	/// pool has grown to the number of concurrently scheduled timers.
+	/// This makes the TimingWheel suitable for large numbers of timers
+	/// that are usually cancelled or restarted before they expire,
+	/// such as connection or request timeouts.
+	///
+	/// The TimingWheel does not have its own thread. The owner must
+	/// call advance() periodically, e.g. from an event loop, using
+	/// nextTimeout() to determine how long it can wait. Expired timer
+	/// callbacks are invoked from advance(), without holding the
+	/// internal lock, so that callbacks can schedule and cancel timers.
+	///
+	/// All methods are thread-safe. Timers may be scheduled and cancelled
+	/// from any thread, while advance() should be called from one thread only.
+	///
+	/// Timers never fire early. Due to the tick granularity, they may
+	/// fire up to one tick (plus the latency of advance() calls) late.
+{
+public:
+	using Callback = std::function<void()>;
+
+	class Handle
+		/// A Handle identifies a scheduled timer and is used to
+		/// reschedule or cancel it.
+		///
+		/// Handles are small values that can be copied freely.
+		/// A Handle becomes stale once its timer has expired or
+		/// has been cancelled; using a stale Handle is harmless.
+	{
+	public:
+		Handle();
+			/// Creates a null Handle.
+
+		bool isNull() const;
+			/// Returns true if the Handle is a null Handle.
+
+		void reset();
+			/// Resets the Handle to a null Handle.
+
+		bool operator == (const Handle& other) const;
+		bool operator != (const Handle& other) const;
+
+	private:
+		Handle(Poco::UInt32 index, Poco::UInt32 generation);
+
+		Poco::UInt32 _index;
+		Poco::UInt32 _generation;
+
+		friend class TimingWheel;
+	};
+
+	explicit TimingWheel(const Poco::Timespan& resolution = Poco::Timespan(0, 1000));
+		/// Creates the TimingWheel with the given tick resolution,
+		/// which must be at least one microsecond.
+
+	TimingWheel(const TimingWheel&) = delete;
+	TimingWheel& operator = (const TimingWheel&) = delete;
+
+	~TimingWheel();
+		/// Destroys the TimingWheel. Pending timers are discarded
+		/// without invoking their callbacks.
+
+	Handle schedule(const Poco::Timespan& delay, const Callback& callback);
+		/// Schedules the callback to be invoked after the given delay.
+		/// Returns a Handle that can be used to reschedule or cancel the timer.
+
+	Handle schedule(const Poco::Clock& time, const Callback& callback);
+		/// Schedules the callback to be invoked at the given time.
+		/// If the time lies in the past, the callback is invoked
+		/// with the next tick.
+
+	bool reschedule(const Handle& handle, const Poco::Timespan& delay);
+		/// Moves the given pending timer so that it expires after
+		/// the given delay, counted from now.
+		///
+		/// Returns true if the timer has been rescheduled, or false
+		/// if the Handle is stale (the timer has already expired
+		/// or has been cancelled).
+
+	bool cancel(Handle& handle);
+		/// Cancels the given pending timer and resets the Handle.
+		///
+		/// Returns true if the timer has been cancelled, or false
+		/// if the Handle is stale. Note that the callback of a timer
+		/// that has expired in a concurrent call to advance() may still
+		/// be running or about to run when cancel() returns false.
+
+	bool isScheduled(const Handle& handle) const;
+		/// Returns true if the timer identified by the Handle is still pending.
+
+	std::size_t advance();
+		/// Expires all timers that are due and invokes their callbacks.
+		/// Returns the number of callbacks invoked.
+		///
+		/// Exceptions thrown by callbacks are passed to the ErrorHandler.
+
+	std::size_t advance(const Poco::Clock& now);
+		/// Expires all timers due at the given time and invokes their
+		/// callbacks. The given time must not be less than the time
+		/// passed to a previous call. Returns the number of callbacks invoked.
+
+	Poco::Timespan nextTimeout(const Poco::Timespan& maxTimeout) const;
+		/// Returns the time until advance() must be called next
+		/// to expire the next pending timer, but not more than maxTimeout.
+		///
+		/// The returned time may be shorter than the time until the
+		/// next timer actually expires, as timers in the outer wheels
+		/// must be cascaded first.
+
+	void clear();
+		/// Cancels all pending timers, without invoking their callbacks.
+
+	std::size_t size() const;
+		/// Returns the number of pending timers.
+
+	bool empty() const;
+		/// Returns true if there are no pending timers.
+
+	Poco::Timespan resolution() const;
+		/// Returns the tick resolution.
+
+private:
+	enum
+	{
+		WHEEL_BITS  = 8,
+		WHEEL_SIZE  = 1 << WHEEL_BITS,
+		WHEEL_MASK  = WHEEL_SIZE - 1,
+		WHEEL_COUNT = 4
+	};
+
+	static const Poco::UInt32 NIL = 0xFFFFFFFF;
+
+	struct Node
+	{
+		Poco::Int64  expires;
+		Poco::UInt32 prev;
+		Poco::UInt32 next;
+		Poco::UInt32 slot;
+		Poco::UInt32 generation;
+		Callback     callback;
+	};
+
+	Poco::Int64 ticksAt(const Poco::Clock& time) const;
+	Poco::UInt32 allocate();
+	void release(Poco::UInt32 index);
+	void link(Poco::UInt32 index);
+	void unlink(Poco::UInt32 index);
+	bool cascade(int wheel, int slot);
+	Poco::Int64 skipTicks() const;
+	Node* find(const Handle& handle);
+	const Node* find(const Handle& handle) const;
+
+	Poco::Clock::ClockDiff _resolution;
+	Poco::Clock _start;
+	Poco::Int64 _nextTick;
+	std::vector<Node> _nodes;
+	Poco::UInt32 _free;
+	std::size_t _size;
+	Poco::UInt32 _slots[WHEEL_COUNT*WHEEL_SIZE];
+	std::size_t _wheelSize[WHEEL_COUNT];
+	std::vector<Callback> _expired;
+	mutable Poco::FastMutex _mutex;
+};
+
+
+//
+// inlines
+//
+inline TimingWheel::Handle::Handle():
+	_index(0),
+	_generation(0)
+{
+}
+
+
+inline TimingWheel::Handle::Handle(Poco::UInt32 index, Poco::UInt32 generation):
+	_index(index),
+	_generation(generation)
+{
+}
+
+
+inline bool TimingWheel::Handle::isNull() const
+{
+	return _generation == 0;
+}
+
+
+inline void TimingWheel::Handle::reset()
+{
+	_index = 0;
+	_generation = 0;
+}
+
+
+inline bool TimingWheel::Handle::operator == (const Handle& other) const
+{
+	return _index == other._index && _generation == other._generation;
+}
+
+
+inline bool TimingWheel::Handle::operator != (const Handle& other) const
+{
+	return !(*this == other);
+}
+
+
+inline Poco::Timespan TimingWheel::resolution() const
+{
+	return Poco::Timespan(_resolution);
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_TimingWheel_INCLUDED
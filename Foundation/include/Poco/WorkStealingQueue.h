@@ -0,0 +1,221 @@
+//
+// WorkStealingQueue.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  WorkStealingThreadPool
+//
+// Definition of the WorkStealingQueue class template.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_WorkStealingQueue_INCLUDED
+#define Foundation_WorkStealingQueue_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <atomic>
+#include <vector>
+#include <cstdint>
+
+
+namespace Poco {
+
+
+template <class T>
+class WorkStealingQueue
+	/// A lock-free double-ended work-stealing queue of pointers,
+	/// as described by Chase and Lev ("Dynamic Circular Work-Stealing
+	/// Deque", SPAA 2005), using the C11 memory model formulation
+	/// by Lê, Pop, Cohen and Zappa Nardelli ("Correct and Efficient
+	/// Work-Stealing for Weak Memory Models", PPoPP 2013).
+	///
+	/// The queue has a single owner thread, which pushes and pops
+	/// elements at the bottom end (LIFO). Any number of other threads
+	/// can concurrently steal elements from the top end (FIFO).
+	///
+	/// The underlying circular array grows as needed. Arrays that have
+	/// been replaced are kept until the queue is destroyed, as thieves
+	/// may still be reading from them.
+	///
+	/// T must be a pointer type. A null pointer is returned by pop()
+	/// and steal() if no element is available.
+{
+public:
+	explicit WorkStealingQueue(std::size_t capacity = 256):
+		_top(0),
+		_bottom(0)
+		/// Creates the WorkStealingQueue with the given initial
+		/// capacity, which is rounded up to a power of two.
+	{
+		std::size_t n = 2;
+		while (n < capacity) n <<= 1;
+		Array* pArray = new Array(static_cast<std::int64_t>(n));
+		_garbage.push_back(pArray);
+		_pArray.store(pArray, std::memory_order_relaxed);
+	}
+
+	WorkStealingQueue(const WorkStealingQueue&) = delete;
+	WorkStealingQueue& operator = (const WorkStealingQueue&) = delete;
+
+	~WorkStealingQueue()
+		/// Destroys the WorkStealingQueue. Remaining elements
+		/// are not deleted.
+	{
+		for (auto pArray: _garbage) delete pArray;
+	}
+
+	void push(T item)
+		/// Pushes an element at the bottom end of the queue.
+		///
+		/// Must only be called by the owner thread.
+	{
+		std::int64_t b = _bottom.load(std::memory_order_relaxed);
+		std::int64_t t = _top.load(std::memory_order_acquire);
+		Array* pArray = _pArray.load(std::memory_order_relaxed);
+		if (b - t > pArray->capacity() - 1)
+		{
+			pArray = grow(pArray, t, b);
+		}
+		pArray->put(b, item);
+		std::atomic_thread_fence(std::memory_order_release);
+		_bottom.store(b + 1, std::memory_order_relaxed);
+	}
+
+	T pop()
+		/// Removes and returns the element at the bottom end of
+		/// the queue, or a null pointer if the queue is empty.
+		///
+		/// Must only be called by the owner thread.
+	{
+		std::int64_t b = _bottom.load(std::memory_order_relaxed) - 1;
+		Array* pArray = _pArray.load(std::memory_order_relaxed);
+		_bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		std::int64_t t = _top.load(std::memory_order_relaxed);
+		T item = nullptr;
+		if (t <= b)
+		{
+			item = pArray->get(b);
+			if (t == b)
+			{
+				// last element, race against thieves
+				if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					item = nullptr;
+				}
+				_bottom.store(b + 1, std::memory_order_relaxed);
+			}
+		}
+		else
+		{
+			_bottom.store(b + 1, std::memory_order_relaxed);
+		}
+		return item;
+	}
+
+	T steal()
+		/// Removes and returns the element at the top end of the
+		/// queue, or a null pointer if the queue is empty or another
+		/// thread has taken the element concurrently.
+		///
+		/// Can be called by any thread.
+	{
+		std::int64_t t = _top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		std::int64_t b = _bottom.load(std::memory_order_acquire);
+		if (t < b)
+		{
+			Array* pArray = _pArray.load(std::memory_order_acquire);
+			T item = pArray->get(t);
+			if (_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			{
+				return item;
+			}
+		}
+		return nullptr;
+	}
+
+	bool empty() const
+		/// Returns true if the queue is empty. The result is
+		/// only a snapshot if other threads access the queue.
+	{
+		std::int64_t b = _bottom.load(std::memory_order_relaxed);
+		std::int64_t t = _top.load(std::memory_order_relaxed);
+		return b <= t;
+	}
+
+	std::size_t size() const
+		/// Returns the number of elements in the queue. The result
+		/// is only a snapshot if other threads access the queue.
+	{
+		std::int64_t b = _bottom.load(std::memory_order_relaxed);
+		std::int64_t t = _top.load(std::memory_order_relaxed);
+		return b > t ? static_cast<std::size_t>(b - t) : 0;
+	}
+
+private:
+	class Array
+	{
+	public:
+		explicit Array(std::int64_t capacity):
+			_capacity(capacity),
+			_mask(capacity - 1),
+			_items(new std::atomic<T>[static_cast<std::size_t>(capacity)])
+		{
+		}
+
+		~Array()
+		{
+			delete [] _items;
+		}
+
+		std::int64_t capacity() const
+		{
+			return _capacity;
+		}
+
+		void put(std::int64_t index, T item)
+		{
+			_items[index & _mask].store(item, std::memory_order_relaxed);
+		}
+
+		T get(std::int64_t index) const
+		{
+			return _items[index & _mask].load(std::memory_order_relaxed);
+		}
+
+	private:
+		std::int64_t _capacity;
+		std::int64_t _mask;
+		std::atomic<T>* _items;
+	};
+
+	Array* grow(Array* pArray, std::int64_t t, std::int64_t b)
+	{
+		Array* pNewArray = new Array(2*pArray->capacity());
+		for (std::int64_t i = t; i < b; i++)
+		{
+			pNewArray->put(i, pArray->get(i));
+		}
+		_garbage.push_back(pNewArray);
+		_pArray.store(pNewArray, std::memory_order_release);
+		return pNewArray;
+	}
+
+	alignas(64) std::atomic<std::int64_t> _top;
+	alignas(64) std::atomic<std::int64_t> _bottom;
+	std::atomic<Array*> _pArray;
+	std::vector<Array*> _garbage;
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_WorkStealingQueue_INCLUDED
@@ -0,0 +1,302 @@
+//
+// WorkStealingThreadPool.h
+//
+// Library: Foundation
+// Package: Threading
+// Module:  WorkStealingThreadPool
+//
+// Definition of the WorkStealingThreadPool class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_WorkStealingThreadPool_INCLUDED
+#define Foundation_WorkStealingThreadPool_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/Future.h"
+#include "Poco/Environment.h"
+#include "Poco/Mutex.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+namespace Poco {
+
+
+class Runnable;
+
+
+class Foundation_API WorkStealingThreadPool
+	/// A fixed-size thread pool that distributes tasks using work stealing.
+	///
+	/// Every worker thread owns a lock-free double-ended queue
+	/// (see WorkStealingQueue). Tasks submitted by a worker thread,
+	/// e.g. subtasks or continuations, are pushed to the worker's own
+	/// queue, and the worker takes its next task from there (LIFO,
+	/// which is cache-friendly). Idle workers steal tasks from the
+	/// other end of other workers' queues (FIFO). Tasks submitted by
+	/// other threads are placed in a shared injection queue.
+	///
+	/// As a result, fanning out many short tasks does not contend on
+	/// a single queue lock, as it does with ThreadPool and ActiveThreadPool.
+	///
+	/// Tasks can be started as Runnable (start()), as functors or
+	/// lambdas (execute()), or submitted with submit(), which returns
+	/// a Future for the result of the task. parallelFor() invokes a
+	/// function for a range of indices, with the calling thread
+	/// participating in the work.
+	///
+	/// Unlike ThreadPool, the WorkStealingThreadPool never throws a
+	/// NoThreadAvailableException; tasks are queued until a worker
+	/// becomes available. Tasks that block for a long time (e.g.,
+	/// waiting for other tasks) therefore reduce the available
+	/// parallelism and should be avoided.
+	///
+	/// Exceptions thrown by tasks started with start() or execute()
+	/// are passed to the ErrorHandler. Exceptions thrown by tasks
+	/// started with submit() are stored in the Future.
+{
+public:
+	WorkStealingThreadPool(int capacity = static_cast<int>(Environment::processorCount()),
+		int stackSize = POCO_THREAD_STACK_SIZE);
+		/// Creates a WorkStealingThreadPool with the given number of
+		/// worker threads, which are created with the given stack size.
+
+	WorkStealingThreadPool(const std::string& name,
+		int capacity = static_cast<int>(Environment::processorCount()),
+		int stackSize = POCO_THREAD_STACK_SIZE);
+		/// Creates a WorkStealingThreadPool with the given name and number
+		/// of worker threads, which are created with the given stack size.
+
+	WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+	WorkStealingThreadPool& operator = (const WorkStealingThreadPool&) = delete;
+
+	~WorkStealingThreadPool();
+		/// Waits until all pending tasks have completed,
+		/// then stops the worker threads.
+
+	int capacity() const;
+		/// Returns the number of worker threads.
+
+	const std::string& name() const;
+		/// Returns the name of the thread pool,
+		/// or an empty string if no name has been
+		/// specified in the constructor.
+
+	void start(Runnable& target);
+		/// Starts the target in a worker thread. The target
+		/// must remain valid until it has been run.
+
+	template <class Fn>
+	void execute(Fn&& fn)
+		/// Runs the given functor or lambda in a worker thread.
+	{
+		enqueue(new FunctionTask<std::decay_t<Fn>>(std::forward<Fn>(fn)));
+	}
+
+	template <class Fn>
+	Future<std::invoke_result_t<std::decay_t<Fn>>> submit(Fn&& fn)
+		/// Runs the given functor or lambda in a worker thread and
+		/// returns a Future for its result. Continuations registered
+		/// with Future::then() run in this pool.
+	{
+		using R = std::invoke_result_t<std::decay_t<Fn>>;
+
+		Promise<R> promise(*this);
+		Future<R> future = promise.future();
+		execute([promise, fn = std::forward<Fn>(fn)]() mutable
+			{
+				promise.setFrom(fn);
+			});
+		return future;
+	}
+
+	template <class Index, class Fn>
+	void parallelFor(Index begin, Index end, Fn&& fn, Index grain = 0)
+		/// Invokes fn(i) for every i in the range [begin, end), in parallel.
+		///
+		/// The range is split into chunks of grain indices (if zero, a
+		/// suitable grain size is chosen), which are processed by the
+		/// worker threads and the calling thread. Returns when all
+		/// indices have been processed. If fn throws, remaining chunks
+		/// are skipped and the first exception is rethrown.
+		///
+		/// Index must be an integral type. parallelFor() can be called
+		/// from a task running in the pool (nested parallelism).
+	{
+		static_assert(std::is_integral_v<Index>, "Index must be an integral type");
+
+		if (!(begin < end)) return;
+		const Index n = end - begin;
+		if (grain <= 0) grain = std::max<Index>(1, static_cast<Index>(n/(Index(capacity())*8)));
+		const Index chunks = n/grain + (n % grain != 0 ? 1 : 0);
+		const int helpers = static_cast<int>(std::min<Index>(chunks, static_cast<Index>(capacity()))) - 1;
+
+		auto pState = std::make_shared<ParallelForState<Index>>(begin, end, grain);
+		auto* pFn = &fn;
+		for (int i = 0; i < helpers; i++)
+		{
+			// Helpers starting after all chunks have been taken return
+			// immediately, without accessing fn.
+			execute([pState, pFn]()
+				{
+					pState->run(pFn);
+				});
+		}
+		pState->run(pFn);
+		pState->wait();
+	}
+
+	void joinAll();
+		/// Waits until all tasks, including tasks started while waiting,
+		/// have completed. Must not be called from a worker thread.
+
+	static WorkStealingThreadPool& defaultPool();
+		/// Returns a reference to the default WorkStealingThreadPool,
+		/// which has one worker thread per processor.
+
+private:
+	class Task
+	{
+	public:
+		virtual ~Task() = default;
+		virtual void run() = 0;
+	};
+
+	template <class Fn>
+	class FunctionTask: public Task
+	{
+	public:
+		template <class F>
+		explicit FunctionTask(F&& fn):
+			_fn(std::forward<F>(fn))
+		{
+		}
+
+		void run() override
+		{
+			_fn();
+		}
+
+	private:
+		Fn _fn;
+	};
+
+	template <class Index>
+	class ParallelForState
+	{
+	public:
+		ParallelForState(Index begin, Index end, Index grain):
+			_next(begin),
+			_end(end),
+			_grain(grain),
+			_active(0),
+			_failed(false)
+		{
+		}
+
+		template <class Fn>
+		void run(Fn* pFn)
+		{
+			_active.fetch_add(1);
+			while (!_failed.load(std::memory_order_relaxed))
+			{
+				Index first = _next.fetch_add(_grain);
+				if (!(first < _end)) break;
+				Index last = _end - first > _grain ? first + _grain : _end;
+				try
+				{
+					for (Index i = first; i < last; ++i) (*pFn)(i);
+				}
+				catch (...)
+				{
+					std::lock_guard<std::mutex> lock(_mutex);
+					if (!_pException) _pException = std::current_exception();
+					_failed = true;
+				}
+			}
+			if (_active.fetch_sub(1) == 1)
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_done.notify_all();
+			}
+		}
+
+		void wait()
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_done.wait(lock, [this]() { return _active.load() == 0; });
+			if (_pException) std::rethrow_exception(_pException);
+		}
+
+	private:
+		std::atomic<Index> _next;
+		const Index _end;
+		const Index _grain;
+		std::atomic<int> _active;
+		std::atomic<bool> _failed;
+		std::exception_ptr _pException;
+		std::mutex _mutex;
+		std::condition_variable _done;
+	};
+
+	class RunnableTask;
+	class Worker;
+
+	void init(int capacity, int stackSize);
+	void enqueue(Task* pTask);
+	Task* findTask(Worker* pWorker);
+	Task* takeInjected();
+	bool hasTasks() const;
+	bool park();
+	void wakeUp();
+	bool quiescent() const;
+
+	std::string _name;
+	std::vector<std::unique_ptr<Worker>> _workers;
+	FastMutex _injectionMutex;
+	std::deque<Task*> _injected;
+	std::atomic<std::size_t> _injectedCount;
+	std::atomic<Poco::UInt64> _injectedTotal;
+	alignas(64) std::atomic<int> _idle;
+	std::mutex _parkMutex;
+	std::condition_variable _parkCondition;
+	std::condition_variable _joinCondition;
+	int _wakeUps;
+	bool _stopped;
+
+	friend class Worker;
+};
+
+
+//
+// inlines
+//
+inline int WorkStealingThreadPool::capacity() const
+{
+	return static_cast<int>(_workers.size());
+}
+
+
+inline const std::string& WorkStealingThreadPool::name() const
+{
+	return _name;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_WorkStealingThreadPool_INCLUDED
@@ -0,0 +1,177 @@
+//
+// XXH3.h
+//
+// Library: Foundation
+// Package: Hashing
+// Module:  XXH3
+//
+// Definition of the XXH3 class and the XXH3Hash class template.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_XXH3_INCLUDED
+#define Foundation_XXH3_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+
+namespace Poco {
+
+
+class Foundation_API XXH3
+	/// This class implements the 64-bit variant of the XXH3
+	/// non-cryptographic hash function from the xxHash family
+	/// (version 0.8, <https://github.com/Cyan4973/xxHash>).
+	/// Results are identical to XXH3_64bits() and XXH3_64bits_withSeed()
+	/// of the reference implementation.
+	///
+	/// XXH3 is very fast for both short keys (a few nanoseconds
+	/// for strings of up to 16 bytes) and long inputs (several
+	/// gigabytes per second, using SSE2 on x86/x64) and has
+	/// excellent distribution properties.
+	///
+	/// XXH3 must not be used where a cryptographic hash function
+	/// is required.
+	///
+	/// The static hash() functions compute the hash of a single
+	/// block of data. An XXH3 object computes the hash of data that
+	/// is passed in several parts with update(). See also XXH3Engine
+	/// and XXH3Hash.
+{
+public:
+	explicit XXH3(UInt64 seed = 0);
+		/// Creates the XXH3 using the given seed.
+
+	~XXH3();
+		/// Destroys the XXH3.
+
+	void update(const void* data, std::size_t length);
+		/// Updates the hash with the given data.
+
+	void update(const std::string& data);
+		/// Updates the hash with the given data.
+
+	UInt64 digest() const;
+		/// Returns the hash of the data passed to update() so far.
+		/// More data can be passed to update() afterwards.
+
+	void reset();
+		/// Resets the XXH3 so that a new hash can be computed,
+		/// using the same seed.
+
+	void reset(UInt64 seed);
+		/// Resets the XXH3 so that a new hash can be computed,
+		/// using the given seed.
+
+	UInt64 seed() const;
+		/// Returns the seed.
+
+	static UInt64 hash(const void* data, std::size_t length, UInt64 seed = 0);
+		/// Returns the hash of the given data.
+
+	static UInt64 hash(std::string_view data, UInt64 seed = 0);
+		/// Returns the hash of the given data.
+
+	enum
+	{
+		STRIPE_SIZE = 64,
+		SECRET_SIZE = 192,
+		BUFFER_SIZE = 256
+	};
+
+private:
+	alignas(64) UInt64 _acc[8];
+	alignas(64) unsigned char _secret[SECRET_SIZE];
+	alignas(64) unsigned char _buffer[BUFFER_SIZE];
+	std::size_t _bufferedSize;
+	std::size_t _stripesSoFar;
+	UInt64 _totalLength;
+	UInt64 _seed;
+};
+
+
+template <class T>
+struct XXH3Hash
+	/// A hash function for integral and enumeration types,
+	/// std::string and std::string_view, based on XXH3.
+	///
+	/// Can be used with HashMap, HashSet, LinearHashTable
+	/// and the standard library's unordered containers, e.g.:
+	///
+	///     Poco::HashMap<std::string, int, Poco::XXH3Hash<std::string>> map;
+{
+	static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "XXH3Hash requires an integral, enum or string type");
+
+	std::size_t operator () (T value) const
+		/// Returns the hash for the given value.
+	{
+		return static_cast<std::size_t>(XXH3::hash(&value, sizeof(value)));
+	}
+};
+
+
+template <>
+struct XXH3Hash<std::string>
+	/// A hash function for std::string, based on XXH3.
+	///
+	/// Also accepts std::string_view and C strings,
+	/// so it can be used for heterogeneous lookups
+	/// in HashMap and HashSet.
+{
+	using is_transparent = void;
+
+	std::size_t operator () (std::string_view value) const
+		/// Returns the hash for the given value.
+	{
+		return static_cast<std::size_t>(XXH3::hash(value.data(), value.size()));
+	}
+};
+
+
+template <>
+struct XXH3Hash<std::string_view>
+	/// A hash function for std::string_view, based on XXH3.
+{
+	std::size_t operator () (std::string_view value) const
+		/// Returns the hash for the given value.
+	{
+		return static_cast<std::size_t>(XXH3::hash(value.data(), value.size()));
+	}
+};
+
+
+//
+// inlines
+//
+inline void XXH3::update(const std::string& data)
+{
+	update(data.data(), data.size());
+}
+
+
+inline UInt64 XXH3::hash(std::string_view data, UInt64 seed)
+{
+	return hash(data.data(), data.size(), seed);
+}
+
+
+inline UInt64 XXH3::seed() const
+{
+	return _seed;
+}
+
+
+} // namespace Poco
+
+
+#endif // Foundation_XXH3_INCLUDED
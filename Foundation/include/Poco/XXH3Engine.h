@@ -0,0 +1,69 @@
+//
+// XXH3Engine.h
+//
+// Library: Foundation
+// Package: Crypt
+// Module:  XXH3Engine
+//
+// Definition of class XXH3Engine.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Foundation_XXH3Engine_INCLUDED
+#define Foundation_XXH3Engine_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "Poco/DigestEngine.h"
+#include "Poco/XXH3.h"
+
+
+namespace Poco {
+
+
+class Foundation_API XXH3Engine: public DigestEngine
+	/// This class adapts XXH3 to the DigestEngine interface,
+	/// e.g. for fast content fingerprints with DigestOutputStream.
+	///
+	/// The digest consists of the eight bytes of the 64-bit hash,
+	/// in big-endian byte order (the canonical representation used
+	/// by the xxhsum utility). XXH3 is not suitable for cryptographic
+	/// purposes.
+{
+public:
+	enum
+	{
+		DIGEST_SIZE = 8
+	};
+
+	explicit XXH3Engine(UInt64 seed = 0);
+		/// Creates the XXH3Engine, using the given seed.
+
+	~XXH3Engine() override;
+		/// Destroys the XXH3Engine.
+
+	std::size_t digestLength() const override;
+	void reset() override;
+	const DigestEngine::Digest& digest() override;
+
+protected:
+	void updateImpl(const void* data, std::size_t length) override;
+
+private:
+	XXH3 _xxh3;
+	DigestEngine::Digest _digest;
+
+	XXH3Engine(const XXH3Engine&);
+	XXH3Engine& operator = (const XXH3Engine&);
+};
+
+
+} // namespace Poco
+
+
+#endif // Foundation_XXH3Engine_INCLUDED
@@ -74,6 +74,7 @@ static const std::string compressFilePrefix ( ".~" );
 ArchiveStrategy::ArchiveStrategy():
 	_compressingCount(0),
 	_compress(false),
+	_compressThreads(1),
 	_pCompressor(nullptr)
 {
 }
@@ -110,6 +111,14 @@ void ArchiveStrategy::compress(bool flag)
 }
 
 
+void ArchiveStrategy::compressThreads(int threads)
+{
+	poco_assert (threads >= 0);
+
+	_compressThreads = threads;
+}
+
+
 void ArchiveStrategy::setPurgeCallback(PurgeCallback callback)
 {
 	_purgeCallback = std::move(callback);
@@ -192,7 +201,7 @@ void ArchiveStrategy::compressFile(const std::string& path)
 	FileOutputStream ostr(gzPath);
 	try
 	{
-		DeflatingOutputStream deflater(ostr, DeflatingStreamBuf::STREAM_GZIP);
+		DeflatingOutputStream deflater(ostr, DeflatingStreamBuf::STREAM_GZIP, DeflatingStreamBuf::DEFAULT_COMPRESSION, _compressThreads);
 		StreamCopier::copyStream(istr, deflater);
 		if (!deflater.good() || !ostr.good())
 			throw WriteFileException(gzPath);
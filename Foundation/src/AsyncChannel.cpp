@@ -22,6 +22,7 @@
 #include "Poco/Exception.h"
 #include "Poco/String.h"
 #include "Poco/Format.h"
+#include "Poco/Environment.h"
 #if defined(__linux__)
 #include <sched.h>
 #include <unistd.h>
@@ -60,10 +61,31 @@ private:
 };
 
 
+namespace
+{
+	const std::size_t MAX_RINGS = 16;
+
+	std::size_t ringIndex()
+		/// Returns the index of the ring buffer used by the current thread.
+		/// Threads are assigned round-robin, so that threads started at the
+		/// same time use different ring buffers.
+	{
+		static std::atomic<std::size_t> nextIndex(0);
+		static thread_local std::size_t index = nextIndex++;
+		return index;
+	}
+}
+
+
 AsyncChannel::AsyncChannel(Channel::Ptr pChannel, Thread::Priority prio):
 	_pChannel(pChannel),
 	_thread("AsyncChannel"),
-	_closed(false)
+	_closed(false),
+	_ringsReady(false),
+	_ringDropCount(0),
+	_sampleCount(0),
+	_ringIdle(false),
+	_ringEvent(Event::EVENT_AUTORESET)
 {
 	_thread.setPriority(prio);
 }
@@ -100,7 +122,20 @@ void AsyncChannel::open()
 {
 	FastMutex::ScopedLock lock(_threadMutex);
 
-	if (!_thread.isRunning()) _thread.start(*this);
+	if (!_thread.isRunning())
+	{
+		if (_ringSize != 0 && _rings.empty())
+		{
+			std::size_t n = 1;
+			while (n < static_cast<std::size_t>(Environment::processorCount()) && n < MAX_RINGS) n *= 2;
+			for (std::size_t i = 0; i < n; i++)
+			{
+				_rings.push_back(std::make_unique<RingBuffer>(_ringSize));
+			}
+			_ringsReady.store(true, std::memory_order_release);
+		}
+		_thread.start(*this);
+	}
 }
 
 
@@ -108,7 +143,17 @@ void AsyncChannel::close()
 {
 	if (!_closed.exchange(true))
 	{
-		if (_thread.isRunning())
+		if (_thread.isRunning() && !_rings.empty())
+		{
+			// The background thread drains the ring buffers
+			// and exits once it sees the channel closed.
+			do
+			{
+				_ringEvent.set();
+			}
+			while (!_thread.tryJoin(100));
+		}
+		else if (_thread.isRunning())
 		{
 			while (!_queue.empty()) Thread::sleep(100);
 
@@ -126,6 +171,11 @@ template <typename M>
 void AsyncChannel::logImpl(M&& msg)
 {
 	if (_closed) return;
+	if (_ringSize != 0)
+	{
+		logToRing(std::forward<M>(msg));
+		return;
+	}
 	if (_queueSize != 0 && static_cast<std::size_t>(_queue.size()) >= _queueSize)
 	{
 		++_dropCount;
@@ -144,6 +194,45 @@ void AsyncChannel::logImpl(M&& msg)
 }
 
 
+template <typename M>
+void AsyncChannel::logToRing(M&& msg)
+{
+	if (!_ringsReady.load(std::memory_order_acquire)) open();
+
+	RingBuffer& ring = *_rings[ringIndex() & (_rings.size() - 1)];
+	if (_overflowPolicy == OVERFLOW_SAMPLE
+		&& msg.getPriority() > Message::PRIO_ERROR
+		&& ring.size() >= ring.capacity()/2
+		&& _sampleCount++ % _sampleRate != 0)
+	{
+		++_ringDropCount;
+		return;
+	}
+
+	// emplace() only consumes msg if it succeeds.
+	while (!ring.emplace(std::forward<M>(msg)))
+	{
+		if (_overflowPolicy != OVERFLOW_BLOCK || _closed)
+		{
+			++_ringDropCount;
+			return;
+		}
+		wakeUpRing();
+		Thread::yield();
+	}
+	wakeUpRing();
+}
+
+
+void AsyncChannel::wakeUpRing()
+{
+	// Pairs with the fence in runRing(): either the background
+	// thread sees the new message, or we see that it is idle.
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_ringIdle.load(std::memory_order_relaxed)) _ringEvent.set();
+}
+
+
 void AsyncChannel::log(const Message& msg)
 {
 	logImpl(msg);
@@ -177,6 +266,10 @@ void AsyncChannel::setProperty(const std::string& name, const std::string& value
 	{
 		_enableCpuAffinity = (Poco::icompare(value, "true") == 0 || value == "1");
 	}
+	else if (name == "ringBufferSize" || name == "overflowPolicy" || name == "sampleRate" || name == "batchSize")
+	{
+		setRingProperty(name, value);
+	}
 	else
 	{
 		Channel::setProperty(name, value);
@@ -209,6 +302,12 @@ void AsyncChannel::run()
 #endif
 	}
 
+	if (!_rings.empty())
+	{
+		runRing();
+		return;
+	}
+
 	AutoPtr<Notification> nf = _queue.waitDequeueNotification();
 	while (nf)
 	{
@@ -223,6 +322,107 @@ void AsyncChannel::run()
 }
 
 
+void AsyncChannel::runRing()
+{
+	for (;;)
+	{
+		if (drainRings() == 0)
+		{
+			if (_closed)
+			{
+				drainRings();
+				break;
+			}
+			_ringIdle.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (ringsEmpty()) _ringEvent.tryWait(100);
+			_ringIdle.store(false, std::memory_order_relaxed);
+		}
+	}
+}
+
+
+std::size_t AsyncChannel::drainRings()
+{
+	std::size_t count = 0;
+	for (auto& pRing: _rings)
+	{
+		if (pRing->empty()) continue;
+
+		FastMutex::ScopedLock lock(_channelMutex);
+		if (_pChannel)
+		{
+			count += pRing->consume([this](Message& msg)
+				{
+					_pChannel->log(std::move(msg));
+				}, _batchSize);
+		}
+		else
+		{
+			count += pRing->consume([](Message&) {}, _batchSize);
+		}
+	}
+
+	std::size_t dropCount = _ringDropCount.exchange(0);
+	if (dropCount != 0)
+	{
+		FastMutex::ScopedLock lock(_channelMutex);
+		if (_pChannel) _pChannel->log(Message("AsyncChannel", Poco::format("Dropped %z messages.", dropCount), Message::PRIO_WARNING));
+	}
+	return count;
+}
+
+
+bool AsyncChannel::ringsEmpty() const
+{
+	for (const auto& pRing: _rings)
+	{
+		if (!pRing->empty()) return false;
+	}
+	return true;
+}
+
+
+void AsyncChannel::setRingProperty(const std::string& name, const std::string& value)
+{
+	FastMutex::ScopedLock lock(_threadMutex);
+
+	if (_thread.isRunning() || !_rings.empty())
+		throw IllegalStateException("Cannot change property of open AsyncChannel", name);
+
+	if (name == "ringBufferSize")
+	{
+		if (Poco::icompare(value, "none") == 0 || value.empty())
+			_ringSize = 0;
+		else
+			_ringSize = Poco::NumberParser::parseUnsigned(value);
+	}
+	else if (name == "overflowPolicy")
+	{
+		if (value == "block")
+			_overflowPolicy = OVERFLOW_BLOCK;
+		else if (value == "drop")
+			_overflowPolicy = OVERFLOW_DROP;
+		else if (value == "sample")
+			_overflowPolicy = OVERFLOW_SAMPLE;
+		else
+			throw InvalidArgumentException("overflow policy", value);
+	}
+	else if (name == "sampleRate")
+	{
+		std::size_t rate = Poco::NumberParser::parseUnsigned(value);
+		if (rate == 0) throw InvalidArgumentException("sample rate", value);
+		_sampleRate = rate;
+	}
+	else if (name == "batchSize")
+	{
+		std::size_t size = Poco::NumberParser::parseUnsigned(value);
+		if (size == 0) throw InvalidArgumentException("batch size", value);
+		_batchSize = size;
+	}
+}
+
+
 void AsyncChannel::setPriority(const std::string& value)
 {
 	Thread::Priority prio = Thread::PRIO_NORMAL;
@@ -100,7 +100,18 @@ void AsyncNotificationCenter::postNotification(Notification::Ptr pNotification)
 
 int AsyncNotificationCenter::backlog() const
 {
-	return _nq.size();
+	int cnt = _nq.size();
+
+#if (POCO_HAVE_JTHREAD)
+	AutoPtr<QueueSnapshot> pQueues = _queues.get();
+	if (pQueues)
+	{
+		for (const auto& pQueue: pQueues->queues)
+			cnt += static_cast<int>(pQueue->queue.size());
+	}
+#endif
+
+	return cnt;
 }
 
 
@@ -134,17 +145,14 @@ void AsyncNotificationCenter::notifyObservers(Notification::Ptr& pNotification)
 
 	if (_mode == AsyncMode::NOTIFY || _mode == AsyncMode::BOTH)
 	{
-		std::unique_lock<std::mutex> lock(_listsMutex);
-		auto observers = observersToNotify(pNotification);
-		if (observers.empty())
-			return;
-		for (auto& o : observers)
+		AutoPtr<QueueSnapshot> pQueues = _queues.get();
+		if (!pQueues) return;
+		const ObserverList& observers = pQueues->pObservers->observers;
+		for (std::size_t i = 0; i < observers.size(); ++i)
 		{
-			auto& list = _lists[o];
-			list.push_back(pNotification);
+			if (observers[i]->accepts(pNotification))
+				enqueue(*pQueues->queues[i], pNotification);
 		}
-		_listsEmpty = false;
-		_listsEmptyCondition.notify_all();
 		return;
 	}
 
@@ -177,8 +185,6 @@ void AsyncNotificationCenter::start()
 	}
 
 #if (POCO_HAVE_JTHREAD)
-	_workerIterator = _lists.begin();
-
 	if (_mode == AsyncMode::NOTIFY || _mode == AsyncMode::BOTH)
 	{
 		auto dispatch = [this](std::stop_token stopToken, std::size_t workerId) {
@@ -213,6 +219,10 @@ void AsyncNotificationCenter::stop()
 	{
 		t.request_stop();
 	}
+	{
+		std::lock_guard<std::mutex> lock(_readyMutex);
+		_readyCondition.notify_all();
+	}
 	for (auto& t: _workers)
 	{
 		if (t.joinable()) t.join();
@@ -254,59 +264,160 @@ void AsyncNotificationCenter::dequeue()
 
 #if (POCO_HAVE_JTHREAD)
 
-std::optional<AsyncNotificationCenter::NotificationTuple> AsyncNotificationCenter::nextNotification()
+void AsyncNotificationCenter::observersChanged(const ObserverSnapshotPtr& pObservers)
 {
-	std::unique_lock<std::mutex> lock(_listsMutex);
+	if (_mode == AsyncMode::ENQUEUE) return;
+
+	// Keep the queues (and pending notifications) of observers that are still
+	// registered. Queues of removed observers are dropped; if one is currently
+	// scheduled, the worker delivers its remaining notifications to the
+	// disabled observer, which ignores them.
+	AutoPtr<QueueSnapshot> pOld = _queues.get();
+	AutoPtr<QueueSnapshot> pNew = new QueueSnapshot;
+	pNew->pObservers = pObservers;
+	pNew->queues.reserve(pObservers->observers.size());
+	for (const auto& pObserver: pObservers->observers)
+	{
+		ObserverQueuePtr pQueue;
+		if (pOld)
+		{
+			for (const auto& pOldQueue: pOld->queues)
+			{
+				if (pOldQueue->pObserver.get() == pObserver.get())
+				{
+					pQueue = pOldQueue;
+					break;
+				}
+			}
+		}
+		if (!pQueue) pQueue = new ObserverQueue(pObserver);
+		pNew->queues.push_back(pQueue);
+	}
+	_queues.assign(pNew);
+}
 
-	for (std::size_t i {0}; i < _lists.size(); ++i)
+
+void AsyncNotificationCenter::enqueue(ObserverQueue& queue, const Notification::Ptr& pNotification)
+{
+	if (queue.overflowed.load() || !queue.queue.tryPush(pNotification))
+	{
+		std::lock_guard<std::mutex> lock(queue.overflowMutex);
+		queue.overflow.push_back(pNotification);
+		queue.overflowed = true;
+	}
+	if (!queue.scheduled.exchange(true))
 	{
-		if (_lists.empty())
-			break;
+		schedule(ObserverQueuePtr(&queue, true));
+	}
+}
 
-		if (_workerIterator == _lists.end())
-			_workerIterator = _lists.begin();
 
-		auto& o = _workerIterator->first;
-		auto& l = _workerIterator->second;
-		if (l.empty())
+void AsyncNotificationCenter::schedule(const ObserverQueuePtr& pQueue)
+{
+	{
+		std::lock_guard<std::mutex> lock(_readyMutex);
+		_ready.push_back(pQueue);
+	}
+	_readyCondition.notify_one();
+}
+
+
+void AsyncNotificationCenter::dispatchBatch(ObserverQueue& queue)
+{
+	std::size_t count = 0;
+	auto notify = [&queue, &count](Notification::Ptr& pNf)
+	{
+		++count;
+		queue.pObserver->notify(pNf);
+	};
+
+	bool more = true;
+	while (more && count < DISPATCH_BATCH_SIZE)
+	{
+		try
 		{
-			++_workerIterator;
-			continue;
-		};
-		if (!hasObserver(*o))
+			std::size_t n = DISPATCH_BATCH_SIZE - count;
+			more = queue.queue.consume(notify, n) == n;
+			if (!more && queue.overflowed.load())
+			{
+				// The ring buffer is empty, so all notifications in the
+				// overflow list have been posted after the ones delivered so far.
+				std::deque<Notification::Ptr> overflow;
+				{
+					std::lock_guard<std::mutex> lock(queue.overflowMutex);
+					overflow.swap(queue.overflow);
+					queue.overflowed = false;
+				}
+				while (!overflow.empty())
+				{
+					Notification::Ptr pNf = std::move(overflow.front());
+					overflow.pop_front();
+					try
+					{
+						notify(pNf);
+					}
+					catch (...)
+					{
+						if (!overflow.empty())
+						{
+							// put back the rest, in front of newer notifications
+							std::lock_guard<std::mutex> lock(queue.overflowMutex);
+							queue.overflow.insert(queue.overflow.begin(), overflow.begin(), overflow.end());
+							queue.overflowed = true;
+						}
+						throw;
+					}
+				}
+			}
+		}
+		catch (Poco::Exception& ex)
 		{
-			// Observer is not registered anymore, remove its list
-			_workerIterator = _lists.erase(_workerIterator);
-			continue;
+			Poco::ErrorHandler::handle(ex);
+			more = true;
+		}
+		catch (std::exception& ex)
+		{
+			Poco::ErrorHandler::handle(ex);
+			more = true;
+		}
+		catch (...)
+		{
+			Poco::ErrorHandler::handle();
+			more = true;
 		}
-		auto n = l.front();
-		l.pop_front();
-		return { {o, n} };
 	}
-	_listsEmpty = true;
-	return {};
 }
 
+
 void AsyncNotificationCenter::dispatchNotifications(std::stop_token& stopToken, std::size_t workerId)
 {
 	while (!stopToken.stop_requested())
 	{
-		// get next observer and notification
-		auto no = nextNotification();
-		if (no.has_value())
+		ObserverQueuePtr pQueue;
 		{
-			auto [o, n] = *no;
-			o->notify(n);
-			continue;
+			std::unique_lock<std::mutex> lock(_readyMutex);
+			_readyCondition.wait(lock, [&stopToken, this] { return !_ready.empty() || stopToken.stop_requested(); });
+			if (stopToken.stop_requested())
+				break;
+			pQueue = std::move(_ready.front());
+			_ready.pop_front();
+		}
+
+		dispatchBatch(*pQueue);
+
+		if (pQueue->pending())
+		{
+			// Let other observers have their turn first.
+			schedule(pQueue);
+		}
+		else
+		{
+			pQueue->scheduled = false;
+			// A notification may have been added after pending() returned false,
+			// but before the flag was cleared, without scheduling the queue.
+			if (pQueue->pending() && !pQueue->scheduled.exchange(true))
+				schedule(pQueue);
 		}
-		// No notification available, wait for a while
-		std::unique_lock<std::mutex> lock(_listsMutex);
-		_listsEmptyCondition.wait_for(
-			lock, 1s,
-			[&stopToken, this] { return !_listsEmpty || stopToken.stop_requested(); }
-		);
-		if (stopToken.stop_requested())
-			break;
 	}
 }
 
@@ -0,0 +1,377 @@
+//
+// CRC.cpp
+//
+// Library: Foundation
+// Package: Core
+// Module:  CRC
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/CRC.h"
+#include <cstdint>
+#include <cstring>
+
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#define POCO_CRC_X64 1
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+		#define POCO_CRC_TARGET(t)
+	#else
+		#include <cpuid.h>
+		#define POCO_CRC_TARGET(t) __attribute__((target(t)))
+	#endif
+#elif defined(__ARM_FEATURE_CRC32)
+	#define POCO_CRC_ARMV8 1
+	#include <arm_acle.h>
+#endif
+
+
+namespace Poco {
+
+
+namespace
+{
+	//
+	// Table-driven implementation (slicing-by-8), for reflected polynomials.
+	//
+
+	class CRCTable
+	{
+	public:
+		explicit CRCTable(UInt32 polynomial)
+		{
+			for (UInt32 i = 0; i < 256; i++)
+			{
+				UInt32 crc = i;
+				for (int k = 0; k < 8; k++)
+				{
+					crc = (crc & 1) ? (crc >> 1) ^ polynomial : crc >> 1;
+				}
+				_table[0][i] = crc;
+			}
+			for (UInt32 i = 0; i < 256; i++)
+			{
+				for (int k = 1; k < 8; k++)
+				{
+					_table[k][i] = (_table[k - 1][i] >> 8) ^ _table[0][_table[k - 1][i] & 0xFF];
+				}
+			}
+		}
+
+		UInt32 update(UInt32 crc, const unsigned char* p, std::size_t n) const
+			/// Updates the given internal (inverted) CRC.
+		{
+			while (n >= 8)
+			{
+				UInt32 one = crc ^ (UInt32(p[0]) | (UInt32(p[1]) << 8) | (UInt32(p[2]) << 16) | (UInt32(p[3]) << 24));
+				UInt32 two = UInt32(p[4]) | (UInt32(p[5]) << 8) | (UInt32(p[6]) << 16) | (UInt32(p[7]) << 24);
+				crc = _table[7][one & 0xFF] ^ _table[6][(one >> 8) & 0xFF] ^ _table[5][(one >> 16) & 0xFF] ^ _table[4][one >> 24]
+				    ^ _table[3][two & 0xFF] ^ _table[2][(two >> 8) & 0xFF] ^ _table[1][(two >> 16) & 0xFF] ^ _table[0][two >> 24];
+				p += 8;
+				n -= 8;
+			}
+			while (n--)
+			{
+				crc = (crc >> 8) ^ _table[0][(crc ^ *p++) & 0xFF];
+			}
+			return crc;
+		}
+
+	private:
+		UInt32 _table[8][256];
+	};
+
+	const CRCTable& crc32Table()
+	{
+		static const CRCTable table(0xEDB88320);
+		return table;
+	}
+
+	const CRCTable& crc32cTable()
+	{
+		static const CRCTable table(0x82F63B78);
+		return table;
+	}
+
+	UInt32 crc32Generic(UInt32 crc, const unsigned char* p, std::size_t n)
+	{
+		return crc32Table().update(crc, p, n);
+	}
+
+	UInt32 crc32cGeneric(UInt32 crc, const unsigned char* p, std::size_t n)
+	{
+		return crc32cTable().update(crc, p, n);
+	}
+
+
+#if defined(POCO_CRC_X64)
+
+
+	//
+	// x64: CRC-32C using the SSE 4.2 CRC32 instruction.
+	//
+
+	POCO_CRC_TARGET("sse4.2")
+	UInt32 crc32cSSE42(UInt32 crc, const unsigned char* p, std::size_t n)
+	{
+		while (n > 0 && (reinterpret_cast<std::uintptr_t>(p) & 7) != 0)
+		{
+			crc = _mm_crc32_u8(crc, *p++);
+			n--;
+		}
+		UInt64 crc64 = crc;
+		while (n >= 32)
+		{
+			UInt64 v[4];
+			std::memcpy(v, p, sizeof(v));
+			crc64 = _mm_crc32_u64(crc64, v[0]);
+			crc64 = _mm_crc32_u64(crc64, v[1]);
+			crc64 = _mm_crc32_u64(crc64, v[2]);
+			crc64 = _mm_crc32_u64(crc64, v[3]);
+			p += 32;
+			n -= 32;
+		}
+		while (n >= 8)
+		{
+			UInt64 v;
+			std::memcpy(&v, p, sizeof(v));
+			crc64 = _mm_crc32_u64(crc64, v);
+			p += 8;
+			n -= 8;
+		}
+		crc = static_cast<UInt32>(crc64);
+		while (n-- > 0)
+		{
+			crc = _mm_crc32_u8(crc, *p++);
+		}
+		return crc;
+	}
+
+
+	//
+	// x64: CRC-32 by folding with carry-less multiplication, as described in
+	// "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction"
+	// (V. Gopal et al., Intel, 2009), with the constants for the bit-reflected
+	// CRC-32 polynomial. Requires n >= 64 and a multiple of 16.
+	//
+
+	POCO_CRC_TARGET("sse4.1,pclmul")
+	UInt32 crc32Fold(UInt32 crc, const unsigned char* p, std::size_t n)
+	{
+		alignas(16) static const UInt64 k1k2[] = {0x0154442bd4, 0x01c6e41596};
+		alignas(16) static const UInt64 k3k4[] = {0x01751997d0, 0x00ccaa009e};
+		alignas(16) static const UInt64 k5k0[] = {0x0163cd6124, 0x0000000000};
+		alignas(16) static const UInt64 poly[] = {0x01db710641, 0x01f7011641};
+
+		__m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+		x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x00));
+		x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x10));
+		x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x20));
+		x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x30));
+		x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+		x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+		p += 64;
+		n -= 64;
+
+		// fold four 128-bit lanes in parallel
+		while (n >= 64)
+		{
+			x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+			x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+			x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+			x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+			x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+			x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+			x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+			x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+			y5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x00));
+			y6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x10));
+			y7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x20));
+			y8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0x30));
+			x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+			x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+			x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+			x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+			p += 64;
+			n -= 64;
+		}
+
+		// fold the four lanes into one
+		x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+		x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+		// fold remaining 16 byte blocks
+		while (n >= 16)
+		{
+			x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+			x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+			x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+			p += 16;
+			n -= 16;
+		}
+
+		// fold 128 to 64 bits
+		x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+		x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+		x1 = _mm_srli_si128(x1, 8);
+		x1 = _mm_xor_si128(x1, x2);
+		x0 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+		x2 = _mm_srli_si128(x1, 4);
+		x1 = _mm_and_si128(x1, x3);
+		x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+		x1 = _mm_xor_si128(x1, x2);
+
+		// Barrett reduction to 32 bits
+		x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+		x2 = _mm_and_si128(x1, x3);
+		x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+		x2 = _mm_and_si128(x2, x3);
+		x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+		x1 = _mm_xor_si128(x1, x2);
+
+		return static_cast<UInt32>(_mm_extract_epi32(x1, 1));
+	}
+
+	UInt32 crc32PCLMUL(UInt32 crc, const unsigned char* p, std::size_t n)
+	{
+		if (n >= 64)
+		{
+			std::size_t blocks = n & ~std::size_t(15);
+			crc = crc32Fold(crc, p, blocks);
+			p += blocks;
+			n -= blocks;
+		}
+		return crc32Generic(crc, p, n);
+	}
+
+
+#elif defined(POCO_CRC_ARMV8)
+
+
+	//
+	// ARMv8: CRC-32 and CRC-32C using the CRC32 instructions.
+	//
+
+	UInt32 crc32ARMv8(UInt32 crc, const unsigned char* p, std::size_t n)
+	{
+		while (n >= 8)
+		{
+			UInt64 v;
+			std::memcpy(&v, p, sizeof(v));
+			crc = __crc32d(crc, v);
+			p += 8;
+			n -= 8;
+		}
+		while (n-- > 0)
+		{
+			crc = __crc32b(crc, *p++);
+		}
+		return crc;
+	}
+
+	UInt32 crc32cARMv8(UInt32 crc, const unsigned char* p, std::size_t n)
+	{
+		while (n >= 8)
+		{
+			UInt64 v;
+			std::memcpy(&v, p, sizeof(v));
+			crc = __crc32cd(crc, v);
+			p += 8;
+			n -= 8;
+		}
+		while (n-- > 0)
+		{
+			crc = __crc32cb(crc, *p++);
+		}
+		return crc;
+	}
+
+
+#endif
+
+
+	using CRCFunction = UInt32 (*)(UInt32, const unsigned char*, std::size_t);
+
+	struct CRCFunctions
+	{
+		CRCFunctions():
+			crc32(crc32Generic),
+			crc32c(crc32cGeneric)
+		{
+#if defined(POCO_CRC_X64)
+			unsigned ecx = 0;
+	#if defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 1);
+			ecx = static_cast<unsigned>(info[2]);
+	#else
+			unsigned eax, ebx, edx;
+			if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) ecx = 0;
+	#endif
+			const bool hasPCLMUL = (ecx & (1u << 1)) != 0;
+			const bool hasSSE41  = (ecx & (1u << 19)) != 0;
+			const bool hasSSE42  = (ecx & (1u << 20)) != 0;
+			if (hasPCLMUL && hasSSE41) crc32 = crc32PCLMUL;
+			if (hasSSE42) crc32c = crc32cSSE42;
+#elif defined(POCO_CRC_ARMV8)
+			crc32 = crc32ARMv8;
+			crc32c = crc32cARMv8;
+#endif
+		}
+
+		CRCFunction crc32;
+		CRCFunction crc32c;
+	};
+
+	const CRCFunctions& crcFunctions()
+	{
+		static const CRCFunctions functions;
+		return functions;
+	}
+}
+
+
+UInt32 CRC::crc32(UInt32 crc, const void* data, std::size_t length)
+{
+	if (length == 0) return crc;
+	return ~crcFunctions().crc32(~crc, static_cast<const unsigned char*>(data), length);
+}
+
+
+UInt32 CRC::crc32c(UInt32 crc, const void* data, std::size_t length)
+{
+	if (length == 0) return crc;
+	return ~crcFunctions().crc32c(~crc, static_cast<const unsigned char*>(data), length);
+}
+
+
+bool CRC::isCRC32Accelerated()
+{
+	return crcFunctions().crc32 != crc32Generic;
+}
+
+
+bool CRC::isCRC32CAccelerated()
+{
+	return crcFunctions().crc32c != crc32cGeneric;
+}
+
+
+} // namespace Poco
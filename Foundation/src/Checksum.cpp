@@ -13,6 +13,7 @@
 
 
 #include "Poco/Checksum.h"
+#include "Poco/CRC.h"
 #include <zlib.h>
 
 
@@ -21,7 +22,7 @@ namespace Poco {
 
 Checksum::Checksum():
 	_type(TYPE_CRC32),
-	_value(crc32(0L, nullptr, 0))
+	_value(0)
 {
 }
 
@@ -30,10 +31,7 @@ Checksum::Checksum(Type t):
 	_type(t),
 	_value(0)
 {
-	if (t == TYPE_CRC32)
-		_value = crc32(0L, nullptr, 0);
-	else
-		_value = adler32(0L, nullptr, 0);
+	reset();
 }
 
 
@@ -44,10 +42,27 @@ Checksum::~Checksum()
 
 void Checksum::update(const char* data, unsigned length)
 {
-	if (_type == TYPE_ADLER32)
+	switch (_type)
+	{
+	case TYPE_ADLER32:
 		_value = adler32(_value, reinterpret_cast<const Bytef*>(data), length);
+		break;
+	case TYPE_CRC32:
+		_value = CRC::crc32(_value, data, length);
+		break;
+	case TYPE_CRC32C:
+		_value = CRC::crc32c(_value, data, length);
+		break;
+	}
+}
+
+
+void Checksum::reset()
+{
+	if (_type == TYPE_ADLER32)
+		_value = adler32(0L, nullptr, 0);
 	else
-		_value = crc32(_value, reinterpret_cast<const Bytef*>(data), length);
+		_value = 0;
 }
 
 
@@ -0,0 +1,72 @@
+//
+// ChecksumEngine.cpp
+//
+// Library: Foundation
+// Package: Crypt
+// Module:  ChecksumEngine
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/ChecksumEngine.h"
+#include <limits>
+
+
+namespace Poco {
+
+
+ChecksumEngine::ChecksumEngine(Checksum::Type type):
+	_checksum(type)
+{
+	_digest.reserve(DIGEST_SIZE);
+}
+
+
+ChecksumEngine::~ChecksumEngine()
+{
+}
+
+
+void ChecksumEngine::updateImpl(const void* data, std::size_t length)
+{
+	const char* p = static_cast<const char*>(data);
+	while (length > 0)
+	{
+		unsigned n = length > std::numeric_limits<unsigned>::max() ? std::numeric_limits<unsigned>::max() : static_cast<unsigned>(length);
+		_checksum.update(p, n);
+		p += n;
+		length -= n;
+	}
+}
+
+
+std::size_t ChecksumEngine::digestLength() const
+{
+	return DIGEST_SIZE;
+}
+
+
+void ChecksumEngine::reset()
+{
+	_checksum.reset();
+}
+
+
+const DigestEngine::Digest& ChecksumEngine::digest()
+{
+	UInt32 value = _checksum.checksum();
+	_digest.clear();
+	_digest.push_back(static_cast<unsigned char>(value >> 24));
+	_digest.push_back(static_cast<unsigned char>(value >> 16));
+	_digest.push_back(static_cast<unsigned char>(value >> 8));
+	_digest.push_back(static_cast<unsigned char>(value));
+	reset();
+	return _digest;
+}
+
+
+} // namespace Poco
@@ -14,6 +14,10 @@
 
 #include "Poco/DeflatingStream.h"
 #include "Poco/Exception.h"
+#include "Poco/Environment.h"
+#include "Poco/WorkStealingThreadPool.h"
+#include <algorithm>
+#include <deque>
 #include <memory>
 #include <zlib.h>
 
@@ -21,11 +25,240 @@
 namespace Poco {
 
 
+//
+// DeflatingStreamBuf::ParallelDeflater
+//
+
+
+class DeflatingStreamBuf::ParallelDeflater
+	/// Compresses blocks of data concurrently in the default
+	/// WorkStealingThreadPool and writes them, in order, as
+	/// a single zlib or gzip stream.
+{
+public:
+	ParallelDeflater(std::ostream& ostr, StreamType type, int level, int threads, std::size_t blockSize):
+		_ostr(ostr),
+		_type(type),
+		_level(level),
+		_threads(threads > 0 ? threads : static_cast<int>(Environment::processorCount())),
+		_blockSize(std::max<std::size_t>(blockSize, DICTIONARY_SIZE)),
+		_check(type == STREAM_GZIP ? crc32(0, Z_NULL, 0) : adler32(0, Z_NULL, 0)),
+		_totalIn(0),
+		_headerWritten(false)
+	{
+		if (level < Z_DEFAULT_COMPRESSION || level > Z_BEST_COMPRESSION)
+			throw InvalidArgumentException("Invalid compression level");
+
+		_input.reserve(_blockSize);
+	}
+
+	int threads() const
+	{
+		return _threads;
+	}
+
+	void write(const char* buffer, std::size_t length)
+	{
+		while (length > 0)
+		{
+			std::size_t n = std::min(length, _blockSize - _input.size());
+			_input.append(buffer, n);
+			buffer += n;
+			length -= n;
+			if (_input.size() == _blockSize) submit(false);
+		}
+	}
+
+	void flush()
+		/// Compresses the data written so far, ending the compressed
+		/// data on a byte boundary, and writes it to the output stream.
+	{
+		if (!_input.empty()) submit(false);
+		while (!_pending.empty()) writeNext();
+	}
+
+	void finish()
+		/// Compresses the remaining data and writes the
+		/// end of the stream to the output stream.
+	{
+		submit(true);
+		while (!_pending.empty()) writeNext();
+
+		unsigned char trailer[8];
+		if (_type == STREAM_GZIP)
+		{
+			for (int i = 0; i < 4; i++) trailer[i] = static_cast<unsigned char>(_check >> (8*i));
+			for (int i = 0; i < 4; i++) trailer[4 + i] = static_cast<unsigned char>(_totalIn >> (8*i));
+			writeOutput(reinterpret_cast<const char*>(trailer), 8);
+		}
+		else
+		{
+			for (int i = 0; i < 4; i++) trailer[i] = static_cast<unsigned char>(_check >> (24 - 8*i));
+			writeOutput(reinterpret_cast<const char*>(trailer), 4);
+		}
+	}
+
+private:
+	enum
+	{
+		DICTIONARY_SIZE = 32768
+	};
+
+	struct Block
+	{
+		std::string data;
+		uLong check = 0;
+		std::size_t length = 0;
+	};
+
+	using Input = std::shared_ptr<const std::string>;
+
+	void submit(bool last)
+	{
+		Input pInput = std::make_shared<const std::string>(std::move(_input));
+		_input.clear();
+		_input.reserve(_blockSize);
+
+		Input pDictionary = _pDictionary;
+		int level = _level;
+		bool gzip = _type == STREAM_GZIP;
+		_pending.push_back(WorkStealingThreadPool::defaultPool().submit([pInput, pDictionary, level, gzip, last]()
+			{
+				return compress(*pInput, pDictionary.get(), level, gzip, last);
+			}));
+		_pDictionary = pInput;
+
+		while (_pending.size() >= static_cast<std::size_t>(_threads)) writeNext();
+	}
+
+	void writeNext()
+	{
+		Future<Block> future = std::move(_pending.front());
+		_pending.pop_front();
+		const Block& block = future.get();
+
+		if (!_headerWritten)
+		{
+			writeHeader();
+			_headerWritten = true;
+		}
+		writeOutput(block.data.data(), block.data.size());
+		if (_type == STREAM_GZIP)
+			_check = crc32_combine(_check, block.check, static_cast<z_off_t>(block.length));
+		else
+			_check = adler32_combine(_check, block.check, static_cast<z_off_t>(block.length));
+		_totalIn += block.length;
+	}
+
+	void writeHeader()
+	{
+		if (_type == STREAM_GZIP)
+		{
+			// no file name, no modification time, unknown operating system
+			const unsigned char extraFlags = _level == Z_BEST_COMPRESSION ? 2 : (_level == Z_BEST_SPEED ? 4 : 0);
+			const unsigned char header[10] = {0x1F, 0x8B, Z_DEFLATED, 0, 0, 0, 0, 0, extraFlags, 0xFF};
+			writeOutput(reinterpret_cast<const char*>(header), sizeof(header));
+		}
+		else
+		{
+			// 32K window, compression level hint as set by deflate()
+			unsigned cmf = 0x78;
+			unsigned flags = 0;
+			if (_level == Z_DEFAULT_COMPRESSION || _level == 6) flags = 2;
+			else if (_level >= 7) flags = 3;
+			else if (_level >= 2) flags = 1;
+			flags <<= 6;
+			flags += 31 - ((cmf << 8) + flags) % 31;
+			const unsigned char header[2] = {static_cast<unsigned char>(cmf), static_cast<unsigned char>(flags)};
+			writeOutput(reinterpret_cast<const char*>(header), sizeof(header));
+		}
+	}
+
+	void writeOutput(const char* data, std::size_t size)
+	{
+		_ostr.write(data, static_cast<std::streamsize>(size));
+		if (!_ostr.good()) throw IOException("Failed writing deflated data to output stream");
+	}
+
+	static Block compress(const std::string& input, const std::string* pDictionary, int level, bool gzip, bool last)
+		/// Compresses a block as raw deflate data. Unless it is the
+		/// last block, the compressed data ends on a byte boundary,
+		/// so that the blocks can simply be concatenated.
+	{
+		Block block;
+		block.length = input.size();
+		const Bytef* pInput = reinterpret_cast<const Bytef*>(input.data());
+		if (gzip)
+			block.check = crc32(crc32(0, Z_NULL, 0), pInput, static_cast<uInt>(input.size()));
+		else
+			block.check = adler32(adler32(0, Z_NULL, 0), pInput, static_cast<uInt>(input.size()));
+
+		z_stream zstr{};
+		int rc = deflateInit2(&zstr, level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+		if (rc != Z_OK) throw IOException(zError(rc));
+		try
+		{
+			if (pDictionary && !pDictionary->empty())
+			{
+				std::size_t n = std::min<std::size_t>(pDictionary->size(), DICTIONARY_SIZE);
+				rc = deflateSetDictionary(&zstr, reinterpret_cast<const Bytef*>(pDictionary->data() + pDictionary->size() - n), static_cast<uInt>(n));
+				if (rc != Z_OK) throw IOException(zError(rc));
+			}
+
+			// deflateBound() does not include the empty stored
+			// block appended by Z_SYNC_FLUSH.
+			block.data.resize(deflateBound(&zstr, static_cast<uLong>(input.size())) + 16);
+			zstr.next_in   = const_cast<Bytef*>(pInput);
+			zstr.avail_in  = static_cast<uInt>(input.size());
+			zstr.next_out  = reinterpret_cast<Bytef*>(&block.data[0]);
+			zstr.avail_out = static_cast<uInt>(block.data.size());
+			for (;;)
+			{
+				rc = deflate(&zstr, last ? Z_FINISH : Z_SYNC_FLUSH);
+				if (rc != Z_OK && rc != Z_STREAM_END && rc != Z_BUF_ERROR) throw IOException(zError(rc));
+				if (last ? rc == Z_STREAM_END : zstr.avail_out != 0) break;
+
+				std::size_t used = block.data.size() - zstr.avail_out;
+				block.data.resize(block.data.size() + DICTIONARY_SIZE);
+				zstr.next_out  = reinterpret_cast<Bytef*>(&block.data[used]);
+				zstr.avail_out = static_cast<uInt>(block.data.size() - used);
+			}
+			block.data.resize(block.data.size() - zstr.avail_out);
+		}
+		catch (...)
+		{
+			deflateEnd(&zstr);
+			throw;
+		}
+		deflateEnd(&zstr);
+		return block;
+	}
+
+	std::ostream& _ostr;
+	StreamType _type;
+	int _level;
+	int _threads;
+	std::size_t _blockSize;
+	std::string _input;
+	Input _pDictionary;
+	std::deque<Future<Block>> _pending;
+	uLong _check;
+	UInt64 _totalIn;
+	bool _headerWritten;
+};
+
+
+//
+// DeflatingStreamBuf
+//
+
+
 DeflatingStreamBuf::DeflatingStreamBuf(std::istream& istr, StreamType type, int level):
 	BufferedStreamBuf(STREAM_BUFFER_SIZE, std::ios::in),
 	_pIstr(&istr),
 	_pOstr(nullptr),
-	_eof(false)
+	_eof(false),
+	_pParallel(nullptr)
 {
 	std::unique_ptr<char[]> buffer(new char[DEFLATE_BUFFER_SIZE]);
 
@@ -45,7 +278,8 @@ DeflatingStreamBuf::DeflatingStreamBuf(std::istream& istr, int windowBits, int l
 	BufferedStreamBuf(STREAM_BUFFER_SIZE, std::ios::in),
 	_pIstr(&istr),
 	_pOstr(nullptr),
-	_eof(false)
+	_eof(false),
+	_pParallel(nullptr)
 {
 	std::unique_ptr<char[]> buffer(new char[DEFLATE_BUFFER_SIZE]);
 
@@ -65,7 +299,8 @@ DeflatingStreamBuf::DeflatingStreamBuf(std::ostream& ostr, StreamType type, int
 	BufferedStreamBuf(STREAM_BUFFER_SIZE, std::ios::out),
 	_pIstr(nullptr),
 	_pOstr(&ostr),
-	_eof(false)
+	_eof(false),
+	_pParallel(nullptr)
 {
 	std::unique_ptr<char[]> buffer(new char[DEFLATE_BUFFER_SIZE]);
 
@@ -85,7 +320,8 @@ DeflatingStreamBuf::DeflatingStreamBuf(std::ostream& ostr, int windowBits, int l
 	BufferedStreamBuf(STREAM_BUFFER_SIZE, std::ios::out),
 	_pIstr(nullptr),
 	_pOstr(&ostr),
-	_eof(false)
+	_eof(false),
+	_pParallel(nullptr)
 {
 	std::unique_ptr<char[]> buffer(new char[DEFLATE_BUFFER_SIZE]);
 
@@ -101,6 +337,36 @@ DeflatingStreamBuf::DeflatingStreamBuf(std::ostream& ostr, int windowBits, int l
 }
 
 
+DeflatingStreamBuf::DeflatingStreamBuf(std::ostream& ostr, StreamType type, int level, int threads, std::size_t blockSize):
+	BufferedStreamBuf(threads == 1 ? STREAM_BUFFER_SIZE : DEFLATE_BUFFER_SIZE, std::ios::out),
+	_pIstr(nullptr),
+	_pOstr(&ostr),
+	_buffer(nullptr),
+	_pZstr(nullptr),
+	_eof(false),
+	_pParallel(nullptr)
+{
+	if (threads == 1)
+	{
+		std::unique_ptr<char[]> buffer(new char[DEFLATE_BUFFER_SIZE]);
+
+		std::unique_ptr<z_stream> pZstr = std::make_unique<z_stream>(z_stream{});
+		int rc = deflateInit2(pZstr.get(), level, Z_DEFLATED, 15 + (type == STREAM_GZIP ? 16 : 0), 8, Z_DEFAULT_STRATEGY);
+		if (rc != Z_OK)
+		{
+			throw IOException(zError(rc));
+		}
+
+		_pZstr = pZstr.release();
+		_buffer = buffer.release();
+	}
+	else
+	{
+		_pParallel = new ParallelDeflater(ostr, type, level, threads, blockSize);
+	}
+}
+
+
 DeflatingStreamBuf::~DeflatingStreamBuf()
 {
 	try
@@ -110,9 +376,13 @@ DeflatingStreamBuf::~DeflatingStreamBuf()
 	catch (...)
 	{
 	}
+	delete _pParallel;
 	delete [] _buffer;
-	deflateEnd(_pZstr);
-	delete _pZstr;
+	if (_pZstr)
+	{
+		deflateEnd(_pZstr);
+		delete _pZstr;
+	}
 }
 
 
@@ -120,7 +390,14 @@ int DeflatingStreamBuf::close()
 {
 	BufferedStreamBuf::sync();
 	_pIstr = nullptr;
-	if (_pOstr)
+	if (_pOstr && _pParallel)
+	{
+		std::ostream* pOstr = _pOstr;
+		_pOstr = nullptr;
+		_pParallel->finish();
+		pOstr->flush();
+	}
+	else if (_pOstr)
 	{
 		if (_pZstr->next_out)
 		{
@@ -147,12 +424,22 @@ int DeflatingStreamBuf::close()
 }
 
 
+int DeflatingStreamBuf::threads() const
+{
+	return _pParallel ? _pParallel->threads() : 1;
+}
+
+
 int DeflatingStreamBuf::sync()
 {
 	if (BufferedStreamBuf::sync())
 		return -1;
 
-	if (_pOstr)
+	if (_pOstr && _pParallel)
+	{
+		_pParallel->flush();
+	}
+	else if (_pOstr)
 	{
 		if (_pZstr->next_out)
 		{
@@ -246,6 +533,12 @@ std::streamsize DeflatingStreamBuf::writeToDevice(const char* buffer, std::strea
 {
 	if (length == 0 || !_pOstr) return 0;
 
+	if (_pParallel)
+	{
+		_pParallel->write(buffer, static_cast<std::size_t>(length));
+		return length;
+	}
+
 	_pZstr->next_in   = (unsigned char*) buffer;
 	_pZstr->avail_in  = static_cast<unsigned>(length);
 	_pZstr->next_out  = (unsigned char*) _buffer;
@@ -288,6 +581,13 @@ DeflatingIOS::DeflatingIOS(std::ostream& ostr, int windowBits, int level):
 }
 
 
+DeflatingIOS::DeflatingIOS(std::ostream& ostr, DeflatingStreamBuf::StreamType type, int level, int threads, std::size_t blockSize):
+	_buf(ostr, type, level, threads, blockSize)
+{
+	poco_ios_init(&_buf);
+}
+
+
 DeflatingIOS::DeflatingIOS(std::istream& istr, DeflatingStreamBuf::StreamType type, int level):
 	_buf(istr, type, level)
 {
@@ -327,6 +627,13 @@ DeflatingOutputStream::DeflatingOutputStream(std::ostream& ostr, int windowBits,
 }
 
 
+DeflatingOutputStream::DeflatingOutputStream(std::ostream& ostr, DeflatingStreamBuf::StreamType type, int level, int threads, std::size_t blockSize):
+	std::ostream(&_buf),
+	DeflatingIOS(ostr, type, level, threads, blockSize)
+{
+}
+
+
 DeflatingOutputStream::~DeflatingOutputStream()
 {
 }
@@ -18,6 +18,7 @@
 #include "Poco/PurgeStrategy.h"
 #include "Poco/Message.h"
 #include "Poco/NumberParser.h"
+#include "Poco/NumberFormatter.h"
 #include "Poco/DateTimeFormatter.h"
 #include "Poco/DateTime.h"
 #include "Poco/LocalDateTime.h"
@@ -34,6 +35,7 @@ const std::string FileChannel::PROP_ROTATION     = "rotation";
 const std::string FileChannel::PROP_ARCHIVE      = "archive";
 const std::string FileChannel::PROP_TIMES        = "times";
 const std::string FileChannel::PROP_COMPRESS     = "compress";
+const std::string FileChannel::PROP_COMPRESSTHREADS = "compressThreads";
 const std::string FileChannel::PROP_PURGEAGE     = "purgeAge";
 const std::string FileChannel::PROP_PURGECOUNT   = "purgeCount";
 const std::string FileChannel::PROP_FLUSH        = "flush";
@@ -42,6 +44,7 @@ const std::string FileChannel::PROP_ROTATEONOPEN = "rotateOnOpen";
 FileChannel::FileChannel():
 	_times("utc"),
 	_compress(false),
+	_compressThreads(1),
 	_flush(false),
 	_rotateOnOpen(false),
 	_pFile(nullptr),
@@ -57,6 +60,7 @@ FileChannel::FileChannel(const std::string& path):
 	_path(path),
 	_times("utc"),
 	_compress(false),
+	_compressThreads(1),
 	_flush(false),
 	_rotateOnOpen(false),
 	_pFile(nullptr),
@@ -167,6 +171,8 @@ void FileChannel::setProperty(const std::string& name, const std::string& value)
 		setArchive(value);
 	else if (name == PROP_COMPRESS)
 		setCompress(value);
+	else if (name == PROP_COMPRESSTHREADS)
+		setCompressThreads(value);
 	else if (name == PROP_PURGEAGE)
 		setPurgeAge(value);
 	else if (name == PROP_PURGECOUNT)
@@ -192,6 +198,8 @@ std::string FileChannel::getProperty(const std::string& name) const
 		return _archive;
 	else if (name == PROP_COMPRESS)
 		return std::string(_compress ? "true" : "false");
+	else if (name == PROP_COMPRESSTHREADS)
+		return NumberFormatter::format(_compressThreads);
 	else if (name == PROP_PURGEAGE)
 		return _purgeAge;
 	else if (name == PROP_PURGECOUNT)
@@ -349,6 +357,7 @@ void FileChannel::setArchive(const std::string& archive)
 	else throw InvalidArgumentException("archive", archive);
 	delete _pArchiveStrategy;
 	pStrategy->compress(_compress);
+	pStrategy->compressThreads(_compressThreads);
 	pStrategy->setPurgeCallback([this]() { purge(); });
 	_pArchiveStrategy = pStrategy;
 	_archive = archive;
@@ -363,6 +372,16 @@ void FileChannel::setCompress(const std::string& compress)
 }
 
 
+void FileChannel::setCompressThreads(const std::string& threads)
+{
+	int n = NumberParser::parse(threads);
+	if (n < 0) throw InvalidArgumentException("compressThreads", threads);
+	_compressThreads = n;
+	if (_pArchiveStrategy)
+		_pArchiveStrategy->compressThreads(_compressThreads);
+}
+
+
 void FileChannel::setPurgeAge(const std::string& age)
 {
 	if (setNoPurge(age)) return;
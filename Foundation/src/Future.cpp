@@ -0,0 +1,160 @@
+//
+// Future.cpp
+//
+// Library: Foundation
+// Package: Threading
+// Module:  WorkStealingThreadPool
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Future.h"
+#include "Poco/WorkStealingThreadPool.h"
+#include <chrono>
+
+
+namespace Poco {
+namespace Impl {
+
+
+FutureStateBase::FutureStateBase(WorkStealingThreadPool* pPool):
+	_isReady(false),
+	_pPool(pPool)
+{
+}
+
+
+FutureStateBase::~FutureStateBase()
+{
+}
+
+
+bool FutureStateBase::isReady() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _isReady;
+}
+
+
+void FutureStateBase::wait() const
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	_readyCondition.wait(lock, [this]() { return _isReady; });
+}
+
+
+bool FutureStateBase::tryWait(long milliseconds) const
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	return _readyCondition.wait_for(lock, std::chrono::milliseconds(milliseconds), [this]() { return _isReady; });
+}
+
+
+void FutureStateBase::setException(std::exception_ptr pException)
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	if (_isReady) throw IllegalStateException("Promise already satisfied");
+	_pException = pException;
+	ready(lock);
+}
+
+
+std::exception_ptr FutureStateBase::exception() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _pException;
+}
+
+
+void FutureStateBase::rethrow() const
+{
+	std::exception_ptr pException = exception();
+	if (pException) std::rethrow_exception(pException);
+}
+
+
+void FutureStateBase::onReady(Continuation&& continuation)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (!_isReady)
+		{
+			_continuations.push_back(std::move(continuation));
+			return;
+		}
+	}
+	continuation();
+}
+
+
+void FutureStateBase::dispatch(Continuation&& continuation)
+{
+	if (_pPool)
+		_pPool->execute(std::move(continuation));
+	else
+		continuation();
+}
+
+
+WorkStealingThreadPool* FutureStateBase::pool() const
+{
+	return _pPool;
+}
+
+
+void FutureStateBase::ready(std::unique_lock<std::mutex>& lock)
+{
+	_isReady = true;
+	std::vector<Continuation> continuations;
+	continuations.swap(_continuations);
+	lock.unlock();
+	_readyCondition.notify_all();
+
+	for (auto& continuation: continuations)
+	{
+		continuation();
+	}
+}
+
+
+} // namespace Impl
+
+
+Future<void> whenAll(const std::vector<Future<void>>& futures)
+{
+	WorkStealingThreadPool* pPool = futures.empty() ? nullptr : futures.front().state().pool();
+	auto pResult = std::make_shared<Impl::FutureState<void>>(pPool);
+	if (futures.empty())
+	{
+		pResult->set();
+		return Future<void>(pResult);
+	}
+
+	auto pFutures = std::make_shared<std::vector<Future<void>>>(futures);
+	auto pRemaining = std::make_shared<std::atomic<std::size_t>>(futures.size());
+	for (const auto& future: *pFutures)
+	{
+		future.state().onReady([pResult, pFutures, pRemaining]()
+			{
+				if (pRemaining->fetch_sub(1) != 1) return;
+
+				for (const auto& f: *pFutures)
+				{
+					if (f._pState->exception())
+					{
+						pResult->setException(f._pState->exception());
+						return;
+					}
+				}
+				pResult->set();
+			});
+	}
+	return Future<void>(pResult);
+}
+
+
+} // namespace Poco
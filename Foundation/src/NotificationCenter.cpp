@@ -20,7 +20,10 @@
 namespace Poco {
 
 
-NotificationCenter::NotificationCenter() = default;
+NotificationCenter::NotificationCenter():
+	_observers(new ObserverSnapshot)
+{
+}
 
 
 NotificationCenter::~NotificationCenter()
@@ -41,7 +44,9 @@ void NotificationCenter::addObserver(const AbstractObserver& observer)
 	AbstractObserverPtr pObserver = observer.clone();
 	{
 		RWLock::ScopedWriteLock lock(_mutex);
-		_observers.push_back(pObserver);
+		ObserverList observers(_observers.get()->observers);
+		observers.push_back(pObserver);
+		publish(observers);
 	}
 
 	pObserver->start();
@@ -53,12 +58,14 @@ void NotificationCenter::removeObserver(const AbstractObserver& observer)
 	AbstractObserverPtr pObserverToDisable;
 	{
 		RWLock::ScopedWriteLock lock(_mutex);
-		for (auto it = _observers.begin(); it != _observers.end(); ++it)
+		ObserverList observers(_observers.get()->observers);
+		for (auto it = observers.begin(); it != observers.end(); ++it)
 		{
 			if (observer.equals(**it))
 			{
 				pObserverToDisable = std::move(*it);
-				_observers.erase(it);
+				observers.erase(it);
+				publish(observers);
 				break;
 			}
 		}
@@ -71,24 +78,26 @@ void NotificationCenter::removeObserver(const AbstractObserver& observer)
 
 bool NotificationCenter::hasObserver(const AbstractObserver& observer) const
 {
-	RWLock::ScopedReadLock lock(_mutex);
-	for (const auto& p: _observers)
+	ObserverSnapshotPtr pSnapshot = _observers.get();
+	for (const auto& p: pSnapshot->observers)
 		if (observer.equals(*p)) return true;
 
 	return false;
 }
 
 
+NotificationCenter::ObserverSnapshotPtr NotificationCenter::observerSnapshot() const
+{
+	return _observers.get();
+}
+
+
 NotificationCenter::ObserverList NotificationCenter::observersToNotify(const Notification::Ptr& pNotification) const
 {
-	ObserverList observers;
-	{
-		RWLock::ScopedReadLock lock(_mutex);
-		observers = _observers;
-	}
+	ObserverSnapshotPtr pSnapshot = _observers.get();
 
 	ObserverList ret;
-	for (auto& o : observers)
+	for (auto& o: pSnapshot->observers)
 	{
 		if (o->accepts(pNotification))
 			ret.push_back(o);
@@ -109,25 +118,39 @@ void NotificationCenter::notifyObservers(Notification::Ptr& pNotification)
 {
 	poco_check_ptr (pNotification);
 
-	ObserverList observers = observersToNotify(pNotification);
-	for (auto& p: observers)
-		p->notify(pNotification);
+	// The snapshot keeps all observers alive, even if they are
+	// removed by a handler during dispatch.
+	ObserverSnapshotPtr pSnapshot = _observers.get();
+	for (auto& p: pSnapshot->observers)
+	{
+		if (p->accepts(pNotification))
+			p->notify(pNotification);
+	}
+}
+
+
+void NotificationCenter::observersChanged(const ObserverSnapshotPtr&)
+{
 }
 
 
-bool NotificationCenter::hasObservers() const
+void NotificationCenter::publish(const ObserverList& observers)
 {
-	RWLock::ScopedReadLock lock(_mutex);
+	ObserverSnapshotPtr pSnapshot = new ObserverSnapshot(observers);
+	_observers.assign(pSnapshot);
+	observersChanged(pSnapshot);
+}
+
 
-	return !_observers.empty();
+bool NotificationCenter::hasObservers() const
+{
+	return !_observers.get()->observers.empty();
 }
 
 
 std::size_t NotificationCenter::countObservers() const
 {
-	RWLock::ScopedReadLock lock(_mutex);
-
-	return _observers.size();
+	return _observers.get()->observers.size();
 }
 
 
@@ -135,10 +158,8 @@ int NotificationCenter::backlog() const
 {
 	int cnt = 0;
 
-	_mutex.readLock();
-	ObserverList observersToCount(_observers);
-	_mutex.unlock();
-	for (const auto& p : observersToCount)
+	ObserverSnapshotPtr pSnapshot = _observers.get();
+	for (const auto& p: pSnapshot->observers)
 		cnt += p->backlog();
 
 	return cnt;
@@ -154,13 +175,15 @@ NotificationCenter& NotificationCenter::defaultCenter()
 
 void NotificationCenter::clear()
 {
-	ObserverList observers;
+	ObserverSnapshotPtr pSnapshot;
 	{
 		RWLock::ScopedWriteLock lock(_mutex);
-		_observers.swap(observers);
+		pSnapshot = _observers.get();
+		if (pSnapshot->observers.empty()) return;
+		publish(ObserverList());
 	}
 
-	for (auto& o: observers)
+	for (auto& o: pSnapshot->observers)
 		o->disable();
 }
 
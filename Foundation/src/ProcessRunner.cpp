@@ -14,6 +14,7 @@
 
 
 #include "Poco/ProcessRunner.h"
+#include "Poco/ProcessZygote.h"
 #include "Poco/PIDFile.h"
 #include "Poco/FileStream.h"
 #include "Poco/AutoPtr.h"
@@ -50,12 +51,14 @@ ProcessRunner::ProcessRunner(const std::string& cmd,
 		int options,
 		int timeout,
 		bool startProcess,
-		const Args& pidArgFmt): _cmd(cmd),
+		const Args& pidArgFmt,
+		ProcessZygote* pZygote): _cmd(cmd),
 			_args(args),
 			_pid(INVALID_PID),
 			_pidFile(pidFile),
 			_options(options),
 			_timeout(timeout),
+			_pZygote(pZygote),
 			_pPH(nullptr),
 			_started(false),
 			_rc(RESULT_UNKNOWN),
@@ -127,7 +130,10 @@ void ProcessRunner::run()
 	ProcessHandle* pPH = nullptr;
 	try
 	{
-		pPH = new ProcessHandle(Process::launch(_cmd, _args, _options));
+		if (_pZygote)
+			pPH = new ProcessHandle(_pZygote->launch(_cmd, _args, _options));
+		else
+			pPH = new ProcessHandle(Process::launch(_cmd, _args, _options));
 		errHandle = Error::last();
 
 		_pid = pPH->id();
@@ -0,0 +1,491 @@
+//
+// ProcessZygote.cpp
+//
+// Library: Foundation
+// Package: Processes
+// Module:  ProcessZygote
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/ProcessZygote.h"
+#include "Poco/ProcessOptions.h"
+#include "Poco/Exception.h"
+#include "Poco/Pipe.h"
+#if POCO_OS == POCO_OS_LINUX
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <sys/wait.h>
+#include <sched.h>
+#include <signal.h>
+#include <unistd.h>
+#include <climits>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+
+extern char** environ;
+
+
+#define POCO_HAVE_PROCESS_ZYGOTE 1
+#endif
+
+
+namespace Poco {
+
+
+#if defined(POCO_HAVE_PROCESS_ZYGOTE)
+
+
+namespace
+{
+	struct Request
+		/// Header of a launch request, followed by the given number of
+		/// bytes of zero-terminated strings: current directory, initial
+		/// directory, command and arguments, environment variables.
+		/// The redirected file descriptors are sent as ancillary data.
+	{
+		UInt32 size;
+		Int32 options;
+		UInt32 redirect;
+		UInt32 argCount;
+		UInt32 envCount;
+	};
+
+	struct Reply
+	{
+		Int32 pid;
+		Int32 error;
+	};
+
+	enum
+	{
+		REDIRECT_IN  = 1,
+		REDIRECT_OUT = 2,
+		REDIRECT_ERR = 4
+	};
+
+	const int MAX_FDS = 3;
+
+
+	bool sendBytes(int fd, const char* buffer, std::size_t length)
+	{
+		while (length > 0)
+		{
+			ssize_t n = ::send(fd, buffer, length, MSG_NOSIGNAL);
+			if (n < 0 && errno == EINTR) continue;
+			if (n <= 0) return false;
+			buffer += n;
+			length -= static_cast<std::size_t>(n);
+		}
+		return true;
+	}
+
+
+	bool receiveBytes(int fd, char* buffer, std::size_t length)
+	{
+		while (length > 0)
+		{
+			ssize_t n = ::recv(fd, buffer, length, 0);
+			if (n < 0 && errno == EINTR) continue;
+			if (n <= 0) return false;
+			buffer += n;
+			length -= static_cast<std::size_t>(n);
+		}
+		return true;
+	}
+
+
+	bool sendMessage(int fd, const std::string& message, const int* fds, int fdCount)
+		/// Sends the message, with the given file descriptors attached
+		/// to its first byte.
+	{
+		union
+		{
+			char buffer[CMSG_SPACE(MAX_FDS*sizeof(int))];
+			struct cmsghdr align;
+		} control;
+		std::memset(&control, 0, sizeof(control));
+
+		struct iovec iov;
+		iov.iov_base = const_cast<char*>(message.data());
+		iov.iov_len = message.size();
+		struct msghdr msg;
+		std::memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = &iov;
+		msg.msg_iovlen = 1;
+		if (fdCount > 0)
+		{
+			msg.msg_control = control.buffer;
+			msg.msg_controllen = CMSG_SPACE(fdCount*sizeof(int));
+			struct cmsghdr* pCmsg = CMSG_FIRSTHDR(&msg);
+			pCmsg->cmsg_level = SOL_SOCKET;
+			pCmsg->cmsg_type = SCM_RIGHTS;
+			pCmsg->cmsg_len = CMSG_LEN(fdCount*sizeof(int));
+			std::memcpy(CMSG_DATA(pCmsg), fds, fdCount*sizeof(int));
+		}
+		ssize_t n;
+		do
+		{
+			n = ::sendmsg(fd, &msg, MSG_NOSIGNAL);
+		}
+		while (n < 0 && errno == EINTR);
+		if (n <= 0) return false;
+		return sendBytes(fd, message.data() + n, message.size() - static_cast<std::size_t>(n));
+	}
+
+
+	bool receiveRequest(int fd, Request& request, std::vector<char>& data, int* fds, int& fdCount)
+		/// Receives a request and the file descriptors attached to it.
+		/// The file descriptors are created with FD_CLOEXEC set.
+	{
+		union
+		{
+			char buffer[CMSG_SPACE(MAX_FDS*sizeof(int))];
+			struct cmsghdr align;
+		} control;
+
+		struct iovec iov;
+		iov.iov_base = &request;
+		iov.iov_len = sizeof(request);
+		struct msghdr msg;
+		std::memset(&msg, 0, sizeof(msg));
+		msg.msg_iov = &iov;
+		msg.msg_iovlen = 1;
+		msg.msg_control = control.buffer;
+		msg.msg_controllen = sizeof(control.buffer);
+		ssize_t n;
+		do
+		{
+			n = ::recvmsg(fd, &msg, MSG_CMSG_CLOEXEC);
+		}
+		while (n < 0 && errno == EINTR);
+		if (n <= 0) return false;
+
+		fdCount = 0;
+		for (struct cmsghdr* pCmsg = CMSG_FIRSTHDR(&msg); pCmsg; pCmsg = CMSG_NXTHDR(&msg, pCmsg))
+		{
+			if (pCmsg->cmsg_level == SOL_SOCKET && pCmsg->cmsg_type == SCM_RIGHTS)
+			{
+				int count = static_cast<int>((pCmsg->cmsg_len - CMSG_LEN(0))/sizeof(int));
+				if (count > MAX_FDS - fdCount) count = MAX_FDS - fdCount;
+				std::memcpy(fds + fdCount, CMSG_DATA(pCmsg), count*sizeof(int));
+				fdCount += count;
+			}
+		}
+
+		if (!receiveBytes(fd, reinterpret_cast<char*>(&request) + n, sizeof(request) - static_cast<std::size_t>(n)))
+			return false;
+		data.resize(request.size);
+		return receiveBytes(fd, data.data(), data.size());
+	}
+
+
+	void closeDescriptors(int keepFd)
+		/// Closes all file descriptors other than stdin, stdout,
+		/// stderr and keepFd.
+	{
+#if defined(SYS_close_range)
+		if (keepFd < 3)
+		{
+			if (::syscall(SYS_close_range, 3, ~0U, 0) == 0) return;
+		}
+		else if ((keepFd == 3 || ::syscall(SYS_close_range, 3, keepFd - 1, 0) == 0) &&
+			::syscall(SYS_close_range, keepFd + 1, ~0U, 0) == 0)
+		{
+			return;
+		}
+#endif
+		// On some systems, sysconf(_SC_OPEN_MAX) returns a ridiculously high number.
+		const long CLOSE_FD_MAX = 100000;
+		long fdMax = sysconf(_SC_OPEN_MAX);
+		if (fdMax > CLOSE_FD_MAX) fdMax = CLOSE_FD_MAX;
+		for (long fd = 3; fd < fdMax; ++fd)
+		{
+			if (fd != keepFd) ::close(static_cast<int>(fd));
+		}
+	}
+
+
+	pid_t cloneParent()
+		/// Like fork(), but the new process becomes a sibling of the
+		/// calling process, i.e., a child of its parent.
+	{
+#if defined(__s390__) || defined(__s390x__)
+		return static_cast<pid_t>(::syscall(SYS_clone, 0, CLONE_PARENT | SIGCHLD, 0, 0, 0));
+#else
+		return static_cast<pid_t>(::syscall(SYS_clone, CLONE_PARENT | SIGCHLD, 0, 0, 0, 0));
+#endif
+	}
+
+
+	void execChild(int options, char** argv, char** envp, const char* currentDirectory, const char* initialDirectory, int inFd, int outFd, int errFd)
+		/// Sets up the new process and executes the command.
+		/// Only async-signal-safe functions may be called here.
+	{
+		if (*currentDirectory && ::chdir(currentDirectory) != 0)
+			_exit(PROCESS_EXIT_EXEC_FAILED);
+		if (*initialDirectory && ::chdir(initialDirectory) != 0)
+			_exit(PROCESS_EXIT_EXEC_FAILED);
+
+		environ = envp;
+
+		// The received file descriptors have FD_CLOEXEC set,
+		// so only the duplicates survive execvp().
+		if (inFd >= 0) ::dup2(inFd, STDIN_FILENO);
+		if (options & PROCESS_CLOSE_STDIN) ::close(STDIN_FILENO);
+		if (outFd >= 0) ::dup2(outFd, STDOUT_FILENO);
+		if (errFd >= 0) ::dup2(errFd, STDERR_FILENO);
+		if (options & PROCESS_CLOSE_STDOUT) ::close(STDOUT_FILENO);
+		if (options & PROCESS_CLOSE_STDERR) ::close(STDERR_FILENO);
+
+		if (options & PROCESS_KILL_TREE)
+		{
+			if (::setpgid(0, 0) != 0)
+				_exit(PROCESS_EXIT_SETPGID_FAILED);
+		}
+
+		::execvp(argv[0], argv);
+		_exit(PROCESS_EXIT_EXEC_FAILED);
+	}
+
+
+	void runZygote(int fd)
+		/// Main loop of the helper process. Exits when the
+		/// connection to the ProcessZygote is closed.
+	{
+		closeDescriptors(fd);
+
+		Request request;
+		std::vector<char> data;
+		std::vector<char*> strings;
+		while (true)
+		{
+			int fds[MAX_FDS];
+			int fdCount = 0;
+			if (!receiveRequest(fd, request, data, fds, fdCount)) break;
+
+			strings.clear();
+			std::size_t pos = 0;
+			while (pos < data.size())
+			{
+				strings.push_back(&data[pos]);
+				while (pos < data.size() && data[pos]) ++pos;
+				++pos;
+			}
+
+			Reply reply = {0, 0};
+			const std::size_t argStart = 2;
+			const std::size_t envStart = argStart + request.argCount;
+			if (data.empty() || data.back() != 0 || request.argCount == 0 || strings.size() != envStart + request.envCount)
+			{
+				reply.error = EINVAL;
+			}
+			else
+			{
+				int fdIndex = 0;
+				int inFd  = (request.redirect & REDIRECT_IN)  && fdIndex < fdCount ? fds[fdIndex++] : -1;
+				int outFd = (request.redirect & REDIRECT_OUT) && fdIndex < fdCount ? fds[fdIndex++] : -1;
+				int errFd = (request.redirect & REDIRECT_ERR) && fdIndex < fdCount ? fds[fdIndex++] : -1;
+
+				// argv and envp are null-terminated arrays within strings
+				strings.insert(strings.begin() + envStart, nullptr);
+				strings.push_back(nullptr);
+
+				pid_t pid = cloneParent();
+				if (pid == 0)
+				{
+					execChild(request.options, &strings[argStart], &strings[envStart + 1], strings[0], strings[1], inFd, outFd, errFd);
+				}
+				reply.pid = pid;
+				if (pid < 0) reply.error = errno;
+			}
+			for (int i = 0; i < fdCount; i++) ::close(fds[i]);
+
+			if (!sendBytes(fd, reinterpret_cast<const char*>(&reply), sizeof(reply))) break;
+		}
+		_exit(0);
+	}
+}
+
+
+ProcessZygote::ProcessZygote():
+	_fd(-1),
+	_pid(0)
+{
+	int fds[2];
+	if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0)
+		throw SystemException("Cannot create socket pair for process zygote");
+
+	pid_t pid = ::fork();
+	if (pid < 0)
+	{
+		::close(fds[0]);
+		::close(fds[1]);
+		throw SystemException("Cannot fork process zygote");
+	}
+	else if (pid == 0)
+	{
+		runZygote(fds[1]);
+	}
+	::close(fds[1]);
+	_fd = fds[0];
+	_pid = pid;
+}
+
+
+ProcessZygote::~ProcessZygote()
+{
+	if (_fd >= 0) ::close(_fd);
+	if (_pid > 0)
+	{
+		int rc;
+		do
+		{
+			rc = ::waitpid(_pid, nullptr, 0);
+		}
+		while (rc < 0 && errno == EINTR);
+	}
+}
+
+
+ProcessHandle ProcessZygote::launch(const std::string& command, const Args& args, const std::string& initialDirectory, Pipe* inPipe, Pipe* outPipe, Pipe* errPipe, const Env& env, int options)
+{
+	poco_assert (inPipe == nullptr || (inPipe != outPipe && inPipe != errPipe));
+
+	Request request;
+	request.options = options;
+	request.redirect = 0;
+	request.argCount = static_cast<UInt32>(args.size() + 1);
+	request.envCount = 0;
+
+	std::string message(sizeof(request), '\0');
+	char currentDirectory[PATH_MAX];
+	if (::getcwd(currentDirectory, sizeof(currentDirectory)))
+		message.append(currentDirectory);
+	message.append(1, '\0');
+	message.append(initialDirectory).append(1, '\0');
+	message.append(command).append(1, '\0');
+	for (const auto& a: args)
+	{
+		message.append(a).append(1, '\0');
+	}
+
+	// The new process gets the environment of the calling process,
+	// with the given variables added or replaced.
+	for (char** pp = environ; *pp; ++pp)
+	{
+		const char* pEq = std::strchr(*pp, '=');
+		std::string name(*pp, pEq ? pEq - *pp : std::strlen(*pp));
+		if (env.find(name) == env.end())
+		{
+			message.append(*pp).append(1, '\0');
+			request.envCount++;
+		}
+	}
+	for (const auto& p: env)
+	{
+		message.append(p.first).append(1, '=').append(p.second).append(1, '\0');
+		request.envCount++;
+	}
+
+	int fds[MAX_FDS];
+	int fdCount = 0;
+	if (inPipe)
+	{
+		request.redirect |= REDIRECT_IN;
+		fds[fdCount++] = inPipe->readHandle();
+	}
+	if (outPipe)
+	{
+		request.redirect |= REDIRECT_OUT;
+		fds[fdCount++] = outPipe->writeHandle();
+	}
+	if (errPipe)
+	{
+		request.redirect |= REDIRECT_ERR;
+		fds[fdCount++] = errPipe->writeHandle();
+	}
+	request.size = static_cast<UInt32>(message.size() - sizeof(request));
+	std::memcpy(&message[0], &request, sizeof(request));
+
+	Reply reply;
+	{
+		FastMutex::ScopedLock lock(_mutex);
+
+		if (_fd < 0 || !sendMessage(_fd, message, fds, fdCount) || !receiveBytes(_fd, reinterpret_cast<char*>(&reply), sizeof(reply)))
+		{
+			if (_fd >= 0)
+			{
+				::close(_fd);
+				_fd = -1;
+			}
+			throw SystemException("Process zygote is not running; cannot launch", command);
+		}
+	}
+	if (reply.error != 0)
+		throw SystemException("Cannot fork process for", command);
+
+	// See ProcessImpl::launchByForkExecImpl().
+	if (options & PROCESS_KILL_TREE)
+		::setpgid(reply.pid, reply.pid);
+
+	if (inPipe)  inPipe->close(Pipe::CLOSE_READ);
+	if (outPipe) outPipe->close(Pipe::CLOSE_WRITE);
+	if (errPipe) errPipe->close(Pipe::CLOSE_WRITE);
+	return ProcessHandle(new ProcessHandleImpl(reply.pid));
+}
+
+
+bool ProcessZygote::isSupported()
+{
+	return true;
+}
+
+
+#else
+
+
+ProcessZygote::ProcessZygote():
+	_fd(-1),
+	_pid(0)
+{
+}
+
+
+ProcessZygote::~ProcessZygote()
+{
+}
+
+
+ProcessHandle ProcessZygote::launch(const std::string& command, const Args& args, const std::string& initialDirectory, Pipe* inPipe, Pipe* outPipe, Pipe* errPipe, const Env& env, int options)
+{
+	return Process::launch(command, args, initialDirectory, inPipe, outPipe, errPipe, env, options);
+}
+
+
+bool ProcessZygote::isSupported()
+{
+	return false;
+}
+
+
+#endif
+
+
+ProcessHandle ProcessZygote::launch(const std::string& command, const Args& args, int options)
+{
+	std::string initialDirectory;
+	Env env;
+	return launch(command, args, initialDirectory, nullptr, nullptr, nullptr, env, options);
+}
+
+
+} // namespace Poco
@@ -33,6 +33,18 @@
 #endif
 
 
+#if defined(__GLIBC__) && !defined(POCO_NO_FORK_EXEC)
+#if __GLIBC_PREREQ(2, 34)
+// posix_spawn() is implemented with clone(CLONE_VM|CLONE_VFORK) since
+// glibc 2.24; posix_spawn_file_actions_addclosefrom_np() requires 2.34.
+#define POCO_HAVE_POSIX_SPAWN 1
+#include <spawn.h>
+#include <cstring>
+extern char** environ;
+#endif
+#endif
+
+
 namespace Poco {
 
 
@@ -183,7 +195,106 @@ ProcessHandleImpl* ProcessImpl::launchImpl(const std::string& command, const Arg
 		return launchByForkExecImpl(command, args, initialDirectory, inPipe, outPipe, errPipe, env, options);
 	}
 #else
-	return launchByForkExecImpl(command, args, initialDirectory, inPipe, outPipe, errPipe, env, options);
+	ProcessHandleImpl* pHandle = launchBySpawnImpl(command, args, initialDirectory, inPipe, outPipe, errPipe, env, options);
+	if (pHandle)
+		return pHandle;
+	else
+		return launchByForkExecImpl(command, args, initialDirectory, inPipe, outPipe, errPipe, env, options);
+#endif
+}
+
+
+ProcessHandleImpl* ProcessImpl::launchBySpawnImpl(const std::string& command, const ArgsImpl& args, const std::string& initialDirectory, Pipe* inPipe, Pipe* outPipe, Pipe* errPipe, const EnvImpl& env, int options)
+{
+#if defined(POCO_HAVE_POSIX_SPAWN)
+	// posix_spawnp() searches the PATH of the calling process, whereas
+	// execvp() in a forked child searches the PATH of the new environment.
+	if (env.find("PATH") != env.end()) return nullptr;
+
+	std::vector<char*> argv(args.size() + 2);
+	int i = 0;
+	argv[i++] = const_cast<char*>(command.c_str());
+	for (const auto& a: args)
+	{
+		argv[i++] = const_cast<char*>(a.c_str());
+	}
+	argv[i] = nullptr;
+
+	// The child gets the environment of the calling process,
+	// with the given variables added or replaced.
+	char** envp = environ;
+	std::vector<char> envChars;
+	std::vector<char*> envPtrs;
+	if (!env.empty())
+	{
+		for (char** pp = environ; *pp; ++pp)
+		{
+			const char* pEq = std::strchr(*pp, '=');
+			std::string name(*pp, pEq ? pEq - *pp : std::strlen(*pp));
+			if (env.find(name) == env.end()) envPtrs.push_back(*pp);
+		}
+		envChars = getEnvironmentVariablesBuffer(env);
+		char* p = &envChars[0];
+		while (*p)
+		{
+			envPtrs.push_back(p);
+			while (*p) ++p;
+			++p;
+		}
+		envPtrs.push_back(nullptr);
+		envp = &envPtrs[0];
+	}
+
+	posix_spawn_file_actions_t fileActions;
+	posix_spawnattr_t attr;
+	posix_spawn_file_actions_init(&fileActions);
+	posix_spawnattr_init(&attr);
+
+	// File actions are performed in the child in the order given,
+	// mirroring the steps of launchByForkExecImpl().
+	int rc = 0;
+	if (!initialDirectory.empty())
+		rc = posix_spawn_file_actions_addchdir_np(&fileActions, initialDirectory.c_str());
+	if (rc == 0 && inPipe)
+		rc = posix_spawn_file_actions_adddup2(&fileActions, inPipe->readHandle(), STDIN_FILENO);
+	if (rc == 0 && (options & PROCESS_CLOSE_STDIN))
+		rc = posix_spawn_file_actions_addclose(&fileActions, STDIN_FILENO);
+	if (rc == 0 && outPipe)
+		rc = posix_spawn_file_actions_adddup2(&fileActions, outPipe->writeHandle(), STDOUT_FILENO);
+	if (rc == 0 && errPipe)
+		rc = posix_spawn_file_actions_adddup2(&fileActions, errPipe->writeHandle(), STDERR_FILENO);
+	if (rc == 0 && (options & PROCESS_CLOSE_STDOUT))
+		rc = posix_spawn_file_actions_addclose(&fileActions, STDOUT_FILENO);
+	if (rc == 0 && (options & PROCESS_CLOSE_STDERR))
+		rc = posix_spawn_file_actions_addclose(&fileActions, STDERR_FILENO);
+	// close all open file descriptors other than stdin, stdout, stderr
+	if (rc == 0)
+		rc = posix_spawn_file_actions_addclosefrom_np(&fileActions, 3);
+	if (rc == 0 && (options & PROCESS_KILL_TREE))
+	{
+		rc = posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETPGROUP);
+		if (rc == 0) rc = posix_spawnattr_setpgroup(&attr, 0);
+	}
+
+	pid_t pid = -1;
+	if (rc == 0)
+		rc = posix_spawnp(&pid, argv[0], &fileActions, &attr, &argv[0], envp);
+
+	posix_spawnattr_destroy(&attr);
+	posix_spawn_file_actions_destroy(&fileActions);
+
+	// If the child could not be started (e.g., command not found,
+	// or a script without interpreter line, which execvp() runs
+	// with /bin/sh), no child process exists. Retry with fork/exec,
+	// which reports such errors with the child's exit code.
+	if (rc != 0) return nullptr;
+
+	if (inPipe)  inPipe->close(Pipe::CLOSE_READ);
+	if (outPipe) outPipe->close(Pipe::CLOSE_WRITE);
+	if (errPipe) errPipe->close(Pipe::CLOSE_WRITE);
+	return new ProcessHandleImpl(pid);
+#else
+	return nullptr;
 #endif
 }
 
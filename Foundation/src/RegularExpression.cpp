@@ -23,44 +23,117 @@
 namespace
 {
 	class MatchData
+		/// Match data shared by all RegularExpression objects
+		/// used by a thread, so that match data (and the backtracking
+		/// frames PCRE2 allocates with it) does not have to be created
+		/// for every match. Also holds the JIT stack for JIT compiled
+		/// patterns.
 	{
 	public:
-		MatchData(pcre2_code* code):
-			_match(pcre2_match_data_create_from_pattern(reinterpret_cast<pcre2_code*>(code), nullptr))
+		MatchData():
+			_match(nullptr),
+			_pairs(0),
+			_jitStack(nullptr),
+			_jitContext(nullptr)
 		{
-			if (!_match) throw Poco::RegularExpressionException("cannot create match data");
 		}
 
 		~MatchData()
 		{
 			if (_match) pcre2_match_data_free(_match);
+			if (_jitContext) pcre2_match_context_free(_jitContext);
+			if (_jitStack) pcre2_jit_stack_free(_jitStack);
 		}
 
-		std::uint32_t count() const
+		pcre2_match_data* get(std::uint32_t pairs)
 		{
-			return pcre2_get_ovector_count(_match);
+			if (pairs > _pairs)
+			{
+				pcre2_match_data* match = pcre2_match_data_create(pairs, nullptr);
+				if (!match) throw Poco::RegularExpressionException("cannot create match data");
+				if (_match) pcre2_match_data_free(_match);
+				_match = match;
+				_pairs = pairs;
+			}
+			return _match;
 		}
 
-		const PCRE2_SIZE* data() const
+		pcre2_match_context* jitContext()
 		{
-			return pcre2_get_ovector_pointer(_match);
+			if (!_jitContext)
+			{
+				_jitStack = pcre2_jit_stack_create(JIT_STACK_START_SIZE, JIT_STACK_MAX_SIZE, nullptr);
+				if (!_jitStack) throw Poco::RegularExpressionException("cannot create JIT stack");
+				_jitContext = pcre2_match_context_create(nullptr);
+				if (!_jitContext) throw Poco::RegularExpressionException("cannot create match context");
+				pcre2_jit_stack_assign(_jitContext, nullptr, _jitStack);
+			}
+			return _jitContext;
 		}
 
-		operator pcre2_match_data*()
+		static MatchData& forThread()
 		{
-			return _match;
+			static thread_local MatchData matchData;
+			return matchData;
 		}
 
 	private:
+		enum
+		{
+			JIT_STACK_START_SIZE = 32*1024,
+			JIT_STACK_MAX_SIZE   = 512*1024
+		};
+
+		MatchData(const MatchData&);
+		MatchData& operator = (const MatchData&);
+
 		pcre2_match_data* _match;
+		std::uint32_t _pairs;
+		pcre2_jit_stack* _jitStack;
+		pcre2_match_context* _jitContext;
 	};
+
+
+	const PCRE2_SIZE* execute(void* pcre, bool jit, std::uint32_t pairs, std::string_view subject, std::size_t offset, std::uint32_t options, int& rc)
+		/// Matches subject against the compiled pattern. Returns the
+		/// ovector, or a null pointer if there is no match.
+		/// The ovector is only valid until the next match in the
+		/// same thread.
+	{
+		MatchData& matchData = MatchData::forThread();
+		pcre2_match_data* match = matchData.get(pairs);
+		PCRE2_SPTR data = reinterpret_cast<PCRE2_SPTR>(subject.empty() ? "" : subject.data());
+		rc = pcre2_match(reinterpret_cast<pcre2_code*>(pcre), data, subject.size(), offset, options, match, jit ? matchData.jitContext() : nullptr);
+		if (rc == PCRE2_ERROR_NOMATCH)
+		{
+			return nullptr;
+		}
+		else if (rc == PCRE2_ERROR_BADOPTION)
+		{
+			throw Poco::RegularExpressionException("bad option");
+		}
+		else if (rc == 0)
+		{
+			throw Poco::RegularExpressionException("too many captured substrings");
+		}
+		else if (rc < 0)
+		{
+			PCRE2_UCHAR buffer[256];
+			pcre2_get_error_message(rc, buffer, sizeof(buffer));
+			throw Poco::RegularExpressionException(std::string(reinterpret_cast<char*>(buffer)));
+		}
+		return pcre2_get_ovector_pointer(match);
+	}
 }
 
 
 namespace Poco {
 
 
-RegularExpression::RegularExpression(const std::string& pattern, int options, bool /*study*/): _pcre(nullptr)
+RegularExpression::RegularExpression(const std::string& pattern, int options, bool /*study*/):
+	_pcre(nullptr),
+	_ovecPairs(0),
+	_jit(false)
 {
 	int errorCode;
 	PCRE2_SIZE errorOffset;
@@ -95,6 +168,15 @@ RegularExpression::RegularExpression(const std::string& pattern, int options, bo
 		throw RegularExpressionException(msg.str());
 	}
 
+	if (options & RE_JIT)
+	{
+		_jit = pcre2_jit_compile(reinterpret_cast<pcre2_code*>(_pcre), PCRE2_JIT_COMPLETE) == 0;
+	}
+
+	std::uint32_t captureCount = 0;
+	pcre2_pattern_info(reinterpret_cast<pcre2_code*>(_pcre), PCRE2_INFO_CAPTURECOUNT, &captureCount);
+	_ovecPairs = captureCount + 1;
+
 	pcre2_pattern_info(reinterpret_cast<pcre2_code*>(_pcre), PCRE2_INFO_NAMECOUNT, &nameCount);
 	pcre2_pattern_info(reinterpret_cast<pcre2_code*>(_pcre), PCRE2_INFO_NAMEENTRYSIZE, &nameEntrySize);
 	pcre2_pattern_info(reinterpret_cast<pcre2_code*>(_pcre), PCRE2_INFO_NAMETABLE, &nameTable);
@@ -114,67 +196,37 @@ RegularExpression::~RegularExpression()
 }
 
 
-int RegularExpression::match(const std::string& subject, std::string::size_type offset, Match& mtch, int options) const
+int RegularExpression::match(std::string_view subject, std::string::size_type offset, Match& mtch, int options) const
 {
 	poco_assert (offset <= subject.length());
 
-	MatchData matchData(reinterpret_cast<pcre2_code*>(_pcre));
-	int rc = pcre2_match(reinterpret_cast<pcre2_code*>(_pcre), reinterpret_cast<PCRE2_SPTR>(subject.c_str()), subject.size(), offset, matchOptions(options), matchData, nullptr);
-	if (rc == PCRE2_ERROR_NOMATCH)
+	int rc;
+	const PCRE2_SIZE* ovec = execute(_pcre, _jit, _ovecPairs, subject, offset, matchOptions(options), rc);
+	if (!ovec)
 	{
 		mtch.offset = std::string::npos;
 		mtch.length = 0;
 		return 0;
 	}
-	else if (rc == PCRE2_ERROR_BADOPTION)
-	{
-		throw RegularExpressionException("bad option");
-	}
-	else if (rc == 0)
-	{
-		throw RegularExpressionException("too many captured substrings");
-	}
-	else if (rc < 0)
-	{
-		PCRE2_UCHAR buffer[256];
-		pcre2_get_error_message(rc, buffer, sizeof(buffer));
-		throw RegularExpressionException(std::string(reinterpret_cast<char*>(buffer)));
-	}
-	const PCRE2_SIZE* ovec = matchData.data();
 	mtch.offset = (ovec[0] == PCRE2_UNSET) ? std::string::npos : ovec[0];
 	mtch.length = ovec[1] - mtch.offset;
 	return rc;
 }
 
 
-int RegularExpression::match(const std::string& subject, std::string::size_type offset, MatchVec& matches, int options) const
+int RegularExpression::match(std::string_view subject, std::string::size_type offset, MatchVec& matches, int options) const
 {
 	poco_assert (offset <= subject.length());
 
 	matches.clear();
 
-	MatchData matchData(reinterpret_cast<pcre2_code*>(_pcre));
-	int rc = pcre2_match(reinterpret_cast<pcre2_code*>(_pcre), reinterpret_cast<PCRE2_SPTR>(subject.c_str()), subject.size(), offset, matchOptions(options), matchData, nullptr);
-	if (rc == PCRE2_ERROR_NOMATCH)
+	int rc;
+	const PCRE2_SIZE* ovec = execute(_pcre, _jit, _ovecPairs, subject, offset, matchOptions(options), rc);
+	if (!ovec)
 	{
 		return 0;
 	}
-	else if (rc == PCRE2_ERROR_BADOPTION)
-	{
-		throw RegularExpressionException("bad option");
-	}
-	else if (rc == 0)
-	{
-		throw RegularExpressionException("too many captured substrings");
-	}
-	else if (rc < 0)
-	{
-		PCRE2_UCHAR buffer[256];
-		pcre2_get_error_message(rc, buffer, sizeof(buffer));
-		throw RegularExpressionException(std::string(reinterpret_cast<char*>(buffer)));
-	}
 	matches.reserve(rc);
-	const PCRE2_SIZE* ovec = matchData.data();
 	for (int i = 0; i < rc; ++i)
 	{
 		Match m;
@@ -203,7 +255,7 @@ bool RegularExpression::match(const std::string& subject, std::string::size_type
 }
 
 
-bool RegularExpression::match(const std::string& subject, std::string::size_type offset, int options) const
+bool RegularExpression::match(std::string_view subject, std::string::size_type offset, int options) const
 {
 	Match mtch;
 	match(subject, offset, mtch, options);
@@ -276,27 +328,12 @@ std::string::size_type RegularExpression::substOne(std::string& subject, std::st
 {
 	if (offset >= subject.length()) return std::string::npos;
 
-	MatchData matchData(reinterpret_cast<pcre2_code*>(_pcre));
-	int rc = pcre2_match(reinterpret_cast<pcre2_code*>(_pcre), reinterpret_cast<PCRE2_SPTR>(subject.c_str()), subject.size(), offset, matchOptions(options), matchData, nullptr);
-	if (rc == PCRE2_ERROR_NOMATCH)
+	int rc;
+	const PCRE2_SIZE* ovec = execute(_pcre, _jit, _ovecPairs, subject, offset, matchOptions(options), rc);
+	if (!ovec)
 	{
 		return std::string::npos;
 	}
-	else if (rc == PCRE2_ERROR_BADOPTION)
-	{
-		throw RegularExpressionException("bad option");
-	}
-	else if (rc == 0)
-	{
-		throw RegularExpressionException("too many captured substrings");
-	}
-	else if (rc < 0)
-	{
-		PCRE2_UCHAR buffer[256];
-		pcre2_get_error_message(rc, buffer, sizeof(buffer));
-		throw RegularExpressionException(std::string(reinterpret_cast<char*>(buffer)));
-	}
-	const PCRE2_SIZE* ovec = matchData.data();
 	std::string result;
 	std::string::size_type len = subject.length();
 	std::string::size_type pos = 0;
@@ -16,49 +16,59 @@
 
 
 #include "Poco/SHA1Engine.h"
+#include <atomic>
 #include <cstring>
 
 
-#ifdef POCO_ARCH_LITTLE_ENDIAN
-	#define SHA1_BYTE_REVERSE(x, y) byteReverse(x, y)
-#else
-	#define SHA1_BYTE_REVERSE(x, y)
+#if defined(__x86_64__) || defined(_M_X64)
+	#define POCO_SHA1_X64 1
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+		#define POCO_SHA1_TARGET(t)
+	#else
+		#include <cpuid.h>
+		#define POCO_SHA1_TARGET(t) __attribute__((target(t)))
+	#endif
+#elif defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO)
+	#define POCO_SHA1_ARMV8 1
+	#include <arm_neon.h>
 #endif
 
 
 namespace Poco {
 
 
-SHA1Engine::SHA1Engine()
+namespace
 {
-	_digest.reserve(16);
-	reset();
+	using TransformFunction = void (*)(UInt32* digest, const unsigned char* p, std::size_t blocks);
+		/// Processes the given number of 64 byte blocks.
+
+	TransformFunction transformFunction();
+		/// Returns the implementation for the CPU and the selected kernel.
+
+	std::atomic<int> kernel(SHA1Engine::KERNEL_AUTO);
+		/// The implementation selected with SHA1Engine::setKernel().
 }
 
 
-SHA1Engine::~SHA1Engine()
+SHA1Engine::SHA1Engine()
 {
+	_digest.reserve(16);
 	reset();
 }
 
 
-inline void SHA1Engine::byteReverse(UInt32* buffer, int byteCount)
+SHA1Engine::~SHA1Engine()
 {
-#ifdef POCO_ARCH_LITTLE_ENDIAN
-	byteCount /= sizeof(UInt32);
-	for(int count = 0; count < byteCount; count++)
-	{
-		UInt32 value = (buffer[ count ] << 16) | (buffer[ count ] >> 16);
-		buffer[count] = ((value & 0xFF00FF00L) >> 8) | ((value & 0x00FF00FFL) << 8);
-	}
-#endif // POCO_ARCH_LITTLE_ENDIAN
+	reset();
 }
 
 
 void SHA1Engine::updateImpl(const void* buffer_, std::size_t count)
 {
-	const BYTE* buffer = (const BYTE*) buffer_;
-	BYTE* db = (BYTE*) &_context.data[0];
+	const BYTE* buffer = static_cast<const BYTE*>(buffer_);
+	BYTE* db = reinterpret_cast<BYTE*>(&_context.data[0]);
 
 	/* Update bitcount */
 	if ((_context.countLo + ((UInt32) count << 3)) < _context.countLo)
@@ -66,18 +76,31 @@ void SHA1Engine::updateImpl(const void* buffer_, std::size_t count)
 	_context.countLo += ((UInt32) count << 3);
 	_context.countHi += ((UInt32 ) count >> 29);
 
-	/* Process data in BLOCK_SIZE chunks */
-	while (count-- > 0)
+	/* Complete a partial block */
+	if (_context.slop > 0)
 	{
-		db[_context.slop++] = *(buffer++);
-		if (_context.slop == BLOCK_SIZE)
-		{
-			/* transform this one block */
-			SHA1_BYTE_REVERSE(_context.data, BLOCK_SIZE);
-			transform();
-			_context.slop = 0 ;	/* no slop left */
-		}
+		std::size_t n = BLOCK_SIZE - _context.slop;
+		if (n > count) n = count;
+		std::memcpy(db + _context.slop, buffer, n);
+		_context.slop += static_cast<UInt32>(n);
+		buffer += n;
+		count -= n;
+		if (_context.slop < BLOCK_SIZE) return;
+		transformFunction()(_context.digest, db, 1);
+		_context.slop = 0;
 	}
+
+	/* Process full blocks directly from the buffer */
+	if (count >= BLOCK_SIZE)
+	{
+		transformFunction()(_context.digest, buffer, count/BLOCK_SIZE);
+		buffer += count - count % BLOCK_SIZE;
+		count %= BLOCK_SIZE;
+	}
+
+	/* Save the remaining bytes */
+	std::memcpy(db, buffer, count);
+	_context.slop = static_cast<UInt32>(count);
 }
 
 
@@ -103,45 +126,26 @@ void SHA1Engine::reset()
 
 const DigestEngine::Digest& SHA1Engine::digest()
 {
-	int count;
 	UInt32 lowBitcount  = _context.countLo;
 	UInt32 highBitcount = _context.countHi;
 
-	/* Compute number of bytes mod 64 */
-	count = (int) ((_context.countLo >> 3) & 0x3F);
-
-	/* Set the first char of padding to 0x80.  This is safe since there is
-		always at least one byte free */
-	((BYTE*) _context.data)[count++] = 0x80;
-
-	/* Pad out to 56 mod 64 */
-	if (count > 56)
-	{
-		/* Two lots of padding:  Pad the first block to 64 bytes */
-		std::memset((BYTE*) &_context.data + count, 0, 64 - count);
-		SHA1_BYTE_REVERSE(_context.data, BLOCK_SIZE);
-		transform();
+	/* Pad out to 56 mod 64, starting with a single 1 bit */
+	static const BYTE padding[BLOCK_SIZE] = { 0x80 };
+	std::size_t count = (lowBitcount >> 3) & 0x3F;
+	updateImpl(padding, count < 56 ? 56 - count : 120 - count);
 
-		/* Now fill the next block with 56 bytes */
-		std::memset(&_context.data, 0, 56);
-	}
-	else
+	/* Append length in bits and transform */
+	BYTE length[8];
+	for (int i = 0; i < 4; i++)
 	{
-		/* Pad block to 56 bytes */
-		std::memset((BYTE*) &_context.data + count, 0, 56 - count);
+		length[i]     = static_cast<BYTE>(highBitcount >> (24 - 8*i));
+		length[4 + i] = static_cast<BYTE>(lowBitcount >> (24 - 8*i));
 	}
-	SHA1_BYTE_REVERSE(_context.data, BLOCK_SIZE);
-
-	/* Append length in bits and transform */
-	_context.data[14] = highBitcount;
-	_context.data[15] = lowBitcount;
-
-	transform();
-	SHA1_BYTE_REVERSE(_context.data, DIGEST_SIZE);
+	updateImpl(length, sizeof(length));
 
 	unsigned char hash[DIGEST_SIZE];
-	for (count = 0; count < DIGEST_SIZE; count++)
-		hash[count] = (BYTE) ((_context.digest[count>>2]) >> (8*(3-(count & 0x3)))) & 0xff;
+	for (int i = 0; i < DIGEST_SIZE; i++)
+		hash[i] = (BYTE) ((_context.digest[i>>2]) >> (8*(3-(i & 0x3)))) & 0xff;
 	_digest.clear();
 #if defined(POCO_COMPILER_GCC)
 	#pragma GCC diagnostic push
@@ -224,67 +228,352 @@ typedef UInt32 UL;	/* to save space */
 }
 
 
-void SHA1Engine::transform()
+namespace
+{
+	//
+	// Portable implementation
+	//
+
+	void transformBlock(UInt32* digest, const unsigned char* p)
+	{
+		UInt32 W[80];
+		UInt32 temp;
+		UInt32 A, B, C, D, E;
+		int i;
+
+		/* Step A.  Copy the data buffer into the local work buffer */
+		for( i = 0; i < 16; i++ )
+			W[ i ] = (UInt32(p[4*i]) << 24) | (UInt32(p[4*i + 1]) << 16) | (UInt32(p[4*i + 2]) << 8) | UInt32(p[4*i + 3]);
+
+		/* Step B.  Expand the 16 words into 64 temporary data words */
+		expand( 16 ); expand( 17 ); expand( 18 ); expand( 19 ); expand( 20 );
+		expand( 21 ); expand( 22 ); expand( 23 ); expand( 24 ); expand( 25 );
+		expand( 26 ); expand( 27 ); expand( 28 ); expand( 29 ); expand( 30 );
+		expand( 31 ); expand( 32 ); expand( 33 ); expand( 34 ); expand( 35 );
+		expand( 36 ); expand( 37 ); expand( 38 ); expand( 39 ); expand( 40 );
+		expand( 41 ); expand( 42 ); expand( 43 ); expand( 44 ); expand( 45 );
+		expand( 46 ); expand( 47 ); expand( 48 ); expand( 49 ); expand( 50 );
+		expand( 51 ); expand( 52 ); expand( 53 ); expand( 54 ); expand( 55 );
+		expand( 56 ); expand( 57 ); expand( 58 ); expand( 59 ); expand( 60 );
+		expand( 61 ); expand( 62 ); expand( 63 ); expand( 64 ); expand( 65 );
+		expand( 66 ); expand( 67 ); expand( 68 ); expand( 69 ); expand( 70 );
+		expand( 71 ); expand( 72 ); expand( 73 ); expand( 74 ); expand( 75 );
+		expand( 76 ); expand( 77 ); expand( 78 ); expand( 79 );
+
+		/* Step C.  Set up first buffer */
+		A = digest[ 0 ];
+		B = digest[ 1 ];
+		C = digest[ 2 ];
+		D = digest[ 3 ];
+		E = digest[ 4 ];
+
+		/* Step D.  Serious mangling, divided into four sub-rounds */
+		subRound1( 0 ); subRound1( 1 ); subRound1( 2 ); subRound1( 3 );
+		subRound1( 4 ); subRound1( 5 ); subRound1( 6 ); subRound1( 7 );
+		subRound1( 8 ); subRound1( 9 ); subRound1( 10 ); subRound1( 11 );
+		subRound1( 12 ); subRound1( 13 ); subRound1( 14 ); subRound1( 15 );
+		subRound1( 16 ); subRound1( 17 ); subRound1( 18 ); subRound1( 19 );
+		subRound2( 20 ); subRound2( 21 ); subRound2( 22 ); subRound2( 23 );
+		subRound2( 24 ); subRound2( 25 ); subRound2( 26 ); subRound2( 27 );
+		subRound2( 28 ); subRound2( 29 ); subRound2( 30 ); subRound2( 31 );
+		subRound2( 32 ); subRound2( 33 ); subRound2( 34 ); subRound2( 35 );
+		subRound2( 36 ); subRound2( 37 ); subRound2( 38 ); subRound2( 39 );
+		subRound3( 40 ); subRound3( 41 ); subRound3( 42 ); subRound3( 43 );
+		subRound3( 44 ); subRound3( 45 ); subRound3( 46 ); subRound3( 47 );
+		subRound3( 48 ); subRound3( 49 ); subRound3( 50 ); subRound3( 51 );
+		subRound3( 52 ); subRound3( 53 ); subRound3( 54 ); subRound3( 55 );
+		subRound3( 56 ); subRound3( 57 ); subRound3( 58 ); subRound3( 59 );
+		subRound4( 60 ); subRound4( 61 ); subRound4( 62 ); subRound4( 63 );
+		subRound4( 64 ); subRound4( 65 ); subRound4( 66 ); subRound4( 67 );
+		subRound4( 68 ); subRound4( 69 ); subRound4( 70 ); subRound4( 71 );
+		subRound4( 72 ); subRound4( 73 ); subRound4( 74 ); subRound4( 75 );
+		subRound4( 76 ); subRound4( 77 ); subRound4( 78 ); subRound4( 79 );
+
+		/* Step E.  Build message digest */
+		digest[ 0 ] += A;
+		digest[ 1 ] += B;
+		digest[ 2 ] += C;
+		digest[ 3 ] += D;
+		digest[ 4 ] += E;
+	}
+
+
+	void transformGeneric(UInt32* digest, const unsigned char* p, std::size_t blocks)
+	{
+		for (; blocks > 0; blocks--, p += 64)
+		{
+			transformBlock(digest, p);
+		}
+	}
+}
+
+
+#if defined(POCO_SHA1_X64)
+
+
+namespace
+{
+	//
+	// x86/x64 SHA extensions (SHA-NI)
+	//
+
+	POCO_SHA1_TARGET("sha,ssse3,sse4.1")
+	void transformSHANI(UInt32* digest, const unsigned char* p, std::size_t blocks)
+	{
+		const __m128i mask = _mm_set_epi64x(0x0001020304050607LL, 0x08090A0B0C0D0E0FLL);
+		__m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digest)), 0x1B);
+		__m128i e0 = _mm_set_epi32(static_cast<int>(digest[4]), 0, 0, 0);
+		__m128i e1;
+		__m128i msg0, msg1, msg2, msg3;
+		for (; blocks > 0; blocks--, p += 64)
+		{
+			const __m128i abcdSave = abcd;
+			const __m128i e0Save = e0;
+
+			msg0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0)), mask);
+			e0 = _mm_add_epi32(e0, msg0);
+			e1 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+			msg1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)), mask);
+			e1 = _mm_sha1nexte_epu32(e1, msg1);
+			e0 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+			msg2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 32)), mask);
+			e0 = _mm_sha1nexte_epu32(e0, msg2);
+			e1 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+			msg3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 48)), mask);
+			e1 = _mm_sha1nexte_epu32(e1, msg3);
+			e0 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 0);
+			msg0 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg0, msg1), msg2), msg3);
+			e0 = _mm_sha1nexte_epu32(e0, msg0);
+			e1 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+			msg1 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg1, msg2), msg3), msg0);
+			e1 = _mm_sha1nexte_epu32(e1, msg1);
+			e0 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+			msg2 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg2, msg3), msg0), msg1);
+			e0 = _mm_sha1nexte_epu32(e0, msg2);
+			e1 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+			msg3 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg3, msg0), msg1), msg2);
+			e1 = _mm_sha1nexte_epu32(e1, msg3);
+			e0 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+			msg0 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg0, msg1), msg2), msg3);
+			e0 = _mm_sha1nexte_epu32(e0, msg0);
+			e1 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 1);
+			msg1 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg1, msg2), msg3), msg0);
+			e1 = _mm_sha1nexte_epu32(e1, msg1);
+			e0 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 1);
+			msg2 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg2, msg3), msg0), msg1);
+			e0 = _mm_sha1nexte_epu32(e0, msg2);
+			e1 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+			msg3 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg3, msg0), msg1), msg2);
+			e1 = _mm_sha1nexte_epu32(e1, msg3);
+			e0 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+			msg0 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg0, msg1), msg2), msg3);
+			e0 = _mm_sha1nexte_epu32(e0, msg0);
+			e1 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+			msg1 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg1, msg2), msg3), msg0);
+			e1 = _mm_sha1nexte_epu32(e1, msg1);
+			e0 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 2);
+			msg2 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg2, msg3), msg0), msg1);
+			e0 = _mm_sha1nexte_epu32(e0, msg2);
+			e1 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 2);
+			msg3 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg3, msg0), msg1), msg2);
+			e1 = _mm_sha1nexte_epu32(e1, msg3);
+			e0 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+			msg0 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg0, msg1), msg2), msg3);
+			e0 = _mm_sha1nexte_epu32(e0, msg0);
+			e1 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+			msg1 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg1, msg2), msg3), msg0);
+			e1 = _mm_sha1nexte_epu32(e1, msg1);
+			e0 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+			msg2 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg2, msg3), msg0), msg1);
+			e0 = _mm_sha1nexte_epu32(e0, msg2);
+			e1 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e0, 3);
+			msg3 = _mm_sha1msg2_epu32(_mm_xor_si128(_mm_sha1msg1_epu32(msg3, msg0), msg1), msg2);
+			e1 = _mm_sha1nexte_epu32(e1, msg3);
+			e0 = abcd;
+			abcd = _mm_sha1rnds4_epu32(abcd, e1, 3);
+
+			e0 = _mm_sha1nexte_epu32(e0, e0Save);
+			abcd = _mm_add_epi32(abcd, abcdSave);
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(digest), _mm_shuffle_epi32(abcd, 0x1B));
+		digest[4] = static_cast<UInt32>(_mm_extract_epi32(e0, 3));
+	}
+
+
+	bool hasSHANI()
+	{
+#if defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7) return false;
+		__cpuid(info, 1);
+		const bool hasSSSE3 = (info[2] & (1 << 9)) != 0;
+		const bool hasSSE41 = (info[2] & (1 << 19)) != 0;
+		__cpuidex(info, 7, 0);
+		return hasSSSE3 && hasSSE41 && (info[1] & (1 << 29)) != 0;
+#else
+		unsigned eax, ebx, ecx, edx;
+		if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return false;
+		const bool hasSSSE3 = (ecx & (1u << 9)) != 0;
+		const bool hasSSE41 = (ecx & (1u << 19)) != 0;
+		if (!hasSSSE3 || !hasSSE41 || __get_cpuid_max(0, nullptr) < 7) return false;
+		__cpuid_count(7, 0, eax, ebx, ecx, edx);
+		return (ebx & (1u << 29)) != 0;
+#endif
+	}
+}
+
+
+#elif defined(POCO_SHA1_ARMV8)
+
+
+namespace
+{
+	//
+	// ARMv8 cryptography extensions
+	//
+
+	void transformARMv8(UInt32* digest, const unsigned char* p, std::size_t blocks)
+	{
+		const uint32x4_t k0 = vdupq_n_u32(0x5A827999);
+		const uint32x4_t k1 = vdupq_n_u32(0x6ED9EBA1);
+		const uint32x4_t k2 = vdupq_n_u32(0x8F1BBCDC);
+		const uint32x4_t k3 = vdupq_n_u32(0xCA62C1D6);
+		uint32x4_t abcd = vld1q_u32(digest);
+		uint32_t e0 = digest[4];
+		uint32_t e1;
+		uint32x4_t msg0, msg1, msg2, msg3;
+		for (; blocks > 0; blocks--, p += 64)
+		{
+			const uint32x4_t abcdSave = abcd;
+			const uint32_t e0Save = e0;
+
+			msg0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(p + 0)));
+			e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1cq_u32(abcd, e0, vaddq_u32(msg0, k0));
+			msg1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(p + 16)));
+			e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1cq_u32(abcd, e1, vaddq_u32(msg1, k0));
+			msg2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(p + 32)));
+			e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1cq_u32(abcd, e0, vaddq_u32(msg2, k0));
+			msg3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(p + 48)));
+			e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1cq_u32(abcd, e1, vaddq_u32(msg3, k0));
+			msg0 = vsha1su1q_u32(vsha1su0q_u32(msg0, msg1, msg2), msg3);
+			e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1cq_u32(abcd, e0, vaddq_u32(msg0, k0));
+			msg1 = vsha1su1q_u32(vsha1su0q_u32(msg1, msg2, msg3), msg0);
+			e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1pq_u32(abcd, e1, vaddq_u32(msg1, k1));
+			msg2 = vsha1su1q_u32(vsha1su0q_u32(msg2, msg3, msg0), msg1);
+			e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1pq_u32(abcd, e0, vaddq_u32(msg2, k1));
+			msg3 = vsha1su1q_u32(vsha1su0q_u32(msg3, msg0, msg1), msg2);
+			e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1pq_u32(abcd, e1, vaddq_u32(msg3, k1));
+			msg0 = vsha1su1q_u32(vsha1su0q_u32(msg0, msg1, msg2), msg3);
+			e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1pq_u32(abcd, e0, vaddq_u32(msg0, k1));
+			msg1 = vsha1su1q_u32(vsha1su0q_u32(msg1, msg2, msg3), msg0);
+			e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1pq_u32(abcd, e1, vaddq_u32(msg1, k1));
+			msg2 = vsha1su1q_u32(vsha1su0q_u32(msg2, msg3, msg0), msg1);
+			e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1mq_u32(abcd, e0, vaddq_u32(msg2, k2));
+			msg3 = vsha1su1q_u32(vsha1su0q_u32(msg3, msg0, msg1), msg2);
+			e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1mq_u32(abcd, e1, vaddq_u32(msg3, k2));
+			msg0 = vsha1su1q_u32(vsha1su0q_u32(msg0, msg1, msg2), msg3);
+			e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1mq_u32(abcd, e0, vaddq_u32(msg0, k2));
+			msg1 = vsha1su1q_u32(vsha1su0q_u32(msg1, msg2, msg3), msg0);
+			e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1mq_u32(abcd, e1, vaddq_u32(msg1, k2));
+			msg2 = vsha1su1q_u32(vsha1su0q_u32(msg2, msg3, msg0), msg1);
+			e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1mq_u32(abcd, e0, vaddq_u32(msg2, k2));
+			msg3 = vsha1su1q_u32(vsha1su0q_u32(msg3, msg0, msg1), msg2);
+			e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1pq_u32(abcd, e1, vaddq_u32(msg3, k3));
+			msg0 = vsha1su1q_u32(vsha1su0q_u32(msg0, msg1, msg2), msg3);
+			e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1pq_u32(abcd, e0, vaddq_u32(msg0, k3));
+			msg1 = vsha1su1q_u32(vsha1su0q_u32(msg1, msg2, msg3), msg0);
+			e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1pq_u32(abcd, e1, vaddq_u32(msg1, k3));
+			msg2 = vsha1su1q_u32(vsha1su0q_u32(msg2, msg3, msg0), msg1);
+			e1 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1pq_u32(abcd, e0, vaddq_u32(msg2, k3));
+			msg3 = vsha1su1q_u32(vsha1su0q_u32(msg3, msg0, msg1), msg2);
+			e0 = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+			abcd = vsha1pq_u32(abcd, e1, vaddq_u32(msg3, k3));
+
+			e0 += e0Save;
+			abcd = vaddq_u32(abcd, abcdSave);
+		}
+		vst1q_u32(digest, abcd);
+		digest[4] = e0;
+	}
+}
+
+
+#endif
+
+
+namespace
+{
+	TransformFunction transformFunction()
+	{
+		static const TransformFunction function = []() -> TransformFunction
+		{
+#if defined(POCO_SHA1_X64)
+			if (hasSHANI()) return transformSHANI;
+#elif defined(POCO_SHA1_ARMV8)
+			return transformARMv8;
+#endif
+			return transformGeneric;
+		}();
+		if (kernel.load(std::memory_order_relaxed) == SHA1Engine::KERNEL_GENERIC) return transformGeneric;
+		return function;
+	}
+}
+
+
+bool SHA1Engine::isAccelerated()
+{
+	return transformFunction() != transformGeneric;
+}
+
+
+void SHA1Engine::setKernel(Kernel k)
+{
+	kernel.store(k, std::memory_order_relaxed);
+}
+
+
+SHA1Engine::Kernel SHA1Engine::getKernel()
 {
-	UInt32 W[80];
-	UInt32 temp;
-	UInt32 A, B, C, D, E;
-	int i;
-
-	/* Step A.  Copy the data buffer into the local work buffer */
-	for( i = 0; i < 16; i++ )
-	W[ i ] = _context.data[ i ];
-
-	/* Step B.  Expand the 16 words into 64 temporary data words */
-	expand( 16 ); expand( 17 ); expand( 18 ); expand( 19 ); expand( 20 );
-	expand( 21 ); expand( 22 ); expand( 23 ); expand( 24 ); expand( 25 );
-	expand( 26 ); expand( 27 ); expand( 28 ); expand( 29 ); expand( 30 );
-	expand( 31 ); expand( 32 ); expand( 33 ); expand( 34 ); expand( 35 );
-	expand( 36 ); expand( 37 ); expand( 38 ); expand( 39 ); expand( 40 );
-	expand( 41 ); expand( 42 ); expand( 43 ); expand( 44 ); expand( 45 );
-	expand( 46 ); expand( 47 ); expand( 48 ); expand( 49 ); expand( 50 );
-	expand( 51 ); expand( 52 ); expand( 53 ); expand( 54 ); expand( 55 );
-	expand( 56 ); expand( 57 ); expand( 58 ); expand( 59 ); expand( 60 );
-	expand( 61 ); expand( 62 ); expand( 63 ); expand( 64 ); expand( 65 );
-	expand( 66 ); expand( 67 ); expand( 68 ); expand( 69 ); expand( 70 );
-	expand( 71 ); expand( 72 ); expand( 73 ); expand( 74 ); expand( 75 );
-	expand( 76 ); expand( 77 ); expand( 78 ); expand( 79 );
-
-	/* Step C.  Set up first buffer */
-	A = _context.digest[ 0 ];
-	B = _context.digest[ 1 ];
-	C = _context.digest[ 2 ];
-	D = _context.digest[ 3 ];
-	E = _context.digest[ 4 ];
-
-	/* Step D.  Serious mangling, divided into four sub-rounds */
-	subRound1( 0 ); subRound1( 1 ); subRound1( 2 ); subRound1( 3 );
-	subRound1( 4 ); subRound1( 5 ); subRound1( 6 ); subRound1( 7 );
-	subRound1( 8 ); subRound1( 9 ); subRound1( 10 ); subRound1( 11 );
-	subRound1( 12 ); subRound1( 13 ); subRound1( 14 ); subRound1( 15 );
-	subRound1( 16 ); subRound1( 17 ); subRound1( 18 ); subRound1( 19 );
-	subRound2( 20 ); subRound2( 21 ); subRound2( 22 ); subRound2( 23 );
-	subRound2( 24 ); subRound2( 25 ); subRound2( 26 ); subRound2( 27 );
-	subRound2( 28 ); subRound2( 29 ); subRound2( 30 ); subRound2( 31 );
-	subRound2( 32 ); subRound2( 33 ); subRound2( 34 ); subRound2( 35 );
-	subRound2( 36 ); subRound2( 37 ); subRound2( 38 ); subRound2( 39 );
-	subRound3( 40 ); subRound3( 41 ); subRound3( 42 ); subRound3( 43 );
-	subRound3( 44 ); subRound3( 45 ); subRound3( 46 ); subRound3( 47 );
-	subRound3( 48 ); subRound3( 49 ); subRound3( 50 ); subRound3( 51 );
-	subRound3( 52 ); subRound3( 53 ); subRound3( 54 ); subRound3( 55 );
-	subRound3( 56 ); subRound3( 57 ); subRound3( 58 ); subRound3( 59 );
-	subRound4( 60 ); subRound4( 61 ); subRound4( 62 ); subRound4( 63 );
-	subRound4( 64 ); subRound4( 65 ); subRound4( 66 ); subRound4( 67 );
-	subRound4( 68 ); subRound4( 69 ); subRound4( 70 ); subRound4( 71 );
-	subRound4( 72 ); subRound4( 73 ); subRound4( 74 ); subRound4( 75 );
-	subRound4( 76 ); subRound4( 77 ); subRound4( 78 ); subRound4( 79 );
-
-	/* Step E.  Build message digest */
-	_context.digest[ 0 ] += A;
-	_context.digest[ 1 ] += B;
-	_context.digest[ 2 ] += C;
-	_context.digest[ 3 ] += D;
-	_context.digest[ 4 ] += E;
+	return static_cast<Kernel>(kernel.load(std::memory_order_relaxed));
 }
 
 
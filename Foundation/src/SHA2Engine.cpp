@@ -21,9 +21,26 @@
 
 
 #include "Poco/SHA2Engine.h"
+#include <atomic>
 #include <string.h>
 
 
+#if defined(__x86_64__) || defined(_M_X64)
+	#define POCO_SHA2_X64 1
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+		#define POCO_SHA2_TARGET(t)
+	#else
+		#include <cpuid.h>
+		#define POCO_SHA2_TARGET(t) __attribute__((target(t)))
+	#endif
+#elif defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO)
+	#define POCO_SHA2_ARMV8 1
+	#include <arm_neon.h>
+#endif
+
+
 namespace Poco {
 
 
@@ -212,35 +229,440 @@ SHA2Engine::~SHA2Engine()
 }
 
 
-void _sha256_process(HASHCONTEXT* pContext, const unsigned char data[64])
+namespace
 {
-	unsigned int i;
-	Poco::UInt32 temp1, temp2, temp3[8], W[64];
-	for (i = 0; i < 8; i++) temp3[i] = pContext->state.state32[i];
-	for (i = 0; i < 16; i++) { GET_UINT32(W[i], data, 4 * i); }
-	for (i = 0; i < 16; i += 8)
+	using Transform256Function = void (*)(Poco::UInt32* state, const unsigned char* data, std::size_t blocks);
+		/// Processes the given number of 64 byte SHA-224/SHA-256 blocks.
+
+	std::atomic<int> kernel(SHA2Engine::KERNEL_AUTO);
+		/// The implementation selected with SHA2Engine::setKernel().
+
+
+	//
+	// Portable implementation
+	//
+
+	void transform256Block(Poco::UInt32* state, const unsigned char data[64])
+	{
+		unsigned int i;
+		Poco::UInt32 temp1, temp2, temp3[8], W[64];
+		for (i = 0; i < 8; i++) temp3[i] = state[i];
+		for (i = 0; i < 16; i++) { GET_UINT32(W[i], data, 4 * i); }
+		for (i = 0; i < 16; i += 8)
+	{
+			P32(temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], W[i + 0], K32[i + 0]);
+			P32(temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], W[i + 1], K32[i + 1]);
+			P32(temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], W[i + 2], K32[i + 2]);
+			P32(temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], W[i + 3], K32[i + 3]);
+			P32(temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], W[i + 4], K32[i + 4]);
+			P32(temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], W[i + 5], K32[i + 5]);
+			P32(temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], W[i + 6], K32[i + 6]);
+			P32(temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], W[i + 7], K32[i + 7]);
+		}
+		for (i = 16; i < 64; i += 8)
+	{
+			P32(temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], R32(i + 0), K32[i + 0]);
+			P32(temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], R32(i + 1), K32[i + 1]);
+			P32(temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], R32(i + 2), K32[i + 2]);
+			P32(temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], R32(i + 3), K32[i + 3]);
+			P32(temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], R32(i + 4), K32[i + 4]);
+			P32(temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], R32(i + 5), K32[i + 5]);
+			P32(temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], R32(i + 6), K32[i + 6]);
+			P32(temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], R32(i + 7), K32[i + 7]);
+		}
+		for (i = 0; i < 8; i++) state[i] += temp3[i];
+	}
+
+
+	void transform256Generic(Poco::UInt32* state, const unsigned char* data, std::size_t blocks)
+	{
+		for (; blocks > 0; blocks--, data += 64)
+		{
+			transform256Block(state, data);
+		}
+	}
+
+
+#if defined(POCO_SHA2_X64)
+
+
+	//
+	// x86/x64 SHA extensions (SHA-NI)
+	//
+
+	POCO_SHA2_TARGET("sha,ssse3,sse4.1")
+	void transform256SHANI(Poco::UInt32* state, const unsigned char* p, std::size_t blocks)
+	{
+		const __m128i mask = _mm_set_epi64x(0x0C0D0E0F08090A0BLL, 0x0405060700010203LL);
+
+		// state0 = ABEF, state1 = CDGH
+		__m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state)), 0xB1);
+		__m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(state + 4)), 0x1B);
+		__m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+		state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+		__m128i msg0, msg1, msg2, msg3, w;
+		for (; blocks > 0; blocks--, p += 64)
+		{
+			const __m128i state0Save = state0;
+			const __m128i state1Save = state1;
+
+			msg0 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 0)), mask);
+			w = _mm_add_epi32(msg0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 0)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg1 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)), mask);
+			w = _mm_add_epi32(msg1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 4)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg2 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 32)), mask);
+			w = _mm_add_epi32(msg2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 8)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg3 = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 48)), mask);
+			w = _mm_add_epi32(msg3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 12)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg0 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(msg0, msg1), _mm_alignr_epi8(msg3, msg2, 4)), msg3);
+			w = _mm_add_epi32(msg0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 16)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg1 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(msg1, msg2), _mm_alignr_epi8(msg0, msg3, 4)), msg0);
+			w = _mm_add_epi32(msg1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 20)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg2 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(msg2, msg3), _mm_alignr_epi8(msg1, msg0, 4)), msg1);
+			w = _mm_add_epi32(msg2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 24)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg3 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(msg3, msg0), _mm_alignr_epi8(msg2, msg1, 4)), msg2);
+			w = _mm_add_epi32(msg3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 28)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg0 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(msg0, msg1), _mm_alignr_epi8(msg3, msg2, 4)), msg3);
+			w = _mm_add_epi32(msg0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 32)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg1 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(msg1, msg2), _mm_alignr_epi8(msg0, msg3, 4)), msg0);
+			w = _mm_add_epi32(msg1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 36)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg2 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(msg2, msg3), _mm_alignr_epi8(msg1, msg0, 4)), msg1);
+			w = _mm_add_epi32(msg2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 40)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg3 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(msg3, msg0), _mm_alignr_epi8(msg2, msg1, 4)), msg2);
+			w = _mm_add_epi32(msg3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 44)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg0 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(msg0, msg1), _mm_alignr_epi8(msg3, msg2, 4)), msg3);
+			w = _mm_add_epi32(msg0, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 48)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg1 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(msg1, msg2), _mm_alignr_epi8(msg0, msg3, 4)), msg0);
+			w = _mm_add_epi32(msg1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 52)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg2 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(msg2, msg3), _mm_alignr_epi8(msg1, msg0, 4)), msg1);
+			w = _mm_add_epi32(msg2, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 56)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+			msg3 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(msg3, msg0), _mm_alignr_epi8(msg2, msg1, 4)), msg2);
+			w = _mm_add_epi32(msg3, _mm_loadu_si128(reinterpret_cast<const __m128i*>(K32 + 60)));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, w);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(w, 0x0E));
+
+			state0 = _mm_add_epi32(state0, state0Save);
+			state1 = _mm_add_epi32(state1, state1Save);
+		}
+
+		tmp = _mm_shuffle_epi32(state0, 0x1B);
+		state1 = _mm_shuffle_epi32(state1, 0xB1);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_blend_epi16(tmp, state1, 0xF0));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(state + 4), _mm_alignr_epi8(state1, tmp, 8));
+	}
+
+
+	//
+	// AVX2, hashing eight independent messages in parallel
+	//
+
+	template <int N>
+	POCO_SHA2_TARGET("avx2")
+	inline __m256i rotr(__m256i x)
+	{
+		return _mm256_or_si256(_mm256_srli_epi32(x, N), _mm256_slli_epi32(x, 32 - N));
+	}
+
+
+	POCO_SHA2_TARGET("avx2")
+	inline void transpose8x8(__m256i* r)
+		/// Transposes a matrix of 8x8 32-bit words.
+	{
+		const __m256i t0 = _mm256_unpacklo_epi32(r[0], r[1]);
+		const __m256i t1 = _mm256_unpackhi_epi32(r[0], r[1]);
+		const __m256i t2 = _mm256_unpacklo_epi32(r[2], r[3]);
+		const __m256i t3 = _mm256_unpackhi_epi32(r[2], r[3]);
+		const __m256i t4 = _mm256_unpacklo_epi32(r[4], r[5]);
+		const __m256i t5 = _mm256_unpackhi_epi32(r[4], r[5]);
+		const __m256i t6 = _mm256_unpacklo_epi32(r[6], r[7]);
+		const __m256i t7 = _mm256_unpackhi_epi32(r[6], r[7]);
+		const __m256i u0 = _mm256_unpacklo_epi64(t0, t2);
+		const __m256i u1 = _mm256_unpackhi_epi64(t0, t2);
+		const __m256i u2 = _mm256_unpacklo_epi64(t1, t3);
+		const __m256i u3 = _mm256_unpackhi_epi64(t1, t3);
+		const __m256i u4 = _mm256_unpacklo_epi64(t4, t6);
+		const __m256i u5 = _mm256_unpackhi_epi64(t4, t6);
+		const __m256i u6 = _mm256_unpacklo_epi64(t5, t7);
+		const __m256i u7 = _mm256_unpackhi_epi64(t5, t7);
+		r[0] = _mm256_permute2x128_si256(u0, u4, 0x20);
+		r[1] = _mm256_permute2x128_si256(u1, u5, 0x20);
+		r[2] = _mm256_permute2x128_si256(u2, u6, 0x20);
+		r[3] = _mm256_permute2x128_si256(u3, u7, 0x20);
+		r[4] = _mm256_permute2x128_si256(u0, u4, 0x31);
+		r[5] = _mm256_permute2x128_si256(u1, u5, 0x31);
+		r[6] = _mm256_permute2x128_si256(u2, u6, 0x31);
+		r[7] = _mm256_permute2x128_si256(u3, u7, 0x31);
+	}
+
+
+	POCO_SHA2_TARGET("avx2")
+	void transform256x8AVX2(Poco::UInt32 (*state)[8], const unsigned char* const* blocks)
+		/// Processes one block for each of eight messages. state[i][j]
+		/// is the i-th state word of the j-th message.
 	{
-		P32(temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], W[i + 0], K32[i + 0]);
-		P32(temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], W[i + 1], K32[i + 1]);
-		P32(temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], W[i + 2], K32[i + 2]);
-		P32(temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], W[i + 3], K32[i + 3]);
-		P32(temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], W[i + 4], K32[i + 4]);
-		P32(temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], W[i + 5], K32[i + 5]);
-		P32(temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], W[i + 6], K32[i + 6]);
-		P32(temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], W[i + 7], K32[i + 7]);
+		const __m256i bswap = _mm256_set_epi8(
+			12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+			12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+
+		__m256i W[16];
+		for (int half = 0; half < 2; half++)
+		{
+			__m256i r[8];
+			for (int j = 0; j < 8; j++)
+			{
+				r[j] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks[j] + 32*half));
+			}
+			transpose8x8(r);
+			for (int i = 0; i < 8; i++)
+			{
+				W[8*half + i] = _mm256_shuffle_epi8(r[i], bswap);
+			}
+		}
+
+		__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[0]));
+		__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[1]));
+		__m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[2]));
+		__m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[3]));
+		__m256i e = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[4]));
+		__m256i f = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[5]));
+		__m256i g = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[6]));
+		__m256i h = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[7]));
+
+		for (int t = 0; t < 64; t++)
+		{
+			if (t >= 16)
+			{
+				const __m256i w2 = W[(t - 2) & 15];
+				const __m256i w15 = W[(t - 15) & 15];
+				const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(rotr<7>(w15), rotr<18>(w15)), _mm256_srli_epi32(w15, 3));
+				const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(rotr<17>(w2), rotr<19>(w2)), _mm256_srli_epi32(w2, 10));
+				W[t & 15] = _mm256_add_epi32(_mm256_add_epi32(W[t & 15], s0), _mm256_add_epi32(W[(t - 7) & 15], s1));
+			}
+			const __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(rotr<6>(e), rotr<11>(e)), rotr<25>(e));
+			const __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+			const __m256i k = _mm256_set1_epi32(static_cast<int>(K32[t]));
+			const __m256i temp1 = _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(h, S1), _mm256_add_epi32(ch, k)), W[t & 15]);
+			const __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(rotr<2>(a), rotr<13>(a)), rotr<22>(a));
+			const __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+			const __m256i temp2 = _mm256_add_epi32(S0, maj);
+			h = g;
+			g = f;
+			f = e;
+			e = _mm256_add_epi32(d, temp1);
+			d = c;
+			c = b;
+			b = a;
+			a = _mm256_add_epi32(temp1, temp2);
+		}
+
+		const __m256i result[8] = {a, b, c, d, e, f, g, h};
+		for (int i = 0; i < 8; i++)
+		{
+			__m256i* pState = reinterpret_cast<__m256i*>(state[i]);
+			_mm256_storeu_si256(pState, _mm256_add_epi32(_mm256_loadu_si256(pState), result[i]));
+		}
+	}
+
+
+	bool hasSHANI()
+	{
+#if defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7) return false;
+		__cpuid(info, 1);
+		const bool hasSSSE3 = (info[2] & (1 << 9)) != 0;
+		const bool hasSSE41 = (info[2] & (1 << 19)) != 0;
+		__cpuidex(info, 7, 0);
+		return hasSSSE3 && hasSSE41 && (info[1] & (1 << 29)) != 0;
+#else
+		unsigned eax, ebx, ecx, edx;
+		if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return false;
+		const bool hasSSSE3 = (ecx & (1u << 9)) != 0;
+		const bool hasSSE41 = (ecx & (1u << 19)) != 0;
+		if (!hasSSSE3 || !hasSSE41 || __get_cpuid_max(0, nullptr) < 7) return false;
+		__cpuid_count(7, 0, eax, ebx, ecx, edx);
+		return (ebx & (1u << 29)) != 0;
+#endif
+	}
+
+
+	bool hasAVX2()
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7) return false;
+		__cpuid(info, 1);
+		const bool osxsave = (info[2] & (1 << 27)) != 0;
+		const bool avx = (info[2] & (1 << 28)) != 0;
+		if (!osxsave || !avx) return false;
+		// the operating system must save the YMM registers
+		if ((_xgetbv(0) & 0x6) != 0x6) return false;
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#else
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+#endif
+	}
+
+
+#elif defined(POCO_SHA2_ARMV8)
+
+
+	//
+	// ARMv8 cryptography extensions
+	//
+
+	void transform256ARMv8(Poco::UInt32* state, const unsigned char* p, std::size_t blocks)
+	{
+		uint32x4_t state0 = vld1q_u32(state);
+		uint32x4_t state1 = vld1q_u32(state + 4);
+		uint32x4_t msg0, msg1, msg2, msg3, w, tmp;
+		for (; blocks > 0; blocks--, p += 64)
+		{
+			const uint32x4_t state0Save = state0;
+			const uint32x4_t state1Save = state1;
+
+			msg0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(p + 0)));
+			w = vaddq_u32(msg0, vld1q_u32(K32 + 0));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(p + 16)));
+			w = vaddq_u32(msg1, vld1q_u32(K32 + 4));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(p + 32)));
+			w = vaddq_u32(msg2, vld1q_u32(K32 + 8));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(p + 48)));
+			w = vaddq_u32(msg3, vld1q_u32(K32 + 12));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg0 = vsha256su1q_u32(vsha256su0q_u32(msg0, msg1), msg2, msg3);
+			w = vaddq_u32(msg0, vld1q_u32(K32 + 16));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg1 = vsha256su1q_u32(vsha256su0q_u32(msg1, msg2), msg3, msg0);
+			w = vaddq_u32(msg1, vld1q_u32(K32 + 20));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg2 = vsha256su1q_u32(vsha256su0q_u32(msg2, msg3), msg0, msg1);
+			w = vaddq_u32(msg2, vld1q_u32(K32 + 24));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg3 = vsha256su1q_u32(vsha256su0q_u32(msg3, msg0), msg1, msg2);
+			w = vaddq_u32(msg3, vld1q_u32(K32 + 28));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg0 = vsha256su1q_u32(vsha256su0q_u32(msg0, msg1), msg2, msg3);
+			w = vaddq_u32(msg0, vld1q_u32(K32 + 32));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg1 = vsha256su1q_u32(vsha256su0q_u32(msg1, msg2), msg3, msg0);
+			w = vaddq_u32(msg1, vld1q_u32(K32 + 36));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg2 = vsha256su1q_u32(vsha256su0q_u32(msg2, msg3), msg0, msg1);
+			w = vaddq_u32(msg2, vld1q_u32(K32 + 40));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg3 = vsha256su1q_u32(vsha256su0q_u32(msg3, msg0), msg1, msg2);
+			w = vaddq_u32(msg3, vld1q_u32(K32 + 44));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg0 = vsha256su1q_u32(vsha256su0q_u32(msg0, msg1), msg2, msg3);
+			w = vaddq_u32(msg0, vld1q_u32(K32 + 48));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg1 = vsha256su1q_u32(vsha256su0q_u32(msg1, msg2), msg3, msg0);
+			w = vaddq_u32(msg1, vld1q_u32(K32 + 52));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg2 = vsha256su1q_u32(vsha256su0q_u32(msg2, msg3), msg0, msg1);
+			w = vaddq_u32(msg2, vld1q_u32(K32 + 56));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+			msg3 = vsha256su1q_u32(vsha256su0q_u32(msg3, msg0), msg1, msg2);
+			w = vaddq_u32(msg3, vld1q_u32(K32 + 60));
+			tmp = state0;
+			state0 = vsha256hq_u32(state0, state1, w);
+			state1 = vsha256h2q_u32(state1, tmp, w);
+
+			state0 = vaddq_u32(state0, state0Save);
+			state1 = vaddq_u32(state1, state1Save);
+		}
+		vst1q_u32(state, state0);
+		vst1q_u32(state + 4, state1);
 	}
-	for (i = 16; i < 64; i += 8)
+
+
+#endif
+
+
+	Transform256Function transform256Function()
+		/// Returns the implementation for the CPU and the selected kernel.
 	{
-		P32(temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], R32(i + 0), K32[i + 0]);
-		P32(temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], R32(i + 1), K32[i + 1]);
-		P32(temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], R32(i + 2), K32[i + 2]);
-		P32(temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], temp3[4], R32(i + 3), K32[i + 3]);
-		P32(temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], temp3[3], R32(i + 4), K32[i + 4]);
-		P32(temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], temp3[2], R32(i + 5), K32[i + 5]);
-		P32(temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], temp3[1], R32(i + 6), K32[i + 6]);
-		P32(temp3[1], temp3[2], temp3[3], temp3[4], temp3[5], temp3[6], temp3[7], temp3[0], R32(i + 7), K32[i + 7]);
+		static const Transform256Function function = []() -> Transform256Function
+		{
+#if defined(POCO_SHA2_X64)
+			if (hasSHANI()) return transform256SHANI;
+#elif defined(POCO_SHA2_ARMV8)
+			return transform256ARMv8;
+#endif
+			return transform256Generic;
+		}();
+		if (kernel.load(std::memory_order_relaxed) == SHA2Engine::KERNEL_GENERIC) return transform256Generic;
+		return function;
 	}
-	for (i = 0; i < 8; i++) pContext->state.state32[i] += temp3[i];
 }
 
 
@@ -304,16 +726,16 @@ void SHA2Engine::updateImpl(const void* buffer_, std::size_t count)
 		if (left && count >= fill)
 		{
 			memcpy((void *)(pContext->buffer + left), data, fill);
-			_sha256_process(pContext, pContext->buffer);
+			transform256Function()(pContext->state.state32, pContext->buffer, 1);
 			data += fill;
 			count -= fill;
 			left = 0;
 		}
-		while (count >= 64)
+		if (count >= 64)
 		{
-			_sha256_process(pContext, data);
-			data += 64;
-			count -= 64;
+			transform256Function()(pContext->state.state32, data, count/64);
+			data += count - count % 64;
+			count %= 64;
 		}
 	}
 	if (count > 0) memcpy((void *)(pContext->buffer + left), data, count);
@@ -352,8 +774,10 @@ std::size_t SHA2Engine::digestLength() const
 
 void SHA2Engine::reset()
 {
-	free(_context);
-	_context = calloc(1, sizeof(HASHCONTEXT));
+	if (_context)
+		memset(_context, 0, sizeof(HASHCONTEXT));
+	else
+		_context = calloc(1, sizeof(HASHCONTEXT));
 	HASHCONTEXT* pContext = (HASHCONTEXT*)_context;
 	if (_algorithm == SHA_224)
 	{
@@ -481,4 +905,188 @@ const DigestEngine::Digest& SHA2Engine::digest()
 }
 
 
+bool SHA2Engine::isAccelerated()
+{
+	return transform256Function() != transform256Generic;
+}
+
+
+bool SHA2Engine::isMultiBufferAccelerated()
+{
+#if defined(POCO_SHA2_X64)
+	// The SHA-NI kernel hashes a single buffer faster than
+	// the AVX2 kernel hashes eight, so it is preferred if present.
+	static const bool avx2 = hasAVX2();
+	static const bool shaNI = hasSHANI();
+	switch (kernel.load(std::memory_order_relaxed))
+	{
+	case KERNEL_GENERIC:
+		return false;
+	case KERNEL_MULTI_BUFFER:
+		return avx2;
+	default:
+		return avx2 && !shaNI;
+	}
+#else
+	return false;
+#endif
+}
+
+
+void SHA2Engine::setKernel(Kernel k)
+{
+	kernel.store(k, std::memory_order_relaxed);
+}
+
+
+SHA2Engine::Kernel SHA2Engine::getKernel()
+{
+	return static_cast<Kernel>(kernel.load(std::memory_order_relaxed));
+}
+
+
+#if defined(POCO_SHA2_X64)
+
+
+namespace
+{
+	class MultiBuffer256
+		/// Computes SHA-224/SHA-256 digests of up to eight messages
+		/// at a time, using AVX2. When a message is complete, its
+		/// lane is refilled with the next message.
+	{
+	public:
+		MultiBuffer256(const std::vector<std::string_view>& messages, std::vector<DigestEngine::Digest>& digests, bool sha224):
+			_messages(messages),
+			_digests(digests),
+			_sha224(sha224),
+			_next(0),
+			_active(0)
+		{
+		}
+
+		void run()
+		{
+			static const unsigned char zero[64] = {0};
+
+			for (int j = 0; j < LANES; j++) start(j);
+			while (_active > 0)
+			{
+				const unsigned char* blocks[LANES];
+				for (int j = 0; j < LANES; j++)
+				{
+					blocks[j] = _lanes[j].active ? block(_lanes[j]) : zero;
+				}
+				transform256x8AVX2(_state, blocks);
+				for (int j = 0; j < LANES; j++)
+				{
+					Lane& lane = _lanes[j];
+					if (lane.active && ++lane.block == lane.blocks)
+					{
+						finish(j);
+						start(j);
+					}
+				}
+			}
+		}
+
+	private:
+		enum
+		{
+			LANES = 8
+		};
+
+		struct Lane
+		{
+			bool active = false;
+			std::size_t index = 0;
+			const unsigned char* data = nullptr;
+			std::size_t fullBlocks = 0;
+			std::size_t blocks = 0;
+			std::size_t block = 0;
+			unsigned char tail[128];
+		};
+
+		static const unsigned char* block(const Lane& lane)
+		{
+			if (lane.block < lane.fullBlocks)
+				return lane.data + 64*lane.block;
+			else
+				return lane.tail + 64*(lane.block - lane.fullBlocks);
+		}
+
+		void start(int j)
+		{
+			Lane& lane = _lanes[j];
+			lane.active = _next < _messages.size();
+			if (!lane.active) return;
+
+			lane.index = _next++;
+			const std::string_view& message = _messages[lane.index];
+			lane.data = reinterpret_cast<const unsigned char*>(message.data());
+			lane.fullBlocks = message.size()/64;
+			lane.block = 0;
+
+			// padding and message length in bits
+			const std::size_t rest = message.size() % 64;
+			const std::size_t tailBlocks = rest < 56 ? 1 : 2;
+			memset(lane.tail, 0, sizeof(lane.tail));
+			if (rest > 0) memcpy(lane.tail, lane.data + 64*lane.fullBlocks, rest);
+			lane.tail[rest] = 0x80;
+			const Poco::UInt64 bits = static_cast<Poco::UInt64>(message.size()) << 3;
+			PUT_UINT64(bits, lane.tail, 64*tailBlocks - 8);
+			lane.blocks = lane.fullBlocks + tailBlocks;
+
+			static const Poco::UInt32 iv224[8] = {0xC1059ED8, 0x367CD507, 0x3070DD17, 0xF70E5939, 0xFFC00B31, 0x68581511, 0x64F98FA7, 0xBEFA4FA4};
+			static const Poco::UInt32 iv256[8] = {0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19};
+			const Poco::UInt32* iv = _sha224 ? iv224 : iv256;
+			for (int i = 0; i < 8; i++) _state[i][j] = iv[i];
+			_active++;
+		}
+
+		void finish(int j)
+		{
+			Lane& lane = _lanes[j];
+			unsigned char hash[32];
+			for (int i = 0; i < 8; i++) PUT_UINT32(_state[i][j], hash, 4*i);
+			_digests[lane.index].assign(hash, hash + (_sha224 ? 28 : 32));
+			lane.active = false;
+			_active--;
+		}
+
+		const std::vector<std::string_view>& _messages;
+		std::vector<DigestEngine::Digest>& _digests;
+		bool _sha224;
+		std::size_t _next;
+		int _active;
+		Lane _lanes[LANES];
+		Poco::UInt32 _state[8][LANES];
+	};
+}
+
+
+#endif
+
+
+std::vector<DigestEngine::Digest> SHA2Engine::digestAll(const std::vector<std::string_view>& messages, ALGORITHM algorithm)
+{
+	std::vector<DigestEngine::Digest> digests(messages.size());
+#if defined(POCO_SHA2_X64)
+	if ((algorithm == SHA_224 || algorithm == SHA_256) && messages.size() > 1 && isMultiBufferAccelerated())
+	{
+		MultiBuffer256 multiBuffer(messages, digests, algorithm == SHA_224);
+		multiBuffer.run();
+		return digests;
+	}
+#endif
+	SHA2Engine engine(algorithm);
+	for (std::size_t i = 0; i < messages.size(); i++)
+	{
+		engine.update(messages[i].data(), messages[i].size());
+		digests[i] = engine.digest();
+	}
+	return digests;
+}
+
+
 } // namespace Poco
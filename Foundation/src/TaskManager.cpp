@@ -15,6 +15,7 @@
 #include "Poco/TaskManager.h"
 #include "Poco/TaskNotification.h"
 #include "Poco/ThreadPool.h"
+#include "Poco/WorkStealingThreadPool.h"
 #include "Poco/Timespan.h"
 
 
@@ -29,7 +30,8 @@ TaskManager::TaskManager(const std::string& name,
 		int maxCapacity,
 		int idleTime,
 		int stackSize):
-	_threadPool(*new ThreadPool(name, minCapacity, maxCapacity, idleTime, stackSize)),
+	_pThreadPool(new ThreadPool(name, minCapacity, maxCapacity, idleTime, stackSize)),
+	_pWorkStealingPool(nullptr),
 	_ownPool(true)
 {
 	// prevent skipping the first progress update
@@ -38,7 +40,18 @@ TaskManager::TaskManager(const std::string& name,
 
 
 TaskManager::TaskManager(ThreadPool& pool):
-	_threadPool(pool),
+	_pThreadPool(&pool),
+	_pWorkStealingPool(nullptr),
+	_ownPool(false)
+{
+	// prevent skipping the first progress update
+	_lastProgressNotification -= Timespan(MIN_PROGRESS_NOTIFICATION_INTERVAL*2);
+}
+
+
+TaskManager::TaskManager(WorkStealingThreadPool& pool):
+	_pThreadPool(nullptr),
+	_pWorkStealingPool(&pool),
 	_ownPool(false)
 {
 	// prevent skipping the first progress update
@@ -51,7 +64,7 @@ TaskManager::~TaskManager()
 	for (auto& pTask: _taskList)
 		pTask->setOwner(nullptr);
 
-	if (_ownPool) delete &_threadPool;
+	if (_ownPool) delete _pThreadPool;
 }
 
 
@@ -71,7 +84,10 @@ bool TaskManager::start(Task* pTask)
 				ScopedLockT lock(_mutex);
 				_taskList.push_back(pAutoTask);
 			}
-			_threadPool.start(*pTask, pTask->name());
+			if (_pWorkStealingPool)
+				_pWorkStealingPool->start(*pTask);
+			else
+				_pThreadPool->start(*pTask, pTask->name());
 			return true;
 		}
 		catch (...)
@@ -103,7 +119,10 @@ void TaskManager::cancelAll()
 
 void TaskManager::joinAll()
 {
-	_threadPool.joinAll();
+	if (_pWorkStealingPool)
+		_pWorkStealingPool->joinAll();
+	else
+		_pThreadPool->joinAll();
 }
 
 
@@ -0,0 +1,411 @@
+//
+// TimingWheel.cpp
+//
+// Library: Foundation
+// Package: Threading
+// Module:  TimingWheel
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/TimingWheel.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/Exception.h"
+
+
+namespace Poco {
+
+
+TimingWheel::TimingWheel(const Poco::Timespan& resolution):
+	_resolution(resolution.totalMicroseconds()),
+	_nextTick(0),
+	_free(NIL),
+	_size(0)
+{
+	if (_resolution < 1) throw Poco::InvalidArgumentException("TimingWheel resolution must be at least one microsecond");
+
+	for (auto& slot: _slots) slot = NIL;
+	for (auto& size: _wheelSize) size = 0;
+}
+
+
+TimingWheel::~TimingWheel()
+{
+	try
+	{
+		clear();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+TimingWheel::Handle TimingWheel::schedule(const Poco::Timespan& delay, const Callback& callback)
+{
+	Poco::Clock time;
+	time += delay.totalMicroseconds();
+	return schedule(time, callback);
+}
+
+
+TimingWheel::Handle TimingWheel::schedule(const Poco::Clock& time, const Callback& callback)
+{
+	Poco::Clock::ClockDiff diff = time - _start;
+	Poco::Int64 expires = diff > 0 ? (diff + _resolution - 1)/_resolution : 0;
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	Poco::UInt32 index = allocate();
+	Node& node = _nodes[index];
+	node.expires = expires;
+	node.callback = callback;
+	link(index);
+	_size++;
+	return Handle(index, node.generation);
+}
+
+
+bool TimingWheel::reschedule(const Handle& handle, const Poco::Timespan& delay)
+{
+	Poco::Clock time;
+	time += delay.totalMicroseconds();
+	Poco::Clock::ClockDiff diff = time - _start;
+	Poco::Int64 expires = diff > 0 ? (diff + _resolution - 1)/_resolution : 0;
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	Node* pNode = find(handle);
+	if (!pNode) return false;
+
+	unlink(handle._index);
+	pNode->expires = expires;
+	link(handle._index);
+	return true;
+}
+
+
+bool TimingWheel::cancel(Handle& handle)
+{
+	Callback callback;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		Node* pNode = find(handle);
+		if (!pNode)
+		{
+			handle.reset();
+			return false;
+		}
+		// the callback is destroyed outside of the lock
+		callback.swap(pNode->callback);
+		unlink(handle._index);
+		release(handle._index);
+		_size--;
+	}
+	handle.reset();
+	return true;
+}
+
+
+bool TimingWheel::isScheduled(const Handle& handle) const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return find(handle) != nullptr;
+}
+
+
+std::size_t TimingWheel::advance()
+{
+	return advance(Poco::Clock());
+}
+
+
+std::size_t TimingWheel::advance(const Poco::Clock& now)
+{
+	std::vector<Callback> expired;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		Poco::Int64 nowTick = ticksAt(now);
+		while (_size > 0 && _nextTick <= nowTick)
+		{
+			Poco::Int64 tick = skipTicks();
+			if (tick > nowTick) break;
+			_nextTick = tick;
+
+			int index = static_cast<int>(_nextTick & WHEEL_MASK);
+			if (index == 0 &&
+				!cascade(1, static_cast<int>((_nextTick >> WHEEL_BITS) & WHEEL_MASK)) &&
+				!cascade(2, static_cast<int>((_nextTick >> 2*WHEEL_BITS) & WHEEL_MASK)))
+			{
+				cascade(3, static_cast<int>((_nextTick >> 3*WHEEL_BITS) & WHEEL_MASK));
+			}
+			++_nextTick;
+
+			Poco::UInt32 i = _slots[index];
+			_slots[index] = NIL;
+			while (i != NIL)
+			{
+				Node& node = _nodes[i];
+				Poco::UInt32 next = node.next;
+				_expired.push_back(std::move(node.callback));
+				node.callback = nullptr;
+				release(i);
+				_wheelSize[0]--;
+				_size--;
+				i = next;
+			}
+		}
+		// no timers due, skip the idle ticks
+		if (_nextTick <= nowTick) _nextTick = nowTick + 1;
+
+		expired.swap(_expired);
+	}
+
+	for (auto& callback: expired)
+	{
+		try
+		{
+			callback();
+		}
+		catch (Poco::Exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (std::exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (...)
+		{
+			ErrorHandler::handle();
+		}
+	}
+
+	std::size_t n = expired.size();
+	expired.clear();
+	{
+		// keep the buffer for the next call
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		if (_expired.empty()) _expired.swap(expired);
+	}
+	return n;
+}
+
+
+Poco::Timespan TimingWheel::nextTimeout(const Poco::Timespan& maxTimeout) const
+{
+	Poco::Clock now;
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	if (_size == 0) return maxTimeout;
+
+	// find the next non-empty slot of the first wheel, or the
+	// next turn of the first wheel, whichever comes first
+	Poco::Int64 tick = skipTicks();
+	if (tick == _nextTick)
+	{
+		for (int d = 0; d < WHEEL_SIZE; d++, tick++)
+		{
+			int index = static_cast<int>(tick & WHEEL_MASK);
+			if ((d > 0 && index == 0) || _slots[index] != NIL) break;
+		}
+	}
+	Poco::Clock::ClockDiff timeout = (_start + tick*_resolution) - now;
+	if (timeout < 0) timeout = 0;
+	if (timeout > maxTimeout.totalMicroseconds()) return maxTimeout;
+	return Poco::Timespan(timeout);
+}
+
+
+void TimingWheel::clear()
+{
+	std::vector<Callback> callbacks;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+
+		callbacks.reserve(_size);
+		for (Poco::UInt32 i = 0; i < _nodes.size(); i++)
+		{
+			Node& node = _nodes[i];
+			if (node.slot != NIL)
+			{
+				callbacks.push_back(std::move(node.callback));
+				node.callback = nullptr;
+				release(i);
+			}
+		}
+		for (auto& slot: _slots) slot = NIL;
+		for (auto& size: _wheelSize) size = 0;
+		_size = 0;
+	}
+}
+
+
+std::size_t TimingWheel::size() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	return _size;
+}
+
+
+bool TimingWheel::empty() const
+{
+	return size() == 0;
+}
+
+
+Poco::Int64 TimingWheel::ticksAt(const Poco::Clock& time) const
+{
+	Poco::Clock::ClockDiff diff = time - _start;
+	return diff > 0 ? diff/_resolution : 0;
+}
+
+
+Poco::UInt32 TimingWheel::allocate()
+{
+	if (_free != NIL)
+	{
+		Poco::UInt32 index = _free;
+		_free = _nodes[index].next;
+		return index;
+	}
+	if (_nodes.size() >= NIL) throw Poco::OutOfMemoryException("Too many timers");
+
+	Node node;
+	node.expires = 0;
+	node.prev = NIL;
+	node.next = NIL;
+	node.slot = NIL;
+	node.generation = 1;
+	_nodes.push_back(std::move(node));
+	return static_cast<Poco::UInt32>(_nodes.size() - 1);
+}
+
+
+void TimingWheel::release(Poco::UInt32 index)
+{
+	Node& node = _nodes[index];
+	node.slot = NIL;
+	node.prev = NIL;
+	if (++node.generation == 0) node.generation = 1;
+	node.next = _free;
+	_free = index;
+}
+
+
+void TimingWheel::link(Poco::UInt32 index)
+{
+	Node& node = _nodes[index];
+	Poco::Int64 expires = node.expires;
+	Poco::Int64 delta = expires - _nextTick;
+	Poco::UInt32 slot;
+	if (delta < 0)
+	{
+		// already due, expire with the next tick
+		slot = static_cast<Poco::UInt32>(_nextTick & WHEEL_MASK);
+	}
+	else if (delta < (Poco::Int64(1) << WHEEL_BITS))
+	{
+		slot = static_cast<Poco::UInt32>(expires & WHEEL_MASK);
+	}
+	else if (delta < (Poco::Int64(1) << 2*WHEEL_BITS))
+	{
+		slot = WHEEL_SIZE + static_cast<Poco::UInt32>((expires >> WHEEL_BITS) & WHEEL_MASK);
+	}
+	else if (delta < (Poco::Int64(1) << 3*WHEEL_BITS))
+	{
+		slot = 2*WHEEL_SIZE + static_cast<Poco::UInt32>((expires >> 2*WHEEL_BITS) & WHEEL_MASK);
+	}
+	else
+	{
+		// beyond the range of the outermost wheel, the timer
+		// is cascaded again when the slot comes around
+		const Poco::Int64 maxDelta = (Poco::Int64(1) << 4*WHEEL_BITS) - 1;
+		if (delta > maxDelta) expires = _nextTick + maxDelta;
+		slot = 3*WHEEL_SIZE + static_cast<Poco::UInt32>((expires >> 3*WHEEL_BITS) & WHEEL_MASK);
+	}
+
+	_wheelSize[slot >> WHEEL_BITS]++;
+	node.slot = slot;
+	node.prev = NIL;
+	node.next = _slots[slot];
+	if (node.next != NIL) _nodes[node.next].prev = index;
+	_slots[slot] = index;
+}
+
+
+void TimingWheel::unlink(Poco::UInt32 index)
+{
+	Node& node = _nodes[index];
+	if (node.prev != NIL)
+		_nodes[node.prev].next = node.next;
+	else
+		_slots[node.slot] = node.next;
+	if (node.next != NIL) _nodes[node.next].prev = node.prev;
+	node.prev = NIL;
+	node.next = NIL;
+	_wheelSize[node.slot >> WHEEL_BITS]--;
+}
+
+
+bool TimingWheel::cascade(int wheel, int slot)
+{
+	Poco::UInt32 i = _slots[wheel*WHEEL_SIZE + slot];
+	_slots[wheel*WHEEL_SIZE + slot] = NIL;
+	while (i != NIL)
+	{
+		Poco::UInt32 next = _nodes[i].next;
+		_wheelSize[wheel]--;
+		link(i);
+		i = next;
+	}
+	return slot != 0;
+}
+
+
+Poco::Int64 TimingWheel::skipTicks() const
+{
+	// If the first wheel is empty, nothing can expire before its next
+	// turn, when timers are cascaded from the second wheel. If the second
+	// wheel is empty as well, nothing happens before the third wheel is
+	// cascaded, etc.
+	if (_wheelSize[0] != 0) return _nextTick;
+
+	Poco::Int64 step = WHEEL_SIZE;
+	for (int wheel = 1; wheel < WHEEL_COUNT - 1 && _wheelSize[wheel] == 0; wheel++)
+	{
+		step <<= WHEEL_BITS;
+	}
+	return (_nextTick + step - 1) & ~(step - 1);
+}
+
+
+TimingWheel::Node* TimingWheel::find(const Handle& handle)
+{
+	if (handle._generation == 0 || handle._index >= _nodes.size()) return nullptr;
+	Node& node = _nodes[handle._index];
+	if (node.generation != handle._generation || node.slot == NIL) return nullptr;
+	return &node;
+}
+
+
+const TimingWheel::Node* TimingWheel::find(const Handle& handle) const
+{
+	if (handle._generation == 0 || handle._index >= _nodes.size()) return nullptr;
+	const Node& node = _nodes[handle._index];
+	if (node.generation != handle._generation || node.slot == NIL) return nullptr;
+	return &node;
+}
+
+
+} // namespace Poco
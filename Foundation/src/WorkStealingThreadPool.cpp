@@ -0,0 +1,405 @@
+//
+// WorkStealingThreadPool.cpp
+//
+// Library: Foundation
+// Package: Threading
+// Module:  WorkStealingThreadPool
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/WorkStealingThreadPool.h"
+#include "Poco/WorkStealingQueue.h"
+#include "Poco/Runnable.h"
+#include "Poco/Thread.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/Exception.h"
+#include <chrono>
+#include <sstream>
+
+
+namespace Poco {
+
+
+class WorkStealingThreadPool::RunnableTask: public WorkStealingThreadPool::Task
+{
+public:
+	explicit RunnableTask(Runnable& target):
+		_target(target)
+	{
+	}
+
+	void run() override
+	{
+		_target.run();
+	}
+
+private:
+	Runnable& _target;
+};
+
+
+class WorkStealingThreadPool::Worker: public Runnable
+{
+public:
+	Worker(WorkStealingThreadPool& pool, int index, int stackSize):
+		_pool(pool),
+		_index(index),
+		_random(static_cast<Poco::UInt32>(index)*2654435761U + 1),
+		_submitted(0),
+		_completed(0)
+	{
+		std::ostringstream name;
+		name << pool._name << "[#" << index + 1 << "]";
+		_thread.setName(name.str());
+		_thread.setStackSize(stackSize);
+	}
+
+	void start()
+	{
+		_thread.start(*this);
+	}
+
+	void join()
+	{
+		_thread.join();
+	}
+
+	void push(Task* pTask)
+	{
+		_submitted.fetch_add(1);
+		_queue.push(pTask);
+	}
+
+	Task* pop()
+	{
+		return _queue.pop();
+	}
+
+	Task* steal()
+	{
+		return _queue.steal();
+	}
+
+	bool empty() const
+	{
+		return _queue.empty();
+	}
+
+	Poco::UInt64 submitted() const
+	{
+		return _submitted.load();
+	}
+
+	Poco::UInt64 completed() const
+	{
+		return _completed.load();
+	}
+
+	int index() const
+	{
+		return _index;
+	}
+
+	Poco::UInt32 random()
+	{
+		// xorshift32
+		_random ^= _random << 13;
+		_random ^= _random >> 17;
+		_random ^= _random << 5;
+		return _random;
+	}
+
+	WorkStealingThreadPool& pool() const
+	{
+		return _pool;
+	}
+
+	void run() override
+	{
+		_pCurrent = this;
+		for (;;)
+		{
+			Task* pTask = _pool.findTask(this);
+			for (int spin = 0; !pTask && spin < SPIN_COUNT; spin++)
+			{
+				Thread::yield();
+				pTask = _pool.findTask(this);
+			}
+			if (pTask)
+			{
+				runTask(pTask);
+			}
+			else if (!_pool.park())
+			{
+				break;
+			}
+		}
+		_pCurrent = nullptr;
+	}
+
+	static Worker* current()
+	{
+		return _pCurrent;
+	}
+
+private:
+	enum
+	{
+		SPIN_COUNT = 16
+	};
+
+	void runTask(Task* pTask)
+	{
+		try
+		{
+			pTask->run();
+		}
+		catch (Exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (std::exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (...)
+		{
+			ErrorHandler::handle();
+		}
+		delete pTask;
+		_completed.fetch_add(1);
+	}
+
+	WorkStealingThreadPool& _pool;
+	int _index;
+	Poco::UInt32 _random;
+	WorkStealingQueue<Task*> _queue;
+	alignas(64) std::atomic<Poco::UInt64> _submitted;
+	alignas(64) std::atomic<Poco::UInt64> _completed;
+	Thread _thread;
+
+	static thread_local Worker* _pCurrent;
+};
+
+
+thread_local WorkStealingThreadPool::Worker* WorkStealingThreadPool::Worker::_pCurrent = nullptr;
+
+
+WorkStealingThreadPool::WorkStealingThreadPool(int capacity, int stackSize):
+	_injectedCount(0),
+	_injectedTotal(0),
+	_idle(0),
+	_wakeUps(0),
+	_stopped(false)
+{
+	init(capacity, stackSize);
+}
+
+
+WorkStealingThreadPool::WorkStealingThreadPool(const std::string& name, int capacity, int stackSize):
+	_name(name),
+	_injectedCount(0),
+	_injectedTotal(0),
+	_idle(0),
+	_wakeUps(0),
+	_stopped(false)
+{
+	init(capacity, stackSize);
+}
+
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+	try
+	{
+		joinAll();
+		{
+			std::lock_guard<std::mutex> lock(_parkMutex);
+			_stopped = true;
+			_parkCondition.notify_all();
+		}
+		for (auto& pWorker: _workers)
+		{
+			pWorker->join();
+		}
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void WorkStealingThreadPool::init(int capacity, int stackSize)
+{
+	if (capacity < 1) throw InvalidArgumentException("WorkStealingThreadPool capacity must be at least 1");
+
+	_workers.reserve(capacity);
+	for (int i = 0; i < capacity; i++)
+	{
+		_workers.push_back(std::make_unique<Worker>(*this, i, stackSize));
+	}
+	for (auto& pWorker: _workers)
+	{
+		pWorker->start();
+	}
+}
+
+
+void WorkStealingThreadPool::start(Runnable& target)
+{
+	enqueue(new RunnableTask(target));
+}
+
+
+void WorkStealingThreadPool::joinAll()
+{
+	std::unique_lock<std::mutex> lock(_parkMutex);
+	while (!quiescent())
+	{
+		// Workers notify the condition when they become idle. The timeout
+		// covers tasks that complete without any worker becoming idle.
+		_joinCondition.wait_for(lock, std::chrono::milliseconds(10));
+	}
+}
+
+
+WorkStealingThreadPool& WorkStealingThreadPool::defaultPool()
+{
+	static WorkStealingThreadPool thePool;
+	return thePool;
+}
+
+
+void WorkStealingThreadPool::enqueue(Task* pTask)
+{
+	Worker* pWorker = Worker::current();
+	if (pWorker && &pWorker->pool() == this)
+	{
+		pWorker->push(pTask);
+	}
+	else
+	{
+		FastMutex::ScopedLock lock(_injectionMutex);
+		_injected.push_back(pTask);
+		_injectedTotal.fetch_add(1);
+		_injectedCount.fetch_add(1);
+	}
+	wakeUp();
+}
+
+
+WorkStealingThreadPool::Task* WorkStealingThreadPool::findTask(Worker* pWorker)
+{
+	Task* pTask = pWorker->pop();
+	if (pTask) return pTask;
+
+	pTask = takeInjected();
+	if (pTask) return pTask;
+
+	const std::size_t n = _workers.size();
+	const std::size_t first = pWorker->random() % n;
+	for (std::size_t i = 0; i < n; i++)
+	{
+		Worker* pVictim = _workers[(first + i) % n].get();
+		if (pVictim != pWorker)
+		{
+			pTask = pVictim->steal();
+			if (pTask) return pTask;
+		}
+	}
+	return nullptr;
+}
+
+
+WorkStealingThreadPool::Task* WorkStealingThreadPool::takeInjected()
+{
+	if (_injectedCount.load(std::memory_order_relaxed) == 0) return nullptr;
+
+	FastMutex::ScopedLock lock(_injectionMutex);
+	if (_injected.empty()) return nullptr;
+	Task* pTask = _injected.front();
+	_injected.pop_front();
+	_injectedCount.fetch_sub(1);
+	return pTask;
+}
+
+
+bool WorkStealingThreadPool::hasTasks() const
+{
+	if (_injectedCount.load() != 0) return true;
+	for (const auto& pWorker: _workers)
+	{
+		if (!pWorker->empty()) return true;
+	}
+	return false;
+}
+
+
+bool WorkStealingThreadPool::park()
+{
+	std::unique_lock<std::mutex> lock(_parkMutex);
+
+	// Announce that we are about to sleep before checking for tasks
+	// once more. wakeUp() checks _idle after enqueueing a task,
+	// so either we see the task or wakeUp() sees us.
+	_idle.fetch_add(1);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (hasTasks())
+	{
+		_idle.fetch_sub(1);
+		return true;
+	}
+	if (_stopped)
+	{
+		_idle.fetch_sub(1);
+		return false;
+	}
+	_joinCondition.notify_all();
+	_parkCondition.wait(lock, [this]() { return _wakeUps > 0 || _stopped; });
+	if (_wakeUps > 0) _wakeUps--;
+	_idle.fetch_sub(1);
+	return true;
+}
+
+
+void WorkStealingThreadPool::wakeUp()
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (_idle.load(std::memory_order_relaxed) > 0)
+	{
+		std::lock_guard<std::mutex> lock(_parkMutex);
+		if (_wakeUps < _idle.load())
+		{
+			_wakeUps++;
+			_parkCondition.notify_one();
+		}
+	}
+}
+
+
+bool WorkStealingThreadPool::quiescent() const
+{
+	// Read the completion counters first. If they add up to the
+	// number of tasks submitted afterwards, no task was pending
+	// at the time the completion counters were read.
+	Poco::UInt64 completed = 0;
+	for (const auto& pWorker: _workers)
+	{
+		completed += pWorker->completed();
+	}
+	Poco::UInt64 submitted = _injectedTotal.load();
+	for (const auto& pWorker: _workers)
+	{
+		submitted += pWorker->submitted();
+	}
+	return completed == submitted;
+}
+
+
+} // namespace Poco
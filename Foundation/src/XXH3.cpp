@@ -0,0 +1,493 @@
+//
+// XXH3.cpp
+//
+// Library: Foundation
+// Package: Hashing
+// Module:  XXH3
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+// Based on xxHash (https://github.com/Cyan4973/xxHash),
+// Copyright (c) 2012-2021 Yann Collet, BSD 2-Clause License.
+//
+
+
+#include "Poco/XXH3.h"
+#include "Poco/ByteOrder.h"
+#include <cstring>
+
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define POCO_XXH3_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+
+namespace Poco {
+
+
+namespace
+{
+	const UInt32 PRIME32_1 = 0x9E3779B1U;
+	const UInt32 PRIME32_2 = 0x85EBCA77U;
+	const UInt32 PRIME32_3 = 0xC2B2AE3DU;
+	const UInt64 PRIME64_1 = 0x9E3779B185EBCA87ULL;
+	const UInt64 PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+	const UInt64 PRIME64_3 = 0x165667B19E3779F9ULL;
+	const UInt64 PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+	const UInt64 PRIME64_5 = 0x27D4EB2F165667C5ULL;
+	const UInt64 PRIME_MX1 = 0x165667919E3779F9ULL;
+	const UInt64 PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+
+	const std::size_t STRIPE_SIZE = XXH3::STRIPE_SIZE;
+	const std::size_t SECRET_SIZE = XXH3::SECRET_SIZE;
+	const std::size_t SECRET_SIZE_MIN = 136;
+	const std::size_t SECRET_CONSUME_RATE = 8;
+	const std::size_t SECRET_LASTACC_START = 7;
+	const std::size_t SECRET_MERGEACCS_START = 11;
+	const std::size_t MIDSIZE_MAX = 240;
+	const std::size_t MIDSIZE_STARTOFFSET = 3;
+	const std::size_t MIDSIZE_LASTOFFSET = 17;
+	const std::size_t STRIPES_PER_BLOCK = (SECRET_SIZE - STRIPE_SIZE)/SECRET_CONSUME_RATE;
+
+	alignas(64) const unsigned char DEFAULT_SECRET[SECRET_SIZE] =
+	{
+		0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+		0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+		0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+		0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+		0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+		0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+		0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+		0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+		0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+		0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+		0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+		0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+	};
+
+	inline UInt32 read32(const unsigned char* p)
+	{
+		UInt32 v;
+		std::memcpy(&v, p, sizeof(v));
+		return ByteOrder::fromLittleEndian(v);
+	}
+
+	inline UInt64 read64(const unsigned char* p)
+	{
+		UInt64 v;
+		std::memcpy(&v, p, sizeof(v));
+		return ByteOrder::fromLittleEndian(v);
+	}
+
+	inline void write64(unsigned char* p, UInt64 v)
+	{
+		v = ByteOrder::toLittleEndian(v);
+		std::memcpy(p, &v, sizeof(v));
+	}
+
+	inline UInt64 rotl64(UInt64 x, int r)
+	{
+		return (x << r) | (x >> (64 - r));
+	}
+
+	inline UInt64 swap64(UInt64 x)
+	{
+		return ByteOrder::flipBytes(x);
+	}
+
+	inline UInt64 mul128Fold64(UInt64 lhs, UInt64 rhs)
+	{
+#if defined(__SIZEOF_INT128__)
+		unsigned __int128 product = static_cast<unsigned __int128>(lhs)*rhs;
+		return static_cast<UInt64>(product) ^ static_cast<UInt64>(product >> 64);
+#else
+		UInt64 loLo = (lhs & 0xFFFFFFFF)*(rhs & 0xFFFFFFFF);
+		UInt64 hiLo = (lhs >> 32)*(rhs & 0xFFFFFFFF);
+		UInt64 loHi = (lhs & 0xFFFFFFFF)*(rhs >> 32);
+		UInt64 hiHi = (lhs >> 32)*(rhs >> 32);
+		UInt64 cross = (loLo >> 32) + (hiLo & 0xFFFFFFFF) + loHi;
+		UInt64 upper = (hiLo >> 32) + (cross >> 32) + hiHi;
+		UInt64 lower = (cross << 32) | (loLo & 0xFFFFFFFF);
+		return lower ^ upper;
+#endif
+	}
+
+	inline UInt64 xxh64Avalanche(UInt64 h)
+	{
+		h ^= h >> 33;
+		h *= PRIME64_2;
+		h ^= h >> 29;
+		h *= PRIME64_3;
+		h ^= h >> 32;
+		return h;
+	}
+
+	inline UInt64 avalanche(UInt64 h)
+	{
+		h ^= h >> 37;
+		h *= PRIME_MX1;
+		h ^= h >> 32;
+		return h;
+	}
+
+	inline UInt64 rrmxmx(UInt64 h, UInt64 length)
+	{
+		h ^= rotl64(h, 49) ^ rotl64(h, 24);
+		h *= PRIME_MX2;
+		h ^= (h >> 35) + length;
+		h *= PRIME_MX2;
+		return h ^ (h >> 28);
+	}
+
+	inline UInt64 hash0to16(const unsigned char* p, std::size_t length, const unsigned char* secret, UInt64 seed)
+	{
+		if (length > 8)
+		{
+			UInt64 bitflip1 = (read64(secret + 24) ^ read64(secret + 32)) + seed;
+			UInt64 bitflip2 = (read64(secret + 40) ^ read64(secret + 48)) - seed;
+			UInt64 lo = read64(p) ^ bitflip1;
+			UInt64 hi = read64(p + length - 8) ^ bitflip2;
+			UInt64 acc = length + swap64(lo) + hi + mul128Fold64(lo, hi);
+			return avalanche(acc);
+		}
+		else if (length >= 4)
+		{
+			seed ^= static_cast<UInt64>(ByteOrder::flipBytes(static_cast<UInt32>(seed))) << 32;
+			UInt32 in1 = read32(p);
+			UInt32 in2 = read32(p + length - 4);
+			UInt64 bitflip = (read64(secret + 8) ^ read64(secret + 16)) - seed;
+			UInt64 in64 = in2 + (static_cast<UInt64>(in1) << 32);
+			return rrmxmx(in64 ^ bitflip, length);
+		}
+		else if (length > 0)
+		{
+			UInt32 c1 = p[0];
+			UInt32 c2 = p[length >> 1];
+			UInt32 c3 = p[length - 1];
+			UInt32 combined = (c1 << 16) | (c2 << 24) | c3 | (static_cast<UInt32>(length) << 8);
+			UInt64 bitflip = (read32(secret) ^ read32(secret + 4)) + seed;
+			return xxh64Avalanche(combined ^ bitflip);
+		}
+		else
+		{
+			return xxh64Avalanche(seed ^ (read64(secret + 56) ^ read64(secret + 64)));
+		}
+	}
+
+	inline UInt64 mix16(const unsigned char* p, const unsigned char* secret, UInt64 seed)
+	{
+		UInt64 lo = read64(p);
+		UInt64 hi = read64(p + 8);
+		return mul128Fold64(lo ^ (read64(secret) + seed), hi ^ (read64(secret + 8) - seed));
+	}
+
+	UInt64 hash17to128(const unsigned char* p, std::size_t length, const unsigned char* secret, UInt64 seed)
+	{
+		UInt64 acc = length*PRIME64_1;
+		if (length > 32)
+		{
+			if (length > 64)
+			{
+				if (length > 96)
+				{
+					acc += mix16(p + 48, secret + 96, seed);
+					acc += mix16(p + length - 64, secret + 112, seed);
+				}
+				acc += mix16(p + 32, secret + 64, seed);
+				acc += mix16(p + length - 48, secret + 80, seed);
+			}
+			acc += mix16(p + 16, secret + 32, seed);
+			acc += mix16(p + length - 32, secret + 48, seed);
+		}
+		acc += mix16(p, secret, seed);
+		acc += mix16(p + length - 16, secret + 16, seed);
+		return avalanche(acc);
+	}
+
+	UInt64 hash129to240(const unsigned char* p, std::size_t length, const unsigned char* secret, UInt64 seed)
+	{
+		UInt64 acc = length*PRIME64_1;
+		const std::size_t rounds = length/16;
+		for (std::size_t i = 0; i < 8; i++)
+		{
+			acc += mix16(p + 16*i, secret + 16*i, seed);
+		}
+		UInt64 accEnd = mix16(p + length - 16, secret + SECRET_SIZE_MIN - MIDSIZE_LASTOFFSET, seed);
+		acc = avalanche(acc);
+		for (std::size_t i = 8; i < rounds; i++)
+		{
+			accEnd += mix16(p + 16*i, secret + 16*(i - 8) + MIDSIZE_STARTOFFSET, seed);
+		}
+		return avalanche(acc + accEnd);
+	}
+
+	inline UInt64 hashShort(const unsigned char* p, std::size_t length, UInt64 seed)
+	{
+		if (length <= 16) return hash0to16(p, length, DEFAULT_SECRET, seed);
+		if (length <= 128) return hash17to128(p, length, DEFAULT_SECRET, seed);
+		return hash129to240(p, length, DEFAULT_SECRET, seed);
+	}
+
+	//
+	// Long inputs: 64 byte stripes are accumulated into eight 64-bit lanes.
+	//
+
+	inline void accumulate512(UInt64* acc, const unsigned char* p, const unsigned char* secret)
+	{
+#if defined(POCO_XXH3_SSE2)
+		__m128i* xacc = reinterpret_cast<__m128i*>(acc);
+		for (int i = 0; i < 4; i++)
+		{
+			__m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p) + i);
+			__m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i);
+			__m128i dataKey = _mm_xor_si128(data, key);
+			__m128i dataKeyHi = _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1));
+			__m128i product = _mm_mul_epu32(dataKey, dataKeyHi);
+			__m128i dataSwap = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+			__m128i sum = _mm_add_epi64(_mm_load_si128(xacc + i), dataSwap);
+			_mm_store_si128(xacc + i, _mm_add_epi64(product, sum));
+		}
+#else
+		for (int i = 0; i < 8; i++)
+		{
+			UInt64 data = read64(p + 8*i);
+			UInt64 dataKey = data ^ read64(secret + 8*i);
+			acc[i ^ 1] += data;
+			acc[i] += (dataKey & 0xFFFFFFFF)*(dataKey >> 32);
+		}
+#endif
+	}
+
+	inline void scramble(UInt64* acc, const unsigned char* secret)
+	{
+#if defined(POCO_XXH3_SSE2)
+		__m128i* xacc = reinterpret_cast<__m128i*>(acc);
+		const __m128i prime = _mm_set1_epi32(static_cast<int>(PRIME32_1));
+		for (int i = 0; i < 4; i++)
+		{
+			__m128i a = _mm_load_si128(xacc + i);
+			a = _mm_xor_si128(a, _mm_srli_epi64(a, 47));
+			__m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i);
+			__m128i dataKey = _mm_xor_si128(a, key);
+			__m128i dataKeyHi = _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1));
+			__m128i productLo = _mm_mul_epu32(dataKey, prime);
+			__m128i productHi = _mm_mul_epu32(dataKeyHi, prime);
+			_mm_store_si128(xacc + i, _mm_add_epi64(productLo, _mm_slli_epi64(productHi, 32)));
+		}
+#else
+		for (int i = 0; i < 8; i++)
+		{
+			UInt64 a = acc[i];
+			a ^= a >> 47;
+			a ^= read64(secret + 8*i);
+			a *= PRIME32_1;
+			acc[i] = a;
+		}
+#endif
+	}
+
+	inline void accumulate(UInt64* acc, const unsigned char* p, const unsigned char* secret, std::size_t stripes)
+	{
+		for (std::size_t n = 0; n < stripes; n++)
+		{
+			accumulate512(acc, p + n*STRIPE_SIZE, secret + n*SECRET_CONSUME_RATE);
+		}
+	}
+
+	inline void initAcc(UInt64* acc)
+	{
+		acc[0] = PRIME32_3;
+		acc[1] = PRIME64_1;
+		acc[2] = PRIME64_2;
+		acc[3] = PRIME64_3;
+		acc[4] = PRIME64_4;
+		acc[5] = PRIME32_2;
+		acc[6] = PRIME64_5;
+		acc[7] = PRIME32_1;
+	}
+
+	UInt64 mergeAccs(const UInt64* acc, const unsigned char* secret, UInt64 start)
+	{
+		UInt64 result = start;
+		for (int i = 0; i < 4; i++)
+		{
+			result += mul128Fold64(acc[2*i] ^ read64(secret + 16*i), acc[2*i + 1] ^ read64(secret + 16*i + 8));
+		}
+		return avalanche(result);
+	}
+
+	void initSecret(unsigned char* secret, UInt64 seed)
+	{
+		for (std::size_t i = 0; i < SECRET_SIZE/16; i++)
+		{
+			write64(secret + 16*i, read64(DEFAULT_SECRET + 16*i) + seed);
+			write64(secret + 16*i + 8, read64(DEFAULT_SECRET + 16*i + 8) - seed);
+		}
+	}
+
+	UInt64 hashLong(const unsigned char* p, std::size_t length, const unsigned char* secret)
+	{
+		alignas(16) UInt64 acc[8];
+		initAcc(acc);
+
+		const std::size_t blockSize = STRIPE_SIZE*STRIPES_PER_BLOCK;
+		const std::size_t blocks = (length - 1)/blockSize;
+		for (std::size_t n = 0; n < blocks; n++)
+		{
+			accumulate(acc, p + n*blockSize, secret, STRIPES_PER_BLOCK);
+			scramble(acc, secret + SECRET_SIZE - STRIPE_SIZE);
+		}
+		const std::size_t stripes = ((length - 1) - blockSize*blocks)/STRIPE_SIZE;
+		accumulate(acc, p + blocks*blockSize, secret, stripes);
+		accumulate512(acc, p + length - STRIPE_SIZE, secret + SECRET_SIZE - STRIPE_SIZE - SECRET_LASTACC_START);
+
+		return mergeAccs(acc, secret + SECRET_MERGEACCS_START, static_cast<UInt64>(length)*PRIME64_1);
+	}
+
+	void consumeStripes(UInt64* acc, std::size_t& stripesSoFar, const unsigned char* p, std::size_t stripes, const unsigned char* secret)
+	{
+		if (STRIPES_PER_BLOCK - stripesSoFar <= stripes)
+		{
+			// finish the current block
+			std::size_t count = STRIPES_PER_BLOCK - stripesSoFar;
+			accumulate(acc, p, secret + stripesSoFar*SECRET_CONSUME_RATE, count);
+			scramble(acc, secret + SECRET_SIZE - STRIPE_SIZE);
+			p += count*STRIPE_SIZE;
+			stripes -= count;
+			stripesSoFar = 0;
+			while (stripes >= STRIPES_PER_BLOCK)
+			{
+				accumulate(acc, p, secret, STRIPES_PER_BLOCK);
+				scramble(acc, secret + SECRET_SIZE - STRIPE_SIZE);
+				p += STRIPES_PER_BLOCK*STRIPE_SIZE;
+				stripes -= STRIPES_PER_BLOCK;
+			}
+		}
+		accumulate(acc, p, secret + stripesSoFar*SECRET_CONSUME_RATE, stripes);
+		stripesSoFar += stripes;
+	}
+}
+
+
+XXH3::XXH3(UInt64 seed)
+{
+	reset(seed);
+}
+
+
+XXH3::~XXH3()
+{
+}
+
+
+void XXH3::reset()
+{
+	initAcc(_acc);
+	_bufferedSize = 0;
+	_stripesSoFar = 0;
+	_totalLength = 0;
+}
+
+
+void XXH3::reset(UInt64 seed)
+{
+	_seed = seed;
+	initSecret(_secret, seed);
+	reset();
+}
+
+
+void XXH3::update(const void* data, std::size_t length)
+{
+	if (length == 0) return;
+
+	const unsigned char* p = static_cast<const unsigned char*>(data);
+	const unsigned char* end = p + length;
+	_totalLength += length;
+
+	if (length <= BUFFER_SIZE - _bufferedSize)
+	{
+		std::memcpy(_buffer + _bufferedSize, p, length);
+		_bufferedSize += length;
+		return;
+	}
+
+	// The buffer is only consumed once more data follows, so the last
+	// stripe is always available for digest().
+	if (_bufferedSize > 0)
+	{
+		std::size_t fill = BUFFER_SIZE - _bufferedSize;
+		std::memcpy(_buffer + _bufferedSize, p, fill);
+		p += fill;
+		consumeStripes(_acc, _stripesSoFar, _buffer, BUFFER_SIZE/STRIPE_SIZE, _secret);
+		_bufferedSize = 0;
+	}
+	if (static_cast<std::size_t>(end - p) > BUFFER_SIZE)
+	{
+		std::size_t stripes = static_cast<std::size_t>(end - 1 - p)/STRIPE_SIZE;
+		consumeStripes(_acc, _stripesSoFar, p, stripes, _secret);
+		p += stripes*STRIPE_SIZE;
+		// keep the last consumed stripe for digest()
+		std::memcpy(_buffer + BUFFER_SIZE - STRIPE_SIZE, p - STRIPE_SIZE, STRIPE_SIZE);
+	}
+	_bufferedSize = static_cast<std::size_t>(end - p);
+	std::memcpy(_buffer, p, _bufferedSize);
+}
+
+
+UInt64 XXH3::digest() const
+{
+	if (_totalLength <= MIDSIZE_MAX)
+	{
+		return hashShort(_buffer, static_cast<std::size_t>(_totalLength), _seed);
+	}
+
+	alignas(16) UInt64 acc[8];
+	std::memcpy(acc, _acc, sizeof(acc));
+	const unsigned char* pLastStripe;
+	unsigned char lastStripe[STRIPE_SIZE];
+	if (_bufferedSize >= STRIPE_SIZE)
+	{
+		std::size_t stripes = (_bufferedSize - 1)/STRIPE_SIZE;
+		std::size_t stripesSoFar = _stripesSoFar;
+		consumeStripes(acc, stripesSoFar, _buffer, stripes, _secret);
+		pLastStripe = _buffer + _bufferedSize - STRIPE_SIZE;
+	}
+	else
+	{
+		// the last stripe spans the end of the buffer and the buffered data
+		std::size_t catchUp = STRIPE_SIZE - _bufferedSize;
+		std::memcpy(lastStripe, _buffer + BUFFER_SIZE - catchUp, catchUp);
+		std::memcpy(lastStripe + catchUp, _buffer, _bufferedSize);
+		pLastStripe = lastStripe;
+	}
+	accumulate512(acc, pLastStripe, _secret + SECRET_SIZE - STRIPE_SIZE - SECRET_LASTACC_START);
+	return mergeAccs(acc, _secret + SECRET_MERGEACCS_START, _totalLength*PRIME64_1);
+}
+
+
+UInt64 XXH3::hash(const void* data, std::size_t length, UInt64 seed)
+{
+	const unsigned char* p = static_cast<const unsigned char*>(data);
+	if (length <= MIDSIZE_MAX)
+	{
+		return hashShort(p, length, seed);
+	}
+	else if (seed == 0)
+	{
+		return hashLong(p, length, DEFAULT_SECRET);
+	}
+	else
+	{
+		alignas(64) unsigned char secret[SECRET_SIZE];
+		initSecret(secret, seed);
+		return hashLong(p, length, secret);
+	}
+}
+
+
+} // namespace Poco
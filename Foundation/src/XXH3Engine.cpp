@@ -0,0 +1,64 @@
+//
+// XXH3Engine.cpp
+//
+// Library: Foundation
+// Package: Crypt
+// Module:  XXH3Engine
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/XXH3Engine.h"
+
+
+namespace Poco {
+
+
+XXH3Engine::XXH3Engine(UInt64 seed):
+	_xxh3(seed)
+{
+	_digest.reserve(DIGEST_SIZE);
+}
+
+
+XXH3Engine::~XXH3Engine()
+{
+}
+
+
+void XXH3Engine::updateImpl(const void* data, std::size_t length)
+{
+	_xxh3.update(data, length);
+}
+
+
+std::size_t XXH3Engine::digestLength() const
+{
+	return DIGEST_SIZE;
+}
+
+
+void XXH3Engine::reset()
+{
+	_xxh3.reset();
+}
+
+
+const DigestEngine::Digest& XXH3Engine::digest()
+{
+	UInt64 value = _xxh3.digest();
+	_digest.clear();
+	for (int shift = 56; shift >= 0; shift -= 8)
+	{
+		_digest.push_back(static_cast<unsigned char>(value >> shift));
+	}
+	reset();
+	return _digest;
+}
+
+
+} // namespace Poco
@@ -524,6 +524,40 @@ void AsyncNotificationCenterTest::testEdgeCases()
 }
 
 
+void AsyncNotificationCenterTest::testObserverQueueOrder()
+{
+#if (POCO_HAVE_JTHREAD)
+	// More notifications than fit into an observer's queue,
+	// so some of them go to the overflow list.
+	const int count = 5000;
+	{
+		AsyncNotificationCenter nc(AsyncMode::NOTIFY, 4);
+		nc.addNObserver(*this, &AsyncNotificationCenterTest::handleSequence);
+		nc.addNObserver(*this, &AsyncNotificationCenterTest::handleCount);
+
+		for (int i = 0; i < count; ++i)
+		{
+			nc.postNotification(new TestNotification(std::to_string(i)));
+		}
+
+		assertTrue(waitForCondition([&]{ return _notificationCount >= count; }, 10000));
+		assertTrue(waitForCondition([&]{ Poco::Mutex::ScopedLock l(_mutex); return _sequence.size() >= count; }, 10000));
+		assertEqual(0, nc.backlog());
+
+		nc.removeNObserver(*this, &AsyncNotificationCenterTest::handleSequence);
+		nc.removeNObserver(*this, &AsyncNotificationCenterTest::handleCount);
+	}
+
+	Poco::Mutex::ScopedLock l(_mutex);
+	assertEqual(count, static_cast<int>(_sequence.size()));
+	for (int i = 0; i < count; ++i)
+	{
+		assertEqual(i, _sequence[i]);
+	}
+#endif
+}
+
+
 #if (POCO_HAVE_JTHREAD)
 
 void AsyncNotificationCenterTest::workerCount(AsyncMode mode)
@@ -738,6 +772,13 @@ void AsyncNotificationCenterTest::handleThreadSafe(const AutoPtr<Notification>&
 }
 
 
+void AsyncNotificationCenterTest::handleSequence(const AutoPtr<Notification>& pNf)
+{
+	Poco::Mutex::ScopedLock l(_mutex);
+	_sequence.push_back(std::stoi(pNf->name()));
+}
+
+
 bool AsyncNotificationCenterTest::matchAsync(const std::string& name) const
 {
 	return name.find("asyncNotification") == 0;
@@ -751,6 +792,7 @@ void AsyncNotificationCenterTest::resetState()
 	_syncCallCount = 0;
 	_threadSafeCount = 0;
 	_exceptionCount = 0;
+	_sequence.clear();
 	_handleNObsDone = false;
 #ifdef POCO_TEST_DEPRECATED
 	_handle1Done = false;
@@ -793,6 +835,7 @@ CppUnit::Test* AsyncNotificationCenterTest::suite()
 	CppUnit_addTest(pSuite, AsyncNotificationCenterTest, testObserverLifecycle);
 	CppUnit_addTest(pSuite, AsyncNotificationCenterTest, testCleanupDestruction);
 	CppUnit_addTest(pSuite, AsyncNotificationCenterTest, testEdgeCases);
+	CppUnit_addTest(pSuite, AsyncNotificationCenterTest, testObserverQueueOrder);
 
 	return pSuite;
 }
@@ -22,6 +22,7 @@
 #include "Poco/Mutex.h"
 #include "Poco/AsyncNotificationCenter.h"
 #include <set>
+#include <vector>
 
 
 class TestNotification;
@@ -80,6 +81,9 @@ public:
 	void testEdgeCases();
 		/// Tests edge cases: empty observer list, stress testing, dynamic observer registration
 
+	void testObserverQueueOrder();
+		/// Tests that each observer receives notifications in posting order, also if its queue overflows
+
 	void setUp();
 	void tearDown();
 
@@ -97,6 +101,7 @@ protected:
 	Poco::NotificationResult handleSync(const Poco::AutoPtr<Poco::Notification>& pNf);
 	void handleThrow(const Poco::AutoPtr<Poco::Notification>& pNf);
 	void handleThreadSafe(const Poco::AutoPtr<Poco::Notification>& pNf);
+	void handleSequence(const Poco::AutoPtr<Poco::Notification>& pNf);
 	bool matchAsync(const std::string& name) const;
 
 	void resetState();
@@ -126,6 +131,7 @@ private:
 	std::atomic<int> _syncCallCount;
 	std::atomic<int> _threadSafeCount;
 	std::atomic<int> _exceptionCount;
+	std::vector<int> _sequence;
 	Poco::Mutex _mutex;
 };
 
@@ -19,8 +19,13 @@
 #include "Poco/FormattingChannel.h"
 #include "Poco/ConsoleChannel.h"
 #include "Poco/StreamChannel.h"
+#include "Poco/Event.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/NumberParser.h"
+#include "Poco/StringTokenizer.h"
 #include "TestChannel.h"
 #include <sstream>
+#include <vector>
 
 
 using Poco::SplitterChannel;
@@ -73,6 +78,37 @@ private:
 };
 
 
+class BlockingChannel: public TestChannel
+	/// Blocks when logging the first message, until released.
+{
+public:
+	void log(const Message& msg)
+	{
+		if (!_entered.tryWait(0))
+		{
+			_entered.set();
+			_release.wait();
+		}
+		TestChannel::log(msg);
+	}
+
+	void waitEntered()
+	{
+		_entered.wait();
+		_entered.set();
+	}
+
+	void release()
+	{
+		_release.set();
+	}
+
+private:
+	Poco::Event _entered{Poco::Event::EVENT_MANUALRESET};
+	Poco::Event _release{Poco::Event::EVENT_MANUALRESET};
+};
+
+
 ChannelTest::ChannelTest(const std::string& name) : CppUnit::TestCase(name)
 {
 }
@@ -131,6 +167,123 @@ void ChannelTest::testAsync()
 }
 
 
+void ChannelTest::testAsyncRing()
+{
+	const int THREADS = 4;
+	const int MESSAGES = 2000;
+
+	AutoPtr<TestChannel> pChannel = new TestChannel;
+	AutoPtr<AsyncChannel> pAsync = new AsyncChannel(pChannel);
+	pAsync->setProperty("ringBufferSize", "16");
+	pAsync->setProperty("batchSize", "8");
+	pAsync->open();
+
+	AsyncChannel* pAsyncChannel = pAsync.get();
+	std::vector<Thread> threads(THREADS);
+	for (int t = 0; t < THREADS; t++)
+	{
+		threads[t].startFunc([pAsyncChannel, t]()
+			{
+				for (int i = 0; i < MESSAGES; i++)
+				{
+					pAsyncChannel->log(Message("Source", Poco::NumberFormatter::format(t) + ":" + Poco::NumberFormatter::format(i), Message::PRIO_INFORMATION));
+				}
+			});
+	}
+	for (auto& thread: threads) thread.join();
+	pAsync->close();
+
+	// With the block policy, no message must be lost, and
+	// messages of the same thread must be delivered in order.
+	assertTrue (pChannel->list().size() == THREADS*MESSAGES);
+	std::vector<int> next(THREADS, 0);
+	for (const auto& msg: pChannel->list())
+	{
+		Poco::StringTokenizer tok(msg.getText(), ":");
+		int t = Poco::NumberParser::parse(tok[0]);
+		int i = Poco::NumberParser::parse(tok[1]);
+		assertTrue (i == next[t]);
+		next[t]++;
+	}
+
+	try
+	{
+		pAsync->setProperty("ringBufferSize", "32");
+		fail("open channel - must throw");
+	}
+	catch (Poco::IllegalStateException&)
+	{
+	}
+}
+
+
+void ChannelTest::testAsyncRingOverflow()
+{
+	AutoPtr<BlockingChannel> pChannel = new BlockingChannel;
+	AutoPtr<AsyncChannel> pAsync = new AsyncChannel(pChannel);
+	pAsync->setProperty("ringBufferSize", "8");
+	pAsync->setProperty("overflowPolicy", "drop");
+
+	// The first message blocks the background thread,
+	// and keeps its slot occupied.
+	pAsync->log(Message("Source", "first", Message::PRIO_INFORMATION));
+	pChannel->waitEntered();
+	for (int i = 0; i < 20; i++)
+	{
+		pAsync->log(Message("Source", "text", Message::PRIO_INFORMATION));
+	}
+	pChannel->release();
+	pAsync->close();
+
+	assertTrue (pChannel->list().size() == 9);
+	assertTrue (pChannel->list().front().getText() == "first");
+	assertTrue (pChannel->list().back().getText() == "Dropped 13 messages.");
+}
+
+
+void ChannelTest::testAsyncRingSample()
+{
+	AutoPtr<BlockingChannel> pChannel = new BlockingChannel;
+	AutoPtr<AsyncChannel> pAsync = new AsyncChannel(pChannel);
+	pAsync->setProperty("ringBufferSize", "8");
+	pAsync->setProperty("overflowPolicy", "sample");
+	pAsync->setProperty("sampleRate", "10");
+
+	pAsync->log(Message("Source", "first", Message::PRIO_INFORMATION));
+	pChannel->waitEntered();
+
+	// Until the ring buffer is half full, all messages are queued.
+	for (int i = 0; i < 3; i++)
+	{
+		pAsync->log(Message("Source", "info", Message::PRIO_INFORMATION));
+	}
+	// Then only every 10th message below error.
+	for (int i = 0; i < 20; i++)
+	{
+		pAsync->log(Message("Source", "sampled", Message::PRIO_INFORMATION));
+	}
+	// Errors are queued as long as there is space.
+	for (int i = 0; i < 3; i++)
+	{
+		pAsync->log(Message("Source", "error", Message::PRIO_ERROR));
+	}
+	pChannel->release();
+	pAsync->close();
+
+	int sampled = 0;
+	int errors = 0;
+	for (const auto& msg: pChannel->list())
+	{
+		if (msg.getText() == "sampled") sampled++;
+		else if (msg.getText() == "error") errors++;
+	}
+	assertTrue (sampled == 2);
+	assertTrue (errors == 2);
+	assertTrue (pChannel->list().size() == 9);
+	assertTrue (pChannel->list().back().getText() == "Dropped 19 messages.");
+}
+
+
 void ChannelTest::testFormatting()
 {
 	AutoPtr<TestChannel> pChannel = new TestChannel;
@@ -182,6 +335,9 @@ CppUnit::Test* ChannelTest::suite()
 	CppUnit_addTest(pSuite, ChannelTest, testSplitter);
 	CppUnit_addTest(pSuite, ChannelTest, testSplitterAddSameChannelTwice);
 	CppUnit_addTest(pSuite, ChannelTest, testAsync);
+	CppUnit_addTest(pSuite, ChannelTest, testAsyncRing);
+	CppUnit_addTest(pSuite, ChannelTest, testAsyncRingOverflow);
+	CppUnit_addTest(pSuite, ChannelTest, testAsyncRingSample);
 	CppUnit_addTest(pSuite, ChannelTest, testFormatting);
 	CppUnit_addTest(pSuite, ChannelTest, testConsole);
 	CppUnit_addTest(pSuite, ChannelTest, testStream);
@@ -27,6 +27,9 @@ public:
 	void testSplitter();
 	void testSplitterAddSameChannelTwice();
 	void testAsync();
+	void testAsyncRing();
+	void testAsyncRingOverflow();
+	void testAsyncRingSample();
 	void testFormatting();
 	void testConsole();
 	void testStream();
@@ -0,0 +1,172 @@
+//
+// ChecksumTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ChecksumTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Checksum.h"
+#include "Poco/ChecksumEngine.h"
+#include "Poco/CRC.h"
+#include "Poco/DigestStream.h"
+#include <vector>
+
+
+using Poco::Checksum;
+using Poco::ChecksumEngine;
+using Poco::CRC;
+using Poco::DigestEngine;
+using Poco::DigestOutputStream;
+using Poco::UInt32;
+
+
+namespace
+{
+	UInt32 bitwiseCRC(UInt32 polynomial, const unsigned char* p, std::size_t n)
+	{
+		UInt32 crc = 0xFFFFFFFF;
+		while (n--)
+		{
+			crc ^= *p++;
+			for (int k = 0; k < 8; k++)
+			{
+				crc = (crc & 1) ? (crc >> 1) ^ polynomial : crc >> 1;
+			}
+		}
+		return ~crc;
+	}
+}
+
+
+ChecksumTest::ChecksumTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+ChecksumTest::~ChecksumTest()
+{
+}
+
+
+void ChecksumTest::testCRC32()
+{
+	Checksum checksum;
+	assertTrue (checksum.type() == Checksum::TYPE_CRC32);
+	assertTrue (checksum.checksum() == 0);
+
+	checksum.update("123456789");
+	assertTrue (checksum.checksum() == 0xCBF43926);
+
+	checksum.reset();
+	checksum.update("The quick brown fox ");
+	checksum.update("jumps over the lazy dog");
+	assertTrue (checksum.checksum() == 0x414FA339);
+
+	assertTrue (CRC::crc32(0, "123456789", 9) == 0xCBF43926);
+	assertTrue (CRC::crc32(CRC::crc32(0, "12345", 5), "6789", 4) == 0xCBF43926);
+}
+
+
+void ChecksumTest::testCRC32C()
+{
+	Checksum checksum(Checksum::TYPE_CRC32C);
+	assertTrue (checksum.type() == Checksum::TYPE_CRC32C);
+	checksum.update("123456789");
+	assertTrue (checksum.checksum() == 0xE3069283);
+
+	// test vectors from RFC 3720, B.4
+	std::vector<unsigned char> data(32, 0);
+	assertTrue (CRC::crc32c(0, data.data(), data.size()) == 0x8A9136AA);
+	data.assign(32, 0xFF);
+	assertTrue (CRC::crc32c(0, data.data(), data.size()) == 0x62A8AB43);
+	for (int i = 0; i < 32; i++) data[i] = static_cast<unsigned char>(i);
+	assertTrue (CRC::crc32c(0, data.data(), data.size()) == 0x46DD794E);
+	for (int i = 0; i < 32; i++) data[i] = static_cast<unsigned char>(31 - i);
+	assertTrue (CRC::crc32c(0, data.data(), data.size()) == 0x113FDB5C);
+}
+
+
+void ChecksumTest::testAdler32()
+{
+	Checksum checksum(Checksum::TYPE_ADLER32);
+	assertTrue (checksum.checksum() == 1);
+	checksum.update("Wikipedia");
+	assertTrue (checksum.checksum() == 0x11E60398);
+	checksum.reset();
+	assertTrue (checksum.checksum() == 1);
+}
+
+
+void ChecksumTest::testCRCLengths()
+{
+	// all lengths and alignments, to cover the accelerated
+	// implementations as well as the handling of the remaining bytes
+	std::vector<unsigned char> data(1100);
+	UInt32 x = 1;
+	for (auto& c: data)
+	{
+		x = x*1103515245 + 12345;
+		c = static_cast<unsigned char>(x >> 16);
+	}
+	for (std::size_t offset = 0; offset < 8; offset++)
+	{
+		for (std::size_t length = 0; length + offset <= data.size(); length += (length < 300 ? 1 : 37))
+		{
+			const unsigned char* p = data.data() + offset;
+			assertTrue (CRC::crc32(0, p, length) == bitwiseCRC(0xEDB88320, p, length));
+			assertTrue (CRC::crc32c(0, p, length) == bitwiseCRC(0x82F63B78, p, length));
+
+			std::size_t half = length/2;
+			assertTrue (CRC::crc32(CRC::crc32(0, p, half), p + half, length - half) == CRC::crc32(0, p, length));
+			assertTrue (CRC::crc32c(CRC::crc32c(0, p, half), p + half, length - half) == CRC::crc32c(0, p, length));
+		}
+	}
+}
+
+
+void ChecksumTest::testChecksumEngine()
+{
+	ChecksumEngine engine;
+	assertTrue (engine.type() == Checksum::TYPE_CRC32C);
+	assertTrue (engine.digestLength() == 4);
+	engine.update("123456789");
+	assertTrue (DigestEngine::digestToHex(engine.digest()) == "e3069283");
+	engine.update("");
+	assertTrue (DigestEngine::digestToHex(engine.digest()) == "00000000");
+
+	ChecksumEngine crc32Engine(Checksum::TYPE_CRC32);
+	DigestOutputStream ostr(crc32Engine);
+	ostr << "123456789";
+	ostr.flush();
+	assertTrue (DigestEngine::digestToHex(crc32Engine.digest()) == "cbf43926");
+}
+
+
+void ChecksumTest::setUp()
+{
+}
+
+
+void ChecksumTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ChecksumTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ChecksumTest");
+
+	CppUnit_addTest(pSuite, ChecksumTest, testCRC32);
+	CppUnit_addTest(pSuite, ChecksumTest, testCRC32C);
+	CppUnit_addTest(pSuite, ChecksumTest, testAdler32);
+	CppUnit_addTest(pSuite, ChecksumTest, testCRCLengths);
+	CppUnit_addTest(pSuite, ChecksumTest, testChecksumEngine);
+
+	return pSuite;
+}
@@ -16,6 +16,7 @@
 #include "HMACEngineTest.h"
 #include "PBKDF2EngineTest.h"
 #include "DigestStreamTest.h"
+#include "ChecksumTest.h"
 #include "RandomTest.h"
 #include "RandomStreamTest.h"
 
@@ -31,6 +32,7 @@ CppUnit::Test* CryptTestSuite::suite()
 	pSuite->addTest(HMACEngineTest::suite());
 	pSuite->addTest(PBKDF2EngineTest::suite());
 	pSuite->addTest(DigestStreamTest::suite());
+	pSuite->addTest(ChecksumTest::suite());
 	pSuite->addTest(RandomTest::suite());
 	pSuite->addTest(RandomStreamTest::suite());
 
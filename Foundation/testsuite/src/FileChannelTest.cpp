@@ -29,6 +29,9 @@
 #include "Poco/RotateStrategy.h"
 #include "Poco/ArchiveStrategy.h"
 #include "Poco/PurgeStrategy.h"
+#include "Poco/InflatingStream.h"
+#include "Poco/FileStream.h"
+#include "Poco/StreamCopier.h"
 #include <vector>
 #include <iostream>
 
@@ -560,6 +563,51 @@ void FileChannelTest::testCompress()
 }
 
 
+void FileChannelTest::testCompressThreads()
+{
+	std::string name = filename();
+	try
+	{
+		AutoPtr<FileChannel> pChannel = new FileChannel(name);
+		pChannel->setProperty(FileChannel::PROP_ROTATION, "100 K");
+		pChannel->setProperty(FileChannel::PROP_ARCHIVE, "number");
+		pChannel->setProperty(FileChannel::PROP_COMPRESS, "true");
+		pChannel->setProperty(FileChannel::PROP_COMPRESSTHREADS, "4");
+		assertTrue (pChannel->getProperty(FileChannel::PROP_COMPRESSTHREADS) == "4");
+		try
+		{
+			pChannel->setProperty(FileChannel::PROP_COMPRESSTHREADS, "-1");
+			fail("negative number of threads - must throw");
+		}
+		catch (InvalidArgumentException&)
+		{
+		}
+		pChannel->open();
+		Message msg("source", "This is a log file entry", Message::PRIO_INFORMATION);
+		for (int i = 0; i < 10000; ++i)
+		{
+			pChannel->log(msg);
+		}
+		Thread::sleep(3000); // allow time for background compression
+		File f0(name + ".0.gz");
+		assertTrue (f0.exists());
+
+		Poco::FileInputStream istr(f0.path());
+		Poco::InflatingInputStream inflater(istr, Poco::InflatingStreamBuf::STREAM_GZIP);
+		std::string data;
+		Poco::StreamCopier::copyToString(inflater, data);
+		assertTrue (data.size() >= 100*1024);
+		assertTrue (data.find("This is a log file entry") == 0);
+	}
+	catch (...)
+	{
+		remove(name);
+		throw;
+	}
+	remove(name);
+}
+
+
 void FileChannelTest::testCompressedRotation()
 {
 	static const uint32_t MAX_ROLLOVER_TIMES = 8;
@@ -959,6 +1007,7 @@ CppUnit::Test* FileChannelTest::suite()
 	CppUnit_addTest(pSuite, FileChannelTest, testArchive);
 	CppUnit_addTest(pSuite, FileChannelTest, testArchiveByStrategy);
 	CppUnit_addTest(pSuite, FileChannelTest, testCompress);
+	CppUnit_addTest(pSuite, FileChannelTest, testCompressThreads);
 	CppUnit_addTest(pSuite, FileChannelTest, testCompressedRotation);
 	CppUnit_addLongTest(pSuite, FileChannelTest, testPurgeAge);
 	CppUnit_addTest(pSuite, FileChannelTest, testPurgeCount);
@@ -13,12 +13,28 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/HashMap.h"
 #include "Poco/Exception.h"
+#include "Poco/NumberFormatter.h"
 #include <map>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 
 using Poco::HashMap;
 
 
+namespace
+{
+	struct ConstantHash
+	{
+		std::size_t operator () (int) const
+		{
+			return 0;
+		}
+	};
+}
+
+
 HashMapTest::HashMapTest(const std::string& name): CppUnit::TestCase(name)
 {
 }
@@ -198,6 +214,212 @@ void HashMapTest::testIndex()
 }
 
 
+void HashMapTest::testStringKeys()
+{
+	const int N = 1000;
+
+	typedef HashMap<std::string, int> StringMap;
+	StringMap hm;
+
+	for (int i = 0; i < N; ++i)
+	{
+		hm[Poco::NumberFormatter::format(i)] = i;
+	}
+	assertTrue (hm.size() == N);
+
+	for (int i = 0; i < N; ++i)
+	{
+		StringMap::ConstIterator it = hm.find(Poco::NumberFormatter::format(i));
+		assertTrue (it != hm.end());
+		assertTrue (it->second == i);
+	}
+	assertTrue (hm.find("-1") == hm.end());
+
+	for (int i = 0; i < N; i += 3)
+	{
+		hm.erase(Poco::NumberFormatter::format(i));
+	}
+	for (int i = 0; i < N; ++i)
+	{
+		assertTrue (hm.count(Poco::NumberFormatter::format(i)) == (i % 3 == 0 ? 0 : 1));
+	}
+}
+
+
+void HashMapTest::testHeterogeneousLookup()
+{
+	typedef HashMap<std::string, int> StringMap;
+	StringMap hm;
+
+	hm.insert(StringMap::PairType("one", 1));
+	hm.insert(StringMap::PairType("two", 2));
+	hm.insert(StringMap::PairType("three", 3));
+
+	std::string_view sv("two");
+	StringMap::Iterator it = hm.find(sv);
+	assertTrue (it != hm.end());
+	assertTrue (it->first == "two");
+	assertTrue (it->second == 2);
+
+	const StringMap& chm = hm;
+	StringMap::ConstIterator cit = chm.find("three");
+	assertTrue (cit != chm.end());
+	assertTrue (cit->second == 3);
+
+	std::string buffer("one,four");
+	assertTrue (hm.contains(std::string_view(buffer).substr(0, 3)));
+	assertTrue (!hm.contains(std::string_view(buffer).substr(4)));
+	assertTrue (hm.count(std::string_view("one")) == 1);
+
+	hm.erase(std::string_view("one"));
+	assertTrue (!hm.contains("one"));
+	assertTrue (hm.size() == 2);
+
+	// std::string keys use XXH3Hash by default, while Poco::Hash<std::string>
+	// still uses Poco::hash(), e.g. for LinearHashTable.
+	assertTrue ((std::is_same<StringMap::HashType, Poco::XXH3Hash<std::string>>::value));
+	assertTrue (Poco::Hash<std::string>()("two") == Poco::hash(std::string("two")));
+}
+
+
+void HashMapTest::testReserve()
+{
+	const int N = 1000;
+
+	typedef HashMap<int, int> IntMap;
+	IntMap hm;
+	hm.reserve(N);
+
+	IntMap::Iterator first = hm.insert(IntMap::ValueType(0, 0)).first;
+	const int* pFirst = &first->second;
+	for (int i = 1; i < N; ++i)
+	{
+		hm.insert(IntMap::ValueType(i, i*2));
+	}
+	// no rehash, so entries have not moved
+	assertTrue (&hm.find(0)->second == pFirst);
+	assertTrue (hm.size() == N);
+
+	IntMap hm2(N);
+	for (int i = 0; i < N; ++i)
+	{
+		hm2[i] = i;
+	}
+	assertTrue (hm2.size() == N);
+}
+
+
+void HashMapTest::testRandomOperations()
+{
+	const int N = 20000;
+
+	typedef HashMap<unsigned, unsigned> IntMap;
+	IntMap hm;
+	std::map<unsigned, unsigned> ref;
+
+	// small key range, so that many insertions hit deleted slots
+	unsigned x = 1;
+	for (int i = 0; i < N; ++i)
+	{
+		x = x*1103515245 + 12345;
+		unsigned key = (x >> 8) % 2000;
+		if ((x >> 4) % 3 == 0)
+		{
+			hm.erase(key);
+			ref.erase(key);
+		}
+		else
+		{
+			hm[key] = i;
+			ref[key] = i;
+		}
+		assertTrue (hm.size() == ref.size());
+	}
+
+	for (const auto& p: ref)
+	{
+		IntMap::ConstIterator it = hm.find(p.first);
+		assertTrue (it != hm.end());
+		assertTrue (it->second == p.second);
+	}
+
+	std::size_t n = 0;
+	for (IntMap::Iterator it = hm.begin(); it != hm.end(); ++it)
+	{
+		assertTrue (ref[it->first] == it->second);
+		++n;
+	}
+	assertTrue (n == ref.size());
+
+	hm.clear();
+	assertTrue (hm.empty());
+	assertTrue (hm.begin() == hm.end());
+}
+
+
+void HashMapTest::testCopyAndMove()
+{
+	typedef HashMap<std::string, std::string> StringMap;
+	StringMap hm;
+	for (int i = 0; i < 100; ++i)
+	{
+		hm[Poco::NumberFormatter::format(i)] = std::string(50, 'a' + i % 26);
+	}
+
+	StringMap hm2(hm);
+	assertTrue (hm2.size() == 100);
+	assertTrue (hm2["42"] == hm["42"]);
+
+	StringMap hm3;
+	hm3 = hm;
+	hm.clear();
+	assertTrue (hm3.size() == 100);
+	assertTrue (hm3["99"] == std::string(50, 'a' + 99 % 26));
+
+	StringMap hm4(std::move(hm2));
+	assertTrue (hm4.size() == 100);
+	assertTrue (hm4.contains("0"));
+
+	hm4.swap(hm);
+	assertTrue (hm.size() == 100);
+	assertTrue (hm4.empty());
+}
+
+
+void HashMapTest::testCopyAfterErase()
+{
+	// All keys go to the same probe sequence. The 17th key does not
+	// fit into the first group, so it is stored in the second one,
+	// and erasing a key from the full first group leaves a tombstone.
+	typedef HashMap<int, int, ConstantHash> IntMap;
+	IntMap hm;
+	hm.reserve(20);
+	for (int i = 0; i < 17; ++i)
+	{
+		hm[i] = i;
+	}
+	hm.erase(0);
+
+	IntMap hm2(hm);
+	assertTrue (hm2.size() == 16);
+	for (int i = 1; i < 17; ++i)
+	{
+		assertTrue (hm2.find(i) != hm2.end());
+		assertTrue (hm2[i] == i);
+	}
+	assertTrue (hm2.size() == 16);
+	assertTrue (!hm2.insert(IntMap::PairType(16, 0)).second);
+	assertTrue (hm2.size() == 16);
+
+	IntMap hm3;
+	hm3 = hm;
+	assertTrue (hm3.find(16) != hm3.end());
+	hm3.erase(16);
+	assertTrue (hm3.find(16) == hm3.end());
+	assertTrue (hm3.size() == 15);
+}
+
+
 void HashMapTest::setUp()
 {
 }
@@ -217,6 +439,12 @@ CppUnit::Test* HashMapTest::suite()
 	CppUnit_addTest(pSuite, HashMapTest, testIterator);
 	CppUnit_addTest(pSuite, HashMapTest, testConstIterator);
 	CppUnit_addTest(pSuite, HashMapTest, testIndex);
+	CppUnit_addTest(pSuite, HashMapTest, testStringKeys);
+	CppUnit_addTest(pSuite, HashMapTest, testHeterogeneousLookup);
+	CppUnit_addTest(pSuite, HashMapTest, testReserve);
+	CppUnit_addTest(pSuite, HashMapTest, testCopyAfterErase);
+	CppUnit_addTest(pSuite, HashMapTest, testRandomOperations);
+	CppUnit_addTest(pSuite, HashMapTest, testCopyAndMove);
 
 	return pSuite;
 }
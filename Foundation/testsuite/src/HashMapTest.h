@@ -29,6 +29,12 @@ public:
 	void testIterator();
 	void testConstIterator();
 	void testIndex();
+	void testStringKeys();
+	void testHeterogeneousLookup();
+	void testReserve();
+	void testCopyAfterErase();
+	void testRandomOperations();
+	void testCopyAndMove();
 
 	void setUp();
 	void tearDown();
@@ -13,12 +13,26 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/HashSet.h"
 #include <set>
+#include <string>
+#include <string_view>
 
 
 using Poco::Hash;
 using Poco::HashSet;
 
 
+namespace
+{
+	struct ConstantHash
+	{
+		std::size_t operator () (int) const
+		{
+			return 0;
+		}
+	};
+}
+
+
 HashSetTest::HashSetTest(const std::string& name): CppUnit::TestCase(name)
 {
 }
@@ -161,6 +175,74 @@ void HashSetTest::testConstIterator()
 }
 
 
+void HashSetTest::testHeterogeneousLookup()
+{
+	HashSet<std::string> hs;
+	hs.insert("alpha");
+	hs.insert("beta");
+	hs.insert(std::string("gamma"));
+
+	assertTrue (hs.contains(std::string_view("beta")));
+	assertTrue (!hs.contains(std::string_view("delta")));
+	assertTrue (hs.count("alpha") == 1);
+
+	HashSet<std::string>::Iterator it = hs.find(std::string_view("gamma"));
+	assertTrue (it != hs.end());
+	assertTrue (*it == "gamma");
+
+	hs.erase(std::string_view("alpha"));
+	assertTrue (hs.size() == 2);
+	assertTrue (hs.find("alpha") == hs.end());
+}
+
+
+void HashSetTest::testReserve()
+{
+	const int N = 1000;
+
+	HashSet<int, Hash<int> > hs;
+	hs.reserve(N);
+	const int* pFirst = &*hs.insert(0).first;
+	for (int i = 1; i < N; ++i)
+	{
+		hs.insert(i);
+	}
+	assertTrue (&*hs.find(0) == pFirst);
+	assertTrue (hs.size() == N);
+}
+
+
+void HashSetTest::testCopyAfterErase()
+{
+	// All values go to the same probe sequence. The 17th value does not
+	// fit into the first group, so it is stored in the second one,
+	// and erasing a value from the full first group leaves a tombstone.
+	typedef HashSet<int, ConstantHash> IntSet;
+	IntSet hs;
+	hs.reserve(20);
+	for (int i = 0; i < 17; ++i)
+	{
+		hs.insert(i);
+	}
+	hs.erase(0);
+
+	IntSet hs2(hs);
+	assertTrue (hs2.size() == 16);
+	for (int i = 1; i < 17; ++i)
+	{
+		assertTrue (hs2.find(i) != hs2.end());
+	}
+	assertTrue (!hs2.insert(16).second);
+	assertTrue (hs2.size() == 16);
+
+	IntSet hs3;
+	hs3 = hs;
+	assertTrue (hs3.find(16) != hs3.end());
+	assertTrue (!hs3.insert(16).second);
+	assertTrue (hs3.size() == 16);
+}
+
+
 void HashSetTest::setUp()
 {
 }
@@ -179,6 +261,9 @@ CppUnit::Test* HashSetTest::suite()
 	CppUnit_addTest(pSuite, HashSetTest, testErase);
 	CppUnit_addTest(pSuite, HashSetTest, testIterator);
 	CppUnit_addTest(pSuite, HashSetTest, testConstIterator);
+	CppUnit_addTest(pSuite, HashSetTest, testHeterogeneousLookup);
+	CppUnit_addTest(pSuite, HashSetTest, testReserve);
+	CppUnit_addTest(pSuite, HashSetTest, testCopyAfterErase);
 
 	return pSuite;
 }
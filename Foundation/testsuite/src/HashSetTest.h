@@ -28,6 +28,9 @@ public:
 	void testErase();
 	void testIterator();
 	void testConstIterator();
+	void testHeterogeneousLookup();
+	void testReserve();
+	void testCopyAfterErase();
 
 	void setUp();
 	void tearDown();
@@ -16,6 +16,7 @@
 #include "LinearHashTableTest.h"
 #include "HashSetTest.h"
 #include "HashMapTest.h"
+#include "XXH3Test.h"
 
 
 CppUnit::Test* HashingTestSuite::suite()
@@ -29,6 +30,7 @@ CppUnit::Test* HashingTestSuite::suite()
 	pSuite->addTest(LinearHashTableTest::suite());
 	pSuite->addTest(HashSetTest::suite());
 	pSuite->addTest(HashMapTest::suite());
+	pSuite->addTest(XXH3Test::suite());
 
 	return pSuite;
 }
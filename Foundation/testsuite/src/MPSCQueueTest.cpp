@@ -21,6 +21,7 @@
 #include <vector>
 #include <iostream>
 #include <set>
+#include <stdexcept>
 
 
 using Poco::MPSCQueue;
@@ -469,6 +470,48 @@ void MPSCQueueTest::testHighContention()
 }
 
 
+void MPSCQueueTest::testConsume()
+{
+	MPSCQueue<std::string> queue(8);
+	for (int i = 0; i < 8; i++)
+	{
+		assertTrue(queue.tryPush(std::to_string(i)));
+	}
+	assertFalse(queue.tryPush("full"));
+
+	std::vector<std::string> items;
+	auto collect = [&items](std::string& item) { items.push_back(std::move(item)); };
+	assertTrue(queue.consume(collect, 3) == 3);
+	assertTrue(items.size() == 3);
+	assertTrue(items[0] == "0" && items[2] == "2");
+	assertTrue(queue.size() == 5);
+
+	// Consumed slots are available to producers again.
+	assertTrue(queue.tryPush("8"));
+	assertTrue(queue.consume(collect, 100) == 6);
+	assertTrue(items.size() == 9);
+	assertTrue(items[8] == "8");
+	assertTrue(queue.empty());
+	assertTrue(queue.consume(collect, 100) == 0);
+
+	// An exception thrown by the function removes the item.
+	assertTrue(queue.tryPush("a"));
+	assertTrue(queue.tryPush("b"));
+	try
+	{
+		queue.consume([](std::string&) { throw std::runtime_error("error"); }, 100);
+		fail("must throw");
+	}
+	catch (std::runtime_error&)
+	{
+	}
+	assertTrue(queue.size() == 1);
+	std::string value;
+	assertTrue(queue.tryPop(value));
+	assertTrue(value == "b");
+}
+
+
 void MPSCQueueTest::setUp()
 {
 }
@@ -492,6 +535,7 @@ CppUnit::Test* MPSCQueueTest::suite()
 	CppUnit_addTest(pSuite, MPSCQueueTest, testSingleProducerSingleConsumer);
 	CppUnit_addTest(pSuite, MPSCQueueTest, testMultipleProducers);
 	CppUnit_addTest(pSuite, MPSCQueueTest, testHighContention);
+	CppUnit_addTest(pSuite, MPSCQueueTest, testConsume);
 
 	return pSuite;
 }
@@ -34,6 +34,7 @@ public:
 	void testSingleProducerSingleConsumer();
 	void testMultipleProducers();
 	void testHighContention();
+	void testConsume();
 
 	void setUp();
 	void tearDown();
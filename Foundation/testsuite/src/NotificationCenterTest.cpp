@@ -20,6 +20,8 @@
 #include "Poco/Thread.h"
 #include "Poco/Runnable.h"
 #include <chrono>
+#include <thread>
+#include <vector>
 
 
 using Poco::NotificationCenter;
@@ -539,6 +541,86 @@ void NotificationCenterTest::testDeadlock()
 }
 
 
+void NotificationCenterTest::testConcurrentPostAndChange()
+{
+	// Posting does not lock, while observers are added and removed concurrently.
+	NotificationCenter nc;
+	NObserver<NotificationCenterTest, Notification> countObs(*this, &NotificationCenterTest::handleCount);
+	NObserver<NotificationCenterTest, Notification> otherObs(*this, &NotificationCenterTest::handleOther);
+	nc.addObserver(countObs);
+
+	const int threadCount = 4;
+	const int postCount = 10000;
+	std::atomic<bool> stop(false);
+	std::vector<std::thread> threads;
+	for (int i = 0; i < threadCount; ++i)
+	{
+		threads.emplace_back([&nc]()
+		{
+			for (int j = 0; j < postCount; ++j)
+				nc.postNotification(new Notification);
+		});
+	}
+	std::thread changer([&]()
+	{
+		while (!stop)
+		{
+			nc.addObserver(otherObs);
+			nc.removeObserver(otherObs);
+		}
+	});
+
+	for (auto& t: threads) t.join();
+	stop = true;
+	changer.join();
+
+	assertEqual (threadCount*postCount, _count.load());
+	assertTrue (_otherCount.load() <= threadCount*postCount);
+	assertEqual (1u, nc.countObservers());
+	assertTrue (!nc.hasObserver(otherObs));
+}
+
+
+void NotificationCenterTest::testRemoveDuringDispatch()
+{
+	NotificationCenter nc;
+	_pNC = &nc;
+	NObserver<NotificationCenterTest, Notification> removeObs(*this, &NotificationCenterTest::handleRemove);
+	NObserver<NotificationCenterTest, Notification> countObs(*this, &NotificationCenterTest::handleCount);
+	nc.addObserver(removeObs);
+	nc.addObserver(countObs);
+
+	nc.postNotification(new Notification);
+	assertEqual (1, _otherCount.load());
+	assertEqual (1, _count.load());
+	assertTrue (!nc.hasObserver(removeObs));
+
+	nc.postNotification(new Notification);
+	assertEqual (1, _otherCount.load());
+	assertEqual (2, _count.load());
+	_pNC = nullptr;
+}
+
+
+void NotificationCenterTest::handleCount(const AutoPtr<Notification>& pNf)
+{
+	++_count;
+}
+
+
+void NotificationCenterTest::handleOther(const AutoPtr<Notification>& pNf)
+{
+	++_otherCount;
+}
+
+
+void NotificationCenterTest::handleRemove(const AutoPtr<Notification>& pNf)
+{
+	++_otherCount;
+	_pNC->removeObserver(NObserver<NotificationCenterTest, Notification>(*this, &NotificationCenterTest::handleRemove));
+}
+
+
 void NotificationCenterTest::setUp()
 {
 	_set.clear();
@@ -546,6 +628,8 @@ void NotificationCenterTest::setUp()
 	_handleAuto1Done = false;
 	_handlerStarted = false;
 	_handlerCallCount = 0;
+	_count = 0;
+	_otherCount = 0;
 	_pNC = nullptr;
 }
 
@@ -571,6 +655,8 @@ CppUnit::Test* NotificationCenterTest::suite()
 	CppUnit_addTest(pSuite, NotificationCenterTest, testDefaultNotificationCenter);
 #endif
 	CppUnit_addTest(pSuite, NotificationCenterTest, testDeadlock);
+	CppUnit_addTest(pSuite, NotificationCenterTest, testConcurrentPostAndChange);
+	CppUnit_addTest(pSuite, NotificationCenterTest, testRemoveDuringDispatch);
 
 	return pSuite;
 }
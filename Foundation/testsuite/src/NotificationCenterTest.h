@@ -47,6 +47,8 @@ public:
 	void testDefaultNotificationCenter();
 #endif
 	void testDeadlock();
+	void testConcurrentPostAndChange();
+	void testRemoveDuringDispatch();
 
 	void setUp();
 	void tearDown();
@@ -55,6 +57,9 @@ public:
 
 	void handleAuto(const Poco::AutoPtr<Poco::Notification>& pNf);
 	void handleDeadlock(const Poco::AutoPtr<Poco::Notification>& pNf);
+	void handleCount(const Poco::AutoPtr<Poco::Notification>& pNf);
+	void handleOther(const Poco::AutoPtr<Poco::Notification>& pNf);
+	void handleRemove(const Poco::AutoPtr<Poco::Notification>& pNf);
 
 protected:
 #ifdef POCO_TEST_DEPRECATED
@@ -70,6 +75,8 @@ private:
 	std::atomic<bool> _handleAuto1Done;
 	std::atomic<bool> _handlerStarted;
 	std::atomic<int> _handlerCallCount;
+	std::atomic<int> _count;
+	std::atomic<int> _otherCount;
 	Poco::Mutex _mutex;
 	Poco::NotificationCenter* _pNC;
 };
@@ -18,6 +18,7 @@
 #include "Poco/Format.h"
 #include "Poco/Environment.h"
 #include "Poco/ProcessOptions.h"
+#include "Poco/TemporaryFile.h"
 #include <iostream>
 
 
@@ -259,6 +260,30 @@ void ProcessTest::testLaunchInvalidCommand()
 }
 
 
+void ProcessTest::testLaunchInitialDirectory()
+{
+#if defined(POCO_OS_FAMILY_UNIX)
+	Poco::TemporaryFile dir;
+	dir.createDirectories();
+	std::vector<std::string> args;
+	Pipe outPipe;
+	ProcessHandle ph = Process::launch("pwd", args, dir.path(), nullptr, &outPipe, nullptr);
+	PipeInputStream istr(outPipe);
+	std::string s;
+	int c = istr.get();
+	while (c != -1 && c != '\n') { s += (char) c; c = istr.get(); }
+	assertTrue (Path(s).getFileName() == Path(dir.path()).getFileName());
+	int rc = ph.wait();
+	assertTrue (rc == 0);
+
+	// a non-existent initial directory is reported like an invalid command
+	ProcessHandle ph2 = Process::launch("pwd", args, dir.path() + "/nonexistent");
+	rc = ph2.wait();
+	assertTrue (rc == 72);
+#endif
+}
+
+
 void ProcessTest::testIsRunning()
 {
 	std::string name("TestApp");
@@ -372,6 +397,7 @@ CppUnit::Test* ProcessTest::suite()
 	CppUnit_addTest(pSuite, ProcessTest, testLaunchEnv);
 	CppUnit_addTest(pSuite, ProcessTest, testLaunchArgs);
 	CppUnit_addTest(pSuite, ProcessTest, testLaunchInvalidCommand);
+	CppUnit_addTest(pSuite, ProcessTest, testLaunchInitialDirectory);
 	CppUnit_addTest(pSuite, ProcessTest, testIsRunning);
 	CppUnit_addTest(pSuite, ProcessTest, testLaunchCloseHandles);
 
@@ -31,6 +31,7 @@ public:
 	void testLaunchEnv();
 	void testLaunchArgs();
 	void testLaunchInvalidCommand();
+	void testLaunchInitialDirectory();
 	void testIsRunning();
 	void testLaunchCloseHandles();
 
@@ -0,0 +1,273 @@
+//
+// ProcessZygoteTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ProcessZygoteTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/ProcessZygote.h"
+#include "Poco/ProcessRunner.h"
+#include "Poco/ProcessOptions.h"
+#include "Poco/Process.h"
+#include "Poco/Pipe.h"
+#include "Poco/PipeStream.h"
+#include "Poco/PIDFile.h"
+#include "Poco/Path.h"
+#include "Poco/File.h"
+#include "Poco/Format.h"
+#include "Poco/TemporaryFile.h"
+#include "Poco/Thread.h"
+#include "Poco/Stopwatch.h"
+#include <atomic>
+
+
+using Poco::ProcessZygote;
+using Poco::ProcessRunner;
+using Poco::Process;
+using Poco::ProcessHandle;
+using Poco::Pipe;
+using Poco::PipeInputStream;
+using Poco::PipeOutputStream;
+using Poco::Path;
+using Poco::File;
+using Poco::Thread;
+using Poco::Stopwatch;
+
+
+namespace
+{
+	std::string readAll(Pipe& pipe)
+	{
+		PipeInputStream istr(pipe);
+		std::string s;
+		int c = istr.get();
+		while (c != -1) { s += (char) c; c = istr.get(); }
+		return s;
+	}
+}
+
+
+ProcessZygoteTest::ProcessZygoteTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+ProcessZygoteTest::~ProcessZygoteTest()
+{
+}
+
+
+void ProcessZygoteTest::testLaunch()
+{
+	ProcessZygote zygote;
+#if POCO_OS == POCO_OS_LINUX
+	assertTrue (ProcessZygote::isSupported());
+	assertTrue (zygote.id() > 0);
+	assertTrue (Process::isRunning(zygote.id()));
+#endif
+
+	std::vector<std::string> args;
+	args.push_back("arg1");
+	args.push_back("arg2");
+	args.push_back("arg3");
+	ProcessHandle ph = zygote.launch(testApp(), args);
+	assertTrue (ph.id() != zygote.id());
+	int rc = ph.wait();
+	assertTrue (rc == 3);
+
+	// can be used repeatedly
+	for (int i = 0; i < 10; i++)
+	{
+		ProcessHandle ph2 = zygote.launch(testApp(), args);
+		assertTrue (ph2.wait() == 3);
+	}
+}
+
+
+void ProcessZygoteTest::testLaunchRedirect()
+{
+	ProcessZygote zygote;
+
+	{
+		std::vector<std::string> args;
+		args.push_back("-count");
+		Pipe inPipe;
+		ProcessHandle ph = zygote.launch(testApp(), args, "", &inPipe, nullptr, nullptr, Process::Env());
+		assertTrue (Process::isRunning(ph));
+		PipeOutputStream ostr(inPipe);
+		ostr << std::string(100, 'x');
+		ostr.close();
+		int rc = ph.wait();
+		assertTrue (rc == 100);
+		assertTrue (!Process::isRunning(ph));
+	}
+
+	{
+		std::vector<std::string> args;
+		args.push_back("-hello");
+		Pipe outPipe;
+		ProcessHandle ph = zygote.launch(testApp(), args, "", nullptr, &outPipe, nullptr, Process::Env());
+		assertTrue (readAll(outPipe) == "Hello, world!");
+		int rc = ph.wait();
+		assertTrue (rc == 1);
+	}
+
+	{
+		std::vector<std::string> args;
+		args.push_back("-hello");
+		ProcessHandle ph = zygote.launch(testApp(), args, Poco::PROCESS_CLOSE_STDIN | Poco::PROCESS_CLOSE_STDOUT | Poco::PROCESS_CLOSE_STDERR);
+		int rc = ph.wait();
+		assertTrue (rc == 1);
+	}
+}
+
+
+void ProcessZygoteTest::testLaunchEnv()
+{
+	ProcessZygote zygote;
+
+	std::vector<std::string> args;
+	args.push_back("-env");
+	Pipe outPipe;
+	Process::Env env;
+	env["TESTENV"] = "test";
+	ProcessHandle ph = zygote.launch(testApp(), args, "", nullptr, &outPipe, nullptr, env);
+	assertTrue (readAll(outPipe) == "test");
+	int rc = ph.wait();
+	assertTrue (rc == 0);
+}
+
+
+void ProcessZygoteTest::testLaunchInitialDirectory()
+{
+#if defined(POCO_OS_FAMILY_UNIX)
+	ProcessZygote zygote;
+
+	Poco::TemporaryFile dir;
+	dir.createDirectories();
+	std::vector<std::string> args;
+	Pipe outPipe;
+	ProcessHandle ph = zygote.launch("pwd", args, dir.path(), nullptr, &outPipe, nullptr, Process::Env());
+	std::string s = readAll(outPipe);
+	assertTrue (Path(s.substr(0, s.find('\n'))).getFileName() == Path(dir.path()).getFileName());
+	int rc = ph.wait();
+	assertTrue (rc == 0);
+#endif
+}
+
+
+void ProcessZygoteTest::testLaunchInvalidCommand()
+{
+#if defined(POCO_OS_FAMILY_UNIX)
+	ProcessZygote zygote;
+
+	std::vector<std::string> args;
+	ProcessHandle ph = zygote.launch("nonexistent_123-xyz", args);
+	int rc = ph.wait();
+	assertTrue (rc == 72);
+#endif
+}
+
+
+void ProcessZygoteTest::testLaunchConcurrent()
+{
+	ProcessZygote zygote;
+	const std::string cmd = testApp();
+	std::atomic<int> failures(0);
+
+	auto launcher = [&zygote, &cmd, &failures]()
+	{
+		for (int i = 0; i < 5; i++)
+		{
+			std::vector<std::string> args;
+			args.push_back("-hello");
+			Pipe outPipe;
+			ProcessHandle ph = zygote.launch(cmd, args, "", nullptr, &outPipe, nullptr, Process::Env());
+			if (readAll(outPipe) != "Hello, world!" || ph.wait() != 1) ++failures;
+		}
+	};
+
+	Thread t1;
+	Thread t2;
+	Thread t3;
+	t1.startFunc([&launcher]() { launcher(); });
+	t2.startFunc([&launcher]() { launcher(); });
+	t3.startFunc([&launcher]() { launcher(); });
+	t1.join();
+	t2.join();
+	t3.join();
+	assertEqual (0, failures.load());
+}
+
+
+void ProcessZygoteTest::testProcessRunner()
+{
+	ProcessZygote zygote;
+
+	std::string name = Path(testApp()).getFileName();
+	std::vector<std::string> args;
+	char c = Path::separator();
+	std::string pidFile = Poco::format("run%c%s.pid", c, name);
+	args.push_back(std::string("--pidfile=").append(pidFile));
+	{
+		ProcessRunner pr(testApp(), args, "", ProcessRunner::NO_OUT | Poco::PROCESS_KILL_TREE, 10, true, {"--pidfile="}, &zygote);
+		assertTrue (pr.running());
+		assertTrue (pr.pidFile() == Poco::PIDFile::getFileName(pidFile));
+		assertTrue (File(pidFile).exists());
+		assertTrue (Poco::PIDFile::contains(pidFile, pr.pid()));
+		ProcessRunner::PID pid = pr.pid();
+
+		pr.stop();
+		assertFalse (pr.running());
+		assertEqual (0, pr.result());
+		assertTrue (pr.error().empty());
+		assertFalse (Process::isRunning(pid));
+
+		pr.start();
+		assertTrue (pr.running());
+		assertTrue (pr.pid() != pid);
+	}
+	assertTrue (!File(pidFile).exists());
+}
+
+
+std::string ProcessZygoteTest::testApp() const
+{
+	std::string name("TestApp");
+#if defined(_DEBUG) && (POCO_OS != POCO_OS_ANDROID)
+	name += "d";
+#endif
+	return name;
+}
+
+
+void ProcessZygoteTest::setUp()
+{
+}
+
+
+void ProcessZygoteTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ProcessZygoteTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ProcessZygoteTest");
+
+	CppUnit_addTest(pSuite, ProcessZygoteTest, testLaunch);
+	CppUnit_addTest(pSuite, ProcessZygoteTest, testLaunchRedirect);
+	CppUnit_addTest(pSuite, ProcessZygoteTest, testLaunchEnv);
+	CppUnit_addTest(pSuite, ProcessZygoteTest, testLaunchInitialDirectory);
+	CppUnit_addTest(pSuite, ProcessZygoteTest, testLaunchInvalidCommand);
+	CppUnit_addTest(pSuite, ProcessZygoteTest, testLaunchConcurrent);
+	CppUnit_addTest(pSuite, ProcessZygoteTest, testProcessRunner);
+
+	return pSuite;
+}
@@ -0,0 +1,45 @@
+//
+// ProcessZygoteTest.h
+//
+// Definition of the ProcessZygoteTest class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef ProcessZygoteTest_INCLUDED
+#define ProcessZygoteTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class ProcessZygoteTest: public CppUnit::TestCase
+{
+public:
+	ProcessZygoteTest(const std::string& name);
+	~ProcessZygoteTest();
+
+	void testLaunch();
+	void testLaunchRedirect();
+	void testLaunchEnv();
+	void testLaunchInitialDirectory();
+	void testLaunchInvalidCommand();
+	void testLaunchConcurrent();
+	void testProcessRunner();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+	std::string testApp() const;
+};
+
+
+#endif // ProcessZygoteTest_INCLUDED
@@ -14,6 +14,7 @@
 #include "NamedEventTest.h"
 #include "SharedMemoryTest.h"
 #include "ProcessRunnerTest.h"
+#include "ProcessZygoteTest.h"
 #include "FileStreamRWLockTest.h"
 #include "PipeTest.h"
 
@@ -27,6 +28,7 @@ CppUnit::Test* ProcessesTestSuite::suite()
 	pSuite->addTest(NamedEventTest::suite());
 	pSuite->addTest(SharedMemoryTest::suite());
 	pSuite->addTest(ProcessRunnerTest::suite());
+	pSuite->addTest(ProcessZygoteTest::suite());
 	pSuite->addTest(FileStreamRWLockTest::suite());
 	pSuite->addTest(PipeTest::suite());
 
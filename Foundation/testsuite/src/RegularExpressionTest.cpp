@@ -13,6 +13,9 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/RegularExpression.h"
 #include "Poco/Exception.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include <string_view>
 
 
 using Poco::RegularExpression;
@@ -327,6 +330,110 @@ void RegularExpressionTest::testMatchCaptureGroupCount()
 }
 
 
+void RegularExpressionTest::testMatchStringView()
+{
+	const char* line = "GET /api/v1/users/4711 HTTP/1.1\r\n";
+	const std::string_view path(line + 4, 18);
+
+	RegularExpression re("/users/([0-9]+)$");
+	RegularExpression::Match mtch;
+	assertTrue (re.match(path, 0, mtch) == 2);
+	assertTrue (mtch.offset == 7);
+	assertTrue (mtch.length == 11);
+
+	// the subject ends at the end of the view, not at the terminating zero
+	assertTrue (re.match(std::string_view(line), 0, mtch) == 0);
+	assertTrue (mtch.offset == std::string::npos);
+
+	RegularExpression::MatchVec matches;
+	assertTrue (re.match(path, 0, matches) == 2);
+	assertTrue (path.substr(matches[1].offset, matches[1].length) == "4711");
+
+	RegularExpression full("/api/v[0-9]+/.*");
+	assertTrue (full.match(path, 0, RegularExpression::RE_ANCHORED));
+	assertTrue (!full.match(path, 1, RegularExpression::RE_ANCHORED));
+	assertTrue (full.match("/api/v2/", 0, RegularExpression::RE_ANCHORED));
+
+	assertTrue (re.match("/users/42", 0, mtch) == 2);
+	assertTrue (mtch.offset == 0 && mtch.length == 9);
+	assertTrue (re.match(std::string_view(), 0, mtch) == 0);
+}
+
+
+void RegularExpressionTest::testJIT()
+{
+	RegularExpression re("([a-z]+)=([0-9]+)", RegularExpression::RE_JIT);
+	RegularExpression::MatchVec matches;
+	assertTrue (re.match("foo=42 bar=7", 0, matches) == 3);
+	assertTrue (matches[1].offset == 0 && matches[1].length == 3);
+	assertTrue (matches[2].offset == 4 && matches[2].length == 2);
+	assertTrue (re.match("foo=42 bar=7", 6, matches) == 3);
+	assertTrue (matches[1].offset == 7 && matches[1].length == 3);
+
+	std::string s("a=1 b=2");
+	assertTrue (re.subst(s, "$2:$1", RegularExpression::RE_GLOBAL) == 2);
+	assertTrue (s == "1:a 2:b");
+
+	RegularExpression interp("([a-z]+)=([0-9]+)");
+	assertTrue (!interp.isJIT());
+}
+
+
+namespace
+{
+	class Matcher: public Poco::Runnable
+	{
+	public:
+		Matcher(const RegularExpression& re1, const RegularExpression& re2):
+			_re1(re1),
+			_re2(re2),
+			_ok(true)
+		{
+		}
+
+		void run()
+		{
+			RegularExpression::MatchVec matches;
+			for (int i = 0; i < 1000; i++)
+			{
+				_ok = _ok && _re1.match("x=1", 0, matches) == 2 && matches[1].length == 1;
+				_ok = _ok && _re2.match("2024-01-15", 0, matches) == 4 && matches[3].offset == 8;
+			}
+		}
+
+		bool ok() const
+		{
+			return _ok;
+		}
+
+	private:
+		const RegularExpression& _re1;
+		const RegularExpression& _re2;
+		bool _ok;
+	};
+}
+
+
+void RegularExpressionTest::testMatchDataReuse()
+{
+	// Expressions with different numbers of capture groups
+	// share the match data of a thread.
+	RegularExpression re1("x=([0-9])");
+	RegularExpression re2("([0-9]{4})-([0-9]{2})-([0-9]{2})");
+
+	Matcher m1(re1, re2);
+	Matcher m2(re1, re2);
+	Poco::Thread t1;
+	Poco::Thread t2;
+	t1.start(m1);
+	t2.start(m2);
+	t1.join();
+	t2.join();
+	assertTrue (m1.ok());
+	assertTrue (m2.ok());
+}
+
+
 void RegularExpressionTest::setUp()
 {
 }
@@ -360,6 +467,9 @@ CppUnit::Test* RegularExpressionTest::suite()
 	CppUnit_addTest(pSuite, RegularExpressionTest, testError);
 	CppUnit_addTest(pSuite, RegularExpressionTest, testGroup);
 	CppUnit_addTest(pSuite, RegularExpressionTest, testMatchCaptureGroupCount);
+	CppUnit_addTest(pSuite, RegularExpressionTest, testMatchStringView);
+	CppUnit_addTest(pSuite, RegularExpressionTest, testJIT);
+	CppUnit_addTest(pSuite, RegularExpressionTest, testMatchDataReuse);
 
 	return pSuite;
 }
@@ -43,6 +43,9 @@ public:
 	void testError();
 	void testGroup();
 	void testMatchCaptureGroupCount();
+	void testMatchStringView();
+	void testJIT();
+	void testMatchDataReuse();
 
 	void setUp();
 	void tearDown();
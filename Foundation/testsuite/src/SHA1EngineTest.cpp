@@ -12,6 +12,7 @@
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include "Poco/SHA1Engine.h"
+#include <string>
 
 
 using Poco::SHA1Engine;
@@ -46,6 +47,70 @@ void SHA1EngineTest::testSHA1()
 }
 
 
+void SHA1EngineTest::testSHA1Vectors()
+{
+	SHA1Engine engine;
+
+	engine.update("");
+	assertTrue (DigestEngine::digestToHex(engine.digest()) == "da39a3ee5e6b4b0d3255bfef95601890afd80709");
+
+	engine.update("The quick brown fox jumps over the lazy dog");
+	assertTrue (DigestEngine::digestToHex(engine.digest()) == "2fd4e1c67a2d28fced849ee1bb76e7391b93eb12");
+
+	// test vector from FIPS 180-2 (two blocks, padding in third block)
+	engine.update("abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu");
+	assertTrue (DigestEngine::digestToHex(engine.digest()) == "a49b2446a02c645bf419f995b67091253a04a259");
+}
+
+
+void SHA1EngineTest::testSHA1Incremental()
+{
+	std::string data;
+	for (int i = 0; i < 1000; i++) data += static_cast<char>((i*7) % 251);
+
+	SHA1Engine engine;
+	engine.update(data);
+	assertTrue (DigestEngine::digestToHex(engine.digest()) == "33f233c97a803d84a0db9f3dbc05b63ff2045d92");
+
+	// all chunk sizes around the block size, crossing block boundaries
+	for (std::size_t chunk = 1; chunk <= 130; chunk++)
+	{
+		for (std::size_t pos = 0; pos < data.size(); pos += chunk)
+		{
+			engine.update(data.data() + pos, std::min(chunk, data.size() - pos));
+		}
+		assertTrue (DigestEngine::digestToHex(engine.digest()) == "33f233c97a803d84a0db9f3dbc05b63ff2045d92");
+	}
+
+	// all message lengths up to three blocks
+	for (std::size_t length = 0; length <= 192; length++)
+	{
+		SHA1Engine engine1;
+		SHA1Engine engine2;
+		engine1.update(data.data(), length);
+		for (std::size_t i = 0; i < length; i++) engine2.update(data[i]);
+		assertTrue (engine1.digest() == engine2.digest());
+	}
+}
+
+
+void SHA1EngineTest::testKernels()
+{
+	const bool accelerated = SHA1Engine::isAccelerated();
+
+	const SHA1Engine::Kernel kernels[] = {SHA1Engine::KERNEL_GENERIC, SHA1Engine::KERNEL_AUTO};
+	for (auto kernel: kernels)
+	{
+		SHA1Engine::setKernel(kernel);
+		assertTrue (SHA1Engine::getKernel() == kernel);
+		assertTrue (SHA1Engine::isAccelerated() == (accelerated && kernel != SHA1Engine::KERNEL_GENERIC));
+		testSHA1();
+		testSHA1Vectors();
+		testSHA1Incremental();
+	}
+}
+
+
 void SHA1EngineTest::setUp()
 {
 }
@@ -53,6 +118,7 @@ void SHA1EngineTest::setUp()
 
 void SHA1EngineTest::tearDown()
 {
+	SHA1Engine::setKernel(SHA1Engine::KERNEL_AUTO);
 }
 
 
@@ -61,6 +127,9 @@ CppUnit::Test* SHA1EngineTest::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("SHA1EngineTest");
 
 	CppUnit_addTest(pSuite, SHA1EngineTest, testSHA1);
+	CppUnit_addTest(pSuite, SHA1EngineTest, testSHA1Vectors);
+	CppUnit_addTest(pSuite, SHA1EngineTest, testSHA1Incremental);
+	CppUnit_addTest(pSuite, SHA1EngineTest, testKernels);
 
 	return pSuite;
 }
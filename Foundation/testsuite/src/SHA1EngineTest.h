@@ -25,6 +25,9 @@ public:
 	~SHA1EngineTest();
 
 	void testSHA1();
+	void testSHA1Vectors();
+	void testSHA1Incremental();
+	void testKernels();
 
 	void setUp();
 	void tearDown();
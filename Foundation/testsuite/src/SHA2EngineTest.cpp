@@ -16,6 +16,8 @@
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include "Poco/SHA2Engine.h"
+#include <string>
+#include <vector>
 
 
 using Poco::SHA2Engine;
@@ -173,6 +175,116 @@ void SHA2EngineTest::testSHA512_256()
 	assertTrue (DigestEngine::digestToHex(engine.digest()) == "9a59a052930187a97038cae692f30708aa6491923ef5194394dc68d56c74fb21");
 }
 
+
+void SHA2EngineTest::testSHA256Incremental()
+{
+	std::string data;
+	for (int i = 0; i < 1000; i++) data += static_cast<char>((i*7) % 251);
+
+	SHA2Engine engine224(SHA2Engine::SHA_224);
+	SHA2Engine engine256(SHA2Engine::SHA_256);
+
+	// all chunk sizes around the block size, crossing block boundaries
+	for (std::size_t chunk = 1; chunk <= 130; chunk++)
+	{
+		for (std::size_t pos = 0; pos < data.size(); pos += chunk)
+		{
+			std::size_t n = std::min(chunk, data.size() - pos);
+			engine224.update(data.data() + pos, n);
+			engine256.update(data.data() + pos, n);
+		}
+		assertTrue (DigestEngine::digestToHex(engine224.digest()) == "b3bb83df5b19419d6efee61258cdd7bee0b86acaba1f71c6d07f9c08");
+		assertTrue (DigestEngine::digestToHex(engine256.digest()) == "59425e4412e296fc74736673ce067027f384203f59c0d2c3e6be7b13347b3ffc");
+	}
+
+	// all message lengths up to three blocks
+	for (std::size_t length = 0; length <= 192; length++)
+	{
+		SHA2Engine engine1;
+		SHA2Engine engine2;
+		engine1.update(data.data(), length);
+		for (std::size_t i = 0; i < length; i++) engine2.update(data[i]);
+		assertTrue (engine1.digest() == engine2.digest());
+	}
+}
+
+
+void SHA2EngineTest::testDigestAll()
+{
+	std::string data;
+	for (int i = 0; i < 1000; i++) data += static_cast<char>((i*7) % 251);
+
+	std::vector<std::string_view> messages;
+	messages.push_back(std::string_view());
+	messages.push_back("The quick brown fox jumps over the lazy dog");
+	messages.push_back(data);
+	// varying lengths so that lanes finish and are refilled at different times
+	for (std::size_t length = 0; length <= 200; length += 3)
+	{
+		messages.push_back(std::string_view(data.data() + length % 17, length));
+	}
+	messages.push_back(std::string_view(data.data(), 999));
+
+	const SHA2Engine::ALGORITHM algorithms[] = {SHA2Engine::SHA_224, SHA2Engine::SHA_256, SHA2Engine::SHA_384, SHA2Engine::SHA_512};
+	for (auto algorithm: algorithms)
+	{
+		std::vector<DigestEngine::Digest> digests = SHA2Engine::digestAll(messages, algorithm);
+		assertEqual (messages.size(), digests.size());
+		for (std::size_t i = 0; i < messages.size(); i++)
+		{
+			SHA2Engine engine(algorithm);
+			engine.update(messages[i].data(), messages[i].size());
+			assertTrue (digests[i] == engine.digest());
+		}
+	}
+
+	std::vector<DigestEngine::Digest> digests = SHA2Engine::digestAll(messages);
+	assertTrue (DigestEngine::digestToHex(digests[0]) == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+	assertTrue (DigestEngine::digestToHex(digests[1]) == "d7a8fbb307d7809469ca9abcb0082e4f8d5651e46d3cdb762d02d0bf37c9e592");
+	assertTrue (DigestEngine::digestToHex(digests[2]) == "59425e4412e296fc74736673ce067027f384203f59c0d2c3e6be7b13347b3ffc");
+
+	digests = SHA2Engine::digestAll(messages, SHA2Engine::SHA_224);
+	assertTrue (DigestEngine::digestToHex(digests[0]) == "d14a028c2a3a2bc9476102bb288234c415a2b01f828ea62ac5b3e42f");
+	assertTrue (DigestEngine::digestToHex(digests[1]) == "730e109bd7a8a32b1cb9d9a09aa2325d2430587ddbc0c38bad911525");
+	assertTrue (DigestEngine::digestToHex(digests[2]) == "b3bb83df5b19419d6efee61258cdd7bee0b86acaba1f71c6d07f9c08");
+
+	assertTrue (SHA2Engine::digestAll(std::vector<std::string_view>()).empty());
+}
+
+
+void SHA2EngineTest::testKernels()
+{
+	const bool accelerated = SHA2Engine::isAccelerated();
+	const bool multiBufferAccelerated = SHA2Engine::isMultiBufferAccelerated();
+
+	const SHA2Engine::Kernel kernels[] = {SHA2Engine::KERNEL_GENERIC, SHA2Engine::KERNEL_MULTI_BUFFER, SHA2Engine::KERNEL_AUTO};
+	for (auto kernel: kernels)
+	{
+		SHA2Engine::setKernel(kernel);
+		assertTrue (SHA2Engine::getKernel() == kernel);
+		switch (kernel)
+		{
+		case SHA2Engine::KERNEL_GENERIC:
+			assertTrue (!SHA2Engine::isAccelerated());
+			assertTrue (!SHA2Engine::isMultiBufferAccelerated());
+			break;
+		case SHA2Engine::KERNEL_MULTI_BUFFER:
+			assertTrue (SHA2Engine::isAccelerated() == accelerated);
+			assertTrue (SHA2Engine::isMultiBufferAccelerated() || !multiBufferAccelerated);
+			break;
+		default:
+			assertTrue (SHA2Engine::isAccelerated() == accelerated);
+			assertTrue (SHA2Engine::isMultiBufferAccelerated() == multiBufferAccelerated);
+			break;
+		}
+		testSHA224();
+		testSHA256();
+		testSHA256Incremental();
+		testDigestAll();
+	}
+}
+
+
 void SHA2EngineTest::setUp()
 {
 }
@@ -180,6 +292,7 @@ void SHA2EngineTest::setUp()
 
 void SHA2EngineTest::tearDown()
 {
+	SHA2Engine::setKernel(SHA2Engine::KERNEL_AUTO);
 }
 
 
@@ -193,5 +306,8 @@ CppUnit::Test* SHA2EngineTest::suite()
 	CppUnit_addTest(pSuite, SHA2EngineTest, testSHA512);
 	CppUnit_addTest(pSuite, SHA2EngineTest, testSHA512_224);
 	CppUnit_addTest(pSuite, SHA2EngineTest, testSHA512_256);
+	CppUnit_addTest(pSuite, SHA2EngineTest, testSHA256Incremental);
+	CppUnit_addTest(pSuite, SHA2EngineTest, testDigestAll);
+	CppUnit_addTest(pSuite, SHA2EngineTest, testKernels);
 	return pSuite;
 }
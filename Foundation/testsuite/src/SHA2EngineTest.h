@@ -30,6 +30,9 @@ public:
 	void testSHA512();
 	void testSHA512_224();
 	void testSHA512_256();
+	void testSHA256Incremental();
+	void testDigestAll();
+	void testKernels();
 
 	void setUp();
 	void tearDown();
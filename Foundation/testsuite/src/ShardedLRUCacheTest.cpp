@@ -0,0 +1,316 @@
+//
+// ShardedLRUCacheTest.cpp
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "ShardedLRUCacheTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Exception.h"
+#include "Poco/ShardedLRUCache.h"
+#include "Poco/ShardedExpireLRUCache.h"
+#include "Poco/ShardedAccessExpireLRUCache.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
+#include <atomic>
+#include <map>
+#include <string>
+
+
+using namespace Poco;
+
+
+namespace
+{
+	class CacheReader: public Runnable
+	{
+	public:
+		CacheReader(ShardedLRUCache<int, int>& cache, int keys, std::atomic<int>& errors):
+			_cache(cache),
+			_keys(keys),
+			_errors(errors)
+		{
+		}
+
+		void run()
+		{
+			for (int n = 0; n < 20000; n++)
+			{
+				int key = n % _keys;
+				SharedPtr<int> val = _cache.get(key);
+				if (val.isNull())
+					_cache.add(key, key*2);
+				else if (*val != key*2)
+					++_errors;
+			}
+		}
+
+	private:
+		ShardedLRUCache<int, int>& _cache;
+		int _keys;
+		std::atomic<int>& _errors;
+	};
+}
+
+
+ShardedLRUCacheTest::ShardedLRUCacheTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+ShardedLRUCacheTest::~ShardedLRUCacheTest()
+{
+}
+
+
+void ShardedLRUCacheTest::testClear()
+{
+	ShardedLRUCache<int, int> aCache(3);
+	assertTrue (aCache.size() == 0);
+	assertTrue (aCache.getAllKeys().size() == 0);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	aCache.add(5, 6);
+	assertTrue (aCache.size() == 3);
+	assertTrue (aCache.getAllKeys().size() == 3);
+	assertTrue (aCache.has(1));
+	assertTrue (aCache.has(3));
+	assertTrue (aCache.has(5));
+	assertTrue (*aCache.get(1) == 2);
+	assertTrue (*aCache.get(3) == 4);
+	assertTrue (*aCache.get(5) == 6);
+	aCache.clear();
+	assertTrue (!aCache.has(1));
+	assertTrue (!aCache.has(3));
+	assertTrue (!aCache.has(5));
+	assertTrue (aCache.size() == 0);
+}
+
+
+void ShardedLRUCacheTest::testCacheSize0()
+{
+	try
+	{
+		ShardedLRUCache<int, int> aCache(0);
+		failmsg ("cache size of 0 is illegal, test should fail");
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
+}
+
+
+void ShardedLRUCacheTest::testCacheSizeN()
+{
+	ShardedLRUCache<int, int> aCache(1000, 8);
+	assertTrue (aCache.shards() == 8);
+	assertTrue (aCache.capacity() == 1000);
+	for (int i = 0; i < 5000; i++)
+	{
+		aCache.add(i, i);
+		assertTrue (*aCache.get(i) == i);
+	}
+	assertTrue (aCache.size() <= 1000);
+	assertTrue (aCache.size() > 500);
+}
+
+
+void ShardedLRUCacheTest::testClockReplacement()
+{
+	// a cache this small has a single shard, so replacement is deterministic
+	ShardedLRUCache<int, int> aCache(3);
+	assertTrue (aCache.shards() == 1);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	aCache.add(5, 6);
+	assertTrue (!aCache.get(1).isNull());
+
+	// 1 has been referenced, so 3 is replaced
+	aCache.add(7, 8);
+	assertTrue (aCache.has(1));
+	assertTrue (!aCache.has(3));
+	assertTrue (aCache.has(5));
+	assertTrue (aCache.has(7));
+
+	aCache.add(9, 10);
+	assertTrue (!aCache.has(5));
+
+	// the reference bit of 1 has been cleared by the clock hand
+	aCache.add(11, 12);
+	assertTrue (!aCache.has(1));
+	aCache.add(13, 14);
+	assertTrue (!aCache.has(7));
+	assertTrue (aCache.size() == 3);
+}
+
+
+void ShardedLRUCacheTest::testDuplicateAdd()
+{
+	ShardedLRUCache<int, int> aCache(3);
+	aCache.add(1, 2);
+	assertTrue (aCache.has(1));
+	assertTrue (*aCache.get(1) == 2);
+	SharedPtr<int> old = aCache.get(1);
+	aCache.add(1, 3);
+	assertTrue (aCache.has(1));
+	assertTrue (*aCache.get(1) == 3);
+	assertTrue (*old == 2);
+	aCache.update(1, 4);
+	assertTrue (*aCache.get(1) == 4);
+	assertTrue (aCache.size() == 1);
+}
+
+
+void ShardedLRUCacheTest::testRemove()
+{
+	ShardedLRUCache<std::string, int> aCache(16);
+	aCache.add("a", 1);
+	aCache.add("b", 2);
+	SharedPtr<int> val = aCache.get("a");
+	aCache.remove("a");
+	aCache.remove("c");
+	assertTrue (!aCache.has("a"));
+	assertTrue (aCache.get("a").isNull());
+	assertTrue (*val == 1);
+	assertTrue (aCache.has("b"));
+	assertTrue (aCache.size() == 1);
+
+	// removed slots are reused
+	for (int i = 0; i < 100; i++)
+	{
+		aCache.add("x", i);
+		aCache.remove("x");
+	}
+	assertTrue (aCache.size() == 1);
+}
+
+
+void ShardedLRUCacheTest::testForEach()
+{
+	ShardedLRUCache<int, int> aCache(64, 4);
+	std::map<int, int> values;
+	for (int i = 0; i < 10; i++)
+	{
+		aCache.add(i, i*i);
+		values[i] = i*i;
+	}
+	std::map<int, int> visited;
+	aCache.forEach([&visited](int key, int value)
+	{
+		visited[key] = value;
+	});
+	assertTrue (visited == values);
+}
+
+
+void ShardedLRUCacheTest::testShards()
+{
+	ShardedLRUCache<int, int> aCache(1024, 5);
+	assertTrue (aCache.shards() == 8);
+
+	ShardedLRUCache<int, int> smallCache(16, 64);
+	assertTrue (smallCache.shards() == 2);
+	assertTrue (smallCache.capacity() == 16);
+
+	ShardedLRUCache<int, int> defaultCache;
+	assertTrue (defaultCache.shards() >= 1);
+	assertTrue (defaultCache.capacity() >= 1024);
+}
+
+
+void ShardedLRUCacheTest::testExpire()
+{
+	ShardedExpireLRUCache<int, int> aCache(16, 50);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	assertTrue (aCache.has(1));
+	Thread::sleep(30);
+	assertTrue (*aCache.get(1) == 2);
+	Thread::sleep(40);
+	// accessing an entry does not extend its lifetime
+	assertTrue (!aCache.has(1));
+	assertTrue (aCache.get(1).isNull());
+	assertTrue (aCache.size() == 0);
+
+	try
+	{
+		ShardedExpireLRUCache<int, int> invalidCache(16, 10);
+		failmsg ("expire time below 25 ms is illegal, test should fail");
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
+}
+
+
+void ShardedLRUCacheTest::testAccessExpire()
+{
+	ShardedAccessExpireLRUCache<int, int> aCache(16, 100);
+	aCache.add(1, 2);
+	aCache.add(3, 4);
+	for (int i = 0; i < 3; i++)
+	{
+		Thread::sleep(60);
+		assertTrue (*aCache.get(1) == 2);
+	}
+	assertTrue (aCache.has(1));
+	assertTrue (!aCache.has(3));
+	Thread::sleep(150);
+	assertTrue (aCache.get(1).isNull());
+}
+
+
+void ShardedLRUCacheTest::testConcurrentAccess()
+{
+	ShardedLRUCache<int, int> aCache(256, 8);
+	std::atomic<int> errors(0);
+	CacheReader r1(aCache, 200, errors);
+	CacheReader r2(aCache, 500, errors);
+	CacheReader r3(aCache, 1000, errors);
+	Thread t1;
+	Thread t2;
+	Thread t3;
+	t1.start(r1);
+	t2.start(r2);
+	t3.start(r3);
+	t1.join();
+	t2.join();
+	t3.join();
+	assertTrue (errors == 0);
+	assertTrue (aCache.size() <= aCache.capacity());
+}
+
+
+void ShardedLRUCacheTest::setUp()
+{
+}
+
+
+void ShardedLRUCacheTest::tearDown()
+{
+}
+
+
+CppUnit::Test* ShardedLRUCacheTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("ShardedLRUCacheTest");
+
+	CppUnit_addTest(pSuite, ShardedLRUCacheTest, testClear);
+	CppUnit_addTest(pSuite, ShardedLRUCacheTest, testCacheSize0);
+	CppUnit_addTest(pSuite, ShardedLRUCacheTest, testCacheSizeN);
+	CppUnit_addTest(pSuite, ShardedLRUCacheTest, testClockReplacement);
+	CppUnit_addTest(pSuite, ShardedLRUCacheTest, testDuplicateAdd);
+	CppUnit_addTest(pSuite, ShardedLRUCacheTest, testRemove);
+	CppUnit_addTest(pSuite, ShardedLRUCacheTest, testForEach);
+	CppUnit_addTest(pSuite, ShardedLRUCacheTest, testShards);
+	CppUnit_addTest(pSuite, ShardedLRUCacheTest, testExpire);
+	CppUnit_addTest(pSuite, ShardedLRUCacheTest, testAccessExpire);
+	CppUnit_addTest(pSuite, ShardedLRUCacheTest, testConcurrentAccess);
+
+	return pSuite;
+}
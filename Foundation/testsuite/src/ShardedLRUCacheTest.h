@@ -0,0 +1,44 @@
+//
+// ShardedLRUCacheTest.h
+//
+// Tests for ShardedLRUCache, ShardedExpireLRUCache and ShardedAccessExpireLRUCache
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+#ifndef ShardedLRUCacheTest_INCLUDED
+#define ShardedLRUCacheTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class ShardedLRUCacheTest: public CppUnit::TestCase
+{
+public:
+	ShardedLRUCacheTest(const std::string& name);
+	~ShardedLRUCacheTest();
+
+	void testClear();
+	void testCacheSize0();
+	void testCacheSizeN();
+	void testClockReplacement();
+	void testDuplicateAdd();
+	void testRemove();
+	void testForEach();
+	void testShards();
+	void testExpire();
+	void testAccessExpire();
+	void testConcurrentAccess();
+
+	void setUp();
+	void tearDown();
+	static CppUnit::Test* suite();
+};
+
+
+#endif // ShardedLRUCacheTest_INCLUDED
@@ -14,6 +14,7 @@
 #include "RWLockTest.h"
 #include "ThreadPoolTest.h"
 #include "TimerTest.h"
+#include "TimingWheelTest.h"
 #include "ThreadLocalTest.h"
 #include "ActivityTest.h"
 #include "ActiveMethodTest.h"
@@ -21,6 +22,7 @@
 #include "ConditionTest.h"
 #include "ActiveThreadPoolTest.h"
 #include "SpinlockMutexTest.h"
+#include "WorkStealingThreadPoolTest.h"
 
 
 CppUnit::Test* ThreadingTestSuite::suite()
@@ -32,6 +34,7 @@ CppUnit::Test* ThreadingTestSuite::suite()
 	pSuite->addTest(RWLockTest::suite());
 	pSuite->addTest(ThreadPoolTest::suite());
 	pSuite->addTest(TimerTest::suite());
+	pSuite->addTest(TimingWheelTest::suite());
 	pSuite->addTest(ThreadLocalTest::suite());
 	pSuite->addTest(ActivityTest::suite());
 	pSuite->addTest(ActiveMethodTest::suite());
@@ -39,6 +42,7 @@ CppUnit::Test* ThreadingTestSuite::suite()
 	pSuite->addTest(ConditionTest::suite());
 	pSuite->addTest(ActiveThreadPoolTest::suite());
 	pSuite->addTest(SpinlockMutexTest::suite());
+	pSuite->addTest(WorkStealingThreadPoolTest::suite());
 
 	return pSuite;
 }
@@ -0,0 +1,304 @@
+//
+// TimingWheelTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "TimingWheelTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/TimingWheel.h"
+#include "Poco/Clock.h"
+#include "Poco/Event.h"
+#include "Poco/Thread.h"
+#include <vector>
+
+
+using Poco::TimingWheel;
+using Poco::Clock;
+using Poco::Timespan;
+
+
+namespace
+{
+	Clock at(const Clock& start, Poco::Int64 milliseconds)
+	{
+		Clock time(start);
+		time += milliseconds*1000;
+		return time;
+	}
+}
+
+
+TimingWheelTest::TimingWheelTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+TimingWheelTest::~TimingWheelTest()
+{
+}
+
+
+void TimingWheelTest::testSchedule()
+{
+	TimingWheel wheel;
+	Clock start;
+	int fired = 0;
+
+	TimingWheel::Handle h = wheel.schedule(at(start, 10), [&fired]() { fired++; });
+	assertTrue (!h.isNull());
+	assertTrue (wheel.isScheduled(h));
+	assertTrue (wheel.size() == 1);
+
+	assertTrue (wheel.advance(at(start, 5)) == 0);
+	assertTrue (wheel.advance(at(start, 9)) == 0);
+	assertTrue (fired == 0);
+	assertTrue (wheel.advance(at(start, 11)) == 1);
+	assertTrue (fired == 1);
+	assertTrue (!wheel.isScheduled(h));
+	assertTrue (wheel.empty());
+
+	// a timer in the past expires with the next tick
+	wheel.schedule(at(start, 1), [&fired]() { fired++; });
+	assertTrue (wheel.advance(at(start, 12)) == 1);
+	assertTrue (fired == 2);
+}
+
+
+void TimingWheelTest::testOrder()
+{
+	TimingWheel wheel;
+	Clock start;
+	std::vector<int> order;
+
+	wheel.schedule(at(start, 30), [&order]() { order.push_back(3); });
+	wheel.schedule(at(start, 10), [&order]() { order.push_back(1); });
+	wheel.schedule(at(start, 20), [&order]() { order.push_back(2); });
+	assertTrue (wheel.size() == 3);
+
+	assertTrue (wheel.advance(at(start, 100)) == 3);
+	assertTrue (order.size() == 3);
+	assertTrue (order[0] == 1);
+	assertTrue (order[1] == 2);
+	assertTrue (order[2] == 3);
+}
+
+
+void TimingWheelTest::testCascade()
+{
+	TimingWheel wheel;
+	Clock start;
+	std::vector<int> order;
+
+	// beyond the first wheel (256 ticks)
+	wheel.schedule(at(start, 300), [&order]() { order.push_back(300); });
+	wheel.schedule(at(start, 1000), [&order]() { order.push_back(1000); });
+	wheel.schedule(at(start, 257), [&order]() { order.push_back(257); });
+	wheel.schedule(at(start, 100), [&order]() { order.push_back(100); });
+
+	assertTrue (wheel.advance(at(start, 99)) == 0);
+	assertTrue (wheel.advance(at(start, 101)) == 1);
+	assertTrue (wheel.advance(at(start, 256)) == 0);
+	assertTrue (wheel.advance(at(start, 258)) == 1);
+	assertTrue (wheel.advance(at(start, 299)) == 0);
+	assertTrue (wheel.advance(at(start, 301)) == 1);
+	assertTrue (wheel.advance(at(start, 999)) == 0);
+	assertTrue (wheel.advance(at(start, 1001)) == 1);
+
+	assertTrue (order.size() == 4);
+	assertTrue (order[0] == 100);
+	assertTrue (order[1] == 257);
+	assertTrue (order[2] == 300);
+	assertTrue (order[3] == 1000);
+	assertTrue (wheel.empty());
+}
+
+
+void TimingWheelTest::testLongDelay()
+{
+	TimingWheel wheel;
+	Clock start;
+	int fired = 0;
+
+	const Poco::Int64 minute = 60*1000;
+	const Poco::Int64 day = 24*60*minute;
+
+	wheel.schedule(at(start, 70*1000), [&fired]() { fired++; });
+	wheel.schedule(at(start, 2*day), [&fired]() { fired++; });
+	// beyond the range of the outermost wheel
+	wheel.schedule(at(start, 60*day), [&fired]() { fired++; });
+
+	assertTrue (wheel.advance(at(start, 70*1000 - 1)) == 0);
+	assertTrue (wheel.advance(at(start, 70*1000 + 1)) == 1);
+	assertTrue (wheel.advance(at(start, 2*day - 1)) == 0);
+	assertTrue (wheel.advance(at(start, 2*day + 1)) == 1);
+	assertTrue (wheel.advance(at(start, 50*day)) == 0);
+	assertTrue (wheel.advance(at(start, 60*day - 1)) == 0);
+	assertTrue (wheel.advance(at(start, 60*day + 1)) == 1);
+	assertTrue (fired == 3);
+	assertTrue (wheel.empty());
+}
+
+
+void TimingWheelTest::testCancel()
+{
+	TimingWheel wheel;
+	Clock start;
+	int fired = 0;
+
+	TimingWheel::Handle h1 = wheel.schedule(at(start, 10), [&fired]() { fired += 1; });
+	TimingWheel::Handle h2 = wheel.schedule(at(start, 10), [&fired]() { fired += 10; });
+	TimingWheel::Handle h3 = wheel.schedule(at(start, 500), [&fired]() { fired += 100; });
+	assertTrue (wheel.size() == 3);
+
+	assertTrue (wheel.cancel(h1));
+	assertTrue (h1.isNull());
+	assertTrue (!wheel.cancel(h1));
+	assertTrue (wheel.cancel(h3));
+	assertTrue (wheel.size() == 1);
+
+	assertTrue (wheel.advance(at(start, 1000)) == 1);
+	assertTrue (fired == 10);
+
+	// stale handles must not affect timers reusing the same node
+	TimingWheel::Handle h4 = wheel.schedule(at(start, 1010), [&fired]() { fired += 1000; });
+	assertTrue (!wheel.cancel(h2));
+	assertTrue (wheel.isScheduled(h4));
+	assertTrue (wheel.advance(at(start, 1020)) == 1);
+	assertTrue (fired == 1010);
+}
+
+
+void TimingWheelTest::testReschedule()
+{
+	TimingWheel wheel;
+	int fired = 0;
+
+	TimingWheel::Handle h = wheel.schedule(Timespan(0, 10000), [&fired]() { fired++; });
+	assertTrue (wheel.reschedule(h, Timespan(10, 0)));
+	assertTrue (wheel.isScheduled(h));
+
+	Clock now;
+	assertTrue (wheel.advance(at(now, 100)) == 0);
+	assertTrue (wheel.advance(at(now, 9000)) == 0);
+	assertTrue (wheel.advance(at(now, 10100)) == 1);
+	assertTrue (fired == 1);
+	assertTrue (!wheel.reschedule(h, Timespan(1, 0)));
+}
+
+
+void TimingWheelTest::testScheduleFromCallback()
+{
+	TimingWheel wheel;
+	Clock start;
+	int fired = 0;
+
+	TimingWheel::Handle h;
+	std::function<void()> periodic = [&]()
+	{
+		fired++;
+		if (fired < 3) h = wheel.schedule(at(start, 10*(fired + 1)), periodic);
+	};
+	h = wheel.schedule(at(start, 10), periodic);
+
+	assertTrue (wheel.advance(at(start, 11)) == 1);
+	assertTrue (wheel.isScheduled(h));
+	assertTrue (wheel.advance(at(start, 21)) == 1);
+	assertTrue (wheel.advance(at(start, 31)) == 1);
+	assertTrue (fired == 3);
+	assertTrue (wheel.empty());
+}
+
+
+void TimingWheelTest::testNextTimeout()
+{
+	TimingWheel wheel;
+	const Timespan maxTimeout(1, 0);
+
+	assertTrue (wheel.nextTimeout(maxTimeout) == maxTimeout);
+
+	TimingWheel::Handle h = wheel.schedule(Timespan(0, 50000), []() {});
+	Timespan timeout = wheel.nextTimeout(maxTimeout);
+	assertTrue (timeout > 0 && timeout <= Timespan(0, 51000));
+
+	wheel.cancel(h);
+	wheel.schedule(Timespan(10, 0), []() {});
+	timeout = wheel.nextTimeout(maxTimeout);
+	assertTrue (timeout > 0 && timeout <= maxTimeout);
+	timeout = wheel.nextTimeout(Timespan(60, 0));
+	assertTrue (timeout <= Timespan(10, 1000));
+}
+
+
+void TimingWheelTest::testClear()
+{
+	TimingWheel wheel;
+	Clock start;
+	int fired = 0;
+
+	TimingWheel::Handle h = wheel.schedule(at(start, 10), [&fired]() { fired++; });
+	wheel.schedule(at(start, 1000), [&fired]() { fired++; });
+	wheel.schedule(at(start, 100000), [&fired]() { fired++; });
+	assertTrue (wheel.size() == 3);
+
+	wheel.clear();
+	assertTrue (wheel.empty());
+	assertTrue (!wheel.isScheduled(h));
+	assertTrue (wheel.advance(at(start, 200000)) == 0);
+	assertTrue (fired == 0);
+
+	wheel.schedule(at(start, 200010), [&fired]() { fired++; });
+	assertTrue (wheel.advance(at(start, 200011)) == 1);
+	assertTrue (fired == 1);
+}
+
+
+void TimingWheelTest::testRealTime()
+{
+	TimingWheel wheel;
+	Poco::Event event;
+	Clock start;
+
+	wheel.schedule(Timespan(0, 50000), [&event]() { event.set(); });
+	while (!event.tryWait(0))
+	{
+		Poco::Thread::sleep(static_cast<long>(wheel.nextTimeout(Timespan(0, 10000)).totalMilliseconds()) + 1);
+		wheel.advance();
+	}
+	assertTrue (start.elapsed() >= 50000);
+	assertTrue (wheel.empty());
+}
+
+
+void TimingWheelTest::setUp()
+{
+}
+
+
+void TimingWheelTest::tearDown()
+{
+}
+
+
+CppUnit::Test* TimingWheelTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("TimingWheelTest");
+
+	CppUnit_addTest(pSuite, TimingWheelTest, testSchedule);
+	CppUnit_addTest(pSuite, TimingWheelTest, testOrder);
+	CppUnit_addTest(pSuite, TimingWheelTest, testCascade);
+	CppUnit_addTest(pSuite, TimingWheelTest, testLongDelay);
+	CppUnit_addTest(pSuite, TimingWheelTest, testCancel);
+	CppUnit_addTest(pSuite, TimingWheelTest, testReschedule);
+	CppUnit_addTest(pSuite, TimingWheelTest, testScheduleFromCallback);
+	CppUnit_addTest(pSuite, TimingWheelTest, testNextTimeout);
+	CppUnit_addTest(pSuite, TimingWheelTest, testClear);
+	CppUnit_addTest(pSuite, TimingWheelTest, testRealTime);
+
+	return pSuite;
+}
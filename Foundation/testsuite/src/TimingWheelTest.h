@@ -0,0 +1,45 @@
+//
+// TimingWheelTest.h
+//
+// Definition of the TimingWheelTest class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef TimingWheelTest_INCLUDED
+#define TimingWheelTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class TimingWheelTest: public CppUnit::TestCase
+{
+public:
+	TimingWheelTest(const std::string& name);
+	~TimingWheelTest();
+
+	void testSchedule();
+	void testOrder();
+	void testCascade();
+	void testLongDelay();
+	void testCancel();
+	void testReschedule();
+	void testScheduleFromCallback();
+	void testNextTimeout();
+	void testClear();
+	void testRealTime();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // TimingWheelTest_INCLUDED
@@ -0,0 +1,540 @@
+//
+// WorkStealingThreadPoolTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "WorkStealingThreadPoolTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/WorkStealingThreadPool.h"
+#include "Poco/WorkStealingQueue.h"
+#include "Poco/Future.h"
+#include "Poco/ActiveMethod.h"
+#include "Poco/ActiveStarter.h"
+#include "Poco/TaskManager.h"
+#include "Poco/Task.h"
+#include "Poco/Runnable.h"
+#include "Poco/Thread.h"
+#include "Poco/Exception.h"
+#include <atomic>
+#include <numeric>
+#include <set>
+#include <vector>
+
+
+using Poco::WorkStealingThreadPool;
+using Poco::WorkStealingQueue;
+using Poco::Future;
+using Poco::Promise;
+using Poco::ActiveMethod;
+using Poco::ActiveResult;
+using Poco::WorkStealingStarter;
+using Poco::TaskManager;
+using Poco::Task;
+using Poco::Runnable;
+using Poco::Thread;
+
+
+namespace
+{
+	class CountingRunnable: public Runnable
+	{
+	public:
+		CountingRunnable(): _count(0)
+		{
+		}
+
+		void run()
+		{
+			++_count;
+		}
+
+		int count() const
+		{
+			return _count;
+		}
+
+	private:
+		std::atomic<int> _count;
+	};
+
+	class ActiveObject
+	{
+	public:
+		ActiveObject():
+			square(this, &ActiveObject::squareImpl)
+		{
+		}
+
+		ActiveMethod<int, int, ActiveObject, WorkStealingStarter<ActiveObject>> square;
+
+	protected:
+		int squareImpl(const int& n)
+		{
+			if (n < 0) throw Poco::InvalidArgumentException("negative");
+			return n*n;
+		}
+	};
+
+	class CountingTask: public Task
+	{
+	public:
+		CountingTask(std::atomic<int>& counter):
+			Task("CountingTask"),
+			_counter(counter)
+		{
+		}
+
+		void runTask() override
+		{
+			++_counter;
+		}
+
+	private:
+		std::atomic<int>& _counter;
+	};
+}
+
+
+WorkStealingThreadPoolTest::WorkStealingThreadPoolTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+WorkStealingThreadPoolTest::~WorkStealingThreadPoolTest()
+{
+}
+
+
+void WorkStealingThreadPoolTest::testQueue()
+{
+	WorkStealingQueue<int*> queue(2);
+	int values[100];
+	assertTrue (queue.empty());
+	assertTrue (queue.pop() == nullptr);
+	assertTrue (queue.steal() == nullptr);
+
+	for (int i = 0; i < 100; i++) queue.push(&values[i]);
+	assertTrue (queue.size() == 100);
+
+	// owner pops LIFO, thieves steal FIFO
+	assertTrue (queue.pop() == &values[99]);
+	assertTrue (queue.steal() == &values[0]);
+	assertTrue (queue.steal() == &values[1]);
+	assertTrue (queue.pop() == &values[98]);
+	assertTrue (queue.size() == 96);
+
+	int n = 0;
+	while (queue.pop()) n++;
+	assertTrue (n == 96);
+	assertTrue (queue.empty());
+}
+
+
+void WorkStealingThreadPoolTest::testQueueSteal()
+{
+	const int COUNT = 200000;
+	const int THIEVES = 3;
+	WorkStealingQueue<int*> queue(16);
+	std::vector<int> values(COUNT);
+	std::vector<std::atomic<int>> taken(COUNT);
+	for (auto& t: taken) t = 0;
+	std::atomic<bool> done(false);
+
+	std::vector<std::unique_ptr<Thread>> thieves;
+	for (int i = 0; i < THIEVES; i++)
+	{
+		thieves.push_back(std::make_unique<Thread>());
+		thieves.back()->startFunc([&]()
+			{
+				while (!done || !queue.empty())
+				{
+					int* p = queue.steal();
+					if (p) ++taken[p - values.data()];
+				}
+			});
+	}
+
+	for (int i = 0; i < COUNT; i++)
+	{
+		queue.push(&values[i]);
+		if (i % 3 == 0)
+		{
+			int* p = queue.pop();
+			if (p) ++taken[p - values.data()];
+		}
+	}
+	done = true;
+	for (auto& pThread: thieves) pThread->join();
+	while (int* p = queue.pop()) ++taken[p - values.data()];
+
+	// every element has been taken exactly once
+	for (int i = 0; i < COUNT; i++)
+	{
+		assertTrue (taken[i] == 1);
+	}
+}
+
+
+void WorkStealingThreadPoolTest::testStart()
+{
+	WorkStealingThreadPool pool("test", 4);
+	assertTrue (pool.capacity() == 4);
+	assertTrue (pool.name() == "test");
+
+	CountingRunnable runnable;
+	for (int i = 0; i < 1000; i++)
+	{
+		pool.start(runnable);
+	}
+	std::atomic<int> count(0);
+	for (int i = 0; i < 1000; i++)
+	{
+		pool.execute([&count]() { ++count; });
+	}
+	pool.joinAll();
+	assertTrue (runnable.count() == 1000);
+	assertTrue (count == 1000);
+}
+
+
+void WorkStealingThreadPoolTest::testSubmit()
+{
+	WorkStealingThreadPool pool(4);
+
+	std::vector<Future<int>> futures;
+	for (int i = 0; i < 100; i++)
+	{
+		futures.push_back(pool.submit([i]() { return i*i; }));
+	}
+	for (int i = 0; i < 100; i++)
+	{
+		assertTrue (futures[i].get() == i*i);
+	}
+
+	std::atomic<bool> ran(false);
+	Future<void> fv = pool.submit([&ran]() { ran = true; });
+	fv.get();
+	assertTrue (ran);
+	assertTrue (fv.isReady());
+	assertTrue (!fv.failed());
+
+	// move-only functors
+	auto pValue = std::make_unique<std::string>("hello");
+	Future<std::size_t> fs = pool.submit([p = std::move(pValue)]() { return p->size(); });
+	assertTrue (fs.get() == 5);
+
+	Future<int> invalid;
+	assertTrue (!invalid.valid());
+	try
+	{
+		invalid.get();
+		fail("invalid future - must throw");
+	}
+	catch (Poco::InvalidAccessException&)
+	{
+	}
+}
+
+
+void WorkStealingThreadPoolTest::testSubmitException()
+{
+	WorkStealingThreadPool pool(2);
+
+	Future<int> f = pool.submit([]() -> int { throw Poco::NotFoundException("missing"); });
+	f.wait();
+	assertTrue (f.failed());
+	try
+	{
+		f.get();
+		fail("must throw");
+	}
+	catch (Poco::NotFoundException& exc)
+	{
+		assertTrue (exc.message() == "missing");
+	}
+}
+
+
+void WorkStealingThreadPoolTest::testThen()
+{
+	WorkStealingThreadPool pool(4);
+
+	Future<std::string> f = pool.submit([]() { return 20; })
+		.then([](const int& n) { return n + 1; })
+		.then([](const int& n) { return n*2; })
+		.then([](const int& n) { return std::to_string(n); });
+	assertTrue (f.get() == "42");
+
+	std::atomic<int> value(0);
+	Future<void> fv = pool.submit([]() { return 7; })
+		.then([&value](const int& n) { value = n; })
+		.then([&value]() { value = value*6; });
+	fv.get();
+	assertTrue (value == 42);
+
+	// continuation registered after the result is available
+	Future<int> ready = pool.submit([]() { return 1; });
+	ready.wait();
+	assertTrue (ready.then([](const int& n) { return n + 1; }).get() == 2);
+}
+
+
+void WorkStealingThreadPoolTest::testThenException()
+{
+	WorkStealingThreadPool pool(2);
+
+	std::atomic<bool> called(false);
+	Future<int> f = pool.submit([]() -> int { throw Poco::RangeException("range"); })
+		.then([&called](const int& n) { called = true; return n; });
+	try
+	{
+		f.get();
+		fail("must throw");
+	}
+	catch (Poco::RangeException&)
+	{
+	}
+	assertTrue (!called);
+
+	Future<int> g = pool.submit([]() { return 1; })
+		.then([](const int&) -> int { throw Poco::IOException("io"); });
+	try
+	{
+		g.get();
+		fail("must throw");
+	}
+	catch (Poco::IOException&)
+	{
+	}
+}
+
+
+void WorkStealingThreadPoolTest::testPromise()
+{
+	Promise<int> promise;
+	Future<int> future = promise.future();
+	Future<int> next = future.then([](const int& n) { return n + 1; });
+	assertTrue (!future.isReady());
+	assertTrue (!future.tryWait(10));
+
+	Thread thread;
+	thread.startFunc([promise]() { promise.set(41); });
+	assertTrue (next.get() == 42);
+	assertTrue (future.get() == 41);
+	thread.join();
+
+	try
+	{
+		promise.set(1);
+		fail("already satisfied - must throw");
+	}
+	catch (Poco::IllegalStateException&)
+	{
+	}
+
+	Promise<void> voidPromise;
+	voidPromise.setException(std::make_exception_ptr(Poco::TimeoutException()));
+	assertTrue (voidPromise.future().failed());
+}
+
+
+void WorkStealingThreadPoolTest::testWhenAll()
+{
+	WorkStealingThreadPool pool(4);
+
+	std::vector<Future<int>> futures;
+	for (int i = 0; i < 50; i++)
+	{
+		futures.push_back(pool.submit([i]() { return i; }));
+	}
+	Future<int> sum = Poco::whenAll(futures).then([](const std::vector<int>& values)
+		{
+			for (std::size_t i = 0; i < values.size(); i++)
+			{
+				if (values[i] != static_cast<int>(i)) throw Poco::AssertionViolationException("order");
+			}
+			return std::accumulate(values.begin(), values.end(), 0);
+		});
+	assertTrue (sum.get() == 49*50/2);
+
+	futures.push_back(pool.submit([]() -> int { throw Poco::DataException("data"); }));
+	Future<std::vector<int>> failed = Poco::whenAll(futures);
+	failed.wait();
+	assertTrue (failed.failed());
+
+	assertTrue (Poco::whenAll(std::vector<Future<int>>()).get().empty());
+}
+
+
+void WorkStealingThreadPoolTest::testWhenAllVoid()
+{
+	WorkStealingThreadPool pool(4);
+
+	std::atomic<int> count(0);
+	std::vector<Future<void>> futures;
+	for (int i = 0; i < 50; i++)
+	{
+		futures.push_back(pool.submit([&count]() { Thread::sleep(1); ++count; }));
+	}
+	Poco::whenAll(futures).get();
+	assertTrue (count == 50);
+}
+
+
+void WorkStealingThreadPoolTest::testParallelFor()
+{
+	WorkStealingThreadPool pool(4);
+
+	const int N = 100000;
+	std::vector<int> data(N, 0);
+	pool.parallelFor(0, N, [&data](int i) { data[i] = i; });
+	for (int i = 0; i < N; i++)
+	{
+		assertTrue (data[i] == i);
+	}
+
+	std::atomic<long> sum(0);
+	pool.parallelFor<std::size_t>(10, 20, [&sum](std::size_t i) { sum += static_cast<long>(i); }, 3);
+	assertTrue (sum == 145);
+
+	// empty range
+	pool.parallelFor(5, 5, [](int) { throw Poco::BugcheckException(); });
+}
+
+
+void WorkStealingThreadPoolTest::testParallelForNested()
+{
+	WorkStealingThreadPool pool(4);
+
+	const int N = 64;
+	std::vector<std::atomic<int>> counts(N*N);
+	for (auto& c: counts) c = 0;
+	pool.parallelFor(0, N, [&](int i)
+		{
+			pool.parallelFor(0, N, [&](int j) { ++counts[i*N + j]; });
+		});
+	for (auto& c: counts)
+	{
+		assertTrue (c == 1);
+	}
+}
+
+
+void WorkStealingThreadPoolTest::testParallelForException()
+{
+	WorkStealingThreadPool pool(4);
+
+	try
+	{
+		pool.parallelFor(0, 1000, [](int i)
+			{
+				if (i == 500) throw Poco::InvalidArgumentException("500");
+			});
+		fail("must throw");
+	}
+	catch (Poco::InvalidArgumentException& exc)
+	{
+		assertTrue (exc.message() == "500");
+	}
+}
+
+
+void WorkStealingThreadPoolTest::testFanOut()
+{
+	WorkStealingThreadPool pool(4);
+
+	// tasks spawning tasks, pushed to the workers' own queues
+	std::atomic<int> count(0);
+	std::function<void(int)> spawn = [&](int depth)
+	{
+		++count;
+		if (depth > 0)
+		{
+			for (int i = 0; i < 4; i++)
+			{
+				pool.execute([&spawn, depth]() { spawn(depth - 1); });
+			}
+		}
+	};
+	pool.execute([&spawn]() { spawn(6); });
+	pool.joinAll();
+	// 1 + 4 + 16 + ... + 4^6
+	assertTrue (count == 5461);
+}
+
+
+void WorkStealingThreadPoolTest::testActiveMethod()
+{
+	ActiveObject obj;
+	std::vector<ActiveResult<int>> results;
+	for (int i = 0; i < 100; i++)
+	{
+		results.push_back(obj.square(i));
+	}
+	for (int i = 0; i < 100; i++)
+	{
+		results[i].wait();
+		assertTrue (results[i].data() == i*i);
+	}
+
+	ActiveResult<int> result = obj.square(-1);
+	result.wait();
+	assertTrue (result.failed());
+}
+
+
+void WorkStealingThreadPoolTest::testTaskManager()
+{
+	WorkStealingThreadPool pool(4);
+	TaskManager tm(pool);
+
+	std::atomic<int> counter(0);
+	for (int i = 0; i < 100; i++)
+	{
+		assertTrue (tm.start(new CountingTask(counter)));
+	}
+	tm.joinAll();
+	assertTrue (counter == 100);
+	assertTrue (tm.count() == 0);
+}
+
+
+void WorkStealingThreadPoolTest::setUp()
+{
+}
+
+
+void WorkStealingThreadPoolTest::tearDown()
+{
+}
+
+
+CppUnit::Test* WorkStealingThreadPoolTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("WorkStealingThreadPoolTest");
+
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testQueue);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testQueueSteal);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testStart);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testSubmit);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testSubmitException);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testThen);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testThenException);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testPromise);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testWhenAll);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testWhenAllVoid);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testParallelFor);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testParallelForNested);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testParallelForException);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testFanOut);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testActiveMethod);
+	CppUnit_addTest(pSuite, WorkStealingThreadPoolTest, testTaskManager);
+
+	return pSuite;
+}
@@ -0,0 +1,51 @@
+//
+// WorkStealingThreadPoolTest.h
+//
+// Definition of the WorkStealingThreadPoolTest class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef WorkStealingThreadPoolTest_INCLUDED
+#define WorkStealingThreadPoolTest_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class WorkStealingThreadPoolTest: public CppUnit::TestCase
+{
+public:
+	WorkStealingThreadPoolTest(const std::string& name);
+	~WorkStealingThreadPoolTest();
+
+	void testQueue();
+	void testQueueSteal();
+	void testStart();
+	void testSubmit();
+	void testSubmitException();
+	void testThen();
+	void testThenException();
+	void testPromise();
+	void testWhenAll();
+	void testWhenAllVoid();
+	void testParallelFor();
+	void testParallelForNested();
+	void testParallelForException();
+	void testFanOut();
+	void testActiveMethod();
+	void testTaskManager();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // WorkStealingThreadPoolTest_INCLUDED
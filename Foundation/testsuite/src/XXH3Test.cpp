@@ -0,0 +1,205 @@
+//
+// XXH3Test.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "XXH3Test.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/XXH3.h"
+#include "Poco/XXH3Engine.h"
+#include "Poco/HashMap.h"
+#include "Poco/NumberFormatter.h"
+#include <unordered_set>
+#include <vector>
+
+
+using Poco::XXH3;
+using Poco::XXH3Engine;
+using Poco::XXH3Hash;
+using Poco::DigestEngine;
+using Poco::UInt64;
+
+
+namespace
+{
+	struct TestVector
+	{
+		std::size_t length;
+		UInt64 hash;
+		UInt64 seededHash;
+	};
+
+	// computed with the xxHash 0.8 reference implementation, for
+	// data[i] = i*13 + 7 and seed 0x9E3779B185EBCA8D.
+	const TestVector testVectors[] =
+	{
+		{0, 0x2d06800538d394c2ULL, 0xa8a6b918b2f0364aULL},
+		{1, 0x4c5cca45d0f4811fULL, 0xfb9ffac0328029fcULL},
+		{3, 0x4db84cde75d05c7dULL, 0xcaa355f18d0aee47ULL},
+		{4, 0x6463b635ef5d0cc4ULL, 0x6c23f4dc64b7eac2ULL},
+		{8, 0xdfb79fcb63835895ULL, 0x1c544e6d4cbac099ULL},
+		{9, 0xa2535ff36fcf5851ULL, 0x36a212d2ff95e93aULL},
+		{16, 0xec6bdc9b2f13aad3ULL, 0xa596955f9ea29aedULL},
+		{17, 0x15caf8ebb21d1562ULL, 0x9bd6da79fc7185edULL},
+		{128, 0x9e05455fa1160f7cULL, 0x7aced6e9bff17f3cULL},
+		{129, 0xda54f1b29f59de42ULL, 0xf08f4c88e369784bULL},
+		{240, 0x550ffa8941c3677eULL, 0x5c809dfe4f0f6295ULL},
+		{241, 0xf15e917afa846fcaULL, 0x5825bdca1ea529cfULL},
+		{1024, 0xebe3895920eba858ULL, 0x8ce5c63729a58e59ULL},
+		{5000, 0xd501312f1c1f7b2fULL, 0x09f6170a43eab0b3ULL}
+	};
+
+	const UInt64 SEED = 0x9E3779B185EBCA8DULL;
+
+	std::vector<unsigned char> testData()
+	{
+		std::vector<unsigned char> data(5000);
+		for (std::size_t i = 0; i < data.size(); i++)
+		{
+			data[i] = static_cast<unsigned char>(i*13 + 7);
+		}
+		return data;
+	}
+}
+
+
+XXH3Test::XXH3Test(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+XXH3Test::~XXH3Test()
+{
+}
+
+
+void XXH3Test::testHash()
+{
+	std::vector<unsigned char> data = testData();
+	for (const auto& v: testVectors)
+	{
+		assertEqual (v.hash, XXH3::hash(data.data(), v.length));
+	}
+	assertEqual (0x78af5f94892f3950ULL, XXH3::hash("abc"));
+	assertEqual (0x78af5f94892f3950ULL, XXH3::hash(std::string("abc")));
+}
+
+
+void XXH3Test::testSeed()
+{
+	std::vector<unsigned char> data = testData();
+	for (const auto& v: testVectors)
+	{
+		assertEqual (v.seededHash, XXH3::hash(data.data(), v.length, SEED));
+	}
+	assertTrue (XXH3::hash("abc", 1) != XXH3::hash("abc", 2));
+}
+
+
+void XXH3Test::testStreaming()
+{
+	std::vector<unsigned char> data = testData();
+	for (const auto& v: testVectors)
+	{
+		for (std::size_t chunk: {1, 7, 64, 100, 256, 1000})
+		{
+			XXH3 xxh3;
+			XXH3 seeded(SEED);
+			for (std::size_t pos = 0; pos < v.length; pos += chunk)
+			{
+				std::size_t n = std::min(chunk, v.length - pos);
+				xxh3.update(data.data() + pos, n);
+				seeded.update(data.data() + pos, n);
+			}
+			assertEqual (v.hash, xxh3.digest());
+			assertEqual (v.seededHash, seeded.digest());
+		}
+	}
+
+	// digest() does not change the state
+	XXH3 xxh3;
+	xxh3.update(data.data(), 1000);
+	UInt64 h = xxh3.digest();
+	assertEqual (h, xxh3.digest());
+	xxh3.update(data.data() + 1000, 4000);
+	assertEqual (testVectors[13].hash, xxh3.digest());
+
+	xxh3.reset();
+	assertEqual (testVectors[0].hash, xxh3.digest());
+	xxh3.reset(SEED);
+	assertTrue (xxh3.seed() == SEED);
+	assertEqual (testVectors[0].seededHash, xxh3.digest());
+}
+
+
+void XXH3Test::testEngine()
+{
+	std::vector<unsigned char> data = testData();
+	XXH3Engine engine;
+	assertTrue (engine.digestLength() == 8);
+	engine.update(data.data(), 1024);
+	assertTrue (DigestEngine::digestToHex(engine.digest()) == "ebe3895920eba858");
+	engine.update("abc");
+	assertTrue (DigestEngine::digestToHex(engine.digest()) == "78af5f94892f3950");
+	assertTrue (DigestEngine::digestToHex(engine.digest()) == "2d06800538d394c2");
+}
+
+
+void XXH3Test::testHashFunction()
+{
+	XXH3Hash<std::string> stringHash;
+	XXH3Hash<std::string_view> stringViewHash;
+	assertTrue (stringHash("hello") == stringViewHash("hello"));
+	assertTrue (stringHash("hello") != stringHash("hellp"));
+
+	XXH3Hash<int> intHash;
+	std::unordered_set<std::size_t> hashes;
+	for (int i = 0; i < 10000; i++)
+	{
+		hashes.insert(intHash(i));
+	}
+	assertTrue (hashes.size() == 10000);
+
+	Poco::HashMap<std::string, int, XXH3Hash<std::string>> map;
+	for (int i = 0; i < 1000; i++)
+	{
+		map[Poco::NumberFormatter::format(i)] = i;
+	}
+	assertTrue (map.size() == 1000);
+	for (int i = 0; i < 1000; i++)
+	{
+		auto it = map.find(Poco::NumberFormatter::format(i));
+		assertTrue (it != map.end());
+		assertTrue (it->second == i);
+	}
+}
+
+
+void XXH3Test::setUp()
+{
+}
+
+
+void XXH3Test::tearDown()
+{
+}
+
+
+CppUnit::Test* XXH3Test::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("XXH3Test");
+
+	CppUnit_addTest(pSuite, XXH3Test, testHash);
+	CppUnit_addTest(pSuite, XXH3Test, testSeed);
+	CppUnit_addTest(pSuite, XXH3Test, testStreaming);
+	CppUnit_addTest(pSuite, XXH3Test, testEngine);
+	CppUnit_addTest(pSuite, XXH3Test, testHashFunction);
+
+	return pSuite;
+}
@@ -0,0 +1,42 @@
+//
+// XXH3Test.h
+//
+// Definition of the XXH3Test class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef XXH3Test_INCLUDED
+#define XXH3Test_INCLUDED
+
+
+#include "Poco/Foundation.h"
+#include "CppUnit/TestCase.h"
+
+
+class XXH3Test: public CppUnit::TestCase
+{
+public:
+	XXH3Test(const std::string& name);
+	~XXH3Test();
+
+	void testHash();
+	void testSeed();
+	void testStreaming();
+	void testEngine();
+	void testHashFunction();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // XXH3Test_INCLUDED
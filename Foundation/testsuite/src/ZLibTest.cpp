@@ -27,6 +27,27 @@ using Poco::DeflatingStreamBuf;
 using Poco::StreamCopier;
 
 
+namespace
+{
+	std::string generateData(std::size_t size)
+	{
+		// compressible, but not trivially so
+		std::string data;
+		data.reserve(size);
+		Poco::UInt32 seed = 12345;
+		while (data.size() < size)
+		{
+			seed = seed*1103515245 + 12345;
+			data += "line ";
+			data += std::to_string((seed >> 16) % 1000);
+			data += (seed & 0x100) ? " abcdefghijklmnop\n" : " qrstuvwxyz\n";
+		}
+		data.resize(size);
+		return data;
+	}
+}
+
+
 ZLibTest::ZLibTest(const std::string& name): CppUnit::TestCase(name)
 {
 }
@@ -174,6 +195,111 @@ void ZLibTest::testGzip3()
 }
 
 
+void ZLibTest::testParallelDeflate()
+{
+	const std::string data = generateData(1000000);
+	std::stringstream buffer;
+	{
+		DeflatingStreamBuf buf(buffer, DeflatingStreamBuf::STREAM_ZLIB, DeflatingStreamBuf::DEFAULT_COMPRESSION, 4);
+		assertTrue (buf.threads() == 4);
+		DeflatingStreamBuf serialBuf(buffer, DeflatingStreamBuf::STREAM_ZLIB, DeflatingStreamBuf::DEFAULT_COMPRESSION, 1);
+		assertTrue (serialBuf.threads() == 1);
+		DeflatingStreamBuf defaultBuf(buffer, DeflatingStreamBuf::STREAM_ZLIB, DeflatingStreamBuf::DEFAULT_COMPRESSION, 0);
+		assertTrue (defaultBuf.threads() >= 1);
+	}
+	buffer.str("");
+	DeflatingOutputStream deflater(buffer, DeflatingStreamBuf::STREAM_ZLIB, DeflatingStreamBuf::DEFAULT_COMPRESSION, 4, 65536);
+	deflater.write(data.data(), data.size());
+	deflater.close();
+
+	std::string compressed = buffer.str();
+	assertTrue (compressed.size() < data.size()/2);
+	assertTrue (static_cast<unsigned char>(compressed[0]) == 0x78);
+	assertTrue (((static_cast<unsigned char>(compressed[0]) << 8) + static_cast<unsigned char>(compressed[1])) % 31 == 0);
+
+	InflatingInputStream inflater(buffer);
+	std::string result;
+	StreamCopier::copyToString(inflater, result);
+	assertTrue (result == data);
+
+	// serial compression in the same stream
+	std::stringstream serialBuffer;
+	DeflatingOutputStream serialDeflater(serialBuffer, DeflatingStreamBuf::STREAM_ZLIB, DeflatingStreamBuf::DEFAULT_COMPRESSION, 1);
+	serialDeflater.write(data.data(), data.size());
+	serialDeflater.close();
+	InflatingInputStream serialInflater(serialBuffer);
+	result.clear();
+	StreamCopier::copyToString(serialInflater, result);
+	assertTrue (result == data);
+}
+
+
+void ZLibTest::testParallelGzip()
+{
+	const std::string data = generateData(500000);
+	std::stringstream buffer;
+	for (int level: {DeflatingStreamBuf::BEST_SPEED, DeflatingStreamBuf::BEST_COMPRESSION})
+	{
+		DeflatingOutputStream deflater(buffer, DeflatingStreamBuf::STREAM_GZIP, level, 0, 32768);
+		deflater.write(data.data(), data.size());
+		deflater.close();
+	}
+
+	std::string compressed = buffer.str();
+	assertTrue (static_cast<unsigned char>(compressed[0]) == 0x1F);
+	assertTrue (static_cast<unsigned char>(compressed[1]) == 0x8B);
+
+	// gzip trailer contains the uncompressed size
+	std::size_t size = 0;
+	for (int i = 0; i < 4; i++)
+		size += static_cast<std::size_t>(static_cast<unsigned char>(compressed[compressed.size() - 4 + i])) << (8*i);
+	assertTrue (size == data.size());
+
+	// two concatenated gzip members
+	InflatingInputStream inflater(buffer, InflatingStreamBuf::STREAM_GZIP);
+	std::string result;
+	StreamCopier::copyToString(inflater, result);
+	assertTrue (result == data);
+	inflater.reset();
+	result.clear();
+	StreamCopier::copyToString(inflater, result);
+	assertTrue (result == data);
+}
+
+
+void ZLibTest::testParallelSync()
+{
+	std::stringstream buffer;
+	DeflatingOutputStream deflater(buffer, DeflatingStreamBuf::STREAM_GZIP, DeflatingStreamBuf::DEFAULT_COMPRESSION, 2);
+	deflater << "abcdefabcdefabcdefabcdefabcdefabcdef" << std::endl;
+	deflater.flush();
+	std::string::size_type flushed = buffer.str().size();
+	assertTrue (flushed > 10);
+	deflater << "abcdefabcdefabcdefabcdefabcdefabcdef" << std::endl;
+	deflater.flush();
+	deflater.flush();
+	assertTrue (buffer.str().size() > flushed);
+	deflater.close();
+
+	InflatingInputStream inflater(buffer, InflatingStreamBuf::STREAM_GZIP);
+	std::string data;
+	inflater >> data;
+	assertTrue (data == "abcdefabcdefabcdefabcdefabcdefabcdef");
+	inflater >> data;
+	assertTrue (data == "abcdefabcdefabcdefabcdefabcdefabcdef");
+
+	std::stringstream emptyBuffer;
+	DeflatingOutputStream emptyDeflater(emptyBuffer, DeflatingStreamBuf::STREAM_ZLIB, DeflatingStreamBuf::DEFAULT_COMPRESSION, 4);
+	emptyDeflater.close();
+	assertTrue (!emptyBuffer.str().empty());
+	InflatingInputStream emptyInflater(emptyBuffer);
+	data.clear();
+	StreamCopier::copyToString(emptyInflater, data);
+	assertTrue (data.empty());
+	assertTrue (emptyInflater.eof());
+}
+
+
 void ZLibTest::setUp()
 {
 }
@@ -195,6 +321,9 @@ CppUnit::Test* ZLibTest::suite()
 	CppUnit_addTest(pSuite, ZLibTest, testGzip1);
 	CppUnit_addTest(pSuite, ZLibTest, testGzip2);
 	CppUnit_addTest(pSuite, ZLibTest, testGzip3);
+	CppUnit_addTest(pSuite, ZLibTest, testParallelDeflate);
+	CppUnit_addTest(pSuite, ZLibTest, testParallelGzip);
+	CppUnit_addTest(pSuite, ZLibTest, testParallelSync);
 
 	return pSuite;
 }
@@ -31,6 +31,9 @@ public:
 	void testGzip1();
 	void testGzip2();
 	void testGzip3();
+	void testParallelDeflate();
+	void testParallelGzip();
+	void testParallelSync();
 
 	void setUp();
 	void tearDown();
@@ -0,0 +1,548 @@
+//
+// Document.h
+//
+// Library: JSON
+// Package: JSON
+// Module:  Document
+//
+// Definition of the Document class.
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef JSON_JSONDocument_INCLUDED
+#define JSON_JSONDocument_INCLUDED
+
+
+#include "Poco/JSON/JSON.h"
+#include "Poco/JSON/Object.h"
+#include "Poco/JSON/Array.h"
+#include "Poco/Dynamic/Var.h"
+#include "Poco/SharedPtr.h"
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+namespace Poco {
+namespace JSON {
+
+
+class JSON_API Document
+	/// A read-only JSON document, parsed into a compact tape.
+	///
+	/// Unlike Parser with ParseHandler, which builds a tree of Object
+	/// and Array instances holding a Dynamic::Var for every value,
+	/// Document parses the JSON text into a flat array of fixed-size
+	/// nodes (the tape), in document order. Every node refers to
+	/// its text in the JSON source kept by the Document: strings that
+	/// contain no escape sequences are referenced in place, and only
+	/// strings containing escape sequences are unescaped, into a single
+	/// buffer shared by all strings of the document. Numbers are
+	/// validated when parsing, but converted only when accessed.
+	/// Parsing a document therefore only needs a few allocations,
+	/// regardless of the number of values.
+	///
+	/// Values are accessed through Document::Value, a lightweight
+	/// handle providing accessors similar to those of Object, Array
+	/// and Query. Object and Array instances (or a Dynamic::Var
+	/// compatible with the result of Parser::parse()) are only created
+	/// on demand, for a value and its children, by calling
+	/// Value::toObject(), Value::toArray() or Value::toVar().
+	///
+	/// Example:
+	///
+	///    Document doc;
+	///    doc.parse(json);
+	///    Document::Value root = doc.root();
+	///    std::string_view name = root["name"].getStringView();
+	///    Int64 age = root["age"].getInt64();
+	///    for (auto it = root["children"].begin(); it != root["children"].end(); ++it)
+	///    {
+	///        std::string child = (*it).getString();
+	///    }
+	///    std::string city = root.findValue<std::string>("address.city", "");
+	///    Object::Ptr pAddress = root["address"].toObject();
+	/// ----
+	///
+	/// Members of an object are found with a linear search, and
+	/// elements of an array are located by skipping over preceding
+	/// elements (which is fast, as every node knows where its
+	/// subtree ends). To visit all members or elements, use
+	/// Value::begin() and Value::end().
+	///
+	/// Values and string views obtained from a Document are only
+	/// valid as long as the Document exists and has not been
+	/// parsed again or cleared.
+{
+public:
+	using Ptr = SharedPtr<Document>;
+
+	enum Type
+	{
+		TYPE_NONE,    /// no value, e.g. a member that does not exist
+		TYPE_NULL,    /// null
+		TYPE_BOOLEAN, /// true or false
+		TYPE_INTEGER, /// number without fraction or exponent
+		TYPE_FLOAT,   /// number with fraction or exponent
+		TYPE_STRING,  /// string
+		TYPE_ARRAY,   /// array
+		TYPE_OBJECT   /// object
+	};
+
+	class JSON_API Value;
+
+	class JSON_API Iterator
+		/// Iterates over the elements of an array, or the
+		/// members of an object.
+	{
+	public:
+		Iterator();
+			/// Creates an end Iterator.
+
+		Value operator * () const;
+			/// Returns the current element or member value.
+
+		std::string_view key() const;
+			/// Returns the key of the current object member.
+			/// Returns an empty string for array elements.
+
+		Iterator& operator ++ ();
+			/// Advances to the next element or member.
+
+		bool operator == (const Iterator& other) const;
+		bool operator != (const Iterator& other) const;
+
+	private:
+		Iterator(const Document* pDocument, Poco::UInt32 index, Poco::UInt32 end, bool object);
+
+		const Document* _pDocument;
+		Poco::UInt32 _index;
+		Poco::UInt32 _end;
+		bool _object;
+
+		friend class Value;
+	};
+
+	class JSON_API Value
+		/// A handle for a value in a Document.
+		///
+		/// Accessing a member or element that does not exist
+		/// results in an empty Value (TYPE_NONE), so that accessors
+		/// can be chained without checks.
+	{
+	public:
+		Value();
+			/// Creates an empty Value.
+
+		Type type() const;
+			/// Returns the type of the value.
+
+		bool isEmpty() const;
+			/// Returns true if the Value is empty (does not exist).
+
+		bool isNull() const;
+			/// Returns true if the value is null or empty.
+
+		bool isBoolean() const;
+			/// Returns true if the value is true or false.
+
+		bool isNumber() const;
+			/// Returns true if the value is an integer or floating-point number.
+
+		bool isInteger() const;
+			/// Returns true if the value is a number without fraction or exponent.
+
+		bool isString() const;
+			/// Returns true if the value is a string.
+
+		bool isArray() const;
+			/// Returns true if the value is an array.
+
+		bool isObject() const;
+			/// Returns true if the value is an object.
+
+		std::size_t size() const;
+			/// Returns the number of elements of an array, or the
+			/// number of members of an object. Returns 0 for other values.
+
+		bool getBool() const;
+			/// Returns the value of a boolean.
+			/// Throws a Poco::BadCastException if the value is not a boolean.
+
+		Poco::Int64 getInt64() const;
+			/// Returns the value of an integer.
+			/// Throws a Poco::BadCastException if the value is not an integer,
+			/// or a Poco::RangeException if it does not fit into an Int64.
+
+		Poco::UInt64 getUInt64() const;
+			/// Returns the value of a non-negative integer.
+			/// Throws a Poco::BadCastException if the value is not an integer,
+			/// or a Poco::RangeException if it does not fit into an UInt64.
+
+		double getDouble() const;
+			/// Returns the value of a number as double.
+			/// Throws a Poco::BadCastException if the value is not a number.
+
+		std::string_view getStringView() const;
+			/// Returns the value of a string, without copying it.
+			/// Throws a Poco::BadCastException if the value is not a string.
+
+		std::string getString() const;
+			/// Returns a copy of the value of a string.
+			/// Throws a Poco::BadCastException if the value is not a string.
+
+		template <typename T>
+		T convert() const
+			/// Converts the value to the given type, using the
+			/// conversion rules of Dynamic::Var.
+		{
+			return toVar().convert<T>();
+		}
+
+		Value get(std::string_view key) const;
+			/// Returns the member with the given key, or an empty Value
+			/// if the value is not an object or has no such member.
+			///
+			/// If the object has duplicate keys, the last member with
+			/// the key is returned, as with Object.
+
+		Value get(std::size_t index) const;
+			/// Returns the array element with the given index, or an empty
+			/// Value if the value is not an array or the index is out of range.
+
+		Value operator [] (std::string_view key) const;
+			/// Same as get(key).
+
+		Value operator [] (std::size_t index) const;
+			/// Same as get(index).
+
+		bool has(std::string_view key) const;
+			/// Returns true if the value is an object with the given member.
+
+		template <typename T>
+		T getValue(std::string_view key) const
+			/// Returns the member with the given key, converted
+			/// to the given type. See Object::getValue().
+		{
+			return get(key).convert<T>();
+		}
+
+		Value find(std::string_view path) const;
+			/// Returns the value at the given path, using the
+			/// same syntax as Query::find() (e.g. "address.lines[1]"),
+			/// or an empty Value if there is no such value.
+
+		template <typename T>
+		T findValue(std::string_view path, const T& def) const
+			/// Returns the value at the given path, converted to the
+			/// given type, or def if there is no such value, the value
+			/// is null, or it cannot be converted. See Query::findValue().
+		{
+			T result = def;
+			Value value = find(path);
+			if (!value.isNull())
+			{
+				try
+				{
+					result = value.convert<T>();
+				}
+				catch (...)
+				{
+				}
+			}
+			return result;
+		}
+
+		std::string findValue(std::string_view path, const char* def) const
+			/// Returns the value at the given path as string,
+			/// or def if there is no such value.
+		{
+			return findValue<std::string>(path, def);
+		}
+
+		Iterator begin() const;
+			/// Returns an Iterator to the first element or member.
+			/// For values that are neither arrays nor objects,
+			/// begin() == end().
+
+		Iterator end() const;
+			/// Returns the end Iterator.
+
+		Dynamic::Var toVar() const;
+			/// Converts the value, including all its children, into
+			/// a Dynamic::Var, as returned by Parser::parse() with
+			/// a ParseHandler.
+			///
+			/// Objects are converted to Object::Ptr, arrays to
+			/// Array::Ptr, integers to Int64 (or UInt64 if too large
+			/// for Int64), floating-point numbers to double and null
+			/// to an empty Var.
+
+		Object::Ptr toObject() const;
+			/// Converts an object and all its members into an Object.
+			/// Returns a null pointer if the value is not an object.
+
+		Array::Ptr toArray() const;
+			/// Converts an array and all its elements into an Array.
+			/// Returns a null pointer if the value is not an array.
+
+	private:
+		Value(const Document* pDocument, Poco::UInt32 index);
+
+		const Document* _pDocument;
+		Poco::UInt32 _index;
+
+		friend class Document;
+		friend class Iterator;
+	};
+
+	explicit Document(bool preserveObjectOrder = false);
+		/// Creates an empty Document.
+		///
+		/// If preserveObjectOrder is true, Object instances created
+		/// by Value::toObject() and Value::toVar() preserve the
+		/// order of members (see JSON_PRESERVE_KEY_ORDER).
+
+	~Document();
+		/// Destroys the Document.
+
+	void parse(const std::string& json);
+		/// Parses the given JSON text, which is copied
+		/// into the Document.
+		///
+		/// Throws a JSONException if the text is not valid JSON.
+
+	void parse(std::string&& json);
+		/// Parses the given JSON text, which is moved
+		/// into the Document.
+		///
+		/// Throws a JSONException if the text is not valid JSON.
+
+	void parse(std::istream& in);
+		/// Reads and parses JSON text from the given stream.
+		///
+		/// Throws a JSONException if the text is not valid JSON.
+
+	void clear();
+		/// Clears the Document.
+
+	Value root() const;
+		/// Returns the root value, or an empty Value
+		/// if nothing has been parsed.
+
+	Dynamic::Var toVar() const;
+		/// Converts the root value into a Dynamic::Var.
+		/// See Value::toVar().
+
+	void setDepth(std::size_t depth);
+		/// Sets the maximum nesting depth of arrays and objects.
+		///
+		/// Default maximum depth is 128, as with Parser.
+
+	std::size_t getDepth() const;
+		/// Returns the maximum nesting depth.
+
+	std::size_t nodeCount() const;
+		/// Returns the number of nodes on the tape, i.e., the total
+		/// number of values and object keys in the document.
+
+	static const std::size_t DEFAULT_DEPTH = 128;
+
+private:
+	struct Node
+		/// A node on the tape.
+		///
+		/// For strings and numbers, offset and length refer to the
+		/// text in the JSON source, or, if ESCAPED is set, to the
+		/// unescaped string. For arrays and objects, length is the
+		/// number of elements or members, and next is the index of the
+		/// node following the last child. Object members are stored
+		/// as a key node (a string) followed by the value.
+	{
+		Poco::UInt8  type;
+		Poco::UInt8  flags;
+		Poco::UInt32 offset;
+		Poco::UInt32 length;
+		Poco::UInt32 next;
+	};
+
+	enum NodeFlags
+	{
+		FLAG_TRUE     = 0x01,
+		FLAG_ESCAPED  = 0x02,
+		FLAG_NEGATIVE = 0x04
+	};
+
+	class TapeParser;
+
+	void parseTape();
+	const Node& node(Poco::UInt32 index) const;
+	std::string_view nodeText(const Node& n) const;
+	Dynamic::Var toVar(Poco::UInt32 index) const;
+	Object::Ptr toObject(Poco::UInt32 index) const;
+	Array::Ptr toArray(Poco::UInt32 index) const;
+
+	Document(const Document&);
+	Document& operator = (const Document&);
+
+	std::string _json;
+	std::string _strings;
+	std::vector<Node> _tape;
+	std::size_t _depth;
+	bool _preserveObjectOrder;
+
+	friend class Value;
+	friend class Iterator;
+	friend class TapeParser;
+};
+
+
+//
+// inlines
+//
+
+
+inline const Document::Node& Document::node(Poco::UInt32 index) const
+{
+	return _tape[index];
+}
+
+
+inline std::string_view Document::nodeText(const Node& n) const
+{
+	const std::string& buffer = (n.flags & FLAG_ESCAPED) ? _strings : _json;
+	return std::string_view(buffer.data() + n.offset, n.length);
+}
+
+
+inline Document::Value Document::root() const
+{
+	return _tape.empty() ? Value() : Value(this, 0);
+}
+
+
+inline Dynamic::Var Document::toVar() const
+{
+	return root().toVar();
+}
+
+
+inline void Document::setDepth(std::size_t depth)
+{
+	_depth = depth;
+}
+
+
+inline std::size_t Document::getDepth() const
+{
+	return _depth;
+}
+
+
+inline std::size_t Document::nodeCount() const
+{
+	return _tape.size();
+}
+
+
+inline Document::Type Document::Value::type() const
+{
+	return _pDocument ? static_cast<Type>(_pDocument->node(_index).type) : TYPE_NONE;
+}
+
+
+inline bool Document::Value::isEmpty() const
+{
+	return _pDocument == nullptr;
+}
+
+
+inline bool Document::Value::isNull() const
+{
+	return type() <= TYPE_NULL;
+}
+
+
+inline bool Document::Value::isBoolean() const
+{
+	return type() == TYPE_BOOLEAN;
+}
+
+
+inline bool Document::Value::isNumber() const
+{
+	Type t = type();
+	return t == TYPE_INTEGER || t == TYPE_FLOAT;
+}
+
+
+inline bool Document::Value::isInteger() const
+{
+	return type() == TYPE_INTEGER;
+}
+
+
+inline bool Document::Value::isString() const
+{
+	return type() == TYPE_STRING;
+}
+
+
+inline bool Document::Value::isArray() const
+{
+	return type() == TYPE_ARRAY;
+}
+
+
+inline bool Document::Value::isObject() const
+{
+	return type() == TYPE_OBJECT;
+}
+
+
+inline Document::Value Document::Value::operator [] (std::string_view key) const
+{
+	return get(key);
+}
+
+
+inline Document::Value Document::Value::operator [] (std::size_t index) const
+{
+	return get(index);
+}
+
+
+inline bool Document::Value::has(std::string_view key) const
+{
+	return !get(key).isEmpty();
+}
+
+
+inline Document::Iterator Document::Value::end() const
+{
+	return Iterator();
+}
+
+
+inline bool Document::Iterator::operator == (const Iterator& other) const
+{
+	return _pDocument == other._pDocument && _index == other._index;
+}
+
+
+inline bool Document::Iterator::operator != (const Iterator& other) const
+{
+	return !(*this == other);
+}
+
+
+} } // namespace Poco::JSON
+
+
+#endif // JSON_JSONDocument_INCLUDED
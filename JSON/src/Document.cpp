@@ -0,0 +1,755 @@
+//
+// Document.cpp
+//
+// Library: JSON
+// Package: JSON
+// Module:  Document
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/JSON/Document.h"
+#include "Poco/JSON/JSONException.h"
+#include "Poco/JSONString.h"
+#include "Poco/NumericString.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/UTF8Encoding.h"
+#include "Poco/NumberFormatter.h"
+#include <limits>
+
+
+namespace Poco {
+namespace JSON {
+
+
+//
+// Document::TapeParser
+//
+
+
+class Document::TapeParser
+	/// A validating recursive descent parser that
+	/// appends the nodes of a document to the tape.
+{
+public:
+	TapeParser(Document& doc):
+		_doc(doc),
+		_begin(doc._json.data()),
+		_pos(_begin),
+		_end(_begin + doc._json.size())
+	{
+	}
+
+	void parse()
+	{
+		if (_doc._json.size() >= std::numeric_limits<Poco::UInt32>::max())
+			throw JSONException("JSON document too large");
+
+		// Most documents have roughly one value per 8 characters.
+		_doc._tape.reserve(_doc._json.size()/8 + 1);
+
+		skipWhitespace();
+		if (_pos == _end) error("Empty JSON document");
+		parseValue(0);
+		skipWhitespace();
+		if (_pos != _end) error("Excess characters found after JSON end");
+	}
+
+private:
+	void parseValue(std::size_t depth)
+	{
+		switch (*_pos)
+		{
+		case '{':
+			parseObject(depth + 1);
+			break;
+		case '[':
+			parseArray(depth + 1);
+			break;
+		case '"':
+			parseString();
+			break;
+		case 't':
+			parseLiteral("true", 4, TYPE_BOOLEAN, FLAG_TRUE);
+			break;
+		case 'f':
+			parseLiteral("false", 5, TYPE_BOOLEAN, 0);
+			break;
+		case 'n':
+			parseLiteral("null", 4, TYPE_NULL, 0);
+			break;
+		default:
+			if (*_pos == '-' || (*_pos >= '0' && *_pos <= '9'))
+				parseNumber();
+			else
+				error("Unexpected character");
+		}
+	}
+
+	void parseObject(std::size_t depth)
+	{
+		if (depth > _doc._depth) error("Maximum depth exceeded");
+
+		const Poco::UInt32 index = addNode(TYPE_OBJECT, 0, 0, 0);
+		Poco::UInt32 count = 0;
+		++_pos;
+		skipWhitespace();
+		if (_pos < _end && *_pos == '}')
+		{
+			++_pos;
+		}
+		else
+		{
+			while (true)
+			{
+				if (_pos == _end || *_pos != '"') error("Expected object key");
+				parseString();
+				skipWhitespace();
+				if (_pos == _end || *_pos != ':') error("Expected ':'");
+				++_pos;
+				skipWhitespace();
+				if (_pos == _end) error("Unexpected end of JSON document");
+				parseValue(depth);
+				++count;
+				skipWhitespace();
+				if (_pos == _end) error("JSON object end not found");
+				if (*_pos == ',')
+				{
+					++_pos;
+					skipWhitespace();
+				}
+				else if (*_pos == '}')
+				{
+					++_pos;
+					break;
+				}
+				else error("Expected ',' or '}'");
+			}
+		}
+		Node& n = _doc._tape[index];
+		n.length = count;
+		n.next = static_cast<Poco::UInt32>(_doc._tape.size());
+	}
+
+	void parseArray(std::size_t depth)
+	{
+		if (depth > _doc._depth) error("Maximum depth exceeded");
+
+		const Poco::UInt32 index = addNode(TYPE_ARRAY, 0, 0, 0);
+		Poco::UInt32 count = 0;
+		++_pos;
+		skipWhitespace();
+		if (_pos < _end && *_pos == ']')
+		{
+			++_pos;
+		}
+		else
+		{
+			while (true)
+			{
+				if (_pos == _end) error("Unexpected end of JSON document");
+				parseValue(depth);
+				++count;
+				skipWhitespace();
+				if (_pos == _end) error("JSON array end not found");
+				if (*_pos == ',')
+				{
+					++_pos;
+					skipWhitespace();
+				}
+				else if (*_pos == ']')
+				{
+					++_pos;
+					break;
+				}
+				else error("Expected ',' or ']'");
+			}
+		}
+		Node& n = _doc._tape[index];
+		n.length = count;
+		n.next = static_cast<Poco::UInt32>(_doc._tape.size());
+	}
+
+	void parseString()
+	{
+		const char* start = ++_pos;
+		while (_pos < _end)
+		{
+			const unsigned char c = static_cast<unsigned char>(*_pos);
+			if (c == '"')
+			{
+				addNode(TYPE_STRING, 0, offset(start), static_cast<Poco::UInt32>(_pos - start));
+				++_pos;
+				return;
+			}
+			else if (c == '\\')
+			{
+				parseEscapedString(start);
+				return;
+			}
+			else if (c < 0x20)
+			{
+				error("Control character in string");
+			}
+			++_pos;
+		}
+		error("Unterminated string");
+	}
+
+	void parseEscapedString(const char* start)
+		/// Continues parsing a string at the first escape sequence,
+		/// and appends the unescaped string to the strings buffer.
+	{
+		std::string& strings = _doc._strings;
+		const std::size_t unescapedOffset = strings.size();
+		strings.append(start, _pos - start);
+		while (_pos < _end)
+		{
+			const unsigned char c = static_cast<unsigned char>(*_pos);
+			if (c == '"')
+			{
+				if (strings.size() >= std::numeric_limits<Poco::UInt32>::max())
+					throw JSONException("JSON document too large");
+				addNode(TYPE_STRING, FLAG_ESCAPED, static_cast<Poco::UInt32>(unescapedOffset), static_cast<Poco::UInt32>(strings.size() - unescapedOffset));
+				++_pos;
+				return;
+			}
+			else if (c == '\\')
+			{
+				if (++_pos == _end) break;
+				switch (*_pos++)
+				{
+				case '"':  strings += '"'; break;
+				case '\\': strings += '\\'; break;
+				case '/':  strings += '/'; break;
+				case 'b':  strings += '\b'; break;
+				case 'f':  strings += '\f'; break;
+				case 'n':  strings += '\n'; break;
+				case 'r':  strings += '\r'; break;
+				case 't':  strings += '\t'; break;
+				case 'u':  appendUnicodeEscape(strings); break;
+				default:
+					--_pos;
+					error("Invalid escape sequence");
+				}
+			}
+			else if (c < 0x20)
+			{
+				error("Control character in string");
+			}
+			else
+			{
+				const char* run = _pos++;
+				while (_pos < _end && *_pos != '"' && *_pos != '\\' && static_cast<unsigned char>(*_pos) >= 0x20) ++_pos;
+				strings.append(run, _pos - run);
+			}
+		}
+		error("Unterminated string");
+	}
+
+	void appendUnicodeEscape(std::string& strings)
+	{
+		int ch = parseHex4();
+		if (ch >= 0xD800 && ch <= 0xDBFF)
+		{
+			if (_end - _pos < 6 || _pos[0] != '\\' || _pos[1] != 'u') error("Missing low surrogate");
+			_pos += 2;
+			const int low = parseHex4();
+			if (low < 0xDC00 || low > 0xDFFF) error("Invalid low surrogate");
+			ch = 0x10000 + ((ch - 0xD800) << 10) + (low - 0xDC00);
+		}
+		else if (ch >= 0xDC00 && ch <= 0xDFFF)
+		{
+			error("Unexpected low surrogate");
+		}
+		unsigned char buffer[4];
+		const int n = _utf8.convert(ch, buffer, sizeof(buffer));
+		strings.append(reinterpret_cast<const char*>(buffer), n);
+	}
+
+	int parseHex4()
+	{
+		if (_end - _pos < 4) error("Invalid unicode escape sequence");
+		int value = 0;
+		for (int i = 0; i < 4; i++)
+		{
+			const char c = *_pos++;
+			value <<= 4;
+			if (c >= '0' && c <= '9') value += c - '0';
+			else if (c >= 'a' && c <= 'f') value += c - 'a' + 10;
+			else if (c >= 'A' && c <= 'F') value += c - 'A' + 10;
+			else error("Invalid unicode escape sequence");
+		}
+		return value;
+	}
+
+	void parseNumber()
+	{
+		const char* start = _pos;
+		Poco::UInt8 flags = 0;
+		Type type = TYPE_INTEGER;
+		if (*_pos == '-')
+		{
+			flags |= FLAG_NEGATIVE;
+			++_pos;
+		}
+		if (_pos == _end || !isDigit(*_pos)) error("Invalid number");
+		if (*_pos == '0')
+		{
+			++_pos;
+		}
+		else
+		{
+			while (_pos < _end && isDigit(*_pos)) ++_pos;
+		}
+		if (_pos < _end && *_pos == '.')
+		{
+			type = TYPE_FLOAT;
+			++_pos;
+			if (_pos == _end || !isDigit(*_pos)) error("Invalid number");
+			while (_pos < _end && isDigit(*_pos)) ++_pos;
+		}
+		if (_pos < _end && (*_pos == 'e' || *_pos == 'E'))
+		{
+			type = TYPE_FLOAT;
+			++_pos;
+			if (_pos < _end && (*_pos == '+' || *_pos == '-')) ++_pos;
+			if (_pos == _end || !isDigit(*_pos)) error("Invalid number");
+			while (_pos < _end && isDigit(*_pos)) ++_pos;
+		}
+		addNode(type, flags, offset(start), static_cast<Poco::UInt32>(_pos - start));
+	}
+
+	void parseLiteral(const char* literal, std::size_t length, Type type, Poco::UInt8 flags)
+	{
+		if (static_cast<std::size_t>(_end - _pos) < length || std::char_traits<char>::compare(_pos, literal, length) != 0)
+			error("Invalid literal");
+		addNode(type, flags, offset(_pos), static_cast<Poco::UInt32>(length));
+		_pos += length;
+	}
+
+	Poco::UInt32 addNode(Type type, Poco::UInt8 flags, Poco::UInt32 offset, Poco::UInt32 length)
+	{
+		const Poco::UInt32 index = static_cast<Poco::UInt32>(_doc._tape.size());
+		Node n;
+		n.type = static_cast<Poco::UInt8>(type);
+		n.flags = flags;
+		n.offset = offset;
+		n.length = length;
+		n.next = index + 1;
+		_doc._tape.push_back(n);
+		return index;
+	}
+
+	void skipWhitespace()
+	{
+		while (_pos < _end && (*_pos == ' ' || *_pos == '\n' || *_pos == '\r' || *_pos == '\t')) ++_pos;
+	}
+
+	Poco::UInt32 offset(const char* p) const
+	{
+		return static_cast<Poco::UInt32>(p - _begin);
+	}
+
+	static bool isDigit(char c)
+	{
+		return c >= '0' && c <= '9';
+	}
+
+	[[noreturn]] void error(const char* msg) const
+	{
+		std::string text(msg);
+		text += " at offset ";
+		Poco::NumberFormatter::append(text, static_cast<Poco::UInt64>(_pos - _begin));
+		throw JSONException(text);
+	}
+
+	Document& _doc;
+	const char* _begin;
+	const char* _pos;
+	const char* _end;
+	Poco::UTF8Encoding _utf8;
+};
+
+
+//
+// Document
+//
+
+
+Document::Document(bool preserveObjectOrder):
+	_depth(DEFAULT_DEPTH),
+	_preserveObjectOrder(preserveObjectOrder)
+{
+}
+
+
+Document::~Document() = default;
+
+
+void Document::parse(const std::string& json)
+{
+	_json = json;
+	parseTape();
+}
+
+
+void Document::parse(std::string&& json)
+{
+	_json = std::move(json);
+	parseTape();
+}
+
+
+void Document::parse(std::istream& in)
+{
+	_json.clear();
+	Poco::StreamCopier::copyToString(in, _json);
+	parseTape();
+}
+
+
+void Document::clear()
+{
+	_json.clear();
+	_strings.clear();
+	_tape.clear();
+}
+
+
+void Document::parseTape()
+{
+	_strings.clear();
+	_tape.clear();
+	try
+	{
+		TapeParser parser(*this);
+		parser.parse();
+	}
+	catch (...)
+	{
+		clear();
+		throw;
+	}
+}
+
+
+Dynamic::Var Document::toVar(Poco::UInt32 index) const
+{
+	const Node& n = _tape[index];
+	switch (n.type)
+	{
+	case TYPE_BOOLEAN:
+		return (n.flags & FLAG_TRUE) != 0;
+	case TYPE_INTEGER:
+		{
+			Value value(this, index);
+			if (n.flags & FLAG_NEGATIVE)
+				return value.getInt64();
+			const Poco::UInt64 u = value.getUInt64();
+			if (u <= static_cast<Poco::UInt64>(std::numeric_limits<Poco::Int64>::max()))
+				return static_cast<Poco::Int64>(u);
+			else
+				return u;
+		}
+	case TYPE_FLOAT:
+		return Value(this, index).getDouble();
+	case TYPE_STRING:
+		return std::string(nodeText(n));
+	case TYPE_ARRAY:
+		return toArray(index);
+	case TYPE_OBJECT:
+		return toObject(index);
+	default:
+		return Dynamic::Var();
+	}
+}
+
+
+Object::Ptr Document::toObject(Poco::UInt32 index) const
+{
+	Object::Ptr pObject = new Object(_preserveObjectOrder ? Poco::JSON_PRESERVE_KEY_ORDER : 0);
+	const Poco::UInt32 end = _tape[index].next;
+	Poco::UInt32 i = index + 1;
+	while (i < end)
+	{
+		const std::string key(nodeText(_tape[i]));
+		pObject->set(key, toVar(i + 1));
+		i = _tape[i + 1].next;
+	}
+	return pObject;
+}
+
+
+Array::Ptr Document::toArray(Poco::UInt32 index) const
+{
+	Array::Ptr pArray = new Array;
+	const Poco::UInt32 end = _tape[index].next;
+	Poco::UInt32 i = index + 1;
+	while (i < end)
+	{
+		pArray->add(toVar(i));
+		i = _tape[i].next;
+	}
+	return pArray;
+}
+
+
+//
+// Document::Value
+//
+
+
+Document::Value::Value():
+	_pDocument(nullptr),
+	_index(0)
+{
+}
+
+
+Document::Value::Value(const Document* pDocument, Poco::UInt32 index):
+	_pDocument(pDocument),
+	_index(index)
+{
+}
+
+
+std::size_t Document::Value::size() const
+{
+	Type t = type();
+	if (t == TYPE_ARRAY || t == TYPE_OBJECT)
+		return _pDocument->node(_index).length;
+	else
+		return 0;
+}
+
+
+bool Document::Value::getBool() const
+{
+	if (type() != TYPE_BOOLEAN) throw Poco::BadCastException("JSON value is not a boolean");
+	return (_pDocument->node(_index).flags & FLAG_TRUE) != 0;
+}
+
+
+Poco::Int64 Document::Value::getInt64() const
+{
+	if (type() != TYPE_INTEGER) throw Poco::BadCastException("JSON value is not an integer");
+
+	const Node& n = _pDocument->node(_index);
+	std::string_view text = _pDocument->nodeText(n);
+	const bool negative = (n.flags & FLAG_NEGATIVE) != 0;
+	if (negative) text.remove_prefix(1);
+
+	// Accumulate as a negative number, so that the
+	// minimum value can be represented.
+	const Poco::Int64 limit = negative ? std::numeric_limits<Poco::Int64>::min() : -std::numeric_limits<Poco::Int64>::max();
+	Poco::Int64 value = 0;
+	for (char c: text)
+	{
+		const int digit = c - '0';
+		if (value < (limit + digit)/10) throw Poco::RangeException("JSON integer out of range for Int64", std::string(_pDocument->nodeText(n)));
+		value = value*10 - digit;
+	}
+	return negative ? value : -value;
+}
+
+
+Poco::UInt64 Document::Value::getUInt64() const
+{
+	if (type() != TYPE_INTEGER) throw Poco::BadCastException("JSON value is not an integer");
+
+	const Node& n = _pDocument->node(_index);
+	std::string_view text = _pDocument->nodeText(n);
+	if (n.flags & FLAG_NEGATIVE)
+	{
+		if (text != "-0") throw Poco::RangeException("JSON integer out of range for UInt64", std::string(text));
+		return 0;
+	}
+
+	Poco::UInt64 value = 0;
+	for (char c: text)
+	{
+		const unsigned digit = static_cast<unsigned>(c - '0');
+		if (value > (std::numeric_limits<Poco::UInt64>::max() - digit)/10) throw Poco::RangeException("JSON integer out of range for UInt64", std::string(text));
+		value = value*10 + digit;
+	}
+	return value;
+}
+
+
+double Document::Value::getDouble() const
+{
+	const Type t = type();
+	if (t != TYPE_FLOAT && t != TYPE_INTEGER) throw Poco::BadCastException("JSON value is not a number");
+
+	std::string_view text = _pDocument->nodeText(_pDocument->node(_index));
+	char buffer[64];
+	if (text.size() < sizeof(buffer))
+	{
+		text.copy(buffer, text.size());
+		buffer[text.size()] = 0;
+		return Poco::strToDouble(buffer);
+	}
+	else
+	{
+		return Poco::strToDouble(std::string(text).c_str());
+	}
+}
+
+
+std::string_view Document::Value::getStringView() const
+{
+	if (type() != TYPE_STRING) throw Poco::BadCastException("JSON value is not a string");
+	return _pDocument->nodeText(_pDocument->node(_index));
+}
+
+
+std::string Document::Value::getString() const
+{
+	return std::string(getStringView());
+}
+
+
+Document::Value Document::Value::get(std::string_view key) const
+{
+	Value result;
+	if (type() == TYPE_OBJECT)
+	{
+		const Poco::UInt32 end = _pDocument->node(_index).next;
+		Poco::UInt32 i = _index + 1;
+		while (i < end)
+		{
+			if (_pDocument->nodeText(_pDocument->node(i)) == key)
+				result = Value(_pDocument, i + 1);
+			i = _pDocument->node(i + 1).next;
+		}
+	}
+	return result;
+}
+
+
+Document::Value Document::Value::get(std::size_t index) const
+{
+	if (type() == TYPE_ARRAY)
+	{
+		const Node& n = _pDocument->node(_index);
+		if (index < n.length)
+		{
+			Poco::UInt32 i = _index + 1;
+			while (index-- > 0) i = _pDocument->node(i).next;
+			return Value(_pDocument, i);
+		}
+	}
+	return Value();
+}
+
+
+Document::Value Document::Value::find(std::string_view path) const
+{
+	Value result = *this;
+	std::size_t pos = 0;
+	while (pos < path.size() && !result.isEmpty())
+	{
+		std::size_t dot = path.find('.', pos);
+		if (dot == std::string_view::npos) dot = path.size();
+		std::string_view token = path.substr(pos, dot - pos);
+		pos = dot + 1;
+
+		std::size_t bracket = token.find('[');
+		std::string_view name = token.substr(0, bracket);
+		if (!name.empty()) result = result.get(name);
+		while (bracket != std::string_view::npos && !result.isEmpty())
+		{
+			const std::size_t close = token.find(']', bracket);
+			if (close == std::string_view::npos || close == bracket + 1) return Value();
+			std::size_t index = 0;
+			for (std::size_t i = bracket + 1; i < close; i++)
+			{
+				if (token[i] < '0' || token[i] > '9') return Value();
+				index = index*10 + (token[i] - '0');
+			}
+			result = result.get(index);
+			bracket = token.find('[', close);
+		}
+	}
+	return result;
+}
+
+
+Document::Iterator Document::Value::begin() const
+{
+	const Type t = type();
+	if ((t == TYPE_ARRAY || t == TYPE_OBJECT) && _pDocument->node(_index).length > 0)
+		return Iterator(_pDocument, _index + 1, _pDocument->node(_index).next, t == TYPE_OBJECT);
+	else
+		return Iterator();
+}
+
+
+Dynamic::Var Document::Value::toVar() const
+{
+	return _pDocument ? _pDocument->toVar(_index) : Dynamic::Var();
+}
+
+
+Object::Ptr Document::Value::toObject() const
+{
+	return type() == TYPE_OBJECT ? _pDocument->toObject(_index) : Object::Ptr();
+}
+
+
+Array::Ptr Document::Value::toArray() const
+{
+	return type() == TYPE_ARRAY ? _pDocument->toArray(_index) : Array::Ptr();
+}
+
+
+//
+// Document::Iterator
+//
+
+
+Document::Iterator::Iterator():
+	_pDocument(nullptr),
+	_index(0),
+	_end(0),
+	_object(false)
+{
+}
+
+
+Document::Iterator::Iterator(const Document* pDocument, Poco::UInt32 index, Poco::UInt32 end, bool object):
+	_pDocument(pDocument),
+	_index(index),
+	_end(end),
+	_object(object)
+{
+}
+
+
+Document::Value Document::Iterator::operator * () const
+{
+	return Value(_pDocument, _object ? _index + 1 : _index);
+}
+
+
+std::string_view Document::Iterator::key() const
+{
+	return _object ? _pDocument->nodeText(_pDocument->node(_index)) : std::string_view();
+}
+
+
+Document::Iterator& Document::Iterator::operator ++ ()
+{
+	const Poco::UInt32 value = _object ? _index + 1 : _index;
+	_index = _pDocument->node(value).next;
+	if (_index >= _end) *this = Iterator();
+	return *this;
+}
+
+
+} } // namespace Poco::JSON
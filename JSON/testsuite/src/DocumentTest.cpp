@@ -0,0 +1,391 @@
+//
+// DocumentTest.cpp
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "DocumentTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/JSON/Document.h"
+#include "Poco/JSON/Parser.h"
+#include "Poco/JSON/Stringifier.h"
+#include "Poco/JSON/JSONException.h"
+#include "Poco/Exception.h"
+#include <sstream>
+#include <string>
+
+
+using Poco::JSON::Document;
+using Poco::JSON::Object;
+using Poco::JSON::Array;
+using Poco::JSON::JSONException;
+using Poco::Dynamic::Var;
+
+
+DocumentTest::DocumentTest(const std::string& name):
+	CppUnit::TestCase(name)
+{
+}
+
+
+DocumentTest::~DocumentTest()
+{
+}
+
+
+void DocumentTest::testScalars()
+{
+	Document doc;
+	assertTrue (doc.root().isEmpty());
+
+	doc.parse(std::string(" true "));
+	assertTrue (doc.root().isBoolean());
+	assertTrue (doc.root().getBool());
+
+	doc.parse(std::string("false"));
+	assertTrue (!doc.root().getBool());
+
+	doc.parse(std::string("null"));
+	assertTrue (doc.root().type() == Document::TYPE_NULL);
+	assertTrue (doc.root().isNull());
+	assertTrue (!doc.root().isEmpty());
+
+	doc.parse(std::string("\"text\""));
+	assertTrue (doc.root().getStringView() == "text");
+
+	doc.parse(std::string("42"));
+	assertTrue (doc.root().getInt64() == 42);
+
+	try
+	{
+		doc.root().getStringView();
+		fail ("not a string - must throw");
+	}
+	catch (Poco::BadCastException&)
+	{
+	}
+}
+
+
+void DocumentTest::testObject()
+{
+	Document doc;
+	doc.parse(std::string("{ \"name\" : \"Franky\", \"age\": 33, \"children\" : [ \"Jonas\", \"Ellen\" ], \"address\": { \"city\": \"Graz\" }, \"none\": null }"));
+
+	Document::Value root = doc.root();
+	assertTrue (root.isObject());
+	assertEqual (5, root.size());
+	assertTrue (root["name"].getStringView() == "Franky");
+	assertTrue (root["age"].getInt64() == 33);
+	assertTrue (root["children"].isArray());
+	assertEqual (2, root["children"].size());
+	assertTrue (root["address"]["city"].getString() == "Graz");
+	assertTrue (root.has("none"));
+	assertTrue (root["none"].isNull());
+	assertTrue (!root.has("missing"));
+	assertTrue (root["missing"].isEmpty());
+	assertTrue (root["missing"]["deeper"][3].isEmpty());
+	assertTrue (root.getValue<int>("age") == 33);
+	assertTrue (root.getValue<std::string>("age") == "33");
+
+	doc.parse(std::string("{\"a\":1,\"a\":2}"));
+	assertTrue (doc.root()["a"].getInt64() == 2);
+
+	doc.parse(std::string("{}"));
+	assertTrue (doc.root().isObject());
+	assertEqual (0, doc.root().size());
+}
+
+
+void DocumentTest::testArray()
+{
+	Document doc;
+	doc.parse(std::string("[1, [2, 3], {\"x\": [4]}, \"five\", 6.5, []]"));
+
+	Document::Value root = doc.root();
+	assertTrue (root.isArray());
+	assertEqual (6, root.size());
+	assertTrue (root[0].getInt64() == 1);
+	assertTrue (root[1][1].getInt64() == 3);
+	assertTrue (root[2]["x"][0].getInt64() == 4);
+	assertTrue (root[3].getStringView() == "five");
+	assertEqualDelta (6.5, root[4].getDouble(), 0.0);
+	assertTrue (root[5].isArray());
+	assertEqual (0, root[5].size());
+	assertTrue (root[6].isEmpty());
+	assertTrue (root["x"].isEmpty());
+}
+
+
+void DocumentTest::testStrings()
+{
+	Document doc;
+	const std::string json("[\"plain\", \"tab\\there\", \"quote\\\"s\", \"\\u00e4\\u20AC\", \"\\ud83d\\ude00\", \"\\/\\\\\", \"\"]");
+	doc.parse(json);
+
+	Document::Value root = doc.root();
+	assertTrue (root[0].getStringView() == "plain");
+	assertTrue (root[1].getStringView() == "tab\there");
+	assertTrue (root[2].getStringView() == "quote\"s");
+	assertTrue (root[3].getStringView() == "\xC3\xA4\xE2\x82\xAC");
+	assertTrue (root[4].getStringView() == "\xF0\x9F\x98\x80");
+	assertTrue (root[5].getStringView() == "/\\");
+	assertTrue (root[6].getStringView().empty());
+
+	// keys with escape sequences
+	doc.parse(std::string("{\"a\\u0062c\": 1}"));
+	assertTrue (doc.root()["abc"].getInt64() == 1);
+}
+
+
+void DocumentTest::testNumbers()
+{
+	Document doc;
+	doc.parse(std::string("[0, -0, -12, 9223372036854775807, -9223372036854775808, 18446744073709551615, 18446744073709551616, 1.5, -2e3, 1E-2]"));
+
+	Document::Value root = doc.root();
+	assertTrue (root[0].isInteger());
+	assertTrue (root[0].getInt64() == 0);
+	assertTrue (root[1].getUInt64() == 0);
+	assertTrue (root[2].getInt64() == -12);
+	assertTrue (root[3].getInt64() == 9223372036854775807LL);
+	assertTrue (root[4].getInt64() == -9223372036854775807LL - 1);
+	assertTrue (root[5].getUInt64() == 18446744073709551615ULL);
+
+	try
+	{
+		root[5].getInt64();
+		fail ("out of range - must throw");
+	}
+	catch (Poco::RangeException&)
+	{
+	}
+
+	try
+	{
+		root[6].getUInt64();
+		fail ("out of range - must throw");
+	}
+	catch (Poco::RangeException&)
+	{
+	}
+
+	try
+	{
+		root[2].getUInt64();
+		fail ("negative - must throw");
+	}
+	catch (Poco::RangeException&)
+	{
+	}
+
+	assertTrue (root[7].type() == Document::TYPE_FLOAT);
+	assertEqualDelta (1.5, root[7].getDouble(), 0.0);
+	assertEqualDelta (-2000.0, root[8].getDouble(), 0.0);
+	assertEqualDelta (0.01, root[9].getDouble(), 1e-15);
+	assertEqualDelta (-12.0, root[2].getDouble(), 0.0);
+}
+
+
+void DocumentTest::testFind()
+{
+	Document doc;
+	doc.parse(std::string("{ \"name\" : \"Franky\", \"children\" : [ \"Jonas\", \"Ellen\" ], \"address\": { \"lines\": [\"Main St 1\", \"Apt 2\"], \"zip\": 8010 }, \"matrix\": [[1, 2], [3, 4]] }"));
+
+	Document::Value root = doc.root();
+	assertTrue (root.find("name").getStringView() == "Franky");
+	assertTrue (root.find("children[1]").getStringView() == "Ellen");
+	assertTrue (root.find("address.lines[0]").getStringView() == "Main St 1");
+	assertTrue (root.find("matrix[1][0]").getInt64() == 3);
+	assertTrue (root.find("address.missing").isEmpty());
+	assertTrue (root.find("children[2]").isEmpty());
+	assertTrue (root.find("children[x]").isEmpty());
+	assertTrue (root.findValue<int>("address.zip", 0) == 8010);
+	assertTrue (root.findValue<int>("address.city", 42) == 42);
+	assertTrue (root.findValue("address.lines[1]", "") == "Apt 2");
+	assertTrue (root.findValue("address.city", "Graz") == "Graz");
+}
+
+
+void DocumentTest::testIterator()
+{
+	Document doc;
+	doc.parse(std::string("{\"a\": 1, \"b\": [1, 2, 3], \"c\": {\"d\": null}}"));
+
+	Document::Value root = doc.root();
+	std::string keys;
+	int n = 0;
+	for (Document::Iterator it = root.begin(); it != root.end(); ++it)
+	{
+		keys += it.key();
+		++n;
+	}
+	assertTrue (keys == "abc");
+	assertEqual (3, n);
+
+	Poco::Int64 sum = 0;
+	for (Document::Value v: root["b"])
+	{
+		sum += v.getInt64();
+	}
+	assertTrue (sum == 6);
+
+	assertTrue (root["a"].begin() == root["a"].end());
+	assertTrue (root["missing"].begin() == root["missing"].end());
+}
+
+
+void DocumentTest::testToVar()
+{
+	const std::string json("{ \"name\" : \"Franky\", \"children\" : [ \"Jonas\", \"Ellen\" ], \"age\": 33, \"big\": 18446744073709551615, \"pi\": 3.14, \"ok\": true, \"none\": null, \"nested\": {\"x\": [1, {\"y\": \"z\"}]} }");
+
+	Document doc;
+	doc.parse(json);
+	Var docVar = doc.toVar();
+
+	Poco::JSON::Parser parser;
+	Var parserVar = parser.parse(json);
+
+	std::ostringstream docStr;
+	Poco::JSON::Stringifier::stringify(docVar, docStr);
+	std::ostringstream parserStr;
+	Poco::JSON::Stringifier::stringify(parserVar, parserStr);
+	assertEqual (parserStr.str(), docStr.str());
+
+	Object::Ptr pObject = doc.root().toObject();
+	assertTrue (!pObject.isNull());
+	assertTrue (pObject->getValue<std::string>("name") == "Franky");
+	assertTrue (pObject->get("age").type() == typeid(Poco::Int64));
+	assertTrue (pObject->get("big").type() == typeid(Poco::UInt64));
+	assertTrue (pObject->isNull("none"));
+	assertTrue (pObject->getArray("children")->size() == 2);
+
+	Array::Ptr pArray = doc.root()["children"].toArray();
+	assertTrue (!pArray.isNull());
+	assertTrue (pArray->getElement<std::string>(1) == "Ellen");
+
+	assertTrue (doc.root()["name"].toObject().isNull());
+	assertTrue (doc.root()["name"].toArray().isNull());
+
+	Document ordered(true);
+	ordered.parse(std::string("{\"b\": 1, \"a\": 2}"));
+	std::ostringstream orderedStr;
+	ordered.root().toObject()->stringify(orderedStr);
+	assertEqual (std::string("{\"b\":1,\"a\":2}"), orderedStr.str());
+}
+
+
+void DocumentTest::testInvalid()
+{
+	const char* invalid[] =
+	{
+		"",
+		"   ",
+		"{",
+		"[1, 2",
+		"[1, 2,]",
+		"{\"a\" 1}",
+		"{\"a\": 1,}",
+		"{a: 1}",
+		"tru",
+		"nul",
+		"01",
+		"1.",
+		"-",
+		"1e",
+		".5",
+		"\"unterminated",
+		"\"bad \\x escape\"",
+		"\"bad \\u12G4\"",
+		"\"\\ud83d\"",
+		"\"control \x01 char\"",
+		"[1] 2",
+		"{\"a\": 1} x"
+	};
+
+	Document doc;
+	for (const char* json: invalid)
+	{
+		try
+		{
+			doc.parse(std::string(json));
+			failmsg (std::string("invalid JSON must throw: ") + json);
+		}
+		catch (JSONException&)
+		{
+		}
+		assertTrue (doc.root().isEmpty());
+	}
+}
+
+
+void DocumentTest::testDepth()
+{
+	std::string json;
+	for (int i = 0; i < 10; i++) json += '[';
+	for (int i = 0; i < 10; i++) json += ']';
+
+	Document doc;
+	doc.setDepth(10);
+	doc.parse(json);
+	assertTrue (doc.root()[0][0][0][0][0][0][0][0][0].isArray());
+
+	doc.setDepth(9);
+	try
+	{
+		doc.parse(json);
+		fail ("maximum depth exceeded - must throw");
+	}
+	catch (JSONException&)
+	{
+	}
+}
+
+
+void DocumentTest::testStream()
+{
+	std::istringstream istr("{\"values\": [1, 2, 3]}");
+	Document doc;
+	doc.parse(istr);
+	assertTrue (doc.root()["values"][2].getInt64() == 3);
+	assertEqual (6, doc.nodeCount());
+
+	doc.clear();
+	assertTrue (doc.root().isEmpty());
+	assertEqual (0, doc.nodeCount());
+}
+
+
+void DocumentTest::setUp()
+{
+}
+
+
+void DocumentTest::tearDown()
+{
+}
+
+
+CppUnit::Test* DocumentTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("DocumentTest");
+
+	CppUnit_addTest(pSuite, DocumentTest, testScalars);
+	CppUnit_addTest(pSuite, DocumentTest, testObject);
+	CppUnit_addTest(pSuite, DocumentTest, testArray);
+	CppUnit_addTest(pSuite, DocumentTest, testStrings);
+	CppUnit_addTest(pSuite, DocumentTest, testNumbers);
+	CppUnit_addTest(pSuite, DocumentTest, testFind);
+	CppUnit_addTest(pSuite, DocumentTest, testIterator);
+	CppUnit_addTest(pSuite, DocumentTest, testToVar);
+	CppUnit_addTest(pSuite, DocumentTest, testInvalid);
+	CppUnit_addTest(pSuite, DocumentTest, testDepth);
+	CppUnit_addTest(pSuite, DocumentTest, testStream);
+
+	return pSuite;
+}
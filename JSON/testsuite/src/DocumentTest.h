@@ -0,0 +1,46 @@
+//
+// DocumentTest.h
+//
+// Definition of the DocumentTest class.
+//
+// Copyright (c) 2012, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef DocumentTest_INCLUDED
+#define DocumentTest_INCLUDED
+
+
+#include "Poco/JSON/JSON.h"
+#include "CppUnit/TestCase.h"
+
+
+class DocumentTest: public CppUnit::TestCase
+{
+public:
+	DocumentTest(const std::string& name);
+	~DocumentTest();
+
+	void testScalars();
+	void testObject();
+	void testArray();
+	void testStrings();
+	void testNumbers();
+	void testFind();
+	void testIterator();
+	void testToVar();
+	void testInvalid();
+	void testDepth();
+	void testStream();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // DocumentTest_INCLUDED
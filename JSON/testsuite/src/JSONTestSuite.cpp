@@ -10,6 +10,7 @@
 
 #include "JSONTestSuite.h"
 #include "JSONTest.h"
+#include "DocumentTest.h"
 
 
 CppUnit::Test* JSONTestSuite::suite()
@@ -17,6 +18,7 @@ CppUnit::Test* JSONTestSuite::suite()
 	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("JSONTestSuite");
 
 	pSuite->addTest(JSONTest::suite());
+	pSuite->addTest(DocumentTest::suite());
 
 	return pSuite;
 }
@@ -43,6 +43,9 @@ class Net_API DNS
 	///   * IDNs returned in HostEntry objects are never decoded. They can be
 	///     decoded by calling decodeIDN() (after testing for an encoded IDN by
 	///     calling isEncodedIDN()).
+	///
+	/// All lookups block the calling thread. For asynchronous lookups
+	/// with caching, see DNSResolver.
 {
 public:
 	enum HintFlag
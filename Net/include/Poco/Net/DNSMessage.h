@@ -0,0 +1,239 @@
+//
+// DNSMessage.h
+//
+// Library: Net
+// Package: NetCore
+// Module:  DNSMessage
+//
+// Definition of the DNSMessage class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_DNSMessage_INCLUDED
+#define Net_DNSMessage_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/IPAddress.h"
+#include <string>
+#include <vector>
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API DNSMessage
+	/// This class represents a message of the domain name
+	/// system protocol, as specified in RFC 1035.
+	///
+	/// Only the parts of the protocol needed for address
+	/// lookups by DNSResolver are supported. Messages are
+	/// written without name compression. Compressed names
+	/// in received messages are expanded.
+	///
+	/// The data of a resource record is kept in wire format,
+	/// with the following exceptions:
+	///
+	///   * For CNAME, NS and PTR records, the data is the
+	///     domain name in dotted notation.
+	///   * For SOA records, the data consists of the five 32-bit
+	///     fields following the two domain names (serial, refresh,
+	///     retry, expire and minimum). The domain names are
+	///     not kept; they are written as the root domain.
+{
+public:
+	enum RecordType
+	{
+		TYPE_A     = 1,
+		TYPE_NS    = 2,
+		TYPE_CNAME = 5,
+		TYPE_SOA   = 6,
+		TYPE_PTR   = 12,
+		TYPE_AAAA  = 28
+	};
+
+	enum ResponseCode
+	{
+		RCODE_NOERROR  = 0,
+		RCODE_FORMERR  = 1,
+		RCODE_SERVFAIL = 2,
+		RCODE_NXDOMAIN = 3,
+		RCODE_NOTIMP   = 4,
+		RCODE_REFUSED  = 5
+	};
+
+	enum
+	{
+		CLASS_IN = 1,
+		HEADER_SIZE = 12,
+		MAX_UDP_SIZE = 512,
+		MAX_NAME_LENGTH = 255,
+		MAX_LABEL_LENGTH = 63
+	};
+
+	struct Question
+	{
+		std::string name;
+		UInt16 type = TYPE_A;
+	};
+
+	struct Record
+	{
+		std::string name;
+		UInt16 type = TYPE_A;
+		UInt32 ttl = 0;
+		std::string data;
+	};
+
+	using Questions = std::vector<Question>;
+	using Records = std::vector<Record>;
+
+	DNSMessage();
+		/// Creates an empty DNSMessage.
+
+	~DNSMessage();
+		/// Destroys the DNSMessage.
+
+	void setId(UInt16 id);
+		/// Sets the message ID.
+
+	UInt16 getId() const;
+		/// Returns the message ID.
+
+	void setResponse(bool response);
+		/// Marks the message as a response (QR flag).
+
+	bool isResponse() const;
+		/// Returns true if the message is a response.
+
+	void setTruncated(bool truncated);
+		/// Sets the TC flag.
+
+	bool isTruncated() const;
+		/// Returns true if the message has been truncated
+		/// and must be requested again over TCP.
+
+	void setRecursionDesired(bool recursion);
+		/// Sets the RD flag. Default is true.
+
+	bool getRecursionDesired() const;
+		/// Returns true if the RD flag is set.
+
+	void setResponseCode(ResponseCode code);
+		/// Sets the response code.
+
+	ResponseCode getResponseCode() const;
+		/// Returns the response code.
+
+	void addQuestion(const std::string& name, UInt16 type);
+		/// Adds a question for the given name and record type.
+
+	const Questions& questions() const;
+		/// Returns the questions.
+
+	void addAnswer(const Record& record);
+		/// Adds a record to the answer section.
+
+	const Records& answers() const;
+		/// Returns the records in the answer section.
+
+	void addAuthority(const Record& record);
+		/// Adds a record to the authority section.
+
+	const Records& authorities() const;
+		/// Returns the records in the authority section.
+
+	void write(std::string& buffer) const;
+		/// Appends the message in wire format to the given buffer.
+		///
+		/// Throws a DNSException if a name is not valid.
+
+	void read(const char* buffer, std::size_t size);
+		/// Reads the message from the given buffer.
+		///
+		/// Records in the additional section are ignored.
+		/// Throws a DNSException if the message is malformed.
+
+	static Record addressRecord(const std::string& name, const IPAddress& address, UInt32 ttl);
+		/// Creates an A or AAAA record for the given address.
+
+	static Record cnameRecord(const std::string& name, const std::string& target, UInt32 ttl);
+		/// Creates a CNAME record.
+
+	static Record soaRecord(const std::string& name, UInt32 minimum, UInt32 ttl);
+		/// Creates a SOA record with the given minimum (negative caching) TTL.
+		/// The other fields of the record are zero.
+
+	static IPAddress address(const Record& record);
+		/// Returns the address of an A or AAAA record.
+		///
+		/// Throws a DNSException if the record is not an
+		/// A or AAAA record or its data is malformed.
+
+	static UInt32 soaMinimum(const Record& record);
+		/// Returns the minimum TTL of a SOA record.
+		///
+		/// Throws a DNSException if the record is not a
+		/// SOA record or its data is malformed.
+
+	static bool equalNames(const std::string& name1, const std::string& name2);
+		/// Returns true if both domain names are equal,
+		/// ignoring case and a trailing dot.
+
+private:
+	static void writeName(std::string& buffer, const std::string& name);
+	static void writeRecord(std::string& buffer, const Record& record);
+	static std::string readName(const char* buffer, std::size_t size, std::size_t& pos);
+	static void readRecord(const char* buffer, std::size_t size, std::size_t& pos, Record& record);
+
+	UInt16 _id;
+	UInt16 _flags;
+	Questions _questions;
+	Records _answers;
+	Records _authorities;
+};
+
+
+//
+// inlines
+//
+inline void DNSMessage::setId(UInt16 id)
+{
+	_id = id;
+}
+
+
+inline UInt16 DNSMessage::getId() const
+{
+	return _id;
+}
+
+
+inline const DNSMessage::Questions& DNSMessage::questions() const
+{
+	return _questions;
+}
+
+
+inline const DNSMessage::Records& DNSMessage::answers() const
+{
+	return _answers;
+}
+
+
+inline const DNSMessage::Records& DNSMessage::authorities() const
+{
+	return _authorities;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_DNSMessage_INCLUDED
@@ -0,0 +1,241 @@
+//
+// DNSResolver.h
+//
+// Library: Net
+// Package: NetCore
+// Module:  DNSResolver
+//
+// Definition of the DNSResolver class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_DNSResolver_INCLUDED
+#define Net_DNSResolver_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/HostEntry.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Future.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/Mutex.h"
+#include "Poco/Timespan.h"
+#include "Poco/Timestamp.h"
+#include "Poco/UniqueExpireLRUCache.h"
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <vector>
+
+
+namespace Poco {
+namespace Net {
+
+
+class SocketReactor;
+
+
+class Net_API DNSResolver
+	/// DNSResolver resolves host names asynchronously, by
+	/// talking the DNS protocol to the configured name servers.
+	/// Unlike DNS::hostByName() and DNS::resolve(), which block
+	/// the calling thread in the system resolver, a DNSResolver
+	/// does all its work in a SocketReactor, so that any number
+	/// of lookups can be outstanding without tying up threads.
+	///
+	/// For every lookup, A and (optionally) AAAA queries are sent
+	/// at the same time over UDP. Each attempt uses a new socket,
+	/// thus a new source port. Queries that are not answered within
+	/// the timeout are sent again, to the next name server in turn.
+	/// Truncated responses are retried over TCP.
+	///
+	/// Results are kept in a cache, honouring the TTLs of the
+	/// records (limited by Params::minTTL and Params::maxTTL).
+	/// Negative answers (non-existing names and names without
+	/// addresses) are cached as well, as specified in RFC 2308.
+	/// The cache is divided into shards, each protected by its
+	/// own mutex, so that lookups from many threads do not
+	/// contend for a single lock.
+	///
+	/// Concurrent lookups of the same name are coalesced: only
+	/// the first one sends queries, and all of them complete
+	/// together when the response arrives.
+	///
+	/// A lookup either returns a Future, or invokes a callback
+	/// when it completes. Callbacks and continuations registered
+	/// with Future::then() run in the reactor thread (or in the
+	/// calling thread if the result is taken from the cache),
+	/// so they must not block.
+	///
+	/// Failed lookups complete with a HostNotFoundException
+	/// (the name does not exist), a NoAddressFoundException (the
+	/// name has no addresses), a TimeoutException (no name server
+	/// responded) or a DNSException (server failure or malformed
+	/// response).
+	///
+	/// Host names are treated as fully qualified; search domains
+	/// and the hosts file are not consulted. Numeric addresses
+	/// are returned without a lookup. IDNs are encoded as with
+	/// DNS::resolve().
+	///
+	/// The SocketReactor must be running for lookups to complete.
+	/// The DNSResolver must be destroyed before the SocketReactor,
+	/// and should only be destroyed while the reactor is stopped or
+	/// while no lookups are outstanding. Outstanding lookups fail
+	/// with an IOException when the DNSResolver is destroyed.
+{
+public:
+	using Callback = std::function<void(const HostEntry& entry, std::exception_ptr pException)>;
+		/// The callback for a lookup. On success, pException is null.
+		/// Otherwise, entry is empty and pException holds the reason
+		/// for the failure.
+
+	struct Params
+		/// DNSResolver parameters.
+	{
+		std::vector<SocketAddress> nameServers;
+			/// The name servers to query, in order of preference.
+			/// If empty, the name servers returned by
+			/// systemNameServers() are used.
+
+		Poco::Timespan timeout = Poco::Timespan(2, 0);
+			/// Time to wait for a response before the query
+			/// is sent again.
+
+		int attempts = 2;
+			/// Number of times queries are sent to each name server.
+
+		bool queryIPv6 = true;
+			/// If true, AAAA queries are sent in addition to A queries.
+
+		bool useTCP = true;
+			/// If true, truncated responses are retried over TCP.
+
+		std::size_t cacheShards = 16;
+			/// Number of cache shards.
+
+		std::size_t cacheSize = 4096;
+			/// Maximum number of names in the cache, distributed
+			/// over all shards. Zero disables caching.
+
+		Poco::Timespan minTTL = 0;
+			/// Lower bound for the time results are cached.
+
+		Poco::Timespan maxTTL = Poco::Timespan(86400, 0);
+			/// Upper bound for the time results are cached.
+
+		Poco::Timespan maxNegativeTTL = Poco::Timespan(300, 0);
+			/// Upper bound for the time negative answers are cached.
+
+		Poco::Timespan defaultNegativeTTL = Poco::Timespan(30, 0);
+			/// Time negative answers are cached if the
+			/// response does not contain a SOA record.
+	};
+
+	explicit DNSResolver(SocketReactor& reactor);
+		/// Creates the DNSResolver, using the given SocketReactor
+		/// and default parameters.
+
+	DNSResolver(SocketReactor& reactor, const Params& params);
+		/// Creates the DNSResolver, using the given SocketReactor
+		/// and parameters.
+
+	~DNSResolver();
+		/// Destroys the DNSResolver. Outstanding lookups fail
+		/// with an IOException.
+
+	Poco::Future<HostEntry> resolve(const std::string& hostname);
+		/// Looks up the given host name and returns a Future
+		/// for the result.
+
+	void resolve(const std::string& hostname, const Callback& callback);
+		/// Looks up the given host name and invokes the callback
+		/// with the result.
+
+	void clearCache();
+		/// Removes all entries from the cache.
+
+	std::size_t cacheSize() const;
+		/// Returns the number of entries in the cache, including
+		/// entries that have expired but have not been removed yet.
+
+	std::size_t pendingLookups() const;
+		/// Returns the number of lookups waiting for a response.
+
+	const Params& params() const;
+		/// Returns the parameters.
+
+	static std::vector<SocketAddress> systemNameServers();
+		/// Returns the name servers configured for the system
+		/// (from /etc/resolv.conf on Unix platforms).
+		/// If none are configured, returns 127.0.0.1:53.
+
+private:
+	class Lookup;
+	using LookupPtr = Poco::AutoPtr<Lookup>;
+
+	class CacheEntry
+	{
+	public:
+		enum Status
+		{
+			ENTRY_FOUND,
+			ENTRY_NOT_FOUND,
+			ENTRY_NO_ADDRESS
+		};
+
+		CacheEntry(const HostEntry& entry, Status status, const Poco::Timestamp& expiration);
+
+		const HostEntry& entry() const;
+		Status status() const;
+		const Poco::Timestamp& getExpiration() const;
+
+	private:
+		HostEntry _entry;
+		Status _status;
+		Poco::Timestamp _expiration;
+	};
+
+	using Cache = Poco::UniqueExpireLRUCache<std::string, CacheEntry>;
+
+	void start(const std::string& name, const Callback& callback);
+	void complete(Lookup& lookup, const HostEntry& entry, CacheEntry::Status status, std::exception_ptr pException, const Poco::Timespan& ttl);
+	bool lookupCache(const std::string& name, HostEntry& entry, std::exception_ptr& pException);
+	Cache& cacheShard(const std::string& name) const;
+	UInt16 nextId();
+
+	static std::string normalize(const std::string& hostname);
+	static std::exception_ptr makeException(CacheEntry::Status status, const std::string& name);
+
+	SocketReactor& _reactor;
+	Params _params;
+	std::vector<std::unique_ptr<Cache>> _cache;
+	std::map<std::string, LookupPtr> _lookups;
+	mutable Poco::FastMutex _mutex;
+
+	DNSResolver(const DNSResolver&) = delete;
+	DNSResolver& operator = (const DNSResolver&) = delete;
+
+	friend class Lookup;
+};
+
+
+//
+// inlines
+//
+inline const DNSResolver::Params& DNSResolver::params() const
+{
+	return _params;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_DNSResolver_INCLUDED
@@ -270,6 +270,65 @@ public:
 		/// The flags parameter can be used to pass system-defined flags
 		/// for recvfrom() like MSG_PEEK.
 
+	int sendBatch(const SocketDatagram* datagrams, int count, int flags = 0);
+		/// Sends up to count datagrams through the socket, each to
+		/// the address given in the datagram (or to the connected
+		/// peer, if the address is null).
+		///
+		/// On platforms supporting it (POCO_HAVE_MMSG), all datagrams
+		/// are passed to the kernel with a single sendmmsg() call per
+		/// SocketImpl::MAX_DATAGRAM_BATCH datagrams.
+		///
+		/// Returns the number of datagrams sent, which may be less
+		/// than count, or -1 if the socket is non-blocking and no
+		/// datagram could be sent without blocking.
+
+	int sendBatch(const SocketDatagramVec& datagrams, int flags = 0);
+		/// Sends the given datagrams through the socket.
+		/// See sendBatch(const SocketDatagram*, int, int).
+
+	int sendSegmented(const void* buffer, int length, int segmentSize, const SocketAddress& address, int flags = 0);
+		/// Sends the contents of buffer to the given address, as a
+		/// series of datagrams of segmentSize bytes each (the last
+		/// datagram may be shorter).
+		///
+		/// On Linux, UDP generic segmentation offload is used, so that
+		/// the kernel (or the network device) splits the buffer into
+		/// datagrams. Otherwise, the datagrams are sent with sendBatch().
+		///
+		/// Returns the number of bytes sent.
+
+	int receiveBatch(SocketDatagram* datagrams, int count, int flags = 0);
+		/// Receives up to count datagrams (but no more than
+		/// SocketImpl::MAX_DATAGRAM_BATCH) into the given datagram
+		/// buffers, using a single recvmmsg() call on platforms
+		/// supporting it (POCO_HAVE_MMSG). On other platforms,
+		/// a single datagram is received.
+		///
+		/// If the socket is blocking, waits for the first datagram;
+		/// further datagrams are only received if already available.
+		///
+		/// Returns the number of datagrams received, or -1 if the
+		/// socket is non-blocking and no datagram is available.
+		/// The length, addressLength and segmentSize members
+		/// of each received datagram are updated.
+
+	int receiveBatch(SocketDatagramVec& datagrams, int flags = 0);
+		/// Receives datagrams into the given datagram buffers.
+		/// See receiveBatch(SocketDatagram*, int, int).
+
+	void setUDPGRO(bool flag);
+		/// Enables or disables UDP generic receive offload on Linux.
+		/// Does nothing on other platforms.
+		///
+		/// With receive offload enabled, the kernel may coalesce several
+		/// datagrams from the same sender into a single buffer, if the
+		/// buffer is large enough. receiveBatch() reports the size of the
+		/// coalesced datagrams in SocketDatagram::segmentSize.
+
+	bool getUDPGRO() const;
+		/// Returns true if UDP generic receive offload is enabled.
+
 	void setBroadcast(bool flag);
 		/// Sets the value of the SO_BROADCAST socket option.
 		///
@@ -304,6 +363,48 @@ inline bool DatagramSocket::getBroadcast() const
 }
 
 
+inline int DatagramSocket::sendBatch(const SocketDatagram* datagrams, int count, int flags)
+{
+	return impl()->sendBatch(datagrams, count, flags);
+}
+
+
+inline int DatagramSocket::sendBatch(const SocketDatagramVec& datagrams, int flags)
+{
+	return datagrams.empty() ? 0 : impl()->sendBatch(&datagrams[0], static_cast<int>(datagrams.size()), flags);
+}
+
+
+inline int DatagramSocket::sendSegmented(const void* buffer, int length, int segmentSize, const SocketAddress& address, int flags)
+{
+	return impl()->sendSegmented(buffer, length, segmentSize, address, flags);
+}
+
+
+inline int DatagramSocket::receiveBatch(SocketDatagram* datagrams, int count, int flags)
+{
+	return impl()->receiveBatch(datagrams, count, flags);
+}
+
+
+inline int DatagramSocket::receiveBatch(SocketDatagramVec& datagrams, int flags)
+{
+	return datagrams.empty() ? 0 : impl()->receiveBatch(&datagrams[0], static_cast<int>(datagrams.size()), flags);
+}
+
+
+inline void DatagramSocket::setUDPGRO(bool flag)
+{
+	impl()->setUDPGRO(flag);
+}
+
+
+inline bool DatagramSocket::getUDPGRO() const
+{
+	return impl()->getUDPGRO();
+}
+
+
 } } // namespace Poco::Net
 
 
@@ -0,0 +1,282 @@
+//
+// HPACK.h
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HPACK
+//
+// Definition of the HPACKHuffman, HPACKTable, HPACKEncoder
+// and HPACKDecoder classes.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HPACK_INCLUDED
+#define Net_HPACK_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace Poco {
+namespace Net {
+
+
+using HPACKHeaderField = std::pair<std::string, std::string>;
+	/// A header field (name, value). Names are lower case.
+
+using HPACKHeaderList = std::vector<HPACKHeaderField>;
+	/// A list of header fields, in the order they appear in a header block.
+
+
+class Net_API HPACKHuffman
+	/// The static Huffman code used by HPACK for
+	/// string literals (RFC 7541, Section 5.2 and Appendix B).
+{
+public:
+	static std::size_t encodedLength(const std::string& str);
+		/// Returns the length in bytes of the Huffman encoded string.
+
+	static void encode(const std::string& str, std::string& buffer);
+		/// Appends the Huffman encoded string to buffer.
+
+	static void decode(const char* pData, std::size_t length, std::string& str);
+		/// Appends the decoded Huffman encoded data to str.
+		///
+		/// Throws a HTTP2Exception (ERROR_COMPRESSION) if the
+		/// data is not validly encoded.
+};
+
+
+class Net_API HPACKTable
+	/// The HPACK indexing table, consisting of the static table
+	/// and a dynamic table (RFC 7541, Section 2.3).
+	///
+	/// Indices start at 1. Indices 1 to STATIC_TABLE_SIZE refer to
+	/// the static table, higher indices to the dynamic table,
+	/// starting with the most recently added entry.
+{
+public:
+	enum
+	{
+		STATIC_TABLE_SIZE  = 61,
+		DEFAULT_TABLE_SIZE = 4096,
+		ENTRY_OVERHEAD     = 32
+	};
+
+	explicit HPACKTable(std::size_t maxSize = DEFAULT_TABLE_SIZE);
+		/// Creates the HPACKTable with the given maximum
+		/// size of the dynamic table.
+
+	~HPACKTable();
+		/// Destroys the HPACKTable.
+
+	const HPACKHeaderField& get(std::size_t index) const;
+		/// Returns the entry with the given index.
+		///
+		/// Throws a HTTP2Exception (ERROR_COMPRESSION) if the
+		/// index is not valid.
+
+	void add(const std::string& name, const std::string& value);
+		/// Adds an entry to the dynamic table, evicting older
+		/// entries as necessary. An entry that is larger than the
+		/// maximum size empties the table.
+
+	std::size_t find(const std::string& name, const std::string& value, bool& valueMatch) const;
+		/// Searches the static and dynamic table for an entry with
+		/// the given name and value, or at least the given name.
+		/// Returns the index of the entry, or 0 if there is no
+		/// entry with the given name. valueMatch is set to true if
+		/// the value matches as well.
+
+	void setMaxSize(std::size_t maxSize);
+		/// Sets the maximum size of the dynamic table,
+		/// evicting entries as necessary.
+
+	std::size_t maxSize() const;
+		/// Returns the maximum size of the dynamic table.
+
+	std::size_t size() const;
+		/// Returns the size of the dynamic table, which is the
+		/// sum of the entry sizes (name length, value length and
+		/// ENTRY_OVERHEAD).
+
+	std::size_t entries() const;
+		/// Returns the number of entries in the dynamic table.
+
+private:
+	void evict(std::size_t maxSize);
+
+	std::deque<HPACKHeaderField> _dynamicTable;
+	std::size_t _size;
+	std::size_t _maxSize;
+};
+
+
+class Net_API HPACKEncoder
+	/// The HPACKEncoder encodes header lists into HPACK header
+	/// blocks (RFC 7541).
+	///
+	/// The encoder adds header fields that are likely to be repeated
+	/// (e.g., content-type or server) to the dynamic table. Header
+	/// fields that usually differ for every message (e.g., content-length)
+	/// are not indexed, and sensitive header fields (authorization,
+	/// cookies) are sent as never-indexed literals.
+	/// String literals are Huffman encoded if that makes them shorter.
+	///
+	/// An encoder keeps the state of the dynamic table for one
+	/// direction of a connection, so all header blocks must be
+	/// sent in the order they have been encoded.
+{
+public:
+	explicit HPACKEncoder(std::size_t maxTableSize = HPACKTable::DEFAULT_TABLE_SIZE);
+		/// Creates the HPACKEncoder, using a dynamic table
+		/// of at most the given size.
+
+	~HPACKEncoder();
+		/// Destroys the HPACKEncoder.
+
+	void encode(const HPACKHeaderList& headers, std::string& block);
+		/// Encodes the given header fields and appends the
+		/// header block to block. Header names must be lower case.
+
+	void setMaxTableSize(std::size_t maxTableSize);
+		/// Sets the maximum size of the dynamic table announced
+		/// by the peer (SETTINGS_HEADER_TABLE_SIZE). The encoder uses
+		/// the smaller of this and the size given to the constructor,
+		/// and signals the change at the start of the next header block.
+
+	const HPACKTable& table() const;
+		/// Returns the encoder's indexing table.
+
+	static void encodeInteger(Poco::UInt64 value, int prefixBits, int flags, std::string& buffer);
+		/// Appends an integer with the given prefix size (RFC 7541, Section 5.1).
+		/// flags are stored in the first byte, above the prefix bits.
+
+	static void encodeString(const std::string& str, std::string& buffer);
+		/// Appends a string literal (RFC 7541, Section 5.2),
+		/// Huffman encoded if that is shorter.
+
+private:
+	enum Indexing
+	{
+		INDEXING_INCREMENTAL,
+		INDEXING_NONE,
+		INDEXING_NEVER
+	};
+
+	void encodeField(const std::string& name, const std::string& value, std::string& block);
+	static Indexing indexing(const std::string& name, const std::string& value);
+
+	HPACKTable _table;
+	std::size_t _maxTableSize;
+	std::size_t _newTableSize;
+	std::size_t _minTableSize;
+	bool _sizeUpdatePending;
+};
+
+
+class Net_API HPACKDecoder
+	/// The HPACKDecoder decodes HPACK header blocks (RFC 7541)
+	/// into header lists.
+	///
+	/// A decoder keeps the state of the dynamic table for one
+	/// direction of a connection, so all header blocks must be
+	/// decoded in the order they have been received.
+{
+public:
+	enum
+	{
+		DEFAULT_MAX_HEADER_LIST_SIZE = 65536
+	};
+
+	explicit HPACKDecoder(std::size_t maxTableSize = HPACKTable::DEFAULT_TABLE_SIZE);
+		/// Creates the HPACKDecoder, allowing the peer to use a dynamic table
+		/// of at most the given size (SETTINGS_HEADER_TABLE_SIZE).
+
+	~HPACKDecoder();
+		/// Destroys the HPACKDecoder.
+
+	void decode(const char* pBlock, std::size_t length, HPACKHeaderList& headers);
+		/// Decodes the given header block and appends the header fields to headers.
+		///
+		/// Throws a HTTP2Exception (ERROR_COMPRESSION) if the header block
+		/// is not valid, or (ERROR_ENHANCE_YOUR_CALM) if the decoded header list
+		/// exceeds the maximum header list size. In both cases, the state of the
+		/// decoder is undefined afterwards and the connection must be closed.
+
+	void setMaxHeaderListSize(std::size_t size);
+		/// Sets the maximum size of a decoded header list, computed like the size
+		/// of dynamic table entries. Defaults to DEFAULT_MAX_HEADER_LIST_SIZE.
+
+	std::size_t getMaxHeaderListSize() const;
+		/// Returns the maximum size of a decoded header list.
+
+	const HPACKTable& table() const;
+		/// Returns the decoder's indexing table.
+
+	static Poco::UInt64 decodeInteger(const char*& pData, const char* pEnd, int prefixBits);
+		/// Decodes an integer with the given prefix size (RFC 7541, Section 5.1),
+		/// and advances pData.
+
+	static void decodeString(const char*& pData, const char* pEnd, std::string& str);
+		/// Decodes a string literal (RFC 7541, Section 5.2), and advances pData.
+
+private:
+	HPACKTable _table;
+	std::size_t _maxTableSize;
+	std::size_t _maxHeaderListSize;
+};
+
+
+//
+// inlines
+//
+inline std::size_t HPACKTable::maxSize() const
+{
+	return _maxSize;
+}
+
+
+inline std::size_t HPACKTable::size() const
+{
+	return _size;
+}
+
+
+inline std::size_t HPACKTable::entries() const
+{
+	return _dynamicTable.size();
+}
+
+
+inline const HPACKTable& HPACKEncoder::table() const
+{
+	return _table;
+}
+
+
+inline std::size_t HPACKDecoder::getMaxHeaderListSize() const
+{
+	return _maxHeaderListSize;
+}
+
+
+inline const HPACKTable& HPACKDecoder::table() const
+{
+	return _table;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HPACK_INCLUDED
@@ -0,0 +1,201 @@
+//
+// HTTP2Frame.h
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2Frame
+//
+// Definition of the HTTP2Frame class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTP2Frame_INCLUDED
+#define Net_HTTP2Frame_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include <string>
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API HTTP2Frame
+	/// This class represents the header of an HTTP/2 frame
+	/// (RFC 9113, Section 4.1), and defines the frame types, flags,
+	/// settings and error codes used by HTTP/2.
+{
+public:
+	enum Type
+	{
+		FRAME_DATA          = 0x0,
+		FRAME_HEADERS       = 0x1,
+		FRAME_PRIORITY      = 0x2,
+		FRAME_RST_STREAM    = 0x3,
+		FRAME_SETTINGS      = 0x4,
+		FRAME_PUSH_PROMISE  = 0x5,
+		FRAME_PING          = 0x6,
+		FRAME_GOAWAY        = 0x7,
+		FRAME_WINDOW_UPDATE = 0x8,
+		FRAME_CONTINUATION  = 0x9
+	};
+
+	enum Flags
+	{
+		FLAG_END_STREAM  = 0x01,
+		FLAG_ACK         = 0x01,
+		FLAG_END_HEADERS = 0x04,
+		FLAG_PADDED      = 0x08,
+		FLAG_PRIORITY    = 0x20
+	};
+
+	enum Setting
+	{
+		SETTINGS_HEADER_TABLE_SIZE      = 0x1,
+		SETTINGS_ENABLE_PUSH            = 0x2,
+		SETTINGS_MAX_CONCURRENT_STREAMS = 0x3,
+		SETTINGS_INITIAL_WINDOW_SIZE    = 0x4,
+		SETTINGS_MAX_FRAME_SIZE         = 0x5,
+		SETTINGS_MAX_HEADER_LIST_SIZE   = 0x6
+	};
+
+	enum ErrorCode
+	{
+		ERROR_NONE                = 0x0,
+		ERROR_PROTOCOL            = 0x1,
+		ERROR_INTERNAL            = 0x2,
+		ERROR_FLOW_CONTROL        = 0x3,
+		ERROR_SETTINGS_TIMEOUT    = 0x4,
+		ERROR_STREAM_CLOSED       = 0x5,
+		ERROR_FRAME_SIZE          = 0x6,
+		ERROR_REFUSED_STREAM      = 0x7,
+		ERROR_CANCEL              = 0x8,
+		ERROR_COMPRESSION         = 0x9,
+		ERROR_CONNECT             = 0xa,
+		ERROR_ENHANCE_YOUR_CALM   = 0xb,
+		ERROR_INADEQUATE_SECURITY = 0xc,
+		ERROR_HTTP_1_1_REQUIRED   = 0xd
+	};
+
+	enum
+	{
+		HEADER_SIZE            = 9,
+		DEFAULT_MAX_FRAME_SIZE = 16384,
+		MAX_MAX_FRAME_SIZE     = 16777215,
+		DEFAULT_WINDOW_SIZE    = 65535,
+		MAX_WINDOW_SIZE        = 0x7fffffff
+	};
+
+	HTTP2Frame();
+		/// Creates an empty HTTP2Frame.
+
+	HTTP2Frame(Poco::UInt32 length, Type type, int flags, Poco::UInt32 streamId);
+		/// Creates a HTTP2Frame with the given payload length,
+		/// type, flags and stream identifier.
+
+	~HTTP2Frame();
+		/// Destroys the HTTP2Frame.
+
+	Poco::UInt32 length() const;
+		/// Returns the length of the frame payload.
+
+	Type type() const;
+		/// Returns the frame type. Note that the returned value
+		/// may not be one of the known types.
+
+	int flags() const;
+		/// Returns the frame flags.
+
+	bool hasFlag(int flag) const;
+		/// Returns true if the given flag is set.
+
+	Poco::UInt32 streamId() const;
+		/// Returns the stream identifier.
+
+	void read(const char* pHeader);
+		/// Reads the frame header from the given buffer,
+		/// which must contain HEADER_SIZE bytes.
+
+	void write(char* pHeader) const;
+		/// Writes the frame header to the given buffer,
+		/// which must have room for HEADER_SIZE bytes.
+
+	void append(std::string& buffer) const;
+		/// Appends the frame header to the given buffer.
+
+	static Poco::UInt32 readUInt32(const char* p);
+		/// Reads an unsigned 32-bit integer in network byte order.
+
+	static void appendUInt32(std::string& buffer, Poco::UInt32 value);
+		/// Appends an unsigned 32-bit integer in network byte order.
+
+	static const std::string CONNECTION_PREFACE;
+		/// The client connection preface ("PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n").
+
+private:
+	Poco::UInt32 _length;
+	Type _type;
+	int _flags;
+	Poco::UInt32 _streamId;
+};
+
+
+//
+// inlines
+//
+inline Poco::UInt32 HTTP2Frame::length() const
+{
+	return _length;
+}
+
+
+inline HTTP2Frame::Type HTTP2Frame::type() const
+{
+	return _type;
+}
+
+
+inline int HTTP2Frame::flags() const
+{
+	return _flags;
+}
+
+
+inline bool HTTP2Frame::hasFlag(int flag) const
+{
+	return (_flags & flag) != 0;
+}
+
+
+inline Poco::UInt32 HTTP2Frame::streamId() const
+{
+	return _streamId;
+}
+
+
+inline Poco::UInt32 HTTP2Frame::readUInt32(const char* p)
+{
+	const unsigned char* pu = reinterpret_cast<const unsigned char*>(p);
+	return (static_cast<Poco::UInt32>(pu[0]) << 24) | (static_cast<Poco::UInt32>(pu[1]) << 16) | (static_cast<Poco::UInt32>(pu[2]) << 8) | pu[3];
+}
+
+
+inline void HTTP2Frame::appendUInt32(std::string& buffer, Poco::UInt32 value)
+{
+	buffer += static_cast<char>(value >> 24);
+	buffer += static_cast<char>(value >> 16);
+	buffer += static_cast<char>(value >> 8);
+	buffer += static_cast<char>(value);
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTP2Frame_INCLUDED
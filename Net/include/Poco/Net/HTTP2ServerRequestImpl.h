@@ -0,0 +1,101 @@
+//
+// HTTP2ServerRequestImpl.h
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2ServerRequestImpl
+//
+// Definition of the HTTP2ServerRequestImpl class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTP2ServerRequestImpl_INCLUDED
+#define Net_HTTP2ServerRequestImpl_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTP2ServerResponseImpl.h"
+#include "Poco/Net/SocketAddress.h"
+#include <istream>
+
+
+namespace Poco {
+namespace Net {
+
+
+class HTTP2ServerStream;
+
+
+class Net_API HTTP2ServerRequestImpl: public HTTPServerRequest
+	/// This subclass of HTTPServerRequest is used for
+	/// representing server-side HTTP/2 requests.
+	///
+	/// The request method, URI and host are taken from the
+	/// :method, :path and :authority pseudo-header fields.
+	/// The version is HTTP/2.0. Multiple cookie header fields
+	/// are combined into a single Cookie header.
+{
+public:
+	HTTP2ServerRequestImpl(HTTP2ServerResponseImpl& response, HTTP2ServerStream& stream);
+		/// Creates the HTTP2ServerRequestImpl from the header
+		/// fields received on the given stream.
+
+	~HTTP2ServerRequestImpl();
+		/// Destroys the HTTP2ServerRequestImpl.
+
+	std::istream& stream();
+		/// Returns the input stream for reading
+		/// the request body.
+		///
+		/// The stream is valid until the HTTP2ServerRequestImpl
+		/// object is destroyed.
+
+	const SocketAddress& clientAddress() const;
+		/// Returns the client's address.
+
+	const SocketAddress& serverAddress() const;
+		/// Returns the server's address.
+
+	const HTTPServerParams& serverParams() const;
+		/// Returns a reference to the server parameters.
+
+	HTTPServerResponse& response() const;
+		/// Returns a reference to the associated response.
+
+	bool secure() const;
+		/// Returns true if the request is using a secure
+		/// connection.
+
+	const std::string& getScheme() const;
+		/// Returns the value of the :scheme pseudo-header field.
+
+	Poco::UInt32 streamId() const;
+		/// Returns the identifier of the HTTP/2 stream.
+
+private:
+	HTTP2ServerResponseImpl& _response;
+	HTTP2ServerStream&       _stream;
+	std::istream*            _pStream;
+	std::string              _scheme;
+};
+
+
+//
+// inlines
+//
+inline const std::string& HTTP2ServerRequestImpl::getScheme() const
+{
+	return _scheme;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTP2ServerRequestImpl_INCLUDED
@@ -0,0 +1,168 @@
+//
+// HTTP2ServerResponseImpl.h
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2ServerResponseImpl
+//
+// Definition of the HTTP2ServerResponseImpl class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTP2ServerResponseImpl_INCLUDED
+#define Net_HTTP2ServerResponseImpl_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/MessageHeader.h"
+#include "Poco/Net/HPACK.h"
+#include <ostream>
+
+
+namespace Poco {
+namespace Net {
+
+
+class HTTP2ServerStream;
+class HTTP2ServerRequestImpl;
+class HTTP2OutputStream;
+
+
+class Net_API HTTP2ServerResponseImpl: public HTTPServerResponse
+	/// This subclass of HTTPServerResponse is used for
+	/// representing server-side HTTP/2 responses.
+	///
+	/// The response header is sent in a HEADERS frame, the
+	/// response body in DATA frames. Connection-specific header
+	/// fields (Connection, Keep-Alive, Transfer-Encoding, etc.)
+	/// are not sent, as they are not allowed in HTTP/2, and
+	/// chunked transfer encoding is not used.
+	///
+	/// After the request handler has returned, the stream is
+	/// ended, optionally with a trailer (see trailer()).
+{
+public:
+	HTTP2ServerResponseImpl(HTTP2ServerStream& stream);
+		/// Creates the HTTP2ServerResponseImpl.
+
+	~HTTP2ServerResponseImpl();
+		/// Destroys the HTTP2ServerResponseImpl.
+
+	void sendContinue();
+		/// Sends a 100 Continue response to the
+		/// client.
+
+	std::ostream& send();
+		/// Sends the response header to the client and
+		/// returns an output stream for sending the
+		/// response body.
+		///
+		/// The returned stream is valid until the response
+		/// object is destroyed.
+		///
+		/// Must not be called after sendFile(), sendBuffer()
+		/// or redirect() has been called.
+
+	void sendFile(const std::string& path, const std::string& mediaType);
+		/// Sends the response header to the client, followed
+		/// by the content of the given file.
+		///
+		/// Must not be called after send(), sendBuffer()
+		/// or redirect() has been called.
+		///
+		/// Throws a FileNotFoundException if the file
+		/// cannot be found, or an OpenFileException if
+		/// the file cannot be opened.
+
+	void sendBuffer(const void* pBuffer, std::size_t length);
+		/// Sends the response header to the client, followed
+		/// by the contents of the given buffer.
+		///
+		/// The Content-Length header of the response is set
+		/// to length. If the client's flow control window allows,
+		/// header and body are sent with a single write to the socket.
+		///
+		/// Must not be called after send(), sendFile()
+		/// or redirect() has been called.
+
+	void redirect(const std::string& uri, HTTPStatus status = HTTP_FOUND);
+		/// Sets the status code, which must be one of
+		/// HTTP_MOVED_PERMANENTLY (301), HTTP_FOUND (302),
+		/// or HTTP_SEE_OTHER (303),
+		/// and sets the "Location" header field
+		/// to the given URI, which according to
+		/// the HTTP specification, must be absolute.
+		///
+		/// Must not be called after send() has been called.
+
+	void requireAuthentication(const std::string& realm);
+		/// Sets the status code to 401 (Unauthorized)
+		/// and sets the "WWW-Authenticate" header field
+		/// according to the given realm.
+
+	bool sent() const;
+		/// Returns true if the response (header) has been sent.
+
+	MessageHeader& trailer();
+		/// Returns the trailer, which is sent after the response
+		/// body, if it is not empty (e.g., grpc-status for gRPC).
+		/// Only used if the response body is sent with send().
+
+	void finish();
+		/// Ends the stream, sending any buffered response body data
+		/// and the trailer. If no response has been sent, the response
+		/// header is sent with an empty body.
+		///
+		/// Called by HTTP2ServerSession after the request handler
+		/// has returned.
+
+protected:
+	void attachRequest(HTTP2ServerRequestImpl* pRequest);
+	void headerFields(HPACKHeaderList& fields) const;
+	void sendHeader(bool endStream);
+	bool noBody() const;
+
+private:
+	HTTP2ServerStream&      _stream;
+	HTTP2ServerRequestImpl* _pRequest;
+	std::ostream*           _pStream;
+	HTTP2OutputStream*      _pOutputStream;
+	MessageHeader           _trailer;
+	bool                    _sent;
+	bool                    _finished;
+
+	friend class HTTP2ServerRequestImpl;
+};
+
+
+//
+// inlines
+//
+inline bool HTTP2ServerResponseImpl::sent() const
+{
+	return _sent;
+}
+
+
+inline MessageHeader& HTTP2ServerResponseImpl::trailer()
+{
+	return _trailer;
+}
+
+
+inline void HTTP2ServerResponseImpl::attachRequest(HTTP2ServerRequestImpl* pRequest)
+{
+	_pRequest = pRequest;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTP2ServerResponseImpl_INCLUDED
@@ -0,0 +1,324 @@
+//
+// HTTP2ServerSession.h
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2ServerSession
+//
+// Definition of the HTTP2ServerSession and HTTP2ServerStream classes.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTP2ServerSession_INCLUDED
+#define Net_HTTP2ServerSession_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTP2Frame.h"
+#include "Poco/Net/HPACK.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/AutoPtr.h"
+#include "Poco/Runnable.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Buffer.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include "Poco/Timespan.h"
+#include <atomic>
+#include <map>
+#include <memory>
+
+
+namespace Poco {
+namespace Net {
+
+
+class HTTP2ServerSession;
+
+
+class Net_API HTTP2ServerStream: public Poco::RefCountedObject, public Poco::Runnable
+	/// A HTTP/2 stream, carrying a single request and its response,
+	/// within a HTTP2ServerSession.
+	///
+	/// This class is for internal use by HTTP2ServerSession and the
+	/// HTTP/2 request and response classes only.
+{
+public:
+	using Ptr = Poco::AutoPtr<HTTP2ServerStream>;
+
+	HTTP2ServerStream(HTTP2ServerSession& session, Poco::UInt32 id, HPACKHeaderList& headers, bool endStream);
+		/// Creates the HTTP2ServerStream with the given request header fields,
+		/// which are moved into the stream.
+
+	Poco::UInt32 id() const;
+		/// Returns the stream identifier.
+
+	HTTP2ServerSession& session() const;
+		/// Returns the session the stream belongs to.
+
+	const HPACKHeaderList& headers() const;
+		/// Returns the header fields of the request.
+
+	int read(char* buffer, std::streamsize length);
+		/// Reads request body data, waiting for data if necessary.
+		/// Returns 0 at the end of the request body.
+
+	void write(const char* buffer, std::streamsize length, bool endStream);
+		/// Sends response body data in DATA frames, waiting
+		/// for the client's flow control window if necessary.
+
+	void sendHeaders(const HPACKHeaderList& headers, bool endStream);
+		/// Sends a header block (response header or trailer).
+
+	void sendResponse(const HPACKHeaderList& headers, const char* pBody, std::size_t length);
+		/// Sends the response header, followed by the given response body,
+		/// and ends the stream.
+
+	void run();
+		/// Processes the request by invoking the request handler.
+
+protected:
+	~HTTP2ServerStream();
+
+private:
+	HTTP2ServerSession& _session;
+	Poco::UInt32 _id;
+	HPACKHeaderList _headers;
+
+	// The following members are protected by the session's mutex.
+	std::string _data;
+	std::size_t _dataOffset;
+	Poco::Int64 _sendWindow;
+	Poco::Int64 _recvWindow;
+	Poco::UInt32 _recvUnacked;
+	bool _remoteClosed;
+	bool _localClosed;
+	bool _reset;
+	Poco::Condition _dataAvailable;
+
+	friend class HTTP2ServerSession;
+};
+
+
+class Net_API HTTP2ServerSession
+	/// This class implements the server side of an HTTP/2 connection
+	/// (RFC 9113).
+	///
+	/// Every request stream is mapped to a HTTPServerRequest and
+	/// HTTPServerResponse pair, which is passed to a HTTPRequestHandler
+	/// created by the HTTPRequestHandlerFactory, just like HTTP/1.x
+	/// requests, so that existing request handlers can be used without
+	/// changes. Header fields are compressed with HPACK.
+	///
+	/// The connection's thread reads and processes incoming frames,
+	/// while request handlers run in a thread pool, which is usually
+	/// shared by all connections of the server, so that multiple requests
+	/// on the same connection are handled concurrently. The number of
+	/// concurrent streams is limited by HTTPServerParams::getHTTP2MaxConcurrentStreams().
+	/// Further streams, as well as streams for which no thread is available
+	/// in the thread pool, are refused (REFUSED_STREAM), so that the client
+	/// can retry them later.
+	///
+	/// Request and response bodies are subject to HTTP/2 flow control.
+	/// Data received for a request is buffered until it is read by the
+	/// request handler, up to the stream's flow control window.
+	/// A request handler sending a response body waits if the client's
+	/// flow control window is exhausted.
+	///
+	/// Server push and stream priorities are not supported.
+	///
+	/// HTTPServerConnection uses a HTTP2ServerSession if HTTP/2 has
+	/// been enabled with HTTPServerParams::setHTTP2Enabled() and the
+	/// client starts the connection with the HTTP/2 client connection
+	/// preface. Upgrading a HTTP/1.1 connection to HTTP/2 (h2c upgrade)
+	/// is not supported.
+{
+public:
+	HTTP2ServerSession(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory, Poco::ThreadPool& threadPool);
+		/// Creates the HTTP2ServerSession for the given connection.
+		///
+		/// Request handlers are run by the given thread pool, which
+		/// must outlive the HTTP2ServerSession.
+
+	~HTTP2ServerSession();
+		/// Destroys the HTTP2ServerSession.
+
+	void run();
+		/// Processes frames until
+		/// the connection is closed by the client, the connection has been
+		/// idle for longer than the keep-alive timeout, an error occurs or
+		/// the session is stopped. Waits for all request handlers to complete
+		/// before returning.
+
+	void stop(bool abortCurrent);
+		/// Stops the session. If abortCurrent is false, the client is informed
+		/// with a GOAWAY frame that no more streams will be accepted, and the
+		/// session ends after all current requests have been handled.
+		/// Otherwise, the connection is shut down immediately.
+		///
+		/// May be called from any thread.
+
+	const SocketAddress& clientAddress() const;
+		/// Returns the client's address.
+
+	const SocketAddress& serverAddress() const;
+		/// Returns the server's address.
+
+	bool secure() const;
+		/// Returns true if the connection is secure.
+
+	const HTTPServerParams& serverParams() const;
+		/// Returns the server parameters.
+
+	static bool readConnectionPreface(StreamSocket& socket, std::string& data);
+		/// Reads data from the socket as long as it matches the start
+		/// of the HTTP/2 client connection preface, and returns true if
+		/// the complete preface has been received. The connection can then
+		/// be handled by a HTTP2ServerSession.
+		///
+		/// Otherwise, returns false, and data contains the bytes read so far,
+		/// which must be passed on to the HTTP/1.x session (see HTTPSession::unread()).
+		/// No data following the preface is read. Every read waits up
+		/// to the socket's receive timeout.
+
+protected:
+	enum
+	{
+		STREAM_WINDOW_SIZE     = 256*1024,
+		CONNECTION_WINDOW_SIZE = 16*1024*1024,
+		MAX_HEADER_BLOCK_SIZE  = 256*1024,
+		READ_BUFFER_SIZE       = 64*1024
+	};
+
+	void processStream(HTTP2ServerStream& stream);
+	int readData(HTTP2ServerStream& stream, char* buffer, std::streamsize length);
+	void sendData(HTTP2ServerStream& stream, const char* buffer, std::size_t length, bool endStream);
+	void sendHeaders(HTTP2ServerStream& stream, const HPACKHeaderList& headers, bool endStream);
+	void sendResponse(HTTP2ServerStream& stream, const HPACKHeaderList& headers, const char* pBody, std::size_t length);
+
+private:
+	bool readFrame(HTTP2Frame& frame);
+	bool fill(std::size_t length);
+	void handleFrame(const HTTP2Frame& frame, const char* pPayload);
+	void handleData(const HTTP2Frame& frame, const char* pPayload);
+	void handleHeaders(const HTTP2Frame& frame, const char* pPayload);
+	void handleContinuation(const HTTP2Frame& frame, const char* pPayload);
+	void handleHeaderBlock(Poco::UInt32 streamId, bool endStream);
+	void handleRstStream(const HTTP2Frame& frame, const char* pPayload);
+	void handleSettings(const HTTP2Frame& frame, const char* pPayload);
+	void handlePing(const HTTP2Frame& frame, const char* pPayload);
+	void handleGoAway(const HTTP2Frame& frame, const char* pPayload);
+	void handleWindowUpdate(const HTTP2Frame& frame, const char* pPayload);
+	void startStream(Poco::UInt32 streamId, HPACKHeaderList& headers, bool endStream);
+	void streamFinished(HTTP2ServerStream& stream);
+	void streamThreadFinished();
+	void resetStream(Poco::UInt32 streamId, HTTP2Frame::ErrorCode error);
+	void sendSettings();
+	void sendWindowUpdate(Poco::UInt32 streamId, Poco::UInt32 increment);
+	void sendGoAway(HTTP2Frame::ErrorCode error);
+	void appendHeaderFrames(std::string& buffer, Poco::UInt32 streamId, const HPACKHeaderList& headers, bool endStream);
+	void appendDataFrames(std::string& buffer, Poco::UInt32 streamId, const char* pData, std::size_t length, bool endStream);
+	void sendFrames(const std::string& frames);
+	void close();
+	static bool isValidRequest(const HPACKHeaderList& headers);
+
+	StreamSocket _socket;
+	HTTPServerParams::Ptr _pParams;
+	HTTPRequestHandlerFactory::Ptr _pFactory;
+	SocketAddress _clientAddress;
+	SocketAddress _serverAddress;
+	bool _secure;
+	Poco::Timespan _timeout;
+	Poco::ThreadPool& _threadPool;
+
+	// used by the connection thread only
+	Poco::Buffer<char> _readBuffer;
+	std::size_t _readOffset;
+	std::size_t _readEnd;
+	HPACKDecoder _decoder;
+	std::string _headerBlock;
+	Poco::UInt32 _headerStreamId;
+	bool _headerEndStream;
+	Poco::UInt32 _lastStreamId;
+	Poco::UInt32 _connectionRecvUnacked;
+
+	// protected by _mutex
+	std::map<Poco::UInt32, HTTP2ServerStream::Ptr> _streams;
+	Poco::Int64 _sendWindow;
+	Poco::Int64 _peerInitialWindowSize;
+	bool _goingAway;
+	bool _goAwaySent;
+	bool _closed;
+	int _runningStreams;
+	Poco::Mutex _mutex;
+	Poco::Condition _windowAvailable;
+	Poco::Condition _streamsFinished;
+
+	// protected by _writeMutex
+	HPACKEncoder _encoder;
+	Poco::FastMutex _writeMutex;
+
+	std::atomic<Poco::UInt32> _peerMaxFrameSize;
+
+	friend class HTTP2ServerStream;
+};
+
+
+//
+// inlines
+//
+inline Poco::UInt32 HTTP2ServerStream::id() const
+{
+	return _id;
+}
+
+
+inline HTTP2ServerSession& HTTP2ServerStream::session() const
+{
+	return _session;
+}
+
+
+inline const HPACKHeaderList& HTTP2ServerStream::headers() const
+{
+	return _headers;
+}
+
+
+inline const SocketAddress& HTTP2ServerSession::clientAddress() const
+{
+	return _clientAddress;
+}
+
+
+inline const SocketAddress& HTTP2ServerSession::serverAddress() const
+{
+	return _serverAddress;
+}
+
+
+inline bool HTTP2ServerSession::secure() const
+{
+	return _secure;
+}
+
+
+inline const HTTPServerParams& HTTP2ServerSession::serverParams() const
+{
+	return *_pParams;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTP2ServerSession_INCLUDED
@@ -0,0 +1,97 @@
+//
+// HTTP2Stream.h
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2Stream
+//
+// Definition of the HTTP2StreamBuf, HTTP2InputStream and HTTP2OutputStream classes.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTP2Stream_INCLUDED
+#define Net_HTTP2Stream_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/BufferedStreamBuf.h"
+#include <istream>
+#include <ostream>
+
+
+namespace Poco {
+namespace Net {
+
+
+class HTTP2ServerStream;
+
+
+class Net_API HTTP2StreamBuf: public Poco::BufferedStreamBuf
+	/// This is the streambuf class used for reading request bodies
+	/// from, and writing response bodies to HTTP/2 streams.
+	///
+	/// Written data is sent in DATA frames of up to the
+	/// default maximum frame size.
+{
+public:
+	using openmode = Poco::BufferedStreamBuf::openmode;
+
+	HTTP2StreamBuf(HTTP2ServerStream& stream, openmode mode);
+		/// Creates the HTTP2StreamBuf.
+
+	~HTTP2StreamBuf();
+		/// Destroys the HTTP2StreamBuf.
+
+	void close(bool endStream);
+		/// Sends any buffered data. If endStream is true,
+		/// the last DATA frame ends the stream.
+
+protected:
+	std::streamsize readFromDevice(char* buffer, std::streamsize length);
+	std::streamsize writeToDevice(const char* buffer, std::streamsize length);
+
+private:
+	HTTP2ServerStream& _stream;
+};
+
+
+class Net_API HTTP2IOS: public virtual std::ios
+	/// The base class for HTTP2InputStream and HTTP2OutputStream.
+{
+public:
+	HTTP2IOS(HTTP2ServerStream& stream, HTTP2StreamBuf::openmode mode);
+	~HTTP2IOS();
+	HTTP2StreamBuf* rdbuf();
+
+protected:
+	HTTP2StreamBuf _buf;
+};
+
+
+class Net_API HTTP2InputStream: public HTTP2IOS, public std::istream
+	/// This class is for internal use by HTTP2ServerRequestImpl only.
+{
+public:
+	HTTP2InputStream(HTTP2ServerStream& stream);
+	~HTTP2InputStream();
+};
+
+
+class Net_API HTTP2OutputStream: public HTTP2IOS, public std::ostream
+	/// This class is for internal use by HTTP2ServerResponseImpl only.
+{
+public:
+	HTTP2OutputStream(HTTP2ServerStream& stream);
+	~HTTP2OutputStream();
+};
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTP2Stream_INCLUDED
@@ -366,6 +366,10 @@ protected:
 		/// Calls proxyConnect() and attaches the resulting StreamSocket
 		/// to the HTTPClientSession.
 
+	void readResponseHeader(HTTPResponse& response);
+		/// Reads the status line and header of the next response
+		/// from the connection's buffer and parses it.
+
 private:
 	using OStreamPtr = Poco::SharedPtr<std::ostream>;
 	using IStreamPtr = Poco::SharedPtr<std::istream>;
@@ -395,6 +399,7 @@ private:
 	HTTPClientSession& operator = (const HTTPClientSession&);
 
 	friend class WebSocket;
+	friend class HTTPClientSessionPool;
 };
 
 
@@ -0,0 +1,288 @@
+//
+// HTTPClientSessionPool.h
+//
+// Library: Net
+// Package: HTTPClient
+// Module:  HTTPClientSessionPool
+//
+// Definition of the HTTPClientSessionPool class.
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_HTTPClientSessionPool_INCLUDED
+#define Net_HTTPClientSessionPool_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Mutex.h"
+#include "Poco/Condition.h"
+#include "Poco/Timespan.h"
+#include "Poco/Timestamp.h"
+#include "Poco/URI.h"
+#include <map>
+#include <memory>
+#include <vector>
+
+
+namespace Poco {
+namespace Net {
+
+
+class HTTPSessionFactory;
+
+
+class Net_API HTTPClientSessionPool
+	/// A pool of persistent HTTPClientSession objects.
+	///
+	/// Sessions are keyed by scheme, host, port and proxy
+	/// configuration, so that a session obtained from the pool
+	/// is always connected (or about to be connected) to the
+	/// same origin server over the same route. This is especially
+	/// useful for HTTPS, where the TLS handshake often costs more
+	/// than the request itself.
+	///
+	/// Sessions are created by a HTTPSessionFactory. For the
+	/// "https" scheme, the HTTPSSessionInstantiator from the
+	/// NetSSL library must have been registered with the factory.
+	/// For the "http" scheme, a plain HTTPClientSession is created
+	/// if the factory has no instantiator registered.
+	///
+	/// The number of sessions (in use and idle) per key is limited.
+	/// If the limit has been reached, get() waits until another
+	/// session is returned to the pool, or the given timeout expires.
+	///
+	/// Idle sessions are evicted once they have been idle longer
+	/// than the keep-alive timeout, which is also set on every
+	/// session created by the pool (see HTTPClientSession::setKeepAliveTimeout()).
+	/// Before a session is handed out again, it is validated: it must
+	/// still be connected, must not require a reconnect (see
+	/// HTTPClientSession::mustReconnect()), and the server must not
+	/// have closed the connection in the meantime.
+	///
+	/// Sessions are handed out wrapped in a HTTPClientSessionPool::Session
+	/// object, which returns the session to the pool when it is
+	/// destroyed. A session should only be returned to the pool after
+	/// the response body has been read completely. If something went
+	/// wrong, call Session::discard() so that the session is closed
+	/// instead of being reused.
+	///
+	/// The pool must outlive all Session objects obtained from it.
+{
+public:
+	enum
+	{
+		DEFAULT_MAX_SESSIONS_PER_HOST = 8,
+		DEFAULT_KEEP_ALIVE_TIMEOUT    = 8
+	};
+
+	struct Statistics
+		/// Pool statistics, as returned by statistics().
+	{
+		Statistics();
+
+		Poco::UInt64 created;
+			/// Number of sessions created.
+		Poco::UInt64 reused;
+			/// Number of times an idle session has been handed out again.
+		Poco::UInt64 returned;
+			/// Number of sessions returned to the idle list.
+		Poco::UInt64 discarded;
+			/// Number of sessions closed when returned, or because
+			/// they failed validation.
+		Poco::UInt64 evicted;
+			/// Number of idle sessions closed because the keep-alive
+			/// timeout expired.
+		Poco::UInt64 waits;
+			/// Number of times get() had to wait for a session.
+		Poco::UInt64 timeouts;
+			/// Number of times get() failed because the per-host
+			/// limit was reached.
+		std::size_t  idle;
+			/// Current number of idle sessions.
+		std::size_t  active;
+			/// Current number of sessions in use.
+	};
+
+	class Net_API Session
+		/// A handle for a HTTPClientSession obtained from
+		/// the pool. Returns the session to the pool
+		/// when destroyed.
+	{
+	public:
+		Session();
+			/// Creates an empty Session.
+
+		Session(Session&& other) noexcept;
+			/// Takes over the session from other.
+
+		Session& operator = (Session&& other) noexcept;
+			/// Returns the current session (if any) to the pool and
+			/// takes over the session from other.
+
+		~Session();
+			/// Returns the session to the pool.
+
+		HTTPClientSession& operator * () const;
+			/// Returns the session. Throws a NullPointerException
+			/// if the Session is empty.
+
+		HTTPClientSession* operator -> () const;
+			/// Returns the session. Throws a NullPointerException
+			/// if the Session is empty.
+
+		HTTPClientSession* get() const;
+			/// Returns the session, or a null pointer if the Session is empty.
+
+		bool isNull() const;
+			/// Returns true iff the Session is empty.
+
+		void release();
+			/// Returns the session to the pool. Afterwards, the Session is empty.
+
+		void discard();
+			/// Closes the session and removes it from the pool.
+			/// Afterwards, the Session is empty.
+
+	private:
+		Session(HTTPClientSessionPool* pPool, const std::string& key, std::unique_ptr<HTTPClientSession>&& pSession);
+
+		Session(const Session&);
+		Session& operator = (const Session&);
+
+		HTTPClientSessionPool* _pPool;
+		std::string _key;
+		std::unique_ptr<HTTPClientSession> _pSession;
+
+		friend class HTTPClientSessionPool;
+	};
+
+	explicit HTTPClientSessionPool(std::size_t maxSessionsPerHost = DEFAULT_MAX_SESSIONS_PER_HOST, const Poco::Timespan& keepAliveTimeout = Poco::Timespan(DEFAULT_KEEP_ALIVE_TIMEOUT, 0));
+		/// Creates the HTTPClientSessionPool, using the default HTTPSessionFactory.
+
+	HTTPClientSessionPool(HTTPSessionFactory& factory, std::size_t maxSessionsPerHost = DEFAULT_MAX_SESSIONS_PER_HOST, const Poco::Timespan& keepAliveTimeout = Poco::Timespan(DEFAULT_KEEP_ALIVE_TIMEOUT, 0));
+		/// Creates the HTTPClientSessionPool, using the given HTTPSessionFactory.
+		/// The factory must outlive the pool.
+
+	~HTTPClientSessionPool();
+		/// Destroys the HTTPClientSessionPool and closes all idle sessions.
+
+	Session get(const Poco::URI& uri, const Poco::Timespan& timeout = 0);
+		/// Returns a session for the scheme, host and port of the given URI.
+		///
+		/// An idle session is reused if one passes validation, otherwise a
+		/// new session is created. If the maximum number of sessions for the
+		/// host has been reached, waits up to timeout for a session to be
+		/// returned and throws a Poco::TimeoutException if none becomes available.
+
+	Session get(const std::string& scheme, const std::string& host, Poco::UInt16 port, const Poco::Timespan& timeout = 0);
+		/// Returns a session for the given scheme, host and port.
+		/// See get(const Poco::URI&, const Poco::Timespan&).
+
+	std::size_t purge();
+		/// Closes all idle sessions whose keep-alive timeout has expired.
+		/// Returns the number of sessions closed.
+		///
+		/// Expired sessions are also evicted whenever sessions for the
+		/// same host are obtained or returned; calling this periodically
+		/// is only needed to release connections to hosts no longer used.
+
+	void clear();
+		/// Closes all idle sessions.
+
+	Statistics statistics() const;
+		/// Returns the current pool statistics.
+
+	std::size_t maxSessionsPerHost() const;
+		/// Returns the maximum number of sessions per host.
+
+	const Poco::Timespan& getKeepAliveTimeout() const;
+		/// Returns the keep-alive timeout for idle sessions.
+
+protected:
+	virtual bool isReusable(HTTPClientSession& session) const;
+		/// Returns true if the given idle session can be handed out again.
+		///
+		/// The default implementation checks that the session is connected,
+		/// that HTTPClientSession::mustReconnect() returns false, and that the
+		/// socket is not readable (which would mean that the server has either
+		/// closed the connection or sent unexpected data).
+
+	virtual HTTPClientSession* createSession(const Poco::URI& uri);
+		/// Creates a new session for the given URI.
+
+	void putBack(const std::string& key, std::unique_ptr<HTTPClientSession>&& pSession, bool discard);
+		/// Returns a session to the pool, or closes it if discard is true
+		/// or the session cannot be kept alive.
+
+private:
+	struct IdleSession
+	{
+		HTTPClientSession* pSession;
+		Poco::Timestamp    since;
+	};
+
+	struct HostEntry
+	{
+		HostEntry();
+
+		std::vector<IdleSession> idle;
+		std::size_t active;
+	};
+
+	using HostMap = std::map<std::string, HostEntry>;
+
+	std::string sessionKey(const Poco::URI& uri) const;
+	std::size_t evictExpired(HostEntry& entry, const Poco::Timestamp& now);
+
+	HTTPClientSessionPool(const HTTPClientSessionPool&);
+	HTTPClientSessionPool& operator = (const HTTPClientSessionPool&);
+
+	HTTPSessionFactory& _factory;
+	std::size_t         _maxSessionsPerHost;
+	Poco::Timespan      _keepAliveTimeout;
+	HostMap             _hosts;
+	Statistics          _stats;
+	mutable Poco::Mutex _mutex;
+	Poco::Condition     _available;
+
+	friend class Session;
+};
+
+
+//
+// inlines
+//
+inline HTTPClientSession* HTTPClientSessionPool::Session::get() const
+{
+	return _pSession.get();
+}
+
+
+inline bool HTTPClientSessionPool::Session::isNull() const
+{
+	return !_pSession;
+}
+
+
+inline std::size_t HTTPClientSessionPool::maxSessionsPerHost() const
+{
+	return _maxSessionsPerHost;
+}
+
+
+inline const Poco::Timespan& HTTPClientSessionPool::getKeepAliveTimeout() const
+{
+	return _keepAliveTimeout;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_HTTPClientSessionPool_INCLUDED
@@ -9,11 +9,28 @@
 #include "Poco/Net/HTTPSession.h"
 #include "Poco/Net/TCPReactorServer.h"
 #include "Poco/ThreadPool.h"
+#include "Poco/NotificationQueue.h"
+#include "Poco/RunnableAdapter.h"
+#include "Poco/Mutex.h"
+#include <atomic>
+#include <map>
 namespace Poco {
 namespace Net {
 
 
+class HTTPReactorServerSession;
+
+
 class Net_API HTTPReactorServer
+	/// A HTTP server based on TCPReactorServer.
+	///
+	/// Requests are framed in place in the connection buffer.
+	/// All complete (pipelined) requests in the buffer are handled
+	/// in order, and their responses are sent with a single write.
+	///
+	/// By default, request handlers run on the reactor threads.
+	/// If HTTPServerParams::setReactorWorkerDispatch() is enabled,
+	/// they run on a pool of maxThreads worker threads instead.
 {
 public:
 	HTTPReactorServer(int port, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory);
@@ -26,11 +43,40 @@ public:
 	void sendErrorResponse(HTTPSession& session, HTTPResponse::HTTPStatus status);
 
 private:
+	void processRequests(const StreamSocket& socket, std::string& buf);
+		/// Handles all complete requests in buf and sends the responses.
+
+	void handleRequest(HTTPReactorServerSession& session);
+		/// Handles the current request of the session.
+
+	void dispatch(const TcpReactorConnectionPtr& conn);
+		/// Moves all complete requests out of the connection buffer
+		/// and schedules them for processing by a worker thread.
+
+	void processConnection(const TcpReactorConnectionPtr& conn);
+		/// Processes the requests scheduled for the connection.
+
+	void runWorker();
+		/// Worker thread loop.
+
+	struct PendingRequests
+	{
+		TcpReactorConnectionPtr connection;
+		std::string             data;
+	};
+	using PendingMap = std::map<TCPReactorServerConnection*, PendingRequests>;
+
 	TCPReactorServer               _tcpReactorServer;
 	HTTPServerParams::Ptr          _pParams;
 	HTTPRequestHandlerFactory::Ptr _pFactory;
+	const std::string              _softwareVersion;
 
-	ThreadPool _threadPool;
+	ThreadPool                         _threadPool;
+	NotificationQueue                  _queue;
+	RunnableAdapter<HTTPReactorServer> _worker;
+	PendingMap                         _pending;
+	FastMutex                          _pendingMutex;
+	std::atomic<bool>                  _stopped;
 };
 
 }} // namespace Poco::Net
@@ -35,8 +35,21 @@ public:
 	/// Returns the server's address.
 
 	bool checkRequestComplete();
+	/// Returns true if the buffer contains a complete request
+	/// (header and body) at the current position.
+	///
+	/// Framing is done in place: the header block is scanned
+	/// through std::string_view, without copying the buffer.
 
 	void popCompletedRequest();
+	/// Removes the completed request from the buffer, so that
+	/// a subsequent pipelined request can be processed.
+
+	void setOutputBuffer(std::string* pOutput);
+	/// If pOutput is not null, response data is appended
+	/// to the given string instead of being sent to the socket
+	/// immediately. This allows the responses to several
+	/// pipelined requests to be sent with a single write.
 
 private:
 	int get() override;
@@ -47,19 +60,32 @@ private:
 
 	int write(const char* buffer, std::streamsize length) override;
 
+	bool readHeader(std::string& buffer, std::size_t maxSize, const char*& pBegin, const char*& pEnd) override;
+
 	bool parseHeaders(std::size_t pos, std::size_t& bodyStart, std::size_t& contentLength, bool& isChunked);
 
-	bool parseChunkSize(std::size_t& pos, std::size_t& chunkSize, int&);
+	bool parseChunkSize(std::size_t& pos, std::size_t& chunkSize, std::size_t& complete);
 
 private:
 	std::string&   _buf;
 	char*          _pcur{nullptr};
 	char*          _pend{nullptr};
-	int            _idx{0};
-	int            _complete{0};
+	std::size_t    _idx{0};
+	std::size_t    _complete{0};
+	std::string*   _pOutput{nullptr};
 	StreamSocket   _realsocket;
 };
 
+
+//
+// inlines
+//
+inline void HTTPReactorServerSession::setOutputBuffer(std::string* pOutput)
+{
+	_pOutput = pOutput;
+}
+
+
 }} // namespace Poco::Net
 
 #endif // Net_HTTPReactorServerSession_INCLUDED
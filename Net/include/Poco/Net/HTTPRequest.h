@@ -146,6 +146,21 @@ public:
 		/// Reads the HTTP request from the
 		/// given input stream.
 
+	const char* parse(const char* pBegin, const char* pEnd);
+		/// Parses the HTTP request line and header from the
+		/// given buffer, which should contain the complete
+		/// header, including the terminating empty line.
+		/// Returns a pointer to the first character after
+		/// the header.
+		///
+		/// The format, limits and error handling are the same
+		/// as for read(). See MessageHeader::parse() for more
+		/// information.
+
+	std::size_t getHeaderSizeLimit() const override;
+		/// Returns the maximum size of the request line and
+		/// header. See MessageHeader::getHeaderSizeLimit().
+
 	static const std::string HTTP_GET;
 	static const std::string HTTP_HEAD;
 	static const std::string HTTP_PUT;
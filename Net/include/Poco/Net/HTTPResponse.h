@@ -204,6 +204,21 @@ public:
 		///
 		/// 100 Continue responses are ignored.
 
+	const char* parse(const char* pBegin, const char* pEnd);
+		/// Parses the HTTP status line and response header from
+		/// the given buffer, which should contain the complete
+		/// header, including the terminating empty line.
+		/// Returns a pointer to the first character after
+		/// the header.
+		///
+		/// The format, limits and error handling are the same
+		/// as for read(). See MessageHeader::parse() for more
+		/// information.
+
+	std::size_t getHeaderSizeLimit() const override;
+		/// Returns the maximum size of the status line and
+		/// header. See MessageHeader::getHeaderSizeLimit().
+
 	static const std::string& getReasonForStatus(HTTPStatus status);
 		/// Returns an appropriate reason phrase
 		/// for the given status code.
@@ -43,6 +43,9 @@ class Net_API HTTPServer: public TCPServer
 	///   - automatic handling of persistent connections.
 	///   - automatic decoding/encoding of request/response message bodies
 	///     using chunked transfer encoding.
+	///   - HTTP/2 (with prior knowledge, or negotiated via ALPN on a
+	///     SecureServerSocket), if enabled with HTTPServerParams::setHTTP2Enabled().
+	///     See HTTP2ServerSession for details.
 	///
 	/// Please see the TCPServer class for information about
 	/// connection and thread handling.
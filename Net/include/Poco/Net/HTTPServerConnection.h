@@ -23,6 +23,7 @@
 #include "Poco/Net/HTTPResponse.h"
 #include "Poco/Net/HTTPRequestHandlerFactory.h"
 #include "Poco/Net/HTTPServerParams.h"
+#include "Poco/ThreadPool.h"
 #include "Poco/Mutex.h"
 #include <atomic>
 
@@ -32,15 +33,31 @@ namespace Net {
 
 
 class HTTPServerSession;
+class HTTP2ServerSession;
 
 
 class Net_API HTTPServerConnection: public TCPServerConnection
 	/// This subclass of TCPServerConnection handles HTTP
 	/// connections.
+	///
+	/// If HTTP/2 has been enabled in the HTTPServerParams and the
+	/// client starts the connection with the HTTP/2 connection preface
+	/// ("prior knowledge", or after negotiating "h2" with ALPN on a
+	/// secure connection), the connection is handled by a HTTP2ServerSession.
 {
 public:
 	HTTPServerConnection(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory);
 		/// Creates the HTTPServerConnection.
+		///
+		/// Requests on a HTTP/2 connection are handled by
+		/// the default thread pool.
+
+	HTTPServerConnection(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory, Poco::ThreadPool& http2ThreadPool);
+		/// Creates the HTTPServerConnection.
+		///
+		/// Requests on a HTTP/2 connection are handled by
+		/// the given thread pool, which is usually shared by all
+		/// connections of the server.
 
 	virtual ~HTTPServerConnection();
 		/// Destroys the HTTPServerConnection.
@@ -49,6 +66,7 @@ public:
 		/// Handles all HTTP requests coming in.
 
 protected:
+	void runHTTP2();
 	void sendErrorResponse(HTTPServerSession& session, HTTPResponse::HTTPStatus status);
 	void onServerStopped(const bool& abortCurrent);
 
@@ -57,6 +75,9 @@ private:
 	HTTPRequestHandlerFactory::Ptr _pFactory;
 	std::atomic<bool> _stopped;
 	Poco::FastMutex _mutex;
+	Poco::ThreadPool& _http2ThreadPool;
+	HTTP2ServerSession* _pHTTP2Session;
+	Poco::FastMutex _http2Mutex;
 };
 
 
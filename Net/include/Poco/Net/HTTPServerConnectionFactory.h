@@ -22,6 +22,9 @@
 #include "Poco/Net/TCPServerConnectionFactory.h"
 #include "Poco/Net/HTTPRequestHandlerFactory.h"
 #include "Poco/Net/HTTPServerParams.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Mutex.h"
+#include <memory>
 
 
 namespace Poco {
@@ -31,6 +34,10 @@ namespace Net {
 class Net_API HTTPServerConnectionFactory: public TCPServerConnectionFactory
 	/// This implementation of a TCPServerConnectionFactory
 	/// is used by HTTPServer to create HTTPServerConnection objects.
+	///
+	/// If HTTP/2 is enabled, the factory also owns the thread pool
+	/// handling the requests (streams) of all HTTP/2 connections.
+	/// Its capacity is given by HTTPServerParams::getMaxThreads().
 {
 public:
 	HTTPServerConnectionFactory(HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory);
@@ -46,6 +53,8 @@ public:
 private:
 	HTTPServerParams::Ptr          _pParams;
 	HTTPRequestHandlerFactory::Ptr _pFactory;
+	std::unique_ptr<Poco::ThreadPool> _pHTTP2ThreadPool;
+	Poco::FastMutex _mutex;
 };
 
 
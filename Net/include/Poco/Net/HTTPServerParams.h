@@ -43,6 +43,8 @@ public:
 		///   - keepAlive:            true
 		///   - maxKeepAliveRequests: 0
 		///   - keepAliveTimeout:     10 seconds
+		///   - http2Enabled:         false
+		///   - http2MaxConcurrentStreams: 100
 
 	void setServerName(const std::string& serverName);
 		/// Sets the name and port (name:port) that the server uses to identify itself.
@@ -104,6 +106,46 @@ public:
 		/// Returns true if automatic conversion of HTTP header values
 		/// when reading HTTP header.
 
+	void setReactorWorkerDispatch(bool workerDispatch);
+		/// Only used by HTTPReactorServer. If true, request handlers
+		/// are executed by a pool of maxThreads (or, if not set, one per
+		/// processor) worker threads instead of the reactor threads, so that blocking handlers do not
+		/// stall other connections. Requests received on the same
+		/// connection are still handled, and answered, in order.
+		/// Default is false.
+
+	bool getReactorWorkerDispatch() const;
+		/// Returns true if HTTPReactorServer dispatches request
+		/// handlers to worker threads.
+
+	void setHTTP2Enabled(bool enabled);
+		/// Enables or disables HTTP/2 support in HTTPServer.
+		///
+		/// If enabled, a connection that starts with the HTTP/2
+		/// client connection preface is handled by a HTTP2ServerSession.
+		/// This is the case for clients that have negotiated "h2" via
+		/// ALPN on a secure connection (see Context::setALPNProtocols()
+		/// in the NetSSL library), and for clients using HTTP/2 with
+		/// prior knowledge ("h2c") on a plain connection. Other connections
+		/// use HTTP/1.x as before.
+		///
+		/// Default is false.
+
+	bool getHTTP2Enabled() const;
+		/// Returns true if HTTP/2 support is enabled.
+
+	void setHTTP2MaxConcurrentStreams(int maxStreams);
+		/// Sets the maximum number of concurrent streams (requests)
+		/// per HTTP/2 connection (SETTINGS_MAX_CONCURRENT_STREAMS).
+		/// Every stream being processed occupies a thread of a
+		/// thread pool shared by all HTTP/2 connections of the server,
+		/// which has a capacity of getMaxThreads() threads. Streams
+		/// for which no thread is available are refused.
+
+	int getHTTP2MaxConcurrentStreams() const;
+		/// Returns the maximum number of concurrent streams
+		/// per HTTP/2 connection.
+
 protected:
 	virtual ~HTTPServerParams();
 		/// Destroys the HTTPServerParams.
@@ -116,6 +158,9 @@ private:
 	int            _maxKeepAliveRequests;
 	Poco::Timespan _keepAliveTimeout;
 	bool           _autoDecodeHeaders;
+	bool           _reactorWorkerDispatch;
+	bool           _http2Enabled;
+	int            _http2MaxConcurrentStreams;
 };
 
 
@@ -164,6 +209,24 @@ inline bool HTTPServerParams::getAutoDecodeHeaders() const
 }
 
 
+inline bool HTTPServerParams::getReactorWorkerDispatch() const
+{
+	return _reactorWorkerDispatch;
+}
+
+
+inline bool HTTPServerParams::getHTTP2Enabled() const
+{
+	return _http2Enabled;
+}
+
+
+inline int HTTPServerParams::getHTTP2MaxConcurrentStreams() const
+{
+	return _http2MaxConcurrentStreams;
+}
+
+
 } } // namespace Poco::Net
 
 
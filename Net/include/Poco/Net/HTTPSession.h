@@ -131,6 +131,16 @@ public:
 		/// obtain any data already read from the socket, but not
 		/// yet processed.
 
+	void unread(const char* buffer, std::size_t length);
+		/// Puts the given data in front of the data in the internal buffer,
+		/// so that it is read before any further data received from
+		/// the socket.
+		///
+		/// This is used to hand over data that has already been read
+		/// from the socket, e.g. to detect the protocol, to the session.
+		/// Throws an InvalidArgumentException if the data does not fit
+		/// into the internal buffer.
+
 	const MessageHeader& requestTrailer() const;
 		/// Returns the trailer for a request sent using chunked
 		/// transfer encoding. This method must be called after
@@ -193,6 +203,24 @@ protected:
 	virtual int write(const char* buffer, std::streamsize length);
 		/// Writes data to the socket.
 
+	virtual bool readHeader(std::string& buffer, std::size_t maxSize, const char*& pBegin, const char*& pEnd);
+		/// Reads a complete message header (start line and header
+		/// fields, including the terminating empty line), skipping
+		/// leading white space, and stores its location in pBegin
+		/// and pEnd.
+		///
+		/// If the header is contained in the session's buffer, it is
+		/// parsed in place. Otherwise, it is assembled in the given
+		/// buffer. In both cases, the header is only valid until the
+		/// next read operation on the session.
+		///
+		/// If the connection is closed before the end of the header,
+		/// the data received so far is returned. Returns false if the
+		/// connection has been closed before any data has been received.
+		///
+		/// Throws a MessageException if maxSize is not 0 and the
+		/// header is larger than maxSize bytes.
+
 	int receive(char* buffer, int length);
 		/// Reads up to length bytes.
 
@@ -250,6 +278,7 @@ private:
 	friend class HTTPHeaderStreamBuf;
 	friend class HTTPFixedLengthStreamBuf;
 	friend class HTTPChunkedStreamBuf;
+	friend class HTTPServerRequestImpl;
 };
 
 
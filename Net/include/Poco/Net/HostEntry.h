@@ -52,6 +52,9 @@ public:
 	HostEntry(const std::string& name, const IPAddress& addr);
 #endif
 
+	HostEntry(const std::string& name, const AddressList& addresses, const AliasList& aliases = AliasList());
+		/// Creates the HostEntry from the given name, addresses and aliases.
+
 	HostEntry(const HostEntry& entry);
 		/// Creates the HostEntry by copying another one.
 
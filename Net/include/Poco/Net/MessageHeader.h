@@ -87,6 +87,30 @@ public:
 		/// Throws a MessageException if the input stream is
 		/// malformed.
 
+	const char* parse(const char* pBegin, const char* pEnd);
+		/// Parses the message header from the given buffer, which
+		/// should contain the complete header, including the terminating
+		/// empty line.
+		///
+		/// Returns a pointer to the first character after the
+		/// empty line, or pEnd if the buffer does not contain one.
+		///
+		/// The format, limits and error handling are the same as
+		/// for read(), but the buffer is scanned for delimiters
+		/// with MessageHeaderScanner and every header field is
+		/// added to the collection without intermediate copies,
+		/// which is much faster than reading from a stream.
+
+	virtual std::size_t getHeaderSizeLimit() const;
+		/// Returns the maximum size in bytes of a message header
+		/// that does not exceed the field, name and value length
+		/// limits, allowing some white space around values.
+		/// Subclasses add the maximum size of their start line.
+		/// This is used to limit buffering if a header is read
+		/// in one piece for parse().
+		///
+		/// Returns 0 if the number of fields is unlimited.
+
 	void setAutoDecode(bool convert);
 		/// Enables or disables automatic conversion of HTTP header values
 		/// when reading HTTP header.
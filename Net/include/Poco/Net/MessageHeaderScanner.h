@@ -0,0 +1,70 @@
+//
+// MessageHeaderScanner.h
+//
+// Library: Net
+// Package: Messages
+// Module:  MessageHeaderScanner
+//
+// Definition of the MessageHeaderScanner class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Net_MessageHeaderScanner_INCLUDED
+#define Net_MessageHeaderScanner_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+class Net_API MessageHeaderScanner
+	/// This class locates delimiters in message headers held
+	/// in memory, as used by MessageHeader::parse(),
+	/// HTTPRequest::parse() and HTTPResponse::parse().
+	///
+	/// Data is examined 16 or 32 bytes at a time, using SSE2
+	/// or AVX2 on x86-64 and NEON on ARM64. The implementation
+	/// is chosen at runtime, based on the features of the CPU.
+	/// On other platforms, a portable implementation is used.
+{
+public:
+	static const char* find(const char* pBegin, const char* pEnd, char c);
+		/// Returns a pointer to the first occurrence of c in
+		/// the range [pBegin, pEnd), or pEnd if there is none.
+
+	static const char* find(const char* pBegin, const char* pEnd, char c1, char c2);
+		/// Returns a pointer to the first occurrence of c1 or c2 in
+		/// the range [pBegin, pEnd), or pEnd if there is none.
+
+	static const char* findSpace(const char* pBegin, const char* pEnd);
+		/// Returns a pointer to the first white space character
+		/// (as determined by Poco::Ascii::isSpace()) in the range
+		/// [pBegin, pEnd), or pEnd if there is none.
+
+	static const char* findHeaderEnd(const char* pBegin, const char* pEnd);
+		/// Searches the range [pBegin, pEnd) for an empty line
+		/// (\r\n or \n) following a line feed, which ends a
+		/// message header.
+		///
+		/// Returns a pointer to the first character after the
+		/// empty line, or a null pointer if the range does not
+		/// contain the end of the header.
+
+	static const char* implementation();
+		/// Returns the name of the implementation in use
+		/// ("AVX2", "SSE2", "NEON" or "generic").
+};
+
+
+} } // namespace Poco::Net
+
+
+#endif // Net_MessageHeaderScanner_INCLUDED
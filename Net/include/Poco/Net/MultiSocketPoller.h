@@ -53,7 +53,8 @@ public:
 		/// Creates the MutiSocketPoller.
 	{
 		poco_assert (_address.port() > 0 && _address.host().toString() != "0.0.0.0");
-		addSockets(serverParams.numberOfSockets());
+		_reader.setBatchSize(serverParams.batchSize());
+		addSockets(serverParams.numberOfSockets(), serverParams.udpGRO());
 	}
 
 	~MultiSocketPoller()
@@ -108,11 +109,12 @@ public:
 	}
 
 private:
-	void addSockets(int nSockets)
+	void addSockets(int nSockets, bool udpGRO = false)
 	{
 		for (int i = 0; i < nSockets; ++i)
 		{
 			DatagramSocket ds; ds.bind(_address, true, true);
+			if (udpGRO) ds.setUDPGRO(true);
 			_pollSet.add(ds, PollSet::POLL_READ | PollSet::POLL_ERROR);
 		}
 	}
@@ -74,6 +74,10 @@ public:
 	void add(const std::string& name, const std::string& value);
 		/// Adds a new name-value pair with the given name and value.
 
+	void add(std::string&& name, std::string&& value);
+		/// Adds a new name-value pair with the given name and value,
+		/// which are moved into the collection.
+
 	const std::string& get(const std::string& name) const;
 		/// Returns the value of the first name-value pair with the given name.
 		///
@@ -118,6 +122,9 @@ public:
 		/// Returns the number of name-value pairs in the
 		/// collection.
 
+	void reserve(std::size_t size);
+		/// Reserves room for the given number of name-value pairs.
+
 	void erase(const std::string& name);
 		/// Removes all name-value pairs with the given name.
 
@@ -203,6 +210,12 @@ inline std::size_t NameValueCollection::size() const
 }
 
 
+inline void NameValueCollection::reserve(std::size_t size)
+{
+	_map.reserve(size);
+}
+
+
 } } // namespace Poco::Net
 
 
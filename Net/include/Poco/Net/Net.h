@@ -149,4 +149,25 @@ POCO_NET_FORCE_SYMBOL(pocoNetworkInitializer)
 #endif
 
 
+//
+// Define POCO_HAVE_IO_URING if the Linux io_uring interface is available
+// at compile time. Whether it can actually be used is determined at runtime.
+// Define POCO_NET_NO_IO_URING to disable io_uring support altogether.
+//
+#if (POCO_OS == POCO_OS_LINUX) && !defined(POCO_NET_NO_IO_URING) && defined(__has_include)
+	#if __has_include(<linux/io_uring.h>)
+		#define POCO_HAVE_IO_URING 1
+	#endif
+#endif
+
+
+//
+// Define POCO_HAVE_MMSG if recvmmsg() and sendmmsg() are available
+// for batched datagram I/O. Define POCO_NET_NO_MMSG to disable them.
+//
+#if (POCO_OS == POCO_OS_LINUX) && !defined(POCO_NET_NO_MMSG)
+	#define POCO_HAVE_MMSG 1
+#endif
+
+
 #endif // Net_Net_INCLUDED
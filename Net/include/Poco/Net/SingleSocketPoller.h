@@ -49,6 +49,7 @@ public:
 	{
 		_socket.bind(serverParams.address(), false, false);
 		_socket.setBlocking(false);
+		if (serverParams.udpGRO()) _socket.setUDPGRO(true);
 	}
 
 	~SingleSocketPoller()
@@ -392,6 +392,37 @@ inline int SocketBufVecSize(const SocketBufVec& sbv)
 	return static_cast<int>(sz);
 }
 
+struct SocketDatagram
+	/// Describes a single datagram for batched datagram I/O.
+	/// See DatagramSocket::sendBatch() and DatagramSocket::receiveBatch().
+{
+	void* buffer = nullptr;
+		/// The data to send, or the buffer receiving the datagram.
+
+	int length = 0;
+		/// The number of bytes to send, or the size of the receive buffer.
+		/// After receiving, holds the number of bytes received.
+
+	struct sockaddr* pAddress = nullptr;
+		/// The destination address, or the buffer receiving the
+		/// sender address. May be null for a connected socket,
+		/// or if the sender address is not needed.
+
+	poco_socklen_t addressLength = 0;
+		/// The length of the destination address, or the size of
+		/// the address buffer. After receiving, holds the length
+		/// of the sender address.
+
+	int segmentSize = 0;
+		/// After receiving with UDP generic receive offload enabled,
+		/// holds the size of the segments if the kernel has coalesced
+		/// several datagrams from the same sender into the buffer
+		/// (all segments have this size, except the last one, which
+		/// may be shorter). Zero if the buffer holds a single datagram.
+};
+
+typedef std::vector<SocketDatagram> SocketDatagramVec;
+
 struct AddressFamily
 	/// AddressFamily::Family replaces the previously used IPAddress::Family
 	/// enumeration and is now used for IPAddress::Family and SocketAddress::Family.
@@ -59,6 +59,10 @@ public:
 		SELECT_ERROR = 4
 	};
 
+	static const int MAX_DATAGRAM_BATCH = 64;
+		/// The maximum number of datagrams received by a single
+		/// call to receiveBatch().
+
 	virtual SocketImpl* acceptConnection(SocketAddress& clientAddr);
 		/// Get the next completed connection from the
 		/// socket's completed connection queue.
@@ -279,6 +283,47 @@ public:
 		///
 		/// Returns the number of bytes received.
 
+	int sendBatch(const SocketDatagram* datagrams, int count, int flags = 0);
+		/// Sends up to count datagrams through the socket.
+		///
+		/// Uses a single sendmmsg() call per MAX_DATAGRAM_BATCH datagrams
+		/// on platforms supporting it (POCO_HAVE_MMSG), or one sendto()
+		/// call per datagram otherwise.
+		///
+		/// Returns the number of datagrams sent, which may be less than
+		/// count, or -1 if the socket is non-blocking and no datagram
+		/// could be sent without blocking.
+
+	int sendSegmented(const void* buffer, int length, int segmentSize, const SocketAddress& address, int flags = 0);
+		/// Sends the contents of buffer to the given address, split
+		/// into datagrams of segmentSize bytes (the last datagram may
+		/// be shorter).
+		///
+		/// On Linux, UDP generic segmentation offload (UDP_SEGMENT) is
+		/// used to pass all datagrams to the kernel in a single call.
+		/// If segmentation offload is not supported, or the buffer holds
+		/// more segments than the kernel accepts at once, the datagrams
+		/// are sent with sendBatch().
+		///
+		/// Returns the number of bytes sent, or -1 if the socket is
+		/// non-blocking and nothing could be sent without blocking.
+
+	int receiveBatch(SocketDatagram* datagrams, int count, int flags = 0);
+		/// Receives up to count datagrams (but no more than
+		/// MAX_DATAGRAM_BATCH) from the socket into the given
+		/// datagram buffers, using a single recvmmsg() call on
+		/// platforms supporting it (POCO_HAVE_MMSG). Otherwise,
+		/// a single datagram is received.
+		///
+		/// Waits for the first datagram if the socket is blocking,
+		/// but only receives further datagrams that are already
+		/// available.
+		///
+		/// Returns the number of datagrams received, or -1 if the
+		/// socket is non-blocking and no datagram is available.
+		/// The length, addressLength and segmentSize members of the
+		/// received datagrams are updated.
+
 	virtual void sendUrgent(unsigned char data);
 		/// Sends one byte of urgent data through
 		/// the socket.
@@ -475,6 +520,18 @@ public:
 	bool getBroadcast();
 		/// Returns the value of the SO_BROADCAST socket option.
 
+	void setUDPGRO(bool flag);
+		/// Enables or disables UDP generic receive offload (UDP_GRO)
+		/// on Linux. If enabled, the kernel may coalesce several
+		/// datagrams from the same sender into one buffer, which
+		/// must be large enough to hold them (see receiveBatch() and
+		/// SocketDatagram::segmentSize).
+		///
+		/// Does nothing on other platforms.
+
+	bool getUDPGRO();
+		/// Returns true if UDP generic receive offload is enabled.
+
 	virtual void setBlocking(bool flag);
 		/// Sets the socket in blocking mode if flag is true,
 		/// disables blocking mode if flag is false.
@@ -146,6 +146,20 @@ public:
 };
 
 
+class Net_API SocketTimeoutNotification: public SocketNotification
+	/// This notification is sent for a socket if no read or
+	/// write event has occurred on the socket for the time set
+	/// with SocketReactor::setSocketTimeout().
+{
+public:
+	SocketTimeoutNotification(SocketReactor* pReactor);
+		/// Creates the SocketTimeoutNotification for the given SocketReactor.
+
+	~SocketTimeoutNotification() override;
+		/// Destroys the SocketTimeoutNotification.
+};
+
+
 class Net_API ShutdownNotification: public SocketNotification
 	/// This notification is sent when the SocketReactor is
 	/// about to shut down.
@@ -23,7 +23,9 @@
 #include "Poco/RefCountedObject.h"
 #include "Poco/NotificationCenter.h"
 #include "Poco/Observer.h"
+#include "Poco/TimingWheel.h"
 #include <set>
+#include <atomic>
 
 
 namespace Poco {
@@ -71,6 +73,24 @@ public:
 		/// Disables all observers, preventing any further
 		/// handler calls even if notifications are in flight.
 
+	void setTimeout(Poco::TimingWheel& wheel, const Poco::Timespan& timeout, const Poco::TimingWheel::Callback& callback);
+		/// Sets the socket timeout and schedules the given callback
+		/// in the given TimingWheel to be invoked when it expires.
+		/// A zero timeout cancels the timer.
+
+	void restartTimeout(Poco::TimingWheel& wheel, const Poco::TimingWheel::Callback& callback);
+		/// Restarts the socket timer, if a socket timeout has been set.
+		/// If the timer has already expired, the callback is scheduled again.
+
+	void cancelTimeout(Poco::TimingWheel& wheel);
+		/// Cancels the socket timer and resets the socket timeout.
+
+	Poco::Timespan getTimeout() const;
+		/// Returns the socket timeout, or zero if none has been set.
+
+	bool hasTimeout() const;
+		/// Returns true if a socket timeout has been set.
+
 protected:
 	~SocketNotifier() override;
 		/// Destroys the SocketNotifier.
@@ -80,10 +100,13 @@ private:
 	using MutexType = Poco::FastMutex;
 	using ScopedLock = MutexType::ScopedLock;
 
-	EventSet                 _events;
-	Poco::NotificationCenter _nc;
-	Socket                   _socket;
-	MutexType                _mutex;
+	EventSet                  _events;
+	Poco::NotificationCenter  _nc;
+	Socket                    _socket;
+	Poco::Timespan            _timeout;
+	Poco::TimingWheel::Handle _timer;
+	std::atomic<bool>         _hasTimeout;
+	mutable MutexType         _mutex;
 };
 
 
@@ -121,6 +144,12 @@ inline std::size_t SocketNotifier::countObservers() const
 }
 
 
+inline bool SocketNotifier::hasTimeout() const
+{
+	return _hasTimeout;
+}
+
+
 } } // namespace Poco::Net
 
 
@@ -50,12 +50,31 @@ namespace Net {
 
 class Socket;
 class Worker;
+class IOUring;
 
 
 class Net_API SocketProactor final: public Poco::Runnable
 	/// This class implements the proactor pattern.
 	/// It may also contain a simple work executor (enabled by default),
 	/// which executes submitted workload.
+	///
+	/// By default, I/O completions are emulated on top of readiness
+	/// notifications from a PollSet. On Linux, an io_uring based
+	/// engine can be selected at construction time. With io_uring,
+	/// receive and send operations are submitted directly to the
+	/// kernel as submission queue entries, which are batched and
+	/// submitted with a single system call per poll() iteration.
+	/// If io_uring is not available at runtime, the proactor
+	/// transparently falls back to the PollSet engine.
+	///
+	/// With the PollSet engine, completion handlers are run by
+	/// the completion handler thread. With the io_uring engine,
+	/// they are called directly by the thread reaping the completions
+	/// in poll(), which saves handing them over to another thread.
+	/// Such handlers must not block, as this would delay all other
+	/// I/O of the proactor. Handlers that may block must be added
+	/// with blocking set to true, so that they are run by the
+	/// completion handler thread instead.
 {
 public:
 	using Buffer = std::vector<std::uint8_t>;
@@ -68,11 +87,24 @@ public:
 
 	static const Timestamp::TimeDiff PERMANENT_COMPLETION_HANDLER;
 
-	explicit SocketProactor(bool worker = true);
+	enum IOEngine
+		/// The I/O engine used by the SocketProactor.
+	{
+		IO_ENGINE_POLL,    /// Completions are emulated using PollSet readiness notifications.
+		IO_ENGINE_IO_URING /// Operations are submitted to, and completed by, Linux io_uring.
+	};
+
+	explicit SocketProactor(bool worker = true, IOEngine engine = IO_ENGINE_POLL);
 		/// Creates the SocketProactor.
+		///
+		/// If IO_ENGINE_IO_URING is requested, but io_uring is not
+		/// available, IO_ENGINE_POLL is used instead.
 
-	explicit SocketProactor(const Poco::Timespan& timeout, bool worker = true);
+	explicit SocketProactor(const Poco::Timespan& timeout, bool worker = true, IOEngine engine = IO_ENGINE_POLL);
 		/// Creates the SocketProactor, using the given timeout.
+		///
+		/// If IO_ENGINE_IO_URING is requested, but io_uring is not
+		/// available, IO_ENGINE_POLL is used instead.
 
 	SocketProactor(const SocketProactor&) = delete;
 	SocketProactor(SocketProactor&&) = delete;
@@ -166,28 +198,40 @@ public:
 	void removeSocket(const Socket& sock);
 		/// Removes the socket from the poll set.
 
-	void addReceiveFrom(Socket sock, Buffer& buf, SocketAddress& addr, Callback&& onCompletion);
+	void addReceiveFrom(Socket sock, Buffer& buf, SocketAddress& addr, Callback&& onCompletion, bool blocking = false);
 		/// Adds the datagram socket and the completion handler to the I/O receive queue.
+		/// See the class documentation for the blocking parameter.
 
-	void addSendTo(Socket sock, const Buffer& message, const SocketAddress& addr, Callback&& onCompletion);
+	void addSendTo(Socket sock, const Buffer& message, const SocketAddress& addr, Callback&& onCompletion, bool blocking = false);
 		/// Adds the datagram socket and the completion handler to the I/O send queue.
+		/// See the class documentation for the blocking parameter.
 
-	void addSendTo(Socket sock, Buffer&& message, const SocketAddress&& addr, Callback&& onCompletion);
+	void addSendTo(Socket sock, Buffer&& message, const SocketAddress&& addr, Callback&& onCompletion, bool blocking = false);
 		/// Adds the datagram socket and the completion handler to the I/O send queue.
+		/// See the class documentation for the blocking parameter.
 
-	void addSend(Socket sock, Buffer* pMessage, SocketAddress* pAddr, Callback&& onCompletion, bool own = false);
+	void addSend(Socket sock, Buffer* pMessage, SocketAddress* pAddr, Callback&& onCompletion, bool own = false, bool blocking = false);
 		/// Adds the socket and the completion handler to the I/O send queue.
 		/// For stream socket, pAddr can be nullptr.
 		/// If `own` is true, message and address are deleted after the I/O completion.
+		/// See the class documentation for the blocking parameter.
 
-	void addReceive(Socket sock, Buffer& buf, Callback&& onCompletion);
+	void addReceive(Socket sock, Buffer& buf, Callback&& onCompletion, bool blocking = false);
 		/// Adds the stream socket and the completion handler to the I/O receive queue.
+		/// See the class documentation for the blocking parameter.
+		///
+		/// With the io_uring engine, the receive is performed directly into
+		/// the buffer, so the buffer must be sized to the maximum number of
+		/// bytes to receive. An empty buffer is resized to
+		/// DEFAULT_RECEIVE_BUFFER_SIZE.
 
-	void addSend(Socket sock, const Buffer& message, Callback&& onCompletion);
+	void addSend(Socket sock, const Buffer& message, Callback&& onCompletion, bool blocking = false);
 		/// Adds the stream socket and the completion handler to the I/O send queue.
+		/// See the class documentation for the blocking parameter.
 
-	void addSend(Socket sock, Buffer&& message, Callback&& onCompletion);
+	void addSend(Socket sock, Buffer&& message, Callback&& onCompletion, bool blocking = false);
 		/// Adds the stream socket and the completion handler to the I/O send queue.
+		/// See the class documentation for the blocking parameter.
 
 	bool hasSocketHandlers() const;
 		/// Returns true if proactor had at least one I/O completion handler.
@@ -201,6 +245,15 @@ public:
 	bool ioCompletionInProgress() const;
 		/// Returns true if there are not executed handlers from last IO.
 
+	IOEngine ioEngine() const;
+		/// Returns the I/O engine in use.
+
+	static bool isIOUringAvailable();
+		/// Returns true if io_uring support has been compiled in
+		/// and the running kernel permits its use.
+
+	static const std::size_t DEFAULT_RECEIVE_BUFFER_SIZE = 8192;
+
 private:
 	void onShutdown();
 		/// Called when the SocketProactor is about to terminate.
@@ -227,6 +280,7 @@ private:
 		SocketAddress* _pAddr = nullptr;
 		Callback _onCompletion = nullptr;
 		bool _owner = false;
+		bool _blocking = false;
 	};
 
 	class IONotification: public Notification
@@ -373,6 +427,19 @@ private:
 		/// The value of _timeout can grow up to
 		/// _maxTimeout value.
 
+	int pollIOUring();
+		/// Submits pending io_uring operations, waits for completions
+		/// (up to the current timeout) and calls the completion handlers,
+		/// or enqueues them if they have been marked as blocking.
+		/// Returns the number of completed operations.
+
+	static void callCompletionHandler(Callback& onCompletion, int n, int err);
+		/// Calls the completion handler, passing exceptions
+		/// to the ErrorHandler.
+
+	void addIOUring(Socket& sock, Handler& handler, bool send);
+		/// Submits the I/O operation described by handler to io_uring.
+
 	int error(Socket& sock);
 		/// Enqueues the completion handlers and removes
 		/// them from the handlers list after the operation
@@ -455,6 +522,7 @@ private:
 	Poco::Mutex   _readMutex;
 
 	std::unique_ptr<Worker> _pWorker;
+	std::unique_ptr<IOUring> _pIOUring;
 	friend class Worker;
 };
 
@@ -497,6 +565,12 @@ inline bool SocketProactor::isRunning() const
 }
 
 
+inline SocketProactor::IOEngine SocketProactor::ioEngine() const
+{
+	return _pIOUring ? IO_ENGINE_IO_URING : IO_ENGINE_POLL;
+}
+
+
 } } // namespace Poco::Net
 
 
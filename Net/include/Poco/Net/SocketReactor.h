@@ -29,6 +29,7 @@
 #include "Poco/AutoPtr.h"
 #include "Poco/Event.h"
 #include "Poco/Thread.h"
+#include "Poco/TimingWheel.h"
 #include <map>
 #include <atomic>
 
@@ -103,6 +104,14 @@ class Net_API SocketReactor: public Poco::Runnable
 	/// an incremental amount of milliseconds, up to the sleep limit.
 	/// Increment step value and sleep limit are configurable.
 	///
+	/// In addition, a per-socket timeout can be set with setSocketTimeout().
+	/// If a socket has neither become readable nor writable for the given
+	/// time, a SocketTimeoutNotification is dispatched to the event handlers
+	/// registered for the socket. Socket timeouts are kept in a TimingWheel,
+	/// so that starting, restarting and cancelling them is O(1) even with
+	/// many thousands of connections, which makes them suitable for
+	/// read and idle timeouts.
+	///
 	/// Finally, when the SocketReactor is about to shut down (as a result
 	/// of stop() being called), it dispatches a ShutdownNotification
 	/// to all event handlers. This is done in the onShutdown() method
@@ -251,6 +260,37 @@ public:
 		/// from the poll set first (preventing new events) and then
 		/// removes all handlers.
 
+	void setSocketTimeout(const Socket& socket, const Poco::Timespan& timeout);
+		/// Sets a timeout for the given socket.
+		///
+		/// If the socket does not become readable or writable within the
+		/// given timeout, a SocketTimeoutNotification is dispatched to the event
+		/// handlers registered for the socket. The timeout is restarted
+		/// whenever a ReadableNotification or WritableNotification is
+		/// dispatched for the socket, or restartSocketTimeout() is called.
+		/// Once the timeout has expired, it is only restarted by the
+		/// next event on the socket.
+		///
+		/// A zero timeout cancels the socket timeout.
+		///
+		/// The call is ignored if no event handler is registered for
+		/// the socket. The timeout is removed together with the last
+		/// event handler of the socket.
+		///
+		/// Socket timeouts have a resolution of one millisecond. If a
+		/// socket timeout is set from a thread other than the reactor thread,
+		/// it may take up to the poll timeout until the reactor takes
+		/// it into account.
+
+	Poco::Timespan getSocketTimeout(const Socket& socket);
+		/// Returns the timeout set for the given socket, or
+		/// zero if no timeout has been set.
+
+	void restartSocketTimeout(const Socket& socket);
+		/// Restarts the timeout of the given socket, e.g. after
+		/// the handler has made progress without a socket event.
+		/// Does nothing if no timeout has been set for the socket.
+
 protected:
 	using NotifierPtr = Poco::AutoPtr<SocketNotifier>;
 	using NotificationPtr = Poco::AutoPtr<SocketNotification>;
@@ -272,6 +312,15 @@ protected:
 		/// dispatches the ShutdownNotification and thus should be called by overriding
 		/// implementations.
 
+	virtual void onSocketTimeout(const Socket& socket);
+		/// Called when the timeout set with setSocketTimeout()
+		/// for the given socket has expired.
+		///
+		/// Can be overridden by subclasses. The default implementation
+		/// dispatches the SocketTimeoutNotification to the event handlers
+		/// registered for the socket and thus should be called by overriding
+		/// implementations.
+
 	void onError(const Socket& socket, int code, const std::string& description);
 		/// Notifies all subscribers when the reactor loop throws an exception.
 
@@ -297,8 +346,11 @@ protected:
 	Notification* getErrorNotification();
 	Notification* getTimeoutNotification();
 	Notification* getShutdownNotification();
+	Notification* getSocketTimeoutNotification();
 
 private:
+	void onSocketTimer(poco_socket_t sockfd);
+	Poco::TimingWheel::Callback socketTimerCallback(poco_socket_t sockfd);
 
 	NotifierPtr getNotifier(const Socket& socket, bool makeNew = false);
 
@@ -322,6 +374,8 @@ private:
 	NotificationPtr   _pErrorNotification;
 	NotificationPtr   _pTimeoutNotification;
 	NotificationPtr   _pShutdownNotification;
+	NotificationPtr   _pSocketTimeoutNotification;
+	Poco::TimingWheel _socketTimers;
 	MutexType         _mutex;
 	Poco::Event       _event;
 
@@ -423,6 +477,12 @@ inline Notification* SocketReactor::getShutdownNotification()
 }
 
 
+inline Notification* SocketReactor::getSocketTimeoutNotification()
+{
+	return _pSocketTimeoutNotification;
+}
+
+
 //
 // ScopedSocketReactor
 //
@@ -99,46 +99,31 @@ public:
 		char* ret = nullptr;
 		if (_mutex.tryLock(10))
 		{
-			if (_buffers[sock].size() < _bufListSize) // building buffer list
-			{
-				makeNext(sock, &ret);
-			}
-			else if (*reinterpret_cast<MsgSizeT*>(*_bufIt[sock]) != 0) // busy
-			{
-				makeNext(sock, &ret);
-			}
-			else if (*reinterpret_cast<MsgSizeT*>(*_bufIt[sock]) == 0) // available
-			{
-				setBusy(*_bufIt[sock]);
-				ret = *_bufIt[sock];
-				if (++_bufIt[sock] == _buffers[sock].end())
-				{
-					_bufIt[sock] = _buffers[sock].begin();
-				}
-			}
-			else // last resort, full scan
+			ret = nextImpl(sock);
+			_mutex.unlock();
+		}
+		return ret;
+	}
+
+	std::size_t next(poco_socket_t sock, char** pBufs, std::size_t count)
+		/// Obtains up to count buffers at once (see next(poco_socket_t)),
+		/// and stores the pointers in pBufs. Used by the reader
+		/// for batched receiving, so that the mutex only needs
+		/// to be acquired once per batch.
+		/// Returns the number of buffers obtained, which is zero
+		/// if mutex lock times out.
+	{
+		std::size_t n = 0;
+		if (_mutex.tryLock(10))
+		{
+			for (; n < count; ++n)
 			{
-				auto it = _buffers[sock].begin();
-				const auto end = _buffers[sock].end();
-				for (; it != end; ++it)
-				{
-					if (*reinterpret_cast<MsgSizeT*>(*_bufIt[sock]) == 0) // available
-					{
-						setBusy(*it);
-						ret = *it;
-						_bufIt[sock] = it;
-						if (++_bufIt[sock] == _buffers[sock].end())
-						{
-							_bufIt[sock] = _buffers[sock].begin();
-						}
-						break;
-					}
-				}
-				if (it == end) makeNext(sock, &ret);
+				pBufs[n] = nextImpl(sock);
+				if (!pBufs[n]) break;
 			}
 			_mutex.unlock();
 		}
-		return ret;
+		return n;
 	}
 
 	void notify()
@@ -344,6 +329,49 @@ private:
 	using BufIt = std::map<poco_socket_t, BLIt>;
 	using MemPool = Poco::FastMemoryPool<char[S]>;
 
+	char* nextImpl(poco_socket_t sock)
+	{
+		char* ret = nullptr;
+		if (_buffers[sock].size() < _bufListSize) // building buffer list
+		{
+			makeNext(sock, &ret);
+		}
+		else if (*reinterpret_cast<MsgSizeT*>(*_bufIt[sock]) != 0) // busy
+		{
+			makeNext(sock, &ret);
+		}
+		else if (*reinterpret_cast<MsgSizeT*>(*_bufIt[sock]) == 0) // available
+		{
+			setBusy(*_bufIt[sock]);
+			ret = *_bufIt[sock];
+			if (++_bufIt[sock] == _buffers[sock].end())
+			{
+				_bufIt[sock] = _buffers[sock].begin();
+			}
+		}
+		else // last resort, full scan
+		{
+			auto it = _buffers[sock].begin();
+			const auto end = _buffers[sock].end();
+			for (; it != end; ++it)
+			{
+				if (*reinterpret_cast<MsgSizeT*>(*_bufIt[sock]) == 0) // available
+				{
+					setBusy(*it);
+					ret = *it;
+					_bufIt[sock] = it;
+					if (++_bufIt[sock] == _buffers[sock].end())
+					{
+						_bufIt[sock] = _buffers[sock].begin();
+					}
+					break;
+				}
+			}
+			if (it == end) makeNext(sock, &ret);
+		}
+		return ret;
+	}
+
 	void setStatusImpl(char*& pBuf, MsgSizeT status)
 	{
 		*reinterpret_cast<MsgSizeT*>(pBuf) = status;
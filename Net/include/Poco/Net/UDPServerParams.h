@@ -64,6 +64,34 @@ public:
 		/// reports backlogs back to the client. Only meaningful
 		/// if notifySender() is true.
 
+	void setBatchSize(int batchSize);
+		/// Sets the maximum number of datagrams received
+		/// with a single system call. If greater than one
+		/// (and recvmmsg() is available), the server fills
+		/// a batch of handler buffers at once, which considerably
+		/// reduces the per-datagram overhead at high packet rates.
+		///
+		/// Default is 1 (one datagram per system call).
+
+	int batchSize() const;
+		/// Returns the maximum number of datagrams
+		/// received with a single system call.
+
+	void setUDPGRO(bool flag);
+		/// Enables UDP generic receive offload for the server
+		/// sockets (Linux only). Coalesced datagrams are split
+		/// into separate handler buffers again before processing.
+		///
+		/// The kernel only coalesces datagrams that fit into the
+		/// receive buffer, so this only has an effect if the
+		/// handler buffer size is considerably larger than the
+		/// datagrams received.
+		///
+		/// Default is false.
+
+	bool udpGRO() const;
+		/// Returns true if UDP generic receive offload is enabled.
+
 private:
 	UDPServerParams();
 
@@ -73,6 +101,8 @@ private:
 	std::size_t              _handlerBufListSize;
 	bool                     _notifySender;
 	int                      _backlogThreshold;
+	int                      _batchSize;
+	bool                     _udpGRO;
 };
 
 
@@ -116,6 +146,18 @@ inline int UDPServerParams::backlogThreshold() const
 }
 
 
+inline int UDPServerParams::batchSize() const
+{
+	return _batchSize;
+}
+
+
+inline bool UDPServerParams::udpGRO() const
+{
+	return _udpGRO;
+}
+
+
 } } // namespace Poco::Net
 
 
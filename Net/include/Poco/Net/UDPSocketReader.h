@@ -24,6 +24,8 @@
 #include "Poco/Net/UDPServerParams.h"
 
 #include <map>
+#include <vector>
+#include <cstring>
 
 namespace Poco {
 namespace Net {
@@ -89,6 +91,25 @@ public:
 		/// Creates the UDPSocketReader.
 	{
 		poco_assert(_handler != _handlers.end());
+		setBatchSize(serverParams.batchSize());
+	}
+
+	void setBatchSize(int batchSize)
+		/// Sets the maximum number of datagrams received with
+		/// a single system call (see UDPServerParams::setBatchSize()).
+	{
+		poco_assert (batchSize > 0);
+
+		if (batchSize > SocketImpl::MAX_DATAGRAM_BATCH) batchSize = SocketImpl::MAX_DATAGRAM_BATCH;
+		_buffers.resize(batchSize);
+		_datagrams.resize(batchSize);
+	}
+
+	int batchSize() const
+		/// Returns the maximum number of datagrams received
+		/// with a single system call.
+	{
+		return _datagrams.empty() ? 1 : static_cast<int>(_datagrams.size());
 	}
 
 	~UDPSocketReader()
@@ -102,6 +123,12 @@ public:
 		/// for replying to sender and data or error backlog threshold is
 		/// exceeded, sender is notified of the current backlog size.
 	{
+		if (_datagrams.size() > 1)
+		{
+			readBatch(sock);
+			return;
+		}
+
 		using RT = typename UDPHandlerImpl<S>::MsgSizeT;
 		char* p = nullptr;
 		struct sockaddr* pSA = nullptr;
@@ -192,6 +219,86 @@ public:
 	}
 
 private:
+	void readBatch(DatagramSocket& sock)
+		/// Obtains a batch of buffers from the next handler and fills
+		/// as many of them as possible with a single receiveBatch() call.
+		/// Buffers left unused are returned to the handler.
+	{
+		using RT = typename UDPHandlerImpl<S>::MsgSizeT;
+		poco_socket_t sockfd = sock.impl()->sockfd();
+		nextHandler();
+		std::size_t n = handler().next(sockfd, &_buffers[0], _buffers.size());
+		if (n == 0) return;
+
+		const Poco::UInt16 off = handler().offset();
+		for (std::size_t i = 0; i < n; ++i)
+		{
+			char* p = _buffers[i];
+			SocketDatagram& dg = _datagrams[i];
+			dg.buffer = p + off;
+			dg.length = static_cast<int>(S - off - 1);
+			dg.pAddress = reinterpret_cast<struct sockaddr*>(p + sizeof(RT) + sizeof(poco_socklen_t));
+			dg.addressLength = SocketAddress::MAX_ADDRESS_LENGTH;
+			dg.segmentSize = 0;
+		}
+
+		int received = 0;
+		try
+		{
+			received = sock.receiveBatch(&_datagrams[0], static_cast<int>(n));
+		}
+		catch (Poco::Exception& exc)
+		{
+			for (std::size_t i = 1; i < n; ++i) handler().setIdle(_buffers[i]);
+			setError(sockfd, _buffers[0], exc.displayText());
+			handler().notify();
+			return;
+		}
+		if (received < 0) received = 0;
+
+		AtomicCounter::ValueType data = 0;
+		for (int i = 0; i < received; ++i)
+		{
+			char* p = _buffers[i];
+			SocketDatagram& dg = _datagrams[i];
+			*reinterpret_cast<poco_socklen_t*>(p + sizeof(RT)) = dg.addressLength;
+			if (dg.segmentSize > 0) splitSegments(sockfd, p, dg);
+			p[off + dg.length] = 0; // for ascii convenience, zero-terminate
+			data = handler().setData(p, dg.length);
+		}
+		for (std::size_t i = received; i < n; ++i) handler().setIdle(_buffers[i]);
+		if (received == 0) return;
+
+		if (_backlogThreshold > 0 && data > _backlogThreshold && data != _dataBacklog[sockfd])
+		{
+			const SocketDatagram& dg = _datagrams[received - 1];
+			auto d = static_cast<Poco::Int32>(data);
+			sock.sendTo(&d, sizeof(Poco::Int32), SocketAddress(dg.pAddress, dg.addressLength));
+			_dataBacklog[sockfd] = data;
+		}
+		handler().notify();
+	}
+
+	void splitSegments(poco_socket_t sockfd, char* p, SocketDatagram& dg)
+		/// Moves all but the first of several datagrams coalesced by
+		/// UDP generic receive offload into buffers of their own,
+		/// and truncates the datagram in p to the first segment.
+	{
+		using RT = typename UDPHandlerImpl<S>::MsgSizeT;
+		const Poco::UInt16 off = handler().offset();
+		for (int pos = dg.segmentSize; pos < dg.length; pos += dg.segmentSize)
+		{
+			int len = dg.length - pos < dg.segmentSize ? dg.length - pos : dg.segmentSize;
+			char* q = handler().next(sockfd);
+			if (!q) break; // handler busy, segment is dropped
+			std::memcpy(q + sizeof(RT), p + sizeof(RT), off - sizeof(RT)); // sender address
+			std::memcpy(q + off, p + off + pos, len);
+			q[off + len] = 0;
+			handler().setData(q, len);
+		}
+		dg.length = dg.segmentSize;
+	}
+
 	void nextHandler()
 		/// Re-points the handler iterator to the next handler in
 		/// round-robin fashion.
@@ -210,12 +317,16 @@ private:
 	using HandlerList = typename UDPHandlerImpl<S>::List;
 	using HandlerIterator = typename UDPHandlerImpl<S>::List::iterator;
 	using CounterMap = std::map<poco_socket_t, Counter>;
+	using BufferVec = std::vector<char*>;
+	using DatagramVec = SocketDatagramVec;
 
 	HandlerList&    _handlers;
 	HandlerIterator _handler;
 	CounterMap      _dataBacklog;
 	CounterMap      _errorBacklog;
 	int             _backlogThreshold;
+	BufferVec       _buffers;
+	DatagramVec     _datagrams;
 };
 
 
@@ -0,0 +1,404 @@
+//
+// DNSMessage.cpp
+//
+// Library: Net
+// Package: NetCore
+// Module:  DNSMessage
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/DNSMessage.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/String.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+namespace
+{
+	enum
+	{
+		FLAG_QR = 0x8000,
+		FLAG_TC = 0x0200,
+		FLAG_RD = 0x0100,
+		RCODE_MASK = 0x000F,
+		SOA_FIELDS_SIZE = 20
+	};
+
+
+	void writeUInt16(std::string& buffer, UInt16 value)
+	{
+		buffer += static_cast<char>(value >> 8);
+		buffer += static_cast<char>(value & 0xFF);
+	}
+
+
+	void writeUInt32(std::string& buffer, UInt32 value)
+	{
+		writeUInt16(buffer, static_cast<UInt16>(value >> 16));
+		writeUInt16(buffer, static_cast<UInt16>(value & 0xFFFF));
+	}
+
+
+	UInt16 readUInt16(const char* buffer, std::size_t size, std::size_t& pos)
+	{
+		if (size - pos < 2) throw DNSException("Malformed DNS message", "truncated");
+		const unsigned char* p = reinterpret_cast<const unsigned char*>(buffer + pos);
+		pos += 2;
+		return static_cast<UInt16>((p[0] << 8) | p[1]);
+	}
+
+
+	UInt32 readUInt32(const char* buffer, std::size_t size, std::size_t& pos)
+	{
+		UInt32 high = readUInt16(buffer, size, pos);
+		return (high << 16) | readUInt16(buffer, size, pos);
+	}
+
+
+	bool isNameType(UInt16 type)
+	{
+		return type == DNSMessage::TYPE_CNAME || type == DNSMessage::TYPE_NS || type == DNSMessage::TYPE_PTR;
+	}
+}
+
+
+DNSMessage::DNSMessage():
+	_id(0),
+	_flags(FLAG_RD)
+{
+}
+
+
+DNSMessage::~DNSMessage()
+{
+}
+
+
+void DNSMessage::setResponse(bool response)
+{
+	if (response)
+		_flags |= FLAG_QR;
+	else
+		_flags &= ~FLAG_QR;
+}
+
+
+bool DNSMessage::isResponse() const
+{
+	return (_flags & FLAG_QR) != 0;
+}
+
+
+void DNSMessage::setTruncated(bool truncated)
+{
+	if (truncated)
+		_flags |= FLAG_TC;
+	else
+		_flags &= ~FLAG_TC;
+}
+
+
+bool DNSMessage::isTruncated() const
+{
+	return (_flags & FLAG_TC) != 0;
+}
+
+
+void DNSMessage::setRecursionDesired(bool recursion)
+{
+	if (recursion)
+		_flags |= FLAG_RD;
+	else
+		_flags &= ~FLAG_RD;
+}
+
+
+bool DNSMessage::getRecursionDesired() const
+{
+	return (_flags & FLAG_RD) != 0;
+}
+
+
+void DNSMessage::setResponseCode(ResponseCode code)
+{
+	_flags = static_cast<UInt16>((_flags & ~RCODE_MASK) | (code & RCODE_MASK));
+}
+
+
+DNSMessage::ResponseCode DNSMessage::getResponseCode() const
+{
+	return static_cast<ResponseCode>(_flags & RCODE_MASK);
+}
+
+
+void DNSMessage::addQuestion(const std::string& name, UInt16 type)
+{
+	Question question;
+	question.name = name;
+	question.type = type;
+	_questions.push_back(question);
+}
+
+
+void DNSMessage::addAnswer(const Record& record)
+{
+	_answers.push_back(record);
+}
+
+
+void DNSMessage::addAuthority(const Record& record)
+{
+	_authorities.push_back(record);
+}
+
+
+void DNSMessage::write(std::string& buffer) const
+{
+	writeUInt16(buffer, _id);
+	writeUInt16(buffer, _flags);
+	writeUInt16(buffer, static_cast<UInt16>(_questions.size()));
+	writeUInt16(buffer, static_cast<UInt16>(_answers.size()));
+	writeUInt16(buffer, static_cast<UInt16>(_authorities.size()));
+	writeUInt16(buffer, 0);
+	for (const auto& question: _questions)
+	{
+		writeName(buffer, question.name);
+		writeUInt16(buffer, question.type);
+		writeUInt16(buffer, CLASS_IN);
+	}
+	for (const auto& record: _answers)
+	{
+		writeRecord(buffer, record);
+	}
+	for (const auto& record: _authorities)
+	{
+		writeRecord(buffer, record);
+	}
+}
+
+
+void DNSMessage::read(const char* buffer, std::size_t size)
+{
+	_questions.clear();
+	_answers.clear();
+	_authorities.clear();
+
+	std::size_t pos = 0;
+	_id = readUInt16(buffer, size, pos);
+	_flags = readUInt16(buffer, size, pos);
+	UInt16 questionCount = readUInt16(buffer, size, pos);
+	UInt16 answerCount = readUInt16(buffer, size, pos);
+	UInt16 authorityCount = readUInt16(buffer, size, pos);
+	readUInt16(buffer, size, pos);
+
+	for (UInt16 i = 0; i < questionCount; i++)
+	{
+		Question question;
+		question.name = readName(buffer, size, pos);
+		question.type = readUInt16(buffer, size, pos);
+		readUInt16(buffer, size, pos);
+		_questions.push_back(question);
+	}
+	_answers.resize(answerCount);
+	for (auto& record: _answers)
+	{
+		readRecord(buffer, size, pos, record);
+	}
+	_authorities.resize(authorityCount);
+	for (auto& record: _authorities)
+	{
+		readRecord(buffer, size, pos, record);
+	}
+}
+
+
+DNSMessage::Record DNSMessage::addressRecord(const std::string& name, const IPAddress& address, UInt32 ttl)
+{
+	Record record;
+	record.name = name;
+	record.type = address.family() == IPAddress::IPv4 ? TYPE_A : TYPE_AAAA;
+	record.ttl = ttl;
+	record.data.assign(static_cast<const char*>(address.addr()), address.length());
+	return record;
+}
+
+
+DNSMessage::Record DNSMessage::cnameRecord(const std::string& name, const std::string& target, UInt32 ttl)
+{
+	Record record;
+	record.name = name;
+	record.type = TYPE_CNAME;
+	record.ttl = ttl;
+	record.data = target;
+	return record;
+}
+
+
+DNSMessage::Record DNSMessage::soaRecord(const std::string& name, UInt32 minimum, UInt32 ttl)
+{
+	Record record;
+	record.name = name;
+	record.type = TYPE_SOA;
+	record.ttl = ttl;
+	record.data.assign(SOA_FIELDS_SIZE - 4, '\0');
+	writeUInt32(record.data, minimum);
+	return record;
+}
+
+
+IPAddress DNSMessage::address(const Record& record)
+{
+	if (record.type == TYPE_A && record.data.size() == 4)
+		return IPAddress(record.data.data(), 4);
+#if defined(POCO_HAVE_IPv6)
+	if (record.type == TYPE_AAAA && record.data.size() == 16)
+		return IPAddress(record.data.data(), 16);
+#endif
+	throw DNSException("Not a valid address record", record.name);
+}
+
+
+UInt32 DNSMessage::soaMinimum(const Record& record)
+{
+	if (record.type != TYPE_SOA || record.data.size() != SOA_FIELDS_SIZE)
+		throw DNSException("Not a valid SOA record", record.name);
+	std::size_t pos = SOA_FIELDS_SIZE - 4;
+	return readUInt32(record.data.data(), record.data.size(), pos);
+}
+
+
+bool DNSMessage::equalNames(const std::string& name1, const std::string& name2)
+{
+	std::size_t n1 = name1.size();
+	std::size_t n2 = name2.size();
+	if (n1 > 0 && name1[n1 - 1] == '.') --n1;
+	if (n2 > 0 && name2[n2 - 1] == '.') --n2;
+	return n1 == n2 && Poco::icompare(name1, 0, n1, name2, 0, n2) == 0;
+}
+
+
+void DNSMessage::writeName(std::string& buffer, const std::string& name)
+{
+	std::size_t start = buffer.size();
+	std::string::size_type pos = 0;
+	std::string::size_type end = name.size();
+	if (end > 0 && name[end - 1] == '.') --end;
+	while (pos < end)
+	{
+		std::string::size_type dot = name.find('.', pos);
+		if (dot == std::string::npos || dot > end) dot = end;
+		std::size_t length = dot - pos;
+		if (length == 0 || length > MAX_LABEL_LENGTH)
+			throw DNSException("Invalid domain name", name);
+		buffer += static_cast<char>(length);
+		buffer.append(name, pos, length);
+		pos = dot + 1;
+	}
+	buffer += '\0';
+	if (buffer.size() - start > MAX_NAME_LENGTH)
+		throw DNSException("Domain name too long", name);
+}
+
+
+void DNSMessage::writeRecord(std::string& buffer, const Record& record)
+{
+	writeName(buffer, record.name);
+	writeUInt16(buffer, record.type);
+	writeUInt16(buffer, CLASS_IN);
+	writeUInt32(buffer, record.ttl);
+
+	std::string data;
+	if (isNameType(record.type))
+	{
+		writeName(data, record.data);
+	}
+	else if (record.type == TYPE_SOA)
+	{
+		data.assign(2, '\0');
+		data += record.data;
+	}
+	else data = record.data;
+
+	writeUInt16(buffer, static_cast<UInt16>(data.size()));
+	buffer += data;
+}
+
+
+std::string DNSMessage::readName(const char* buffer, std::size_t size, std::size_t& pos)
+{
+	std::string name;
+	std::size_t p = pos;
+	bool jumped = false;
+	int jumps = 0;
+	for (;;)
+	{
+		if (p >= size) throw DNSException("Malformed DNS message", "truncated name");
+		unsigned length = static_cast<unsigned char>(buffer[p]);
+		if ((length & 0xC0) == 0xC0)
+		{
+			// compression pointer; limit the number of jumps to reject loops
+			if (p + 1 >= size || ++jumps > 64) throw DNSException("Malformed DNS message", "bad name pointer");
+			std::size_t target = ((length & 0x3F) << 8) | static_cast<unsigned char>(buffer[p + 1]);
+			if (!jumped) pos = p + 2;
+			jumped = true;
+			p = target;
+		}
+		else if (length & 0xC0)
+		{
+			throw DNSException("Malformed DNS message", "unsupported label type");
+		}
+		else if (length == 0)
+		{
+			if (!jumped) pos = p + 1;
+			break;
+		}
+		else
+		{
+			if (p + 1 + length > size) throw DNSException("Malformed DNS message", "truncated label");
+			if (!name.empty()) name += '.';
+			name.append(buffer + p + 1, length);
+			if (name.size() > MAX_NAME_LENGTH) throw DNSException("Malformed DNS message", "name too long");
+			p += 1 + length;
+		}
+	}
+	return name;
+}
+
+
+void DNSMessage::readRecord(const char* buffer, std::size_t size, std::size_t& pos, Record& record)
+{
+	record.name = readName(buffer, size, pos);
+	record.type = readUInt16(buffer, size, pos);
+	readUInt16(buffer, size, pos);
+	record.ttl = readUInt32(buffer, size, pos);
+	std::size_t length = readUInt16(buffer, size, pos);
+	if (size - pos < length) throw DNSException("Malformed DNS message", "truncated record");
+
+	std::size_t end = pos + length;
+	if (isNameType(record.type))
+	{
+		std::size_t p = pos;
+		record.data = readName(buffer, end, p);
+	}
+	else if (record.type == TYPE_SOA)
+	{
+		std::size_t p = pos;
+		readName(buffer, end, p);
+		readName(buffer, end, p);
+		if (end - p != SOA_FIELDS_SIZE) throw DNSException("Malformed DNS message", "bad SOA record");
+		record.data.assign(buffer + p, SOA_FIELDS_SIZE);
+	}
+	else record.data.assign(buffer + pos, length);
+	pos = end;
+}
+
+
+} } // namespace Poco::Net
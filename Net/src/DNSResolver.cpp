@@ -0,0 +1,907 @@
+//
+// DNSResolver.cpp
+//
+// Library: Net
+// Package: NetCore
+// Module:  DNSResolver
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/DNSResolver.h"
+#include "Poco/Net/DNSMessage.h"
+#include "Poco/Net/DNS.h"
+#include "Poco/Net/SocketReactor.h"
+#include "Poco/Net/SocketNotification.h"
+#include "Poco/Net/DatagramSocket.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/NObserver.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/Error.h"
+#include "Poco/RefCountedObject.h"
+#include "Poco/String.h"
+#include "Poco/StringTokenizer.h"
+#include "Poco/FileStream.h"
+#include "Poco/RandomStream.h"
+#include "Poco/File.h"
+#include <algorithm>
+#include <limits>
+
+
+namespace Poco {
+namespace Net {
+
+
+//
+// DNSResolver::Lookup
+//
+
+
+class DNSResolver::Lookup: public Poco::RefCountedObject
+	/// A Lookup sends the queries for a name and collects
+	/// the responses. All work after start() is done in the
+	/// reactor thread.
+{
+public:
+	Lookup(DNSResolver& resolver, const std::string& name);
+	~Lookup();
+
+	void start();
+		/// Sends the queries to the first name server.
+
+	void cancel();
+		/// Stops the lookup without completing it.
+
+	const std::string& name() const;
+
+	std::vector<Callback>& callbacks();
+		/// Returns the callbacks waiting for the lookup.
+		/// Guarded by the resolver's mutex.
+
+private:
+	enum
+	{
+		MAX_CNAME_CHAIN = 16,
+		RECEIVE_BUFFER_SIZE = 4096
+	};
+
+	struct Query
+	{
+		UInt16 type = DNSMessage::TYPE_A;
+		UInt16 id = 0;
+		bool done = false;
+		CacheEntry::Status status = CacheEntry::ENTRY_NO_ADDRESS;
+		HostEntry::AddressList addresses;
+		HostEntry::AliasList aliases;
+		std::string canonicalName;
+		UInt32 ttl = std::numeric_limits<UInt32>::max();
+	};
+
+	struct Result
+	{
+		bool complete = false;
+		HostEntry entry;
+		CacheEntry::Status status = CacheEntry::ENTRY_NO_ADDRESS;
+		std::exception_ptr pException;
+		Poco::Timespan ttl;
+	};
+
+	void send(Result& result);
+	void sendUDP();
+	void sendTCP();
+	void nextAttempt(Result& result, std::exception_ptr pException);
+	void handleResponse(const char* data, std::size_t size, Result& result);
+	void finish(Result& result);
+	void fail(Result& result, std::exception_ptr pException);
+	void unregister();
+	void done(Result& result);
+
+	void onReadable(const AutoPtr<ReadableNotification>& pNf);
+	void onWritable(const AutoPtr<WritableNotification>& pNf);
+	void onError(const AutoPtr<ErrorNotification>& pNf);
+	void onTimeout(const AutoPtr<SocketTimeoutNotification>& pNf);
+
+	Poco::Timespan clampTTL(UInt32 seconds, const Poco::Timespan& maxTTL) const;
+
+	DNSResolver& _resolver;
+	std::string _name;
+	std::vector<Callback> _callbacks;
+	std::vector<Query> _queries;
+	std::vector<SocketAddress> _servers;
+	std::size_t _attempt;
+	std::size_t _maxAttempts;
+	Socket _socket;
+	bool _tcp;
+	bool _connected;
+	bool _finished;
+	std::string _tcpBuffer;
+	std::exception_ptr _pLastError;
+	Poco::FastMutex _mutex;
+};
+
+
+DNSResolver::Lookup::Lookup(DNSResolver& resolver, const std::string& name):
+	_resolver(resolver),
+	_name(name),
+	_servers(resolver._params.nameServers),
+	_attempt(0),
+	_maxAttempts(0),
+	_tcp(false),
+	_connected(false),
+	_finished(false)
+{
+	_maxAttempts = _servers.size()*std::max(resolver._params.attempts, 1);
+
+	Query query;
+	query.type = DNSMessage::TYPE_A;
+	_queries.push_back(query);
+	if (resolver._params.queryIPv6)
+	{
+		query.type = DNSMessage::TYPE_AAAA;
+		_queries.push_back(query);
+	}
+}
+
+
+DNSResolver::Lookup::~Lookup()
+{
+}
+
+
+const std::string& DNSResolver::Lookup::name() const
+{
+	return _name;
+}
+
+
+std::vector<DNSResolver::Callback>& DNSResolver::Lookup::callbacks()
+{
+	return _callbacks;
+}
+
+
+void DNSResolver::Lookup::start()
+{
+	LookupPtr pThis(this, true);
+	Result result;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		send(result);
+	}
+	done(result);
+}
+
+
+void DNSResolver::Lookup::cancel()
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	_finished = true;
+	unregister();
+}
+
+
+void DNSResolver::Lookup::send(Result& result)
+{
+	try
+	{
+		if (_tcp)
+			sendTCP();
+		else
+			sendUDP();
+	}
+	catch (...)
+	{
+		nextAttempt(result, std::current_exception());
+	}
+}
+
+
+void DNSResolver::Lookup::sendUDP()
+{
+	const SocketAddress& server = _servers[_attempt % _servers.size()];
+	DatagramSocket socket(server.family());
+	socket.connect(server);
+	socket.setBlocking(false);
+	_socket = socket;
+
+	SocketReactor& reactor = _resolver._reactor;
+	reactor.addEventHandler(_socket, Poco::NObserver<Lookup, ReadableNotification>(*this, &Lookup::onReadable));
+	reactor.addEventHandler(_socket, Poco::NObserver<Lookup, ErrorNotification>(*this, &Lookup::onError));
+	reactor.addEventHandler(_socket, Poco::NObserver<Lookup, SocketTimeoutNotification>(*this, &Lookup::onTimeout));
+	reactor.setSocketTimeout(_socket, _resolver._params.timeout);
+
+	for (auto& query: _queries)
+	{
+		if (query.done) continue;
+		query.id = _resolver.nextId();
+		DNSMessage message;
+		message.setId(query.id);
+		message.addQuestion(_name, query.type);
+		std::string buffer;
+		message.write(buffer);
+		socket.sendBytes(buffer.data(), static_cast<int>(buffer.size()));
+	}
+
+	// an idle reactor may be sleeping instead of polling
+	reactor.wakeUp();
+}
+
+
+void DNSResolver::Lookup::sendTCP()
+{
+	const SocketAddress& server = _servers[_attempt % _servers.size()];
+	StreamSocket socket(server.family());
+	socket.connectNB(server);
+	_socket = socket;
+	_connected = false;
+	_tcpBuffer.clear();
+
+	SocketReactor& reactor = _resolver._reactor;
+	reactor.addEventHandler(_socket, Poco::NObserver<Lookup, ReadableNotification>(*this, &Lookup::onReadable));
+	reactor.addEventHandler(_socket, Poco::NObserver<Lookup, WritableNotification>(*this, &Lookup::onWritable));
+	reactor.addEventHandler(_socket, Poco::NObserver<Lookup, ErrorNotification>(*this, &Lookup::onError));
+	reactor.addEventHandler(_socket, Poco::NObserver<Lookup, SocketTimeoutNotification>(*this, &Lookup::onTimeout));
+	reactor.setSocketTimeout(_socket, _resolver._params.timeout);
+	reactor.wakeUp();
+}
+
+
+void DNSResolver::Lookup::nextAttempt(Result& result, std::exception_ptr pException)
+{
+	unregister();
+	if (pException) _pLastError = pException;
+	while (++_attempt < _maxAttempts)
+	{
+		try
+		{
+			if (_tcp)
+				sendTCP();
+			else
+				sendUDP();
+			return;
+		}
+		catch (...)
+		{
+			unregister();
+			_pLastError = std::current_exception();
+		}
+	}
+	if (!_pLastError)
+		_pLastError = std::make_exception_ptr(Poco::TimeoutException("DNS lookup timed out", _name));
+	fail(result, _pLastError);
+}
+
+
+void DNSResolver::Lookup::unregister()
+{
+	if (!_socket.isNull())
+	{
+		_resolver._reactor.remove(_socket);
+		_socket.close();
+		_socket = Socket();
+	}
+}
+
+
+void DNSResolver::Lookup::onReadable(const AutoPtr<ReadableNotification>& pNf)
+{
+	LookupPtr pThis(this, true);
+	Result result;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		if (_finished || pNf->socket() != _socket) return;
+
+		try
+		{
+			if (_tcp)
+			{
+				char buffer[RECEIVE_BUFFER_SIZE];
+				int n = _socket.impl()->receiveBytes(buffer, sizeof(buffer));
+				if (n <= 0)
+				{
+					nextAttempt(result, std::make_exception_ptr(ConnectionResetException("DNS server closed connection", _name)));
+				}
+				else
+				{
+					_tcpBuffer.append(buffer, n);
+					while (!_finished && _tcpBuffer.size() >= 2)
+					{
+						std::size_t length = (static_cast<unsigned char>(_tcpBuffer[0]) << 8) | static_cast<unsigned char>(_tcpBuffer[1]);
+						if (_tcpBuffer.size() < length + 2) break;
+						std::string message(_tcpBuffer, 2, length);
+						_tcpBuffer.erase(0, length + 2);
+						handleResponse(message.data(), message.size(), result);
+					}
+				}
+			}
+			else
+			{
+				char buffer[RECEIVE_BUFFER_SIZE];
+				int n = _socket.impl()->receiveBytes(buffer, sizeof(buffer));
+				if (n > 0) handleResponse(buffer, n, result);
+			}
+		}
+		catch (...)
+		{
+			// e.g., ICMP port unreachable reported for the connected UDP socket
+			nextAttempt(result, std::current_exception());
+		}
+	}
+	done(result);
+}
+
+
+void DNSResolver::Lookup::onWritable(const AutoPtr<WritableNotification>& pNf)
+{
+	LookupPtr pThis(this, true);
+	Result result;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		if (_finished || pNf->socket() != _socket || _connected) return;
+
+		_resolver._reactor.removeEventHandler(_socket, Poco::NObserver<Lookup, WritableNotification>(*this, &Lookup::onWritable));
+		try
+		{
+			int err = _socket.impl()->socketError();
+			if (err) throw NetException(Poco::Error::getMessage(err), err);
+			_connected = true;
+
+			std::string buffer;
+			for (auto& query: _queries)
+			{
+				if (query.done) continue;
+				query.id = _resolver.nextId();
+				DNSMessage message;
+				message.setId(query.id);
+				message.addQuestion(_name, query.type);
+				std::string data;
+				message.write(data);
+				buffer += static_cast<char>(data.size() >> 8);
+				buffer += static_cast<char>(data.size() & 0xFF);
+				buffer += data;
+			}
+			StreamSocket socket(_socket);
+			socket.setBlocking(true);
+			socket.sendBytes(buffer.data(), static_cast<int>(buffer.size()));
+			socket.setBlocking(false);
+		}
+		catch (...)
+		{
+			nextAttempt(result, std::current_exception());
+		}
+	}
+	done(result);
+}
+
+
+void DNSResolver::Lookup::onError(const AutoPtr<ErrorNotification>& pNf)
+{
+	LookupPtr pThis(this, true);
+	Result result;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		if (_finished || pNf->socket() != _socket) return;
+
+		std::exception_ptr pException;
+		try
+		{
+			int err = _socket.impl()->socketError();
+			if (err) throw NetException(Poco::Error::getMessage(err), err);
+		}
+		catch (...)
+		{
+			pException = std::current_exception();
+		}
+		nextAttempt(result, pException);
+	}
+	done(result);
+}
+
+
+void DNSResolver::Lookup::onTimeout(const AutoPtr<SocketTimeoutNotification>& pNf)
+{
+	LookupPtr pThis(this, true);
+	Result result;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		if (_finished || pNf->socket() != _socket) return;
+
+		nextAttempt(result, nullptr);
+	}
+	done(result);
+}
+
+
+void DNSResolver::Lookup::handleResponse(const char* data, std::size_t size, Result& result)
+{
+	DNSMessage message;
+	try
+	{
+		message.read(data, size);
+	}
+	catch (DNSException&)
+	{
+		// ignore garbage, which may also come from an attacker
+		return;
+	}
+	if (!message.isResponse() || message.questions().size() != 1) return;
+
+	const DNSMessage::Question& question = message.questions().front();
+	auto it = std::find_if(_queries.begin(), _queries.end(), [&](const Query& q)
+		{
+			return !q.done && q.id == message.getId() && q.type == question.type;
+		});
+	if (it == _queries.end() || !DNSMessage::equalNames(question.name, _name)) return;
+	Query& query = *it;
+
+	if (message.isTruncated() && _resolver._params.useTCP && !_tcp)
+	{
+		unregister();
+		_tcp = true;
+		send(result);
+		return;
+	}
+
+	switch (message.getResponseCode())
+	{
+	case DNSMessage::RCODE_NOERROR:
+	case DNSMessage::RCODE_NXDOMAIN:
+		break;
+	default:
+		nextAttempt(result, std::make_exception_ptr(DNSException("DNS server failure", _name + ", response code " + std::to_string(message.getResponseCode()))));
+		return;
+	}
+
+	// follow the CNAME chain, starting with the name looked up
+	std::string owner = _name;
+	for (int i = 0; i < MAX_CNAME_CHAIN; i++)
+	{
+		auto cname = std::find_if(message.answers().begin(), message.answers().end(), [&owner](const DNSMessage::Record& r)
+			{
+				return r.type == DNSMessage::TYPE_CNAME && DNSMessage::equalNames(r.name, owner);
+			});
+		if (cname == message.answers().end()) break;
+		query.aliases.push_back(owner);
+		query.ttl = std::min(query.ttl, cname->ttl);
+		owner = cname->data;
+	}
+	query.canonicalName = owner;
+
+	for (const auto& record: message.answers())
+	{
+		if (record.type == query.type && DNSMessage::equalNames(record.name, owner))
+		{
+			try
+			{
+				query.addresses.push_back(DNSMessage::address(record));
+				query.ttl = std::min(query.ttl, record.ttl);
+			}
+			catch (DNSException&)
+			{
+			}
+		}
+	}
+
+	if (query.addresses.empty())
+	{
+		query.status = message.getResponseCode() == DNSMessage::RCODE_NXDOMAIN ? CacheEntry::ENTRY_NOT_FOUND : CacheEntry::ENTRY_NO_ADDRESS;
+
+		// RFC 2308: the negative TTL is the minimum of the SOA
+		// record's TTL and its minimum field
+		query.ttl = std::numeric_limits<UInt32>::max();
+		for (const auto& record: message.authorities())
+		{
+			if (record.type == DNSMessage::TYPE_SOA)
+			{
+				try
+				{
+					query.ttl = std::min(record.ttl, DNSMessage::soaMinimum(record));
+				}
+				catch (DNSException&)
+				{
+				}
+			}
+		}
+	}
+	else query.status = CacheEntry::ENTRY_FOUND;
+	query.done = true;
+
+	if (std::all_of(_queries.begin(), _queries.end(), [](const Query& q) { return q.done; }))
+	{
+		finish(result);
+	}
+}
+
+
+void DNSResolver::Lookup::finish(Result& result)
+{
+	unregister();
+	_finished = true;
+
+	HostEntry::AddressList addresses;
+	HostEntry::AliasList aliases;
+	std::string canonicalName;
+	UInt32 ttl = std::numeric_limits<UInt32>::max();
+	UInt32 negativeTTL = std::numeric_limits<UInt32>::max();
+	bool notFound = false;
+	for (const auto& query: _queries)
+	{
+		if (query.status == CacheEntry::ENTRY_FOUND)
+		{
+			addresses.insert(addresses.end(), query.addresses.begin(), query.addresses.end());
+			if (aliases.empty()) aliases = query.aliases;
+			if (canonicalName.empty()) canonicalName = query.canonicalName;
+			ttl = std::min(ttl, query.ttl);
+		}
+		else
+		{
+			if (query.status == CacheEntry::ENTRY_NOT_FOUND) notFound = true;
+			negativeTTL = std::min(negativeTTL, query.ttl);
+		}
+	}
+
+	const Params& params = _resolver._params;
+	result.complete = true;
+	if (!addresses.empty())
+	{
+		result.status = CacheEntry::ENTRY_FOUND;
+		result.entry = HostEntry(canonicalName, addresses, aliases);
+		result.ttl = clampTTL(ttl, params.maxTTL);
+	}
+	else
+	{
+		result.status = notFound ? CacheEntry::ENTRY_NOT_FOUND : CacheEntry::ENTRY_NO_ADDRESS;
+		result.pException = DNSResolver::makeException(result.status, _name);
+		if (negativeTTL == std::numeric_limits<UInt32>::max())
+			result.ttl = params.defaultNegativeTTL;
+		else
+			result.ttl = clampTTL(negativeTTL, params.maxNegativeTTL);
+	}
+}
+
+
+void DNSResolver::Lookup::fail(Result& result, std::exception_ptr pException)
+{
+	unregister();
+	_finished = true;
+	result.complete = true;
+	result.pException = pException;
+	result.ttl = Poco::Timespan();
+}
+
+
+void DNSResolver::Lookup::done(Result& result)
+{
+	if (result.complete)
+	{
+		_resolver.complete(*this, result.entry, result.status, result.pException, result.ttl);
+	}
+}
+
+
+Poco::Timespan DNSResolver::Lookup::clampTTL(UInt32 seconds, const Poco::Timespan& maxTTL) const
+{
+	Poco::Timespan ttl(static_cast<long>(std::min<UInt32>(seconds, 0x7FFFFFFF)), 0);
+	if (ttl > maxTTL) ttl = maxTTL;
+	if (ttl < _resolver._params.minTTL) ttl = _resolver._params.minTTL;
+	return ttl;
+}
+
+
+//
+// DNSResolver::CacheEntry
+//
+
+
+DNSResolver::CacheEntry::CacheEntry(const HostEntry& entry, Status status, const Poco::Timestamp& expiration):
+	_entry(entry),
+	_status(status),
+	_expiration(expiration)
+{
+}
+
+
+const HostEntry& DNSResolver::CacheEntry::entry() const
+{
+	return _entry;
+}
+
+
+DNSResolver::CacheEntry::Status DNSResolver::CacheEntry::status() const
+{
+	return _status;
+}
+
+
+const Poco::Timestamp& DNSResolver::CacheEntry::getExpiration() const
+{
+	return _expiration;
+}
+
+
+//
+// DNSResolver
+//
+
+
+DNSResolver::DNSResolver(SocketReactor& reactor):
+	DNSResolver(reactor, Params())
+{
+}
+
+
+DNSResolver::DNSResolver(SocketReactor& reactor, const Params& params):
+	_reactor(reactor),
+	_params(params)
+{
+	if (_params.nameServers.empty()) _params.nameServers = systemNameServers();
+	if (_params.cacheSize > 0)
+	{
+		std::size_t shards = std::max<std::size_t>(_params.cacheShards, 1);
+		std::size_t shardSize = std::max<std::size_t>(_params.cacheSize/shards, 1);
+		for (std::size_t i = 0; i < shards; i++)
+		{
+			_cache.push_back(std::make_unique<Cache>(shardSize));
+		}
+	}
+}
+
+
+DNSResolver::~DNSResolver()
+{
+	try
+	{
+		std::map<std::string, LookupPtr> lookups;
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			lookups.swap(_lookups);
+		}
+		for (auto& p: lookups)
+		{
+			p.second->cancel();
+			std::vector<Callback> callbacks;
+			{
+				Poco::FastMutex::ScopedLock lock(_mutex);
+				callbacks.swap(p.second->callbacks());
+			}
+			std::exception_ptr pException = std::make_exception_ptr(Poco::IOException("DNS resolver destroyed", p.first));
+			for (auto& callback: callbacks)
+			{
+				callback(HostEntry(), pException);
+			}
+		}
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+Poco::Future<HostEntry> DNSResolver::resolve(const std::string& hostname)
+{
+	Poco::Promise<HostEntry> promise;
+	resolve(hostname, [promise](const HostEntry& entry, std::exception_ptr pException)
+		{
+			if (pException)
+				promise.setException(pException);
+			else
+				promise.set(entry);
+		});
+	return promise.future();
+}
+
+
+void DNSResolver::resolve(const std::string& hostname, const Callback& callback)
+{
+	std::string name;
+	try
+	{
+		name = normalize(hostname);
+	}
+	catch (...)
+	{
+		callback(HostEntry(), std::current_exception());
+		return;
+	}
+
+	IPAddress address;
+	if (IPAddress::tryParse(name, address))
+	{
+		callback(HostEntry(name, HostEntry::AddressList(1, address)), nullptr);
+		return;
+	}
+
+	HostEntry entry;
+	std::exception_ptr pException;
+	if (lookupCache(name, entry, pException))
+	{
+		callback(entry, pException);
+		return;
+	}
+
+	start(name, callback);
+}
+
+
+void DNSResolver::start(const std::string& name, const Callback& callback)
+{
+	LookupPtr pLookup;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		auto it = _lookups.find(name);
+		if (it != _lookups.end())
+		{
+			it->second->callbacks().push_back(callback);
+			return;
+		}
+		pLookup = new Lookup(*this, name);
+		pLookup->callbacks().push_back(callback);
+		_lookups[name] = pLookup;
+	}
+	pLookup->start();
+}
+
+
+void DNSResolver::complete(Lookup& lookup, const HostEntry& entry, CacheEntry::Status status, std::exception_ptr pException, const Poco::Timespan& ttl)
+{
+	// add to the cache first, so that a lookup started concurrently
+	// either joins this lookup or finds the result in the cache
+	if (!_cache.empty() && ttl > 0 && (status == CacheEntry::ENTRY_FOUND || pException))
+	{
+		Poco::Timestamp expiration;
+		expiration += ttl;
+		cacheShard(lookup.name()).add(lookup.name(), CacheEntry(entry, status, expiration));
+	}
+
+	std::vector<Callback> callbacks;
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		auto it = _lookups.find(lookup.name());
+		if (it != _lookups.end() && it->second.get() == &lookup)
+		{
+			_lookups.erase(it);
+		}
+		callbacks.swap(lookup.callbacks());
+	}
+	for (auto& callback: callbacks)
+	{
+		try
+		{
+			callback(entry, pException);
+		}
+		catch (Poco::Exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (std::exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (...)
+		{
+			ErrorHandler::handle();
+		}
+	}
+}
+
+
+bool DNSResolver::lookupCache(const std::string& name, HostEntry& entry, std::exception_ptr& pException)
+{
+	if (_cache.empty()) return false;
+
+	Poco::SharedPtr<CacheEntry> pEntry = cacheShard(name).get(name);
+	if (!pEntry) return false;
+
+	if (pEntry->status() == CacheEntry::ENTRY_FOUND)
+		entry = pEntry->entry();
+	else
+		pException = makeException(pEntry->status(), name);
+	return true;
+}
+
+
+DNSResolver::Cache& DNSResolver::cacheShard(const std::string& name) const
+{
+	return *_cache[std::hash<std::string>()(name) % _cache.size()];
+}
+
+
+void DNSResolver::clearCache()
+{
+	for (auto& pCache: _cache)
+	{
+		pCache->clear();
+	}
+}
+
+
+std::size_t DNSResolver::cacheSize() const
+{
+	std::size_t size = 0;
+	for (const auto& pCache: _cache)
+	{
+		size += pCache->size();
+	}
+	return size;
+}
+
+
+std::size_t DNSResolver::pendingLookups() const
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	return _lookups.size();
+}
+
+
+UInt16 DNSResolver::nextId()
+{
+	// Query IDs must be unpredictable to make spoofing responses harder.
+	Poco::RandomInputStream random;
+	UInt16 id = 0;
+	random.read(reinterpret_cast<char*>(&id), sizeof(id));
+	return id;
+}
+
+
+std::string DNSResolver::normalize(const std::string& hostname)
+{
+	std::string name = DNS::isIDN(hostname) ? DNS::encodeIDN(hostname) : hostname;
+	Poco::toLowerInPlace(name);
+	if (!name.empty() && name.back() == '.') name.pop_back();
+	if (name.empty()) throw HostNotFoundException("empty host name");
+	return name;
+}
+
+
+std::exception_ptr DNSResolver::makeException(CacheEntry::Status status, const std::string& name)
+{
+	if (status == CacheEntry::ENTRY_NOT_FOUND)
+		return std::make_exception_ptr(HostNotFoundException(name));
+	else
+		return std::make_exception_ptr(NoAddressFoundException(name));
+}
+
+
+std::vector<SocketAddress> DNSResolver::systemNameServers()
+{
+	std::vector<SocketAddress> servers;
+#if defined(POCO_OS_FAMILY_UNIX)
+	try
+	{
+		if (Poco::File("/etc/resolv.conf").exists())
+		{
+			Poco::FileInputStream istr("/etc/resolv.conf");
+			std::string line;
+			while (std::getline(istr, line))
+			{
+				Poco::StringTokenizer tok(line, " \t", Poco::StringTokenizer::TOK_IGNORE_EMPTY | Poco::StringTokenizer::TOK_TRIM);
+				if (tok.count() >= 2 && tok[0] == "nameserver")
+				{
+					IPAddress address;
+					if (IPAddress::tryParse(tok[1], address))
+					{
+						servers.push_back(SocketAddress(address, 53));
+					}
+				}
+			}
+		}
+	}
+	catch (Poco::Exception&)
+	{
+	}
+#endif
+	if (servers.empty())
+	{
+		servers.push_back(SocketAddress(IPAddress("127.0.0.1"), 53));
+	}
+	return servers;
+}
+
+
+} } // namespace Poco::Net
@@ -0,0 +1,711 @@
+//
+// HPACK.cpp
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HPACK
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HPACK.h"
+#include "Poco/Net/HTTP2Frame.h"
+#include "Poco/Net/NetException.h"
+#include <algorithm>
+#include <unordered_map>
+
+
+namespace Poco {
+namespace Net {
+
+
+namespace
+{
+	struct HuffmanCode
+	{
+		Poco::UInt32 code;
+		int bits;
+	};
+
+	const HuffmanCode HUFFMAN_CODES[257] =
+		// RFC 7541, Appendix B; symbol 256 is EOS.
+	{
+	{0x00001ff8, 13}, {0x007fffd8, 23}, {0x0fffffe2, 28}, {0x0fffffe3, 28},
+	{0x0fffffe4, 28}, {0x0fffffe5, 28}, {0x0fffffe6, 28}, {0x0fffffe7, 28},
+	{0x0fffffe8, 28}, {0x00ffffea, 24}, {0x3ffffffc, 30}, {0x0fffffe9, 28},
+	{0x0fffffea, 28}, {0x3ffffffd, 30}, {0x0fffffeb, 28}, {0x0fffffec, 28},
+	{0x0fffffed, 28}, {0x0fffffee, 28}, {0x0fffffef, 28}, {0x0ffffff0, 28},
+	{0x0ffffff1, 28}, {0x0ffffff2, 28}, {0x3ffffffe, 30}, {0x0ffffff3, 28},
+	{0x0ffffff4, 28}, {0x0ffffff5, 28}, {0x0ffffff6, 28}, {0x0ffffff7, 28},
+	{0x0ffffff8, 28}, {0x0ffffff9, 28}, {0x0ffffffa, 28}, {0x0ffffffb, 28},
+	{0x00000014,  6}, {0x000003f8, 10}, {0x000003f9, 10}, {0x00000ffa, 12},
+	{0x00001ff9, 13}, {0x00000015,  6}, {0x000000f8,  8}, {0x000007fa, 11},
+	{0x000003fa, 10}, {0x000003fb, 10}, {0x000000f9,  8}, {0x000007fb, 11},
+	{0x000000fa,  8}, {0x00000016,  6}, {0x00000017,  6}, {0x00000018,  6},
+	{0x00000000,  5}, {0x00000001,  5}, {0x00000002,  5}, {0x00000019,  6},
+	{0x0000001a,  6}, {0x0000001b,  6}, {0x0000001c,  6}, {0x0000001d,  6},
+	{0x0000001e,  6}, {0x0000001f,  6}, {0x0000005c,  7}, {0x000000fb,  8},
+	{0x00007ffc, 15}, {0x00000020,  6}, {0x00000ffb, 12}, {0x000003fc, 10},
+	{0x00001ffa, 13}, {0x00000021,  6}, {0x0000005d,  7}, {0x0000005e,  7},
+	{0x0000005f,  7}, {0x00000060,  7}, {0x00000061,  7}, {0x00000062,  7},
+	{0x00000063,  7}, {0x00000064,  7}, {0x00000065,  7}, {0x00000066,  7},
+	{0x00000067,  7}, {0x00000068,  7}, {0x00000069,  7}, {0x0000006a,  7},
+	{0x0000006b,  7}, {0x0000006c,  7}, {0x0000006d,  7}, {0x0000006e,  7},
+	{0x0000006f,  7}, {0x00000070,  7}, {0x00000071,  7}, {0x00000072,  7},
+	{0x000000fc,  8}, {0x00000073,  7}, {0x000000fd,  8}, {0x00001ffb, 13},
+	{0x0007fff0, 19}, {0x00001ffc, 13}, {0x00003ffc, 14}, {0x00000022,  6},
+	{0x00007ffd, 15}, {0x00000003,  5}, {0x00000023,  6}, {0x00000004,  5},
+	{0x00000024,  6}, {0x00000005,  5}, {0x00000025,  6}, {0x00000026,  6},
+	{0x00000027,  6}, {0x00000006,  5}, {0x00000074,  7}, {0x00000075,  7},
+	{0x00000028,  6}, {0x00000029,  6}, {0x0000002a,  6}, {0x00000007,  5},
+	{0x0000002b,  6}, {0x00000076,  7}, {0x0000002c,  6}, {0x00000008,  5},
+	{0x00000009,  5}, {0x0000002d,  6}, {0x00000077,  7}, {0x00000078,  7},
+	{0x00000079,  7}, {0x0000007a,  7}, {0x0000007b,  7}, {0x00007ffe, 15},
+	{0x000007fc, 11}, {0x00003ffd, 14}, {0x00001ffd, 13}, {0x0ffffffc, 28},
+	{0x000fffe6, 20}, {0x003fffd2, 22}, {0x000fffe7, 20}, {0x000fffe8, 20},
+	{0x003fffd3, 22}, {0x003fffd4, 22}, {0x003fffd5, 22}, {0x007fffd9, 23},
+	{0x003fffd6, 22}, {0x007fffda, 23}, {0x007fffdb, 23}, {0x007fffdc, 23},
+	{0x007fffdd, 23}, {0x007fffde, 23}, {0x00ffffeb, 24}, {0x007fffdf, 23},
+	{0x00ffffec, 24}, {0x00ffffed, 24}, {0x003fffd7, 22}, {0x007fffe0, 23},
+	{0x00ffffee, 24}, {0x007fffe1, 23}, {0x007fffe2, 23}, {0x007fffe3, 23},
+	{0x007fffe4, 23}, {0x001fffdc, 21}, {0x003fffd8, 22}, {0x007fffe5, 23},
+	{0x003fffd9, 22}, {0x007fffe6, 23}, {0x007fffe7, 23}, {0x00ffffef, 24},
+	{0x003fffda, 22}, {0x001fffdd, 21}, {0x000fffe9, 20}, {0x003fffdb, 22},
+	{0x003fffdc, 22}, {0x007fffe8, 23}, {0x007fffe9, 23}, {0x001fffde, 21},
+	{0x007fffea, 23}, {0x003fffdd, 22}, {0x003fffde, 22}, {0x00fffff0, 24},
+	{0x001fffdf, 21}, {0x003fffdf, 22}, {0x007fffeb, 23}, {0x007fffec, 23},
+	{0x001fffe0, 21}, {0x001fffe1, 21}, {0x003fffe0, 22}, {0x001fffe2, 21},
+	{0x007fffed, 23}, {0x003fffe1, 22}, {0x007fffee, 23}, {0x007fffef, 23},
+	{0x000fffea, 20}, {0x003fffe2, 22}, {0x003fffe3, 22}, {0x003fffe4, 22},
+	{0x007ffff0, 23}, {0x003fffe5, 22}, {0x003fffe6, 22}, {0x007ffff1, 23},
+	{0x03ffffe0, 26}, {0x03ffffe1, 26}, {0x000fffeb, 20}, {0x0007fff1, 19},
+	{0x003fffe7, 22}, {0x007ffff2, 23}, {0x003fffe8, 22}, {0x01ffffec, 25},
+	{0x03ffffe2, 26}, {0x03ffffe3, 26}, {0x03ffffe4, 26}, {0x07ffffde, 27},
+	{0x07ffffdf, 27}, {0x03ffffe5, 26}, {0x00fffff1, 24}, {0x01ffffed, 25},
+	{0x0007fff2, 19}, {0x001fffe3, 21}, {0x03ffffe6, 26}, {0x07ffffe0, 27},
+	{0x07ffffe1, 27}, {0x03ffffe7, 26}, {0x07ffffe2, 27}, {0x00fffff2, 24},
+	{0x001fffe4, 21}, {0x001fffe5, 21}, {0x03ffffe8, 26}, {0x03ffffe9, 26},
+	{0x0ffffffd, 28}, {0x07ffffe3, 27}, {0x07ffffe4, 27}, {0x07ffffe5, 27},
+	{0x000fffec, 20}, {0x00fffff3, 24}, {0x000fffed, 20}, {0x001fffe6, 21},
+	{0x003fffe9, 22}, {0x001fffe7, 21}, {0x001fffe8, 21}, {0x007ffff3, 23},
+	{0x003fffea, 22}, {0x003fffeb, 22}, {0x01ffffee, 25}, {0x01ffffef, 25},
+	{0x00fffff4, 24}, {0x00fffff5, 24}, {0x03ffffea, 26}, {0x007ffff4, 23},
+	{0x03ffffeb, 26}, {0x07ffffe6, 27}, {0x03ffffec, 26}, {0x03ffffed, 26},
+	{0x07ffffe7, 27}, {0x07ffffe8, 27}, {0x07ffffe9, 27}, {0x07ffffea, 27},
+	{0x07ffffeb, 27}, {0x0ffffffe, 28}, {0x07ffffec, 27}, {0x07ffffed, 27},
+	{0x07ffffee, 27}, {0x07ffffef, 27}, {0x07fffff0, 27}, {0x03ffffee, 26},
+	{0x3fffffff, 30},
+	};
+
+	class HuffmanDecoder
+		/// A finite state machine for decoding Huffman encoded strings,
+		/// consuming four bits at a time. States are the inner nodes of
+		/// the code tree, state 0 is the root.
+	{
+	public:
+		enum
+		{
+			FLAG_SYMBOL = 1,
+			FLAG_FAIL   = 2,
+			FLAG_ACCEPT = 4
+		};
+
+		struct Transition
+		{
+			Poco::UInt8 state;
+			Poco::UInt8 flags;
+			Poco::UInt8 symbol;
+		};
+
+		HuffmanDecoder()
+		{
+			struct Node
+			{
+				int children[2] = {-1, -1};
+				int symbol = -1;
+				int depth = 0;
+				bool allOnes = true;
+			};
+			std::vector<Node> nodes(1);
+			for (int sym = 0; sym < 257; sym++)
+			{
+				int node = 0;
+				for (int i = HUFFMAN_CODES[sym].bits - 1; i >= 0; i--)
+				{
+					int bit = (HUFFMAN_CODES[sym].code >> i) & 1;
+					if (nodes[node].children[bit] < 0)
+					{
+						Node child;
+						child.depth = nodes[node].depth + 1;
+						child.allOnes = nodes[node].allOnes && bit == 1;
+						nodes[node].children[bit] = static_cast<int>(nodes.size());
+						nodes.push_back(child);
+					}
+					node = nodes[node].children[bit];
+				}
+				nodes[node].symbol = sym;
+			}
+
+			// number the inner nodes
+			std::vector<int> stateOf(nodes.size(), -1);
+			std::vector<int> nodeOf;
+			for (std::size_t i = 0; i < nodes.size(); i++)
+			{
+				if (nodes[i].symbol < 0)
+				{
+					stateOf[i] = static_cast<int>(nodeOf.size());
+					nodeOf.push_back(static_cast<int>(i));
+				}
+			}
+			poco_assert (nodeOf.size() == 256);
+
+			for (int state = 0; state < 256; state++)
+			{
+				for (int nibble = 0; nibble < 16; nibble++)
+				{
+					Transition& t = _transitions[state][nibble];
+					t = Transition{0, 0, 0};
+					int node = nodeOf[state];
+					for (int i = 3; i >= 0; i--)
+					{
+						node = nodes[node].children[(nibble >> i) & 1];
+						if (nodes[node].symbol == 256)
+						{
+							t.flags = FLAG_FAIL;
+							break;
+						}
+						else if (nodes[node].symbol >= 0)
+						{
+							t.flags |= FLAG_SYMBOL;
+							t.symbol = static_cast<Poco::UInt8>(nodes[node].symbol);
+							node = 0;
+						}
+					}
+					if (!(t.flags & FLAG_FAIL))
+					{
+						t.state = static_cast<Poco::UInt8>(stateOf[node]);
+						// padding must be shorter than 8 bits and consist of ones
+						if (nodes[node].allOnes && nodes[node].depth < 8)
+							t.flags |= FLAG_ACCEPT;
+					}
+				}
+			}
+		}
+
+		void decode(const char* pData, std::size_t length, std::string& str) const
+		{
+			const unsigned char* p = reinterpret_cast<const unsigned char*>(pData);
+			const unsigned char* pEnd = p + length;
+			int state = 0;
+			bool accept = true;
+			while (p != pEnd)
+			{
+				unsigned char c = *p++;
+				const Transition& hi = _transitions[state][c >> 4];
+				if (hi.flags & FLAG_FAIL) throw HTTP2Exception("Invalid Huffman code", HTTP2Frame::ERROR_COMPRESSION);
+				if (hi.flags & FLAG_SYMBOL) str += static_cast<char>(hi.symbol);
+				const Transition& lo = _transitions[hi.state][c & 0x0f];
+				if (lo.flags & FLAG_FAIL) throw HTTP2Exception("Invalid Huffman code", HTTP2Frame::ERROR_COMPRESSION);
+				if (lo.flags & FLAG_SYMBOL) str += static_cast<char>(lo.symbol);
+				state = lo.state;
+				accept = (lo.flags & FLAG_ACCEPT) != 0;
+			}
+			if (!accept) throw HTTP2Exception("Invalid Huffman padding", HTTP2Frame::ERROR_COMPRESSION);
+		}
+
+	private:
+		Transition _transitions[256][16];
+	};
+
+	const HuffmanDecoder& huffmanDecoder()
+	{
+		static const HuffmanDecoder decoder;
+		return decoder;
+	}
+
+	const HPACKHeaderField STATIC_TABLE[HPACKTable::STATIC_TABLE_SIZE] =
+		// RFC 7541, Appendix A
+	{
+		{":authority", ""},
+		{":method", "GET"},
+		{":method", "POST"},
+		{":path", "/"},
+		{":path", "/index.html"},
+		{":scheme", "http"},
+		{":scheme", "https"},
+		{":status", "200"},
+		{":status", "204"},
+		{":status", "206"},
+		{":status", "304"},
+		{":status", "400"},
+		{":status", "404"},
+		{":status", "500"},
+		{"accept-charset", ""},
+		{"accept-encoding", "gzip, deflate"},
+		{"accept-language", ""},
+		{"accept-ranges", ""},
+		{"accept", ""},
+		{"access-control-allow-origin", ""},
+		{"age", ""},
+		{"allow", ""},
+		{"authorization", ""},
+		{"cache-control", ""},
+		{"content-disposition", ""},
+		{"content-encoding", ""},
+		{"content-language", ""},
+		{"content-length", ""},
+		{"content-location", ""},
+		{"content-range", ""},
+		{"content-type", ""},
+		{"cookie", ""},
+		{"date", ""},
+		{"etag", ""},
+		{"expect", ""},
+		{"expires", ""},
+		{"from", ""},
+		{"host", ""},
+		{"if-match", ""},
+		{"if-modified-since", ""},
+		{"if-none-match", ""},
+		{"if-range", ""},
+		{"if-unmodified-since", ""},
+		{"last-modified", ""},
+		{"link", ""},
+		{"location", ""},
+		{"max-forwards", ""},
+		{"proxy-authenticate", ""},
+		{"proxy-authorization", ""},
+		{"range", ""},
+		{"referer", ""},
+		{"refresh", ""},
+		{"retry-after", ""},
+		{"server", ""},
+		{"set-cookie", ""},
+		{"strict-transport-security", ""},
+		{"transfer-encoding", ""},
+		{"user-agent", ""},
+		{"vary", ""},
+		{"via", ""},
+		{"www-authenticate", ""}
+	};
+
+	const std::unordered_map<std::string, std::size_t>& staticNameIndex()
+		/// Maps names to the index of their first entry in the static table.
+	{
+		static const std::unordered_map<std::string, std::size_t> index = []()
+		{
+			std::unordered_map<std::string, std::size_t> m;
+			for (std::size_t i = 0; i < HPACKTable::STATIC_TABLE_SIZE; i++)
+			{
+				m.emplace(STATIC_TABLE[i].first, i + 1);
+			}
+			return m;
+		}();
+		return index;
+	}
+
+	inline std::size_t entrySize(const std::string& name, const std::string& value)
+	{
+		return name.size() + value.size() + HPACKTable::ENTRY_OVERHEAD;
+	}
+}
+
+
+//
+// HPACKHuffman
+//
+
+
+std::size_t HPACKHuffman::encodedLength(const std::string& str)
+{
+	std::size_t bits = 0;
+	for (unsigned char c: str)
+	{
+		bits += HUFFMAN_CODES[c].bits;
+	}
+	return (bits + 7)/8;
+}
+
+
+void HPACKHuffman::encode(const std::string& str, std::string& buffer)
+{
+	Poco::UInt64 acc = 0;
+	int bits = 0;
+	for (unsigned char c: str)
+	{
+		const HuffmanCode& hc = HUFFMAN_CODES[c];
+		acc = (acc << hc.bits) | hc.code;
+		bits += hc.bits;
+		while (bits >= 8)
+		{
+			bits -= 8;
+			buffer += static_cast<char>(acc >> bits);
+		}
+	}
+	if (bits > 0)
+	{
+		// pad with the most significant bits of EOS (all ones)
+		acc = (acc << (8 - bits)) | (0xff >> bits);
+		buffer += static_cast<char>(acc);
+	}
+}
+
+
+void HPACKHuffman::decode(const char* pData, std::size_t length, std::string& str)
+{
+	huffmanDecoder().decode(pData, length, str);
+}
+
+
+//
+// HPACKTable
+//
+
+
+HPACKTable::HPACKTable(std::size_t maxSize):
+	_size(0),
+	_maxSize(maxSize)
+{
+}
+
+
+HPACKTable::~HPACKTable()
+{
+}
+
+
+const HPACKHeaderField& HPACKTable::get(std::size_t index) const
+{
+	if (index >= 1 && index <= STATIC_TABLE_SIZE)
+		return STATIC_TABLE[index - 1];
+	else if (index > STATIC_TABLE_SIZE && index - STATIC_TABLE_SIZE <= _dynamicTable.size())
+		return _dynamicTable[index - STATIC_TABLE_SIZE - 1];
+	else
+		throw HTTP2Exception("Invalid HPACK table index", HTTP2Frame::ERROR_COMPRESSION);
+}
+
+
+void HPACKTable::add(const std::string& name, const std::string& value)
+{
+	std::size_t size = entrySize(name, value);
+	if (size > _maxSize)
+	{
+		evict(0);
+	}
+	else
+	{
+		evict(_maxSize - size);
+		_dynamicTable.emplace_front(name, value);
+		_size += size;
+	}
+}
+
+
+std::size_t HPACKTable::find(const std::string& name, const std::string& value, bool& valueMatch) const
+{
+	valueMatch = false;
+	std::size_t nameIndex = 0;
+	const auto& staticIndex = staticNameIndex();
+	auto it = staticIndex.find(name);
+	if (it != staticIndex.end())
+	{
+		nameIndex = it->second;
+		for (std::size_t i = nameIndex; i <= STATIC_TABLE_SIZE && STATIC_TABLE[i - 1].first == name; i++)
+		{
+			if (STATIC_TABLE[i - 1].second == value)
+			{
+				valueMatch = true;
+				return i;
+			}
+		}
+	}
+	for (std::size_t i = 0; i < _dynamicTable.size(); i++)
+	{
+		const HPACKHeaderField& field = _dynamicTable[i];
+		if (field.first == name)
+		{
+			if (field.second == value)
+			{
+				valueMatch = true;
+				return i + STATIC_TABLE_SIZE + 1;
+			}
+			if (nameIndex == 0) nameIndex = i + STATIC_TABLE_SIZE + 1;
+		}
+	}
+	return nameIndex;
+}
+
+
+void HPACKTable::setMaxSize(std::size_t maxSize)
+{
+	_maxSize = maxSize;
+	evict(maxSize);
+}
+
+
+void HPACKTable::evict(std::size_t maxSize)
+{
+	while (_size > maxSize)
+	{
+		const HPACKHeaderField& field = _dynamicTable.back();
+		_size -= entrySize(field.first, field.second);
+		_dynamicTable.pop_back();
+	}
+}
+
+
+//
+// HPACKEncoder
+//
+
+
+HPACKEncoder::HPACKEncoder(std::size_t maxTableSize):
+	_table(HPACKTable::DEFAULT_TABLE_SIZE),
+	_maxTableSize(maxTableSize),
+	_newTableSize(HPACKTable::DEFAULT_TABLE_SIZE),
+	_minTableSize(HPACKTable::DEFAULT_TABLE_SIZE),
+	_sizeUpdatePending(false)
+{
+	if (maxTableSize < HPACKTable::DEFAULT_TABLE_SIZE)
+	{
+		setMaxTableSize(maxTableSize);
+	}
+}
+
+
+HPACKEncoder::~HPACKEncoder()
+{
+}
+
+
+void HPACKEncoder::setMaxTableSize(std::size_t maxTableSize)
+{
+	std::size_t size = std::min(maxTableSize, _maxTableSize);
+	if (_sizeUpdatePending)
+	{
+		_minTableSize = std::min(_minTableSize, size);
+	}
+	else
+	{
+		if (size == _table.maxSize()) return;
+		_minTableSize = size;
+	}
+	_newTableSize = size;
+	_sizeUpdatePending = true;
+}
+
+
+void HPACKEncoder::encode(const HPACKHeaderList& headers, std::string& block)
+{
+	if (_sizeUpdatePending)
+	{
+		// RFC 7541, Section 4.2: if the size has been reduced and increased
+		// again, the smallest size must be signaled first.
+		if (_minTableSize < _newTableSize)
+		{
+			encodeInteger(_minTableSize, 5, 0x20, block);
+			_table.setMaxSize(_minTableSize);
+		}
+		encodeInteger(_newTableSize, 5, 0x20, block);
+		_table.setMaxSize(_newTableSize);
+		_sizeUpdatePending = false;
+	}
+	for (const auto& field: headers)
+	{
+		encodeField(field.first, field.second, block);
+	}
+}
+
+
+void HPACKEncoder::encodeField(const std::string& name, const std::string& value, std::string& block)
+{
+	bool valueMatch;
+	std::size_t index = _table.find(name, value, valueMatch);
+	Indexing mode = indexing(name, value);
+	if (valueMatch && mode != INDEXING_NEVER)
+	{
+		encodeInteger(index, 7, 0x80, block);
+		return;
+	}
+	switch (mode)
+	{
+	case INDEXING_INCREMENTAL:
+		encodeInteger(index, 6, 0x40, block);
+		break;
+	case INDEXING_NONE:
+		encodeInteger(index, 4, 0x00, block);
+		break;
+	case INDEXING_NEVER:
+		encodeInteger(index, 4, 0x10, block);
+		break;
+	}
+	if (index == 0) encodeString(name, block);
+	encodeString(value, block);
+	if (mode == INDEXING_INCREMENTAL)
+	{
+		_table.add(name, value);
+	}
+}
+
+
+HPACKEncoder::Indexing HPACKEncoder::indexing(const std::string& name, const std::string& value)
+{
+	if (name == "authorization" || name == "proxy-authorization" || name == "set-cookie" || (name == "cookie" && value.size() < 20))
+		return INDEXING_NEVER;
+	else if (name == "content-length" || name == ":path" || name == "etag" || name == "location" ||
+		name == "last-modified" || name == "content-range" || name == "if-modified-since" || name == "if-none-match" ||
+		entrySize(name, value) > HPACKTable::DEFAULT_TABLE_SIZE/4)
+		return INDEXING_NONE;
+	else
+		return INDEXING_INCREMENTAL;
+}
+
+
+void HPACKEncoder::encodeInteger(Poco::UInt64 value, int prefixBits, int flags, std::string& buffer)
+{
+	const Poco::UInt64 max = (1u << prefixBits) - 1;
+	if (value < max)
+	{
+		buffer += static_cast<char>(flags | static_cast<int>(value));
+	}
+	else
+	{
+		buffer += static_cast<char>(flags | static_cast<int>(max));
+		value -= max;
+		while (value >= 128)
+		{
+			buffer += static_cast<char>((value & 0x7f) | 0x80);
+			value >>= 7;
+		}
+		buffer += static_cast<char>(value);
+	}
+}
+
+
+void HPACKEncoder::encodeString(const std::string& str, std::string& buffer)
+{
+	std::size_t huffmanLength = HPACKHuffman::encodedLength(str);
+	if (huffmanLength < str.size())
+	{
+		encodeInteger(huffmanLength, 7, 0x80, buffer);
+		HPACKHuffman::encode(str, buffer);
+	}
+	else
+	{
+		encodeInteger(str.size(), 7, 0x00, buffer);
+		buffer += str;
+	}
+}
+
+
+//
+// HPACKDecoder
+//
+
+
+HPACKDecoder::HPACKDecoder(std::size_t maxTableSize):
+	_table(maxTableSize),
+	_maxTableSize(maxTableSize),
+	_maxHeaderListSize(DEFAULT_MAX_HEADER_LIST_SIZE)
+{
+}
+
+
+HPACKDecoder::~HPACKDecoder()
+{
+}
+
+
+void HPACKDecoder::setMaxHeaderListSize(std::size_t size)
+{
+	_maxHeaderListSize = size;
+}
+
+
+void HPACKDecoder::decode(const char* pBlock, std::size_t length, HPACKHeaderList& headers)
+{
+	const char* p = pBlock;
+	const char* pEnd = pBlock + length;
+	std::size_t listSize = 0;
+	bool first = true;
+	while (p != pEnd)
+	{
+		unsigned char c = static_cast<unsigned char>(*p);
+		if (c & 0x80)
+		{
+			// indexed header field
+			std::size_t index = static_cast<std::size_t>(decodeInteger(p, pEnd, 7));
+			if (index == 0) throw HTTP2Exception("Invalid HPACK table index", HTTP2Frame::ERROR_COMPRESSION);
+			headers.push_back(_table.get(index));
+		}
+		else if ((c & 0xe0) == 0x20)
+		{
+			// dynamic table size update, only allowed at the beginning of a header block
+			if (!first) throw HTTP2Exception("Misplaced HPACK dynamic table size update", HTTP2Frame::ERROR_COMPRESSION);
+			Poco::UInt64 size = decodeInteger(p, pEnd, 5);
+			if (size > _maxTableSize) throw HTTP2Exception("Invalid HPACK dynamic table size update", HTTP2Frame::ERROR_COMPRESSION);
+			_table.setMaxSize(static_cast<std::size_t>(size));
+			continue;
+		}
+		else
+		{
+			// literal header field with incremental indexing (01), without indexing (0000) or never indexed (0001)
+			bool incremental = (c & 0xc0) == 0x40;
+			std::size_t index = static_cast<std::size_t>(decodeInteger(p, pEnd, incremental ? 6 : 4));
+			HPACKHeaderField field;
+			if (index == 0)
+				decodeString(p, pEnd, field.first);
+			else
+				field.first = _table.get(index).first;
+			decodeString(p, pEnd, field.second);
+			if (incremental) _table.add(field.first, field.second);
+			headers.push_back(std::move(field));
+		}
+		first = false;
+		const HPACKHeaderField& field = headers.back();
+		listSize += entrySize(field.first, field.second);
+		if (listSize > _maxHeaderListSize) throw HTTP2Exception("Header list too large", HTTP2Frame::ERROR_ENHANCE_YOUR_CALM);
+	}
+}
+
+
+Poco::UInt64 HPACKDecoder::decodeInteger(const char*& pData, const char* pEnd, int prefixBits)
+{
+	if (pData == pEnd) throw HTTP2Exception("Truncated HPACK integer", HTTP2Frame::ERROR_COMPRESSION);
+	const Poco::UInt64 max = (1u << prefixBits) - 1;
+	Poco::UInt64 value = static_cast<unsigned char>(*pData++) & max;
+	if (value < max) return value;
+	int shift = 0;
+	for (;;)
+	{
+		if (pData == pEnd) throw HTTP2Exception("Truncated HPACK integer", HTTP2Frame::ERROR_COMPRESSION);
+		unsigned char c = static_cast<unsigned char>(*pData++);
+		value += static_cast<Poco::UInt64>(c & 0x7f) << shift;
+		if (!(c & 0x80)) break;
+		shift += 7;
+		if (shift > 28) throw HTTP2Exception("HPACK integer too large", HTTP2Frame::ERROR_COMPRESSION);
+	}
+	return value;
+}
+
+
+void HPACKDecoder::decodeString(const char*& pData, const char* pEnd, std::string& str)
+{
+	if (pData == pEnd) throw HTTP2Exception("Truncated HPACK string", HTTP2Frame::ERROR_COMPRESSION);
+	bool huffman = (static_cast<unsigned char>(*pData) & 0x80) != 0;
+	Poco::UInt64 length = decodeInteger(pData, pEnd, 7);
+	if (length > static_cast<Poco::UInt64>(pEnd - pData)) throw HTTP2Exception("Truncated HPACK string", HTTP2Frame::ERROR_COMPRESSION);
+	std::size_t n = static_cast<std::size_t>(length);
+	if (huffman)
+		HPACKHuffman::decode(pData, n, str);
+	else
+		str.assign(pData, n);
+	pData += n;
+}
+
+
+} } // namespace Poco::Net
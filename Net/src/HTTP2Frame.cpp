@@ -0,0 +1,81 @@
+//
+// HTTP2Frame.cpp
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2Frame
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTP2Frame.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+const std::string HTTP2Frame::CONNECTION_PREFACE("PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n");
+
+
+HTTP2Frame::HTTP2Frame():
+	_length(0),
+	_type(FRAME_DATA),
+	_flags(0),
+	_streamId(0)
+{
+}
+
+
+HTTP2Frame::HTTP2Frame(Poco::UInt32 length, Type type, int flags, Poco::UInt32 streamId):
+	_length(length),
+	_type(type),
+	_flags(flags),
+	_streamId(streamId)
+{
+	poco_assert (length <= MAX_MAX_FRAME_SIZE);
+}
+
+
+HTTP2Frame::~HTTP2Frame()
+{
+}
+
+
+void HTTP2Frame::read(const char* pHeader)
+{
+	const unsigned char* p = reinterpret_cast<const unsigned char*>(pHeader);
+	_length   = (static_cast<Poco::UInt32>(p[0]) << 16) | (static_cast<Poco::UInt32>(p[1]) << 8) | p[2];
+	_type     = static_cast<Type>(p[3]);
+	_flags    = p[4];
+	_streamId = readUInt32(pHeader + 5) & 0x7fffffff;
+}
+
+
+void HTTP2Frame::write(char* pHeader) const
+{
+	pHeader[0] = static_cast<char>(_length >> 16);
+	pHeader[1] = static_cast<char>(_length >> 8);
+	pHeader[2] = static_cast<char>(_length);
+	pHeader[3] = static_cast<char>(_type);
+	pHeader[4] = static_cast<char>(_flags);
+	pHeader[5] = static_cast<char>((_streamId >> 24) & 0x7f);
+	pHeader[6] = static_cast<char>(_streamId >> 16);
+	pHeader[7] = static_cast<char>(_streamId >> 8);
+	pHeader[8] = static_cast<char>(_streamId);
+}
+
+
+void HTTP2Frame::append(std::string& buffer) const
+{
+	char header[HEADER_SIZE];
+	write(header);
+	buffer.append(header, HEADER_SIZE);
+}
+
+
+} } // namespace Poco::Net
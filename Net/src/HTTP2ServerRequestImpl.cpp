@@ -0,0 +1,116 @@
+//
+// HTTP2ServerRequestImpl.cpp
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2ServerRequestImpl
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTP2ServerRequestImpl.h"
+#include "Poco/Net/HTTP2ServerSession.h"
+#include "Poco/Net/HTTP2Stream.h"
+
+
+using namespace std::string_literals;
+
+
+namespace Poco {
+namespace Net {
+
+
+HTTP2ServerRequestImpl::HTTP2ServerRequestImpl(HTTP2ServerResponseImpl& response, HTTP2ServerStream& stream):
+	_response(response),
+	_stream(stream),
+	_pStream(nullptr)
+{
+	response.attachRequest(this);
+
+	setVersion(HTTP_2_0);
+	std::string authority;
+	std::string cookies;
+	for (const auto& field: stream.headers())
+	{
+		const std::string& name = field.first;
+		if (!name.empty() && name[0] == ':')
+		{
+			if (name == ":method")
+				setMethod(field.second);
+			else if (name == ":path")
+				setURI(field.second);
+			else if (name == ":scheme")
+				_scheme = field.second;
+			else if (name == ":authority")
+				authority = field.second;
+		}
+		else if (name == "cookie")
+		{
+			// RFC 9113, Section 8.2.3
+			if (!cookies.empty()) cookies += "; ";
+			cookies += field.second;
+		}
+		else add(name, field.second);
+	}
+	if (!cookies.empty()) set("Cookie"s, cookies);
+	if (!authority.empty() && !has(HOST)) set(HOST, authority);
+
+	_pStream = new HTTP2InputStream(stream);
+}
+
+
+HTTP2ServerRequestImpl::~HTTP2ServerRequestImpl()
+{
+	delete _pStream;
+}
+
+
+std::istream& HTTP2ServerRequestImpl::stream()
+{
+	poco_check_ptr (_pStream);
+
+	return *_pStream;
+}
+
+
+const SocketAddress& HTTP2ServerRequestImpl::clientAddress() const
+{
+	return _stream.session().clientAddress();
+}
+
+
+const SocketAddress& HTTP2ServerRequestImpl::serverAddress() const
+{
+	return _stream.session().serverAddress();
+}
+
+
+const HTTPServerParams& HTTP2ServerRequestImpl::serverParams() const
+{
+	return _stream.session().serverParams();
+}
+
+
+HTTPServerResponse& HTTP2ServerRequestImpl::response() const
+{
+	return _response;
+}
+
+
+bool HTTP2ServerRequestImpl::secure() const
+{
+	return _stream.session().secure();
+}
+
+
+Poco::UInt32 HTTP2ServerRequestImpl::streamId() const
+{
+	return _stream.id();
+}
+
+
+} } // namespace Poco::Net
@@ -0,0 +1,238 @@
+//
+// HTTP2ServerResponseImpl.cpp
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2ServerResponseImpl
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTP2ServerResponseImpl.h"
+#include "Poco/Net/HTTP2ServerRequestImpl.h"
+#include "Poco/Net/HTTP2ServerSession.h"
+#include "Poco/Net/HTTP2Stream.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/File.h"
+#include "Poco/FileStream.h"
+#include "Poco/NullStream.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/DateTimeFormatter.h"
+#include "Poco/DateTimeFormat.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/String.h"
+
+
+using Poco::File;
+using Poco::Timestamp;
+using Poco::DateTimeFormatter;
+using Poco::DateTimeFormat;
+using Poco::OpenFileException;
+using namespace std::string_literals;
+
+
+namespace Poco {
+namespace Net {
+
+
+namespace
+{
+	bool isConnectionSpecific(const std::string& name)
+		/// Returns true for header fields that must not be used with HTTP/2
+		/// (RFC 9113, Section 8.2.2). name must be lower case.
+	{
+		return name == "connection" || name == "keep-alive" || name == "proxy-connection" ||
+			name == "transfer-encoding" || name == "upgrade";
+	}
+
+	void appendFields(const MessageHeader& header, HPACKHeaderList& fields)
+	{
+		for (const auto& field: header)
+		{
+			std::string name = Poco::toLower(field.first);
+			if (!isConnectionSpecific(name))
+			{
+				fields.emplace_back(std::move(name), field.second);
+			}
+		}
+	}
+}
+
+
+HTTP2ServerResponseImpl::HTTP2ServerResponseImpl(HTTP2ServerStream& stream):
+	_stream(stream),
+	_pRequest(nullptr),
+	_pStream(nullptr),
+	_pOutputStream(nullptr),
+	_sent(false),
+	_finished(false)
+{
+}
+
+
+HTTP2ServerResponseImpl::~HTTP2ServerResponseImpl()
+{
+	delete _pStream;
+}
+
+
+void HTTP2ServerResponseImpl::sendContinue()
+{
+	HPACKHeaderList fields;
+	fields.emplace_back(":status"s, "100"s);
+	_stream.sendHeaders(fields, false);
+}
+
+
+std::ostream& HTTP2ServerResponseImpl::send()
+{
+	poco_assert (!_sent);
+
+	if (noBody())
+	{
+		sendHeader(true);
+		_pStream = new Poco::NullOutputStream;
+	}
+	else
+	{
+		sendHeader(false);
+		_pOutputStream = new HTTP2OutputStream(_stream);
+		_pStream = _pOutputStream;
+	}
+	return *_pStream;
+}
+
+
+void HTTP2ServerResponseImpl::sendFile(const std::string& path, const std::string& mediaType)
+{
+	poco_assert (!_sent);
+
+	File f(path);
+	Timestamp dateTime    = f.getLastModified();
+	File::FileSize length = f.getSize();
+	set("Last-Modified"s, DateTimeFormatter::format(dateTime, DateTimeFormat::HTTP_FORMAT));
+#if defined(POCO_HAVE_INT64)
+	setContentLength64(length);
+#else
+	setContentLength(static_cast<int>(length));
+#endif
+	setContentType(mediaType);
+	setChunkedTransferEncoding(false);
+
+	Poco::FileInputStream istr(path);
+	if (istr.good())
+	{
+		std::ostream& ostr = send();
+		if (_pOutputStream)
+		{
+			Poco::StreamCopier::copyStream(istr, ostr, HTTP2Frame::DEFAULT_MAX_FRAME_SIZE);
+		}
+	}
+	else throw OpenFileException(path);
+}
+
+
+void HTTP2ServerResponseImpl::sendBuffer(const void* pBuffer, std::size_t length)
+{
+	poco_assert (!_sent);
+
+	setContentLength(static_cast<int>(length));
+	setChunkedTransferEncoding(false);
+
+	if (noBody() || length == 0)
+	{
+		sendHeader(true);
+	}
+	else
+	{
+		HPACKHeaderList fields;
+		headerFields(fields);
+		_sent = true;
+		_stream.sendResponse(fields, static_cast<const char*>(pBuffer), length);
+	}
+}
+
+
+void HTTP2ServerResponseImpl::redirect(const std::string& uri, HTTPStatus status)
+{
+	poco_assert (!_sent);
+
+	setContentLength(0);
+	setChunkedTransferEncoding(false);
+
+	setStatusAndReason(status);
+	set("Location"s, uri);
+
+	sendHeader(true);
+}
+
+
+void HTTP2ServerResponseImpl::requireAuthentication(const std::string& realm)
+{
+	poco_assert (!_sent);
+
+	setStatusAndReason(HTTPResponse::HTTP_UNAUTHORIZED);
+	std::string auth("Basic realm=\"");
+	auth.append(realm);
+	auth.append("\"");
+	set("WWW-Authenticate"s, auth);
+}
+
+
+void HTTP2ServerResponseImpl::finish()
+{
+	if (_finished) return;
+	_finished = true;
+
+	if (!_sent)
+	{
+		sendHeader(true);
+	}
+	else if (_pOutputStream)
+	{
+		if (_trailer.empty())
+		{
+			_pOutputStream->rdbuf()->close(true);
+		}
+		else
+		{
+			_pOutputStream->rdbuf()->close(false);
+			HPACKHeaderList fields;
+			appendFields(_trailer, fields);
+			_stream.sendHeaders(fields, true);
+		}
+	}
+}
+
+
+void HTTP2ServerResponseImpl::headerFields(HPACKHeaderList& fields) const
+{
+	fields.reserve(size() + 1);
+	fields.emplace_back(":status"s, Poco::NumberFormatter::format(static_cast<int>(getStatus())));
+	appendFields(*this, fields);
+}
+
+
+void HTTP2ServerResponseImpl::sendHeader(bool endStream)
+{
+	HPACKHeaderList fields;
+	headerFields(fields);
+	_sent = true;
+	_stream.sendHeaders(fields, endStream);
+}
+
+
+bool HTTP2ServerResponseImpl::noBody() const
+{
+	return (_pRequest && _pRequest->getMethod() == HTTPRequest::HTTP_HEAD) ||
+		getStatus() < 200 ||
+		getStatus() == HTTPResponse::HTTP_NO_CONTENT ||
+		getStatus() == HTTPResponse::HTTP_NOT_MODIFIED;
+}
+
+
+} } // namespace Poco::Net
@@ -0,0 +1,1077 @@
+//
+// HTTP2ServerSession.cpp
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2ServerSession
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTP2ServerSession.h"
+#include "Poco/Net/HTTP2ServerRequestImpl.h"
+#include "Poco/Net/HTTP2ServerResponseImpl.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/Exception.h"
+#include "Poco/Timestamp.h"
+#include <algorithm>
+#include <cstring>
+
+
+using namespace std::string_literals;
+
+
+namespace Poco {
+namespace Net {
+
+
+//
+// HTTP2ServerStream
+//
+
+
+HTTP2ServerStream::HTTP2ServerStream(HTTP2ServerSession& session, Poco::UInt32 id, HPACKHeaderList& headers, bool endStream):
+	_session(session),
+	_id(id),
+	_dataOffset(0),
+	_sendWindow(0),
+	_recvWindow(0),
+	_recvUnacked(0),
+	_remoteClosed(endStream),
+	_localClosed(false),
+	_reset(false)
+{
+	_headers.swap(headers);
+}
+
+
+HTTP2ServerStream::~HTTP2ServerStream()
+{
+}
+
+
+int HTTP2ServerStream::read(char* buffer, std::streamsize length)
+{
+	return _session.readData(*this, buffer, length);
+}
+
+
+void HTTP2ServerStream::write(const char* buffer, std::streamsize length, bool endStream)
+{
+	_session.sendData(*this, buffer, static_cast<std::size_t>(length), endStream);
+}
+
+
+void HTTP2ServerStream::sendHeaders(const HPACKHeaderList& headers, bool endStream)
+{
+	_session.sendHeaders(*this, headers, endStream);
+}
+
+
+void HTTP2ServerStream::sendResponse(const HPACKHeaderList& headers, const char* pBody, std::size_t length)
+{
+	_session.sendResponse(*this, headers, pBody, length);
+}
+
+
+void HTTP2ServerStream::run()
+{
+	_session.processStream(*this);
+}
+
+
+//
+// HTTP2ServerSession
+//
+
+
+HTTP2ServerSession::HTTP2ServerSession(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory, Poco::ThreadPool& threadPool):
+	_socket(socket),
+	_pParams(pParams),
+	_pFactory(pFactory),
+	_secure(socket.secure()),
+	_timeout(pParams->getTimeout()),
+	_threadPool(threadPool),
+	_readBuffer(READ_BUFFER_SIZE),
+	_readOffset(0),
+	_readEnd(0),
+	_headerStreamId(0),
+	_headerEndStream(false),
+	_lastStreamId(0),
+	_connectionRecvUnacked(0),
+	_sendWindow(HTTP2Frame::DEFAULT_WINDOW_SIZE),
+	_peerInitialWindowSize(HTTP2Frame::DEFAULT_WINDOW_SIZE),
+	_goingAway(false),
+	_goAwaySent(false),
+	_closed(false),
+	_runningStreams(0),
+	_peerMaxFrameSize(HTTP2Frame::DEFAULT_MAX_FRAME_SIZE)
+{
+	poco_check_ptr (pFactory);
+}
+
+
+HTTP2ServerSession::~HTTP2ServerSession()
+{
+	try
+	{
+		close();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+bool HTTP2ServerSession::readConnectionPreface(StreamSocket& socket, std::string& data)
+{
+	const std::string& preface = HTTP2Frame::CONNECTION_PREFACE;
+	char buffer[32];
+	poco_assert_dbg (preface.size() <= sizeof(buffer));
+
+	data.clear();
+	while (data.size() < preface.size())
+	{
+		int n;
+		try
+		{
+			n = socket.receiveBytes(buffer, static_cast<int>(preface.size() - data.size()));
+		}
+		catch (Poco::Exception&)
+		{
+			// leave error handling to the HTTP/1.x session
+			return false;
+		}
+		if (n <= 0) return false;
+		const std::size_t offset = data.size();
+		data.append(buffer, static_cast<std::size_t>(n));
+		if (preface.compare(offset, static_cast<std::size_t>(n), buffer, static_cast<std::size_t>(n)) != 0)
+			return false;
+	}
+	return true;
+}
+
+
+void HTTP2ServerSession::run()
+{
+	// The receive timeout determines how often the connection
+	// thread checks for an idle connection or a stopped session.
+	const Poco::Timespan tick(1, 0);
+	_socket.setReceiveTimeout(std::min(tick, _timeout));
+	_clientAddress = _socket.peerAddress();
+	_serverAddress = _socket.address();
+
+	try
+	{
+		sendSettings();
+		Poco::Timestamp lastActivity;
+		HTTP2Frame frame;
+		for (;;)
+		{
+			bool received;
+			try
+			{
+				received = readFrame(frame);
+			}
+			catch (Poco::TimeoutException&)
+			{
+				Poco::Mutex::ScopedLock lock(_mutex);
+				if (_goingAway && _streams.empty()) break;
+				Poco::Timespan idleTimeout = _streams.empty() ? _pParams->getKeepAliveTimeout() : _timeout;
+				if (lastActivity.isElapsed(idleTimeout.totalMicroseconds())) break;
+				continue;
+			}
+			if (!received) break;
+			lastActivity.update();
+			handleFrame(frame, _readBuffer.begin() + _readOffset);
+			_readOffset += frame.length();
+			{
+				Poco::Mutex::ScopedLock lock(_mutex);
+				if (_goingAway && _streams.empty()) break;
+			}
+		}
+		sendGoAway(HTTP2Frame::ERROR_NONE);
+	}
+	catch (HTTP2Exception& exc)
+	{
+		try
+		{
+			sendGoAway(static_cast<HTTP2Frame::ErrorCode>(exc.code()));
+		}
+		catch (...)
+		{
+		}
+	}
+	catch (Poco::Exception&)
+	{
+		// connection error, e.g. reset by client
+	}
+	close();
+}
+
+
+void HTTP2ServerSession::stop(bool abortCurrent)
+{
+	if (abortCurrent)
+	{
+		{
+			Poco::Mutex::ScopedLock lock(_mutex);
+			_goingAway = true;
+		}
+		try
+		{
+			_socket.shutdown();
+		}
+		catch (...)
+		{
+		}
+	}
+	else
+	{
+		{
+			Poco::Mutex::ScopedLock lock(_mutex);
+			_goingAway = true;
+		}
+		try
+		{
+			sendGoAway(HTTP2Frame::ERROR_NONE);
+		}
+		catch (...)
+		{
+		}
+	}
+}
+
+
+void HTTP2ServerSession::close()
+{
+	Poco::Mutex::ScopedLock lock(_mutex);
+	if (_closed) return;
+	_closed = true;
+	for (auto& p: _streams)
+	{
+		p.second->_dataAvailable.broadcast();
+	}
+	_windowAvailable.broadcast();
+	// The thread pool is shared with other sessions,
+	// so only the threads of our streams are waited for.
+	while (_runningStreams > 0)
+	{
+		_streamsFinished.wait(_mutex);
+	}
+}
+
+
+bool HTTP2ServerSession::readFrame(HTTP2Frame& frame)
+{
+	if (!fill(HTTP2Frame::HEADER_SIZE)) return false;
+	frame.read(_readBuffer.begin() + _readOffset);
+	if (frame.length() > HTTP2Frame::DEFAULT_MAX_FRAME_SIZE)
+		throw HTTP2Exception("Frame too large", HTTP2Frame::ERROR_FRAME_SIZE);
+	if (!fill(HTTP2Frame::HEADER_SIZE + frame.length()))
+		throw HTTP2Exception("Connection closed within frame", HTTP2Frame::ERROR_PROTOCOL);
+	_readOffset += HTTP2Frame::HEADER_SIZE;
+	return true;
+}
+
+
+bool HTTP2ServerSession::fill(std::size_t length)
+{
+	if (_readEnd - _readOffset >= length) return true;
+	if (_readOffset > 0)
+	{
+		std::memmove(_readBuffer.begin(), _readBuffer.begin() + _readOffset, _readEnd - _readOffset);
+		_readEnd -= _readOffset;
+		_readOffset = 0;
+	}
+	while (_readEnd < length)
+	{
+		int n = _socket.receiveBytes(_readBuffer.begin() + _readEnd, static_cast<int>(_readBuffer.size() - _readEnd));
+		if (n <= 0) return false;
+		_readEnd += n;
+	}
+	return true;
+}
+
+
+void HTTP2ServerSession::handleFrame(const HTTP2Frame& frame, const char* pPayload)
+{
+	if (_headerStreamId != 0 && frame.type() != HTTP2Frame::FRAME_CONTINUATION)
+		throw HTTP2Exception("CONTINUATION frame expected", HTTP2Frame::ERROR_PROTOCOL);
+
+	switch (frame.type())
+	{
+	case HTTP2Frame::FRAME_DATA:
+		handleData(frame, pPayload);
+		break;
+	case HTTP2Frame::FRAME_HEADERS:
+		handleHeaders(frame, pPayload);
+		break;
+	case HTTP2Frame::FRAME_PRIORITY:
+		if (frame.streamId() == 0) throw HTTP2Exception("PRIORITY frame on stream 0", HTTP2Frame::ERROR_PROTOCOL);
+		if (frame.length() != 5) resetStream(frame.streamId(), HTTP2Frame::ERROR_FRAME_SIZE);
+		break;
+	case HTTP2Frame::FRAME_RST_STREAM:
+		handleRstStream(frame, pPayload);
+		break;
+	case HTTP2Frame::FRAME_SETTINGS:
+		handleSettings(frame, pPayload);
+		break;
+	case HTTP2Frame::FRAME_PUSH_PROMISE:
+		throw HTTP2Exception("PUSH_PROMISE frame received from client", HTTP2Frame::ERROR_PROTOCOL);
+	case HTTP2Frame::FRAME_PING:
+		handlePing(frame, pPayload);
+		break;
+	case HTTP2Frame::FRAME_GOAWAY:
+		handleGoAway(frame, pPayload);
+		break;
+	case HTTP2Frame::FRAME_WINDOW_UPDATE:
+		handleWindowUpdate(frame, pPayload);
+		break;
+	case HTTP2Frame::FRAME_CONTINUATION:
+		handleContinuation(frame, pPayload);
+		break;
+	default:
+		// unknown frame types must be ignored
+		break;
+	}
+}
+
+
+void HTTP2ServerSession::handleData(const HTTP2Frame& frame, const char* pPayload)
+{
+	if (frame.streamId() == 0) throw HTTP2Exception("DATA frame on stream 0", HTTP2Frame::ERROR_PROTOCOL);
+
+	std::size_t length = frame.length();
+	std::size_t padding = 0;
+	if (frame.hasFlag(HTTP2Frame::FLAG_PADDED))
+	{
+		if (length < 1) throw HTTP2Exception("Invalid padding", HTTP2Frame::ERROR_PROTOCOL);
+		padding = static_cast<unsigned char>(pPayload[0]);
+		if (padding >= length) throw HTTP2Exception("Invalid padding", HTTP2Frame::ERROR_PROTOCOL);
+		pPayload++;
+		length -= padding + 1;
+	}
+
+	// Data of closed streams counts for connection flow control, too.
+	_connectionRecvUnacked += frame.length();
+	if (_connectionRecvUnacked >= CONNECTION_WINDOW_SIZE/2)
+	{
+		sendWindowUpdate(0, _connectionRecvUnacked);
+		_connectionRecvUnacked = 0;
+	}
+
+	HTTP2Frame::ErrorCode error = HTTP2Frame::ERROR_NONE;
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		auto it = _streams.find(frame.streamId());
+		if (it == _streams.end())
+		{
+			if (frame.streamId() > _lastStreamId) throw HTTP2Exception("DATA frame on idle stream", HTTP2Frame::ERROR_PROTOCOL);
+			// stream has been closed or reset
+			return;
+		}
+		HTTP2ServerStream& stream = *it->second;
+		if (stream._reset) return;
+		if (stream._remoteClosed)
+		{
+			error = HTTP2Frame::ERROR_STREAM_CLOSED;
+		}
+		else if (static_cast<Poco::Int64>(frame.length()) > stream._recvWindow)
+		{
+			error = HTTP2Frame::ERROR_FLOW_CONTROL;
+		}
+		else
+		{
+			stream._recvWindow -= frame.length();
+			// padding is not passed to the request handler, so it is consumed immediately
+			stream._recvUnacked += static_cast<Poco::UInt32>(frame.length() - length);
+			if (stream._dataOffset == stream._data.size())
+			{
+				stream._data.clear();
+				stream._dataOffset = 0;
+			}
+			stream._data.append(pPayload, length);
+			if (frame.hasFlag(HTTP2Frame::FLAG_END_STREAM)) stream._remoteClosed = true;
+			stream._dataAvailable.broadcast();
+		}
+	}
+	if (error != HTTP2Frame::ERROR_NONE) resetStream(frame.streamId(), error);
+}
+
+
+void HTTP2ServerSession::handleHeaders(const HTTP2Frame& frame, const char* pPayload)
+{
+	if (frame.streamId() == 0) throw HTTP2Exception("HEADERS frame on stream 0", HTTP2Frame::ERROR_PROTOCOL);
+
+	std::size_t length = frame.length();
+	std::size_t padding = 0;
+	if (frame.hasFlag(HTTP2Frame::FLAG_PADDED))
+	{
+		if (length < 1) throw HTTP2Exception("Invalid padding", HTTP2Frame::ERROR_PROTOCOL);
+		padding = static_cast<unsigned char>(pPayload[0]);
+		pPayload++;
+		length--;
+	}
+	if (frame.hasFlag(HTTP2Frame::FLAG_PRIORITY))
+	{
+		if (length < 5) throw HTTP2Exception("Invalid HEADERS frame", HTTP2Frame::ERROR_FRAME_SIZE);
+		pPayload += 5;
+		length -= 5;
+	}
+	if (padding > length) throw HTTP2Exception("Invalid padding", HTTP2Frame::ERROR_PROTOCOL);
+	length -= padding;
+
+	_headerBlock.assign(pPayload, length);
+	_headerEndStream = frame.hasFlag(HTTP2Frame::FLAG_END_STREAM);
+	if (frame.hasFlag(HTTP2Frame::FLAG_END_HEADERS))
+		handleHeaderBlock(frame.streamId(), _headerEndStream);
+	else
+		_headerStreamId = frame.streamId();
+}
+
+
+void HTTP2ServerSession::handleContinuation(const HTTP2Frame& frame, const char* pPayload)
+{
+	if (_headerStreamId == 0 || frame.streamId() != _headerStreamId)
+		throw HTTP2Exception("Unexpected CONTINUATION frame", HTTP2Frame::ERROR_PROTOCOL);
+	if (_headerBlock.size() + frame.length() > MAX_HEADER_BLOCK_SIZE)
+		throw HTTP2Exception("Header block too large", HTTP2Frame::ERROR_ENHANCE_YOUR_CALM);
+
+	_headerBlock.append(pPayload, frame.length());
+	if (frame.hasFlag(HTTP2Frame::FLAG_END_HEADERS))
+	{
+		Poco::UInt32 streamId = _headerStreamId;
+		_headerStreamId = 0;
+		handleHeaderBlock(streamId, _headerEndStream);
+	}
+}
+
+
+void HTTP2ServerSession::handleHeaderBlock(Poco::UInt32 streamId, bool endStream)
+{
+	// The header block must always be decoded to keep the decoder's state in sync.
+	HPACKHeaderList headers;
+	_decoder.decode(_headerBlock.data(), _headerBlock.size(), headers);
+	_headerBlock.clear();
+
+	HTTP2Frame::ErrorCode error = HTTP2Frame::ERROR_NONE;
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		auto it = _streams.find(streamId);
+		if (it != _streams.end())
+		{
+			// trailer
+			HTTP2ServerStream& stream = *it->second;
+			if (stream._reset) return;
+			if (stream._remoteClosed)
+			{
+				error = HTTP2Frame::ERROR_STREAM_CLOSED;
+			}
+			else if (!endStream)
+			{
+				error = HTTP2Frame::ERROR_PROTOCOL;
+			}
+			else
+			{
+				stream._remoteClosed = true;
+				stream._dataAvailable.broadcast();
+				return;
+			}
+		}
+		else if (streamId <= _lastStreamId)
+		{
+			// stream has been closed or reset
+			return;
+		}
+		else if ((streamId & 1) == 0)
+		{
+			throw HTTP2Exception("Invalid stream identifier", HTTP2Frame::ERROR_PROTOCOL);
+		}
+		else
+		{
+			_lastStreamId = streamId;
+			if (_goingAway) return;
+			if (_streams.size() >= static_cast<std::size_t>(_pParams->getHTTP2MaxConcurrentStreams()))
+				error = HTTP2Frame::ERROR_REFUSED_STREAM;
+			else if (!isValidRequest(headers))
+				error = HTTP2Frame::ERROR_PROTOCOL;
+		}
+	}
+	if (error != HTTP2Frame::ERROR_NONE)
+		resetStream(streamId, error);
+	else
+		startStream(streamId, headers, endStream);
+}
+
+
+void HTTP2ServerSession::startStream(Poco::UInt32 streamId, HPACKHeaderList& headers, bool endStream)
+{
+	HTTP2ServerStream::Ptr pStream = new HTTP2ServerStream(*this, streamId, headers, endStream);
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		pStream->_sendWindow = _peerInitialWindowSize;
+		pStream->_recvWindow = STREAM_WINDOW_SIZE;
+		_streams[streamId] = pStream;
+		++_runningStreams;
+	}
+	try
+	{
+		_threadPool.start(*pStream);
+	}
+	catch (Poco::NoThreadAvailableException&)
+	{
+		{
+			Poco::Mutex::ScopedLock lock(_mutex);
+			_streams.erase(streamId);
+			--_runningStreams;
+		}
+		resetStream(streamId, HTTP2Frame::ERROR_REFUSED_STREAM);
+	}
+}
+
+
+void HTTP2ServerSession::handleRstStream(const HTTP2Frame& frame, const char* pPayload)
+{
+	if (frame.streamId() == 0) throw HTTP2Exception("RST_STREAM frame on stream 0", HTTP2Frame::ERROR_PROTOCOL);
+	if (frame.length() != 4) throw HTTP2Exception("Invalid RST_STREAM frame", HTTP2Frame::ERROR_FRAME_SIZE);
+
+	Poco::Mutex::ScopedLock lock(_mutex);
+	auto it = _streams.find(frame.streamId());
+	if (it != _streams.end())
+	{
+		HTTP2ServerStream& stream = *it->second;
+		stream._reset = true;
+		stream._dataAvailable.broadcast();
+		_windowAvailable.broadcast();
+	}
+	else if (frame.streamId() > _lastStreamId)
+	{
+		throw HTTP2Exception("RST_STREAM frame on idle stream", HTTP2Frame::ERROR_PROTOCOL);
+	}
+}
+
+
+void HTTP2ServerSession::handleSettings(const HTTP2Frame& frame, const char* pPayload)
+{
+	if (frame.streamId() != 0) throw HTTP2Exception("SETTINGS frame on stream", HTTP2Frame::ERROR_PROTOCOL);
+	if (frame.hasFlag(HTTP2Frame::FLAG_ACK))
+	{
+		if (frame.length() != 0) throw HTTP2Exception("Invalid SETTINGS frame", HTTP2Frame::ERROR_FRAME_SIZE);
+		return;
+	}
+	if (frame.length() % 6 != 0) throw HTTP2Exception("Invalid SETTINGS frame", HTTP2Frame::ERROR_FRAME_SIZE);
+
+	for (const char* p = pPayload; p < pPayload + frame.length(); p += 6)
+	{
+		int id = (static_cast<unsigned char>(p[0]) << 8) | static_cast<unsigned char>(p[1]);
+		Poco::UInt32 value = HTTP2Frame::readUInt32(p + 2);
+		switch (id)
+		{
+		case HTTP2Frame::SETTINGS_HEADER_TABLE_SIZE:
+			{
+				Poco::FastMutex::ScopedLock lock(_writeMutex);
+				_encoder.setMaxTableSize(value);
+			}
+			break;
+		case HTTP2Frame::SETTINGS_ENABLE_PUSH:
+			if (value > 1) throw HTTP2Exception("Invalid SETTINGS_ENABLE_PUSH", HTTP2Frame::ERROR_PROTOCOL);
+			break;
+		case HTTP2Frame::SETTINGS_INITIAL_WINDOW_SIZE:
+			{
+				if (value > HTTP2Frame::MAX_WINDOW_SIZE) throw HTTP2Exception("Invalid SETTINGS_INITIAL_WINDOW_SIZE", HTTP2Frame::ERROR_FLOW_CONTROL);
+				Poco::Mutex::ScopedLock lock(_mutex);
+				Poco::Int64 delta = static_cast<Poco::Int64>(value) - _peerInitialWindowSize;
+				_peerInitialWindowSize = value;
+				for (auto& p: _streams)
+				{
+					p.second->_sendWindow += delta;
+					if (p.second->_sendWindow > HTTP2Frame::MAX_WINDOW_SIZE)
+						throw HTTP2Exception("Flow control window too large", HTTP2Frame::ERROR_FLOW_CONTROL);
+				}
+				_windowAvailable.broadcast();
+			}
+			break;
+		case HTTP2Frame::SETTINGS_MAX_FRAME_SIZE:
+			if (value < HTTP2Frame::DEFAULT_MAX_FRAME_SIZE || value > HTTP2Frame::MAX_MAX_FRAME_SIZE)
+				throw HTTP2Exception("Invalid SETTINGS_MAX_FRAME_SIZE", HTTP2Frame::ERROR_PROTOCOL);
+			_peerMaxFrameSize = value;
+			break;
+		default:
+			// SETTINGS_MAX_CONCURRENT_STREAMS only applies to server push;
+			// other settings are advisory or unknown.
+			break;
+		}
+	}
+
+	std::string frames;
+	HTTP2Frame(0, HTTP2Frame::FRAME_SETTINGS, HTTP2Frame::FLAG_ACK, 0).append(frames);
+	sendFrames(frames);
+}
+
+
+void HTTP2ServerSession::handlePing(const HTTP2Frame& frame, const char* pPayload)
+{
+	if (frame.streamId() != 0) throw HTTP2Exception("PING frame on stream", HTTP2Frame::ERROR_PROTOCOL);
+	if (frame.length() != 8) throw HTTP2Exception("Invalid PING frame", HTTP2Frame::ERROR_FRAME_SIZE);
+	if (!frame.hasFlag(HTTP2Frame::FLAG_ACK))
+	{
+		std::string frames;
+		HTTP2Frame(8, HTTP2Frame::FRAME_PING, HTTP2Frame::FLAG_ACK, 0).append(frames);
+		frames.append(pPayload, 8);
+		sendFrames(frames);
+	}
+}
+
+
+void HTTP2ServerSession::handleGoAway(const HTTP2Frame& frame, const char* pPayload)
+{
+	if (frame.streamId() != 0) throw HTTP2Exception("GOAWAY frame on stream", HTTP2Frame::ERROR_PROTOCOL);
+	if (frame.length() < 8) throw HTTP2Exception("Invalid GOAWAY frame", HTTP2Frame::ERROR_FRAME_SIZE);
+
+	// The client will not open new streams; finish the current ones.
+	Poco::Mutex::ScopedLock lock(_mutex);
+	_goingAway = true;
+}
+
+
+void HTTP2ServerSession::handleWindowUpdate(const HTTP2Frame& frame, const char* pPayload)
+{
+	if (frame.length() != 4) throw HTTP2Exception("Invalid WINDOW_UPDATE frame", HTTP2Frame::ERROR_FRAME_SIZE);
+
+	Poco::UInt32 increment = HTTP2Frame::readUInt32(pPayload) & 0x7fffffff;
+	HTTP2Frame::ErrorCode error = HTTP2Frame::ERROR_NONE;
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		if (frame.streamId() == 0)
+		{
+			if (increment == 0) throw HTTP2Exception("Invalid WINDOW_UPDATE increment", HTTP2Frame::ERROR_PROTOCOL);
+			_sendWindow += increment;
+			if (_sendWindow > HTTP2Frame::MAX_WINDOW_SIZE) throw HTTP2Exception("Flow control window too large", HTTP2Frame::ERROR_FLOW_CONTROL);
+		}
+		else
+		{
+			auto it = _streams.find(frame.streamId());
+			if (it != _streams.end())
+			{
+				HTTP2ServerStream& stream = *it->second;
+				stream._sendWindow += increment;
+				if (increment == 0)
+					error = HTTP2Frame::ERROR_PROTOCOL;
+				else if (stream._sendWindow > HTTP2Frame::MAX_WINDOW_SIZE)
+					error = HTTP2Frame::ERROR_FLOW_CONTROL;
+			}
+			else if (frame.streamId() > _lastStreamId)
+			{
+				throw HTTP2Exception("WINDOW_UPDATE frame on idle stream", HTTP2Frame::ERROR_PROTOCOL);
+			}
+		}
+		_windowAvailable.broadcast();
+	}
+	if (error != HTTP2Frame::ERROR_NONE) resetStream(frame.streamId(), error);
+}
+
+
+void HTTP2ServerSession::processStream(HTTP2ServerStream& stream)
+{
+	HTTP2ServerStream::Ptr pStream(&stream, true);
+	try
+	{
+		HTTP2ServerResponseImpl response(stream);
+		HTTP2ServerRequestImpl request(response, stream);
+
+		Poco::Timestamp now;
+		response.setDate(now);
+		response.setVersion(request.getVersion());
+		const std::string& server = _pParams->getSoftwareVersion();
+		if (!server.empty())
+			response.set("Server"s, server);
+		try
+		{
+			std::unique_ptr<HTTPRequestHandler> pHandler(_pFactory->createRequestHandler(request));
+			if (pHandler.get())
+			{
+				if (request.getExpectContinue() && response.getStatus() == HTTPResponse::HTTP_OK)
+					response.sendContinue();
+
+				pHandler->handleRequest(request, response);
+			}
+			else
+			{
+				response.setStatusAndReason(HTTPResponse::HTTP_NOT_IMPLEMENTED);
+				response.setContentLength(0);
+			}
+			response.finish();
+		}
+		catch (Poco::Exception&)
+		{
+			if (!response.sent())
+			{
+				try
+				{
+					HTTP2ServerResponseImpl errorResponse(stream);
+					errorResponse.setStatusAndReason(HTTPResponse::HTTP_INTERNAL_SERVER_ERROR);
+					errorResponse.setContentLength(0);
+					errorResponse.finish();
+				}
+				catch (...)
+				{
+				}
+			}
+			throw;
+		}
+	}
+	catch (Poco::Exception& exc)
+	{
+		bool reset;
+		{
+			Poco::Mutex::ScopedLock lock(_mutex);
+			reset = stream._reset || _closed;
+		}
+		// Errors caused by the client resetting the stream or
+		// closing the connection are not reported.
+		if (!reset) Poco::ErrorHandler::handle(exc);
+	}
+	catch (std::exception& exc)
+	{
+		Poco::ErrorHandler::handle(exc);
+	}
+	catch (...)
+	{
+		Poco::ErrorHandler::handle();
+	}
+
+	try
+	{
+		streamFinished(stream);
+	}
+	catch (Poco::Exception&)
+	{
+	}
+	streamThreadFinished();
+}
+
+
+void HTTP2ServerSession::streamFinished(HTTP2ServerStream& stream)
+{
+	HTTP2Frame::ErrorCode error = HTTP2Frame::ERROR_NONE;
+	bool reset = false;
+	bool shutdown = false;
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		if (!stream._reset && !_closed)
+		{
+			if (!stream._localClosed)
+			{
+				// the response could not be completed
+				reset = true;
+				error = HTTP2Frame::ERROR_INTERNAL;
+			}
+			else if (!stream._remoteClosed)
+			{
+				// the request handler has not read the entire request body (RFC 9113, Section 8.1)
+				reset = true;
+				error = HTTP2Frame::ERROR_NONE;
+			}
+		}
+		stream._reset = true;
+		_streams.erase(stream.id());
+		shutdown = _goingAway && _streams.empty() && _goAwaySent;
+	}
+	if (reset) resetStream(stream.id(), error);
+	if (shutdown)
+	{
+		// wake up the connection thread
+		_socket.shutdownReceive();
+	}
+}
+
+
+void HTTP2ServerSession::streamThreadFinished()
+{
+	// This must be the last access to the session by the stream's
+	// thread, as close() returns as soon as all threads have finished.
+	Poco::Mutex::ScopedLock lock(_mutex);
+	--_runningStreams;
+	_streamsFinished.broadcast();
+}
+
+
+int HTTP2ServerSession::readData(HTTP2ServerStream& stream, char* buffer, std::streamsize length)
+{
+	Poco::UInt32 increment = 0;
+	std::size_t n = 0;
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		while (stream._dataOffset == stream._data.size() && !stream._remoteClosed && !stream._reset && !_closed)
+		{
+			if (!stream._dataAvailable.tryWait(_mutex, static_cast<long>(_timeout.totalMilliseconds())))
+				throw Poco::TimeoutException("Timeout waiting for request body");
+		}
+		if (stream._reset || _closed) throw HTTP2Exception("Stream has been reset", HTTP2Frame::ERROR_CANCEL);
+
+		n = std::min(stream._data.size() - stream._dataOffset, static_cast<std::size_t>(length));
+		std::memcpy(buffer, stream._data.data() + stream._dataOffset, n);
+		stream._dataOffset += n;
+		stream._recvUnacked += static_cast<Poco::UInt32>(n);
+		if (!stream._remoteClosed && stream._recvUnacked >= STREAM_WINDOW_SIZE/2)
+		{
+			increment = stream._recvUnacked;
+			stream._recvWindow += increment;
+			stream._recvUnacked = 0;
+		}
+	}
+	if (increment > 0) sendWindowUpdate(stream.id(), increment);
+	return static_cast<int>(n);
+}
+
+
+void HTTP2ServerSession::sendData(HTTP2ServerStream& stream, const char* buffer, std::size_t length, bool endStream)
+{
+	std::string frames;
+	do
+	{
+		std::size_t n = 0;
+		{
+			Poco::Mutex::ScopedLock lock(_mutex);
+			if (length > 0)
+			{
+				while ((stream._sendWindow <= 0 || _sendWindow <= 0) && !stream._reset && !_closed)
+				{
+					if (!_windowAvailable.tryWait(_mutex, static_cast<long>(_timeout.totalMilliseconds())))
+						throw Poco::TimeoutException("Timeout waiting for flow control window");
+				}
+			}
+			if (stream._reset || _closed) throw HTTP2Exception("Stream has been reset", HTTP2Frame::ERROR_CANCEL);
+			if (stream._localClosed) throw HTTP2Exception("Stream has been closed", HTTP2Frame::ERROR_STREAM_CLOSED);
+
+			n = std::min<std::size_t>(length, static_cast<std::size_t>(std::min(stream._sendWindow, _sendWindow)));
+			stream._sendWindow -= n;
+			_sendWindow -= n;
+			if (n == length && endStream) stream._localClosed = true;
+		}
+		frames.clear();
+		appendDataFrames(frames, stream.id(), buffer, n, n == length && endStream);
+		sendFrames(frames);
+		buffer += n;
+		length -= n;
+	}
+	while (length > 0);
+}
+
+
+void HTTP2ServerSession::sendHeaders(HTTP2ServerStream& stream, const HPACKHeaderList& headers, bool endStream)
+{
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		if (stream._reset || _closed) throw HTTP2Exception("Stream has been reset", HTTP2Frame::ERROR_CANCEL);
+		if (stream._localClosed) throw HTTP2Exception("Stream has been closed", HTTP2Frame::ERROR_STREAM_CLOSED);
+		if (endStream) stream._localClosed = true;
+	}
+	std::string frames;
+	Poco::FastMutex::ScopedLock lock(_writeMutex);
+	appendHeaderFrames(frames, stream.id(), headers, endStream);
+	_socket.sendBytes(frames.data(), static_cast<int>(frames.size()));
+}
+
+
+void HTTP2ServerSession::sendResponse(HTTP2ServerStream& stream, const HPACKHeaderList& headers, const char* pBody, std::size_t length)
+{
+	// Send the header and as much of the body as the flow control
+	// windows allow with a single write.
+	std::size_t n = 0;
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		if (stream._reset || _closed) throw HTTP2Exception("Stream has been reset", HTTP2Frame::ERROR_CANCEL);
+		if (stream._localClosed) throw HTTP2Exception("Stream has been closed", HTTP2Frame::ERROR_STREAM_CLOSED);
+		Poco::Int64 window = std::min(stream._sendWindow, _sendWindow);
+		if (window > 0) n = std::min<std::size_t>(length, static_cast<std::size_t>(window));
+		stream._sendWindow -= n;
+		_sendWindow -= n;
+		if (n == length) stream._localClosed = true;
+	}
+	std::string frames;
+	frames.reserve(length + 256);
+	{
+		Poco::FastMutex::ScopedLock lock(_writeMutex);
+		appendHeaderFrames(frames, stream.id(), headers, length == 0);
+		if (n > 0) appendDataFrames(frames, stream.id(), pBody, n, n == length);
+		_socket.sendBytes(frames.data(), static_cast<int>(frames.size()));
+	}
+	if (n < length)
+	{
+		sendData(stream, pBody + n, length - n, true);
+	}
+}
+
+
+void HTTP2ServerSession::resetStream(Poco::UInt32 streamId, HTTP2Frame::ErrorCode error)
+{
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		auto it = _streams.find(streamId);
+		if (it != _streams.end())
+		{
+			HTTP2ServerStream& stream = *it->second;
+			stream._reset = true;
+			stream._dataAvailable.broadcast();
+			_windowAvailable.broadcast();
+		}
+	}
+	std::string frames;
+	HTTP2Frame(4, HTTP2Frame::FRAME_RST_STREAM, 0, streamId).append(frames);
+	HTTP2Frame::appendUInt32(frames, error);
+	sendFrames(frames);
+}
+
+
+void HTTP2ServerSession::sendSettings()
+{
+	std::string frames;
+	HTTP2Frame(18, HTTP2Frame::FRAME_SETTINGS, 0, 0).append(frames);
+	frames += '\0';
+	frames += static_cast<char>(HTTP2Frame::SETTINGS_MAX_CONCURRENT_STREAMS);
+	HTTP2Frame::appendUInt32(frames, static_cast<Poco::UInt32>(_pParams->getHTTP2MaxConcurrentStreams()));
+	frames += '\0';
+	frames += static_cast<char>(HTTP2Frame::SETTINGS_INITIAL_WINDOW_SIZE);
+	HTTP2Frame::appendUInt32(frames, STREAM_WINDOW_SIZE);
+	frames += '\0';
+	frames += static_cast<char>(HTTP2Frame::SETTINGS_MAX_HEADER_LIST_SIZE);
+	HTTP2Frame::appendUInt32(frames, static_cast<Poco::UInt32>(_decoder.getMaxHeaderListSize()));
+	// connection window
+	HTTP2Frame(4, HTTP2Frame::FRAME_WINDOW_UPDATE, 0, 0).append(frames);
+	HTTP2Frame::appendUInt32(frames, CONNECTION_WINDOW_SIZE - HTTP2Frame::DEFAULT_WINDOW_SIZE);
+	sendFrames(frames);
+}
+
+
+void HTTP2ServerSession::sendWindowUpdate(Poco::UInt32 streamId, Poco::UInt32 increment)
+{
+	std::string frames;
+	HTTP2Frame(4, HTTP2Frame::FRAME_WINDOW_UPDATE, 0, streamId).append(frames);
+	HTTP2Frame::appendUInt32(frames, increment);
+	sendFrames(frames);
+}
+
+
+void HTTP2ServerSession::sendGoAway(HTTP2Frame::ErrorCode error)
+{
+	Poco::UInt32 lastStreamId;
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		if (_goAwaySent) return;
+		_goAwaySent = true;
+		lastStreamId = _lastStreamId;
+	}
+	std::string frames;
+	HTTP2Frame(8, HTTP2Frame::FRAME_GOAWAY, 0, 0).append(frames);
+	HTTP2Frame::appendUInt32(frames, lastStreamId);
+	HTTP2Frame::appendUInt32(frames, error);
+	sendFrames(frames);
+}
+
+
+void HTTP2ServerSession::appendHeaderFrames(std::string& buffer, Poco::UInt32 streamId, const HPACKHeaderList& headers, bool endStream)
+{
+	// must be called with _writeMutex locked, as the encoder's state
+	// must match the order in which header blocks are sent.
+	std::string block;
+	_encoder.encode(headers, block);
+
+	const std::size_t maxFrameSize = _peerMaxFrameSize;
+	std::size_t offset = 0;
+	bool first = true;
+	do
+	{
+		std::size_t n = std::min(block.size() - offset, maxFrameSize);
+		bool last = offset + n == block.size();
+		int flags = last ? HTTP2Frame::FLAG_END_HEADERS : 0;
+		if (first && endStream) flags |= HTTP2Frame::FLAG_END_STREAM;
+		HTTP2Frame(static_cast<Poco::UInt32>(n), first ? HTTP2Frame::FRAME_HEADERS : HTTP2Frame::FRAME_CONTINUATION, flags, streamId).append(buffer);
+		buffer.append(block, offset, n);
+		offset += n;
+		first = false;
+	}
+	while (offset < block.size());
+}
+
+
+void HTTP2ServerSession::appendDataFrames(std::string& buffer, Poco::UInt32 streamId, const char* pData, std::size_t length, bool endStream)
+{
+	const std::size_t maxFrameSize = _peerMaxFrameSize;
+	std::size_t offset = 0;
+	do
+	{
+		std::size_t n = std::min(length - offset, maxFrameSize);
+		bool last = offset + n == length;
+		HTTP2Frame(static_cast<Poco::UInt32>(n), HTTP2Frame::FRAME_DATA, last && endStream ? HTTP2Frame::FLAG_END_STREAM : 0, streamId).append(buffer);
+		buffer.append(pData + offset, n);
+		offset += n;
+	}
+	while (offset < length);
+}
+
+
+void HTTP2ServerSession::sendFrames(const std::string& frames)
+{
+	Poco::FastMutex::ScopedLock lock(_writeMutex);
+	_socket.sendBytes(frames.data(), static_cast<int>(frames.size()));
+}
+
+
+bool HTTP2ServerSession::isValidRequest(const HPACKHeaderList& headers)
+{
+	// RFC 9113, Section 8.2 and 8.3
+	bool regular = false;
+	int method = 0;
+	int path = 0;
+	int scheme = 0;
+	bool connect = false;
+	for (const auto& field: headers)
+	{
+		const std::string& name = field.first;
+		if (name.empty()) return false;
+		for (char c: name)
+		{
+			if (c >= 'A' && c <= 'Z') return false;
+		}
+		if (name[0] == ':')
+		{
+			if (regular) return false;
+			if (name == ":method")
+			{
+				method++;
+				connect = field.second == "CONNECT";
+			}
+			else if (name == ":path")
+			{
+				if (field.second.empty()) return false;
+				path++;
+			}
+			else if (name == ":scheme")
+				scheme++;
+			else if (name != ":authority")
+				return false;
+		}
+		else
+		{
+			regular = true;
+			if (name == "connection" || name == "keep-alive" || name == "proxy-connection" || name == "transfer-encoding" || name == "upgrade")
+				return false;
+			if (name == "te" && field.second != "trailers")
+				return false;
+		}
+	}
+	if (connect) return method == 1 && path == 0 && scheme == 0;
+	return method == 1 && path == 1 && scheme == 1;
+}
+
+
+} } // namespace Poco::Net
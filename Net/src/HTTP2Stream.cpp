@@ -0,0 +1,121 @@
+//
+// HTTP2Stream.cpp
+//
+// Library: Net
+// Package: HTTP2
+// Module:  HTTP2Stream
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTP2Stream.h"
+#include "Poco/Net/HTTP2ServerSession.h"
+#include "Poco/Net/HTTP2Frame.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+//
+// HTTP2StreamBuf
+//
+
+
+HTTP2StreamBuf::HTTP2StreamBuf(HTTP2ServerStream& stream, openmode mode):
+	Poco::BufferedStreamBuf(HTTP2Frame::DEFAULT_MAX_FRAME_SIZE, mode),
+	_stream(stream)
+{
+}
+
+
+HTTP2StreamBuf::~HTTP2StreamBuf()
+{
+}
+
+
+void HTTP2StreamBuf::close(bool endStream)
+{
+	std::streamsize n = pptr() - pbase();
+	_stream.write(pbase(), n, endStream);
+	pbump(static_cast<int>(-n));
+}
+
+
+std::streamsize HTTP2StreamBuf::readFromDevice(char* buffer, std::streamsize length)
+{
+	return _stream.read(buffer, length);
+}
+
+
+std::streamsize HTTP2StreamBuf::writeToDevice(const char* buffer, std::streamsize length)
+{
+	_stream.write(buffer, length, false);
+	return length;
+}
+
+
+//
+// HTTP2IOS
+//
+
+
+HTTP2IOS::HTTP2IOS(HTTP2ServerStream& stream, HTTP2StreamBuf::openmode mode):
+	_buf(stream, mode)
+{
+	poco_ios_init(&_buf);
+}
+
+
+HTTP2IOS::~HTTP2IOS()
+{
+	// Buffered response data is sent by HTTP2ServerResponseImpl,
+	// which also ends the stream.
+}
+
+
+HTTP2StreamBuf* HTTP2IOS::rdbuf()
+{
+	return &_buf;
+}
+
+
+//
+// HTTP2InputStream
+//
+
+
+HTTP2InputStream::HTTP2InputStream(HTTP2ServerStream& stream):
+	HTTP2IOS(stream, std::ios::in),
+	std::istream(&_buf)
+{
+}
+
+
+HTTP2InputStream::~HTTP2InputStream()
+{
+}
+
+
+//
+// HTTP2OutputStream
+//
+
+
+HTTP2OutputStream::HTTP2OutputStream(HTTP2ServerStream& stream):
+	HTTP2IOS(stream, std::ios::out),
+	std::ostream(&_buf)
+{
+}
+
+
+HTTP2OutputStream::~HTTP2OutputStream()
+{
+}
+
+
+} } // namespace Poco::Net
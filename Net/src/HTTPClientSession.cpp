@@ -349,10 +349,9 @@ std::istream& HTTPClientSession::receiveResponse(HTTPResponse& response)
 		do
 		{
 			response.clear();
-			HTTPHeaderInputStream his(*this);
 			try
 			{
-				response.read(his);
+				readResponseHeader(response);
 			}
 			catch (Exception&)
 			{
@@ -394,10 +393,9 @@ bool HTTPClientSession::peekResponse(HTTPResponse& response)
 	if (networkException()) networkException()->rethrow();
 
 	response.clear();
-	HTTPHeaderInputStream his(*this);
 	try
 	{
-		response.read(his);
+		readResponseHeader(response);
 	}
 	catch (Exception&)
 	{
@@ -413,6 +411,17 @@ bool HTTPClientSession::peekResponse(HTTPResponse& response)
 }
 
 
+void HTTPClientSession::readResponseHeader(HTTPResponse& response)
+{
+	std::string buffer;
+	const char* pBegin;
+	const char* pEnd;
+	if (!readHeader(buffer, response.getHeaderSizeLimit(), pBegin, pEnd))
+		throw NoMessageException();
+	response.parse(pBegin, pEnd);
+}
+
+
 void HTTPClientSession::reset()
 {
 	close();
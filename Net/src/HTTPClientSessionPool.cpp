@@ -0,0 +1,417 @@
+//
+// HTTPClientSessionPool.cpp
+//
+// Library: Net
+// Package: HTTPClient
+// Module:  HTTPClientSessionPool
+//
+// Copyright (c) 2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/HTTPClientSessionPool.h"
+#include "Poco/Net/HTTPSessionFactory.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/Exception.h"
+
+
+using Poco::NumberFormatter;
+
+
+namespace Poco {
+namespace Net {
+
+
+//
+// HTTPClientSessionPool::Statistics
+//
+
+
+HTTPClientSessionPool::Statistics::Statistics():
+	created(0),
+	reused(0),
+	returned(0),
+	discarded(0),
+	evicted(0),
+	waits(0),
+	timeouts(0),
+	idle(0),
+	active(0)
+{
+}
+
+
+//
+// HTTPClientSessionPool::Session
+//
+
+
+HTTPClientSessionPool::Session::Session():
+	_pPool(nullptr)
+{
+}
+
+
+HTTPClientSessionPool::Session::Session(HTTPClientSessionPool* pPool, const std::string& key, std::unique_ptr<HTTPClientSession>&& pSession):
+	_pPool(pPool),
+	_key(key),
+	_pSession(std::move(pSession))
+{
+}
+
+
+HTTPClientSessionPool::Session::Session(Session&& other) noexcept:
+	_pPool(other._pPool),
+	_key(std::move(other._key)),
+	_pSession(std::move(other._pSession))
+{
+	other._pPool = nullptr;
+}
+
+
+HTTPClientSessionPool::Session& HTTPClientSessionPool::Session::operator = (Session&& other) noexcept
+{
+	if (&other != this)
+	{
+		try
+		{
+			release();
+		}
+		catch (...)
+		{
+			poco_unexpected();
+		}
+		_pPool = other._pPool;
+		_key = std::move(other._key);
+		_pSession = std::move(other._pSession);
+		other._pPool = nullptr;
+	}
+	return *this;
+}
+
+
+HTTPClientSessionPool::Session::~Session()
+{
+	try
+	{
+		release();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+HTTPClientSession& HTTPClientSessionPool::Session::operator * () const
+{
+	if (!_pSession) throw NullPointerException("HTTPClientSessionPool::Session");
+	return *_pSession;
+}
+
+
+HTTPClientSession* HTTPClientSessionPool::Session::operator -> () const
+{
+	if (!_pSession) throw NullPointerException("HTTPClientSessionPool::Session");
+	return _pSession.get();
+}
+
+
+void HTTPClientSessionPool::Session::release()
+{
+	if (_pSession && _pPool)
+	{
+		_pPool->putBack(_key, std::move(_pSession), false);
+	}
+	_pSession.reset();
+	_pPool = nullptr;
+}
+
+
+void HTTPClientSessionPool::Session::discard()
+{
+	if (_pSession && _pPool)
+	{
+		_pPool->putBack(_key, std::move(_pSession), true);
+	}
+	_pSession.reset();
+	_pPool = nullptr;
+}
+
+
+//
+// HTTPClientSessionPool
+//
+
+
+HTTPClientSessionPool::HostEntry::HostEntry():
+	active(0)
+{
+}
+
+
+HTTPClientSessionPool::HTTPClientSessionPool(std::size_t maxSessionsPerHost, const Poco::Timespan& keepAliveTimeout):
+	_factory(HTTPSessionFactory::defaultFactory()),
+	_maxSessionsPerHost(maxSessionsPerHost),
+	_keepAliveTimeout(keepAliveTimeout)
+{
+	poco_assert (_maxSessionsPerHost > 0);
+}
+
+
+HTTPClientSessionPool::HTTPClientSessionPool(HTTPSessionFactory& factory, std::size_t maxSessionsPerHost, const Poco::Timespan& keepAliveTimeout):
+	_factory(factory),
+	_maxSessionsPerHost(maxSessionsPerHost),
+	_keepAliveTimeout(keepAliveTimeout)
+{
+	poco_assert (_maxSessionsPerHost > 0);
+}
+
+
+HTTPClientSessionPool::~HTTPClientSessionPool()
+{
+	try
+	{
+		clear();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+HTTPClientSessionPool::Session HTTPClientSessionPool::get(const std::string& scheme, const std::string& host, Poco::UInt16 port, const Poco::Timespan& timeout)
+{
+	Poco::URI uri;
+	uri.setScheme(scheme);
+	uri.setHost(host);
+	uri.setPort(port);
+	return get(uri, timeout);
+}
+
+
+HTTPClientSessionPool::Session HTTPClientSessionPool::get(const Poco::URI& uri, const Poco::Timespan& timeout)
+{
+	const std::string key = sessionKey(uri);
+	Poco::Timestamp start;
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+
+		bool waited = false;
+		while (true)
+		{
+			HostEntry& entry = _hosts[key];
+			evictExpired(entry, Poco::Timestamp());
+			while (!entry.idle.empty())
+			{
+				std::unique_ptr<HTTPClientSession> pSession(entry.idle.back().pSession);
+				entry.idle.pop_back();
+				if (isReusable(*pSession))
+				{
+					++entry.active;
+					++_stats.reused;
+					return Session(this, key, std::move(pSession));
+				}
+				++_stats.discarded;
+			}
+			if (entry.active < _maxSessionsPerHost)
+			{
+				++entry.active;
+				break;
+			}
+			if (!waited)
+			{
+				++_stats.waits;
+				waited = true;
+			}
+			Poco::Timespan remaining = timeout - start.elapsed();
+			if (remaining.totalMilliseconds() <= 0 || !_available.tryWait(_mutex, static_cast<long>(remaining.totalMilliseconds())))
+			{
+				++_stats.timeouts;
+				throw Poco::TimeoutException("No HTTP client session available for", key);
+			}
+		}
+	}
+
+	std::unique_ptr<HTTPClientSession> pSession;
+	try
+	{
+		pSession.reset(createSession(uri));
+		pSession->setKeepAlive(true);
+		pSession->setKeepAliveTimeout(_keepAliveTimeout);
+	}
+	catch (...)
+	{
+		Poco::Mutex::ScopedLock lock(_mutex);
+		--_hosts[key].active;
+		_available.broadcast();
+		throw;
+	}
+
+	Poco::Mutex::ScopedLock lock(_mutex);
+	++_stats.created;
+	return Session(this, key, std::move(pSession));
+}
+
+
+std::size_t HTTPClientSessionPool::purge()
+{
+	Poco::Timestamp now;
+	std::size_t n = 0;
+
+	Poco::Mutex::ScopedLock lock(_mutex);
+
+	HostMap::iterator it = _hosts.begin();
+	while (it != _hosts.end())
+	{
+		n += evictExpired(it->second, now);
+		if (it->second.idle.empty() && it->second.active == 0)
+			it = _hosts.erase(it);
+		else
+			++it;
+	}
+	return n;
+}
+
+
+void HTTPClientSessionPool::clear()
+{
+	Poco::Mutex::ScopedLock lock(_mutex);
+
+	HostMap::iterator it = _hosts.begin();
+	while (it != _hosts.end())
+	{
+		for (auto& idle: it->second.idle)
+		{
+			delete idle.pSession;
+			++_stats.discarded;
+		}
+		it->second.idle.clear();
+		if (it->second.active == 0)
+			it = _hosts.erase(it);
+		else
+			++it;
+	}
+}
+
+
+HTTPClientSessionPool::Statistics HTTPClientSessionPool::statistics() const
+{
+	Poco::Mutex::ScopedLock lock(_mutex);
+
+	Statistics stats(_stats);
+	for (const auto& p: _hosts)
+	{
+		stats.idle += p.second.idle.size();
+		stats.active += p.second.active;
+	}
+	return stats;
+}
+
+
+bool HTTPClientSessionPool::isReusable(HTTPClientSession& session) const
+{
+	if (!session.connected() || session.mustReconnect()) return false;
+	try
+	{
+		// A readable idle connection has either been closed
+		// by the server, or has unexpected data pending.
+		return !session.socket().poll(Poco::Timespan(0), Socket::SELECT_READ | Socket::SELECT_ERROR);
+	}
+	catch (Poco::Exception&)
+	{
+		return false;
+	}
+}
+
+
+HTTPClientSession* HTTPClientSessionPool::createSession(const Poco::URI& uri)
+{
+	if (_factory.supportsProtocol(uri.getScheme()))
+	{
+		return _factory.createClientSession(uri);
+	}
+	else if (uri.getScheme() == "http")
+	{
+		HTTPClientSession* pSession = new HTTPClientSession(uri.getHost(), uri.getPort());
+		pSession->setProxyConfig(_factory.getProxyConfig());
+		return pSession;
+	}
+	else throw Poco::UnknownURISchemeException(uri.getScheme());
+}
+
+
+void HTTPClientSessionPool::putBack(const std::string& key, std::unique_ptr<HTTPClientSession>&& pSession, bool discard)
+{
+	std::unique_ptr<HTTPClientSession> pClosed;
+	bool keep = !discard && pSession->getKeepAlive() && pSession->connected() && !pSession->mustReconnect();
+	if (!keep) pClosed = std::move(pSession);
+
+	Poco::Timestamp now;
+	Poco::Mutex::ScopedLock lock(_mutex);
+
+	HostEntry& entry = _hosts[key];
+	poco_assert_dbg (entry.active > 0);
+	--entry.active;
+	if (keep)
+	{
+		IdleSession idle = { pSession.get(), now };
+		entry.idle.push_back(idle);
+		pSession.release();
+		++_stats.returned;
+	}
+	else ++_stats.discarded;
+	evictExpired(entry, now);
+	_available.broadcast();
+}
+
+
+std::string HTTPClientSessionPool::sessionKey(const Poco::URI& uri) const
+{
+	std::string key(uri.getScheme());
+	key += "://";
+	key += uri.getHost();
+	key += ':';
+	NumberFormatter::append(key, uri.getPort());
+
+	const HTTPClientSession::ProxyConfig& proxyConfig = _factory.getProxyConfig();
+	if (!proxyConfig.host.empty())
+	{
+		key += " via ";
+		if (!proxyConfig.username.empty())
+		{
+			key += proxyConfig.username;
+			key += '@';
+		}
+		key += proxyConfig.host;
+		key += ':';
+		NumberFormatter::append(key, proxyConfig.port);
+	}
+	return key;
+}
+
+
+std::size_t HTTPClientSessionPool::evictExpired(HostEntry& entry, const Poco::Timestamp& now)
+{
+	// Idle sessions are appended when returned, so the
+	// ones idle longest are at the front.
+	std::size_t n = 0;
+	while (n < entry.idle.size() && now - entry.idle[n].since >= _keepAliveTimeout.totalMicroseconds())
+	{
+		delete entry.idle[n].pSession;
+		++n;
+	}
+	if (n > 0)
+	{
+		entry.idle.erase(entry.idle.begin(), entry.idle.begin() + n);
+		_stats.evicted += n;
+	}
+	return n;
+}
+
+
+} } // namespace Poco::Net
@@ -2,16 +2,85 @@
 #include "Poco/Net/HTTPReactorServerSession.h"
 #include "Poco/Net/HTTPRequestHandler.h"
 #include "Poco/Net/HTTPSession.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/ErrorHandler.h"
+#include "Poco/Environment.h"
 #include <cstring>
 
 namespace Poco {
 namespace Net {
 
+namespace
+{
+	class ConnectionNotification: public Notification
+	{
+	public:
+		explicit ConnectionNotification(const TcpReactorConnectionPtr& conn): _conn(conn)
+		{
+		}
+
+		const TcpReactorConnectionPtr& connection() const
+		{
+			return _conn;
+		}
+
+	private:
+		TcpReactorConnectionPtr _conn;
+	};
+
+	int workerCount(const HTTPServerParams& params)
+	{
+		int n = params.getMaxThreads();
+		return n > 0 ? n : static_cast<int>(Poco::Environment::processorCount());
+	}
+
+	void closeConnection(const StreamSocket& socket)
+	{
+		// The reactor closes the connection once it finds
+		// the socket readable with no data.
+		try
+		{
+			StreamSocket ss(socket);
+			ss.shutdown();
+		}
+		catch (...)
+		{
+		}
+	}
+
+	void sendOutput(const StreamSocket& socket, const std::string& output)
+	{
+		StreamSocket ss(socket);
+		const char* p = output.data();
+		std::size_t left = output.size();
+		try
+		{
+			while (left > 0)
+			{
+				int n = ss.sendBytes(p, static_cast<int>(left));
+				if (n <= 0) throw NetException("Cannot send HTTP response");
+				p += n;
+				left -= static_cast<std::size_t>(n);
+			}
+		}
+		catch (...)
+		{
+			// a partially sent response leaves the client out of sync
+			closeConnection(socket);
+			throw;
+		}
+	}
+}
+
 HTTPReactorServer::HTTPReactorServer(int port, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory)
-	: _tcpReactorServer(port, pParams)
+	: _tcpReactorServer(port, pParams),
+	  _pParams(pParams),
+	  _pFactory(pFactory),
+	  _softwareVersion(pParams->getSoftwareVersion()),
+	  _threadPool("HTTPRW", 1, workerCount(*pParams)),
+	  _worker(*this, &HTTPReactorServer::runWorker),
+	  _stopped(false)
 {
-	_pParams = pParams;
-	_pFactory = pFactory;
 	_tcpReactorServer.setRecvMessageCallback(
 		[this](const TcpReactorConnectionPtr& conn)
 		{
@@ -21,81 +90,230 @@ HTTPReactorServer::HTTPReactorServer(int port, HTTPServerParams::Ptr pParams, HT
 
 HTTPReactorServer::~HTTPReactorServer()
 {
+	try
+	{
+		stop();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
 }
 
 void HTTPReactorServer::start()
 {
+	if (_pParams->getReactorWorkerDispatch())
+	{
+		for (int i = 0; i < _threadPool.capacity(); ++i)
+		{
+			_threadPool.start(_worker);
+		}
+	}
 	_tcpReactorServer.start();
 }
 
 void HTTPReactorServer::stop()
 {
 	_tcpReactorServer.stop();
+	if (!_stopped.exchange(true))
+	{
+		_queue.wakeUpAll();
+		_threadPool.joinAll();
+	}
 }
 
 void HTTPReactorServer::onMessage(const TcpReactorConnectionPtr& conn)
 {
 	try
 	{
-		HTTPReactorServerSession session(conn->socket(), conn->buffer(), _pParams);
-		if (!session.checkRequestComplete())
+		if (_pParams->getReactorWorkerDispatch())
+			dispatch(conn);
+		else
+			processRequests(conn->socket(), conn->buffer());
+	}
+	catch (const Poco::Exception& ex)
+	{
+		onError(ex);
+	}
+}
+
+void HTTPReactorServer::processRequests(const StreamSocket& socket, std::string& buf)
+{
+	std::string output;
+	try
+	{
+		HTTPReactorServerSession session(socket, buf, _pParams);
+		session.setOutputBuffer(&output);
+		while (session.checkRequestComplete())
 		{
-			return;
+			handleRequest(session);
+			session.popCompletedRequest();
 		}
+	}
+	catch (...)
+	{
+		// The error response announces "Connection: close", and any
+		// requests pipelined after the failed one are not handled.
+		try
+		{
+			sendOutput(socket, output);
+		}
+		catch (...)
+		{
+		}
+		closeConnection(socket);
+		throw;
+	}
+	sendOutput(socket, output);
+}
+
+void HTTPReactorServer::handleRequest(HTTPReactorServerSession& session)
+{
+	HTTPServerResponseImpl response(session);
+	HTTPServerRequestImpl request(response, session, _pParams);
 
-		HTTPServerResponseImpl response(session);
-		HTTPServerRequestImpl request(response, session, _pParams);
+	Poco::Timestamp now;
+	response.setDate(now);
+	response.setVersion(request.getVersion());
+	response.setKeepAlive(request.getKeepAlive());
+	if (!_softwareVersion.empty())
+	{
+		response.set("Server", _softwareVersion);
+	}
 
-		Poco::Timestamp now;
-		response.setDate(now);
-		response.setVersion(request.getVersion());
-		response.setKeepAlive(request.getKeepAlive());
-		std::string server = _pParams->getSoftwareVersion();
-		if (!server.empty())
+	try
+	{
+		session.requestTrailer().clear();
+		session.responseTrailer().clear();
+		std::unique_ptr<HTTPRequestHandler> pHandler(_pFactory->createRequestHandler(request));
+		if (pHandler.get())
 		{
-			response.set("Server", server);
-		}
+			if (request.getExpectContinue() && response.getStatus() == HTTPResponse::HTTP_OK)
+				response.sendContinue();
 
-		try
+			pHandler->handleRequest(request, response);
+			session.setKeepAlive(_pParams->getKeepAlive() && response.getKeepAlive());
+		}
+		else
+		{
+			sendErrorResponse(session, HTTPResponse::HTTP_NOT_IMPLEMENTED);
+		}
+	}
+	catch (Poco::Exception& e)
+	{
+		if (!response.sent())
 		{
-			session.requestTrailer().clear();
-			session.responseTrailer().clear();
-			std::unique_ptr<HTTPRequestHandler> pHandler(_pFactory->createRequestHandler(request));
-			if (pHandler.get())
+			try
 			{
-				if (request.getExpectContinue() && response.getStatus() == HTTPResponse::HTTP_OK)
-					response.sendContinue();
-
-				pHandler->handleRequest(request, response);
-				session.setKeepAlive(_pParams->getKeepAlive() && response.getKeepAlive());
-				session.popCompletedRequest();
+				sendErrorResponse(session, e.code() == 0 ? HTTPResponse::HTTP_INTERNAL_SERVER_ERROR
+														 : HTTPResponse::HTTPStatus(e.code()));
 			}
-			else
+			catch (...)
 			{
-				sendErrorResponse(session, HTTPResponse::HTTP_NOT_IMPLEMENTED);
-				session.popCompletedRequest();
 			}
 		}
-		catch (Poco::Exception& e)
+		// The failed request must not be handled again
+		// when more data arrives on the connection.
+		session.popCompletedRequest();
+		throw;
+	}
+	catch (...)
+	{
+		session.popCompletedRequest();
+		throw;
+	}
+}
+
+void HTTPReactorServer::dispatch(const TcpReactorConnectionPtr& conn)
+{
+	std::string& buf = conn->buffer();
+	std::size_t total = buf.size();
+	std::string requests;
+	{
+		HTTPReactorServerSession session(conn->socket(), buf, _pParams);
+		if (!session.checkRequestComplete())
+			return;
+		requests = buf;
+		do
+		{
+			session.popCompletedRequest();
+		}
+		while (session.checkRequestComplete());
+	}
+	requests.resize(total - buf.size());
+
+	bool schedule = false;
+	{
+		FastMutex::ScopedLock lock(_pendingMutex);
+		PendingRequests& pending = _pending[conn.get()];
+		schedule = !pending.connection;
+		pending.connection = conn;
+		pending.data.append(requests);
+	}
+	if (schedule)
+	{
+		_queue.enqueueNotification(new ConnectionNotification(conn));
+	}
+}
+
+void HTTPReactorServer::processConnection(const TcpReactorConnectionPtr& conn)
+{
+	std::string requests;
+	while (true)
+	{
 		{
-			if (!response.sent())
+			FastMutex::ScopedLock lock(_pendingMutex);
+			PendingMap::iterator it = _pending.find(conn.get());
+			if (it == _pending.end())
+				return;
+			if (it->second.data.empty())
 			{
-				try
-				{
-					sendErrorResponse(session, e.code() == 0 ? HTTPResponse::HTTP_INTERNAL_SERVER_ERROR
-															 : HTTPResponse::HTTPStatus(e.code()));
-					session.popCompletedRequest();
-				}
-				catch (...)
-				{
-				}
+				_pending.erase(it);
+				return;
 			}
+			requests.clear();
+			requests.swap(it->second.data);
+		}
+		try
+		{
+			processRequests(conn->socket(), requests);
+		}
+		catch (...)
+		{
+			FastMutex::ScopedLock lock(_pendingMutex);
+			_pending.erase(conn.get());
 			throw;
 		}
 	}
-	catch (const Poco::Exception& ex)
+}
+
+void HTTPReactorServer::runWorker()
+{
+	while (!_stopped)
 	{
-		onError(ex);
+		Notification::Ptr pNf(_queue.waitDequeueNotification());
+		if (!pNf)
+			break;
+		ConnectionNotification* pConnNf = dynamic_cast<ConnectionNotification*>(pNf.get());
+		if (pConnNf)
+		{
+			try
+			{
+				processConnection(pConnNf->connection());
+			}
+			catch (Poco::Exception& exc)
+			{
+				ErrorHandler::handle(exc);
+			}
+			catch (std::exception& exc)
+			{
+				ErrorHandler::handle(exc);
+			}
+			catch (...)
+			{
+				ErrorHandler::handle();
+			}
+		}
 	}
 }
 
@@ -117,4 +335,3 @@ void HTTPReactorServer::onError(const Poco::Exception& ex)
 }
 
 }} // namespace Poco::Net
-
@@ -1,7 +1,11 @@
 #include "Poco/Net/HTTPReactorServerSession.h"
 #include "Poco/Net/HTTPMessage.h"
-#include "Poco/String.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/Net/MessageHeaderScanner.h"
+#include "Poco/Ascii.h"
 #include <cstddef>
+#include <charconv>
+#include <string_view>
 
 namespace Poco {
 namespace Net {
@@ -25,159 +29,151 @@ HTTPReactorServerSession::~HTTPReactorServerSession()
 };
 /// Destroys the HTTPReactorServerSession.
 
+namespace
+{
+	std::string_view trim(std::string_view str)
+	{
+		while (!str.empty() && Poco::Ascii::isSpace(str.front())) str.remove_prefix(1);
+		while (!str.empty() && Poco::Ascii::isSpace(str.back())) str.remove_suffix(1);
+		return str;
+	}
+
+	bool equalsIgnoreCase(std::string_view a, std::string_view b)
+	{
+		if (a.size() != b.size()) return false;
+		for (std::size_t i = 0; i < a.size(); ++i)
+		{
+			if (Poco::Ascii::toLower(a[i]) != Poco::Ascii::toLower(b[i])) return false;
+		}
+		return true;
+	}
+
+	bool containsIgnoreCase(std::string_view str, std::string_view token)
+	{
+		for (std::size_t i = 0; i + token.size() <= str.size(); ++i)
+		{
+			if (equalsIgnoreCase(str.substr(i, token.size()), token)) return true;
+		}
+		return false;
+	}
+}
+
 bool HTTPReactorServerSession::checkRequestComplete()
 {
-	enum State { PARSING_HEADERS, PARSING_CHUNK_SIZE, PARSING_CHUNK_DATA, PARSING_BODY, COMPLETE };
+	if (_buf.empty())
+		return false;
 
-	State       state = PARSING_HEADERS;
-	std::size_t pos = 0;
 	std::size_t bodyStart = 0;
 	std::size_t contentLength = 0;
-	std::size_t chunkSize = 0;
+	bool        isChunked = false;
+	if (!parseHeaders(0, bodyStart, contentLength, isChunked))
+		return false;
 
-	while (pos < _buf.size())
+	if (isChunked)
 	{
-		switch (state)
-		{
-		case PARSING_HEADERS:
-		{
-			bool isChunked = false;
-			if (!parseHeaders(pos, bodyStart, contentLength, isChunked))
-				return false;
-			if (isChunked)
-			{
-				state = PARSING_CHUNK_SIZE;
-				pos = bodyStart;
-			} else if (contentLength > 0)
-			{
-				state = PARSING_BODY;
-				pos = bodyStart;
-			} else
-			{
-				_complete = bodyStart;
-				return true;
-			}
-			break;
-		}
-		case PARSING_CHUNK_SIZE:
+		std::size_t pos = bodyStart;
+		std::size_t chunkSize = 0;
+		while (pos < _buf.size())
 		{
 			if (!parseChunkSize(pos, chunkSize, _complete))
 				return false;
 			if (chunkSize == 0)
 				return true;
-			state = PARSING_CHUNK_DATA;
-			break;
-		}
-		case PARSING_CHUNK_DATA:
-		{
-			if (pos + chunkSize + 2 <= _buf.size())
-			{
-				pos += chunkSize + 2; // Skip chunk data and trailing "\r\n"
-				state = PARSING_CHUNK_SIZE;
-			} else
-			{
+			if (pos + chunkSize + 2 > _buf.size())
 				return false; // Incomplete chunk data
-			}
-			break;
-		}
-		case PARSING_BODY:
-		{
-			if (_buf.size() >= bodyStart + contentLength)
-			{
-				_complete = bodyStart + contentLength;
-				return true;
-			}
-			return false; // Incomplete body
-		}
-		case COMPLETE:
-			return true;
+			pos += chunkSize + 2; // Skip chunk data and trailing "\r\n"
 		}
+		return false;
 	}
-	return false; // Request is not complete
+
+	if (_buf.size() < bodyStart + contentLength)
+		return false; // Incomplete body
+	_complete = bodyStart + contentLength;
+	return true;
 }
 
 bool HTTPReactorServerSession::parseHeaders(
 	std::size_t pos, std::size_t& bodyStart, std::size_t& contentLength, bool& isChunked)
 {
-	std::size_t headerEnd = _buf.find("\r\n\r\n", pos);
-	if (headerEnd == std::string::npos)
+	std::string_view data(_buf.data() + pos, _buf.size() - pos);
+	std::size_t headerEnd = data.find("\r\n\r\n");
+	if (headerEnd == std::string_view::npos)
 	{
 		return false; // Incomplete headers
 	}
+	bodyStart = pos + headerEnd + 4; // "\r\n\r\n" is 4 characters
+	contentLength = 0;
+	isChunked = false;
 
-	bodyStart = headerEnd + 4; // "\r\n\r\n" is 4 characters
-	std::size_t chunkedPos = _buf.find(HTTPMessage::TRANSFER_ENCODING, pos);
-	if (chunkedPos == std::string::npos)
-	{
-		chunkedPos = _buf.find(toLower(HTTPMessage::TRANSFER_ENCODING), pos);
-	}
-	std::size_t chunkedVal = _buf.find(HTTPMessage::CHUNKED_TRANSFER_ENCODING, chunkedPos);
-	std::size_t chunkedLineEnd = _buf.find("\r\n", chunkedPos);
-	if (chunkedPos != std::string::npos && chunkedVal != std::string::npos &&
-		chunkedLineEnd != std::string::npos && chunkedVal < chunkedLineEnd)
-	{
-		isChunked = true;
-		return true;
-	}
-	std::size_t contentLengthPos = _buf.find(HTTPMessage::CONTENT_LENGTH, pos);
-	if(contentLengthPos == std::string::npos)
-	{
-		contentLengthPos = _buf.find(toLower(HTTPMessage::CONTENT_LENGTH), pos);
-	}
-	if (contentLengthPos != std::string::npos)
+	// Only the header block is scanned, skipping the request line,
+	// so that neither the body nor a pipelined request can match.
+	std::string_view headers = data.substr(0, headerEnd + 2);
+	std::size_t lineStart = headers.find("\r\n") + 2;
+	while (lineStart < headers.size())
 	{
-		std::size_t valueStart = contentLengthPos + 15; // "Content-Length:" is 15 characters
-		std::size_t valueEnd = _buf.find("\r\n", valueStart);
-		if (valueEnd != std::string::npos)
+		std::size_t lineEnd = headers.find("\r\n", lineStart);
+		std::string_view line = headers.substr(lineStart, lineEnd - lineStart);
+		lineStart = lineEnd + 2;
+		std::size_t colon = line.find(':');
+		if (colon == std::string_view::npos)
+			continue;
+		std::string_view name = trim(line.substr(0, colon));
+		std::string_view value = trim(line.substr(colon + 1));
+		if (equalsIgnoreCase(name, HTTPMessage::TRANSFER_ENCODING))
 		{
-			contentLength = std::stoi(_buf.substr(valueStart, valueEnd - valueStart));
-			isChunked = false;
-			return true;
-		} else
+			if (containsIgnoreCase(value, HTTPMessage::CHUNKED_TRANSFER_ENCODING))
+				isChunked = true;
+		}
+		else if (equalsIgnoreCase(name, HTTPMessage::CONTENT_LENGTH))
 		{
-			return false; // Incomplete Content-Length header
+			auto res = std::from_chars(value.data(), value.data() + value.size(), contentLength);
+			if (res.ec != std::errc() || res.ptr != value.data() + value.size())
+				throw MessageException("Invalid Content-Length header");
 		}
 	}
-	contentLength = 0;
-	isChunked = false;
+	if (isChunked)
+		contentLength = 0;
 	return true;
 }
 
-bool HTTPReactorServerSession::parseChunkSize(std::size_t& pos, std::size_t& chunkSize, int& complete)
+bool HTTPReactorServerSession::parseChunkSize(std::size_t& pos, std::size_t& chunkSize, std::size_t& complete)
 {
-
-	std::size_t chunkSizeEnd = _buf.find("\r\n", pos);
-	if (chunkSizeEnd == std::string::npos)
+	std::string_view data(_buf.data() + pos, _buf.size() - pos);
+	std::size_t chunkSizeEnd = data.find("\r\n");
+	if (chunkSizeEnd == std::string_view::npos)
 		return false; // Incomplete chunk size
 
-	std::string chunkSizeStr = _buf.substr(pos, chunkSizeEnd - pos);
-	chunkSize = std::stoi(chunkSizeStr, nullptr, 16); // Parse hex chunk size
+	// chunk extensions (";name=value") are ignored
+	auto res = std::from_chars(data.data(), data.data() + chunkSizeEnd, chunkSize, 16);
+	if (res.ec != std::errc())
+		throw MessageException("Invalid chunk size");
 	if (chunkSize == 0)
 	{
-		std::size_t finalChunkEnd = _buf.find("\r\n\r\n", chunkSizeEnd);
-		if (finalChunkEnd != std::string::npos)
+		std::size_t finalChunkEnd = data.find("\r\n\r\n", chunkSizeEnd);
+		if (finalChunkEnd != std::string_view::npos)
 		{
-			complete = finalChunkEnd + 4; // End of "\r\n\r\n"
+			complete = pos + finalChunkEnd + 4; // End of "\r\n\r\n"
 			return true;
 		} else
 		{
 			return false; // Incomplete final "\r\n\r\n"
 		}
 	}
-	pos = chunkSizeEnd + 2; // Move to the chunk data
+	pos += chunkSizeEnd + 2; // Move to the chunk data
 
 	return true;
 }
 
 void HTTPReactorServerSession::popCompletedRequest()
 {
-	if (static_cast<std::size_t>(_complete) >= _buf.length())
+	if (_complete >= _buf.length())
 	{
 		// All data has been processed
 		_buf.clear();
 	} else
 	{
-		_buf = _buf.substr(_complete);
+		// erase in place, keeping the buffer's capacity
+		_buf.erase(0, _complete);
 	}
 	_complete = 0;
 	_idx = 0;
@@ -189,7 +185,7 @@ int HTTPReactorServerSession::get()
 {
 	if (_idx < _complete)
 	{
-		return _buf[_idx++];
+		return std::char_traits<char>::to_int_type(_buf[_idx++]);
 	} else
 	{
 		return std::char_traits<char>::eof();
@@ -201,7 +197,7 @@ int HTTPReactorServerSession::peek()
 	if (_idx < _complete)
 	{
 
-		return _buf[_idx];
+		return std::char_traits<char>::to_int_type(_buf[_idx]);
 	} else
 	{
 
@@ -213,17 +209,40 @@ int HTTPReactorServerSession::read(char* buffer, std::streamsize length)
 {
 	if (_idx < _complete)
 	{
-		int n = static_cast<int>(_complete - _idx);
-		if (n > static_cast<int>(length)) n = static_cast<int>(length);
+		std::size_t n = _complete - _idx;
+		if (n > static_cast<std::size_t>(length)) n = static_cast<std::size_t>(length);
 		std::memcpy(buffer, _buf.data() + _idx, n);
 		_idx += n;
-		return n;
+		return static_cast<int>(n);
 	}
 	return 0;
 }
 
+bool HTTPReactorServerSession::readHeader(std::string& buffer, std::size_t maxSize, const char*& pBegin, const char*& pEnd)
+{
+	// The complete request is in the connection buffer, so the
+	// header can always be parsed in place.
+	if (_idx >= _complete) return false;
+
+	const char* pData = _buf.data();
+	const char* p = pData + _idx;
+	const char* pComplete = pData + _complete;
+	while (p < pComplete && Poco::Ascii::isSpace(*p)) ++p;
+	const char* pHeaderEnd = p < pComplete ? MessageHeaderScanner::findHeaderEnd(p, pComplete) : nullptr;
+	if (!pHeaderEnd) pHeaderEnd = pComplete;
+	pBegin = p;
+	pEnd = pHeaderEnd;
+	_idx = pHeaderEnd - pData;
+	return true;
+}
+
 int HTTPReactorServerSession::write(const char* buffer, std::streamsize length)
 {
+	if (_pOutput)
+	{
+		_pOutput->append(buffer, static_cast<std::size_t>(length));
+		return static_cast<int>(length);
+	}
 	try
 	{
 		return _realsocket.sendBytes(buffer, (int)length);
@@ -15,6 +15,7 @@
 #include "Poco/Net/HTTPRequest.h"
 #include "Poco/Net/NetException.h"
 #include "Poco/Net/NameValueCollection.h"
+#include "Poco/Net/MessageHeaderScanner.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/Ascii.h"
 #include "Poco/String.h"
@@ -265,6 +266,62 @@ void HTTPRequest::read(std::istream& istr)
 }
 
 
+namespace
+{
+	inline bool isSpace(char c)
+	{
+		return Poco::Ascii::isSpace(static_cast<unsigned char>(c));
+	}
+
+	inline const char* skipSpace(const char* p, const char* pEnd)
+	{
+		while (p < pEnd && isSpace(*p)) ++p;
+		return p;
+	}
+
+	inline const char* findToken(const char* p, const char* pEnd, int maxLength)
+		/// Returns the end of the token starting at p, or pEnd if the
+		/// token is longer than maxLength or not followed by white space.
+	{
+		const char* pLimit = pEnd - p > maxLength ? p + maxLength + 1 : pEnd;
+		const char* pTokenEnd = MessageHeaderScanner::findSpace(p, pLimit);
+		return pTokenEnd == pLimit ? pEnd : pTokenEnd;
+	}
+}
+
+
+const char* HTTPRequest::parse(const char* pBegin, const char* pEnd)
+{
+	const char* p = skipSpace(pBegin, pEnd);
+	if (p == pEnd) throw MessageException("No HTTP request header");
+	const char* pMethod = p;
+	const char* pMethodEnd = findToken(p, pEnd, MAX_METHOD_LENGTH);
+	if (pMethodEnd == pEnd) throw MessageException("HTTP request method invalid or too long");
+	const char* pURI = skipSpace(pMethodEnd, pEnd);
+	const char* pURIEnd = findToken(pURI, pEnd, MAX_URI_LENGTH);
+	if (pURIEnd == pEnd) throw MessageException("HTTP request URI invalid or too long");
+	const char* pVersion = skipSpace(pURIEnd, pEnd);
+	const char* pVersionEnd = findToken(pVersion, pEnd, MAX_VERSION_LENGTH);
+	if (pVersionEnd == pEnd) throw MessageException("Invalid HTTP version string");
+	p = MessageHeaderScanner::find(pVersionEnd, pEnd, '\n');
+	if (p < pEnd) ++p;
+	p = HTTPMessage::parse(p, pEnd);
+	setMethod(std::string(pMethod, pMethodEnd));
+	setURI(std::string(pURI, pURIEnd));
+	setVersion(std::string(pVersion, pVersionEnd));
+	return p;
+}
+
+
+std::size_t HTTPRequest::getHeaderSizeLimit() const
+{
+	std::size_t limit = HTTPMessage::getHeaderSizeLimit();
+	if (limit == 0) return 0;
+
+	return limit + MAX_METHOD_LENGTH + MAX_URI_LENGTH + MAX_VERSION_LENGTH + 256;
+}
+
+
 void HTTPRequest::getCredentials(const std::string& header, std::string& scheme, std::string& authInfo) const
 {
 	scheme.clear();
@@ -14,6 +14,7 @@
 
 #include "Poco/Net/HTTPResponse.h"
 #include "Poco/Net/NetException.h"
+#include "Poco/Net/MessageHeaderScanner.h"
 #include "Poco/NumberFormatter.h"
 #include "Poco/NumberParser.h"
 #include "Poco/DateTime.h"
@@ -306,6 +307,63 @@ void HTTPResponse::read(std::istream& istr)
 }
 
 
+namespace
+{
+	inline bool isSpace(char c)
+	{
+		return Poco::Ascii::isSpace(static_cast<unsigned char>(c));
+	}
+
+	inline const char* findToken(const char* p, const char* pEnd, int maxLength)
+		/// Returns the end of the token starting at p, or pEnd if the
+		/// token is longer than maxLength or not followed by white space.
+	{
+		const char* pLimit = pEnd - p > maxLength ? p + maxLength + 1 : pEnd;
+		const char* pTokenEnd = MessageHeaderScanner::findSpace(p, pLimit);
+		return pTokenEnd == pLimit ? pEnd : pTokenEnd;
+	}
+}
+
+
+const char* HTTPResponse::parse(const char* pBegin, const char* pEnd)
+{
+	const char* p = pBegin;
+	while (p < pEnd && isSpace(*p)) ++p;
+	if (p == pEnd) throw MessageException("No HTTP response header");
+	const char* pVersion = p;
+	const char* pVersionEnd = findToken(p, pEnd, MAX_VERSION_LENGTH);
+	if (pVersionEnd == pEnd) throw MessageException("Invalid HTTP version string");
+	p = pVersionEnd;
+	while (p < pEnd && isSpace(*p)) ++p;
+	const char* pStatus = p;
+	const char* pStatusEnd = findToken(p, pEnd, MAX_STATUS_LENGTH);
+	if (pStatusEnd == pEnd) throw MessageException("Invalid HTTP status code");
+	p = pStatusEnd;
+	while (p < pEnd && isSpace(*p) && *p != '\r' && *p != '\n') ++p;
+	const char* pReason = p;
+	const char* pReasonLimit = pEnd - p > MAX_REASON_LENGTH ? p + MAX_REASON_LENGTH + 1 : pEnd;
+	const char* pReasonEnd = MessageHeaderScanner::find(p, pReasonLimit, '\r', '\n');
+	if (pReasonEnd == pReasonLimit) throw MessageException("HTTP reason string too long");
+	p = pReasonEnd;
+	if (*p == '\r') ++p;
+	if (p == pEnd || *p != '\n') throw MessageException("Unterminated HTTP response line");
+	p = HTTPMessage::parse(p + 1, pEnd);
+	setVersion(std::string(pVersion, pVersionEnd));
+	setStatus(std::string(pStatus, pStatusEnd));
+	setReason(std::string(pReason, pReasonEnd));
+	return p;
+}
+
+
+std::size_t HTTPResponse::getHeaderSizeLimit() const
+{
+	std::size_t limit = HTTPMessage::getHeaderSizeLimit();
+	if (limit == 0) return 0;
+
+	return limit + MAX_VERSION_LENGTH + MAX_STATUS_LENGTH + MAX_REASON_LENGTH + 256;
+}
+
+
 const std::string& HTTPResponse::getReasonForStatus(HTTPStatus status)
 {
 	switch (status)
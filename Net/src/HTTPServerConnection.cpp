@@ -16,6 +16,7 @@
 #include "Poco/Net/HTTPServerSession.h"
 #include "Poco/Net/HTTPServerRequestImpl.h"
 #include "Poco/Net/HTTPServerResponseImpl.h"
+#include "Poco/Net/HTTP2ServerSession.h"
 #include "Poco/Net/HTTPRequestHandler.h"
 #include "Poco/Net/HTTPRequestHandlerFactory.h"
 #include "Poco/Net/NetException.h"
@@ -36,7 +37,23 @@ HTTPServerConnection::HTTPServerConnection(const StreamSocket& socket, HTTPServe
 	TCPServerConnection(socket),
 	_pParams(pParams),
 	_pFactory(pFactory),
-	_stopped(false)
+	_stopped(false),
+	_http2ThreadPool(Poco::ThreadPool::defaultPool()),
+	_pHTTP2Session(nullptr)
+{
+	poco_check_ptr (pFactory);
+
+	_pFactory->serverStopped += Poco::delegate(this, &HTTPServerConnection::onServerStopped);
+}
+
+
+HTTPServerConnection::HTTPServerConnection(const StreamSocket& socket, HTTPServerParams::Ptr pParams, HTTPRequestHandlerFactory::Ptr pFactory, Poco::ThreadPool& http2ThreadPool):
+	TCPServerConnection(socket),
+	_pParams(pParams),
+	_pFactory(pFactory),
+	_stopped(false),
+	_http2ThreadPool(http2ThreadPool),
+	_pHTTP2Session(nullptr)
 {
 	poco_check_ptr (pFactory);
 
@@ -59,8 +76,20 @@ HTTPServerConnection::~HTTPServerConnection()
 
 void HTTPServerConnection::run()
 {
+	std::string preface;
+	if (_pParams->getHTTP2Enabled())
+	{
+		socket().setReceiveTimeout(_pParams->getTimeout());
+		if (HTTP2ServerSession::readConnectionPreface(socket(), preface))
+		{
+			runHTTP2();
+			return;
+		}
+	}
+
 	std::string server = _pParams->getSoftwareVersion();
 	HTTPServerSession session(socket(), _pParams);
+	if (!preface.empty()) session.unread(preface.data(), preface.size());
 	while (!_stopped && session.hasMoreRequests())
 	{
 		try
@@ -128,6 +157,29 @@ void HTTPServerConnection::run()
 }
 
 
+void HTTPServerConnection::runHTTP2()
+{
+	HTTP2ServerSession session(socket(), _pParams, _pFactory, _http2ThreadPool);
+	{
+		Poco::FastMutex::ScopedLock lock(_http2Mutex);
+		if (_stopped) return;
+		_pHTTP2Session = &session;
+	}
+	try
+	{
+		session.run();
+	}
+	catch (...)
+	{
+		Poco::FastMutex::ScopedLock lock(_http2Mutex);
+		_pHTTP2Session = nullptr;
+		throw;
+	}
+	Poco::FastMutex::ScopedLock lock(_http2Mutex);
+	_pHTTP2Session = nullptr;
+}
+
+
 void HTTPServerConnection::sendErrorResponse(HTTPServerSession& session, HTTPResponse::HTTPStatus status)
 {
 	HTTPServerResponseImpl response(session);
@@ -142,6 +194,14 @@ void HTTPServerConnection::sendErrorResponse(HTTPServerSession& session, HTTPRes
 void HTTPServerConnection::onServerStopped(const bool& abortCurrent)
 {
 	_stopped = true;
+	{
+		Poco::FastMutex::ScopedLock lock(_http2Mutex);
+		if (_pHTTP2Session)
+		{
+			_pHTTP2Session->stop(abortCurrent);
+			return;
+		}
+	}
 	if (abortCurrent)
 	{
 		try
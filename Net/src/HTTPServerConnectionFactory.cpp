@@ -17,6 +17,9 @@
 #include "Poco/Net/HTTPRequestHandlerFactory.h"
 
 
+using namespace std::string_literals;
+
+
 namespace Poco {
 namespace Net {
 
@@ -36,6 +39,19 @@ HTTPServerConnectionFactory::~HTTPServerConnectionFactory()
 
 TCPServerConnection* HTTPServerConnectionFactory::createConnection(const StreamSocket& socket)
 {
+	if (_pParams->getHTTP2Enabled())
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		if (!_pHTTP2ThreadPool)
+		{
+			// The pool is created on first use, when the TCPServerDispatcher
+			// has replaced a maximum number of threads of 0 with its own capacity.
+			int maxThreads = _pParams->getMaxThreads();
+			if (maxThreads <= 0) maxThreads = _pParams->getHTTP2MaxConcurrentStreams();
+			_pHTTP2ThreadPool.reset(new Poco::ThreadPool("HTTP2"s, 1, maxThreads));
+		}
+		return new HTTPServerConnection(socket, _pParams, _pFactory, *_pHTTP2ThreadPool);
+	}
 	return new HTTPServerConnection(socket, _pParams, _pFactory);
 }
 
@@ -24,7 +24,10 @@ HTTPServerParams::HTTPServerParams():
 	_keepAlive(true),
 	_maxKeepAliveRequests(0),
 	_keepAliveTimeout(15000000),
-	_autoDecodeHeaders(true)
+	_autoDecodeHeaders(true),
+	_reactorWorkerDispatch(false),
+	_http2Enabled(false),
+	_http2MaxConcurrentStreams(100)
 {
 }
 
@@ -77,4 +80,23 @@ void HTTPServerParams::setAutoDecodeHeaders(bool autoDecode)
 }
 
 
+void HTTPServerParams::setReactorWorkerDispatch(bool workerDispatch)
+{
+	_reactorWorkerDispatch = workerDispatch;
+}
+
+
+void HTTPServerParams::setHTTP2Enabled(bool enabled)
+{
+	_http2Enabled = enabled;
+}
+
+
+void HTTPServerParams::setHTTP2MaxConcurrentStreams(int maxStreams)
+{
+	poco_assert (maxStreams > 0);
+	_http2MaxConcurrentStreams = maxStreams;
+}
+
+
 } } // namespace Poco::Net
@@ -15,13 +15,13 @@
 #include "Poco/Net/HTTPServerRequestImpl.h"
 #include "Poco/Net/HTTPServerResponseImpl.h"
 #include "Poco/Net/HTTPServerSession.h"
-#include "Poco/Net/HTTPHeaderStream.h"
 #include "Poco/Net/HTTPSession.h"
 #include "Poco/Net/HTTPStream.h"
 #include "Poco/Net/HTTPFixedLengthStream.h"
 #include "Poco/Net/HTTPChunkedStream.h"
 #include "Poco/Net/HTTPServerParams.h"
 #include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/NetException.h"
 #include "Poco/String.h"
 
 
@@ -40,9 +40,13 @@ HTTPServerRequestImpl::HTTPServerRequestImpl(HTTPServerResponseImpl& response, H
 {
 	response.attachRequest(this);
 
-	HTTPHeaderInputStream hs(session);
 	setAutoDecode(_pParams->getAutoDecodeHeaders());
-	read(hs);
+	std::string buffer;
+	const char* pBegin;
+	const char* pEnd;
+	if (!session.readHeader(buffer, getHeaderSizeLimit(), pBegin, pEnd))
+		throw NoMessageException();
+	parse(pBegin, pEnd);
 
 	// Now that we know socket is still connected, obtain addresses
 	_clientAddress = session.clientAddress();
@@ -43,7 +43,9 @@ bool HTTPServerSession::hasMoreRequests()
 	{
 		_firstRequest = false;
 		--_maxKeepAliveRequests;
-		return socket().poll(getTimeout(), Socket::SELECT_READ);
+		// Data may already have been read from the socket and buffered by
+		// a secure socket, e.g. when peeking for the HTTP/2 connection preface.
+		return socket().available() > 0 || socket().poll(getTimeout(), Socket::SELECT_READ);
 	}
 	else if (_maxKeepAliveRequests != 0 && getKeepAlive())
 	{
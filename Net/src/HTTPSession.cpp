@@ -15,6 +15,8 @@
 #include "Poco/Net/HTTPSession.h"
 #include "Poco/Net/HTTPBufferAllocator.h"
 #include "Poco/Net/NetException.h"
+#include "Poco/Net/MessageHeaderScanner.h"
+#include "Poco/Ascii.h"
 #include <cstring>
 
 
@@ -173,6 +175,59 @@ int HTTPSession::receive(char* buffer, int length)
 }
 
 
+bool HTTPSession::readHeader(std::string& buffer, std::size_t maxSize, const char*& pBegin, const char*& pEnd)
+{
+	bool received = _pCurrent < _pEnd;
+	for (;;)
+	{
+		while (_pCurrent < _pEnd && Poco::Ascii::isSpace(*_pCurrent)) ++_pCurrent;
+		if (_pCurrent < _pEnd) break;
+		refill();
+		if (_pCurrent == _pEnd)
+		{
+			pBegin = pEnd = _pCurrent;
+			return received;
+		}
+		received = true;
+	}
+
+	const char* pHeaderEnd = MessageHeaderScanner::findHeaderEnd(_pCurrent, _pEnd);
+	if (pHeaderEnd)
+	{
+		pBegin = _pCurrent;
+		pEnd = pHeaderEnd;
+		_pCurrent += pHeaderEnd - _pCurrent;
+		return true;
+	}
+
+	// The header spans more than one buffer.
+	buffer.assign(_pCurrent, _pEnd);
+	_pCurrent = _pEnd;
+	for (;;)
+	{
+		if (maxSize > 0 && buffer.size() > maxSize)
+			throw MessageException("Message header too long");
+		refill();
+		if (_pCurrent == _pEnd) break;
+		// the empty line may start in the previous buffer
+		const std::size_t offset = buffer.size() > 2 ? buffer.size() - 2 : 0;
+		buffer.append(_pCurrent, _pEnd);
+		pHeaderEnd = MessageHeaderScanner::findHeaderEnd(buffer.data() + offset, buffer.data() + buffer.size());
+		if (pHeaderEnd)
+		{
+			const std::size_t excess = buffer.data() + buffer.size() - pHeaderEnd;
+			buffer.resize(buffer.size() - excess);
+			_pCurrent = _pEnd - excess;
+			break;
+		}
+		_pCurrent = _pEnd;
+	}
+	pBegin = buffer.data();
+	pEnd = buffer.data() + buffer.size();
+	return true;
+}
+
+
 void HTTPSession::refill()
 {
 	if (!_pBuffer)
@@ -268,4 +323,21 @@ void HTTPSession::drainBuffer(Poco::Buffer<char>& buffer)
 }
 
 
+void HTTPSession::unread(const char* buffer, std::size_t length)
+{
+	if (!_pBuffer)
+	{
+		_pBuffer = HTTPBufferAllocator::allocate(HTTPBufferAllocator::BUFFER_SIZE);
+		_pCurrent = _pEnd = _pBuffer;
+	}
+	const std::size_t remaining = static_cast<std::size_t>(_pEnd - _pCurrent);
+	if (length + remaining > HTTPBufferAllocator::BUFFER_SIZE)
+		throw Poco::InvalidArgumentException("Data does not fit into HTTP session buffer");
+	std::memmove(_pBuffer + length, _pCurrent, remaining);
+	std::memcpy(_pBuffer, buffer, length);
+	_pCurrent = _pBuffer;
+	_pEnd = _pBuffer + length + remaining;
+}
+
+
 } } // namespace Poco::Net
@@ -14,6 +14,7 @@
 
 #include "Poco/Net/MessageHeader.h"
 #include "Poco/Net/NetException.h"
+#include "Poco/Net/MessageHeaderScanner.h"
 #include "Poco/String.h"
 #include "Poco/Ascii.h"
 #include "Poco/TextConverter.h"
@@ -136,6 +137,132 @@ void MessageHeader::read(std::istream& istr)
 }
 
 
+namespace
+{
+	inline bool isSpace(char c)
+	{
+		return Poco::Ascii::isSpace(static_cast<unsigned char>(c));
+	}
+
+	inline const char* limitEnd(const char* p, const char* pEnd, int limit)
+		/// Returns the end of the range examined by read() for
+		/// a token of at most limit characters, which includes
+		/// the delimiter following the token.
+	{
+		return pEnd - p > limit ? p + limit + 1 : pEnd;
+	}
+
+	std::size_t countLines(const char* p, const char* pEnd)
+		/// Returns the number of lines up to the first empty line.
+	{
+		std::size_t lines = 0;
+		while ((p = MessageHeaderScanner::find(p, pEnd, '\n')) < pEnd)
+		{
+			++lines;
+			++p;
+			if (p < pEnd && (*p == '\r' || *p == '\n')) break;
+		}
+		return lines;
+	}
+}
+
+
+const char* MessageHeader::parse(const char* pBegin, const char* pEnd)
+{
+	const char* p = pBegin;
+	std::size_t lines = countLines(p, pEnd) + 1;
+	if (_fieldLimit > 0 && lines > static_cast<std::size_t>(_fieldLimit)) lines = _fieldLimit;
+	reserve(size() + lines);
+
+	std::string folded;
+	int fields = 0;
+	while (p < pEnd && *p != '\r' && *p != '\n')
+	{
+		if (_fieldLimit > 0 && fields == _fieldLimit)
+			throw MessageException("Too many header fields");
+
+		const char* pName = p;
+		const char* pNameLimit = limitEnd(p, pEnd, _nameLengthLimit);
+		const char* pNameEnd = MessageHeaderScanner::find(p, pNameLimit, ':', '\n');
+		if (pNameEnd == pNameLimit) throw MessageException("Field name too long/no colon found");
+		p = pNameEnd + 1;
+		if (*pNameEnd == '\n') continue; // ignore invalid header lines
+
+		while (p < pEnd && isSpace(*p) && *p != '\r' && *p != '\n') ++p;
+		const char* pValue = p;
+		const char* pValueLimit = limitEnd(p, pEnd, _valueLengthLimit);
+		const char* pValueEnd = MessageHeaderScanner::find(p, pValueLimit, '\r', '\n');
+		if (pValueEnd == pValueLimit && pValueLimit != pEnd)
+			throw MessageException("Field value too long/no CRLF found");
+		p = pValueEnd;
+		if (p < pEnd && *p == '\r') ++p;
+		if (p < pEnd && *p == '\n')
+			++p;
+		else if (p < pEnd)
+			throw MessageException("Field value too long/no CRLF found");
+
+		bool isFolded = false;
+		while (p < pEnd && (*p == ' ' || *p == '\t')) // folding
+		{
+			if (!isFolded)
+			{
+				folded.assign(pValue, pValueEnd);
+				isFolded = true;
+			}
+			const char* pLimit = limitEnd(p, pEnd, _valueLengthLimit - static_cast<int>(folded.size()));
+			const char* pLineEnd = MessageHeaderScanner::find(p, pLimit, '\r', '\n');
+			if (pLineEnd == pLimit && pLimit != pEnd)
+				throw MessageException("Folded field value too long/no CRLF found");
+			folded.append(p, pLineEnd);
+			p = pLineEnd;
+			if (p < pEnd && *p == '\r') ++p;
+			if (p < pEnd && *p == '\n')
+				++p;
+			else if (p < pEnd)
+				throw MessageException("Folded field value too long/no CRLF found");
+		}
+
+		std::string value;
+		if (isFolded)
+		{
+			Poco::trimRightInPlace(folded);
+			value.swap(folded);
+		}
+		else
+		{
+			while (pValueEnd > pValue && isSpace(pValueEnd[-1])) --pValueEnd;
+			value.assign(pValue, pValueEnd);
+		}
+
+		// decodeWord() returns values without encoded words unchanged
+		if (_autoDecode && value.find("=?") != std::string::npos)
+			add(std::string(pName, pNameEnd), decodeWord(value));
+		else
+			add(std::string(pName, pNameEnd), std::move(value));
+
+		++fields;
+	}
+	// Save the state of the auto decode at the time of reading.
+	_decodedOnRead = _autoDecode;
+
+	// skip the empty line
+	if (p < pEnd)
+	{
+		p = MessageHeaderScanner::find(p, pEnd, '\n');
+		if (p < pEnd) ++p;
+	}
+	return p;
+}
+
+
+std::size_t MessageHeader::getHeaderSizeLimit() const
+{
+	if (_fieldLimit == 0) return 0;
+
+	return static_cast<std::size_t>(_fieldLimit)*(_nameLengthLimit + _valueLengthLimit + 256) + 2;
+}
+
+
 void MessageHeader::setAutoDecode(bool decode)
 {
 	_autoDecode = decode;
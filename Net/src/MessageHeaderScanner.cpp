@@ -0,0 +1,388 @@
+//
+// MessageHeaderScanner.cpp
+//
+// Library: Net
+// Package: Messages
+// Module:  MessageHeaderScanner
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/MessageHeaderScanner.h"
+#include "Poco/Ascii.h"
+#include <cstring>
+
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#define POCO_HEADER_SCANNER_X64 1
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+		#define POCO_HEADER_SCANNER_TARGET(t)
+	#else
+		#define POCO_HEADER_SCANNER_TARGET(t) __attribute__((target(t)))
+	#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define POCO_HEADER_SCANNER_NEON 1
+	#include <arm_neon.h>
+#endif
+
+
+namespace Poco {
+namespace Net {
+
+
+namespace
+{
+	inline bool isSpace(char c)
+	{
+		return Poco::Ascii::isSpace(static_cast<unsigned char>(c));
+	}
+
+
+	inline int lowestBit(UInt32 mask)
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return static_cast<int>(index);
+#else
+		return __builtin_ctz(mask);
+#endif
+	}
+
+
+	//
+	// Portable implementation
+	//
+
+	const char* find1Generic(const char* p, const char* pEnd, char c)
+	{
+		const void* pFound = std::memchr(p, c, pEnd - p);
+		return pFound ? static_cast<const char*>(pFound) : pEnd;
+	}
+
+
+	const char* find2Generic(const char* p, const char* pEnd, char c1, char c2)
+	{
+		while (p < pEnd && *p != c1 && *p != c2) ++p;
+		return p;
+	}
+
+
+	const char* findSpaceGeneric(const char* p, const char* pEnd)
+	{
+		while (p < pEnd && !isSpace(*p)) ++p;
+		return p;
+	}
+
+
+#if defined(POCO_HEADER_SCANNER_X64)
+
+
+	//
+	// SSE2 (always available on x86-64)
+	//
+
+	inline __m128i spaceMask128(__m128i x)
+	{
+		// white space is ' ' or in the range '\t' to '\r'
+		const __m128i t = _mm_sub_epi8(x, _mm_set1_epi8('\t'));
+		const __m128i range = _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8('\r' - '\t')), t);
+		return _mm_or_si128(range, _mm_cmpeq_epi8(x, _mm_set1_epi8(' ')));
+	}
+
+
+	const char* find1SSE2(const char* p, const char* pEnd, char c)
+	{
+		const __m128i v = _mm_set1_epi8(c);
+		while (pEnd - p >= 16)
+		{
+			const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			const UInt32 mask = static_cast<UInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, v)));
+			if (mask) return p + lowestBit(mask);
+			p += 16;
+		}
+		return find1Generic(p, pEnd, c);
+	}
+
+
+	const char* find2SSE2(const char* p, const char* pEnd, char c1, char c2)
+	{
+		const __m128i v1 = _mm_set1_epi8(c1);
+		const __m128i v2 = _mm_set1_epi8(c2);
+		while (pEnd - p >= 16)
+		{
+			const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			const __m128i eq = _mm_or_si128(_mm_cmpeq_epi8(x, v1), _mm_cmpeq_epi8(x, v2));
+			const UInt32 mask = static_cast<UInt32>(_mm_movemask_epi8(eq));
+			if (mask) return p + lowestBit(mask);
+			p += 16;
+		}
+		return find2Generic(p, pEnd, c1, c2);
+	}
+
+
+	const char* findSpaceSSE2(const char* p, const char* pEnd)
+	{
+		while (pEnd - p >= 16)
+		{
+			const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+			const UInt32 mask = static_cast<UInt32>(_mm_movemask_epi8(spaceMask128(x)));
+			if (mask) return p + lowestBit(mask);
+			p += 16;
+		}
+		return findSpaceGeneric(p, pEnd);
+	}
+
+
+	//
+	// AVX2
+	//
+
+	POCO_HEADER_SCANNER_TARGET("avx2")
+	const char* find1AVX2(const char* p, const char* pEnd, char c)
+	{
+		const __m256i v = _mm256_set1_epi8(c);
+		while (pEnd - p >= 32)
+		{
+			const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+			const UInt32 mask = static_cast<UInt32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, v)));
+			if (mask) return p + lowestBit(mask);
+			p += 32;
+		}
+		return find1SSE2(p, pEnd, c);
+	}
+
+
+	POCO_HEADER_SCANNER_TARGET("avx2")
+	const char* find2AVX2(const char* p, const char* pEnd, char c1, char c2)
+	{
+		const __m256i v1 = _mm256_set1_epi8(c1);
+		const __m256i v2 = _mm256_set1_epi8(c2);
+		while (pEnd - p >= 32)
+		{
+			const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+			const __m256i eq = _mm256_or_si256(_mm256_cmpeq_epi8(x, v1), _mm256_cmpeq_epi8(x, v2));
+			const UInt32 mask = static_cast<UInt32>(_mm256_movemask_epi8(eq));
+			if (mask) return p + lowestBit(mask);
+			p += 32;
+		}
+		return find2SSE2(p, pEnd, c1, c2);
+	}
+
+
+	POCO_HEADER_SCANNER_TARGET("avx2")
+	const char* findSpaceAVX2(const char* p, const char* pEnd)
+	{
+		const __m256i tab = _mm256_set1_epi8('\t');
+		const __m256i range = _mm256_set1_epi8('\r' - '\t');
+		const __m256i space = _mm256_set1_epi8(' ');
+		while (pEnd - p >= 32)
+		{
+			const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+			const __m256i t = _mm256_sub_epi8(x, tab);
+			const __m256i inRange = _mm256_cmpeq_epi8(_mm256_min_epu8(t, range), t);
+			const __m256i eq = _mm256_or_si256(inRange, _mm256_cmpeq_epi8(x, space));
+			const UInt32 mask = static_cast<UInt32>(_mm256_movemask_epi8(eq));
+			if (mask) return p + lowestBit(mask);
+			p += 32;
+		}
+		return findSpaceSSE2(p, pEnd);
+	}
+
+
+	bool hasAVX2()
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		int info[4];
+		__cpuid(info, 0);
+		if (info[0] < 7) return false;
+		__cpuid(info, 1);
+		const bool osxsave = (info[2] & (1 << 27)) != 0;
+		const bool avx = (info[2] & (1 << 28)) != 0;
+		if (!osxsave || !avx) return false;
+		// the operating system must save the YMM registers
+		if ((_xgetbv(0) & 0x6) != 0x6) return false;
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#else
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+#endif
+	}
+
+
+#elif defined(POCO_HEADER_SCANNER_NEON)
+
+
+	//
+	// NEON (always available on ARM64)
+	//
+
+	inline UInt64 neonMask(uint8x16_t eq)
+		/// Narrows a comparison result to 4 bits per byte.
+	{
+		const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+		return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+	}
+
+
+	inline int lowestByte(UInt64 mask)
+	{
+#if defined(_MSC_VER) && !defined(__clang__)
+		unsigned long index;
+		_BitScanForward64(&index, mask);
+		return static_cast<int>(index >> 2);
+#else
+		return __builtin_ctzll(mask) >> 2;
+#endif
+	}
+
+
+	const char* find1NEON(const char* p, const char* pEnd, char c)
+	{
+		const uint8x16_t v = vdupq_n_u8(static_cast<UInt8>(c));
+		while (pEnd - p >= 16)
+		{
+			const uint8x16_t x = vld1q_u8(reinterpret_cast<const UInt8*>(p));
+			const UInt64 mask = neonMask(vceqq_u8(x, v));
+			if (mask) return p + lowestByte(mask);
+			p += 16;
+		}
+		return find1Generic(p, pEnd, c);
+	}
+
+
+	const char* find2NEON(const char* p, const char* pEnd, char c1, char c2)
+	{
+		const uint8x16_t v1 = vdupq_n_u8(static_cast<UInt8>(c1));
+		const uint8x16_t v2 = vdupq_n_u8(static_cast<UInt8>(c2));
+		while (pEnd - p >= 16)
+		{
+			const uint8x16_t x = vld1q_u8(reinterpret_cast<const UInt8*>(p));
+			const UInt64 mask = neonMask(vorrq_u8(vceqq_u8(x, v1), vceqq_u8(x, v2)));
+			if (mask) return p + lowestByte(mask);
+			p += 16;
+		}
+		return find2Generic(p, pEnd, c1, c2);
+	}
+
+
+	const char* findSpaceNEON(const char* p, const char* pEnd)
+	{
+		const uint8x16_t tab = vdupq_n_u8('\t');
+		const uint8x16_t range = vdupq_n_u8('\r' - '\t');
+		const uint8x16_t space = vdupq_n_u8(' ');
+		while (pEnd - p >= 16)
+		{
+			const uint8x16_t x = vld1q_u8(reinterpret_cast<const UInt8*>(p));
+			const uint8x16_t inRange = vcleq_u8(vsubq_u8(x, tab), range);
+			const UInt64 mask = neonMask(vorrq_u8(inRange, vceqq_u8(x, space)));
+			if (mask) return p + lowestByte(mask);
+			p += 16;
+		}
+		return findSpaceGeneric(p, pEnd);
+	}
+
+
+#endif
+
+
+	struct ScannerFunctions
+	{
+		ScannerFunctions():
+#if defined(POCO_HEADER_SCANNER_X64)
+			find1(find1SSE2),
+			find2(find2SSE2),
+			findSpace(findSpaceSSE2),
+			name("SSE2")
+		{
+			if (hasAVX2())
+			{
+				find1 = find1AVX2;
+				find2 = find2AVX2;
+				findSpace = findSpaceAVX2;
+				name = "AVX2";
+			}
+		}
+#elif defined(POCO_HEADER_SCANNER_NEON)
+			find1(find1NEON),
+			find2(find2NEON),
+			findSpace(findSpaceNEON),
+			name("NEON")
+		{
+		}
+#else
+			find1(find1Generic),
+			find2(find2Generic),
+			findSpace(findSpaceGeneric),
+			name("generic")
+		{
+		}
+#endif
+
+		const char* (*find1)(const char*, const char*, char);
+		const char* (*find2)(const char*, const char*, char, char);
+		const char* (*findSpace)(const char*, const char*);
+		const char* name;
+	};
+
+
+	const ScannerFunctions& scannerFunctions()
+	{
+		static const ScannerFunctions functions;
+		return functions;
+	}
+}
+
+
+const char* MessageHeaderScanner::find(const char* pBegin, const char* pEnd, char c)
+{
+	return scannerFunctions().find1(pBegin, pEnd, c);
+}
+
+
+const char* MessageHeaderScanner::find(const char* pBegin, const char* pEnd, char c1, char c2)
+{
+	return scannerFunctions().find2(pBegin, pEnd, c1, c2);
+}
+
+
+const char* MessageHeaderScanner::findSpace(const char* pBegin, const char* pEnd)
+{
+	return scannerFunctions().findSpace(pBegin, pEnd);
+}
+
+
+const char* MessageHeaderScanner::findHeaderEnd(const char* pBegin, const char* pEnd)
+{
+	const ScannerFunctions& functions = scannerFunctions();
+	const char* p = pBegin;
+	for (;;)
+	{
+		p = functions.find1(p, pEnd, '\n');
+		if (p == pEnd) return nullptr;
+		++p;
+		if (p == pEnd) return nullptr;
+		if (*p == '\n') return p + 1;
+		if (*p == '\r')
+		{
+			if (p + 1 == pEnd) return nullptr;
+			if (p[1] == '\n') return p + 2;
+		}
+	}
+}
+
+
+const char* MessageHeaderScanner::implementation()
+{
+	return scannerFunctions().name;
+}
+
+
+} } // namespace Poco::Net
@@ -96,6 +96,12 @@ void NameValueCollection::add(const std::string& name, const std::string& value)
 }
 
 
+void NameValueCollection::add(std::string&& name, std::string&& value)
+{
+	_map.insert(HeaderMap::ValueType(std::move(name), std::move(value)));
+}
+
+
 const std::string& NameValueCollection::get(const std::string& name) const
 {
 	ConstIterator it = _map.find(name);
@@ -61,6 +61,17 @@
 #endif
 
 
+#if defined(POCO_HAVE_MMSG)
+#include <netinet/udp.h>
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#ifndef UDP_GRO
+#define UDP_GRO 104
+#endif
+#endif
+
+
 #if defined(_MSC_VER)
 #pragma warning(disable:4996) // deprecation warnings
 #endif
@@ -687,6 +698,236 @@ int SocketImpl::receiveFrom(SocketBufVec& buffers, struct sockaddr** pSA, poco_s
 }
 
 
+int SocketImpl::sendBatch(const SocketDatagram* datagrams, int count, int flags)
+{
+	poco_check_ptr (datagrams);
+
+	if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
+	if (count <= 0) return 0;
+	if (_blocking)
+	{
+		checkBrokenTimeout(SELECT_WRITE);
+	}
+#if defined(POCO_HAVE_MMSG)
+	struct mmsghdr msgs[MAX_DATAGRAM_BATCH];
+	struct iovec iovs[MAX_DATAGRAM_BATCH];
+	int sent = 0;
+	while (sent < count)
+	{
+		int n = count - sent;
+		if (n > MAX_DATAGRAM_BATCH) n = MAX_DATAGRAM_BATCH;
+		memset(msgs, 0, sizeof(struct mmsghdr)*n);
+		for (int i = 0; i < n; i++)
+		{
+			const SocketDatagram& dg = datagrams[sent + i];
+			iovs[i].iov_base = dg.buffer;
+			iovs[i].iov_len = dg.length;
+			msgs[i].msg_hdr.msg_iov = &iovs[i];
+			msgs[i].msg_hdr.msg_iovlen = 1;
+			msgs[i].msg_hdr.msg_name = dg.pAddress;
+			msgs[i].msg_hdr.msg_namelen = dg.pAddress ? dg.addressLength : 0;
+		}
+		int rc;
+		do
+		{
+			rc = ::sendmmsg(_sockfd, msgs, n, flags);
+		}
+		while (_blocking && rc < 0 && lastError() == POCO_EINTR);
+		if (rc < 0)
+		{
+			int err = lastError();
+			if (sent > 0)
+				break;
+			else if (!_blocking && (err == POCO_EAGAIN || err == POCO_EWOULDBLOCK))
+				return rc;
+			else if (err == POCO_EAGAIN || err == POCO_ETIMEDOUT)
+				throw TimeoutException(err);
+			else
+				error(err);
+		}
+		sent += rc;
+		if (rc < n) break;
+	}
+	return sent;
+#else
+	int sent = 0;
+	for (; sent < count; sent++)
+	{
+		const SocketDatagram& dg = datagrams[sent];
+		int rc;
+		if (dg.pAddress)
+			rc = sendTo(dg.buffer, dg.length, SocketAddress(dg.pAddress, dg.addressLength), flags);
+		else
+			rc = sendBytes(dg.buffer, dg.length, flags);
+		if (rc < 0) return sent > 0 ? sent : rc;
+	}
+	return sent;
+#endif
+}
+
+
+int SocketImpl::sendSegmented(const void* buffer, int length, int segmentSize, const SocketAddress& address, int flags)
+{
+	poco_check_ptr (buffer);
+	if (segmentSize <= 0) throw InvalidArgumentException("segmentSize must be > 0");
+
+	if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
+	if (length <= 0) return 0;
+#if defined(POCO_HAVE_MMSG)
+	if (length > segmentSize)
+	{
+		if (_blocking)
+		{
+			checkBrokenTimeout(SELECT_WRITE);
+		}
+		struct iovec iov;
+		iov.iov_base = const_cast<void*>(buffer);
+		iov.iov_len = length;
+		union
+		{
+			char buf[CMSG_SPACE(sizeof(Poco::UInt16))];
+			struct cmsghdr align;
+		} control;
+		memset(&control, 0, sizeof(control));
+		struct msghdr msg;
+		memset(&msg, 0, sizeof(msg));
+		msg.msg_name = const_cast<struct sockaddr*>(address.addr());
+		msg.msg_namelen = address.length();
+		msg.msg_iov = &iov;
+		msg.msg_iovlen = 1;
+		msg.msg_control = control.buf;
+		msg.msg_controllen = sizeof(control.buf);
+		struct cmsghdr* pCmsg = CMSG_FIRSTHDR(&msg);
+		pCmsg->cmsg_level = IPPROTO_UDP;
+		pCmsg->cmsg_type = UDP_SEGMENT;
+		pCmsg->cmsg_len = CMSG_LEN(sizeof(Poco::UInt16));
+		Poco::UInt16 gsoSize = static_cast<Poco::UInt16>(segmentSize);
+		memcpy(CMSG_DATA(pCmsg), &gsoSize, sizeof(gsoSize));
+
+		int rc;
+		do
+		{
+			rc = ::sendmsg(_sockfd, &msg, flags);
+		}
+		while (_blocking && rc < 0 && lastError() == POCO_EINTR);
+		if (rc >= 0) return rc;
+
+		int err = lastError();
+		if (!_blocking && (err == POCO_EAGAIN || err == POCO_EWOULDBLOCK))
+			return rc;
+		else if (err == POCO_EAGAIN || err == POCO_ETIMEDOUT)
+			throw TimeoutException(err);
+		else if (err != EINVAL && err != EIO && err != ENOPROTOOPT && err != EOPNOTSUPP)
+			error(err);
+		// segmentation offload not available for this socket,
+		// device or segment count; send datagrams one by one
+	}
+#endif
+	std::vector<SocketDatagram> datagrams;
+	datagrams.reserve((length + segmentSize - 1)/segmentSize);
+	const char* p = reinterpret_cast<const char*>(buffer);
+	for (int offset = 0; offset < length; offset += segmentSize)
+	{
+		SocketDatagram dg;
+		dg.buffer = const_cast<char*>(p + offset);
+		dg.length = length - offset < segmentSize ? length - offset : segmentSize;
+		dg.pAddress = const_cast<struct sockaddr*>(address.addr());
+		dg.addressLength = address.length();
+		datagrams.push_back(dg);
+	}
+	int n = sendBatch(&datagrams[0], static_cast<int>(datagrams.size()), flags);
+	if (n < 0) return n;
+	int sent = 0;
+	for (int i = 0; i < n; i++) sent += datagrams[i].length;
+	return sent;
+}
+
+
+int SocketImpl::receiveBatch(SocketDatagram* datagrams, int count, int flags)
+{
+	poco_check_ptr (datagrams);
+
+	if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
+	if (count <= 0) return 0;
+	if (_blocking)
+	{
+		checkBrokenTimeout(SELECT_READ);
+	}
+#if defined(POCO_HAVE_MMSG)
+	if (count > MAX_DATAGRAM_BATCH) count = MAX_DATAGRAM_BATCH;
+	struct mmsghdr msgs[MAX_DATAGRAM_BATCH];
+	struct iovec iovs[MAX_DATAGRAM_BATCH];
+	union Control
+	{
+		char buf[CMSG_SPACE(sizeof(int))];
+		struct cmsghdr align;
+	};
+	Control control[MAX_DATAGRAM_BATCH];
+	memset(msgs, 0, sizeof(struct mmsghdr)*count);
+	for (int i = 0; i < count; i++)
+	{
+		SocketDatagram& dg = datagrams[i];
+		iovs[i].iov_base = dg.buffer;
+		iovs[i].iov_len = dg.length;
+		msgs[i].msg_hdr.msg_iov = &iovs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_name = dg.pAddress;
+		msgs[i].msg_hdr.msg_namelen = dg.pAddress ? dg.addressLength : 0;
+		msgs[i].msg_hdr.msg_control = control[i].buf;
+		msgs[i].msg_hdr.msg_controllen = sizeof(control[i].buf);
+	}
+	int rc;
+	do
+	{
+		rc = ::recvmmsg(_sockfd, msgs, count, flags | MSG_WAITFORONE, nullptr);
+	}
+	while (_blocking && rc < 0 && lastError() == POCO_EINTR);
+	if (rc < 0)
+	{
+		int err = lastError();
+		if (!_blocking && (err == POCO_EAGAIN || err == POCO_EWOULDBLOCK))
+			;
+		else if (err == POCO_EAGAIN || err == POCO_ETIMEDOUT)
+			throw TimeoutException(err);
+		else
+			error(err);
+		return rc;
+	}
+	for (int i = 0; i < rc; i++)
+	{
+		SocketDatagram& dg = datagrams[i];
+		dg.length = static_cast<int>(msgs[i].msg_len);
+		dg.addressLength = msgs[i].msg_hdr.msg_namelen;
+		dg.segmentSize = 0;
+		for (struct cmsghdr* pCmsg = CMSG_FIRSTHDR(&msgs[i].msg_hdr); pCmsg; pCmsg = CMSG_NXTHDR(&msgs[i].msg_hdr, pCmsg))
+		{
+			if (pCmsg->cmsg_level == IPPROTO_UDP && pCmsg->cmsg_type == UDP_GRO)
+			{
+				int segmentSize;
+				memcpy(&segmentSize, CMSG_DATA(pCmsg), sizeof(segmentSize));
+				if (segmentSize < dg.length) dg.segmentSize = segmentSize;
+			}
+		}
+	}
+	return rc;
+#else
+	SocketDatagram& dg = datagrams[0];
+	int rc;
+	if (dg.pAddress)
+	{
+		struct sockaddr* pSA = dg.pAddress;
+		poco_socklen_t* pSALen = &dg.addressLength;
+		rc = receiveFrom(dg.buffer, dg.length, &pSA, &pSALen, flags);
+	}
+	else rc = receiveBytes(dg.buffer, dg.length, flags);
+	if (rc < 0) return rc;
+	dg.length = rc;
+	dg.segmentSize = 0;
+	return 1;
+#endif
+}
+
+
 void SocketImpl::sendUrgent(unsigned char data)
 {
 	if (_sockfd == POCO_INVALID_SOCKET) throw InvalidSocketException();
@@ -1237,6 +1478,27 @@ bool SocketImpl::getBroadcast()
 }
 
 
+void SocketImpl::setUDPGRO(bool flag)
+{
+#if defined(POCO_HAVE_MMSG)
+	int value = flag ? 1 : 0;
+	setOption(IPPROTO_UDP, UDP_GRO, value);
+#endif
+}
+
+
+bool SocketImpl::getUDPGRO()
+{
+#if defined(POCO_HAVE_MMSG)
+	int value(0);
+	getOption(IPPROTO_UDP, UDP_GRO, value);
+	return value != 0;
+#else
+	return false;
+#endif
+}
+
+
 void SocketImpl::setBlocking(bool flag)
 {
 #if !defined(POCO_OS_FAMILY_UNIX)
@@ -103,6 +103,17 @@ IdleNotification::~IdleNotification()
 }
 
 
+SocketTimeoutNotification::SocketTimeoutNotification(SocketReactor* pReactor):
+	SocketNotification(pReactor)
+{
+}
+
+
+SocketTimeoutNotification::~SocketTimeoutNotification()
+{
+}
+
+
 ShutdownNotification::ShutdownNotification(SocketReactor* pReactor):
 	SocketNotification(pReactor)
 {
@@ -22,7 +22,8 @@ namespace Net {
 
 
 SocketNotifier::SocketNotifier(const Socket& socket):
-	_socket(socket)
+	_socket(socket),
+	_hasTimeout(false)
 {
 }
 
@@ -44,6 +45,8 @@ void SocketNotifier::addObserver(SocketReactor* pReactor, const Poco::AbstractOb
 		_events.insert(pReactor->_pErrorNotification.get());
 	else if (observer.accepts(pReactor->_pTimeoutNotification))
 		_events.insert(pReactor->_pTimeoutNotification.get());
+	else if (observer.accepts(pReactor->_pSocketTimeoutNotification))
+		_events.insert(pReactor->_pSocketTimeoutNotification.get());
 }
 
 
@@ -60,6 +63,8 @@ void SocketNotifier::removeObserver(SocketReactor* pReactor, const Poco::Abstrac
 		it = _events.find(pReactor->_pErrorNotification.get());
 	else if (observer.accepts(pReactor->_pTimeoutNotification))
 		it = _events.find(pReactor->_pTimeoutNotification.get());
+	else if (observer.accepts(pReactor->_pSocketTimeoutNotification))
+		it = _events.find(pReactor->_pSocketTimeoutNotification.get());
 	if (it != _events.end())
 		_events.erase(it);
 }
@@ -94,4 +99,40 @@ void SocketNotifier::disableObservers()
 }
 
 
+void SocketNotifier::setTimeout(Poco::TimingWheel& wheel, const Poco::Timespan& timeout, const Poco::TimingWheel::Callback& callback)
+{
+	ScopedLock l(_mutex);
+	wheel.cancel(_timer);
+	_timeout = timeout;
+	_hasTimeout = timeout > 0;
+	if (_hasTimeout) _timer = wheel.schedule(timeout, callback);
+}
+
+
+void SocketNotifier::restartTimeout(Poco::TimingWheel& wheel, const Poco::TimingWheel::Callback& callback)
+{
+	ScopedLock l(_mutex);
+	if (_hasTimeout && !wheel.reschedule(_timer, _timeout))
+	{
+		_timer = wheel.schedule(_timeout, callback);
+	}
+}
+
+
+void SocketNotifier::cancelTimeout(Poco::TimingWheel& wheel)
+{
+	ScopedLock l(_mutex);
+	wheel.cancel(_timer);
+	_timeout = 0;
+	_hasTimeout = false;
+}
+
+
+Poco::Timespan SocketNotifier::getTimeout() const
+{
+	ScopedLock l(_mutex);
+	return _timeout;
+}
+
+
 } } // namespace Poco::Net
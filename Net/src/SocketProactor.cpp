@@ -17,12 +17,22 @@
 #include "Poco/Net/DatagramSocketImpl.h"
 #include "Poco/Thread.h"
 #include "Poco/Exception.h"
+#include "Poco/Error.h"
 #ifdef POCO_OS_FAMILY_WINDOWS
 #ifdef max
 #undef max
 #endif // max
 #endif // POCO_OS_FAMILY_WINDOWS
 #include <limits>
+#include <algorithm>
+#if defined(POCO_HAVE_IO_URING)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cstring>
+#endif
 
 
 using Poco::Exception;
@@ -221,6 +231,398 @@ private:
 };
 
 
+#if defined(POCO_HAVE_IO_URING)
+
+
+//
+// IOUring
+//
+
+class IOUring
+	/// IOUring is a minimal io_uring submission/completion ring
+	/// wrapper used by SocketProactor. It talks to the kernel
+	/// directly through io_uring_setup(2) and io_uring_enter(2),
+	/// so liburing is not required.
+	///
+	/// Operations can be pushed from any thread; they are
+	/// accumulated in the submission queue and submitted in
+	/// a batch by the polling thread, which is also the only
+	/// thread reaping completions.
+{
+public:
+	using Buffer = SocketProactor::Buffer;
+	using Callback = SocketProactor::Callback;
+
+	struct Operation
+		/// An in-flight I/O operation. Its address is passed
+		/// to the kernel as the submission entry user data.
+	{
+		~Operation()
+		{
+			if (owner)
+			{
+				delete pBuf;
+				delete pAddr;
+			}
+		}
+
+		Socket socket;
+		Buffer* pBuf = nullptr;
+		SocketAddress* pAddr = nullptr;
+		Callback onCompletion;
+		bool owner = false;
+		bool blocking = false;
+		bool receive = false;
+		bool message = false;
+		struct msghdr msg{};
+		struct iovec iov{};
+		struct sockaddr_storage addr{};
+	};
+
+	static const unsigned ENTRIES = 1024;
+
+	explicit IOUring(unsigned entries = ENTRIES)
+	{
+		io_uring_params params{};
+		_fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+		if (_fd < 0)
+			throw Poco::IOException("io_uring_setup() failed", Error::getMessage(Error::last()));
+		try
+		{
+			checkOpcodes();
+			map(params);
+		}
+		catch (...)
+		{
+			unmap();
+			close(_fd);
+			throw;
+		}
+		_canWait = (params.features & IORING_FEAT_EXT_ARG) != 0;
+	}
+
+	~IOUring()
+	{
+		try
+		{
+			cancelAll();
+		}
+		catch (...)
+		{
+			poco_unexpected();
+		}
+		unmap();
+		close(_fd);
+	}
+
+	void push(std::unique_ptr<Operation> pOp)
+		/// Prepares a submission entry for the operation. If the
+		/// polling thread is currently waiting for completions,
+		/// the entry is submitted immediately; otherwise it is
+		/// submitted with the next batch.
+	{
+		Poco::FastMutex::ScopedLock lock(_mutex);
+		io_uring_sqe* pSQE = nextSQE();
+		if (!pSQE)
+		{
+			submitImpl();
+			pSQE = nextSQE();
+			if (!pSQE) throw Poco::IOException("io_uring submission queue full");
+		}
+		prepare(*pSQE, *pOp);
+		pOp.release();
+		++_inFlight;
+		if (_waiting) submitImpl();
+	}
+
+	void submit(long timeoutMs)
+		/// Submits all pending entries. If there are operations
+		/// in flight but no completions, waits for up to timeoutMs
+		/// milliseconds for the first one.
+	{
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			submitImpl();
+			_waiting = _canWait && timeoutMs > 0 && _inFlight > 0 && !ready();
+		}
+		if (_waiting)
+		{
+			waitImpl(timeoutMs);
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			_waiting = false;
+		}
+	}
+
+	template <typename F>
+	int reap(F&& onComplete)
+		/// Calls onComplete(operation, result) for every completed
+		/// operation and deletes the operation afterwards.
+		/// Returns the number of completed operations.
+	{
+		int completed = 0;
+		unsigned head = *_cqHead;
+		while (head != __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE))
+		{
+			const io_uring_cqe& cqe = _cqes[head & _cqMask];
+			std::unique_ptr<Operation> pOp(reinterpret_cast<Operation*>(cqe.user_data));
+			int res = cqe.res;
+			__atomic_store_n(_cqHead, ++head, __ATOMIC_RELEASE);
+			if (pOp)
+			{
+				--_inFlight;
+				++completed;
+				onComplete(*pOp, res);
+			}
+		}
+		return completed;
+	}
+
+	std::size_t inFlight() const
+	{
+		return _inFlight;
+	}
+
+private:
+	void checkOpcodes()
+	{
+		const int nOps = 256;
+		std::vector<char> buf(sizeof(io_uring_probe) + nOps * sizeof(io_uring_probe_op));
+		io_uring_probe* pProbe = reinterpret_cast<io_uring_probe*>(buf.data());
+		if (syscall(__NR_io_uring_register, _fd, IORING_REGISTER_PROBE, pProbe, nOps) < 0)
+			throw Poco::NotImplementedException("io_uring opcode probing", Error::getMessage(Error::last()));
+		for (int op: {IORING_OP_SEND, IORING_OP_RECV, IORING_OP_SENDMSG, IORING_OP_RECVMSG})
+		{
+			if (op > pProbe->last_op || !(pProbe->ops[op].flags & IO_URING_OP_SUPPORTED))
+				throw Poco::NotImplementedException("io_uring opcode not supported");
+		}
+	}
+
+	void map(const io_uring_params& params)
+	{
+		_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+		if (singleMap) _sqRingSize = _cqRingSize = std::max(_sqRingSize, _cqRingSize);
+
+		_pSQRing = mapRegion(_sqRingSize, IORING_OFF_SQ_RING);
+		_pCQRing = singleMap ? _pSQRing : mapRegion(_cqRingSize, IORING_OFF_CQ_RING);
+		_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+		_sqes = static_cast<io_uring_sqe*>(mapRegion(_sqesSize, IORING_OFF_SQES));
+
+		char* pSQ = static_cast<char*>(_pSQRing);
+		_sqHead = reinterpret_cast<unsigned*>(pSQ + params.sq_off.head);
+		_sqTail = reinterpret_cast<unsigned*>(pSQ + params.sq_off.tail);
+		_sqMask = *reinterpret_cast<unsigned*>(pSQ + params.sq_off.ring_mask);
+		_sqEntries = *reinterpret_cast<unsigned*>(pSQ + params.sq_off.ring_entries);
+		_sqArray = reinterpret_cast<unsigned*>(pSQ + params.sq_off.array);
+		_sqLocalTail = *_sqTail;
+
+		char* pCQ = static_cast<char*>(_pCQRing);
+		_cqHead = reinterpret_cast<unsigned*>(pCQ + params.cq_off.head);
+		_cqTail = reinterpret_cast<unsigned*>(pCQ + params.cq_off.tail);
+		_cqMask = *reinterpret_cast<unsigned*>(pCQ + params.cq_off.ring_mask);
+		_cqes = reinterpret_cast<io_uring_cqe*>(pCQ + params.cq_off.cqes);
+	}
+
+	void* mapRegion(std::size_t size, off_t offset)
+	{
+		void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, offset);
+		if (p == MAP_FAILED)
+			throw Poco::IOException("io_uring ring mapping failed", Error::getMessage(Error::last()));
+		return p;
+	}
+
+	void unmap()
+	{
+		if (_sqes) munmap(_sqes, _sqesSize);
+		if (_pCQRing && _pCQRing != _pSQRing) munmap(_pCQRing, _cqRingSize);
+		if (_pSQRing) munmap(_pSQRing, _sqRingSize);
+		_sqes = nullptr;
+		_pCQRing = _pSQRing = nullptr;
+	}
+
+	io_uring_sqe* nextSQE()
+		/// Returns the next free submission entry, or nullptr
+		/// if the submission queue is full. Must be called
+		/// with the mutex held.
+	{
+		unsigned head = __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+		if (_sqLocalTail - head >= _sqEntries) return nullptr;
+		unsigned index = _sqLocalTail & _sqMask;
+		io_uring_sqe* pSQE = &_sqes[index];
+		std::memset(pSQE, 0, sizeof(io_uring_sqe));
+		_sqArray[index] = index;
+		++_sqLocalTail;
+		++_pending;
+		return pSQE;
+	}
+
+	static void prepare(io_uring_sqe& sqe, Operation& op)
+	{
+		Buffer& buf = *op.pBuf;
+		sqe.fd = static_cast<int>(op.socket.impl()->sockfd());
+		sqe.user_data = reinterpret_cast<__u64>(&op);
+		if (op.message)
+		{
+			op.iov.iov_base = buf.data();
+			op.iov.iov_len = buf.size();
+			op.msg.msg_iov = &op.iov;
+			op.msg.msg_iovlen = 1;
+			if (op.receive)
+			{
+				op.msg.msg_name = &op.addr;
+				op.msg.msg_namelen = sizeof(op.addr);
+				sqe.opcode = IORING_OP_RECVMSG;
+			}
+			else
+			{
+				op.msg.msg_name = const_cast<struct sockaddr*>(op.pAddr->addr());
+				op.msg.msg_namelen = op.pAddr->length();
+				sqe.opcode = IORING_OP_SENDMSG;
+				sqe.msg_flags = MSG_NOSIGNAL;
+			}
+			sqe.addr = reinterpret_cast<__u64>(&op.msg);
+			sqe.len = 1;
+		}
+		else
+		{
+			sqe.opcode = op.receive ? IORING_OP_RECV : IORING_OP_SEND;
+			sqe.addr = reinterpret_cast<__u64>(buf.data());
+			sqe.len = static_cast<__u32>(buf.size());
+			if (!op.receive) sqe.msg_flags = MSG_NOSIGNAL;
+		}
+	}
+
+	bool ready() const
+	{
+		return *_cqHead != __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE);
+	}
+
+	void submitImpl()
+		/// Publishes and submits all pending entries.
+		/// Must be called with the mutex held.
+	{
+		if (!_pending) return;
+		__atomic_store_n(_sqTail, _sqLocalTail, __ATOMIC_RELEASE);
+		while (_pending)
+		{
+			int rc = enter(_pending, 0, 0, nullptr, 0);
+			if (rc > 0) _pending -= rc;
+			else if (rc < 0 && errno == EINTR) continue;
+			else if (rc < 0 && (errno == EAGAIN || errno == EBUSY)) break; // retried on next batch
+			else if (rc < 0) throw Poco::IOException("io_uring_enter() failed", Error::getMessage(Error::last()));
+			else break;
+		}
+	}
+
+	void waitImpl(long timeoutMs)
+	{
+		__kernel_timespec ts{};
+		ts.tv_sec = timeoutMs / 1000;
+		ts.tv_nsec = (timeoutMs % 1000) * 1000000;
+		io_uring_getevents_arg arg{};
+		arg.ts = reinterpret_cast<__u64>(&ts);
+		// ETIME (timeout) and EINTR are expected here
+		enter(0, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+	}
+
+	void cancelAll()
+		/// Cancels all in-flight operations and waits (bounded)
+		/// for the kernel to release them. Operations that are
+		/// still not completed are leaked rather than freed,
+		/// because the kernel may still access their memory.
+	{
+		{
+			Poco::FastMutex::ScopedLock lock(_mutex);
+			if (_inFlight == 0) return;
+			io_uring_sqe* pSQE = nextSQE();
+			if (!pSQE)
+			{
+				submitImpl();
+				pSQE = nextSQE();
+			}
+			if (pSQE)
+			{
+				pSQE->opcode = IORING_OP_ASYNC_CANCEL;
+				pSQE->fd = -1;
+				pSQE->cancel_flags = IORING_ASYNC_CANCEL_ANY;
+			}
+			submitImpl();
+		}
+		for (int i = 0; i < 10 && _inFlight; ++i)
+		{
+			if (!ready() && _canWait) waitImpl(10);
+			reap([](Operation&, int){});
+		}
+	}
+
+	int enter(unsigned toSubmit, unsigned minComplete, unsigned flags, void* arg, std::size_t argSize)
+	{
+		return static_cast<int>(syscall(__NR_io_uring_enter, _fd, toSubmit, minComplete, flags, arg, argSize));
+	}
+
+	int _fd = -1;
+	bool _canWait = false;
+	bool _waiting = false;
+	unsigned _pending = 0;
+	std::atomic<std::size_t> _inFlight{0};
+	Poco::FastMutex _mutex;
+
+	void* _pSQRing = nullptr;
+	void* _pCQRing = nullptr;
+	std::size_t _sqRingSize = 0;
+	std::size_t _cqRingSize = 0;
+	std::size_t _sqesSize = 0;
+
+	io_uring_sqe* _sqes = nullptr;
+	unsigned* _sqHead = nullptr;
+	unsigned* _sqTail = nullptr;
+	unsigned* _sqArray = nullptr;
+	unsigned _sqMask = 0;
+	unsigned _sqEntries = 0;
+	unsigned _sqLocalTail = 0;
+
+	io_uring_cqe* _cqes = nullptr;
+	unsigned* _cqHead = nullptr;
+	unsigned* _cqTail = nullptr;
+	unsigned _cqMask = 0;
+};
+
+
+#else
+
+
+class IOUring
+	/// Placeholder for platforms without io_uring.
+{
+};
+
+
+#endif // POCO_HAVE_IO_URING
+
+
+namespace
+{
+	std::unique_ptr<IOUring> createIOUring(SocketProactor::IOEngine engine)
+	{
+#if defined(POCO_HAVE_IO_URING)
+		if (engine == SocketProactor::IO_ENGINE_IO_URING)
+		{
+			try
+			{
+				return std::make_unique<IOUring>();
+			}
+			catch (Poco::Exception&)
+			{
+				// fall back to PollSet
+			}
+		}
+#endif
+		return nullptr;
+	}
+}
+
+
 //
 // SocketProactor
 //
@@ -229,7 +631,7 @@ const Timestamp::TimeDiff SocketProactor::PERMANENT_COMPLETION_HANDLER =
 	std::numeric_limits<Timestamp::TimeDiff>::max();
 
 
-SocketProactor::SocketProactor(bool worker):
+SocketProactor::SocketProactor(bool worker, IOEngine engine):
 	_isRunning(false),
 	_isStopped(false),
 	_stop(false),
@@ -237,12 +639,13 @@ SocketProactor::SocketProactor(bool worker):
 	_maxTimeout(DEFAULT_MAX_TIMEOUT_MS),
 	_pThread(nullptr),
 	_ioCompletion(_maxTimeout),
-	_pWorker(worker ? new Worker : nullptr)
+	_pWorker(worker ? new Worker : nullptr),
+	_pIOUring(createIOUring(engine))
 {
 }
 
 
-SocketProactor::SocketProactor(const Poco::Timespan& timeout, bool worker):
+SocketProactor::SocketProactor(const Poco::Timespan& timeout, bool worker, IOEngine engine):
 	_isRunning(false),
 	_isStopped(false),
 	_stop(false),
@@ -250,7 +653,8 @@ SocketProactor::SocketProactor(const Poco::Timespan& timeout, bool worker):
 	_maxTimeout(static_cast<long>(timeout.totalMilliseconds())),
 	_pThread(nullptr),
 	_ioCompletion(_maxTimeout),
-	_pWorker(worker ? new Worker : nullptr)
+	_pWorker(worker ? new Worker : nullptr),
+	_pIOUring(createIOUring(engine))
 {
 }
 
@@ -259,6 +663,7 @@ SocketProactor::~SocketProactor()
 {
 	_ioCompletion.stop();
 	wait();
+	_pIOUring.reset();
 	for (auto& pS : _writeHandlers)
 	{
 		for (auto& pH : pS.second)
@@ -290,7 +695,9 @@ int SocketProactor::poll(int* pHandled)
 {
 	int handled = 0;
 	int worked = 0;
-	PollSet::SocketModeMap sm = _pollSet.poll(_timeout);
+	PollSet::SocketModeMap sm;
+	if (_pIOUring) handled = pollIOUring();
+	else sm = _pollSet.poll(_timeout);
 	if (sm.size() > 0)
 	{
 		auto it = sm.begin();
@@ -328,7 +735,7 @@ int SocketProactor::poll(int* pHandled)
 }
 
 
-void SocketProactor::addReceiveFrom(Socket sock, Buffer& buf, Poco::Net::SocketAddress& addr, Callback&& onCompletion)
+void SocketProactor::addReceiveFrom(Socket sock, Buffer& buf, Poco::Net::SocketAddress& addr, Callback&& onCompletion, bool blocking)
 {
 	if (!sock.isDatagram())
 		throw Poco::InvalidArgumentException("SocketProactor::addSend(): UDP socket required");
@@ -336,6 +743,13 @@ void SocketProactor::addReceiveFrom(Socket sock, Buffer& buf, Poco::Net::SocketA
 	pHandler->_pAddr = std::addressof(addr);
 	pHandler->_pBuf = std::addressof(buf);
 	pHandler->_onCompletion = std::move(onCompletion);
+	pHandler->_blocking = blocking;
+
+	if (_pIOUring)
+	{
+		addIOUring(sock, *pHandler, false);
+		return;
+	}
 
 	Poco::Mutex::ScopedLock l(_readMutex);
 	_readHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
@@ -343,7 +757,7 @@ void SocketProactor::addReceiveFrom(Socket sock, Buffer& buf, Poco::Net::SocketA
 }
 
 
-void SocketProactor::addSendTo(Socket sock, const Buffer& message, const SocketAddress& addr, Callback&& onCompletion)
+void SocketProactor::addSendTo(Socket sock, const Buffer& message, const SocketAddress& addr, Callback&& onCompletion, bool blocking)
 {
 	if (!sock.isDatagram())
 		throw Poco::InvalidArgumentException("SocketProactor::addSend(): UDP socket required");
@@ -360,11 +774,11 @@ void SocketProactor::addSendTo(Socket sock, const Buffer& message, const SocketA
 		delete pAddr;
 		throw;
 	}
-	addSend(sock, pMessage, pAddr, std::move(onCompletion), true);
+	addSend(sock, pMessage, pAddr, std::move(onCompletion), true, blocking);
 }
 
 
-void SocketProactor::addSendTo(Socket sock, Buffer&& message, const SocketAddress&& addr, Callback&& onCompletion)
+void SocketProactor::addSendTo(Socket sock, Buffer&& message, const SocketAddress&& addr, Callback&& onCompletion, bool blocking)
 {
 	if (!sock.isDatagram())
 		throw Poco::InvalidArgumentException("SocketProactor::addSend(): UDP socket required");
@@ -381,11 +795,11 @@ void SocketProactor::addSendTo(Socket sock, Buffer&& message, const SocketAddres
 		delete pAddr;
 		throw;
 	}
-	addSend(sock, pMessage, pAddr, std::move(onCompletion), true);
+	addSend(sock, pMessage, pAddr, std::move(onCompletion), true, blocking);
 }
 
 
-void SocketProactor::addReceive(Socket sock, Buffer& buf, Callback&& onCompletion)
+void SocketProactor::addReceive(Socket sock, Buffer& buf, Callback&& onCompletion, bool blocking)
 {
 	if (!sock.isStream())
 		throw Poco::InvalidArgumentException("SocketProactor::addSend(): TCP socket required");
@@ -393,6 +807,13 @@ void SocketProactor::addReceive(Socket sock, Buffer& buf, Callback&& onCompletio
 	pHandler->_pAddr = nullptr;
 	pHandler->_pBuf = std::addressof(buf);
 	pHandler->_onCompletion = std::move(onCompletion);
+	pHandler->_blocking = blocking;
+
+	if (_pIOUring)
+	{
+		addIOUring(sock, *pHandler, false);
+		return;
+	}
 
 	Poco::Mutex::ScopedLock l(_readMutex);
 	_readHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
@@ -400,7 +821,7 @@ void SocketProactor::addReceive(Socket sock, Buffer& buf, Callback&& onCompletio
 }
 
 
-void SocketProactor::addSend(Socket sock, const Buffer& message, Callback&& onCompletion)
+void SocketProactor::addSend(Socket sock, const Buffer& message, Callback&& onCompletion, bool blocking)
 {
 	if (!sock.isStream())
 		throw Poco::InvalidArgumentException("SocketProactor::addSend(): TCP socket required");
@@ -414,11 +835,11 @@ void SocketProactor::addSend(Socket sock, const Buffer& message, Callback&& onCo
 		delete pMessage;
 		throw;
 	}
-	addSend(sock, pMessage, nullptr, std::move(onCompletion), true);
+	addSend(sock, pMessage, nullptr, std::move(onCompletion), true, blocking);
 }
 
 
-void SocketProactor::addSend(Socket sock, Buffer&& message, Callback&& onCompletion)
+void SocketProactor::addSend(Socket sock, Buffer&& message, Callback&& onCompletion, bool blocking)
 {
 	if (!sock.isStream())
 		throw Poco::InvalidArgumentException("SocketProactor::addSend(): TCP socket required");
@@ -432,17 +853,24 @@ void SocketProactor::addSend(Socket sock, Buffer&& message, Callback&& onComplet
 		delete pMessage;
 		throw;
 	}
-	addSend(sock, pMessage, nullptr, std::move(onCompletion), true);
+	addSend(sock, pMessage, nullptr, std::move(onCompletion), true, blocking);
 }
 
 
-void SocketProactor::addSend(Socket sock, Buffer* pMessage, SocketAddress* pAddr, Callback&& onCompletion, bool own)
+void SocketProactor::addSend(Socket sock, Buffer* pMessage, SocketAddress* pAddr, Callback&& onCompletion, bool own, bool blocking)
 {
 	std::unique_ptr<Handler> pHandler(new Handler);
 	pHandler->_pAddr = pAddr;
 	pHandler->_pBuf = pMessage;
 	pHandler->_onCompletion = std::move(onCompletion);
 	pHandler->_owner = own;
+	pHandler->_blocking = blocking;
+
+	if (_pIOUring)
+	{
+		addIOUring(sock, *pHandler, true);
+		return;
+	}
 
 	Poco::Mutex::ScopedLock l(_writeMutex);
 	_writeHandlers[sock.impl()->sockfd()].push_back(std::move(pHandler));
@@ -450,6 +878,89 @@ void SocketProactor::addSend(Socket sock, Buffer* pMessage, SocketAddress* pAddr
 }
 
 
+int SocketProactor::pollIOUring()
+{
+#if defined(POCO_HAVE_IO_URING)
+	_pIOUring->submit(_timeout);
+	bool enqueued = false;
+	int handled = _pIOUring->reap([this, &enqueued](IOUring::Operation& op, int res)
+	{
+		if (op.receive && op.message && res >= 0)
+		{
+			*op.pAddr = SocketAddress(reinterpret_cast<const struct sockaddr*>(&op.addr),
+				static_cast<poco_socklen_t>(op.msg.msg_namelen));
+		}
+		const int n = res > 0 ? res : 0;
+		const int err = res < 0 ? -res : 0;
+		if (op.blocking)
+		{
+			enqueueIONotification(std::move(op.onCompletion), n, err);
+			enqueued = true;
+		}
+		else callCompletionHandler(op.onCompletion, n, err);
+	});
+	if (enqueued) _ioCompletion.wakeUp();
+	return handled;
+#else
+	return 0;
+#endif
+}
+
+
+void SocketProactor::callCompletionHandler(Callback& onCompletion, int n, int err)
+{
+	if (!onCompletion) return;
+	try
+	{
+		onCompletion(std::error_code(err, std::generic_category()), n);
+	}
+	catch (Exception& exc)
+	{
+		ErrorHandler::handle(exc);
+	}
+	catch (std::exception& exc)
+	{
+		ErrorHandler::handle(exc);
+	}
+	catch (...)
+	{
+		ErrorHandler::handle();
+	}
+}
+
+
+void SocketProactor::addIOUring(Socket& sock, Handler& handler, bool send)
+{
+#if defined(POCO_HAVE_IO_URING)
+	// take ownership of the handler resources first,
+	// so that owned buffers are released on failure
+	std::unique_ptr<IOUring::Operation> pOp(new IOUring::Operation);
+	pOp->pBuf = handler._pBuf;
+	pOp->pAddr = handler._pAddr;
+	pOp->owner = handler._owner;
+	handler._owner = false;
+	pOp->onCompletion = std::move(handler._onCompletion);
+	pOp->blocking = handler._blocking;
+	pOp->socket = sock;
+	pOp->receive = !send;
+	pOp->message = sock.isDatagram();
+
+	if (!pOp->pBuf)
+		throw Poco::NullPointerException("SocketProactor: null buffer");
+	if (send && pOp->pBuf->empty())
+		throw Poco::InvalidArgumentException("SocketProactor: empty buffer");
+	if (pOp->message && !pOp->pAddr)
+		throw Poco::NullPointerException("SocketProactor: null address");
+	if (!send && pOp->pBuf->empty())
+		pOp->pBuf->resize(DEFAULT_RECEIVE_BUFFER_SIZE);
+
+	_pIOUring->push(std::move(pOp));
+#else
+	poco_bugcheck();
+#endif
+}
+
+
 int SocketProactor::error(Socket& sock)
 {
 	int cnt = errorImpl(sock, _readHandlers, _readMutex);
@@ -685,6 +1196,10 @@ bool SocketProactor::hasSocketHandlers() const
 {
 	if (_readHandlers.size() || _writeHandlers.size())
 		return true;
+#if defined(POCO_HAVE_IO_URING)
+	if (_pIOUring && _pIOUring->inFlight())
+		return true;
+#endif
 	return false;
 }
 
@@ -779,6 +1294,28 @@ bool SocketProactor::ioCompletionInProgress() const
 }
 
 
+bool SocketProactor::isIOUringAvailable()
+{
+#if defined(POCO_HAVE_IO_URING)
+	static const bool available = []()
+	{
+		try
+		{
+			IOUring ring(2);
+			return true;
+		}
+		catch (Poco::Exception&)
+		{
+			return false;
+		}
+	}();
+	return available;
+#else
+	return false;
+#endif
+}
+
+
 void SocketProactor::onShutdown()
 {
 	_pollSet.wakeUp();
@@ -37,7 +37,8 @@ SocketReactor::SocketReactor():
 	_pWritableNotification(new WritableNotification(this)),
 	_pErrorNotification(new ErrorNotification(this)),
 	_pTimeoutNotification(new TimeoutNotification(this)),
-	_pShutdownNotification(new ShutdownNotification(this))
+	_pShutdownNotification(new ShutdownNotification(this)),
+	_pSocketTimeoutNotification(new SocketTimeoutNotification(this))
 {
 }
 
@@ -49,7 +50,8 @@ SocketReactor::SocketReactor(const Poco::Timespan& pollTimeout, int threadAffini
 	_pWritableNotification(new WritableNotification(this)),
 	_pErrorNotification(new ErrorNotification(this)),
 	_pTimeoutNotification(new TimeoutNotification(this)),
-	_pShutdownNotification(new ShutdownNotification(this))
+	_pShutdownNotification(new ShutdownNotification(this)),
+	_pSocketTimeoutNotification(new SocketTimeoutNotification(this))
 {
 	_params.pollTimeout = pollTimeout;
 }
@@ -62,7 +64,8 @@ SocketReactor::SocketReactor(const Params& params, int threadAffinity):
 	_pWritableNotification(new WritableNotification(this)),
 	_pErrorNotification(new ErrorNotification(this)),
 	_pTimeoutNotification(new TimeoutNotification(this)),
-	_pShutdownNotification(new ShutdownNotification(this))
+	_pShutdownNotification(new ShutdownNotification(this)),
+	_pSocketTimeoutNotification(new SocketTimeoutNotification(this))
 {
 
 }
@@ -83,6 +86,7 @@ void SocketReactor::run()
 	}
 	Poco::Stopwatch sw;
 	if (_params.throttle) sw.start();
+	Poco::Clock lastEvent;
 	PollSet::SocketModeMap sm;
 	while (!_stop)
 	{
@@ -90,7 +94,10 @@ void SocketReactor::run()
 		{
 			if (hasSocketHandlers())
 			{
-				sm = _pollSet.poll(_params.pollTimeout);
+				// wake up in time for the next socket timeout
+				Poco::Timespan pollTimeout = _socketTimers.nextTimeout(_params.pollTimeout);
+				bool shortened = pollTimeout < _params.pollTimeout;
+				sm = _pollSet.poll(pollTimeout);
 				if (_stop) break;
 				for (const auto& s : sm)
 				{
@@ -125,15 +132,27 @@ void SocketReactor::run()
 						ErrorHandler::handle();
 					}
 				}
+				if (!_socketTimers.empty()) _socketTimers.advance();
 				if (0 == sm.size())
 				{
-					onTimeout();
+					// a poll shortened for a socket timeout does not
+					// count as a timeout unless the full poll timeout
+					// has elapsed since the last event
+					if (!shortened || lastEvent.elapsed() >= _params.pollTimeout.totalMicroseconds())
+					{
+						onTimeout();
+						lastEvent.update();
+					}
 					if (_params.throttle && _params.pollTimeout == 0)
 					{
 						if ((sw.elapsed()/1000) > _params.sleepLimit) sleep();
 					}
 				}
-				else if (_params.throttle) sw.restart();
+				else
+				{
+					lastEvent.update();
+					if (_params.throttle) sw.restart();
+				}
 			}
 			else sleep();
 		}
@@ -253,6 +272,7 @@ void SocketReactor::removeEventHandler(const Socket& socket, const Poco::Abstrac
 				_handlers.erase(pImpl->sockfd());
 			}
 			_pollSet.remove(socket);
+			pNotifier->cancelTimeout(_socketTimers);
 		}
 		pNotifier->removeObserver(this, observer);
 
@@ -292,7 +312,38 @@ void SocketReactor::remove(const Socket& socket)
 		}
 	}
 	if (pNotifier)
+	{
+		pNotifier->cancelTimeout(_socketTimers);
 		pNotifier->disableObservers();
+	}
+}
+
+
+void SocketReactor::setSocketTimeout(const Socket& socket, const Poco::Timespan& timeout)
+{
+	NotifierPtr pNotifier = getNotifier(socket);
+	if (!pNotifier) return;
+
+	pNotifier->setTimeout(_socketTimers, timeout, socketTimerCallback(socket.impl()->sockfd()));
+}
+
+
+Poco::Timespan SocketReactor::getSocketTimeout(const Socket& socket)
+{
+	NotifierPtr pNotifier = getNotifier(socket);
+	if (!pNotifier) return Poco::Timespan();
+
+	return pNotifier->getTimeout();
+}
+
+
+void SocketReactor::restartSocketTimeout(const Socket& socket)
+{
+	NotifierPtr pNotifier = getNotifier(socket);
+	if (pNotifier && pNotifier->hasTimeout())
+	{
+		pNotifier->restartTimeout(_socketTimers, socketTimerCallback(socket.impl()->sockfd()));
+	}
 }
 
 
@@ -308,12 +359,64 @@ void SocketReactor::onShutdown()
 }
 
 
+void SocketReactor::onSocketTimeout(const Socket& socket)
+{
+	dispatch(socket, _pSocketTimeoutNotification);
+}
+
+
+void SocketReactor::onSocketTimer(poco_socket_t sockfd)
+{
+	NotifierPtr pNotifier;
+	{
+		ScopedLock lock(_mutex);
+		auto it = _handlers.find(sockfd);
+		if (it == _handlers.end()) return;
+		pNotifier = it->second;
+	}
+	Socket socket = pNotifier->socket();
+	try
+	{
+		onSocketTimeout(socket);
+	}
+	catch (Exception& exc)
+	{
+		onError(socket, exc.code(), exc.displayText());
+		ErrorHandler::handle(exc);
+	}
+	catch (std::exception& exc)
+	{
+		onError(socket, 0, exc.what());
+		ErrorHandler::handle(exc);
+	}
+	catch (...)
+	{
+		onError(socket, 0, "unknown exception");
+		ErrorHandler::handle();
+	}
+}
+
+
+Poco::TimingWheel::Callback SocketReactor::socketTimerCallback(poco_socket_t sockfd)
+{
+	return [this, sockfd]()
+		{
+			onSocketTimer(sockfd);
+		};
+}
+
+
 void SocketReactor::dispatch(const Socket& socket, SocketNotification* pNotification)
 {
 	if (!_pollSet.has(socket)) return;  // Socket was removed, skip dispatch
 
 	NotifierPtr pNotifier = getNotifier(socket);
 	if (!pNotifier) return;
+	if (pNotifier->hasTimeout() &&
+		(pNotification == _pReadableNotification || pNotification == _pWritableNotification))
+	{
+		pNotifier->restartTimeout(_socketTimers, socketTimerCallback(socket.impl()->sockfd()));
+	}
 	pNotifier->dispatch(pNotification);
 }
 
@@ -29,7 +29,9 @@ UDPServerParams::UDPServerParams(const Poco::Net::SocketAddress& sa,
 		_timeout(timeout),
 		_handlerBufListSize(handlerBufListSize),
 		_notifySender(notifySender),
-		_backlogThreshold(backlogThreshold)
+		_backlogThreshold(backlogThreshold),
+		_batchSize(1),
+		_udpGRO(false)
 {
 }
 
@@ -39,4 +41,18 @@ UDPServerParams::~UDPServerParams()
 }
 
 
+void UDPServerParams::setBatchSize(int batchSize)
+{
+	poco_assert (batchSize > 0);
+
+	_batchSize = batchSize;
+}
+
+
+void UDPServerParams::setUDPGRO(bool flag)
+{
+	_udpGRO = flag;
+}
+
+
 } } // namespace Poco::Net
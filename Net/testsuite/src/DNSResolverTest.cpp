@@ -0,0 +1,539 @@
+//
+// DNSResolverTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "DNSResolverTest.h"
+#include "DNSTestServer.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/DNSResolver.h"
+#include "Poco/Net/DNSMessage.h"
+#include "Poco/Net/SocketReactor.h"
+#include "Poco/Net/DatagramSocket.h"
+#include "Poco/Net/NetException.h"
+#include "Poco/Event.h"
+#include "Poco/Thread.h"
+#include <atomic>
+#include <memory>
+
+
+using Poco::Net::DNSResolver;
+using Poco::Net::DNSMessage;
+using Poco::Net::HostEntry;
+using Poco::Net::IPAddress;
+using Poco::Net::SocketAddress;
+using Poco::Net::ScopedSocketReactor;
+using Poco::Net::DatagramSocket;
+using Poco::Net::DNSException;
+using Poco::Net::HostNotFoundException;
+using Poco::Net::NoAddressFoundException;
+using Poco::Future;
+
+
+namespace
+{
+	DNSResolver::Params testParams(const DNSTestServer& server)
+	{
+		DNSResolver::Params params;
+		params.nameServers.push_back(server.address());
+		params.timeout = Poco::Timespan(0, 200000);
+		return params;
+	}
+
+
+	template <class E>
+	bool failsWith(const Future<HostEntry>& future)
+	{
+		try
+		{
+			future.get();
+		}
+		catch (E&)
+		{
+			return true;
+		}
+		catch (...)
+		{
+		}
+		return false;
+	}
+}
+
+
+DNSResolverTest::DNSResolverTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+DNSResolverTest::~DNSResolverTest()
+{
+}
+
+
+void DNSResolverTest::testMessage()
+{
+	DNSMessage message;
+	message.setId(0x1234);
+	message.setResponse(true);
+	message.setResponseCode(DNSMessage::RCODE_NXDOMAIN);
+	message.addQuestion("www.example.com", DNSMessage::TYPE_AAAA);
+	message.addAnswer(DNSMessage::cnameRecord("www.example.com", "example.com", 300));
+	message.addAnswer(DNSMessage::addressRecord("example.com", IPAddress("10.1.2.3"), 60));
+	message.addAuthority(DNSMessage::soaRecord("example.com", 30, 3600));
+
+	std::string buffer;
+	message.write(buffer);
+
+	DNSMessage message2;
+	message2.read(buffer.data(), buffer.size());
+	assertTrue (message2.getId() == 0x1234);
+	assertTrue (message2.isResponse());
+	assertTrue (!message2.isTruncated());
+	assertTrue (message2.getRecursionDesired());
+	assertTrue (message2.getResponseCode() == DNSMessage::RCODE_NXDOMAIN);
+	assertTrue (message2.questions().size() == 1);
+	assertTrue (message2.questions()[0].name == "www.example.com");
+	assertTrue (message2.questions()[0].type == DNSMessage::TYPE_AAAA);
+	assertTrue (message2.answers().size() == 2);
+	assertTrue (message2.answers()[0].type == DNSMessage::TYPE_CNAME);
+	assertTrue (message2.answers()[0].data == "example.com");
+	assertTrue (message2.answers()[0].ttl == 300);
+	assertTrue (DNSMessage::address(message2.answers()[1]) == IPAddress("10.1.2.3"));
+	assertTrue (message2.authorities().size() == 1);
+	assertTrue (DNSMessage::soaMinimum(message2.authorities()[0]) == 30);
+	assertTrue (message2.authorities()[0].ttl == 3600);
+
+	assertTrue (DNSMessage::equalNames("Example.COM.", "example.com"));
+	assertTrue (!DNSMessage::equalNames("example.com", "example.co"));
+
+	std::string label(64, 'x');
+	DNSMessage invalid;
+	invalid.addQuestion(label + ".com", DNSMessage::TYPE_A);
+	try
+	{
+		invalid.write(buffer);
+		fail("label too long - must throw");
+	}
+	catch (DNSException&)
+	{
+	}
+}
+
+
+void DNSResolverTest::testMessageCompression()
+{
+	// response for alias.test, with CNAME host.test and an A record,
+	// using compression pointers as real name servers do
+	std::string buffer("\x12\x34\x81\x80\x00\x01\x00\x02\x00\x00\x00\x00", 12);
+	buffer.append("\x05" "alias" "\x04" "test" "\x00" "\x00\x01" "\x00\x01", 16);
+	buffer.append("\xC0\x0C" "\x00\x05" "\x00\x01" "\x00\x00\x01\x2C" "\x00\x07", 12);
+	std::size_t hostOffset = buffer.size();
+	buffer.append("\x04" "host" "\xC0\x12", 7);
+	buffer += static_cast<char>(0xC0);
+	buffer += static_cast<char>(hostOffset);
+	buffer.append("\x00\x01" "\x00\x01" "\x00\x00\x00\x3C" "\x00\x04" "\x0A\x00\x00\x01", 14);
+
+	DNSMessage message;
+	message.read(buffer.data(), buffer.size());
+	assertTrue (message.getId() == 0x1234);
+	assertTrue (message.isResponse());
+	assertTrue (message.questions()[0].name == "alias.test");
+	assertTrue (message.answers().size() == 2);
+	assertTrue (message.answers()[0].name == "alias.test");
+	assertTrue (message.answers()[0].data == "host.test");
+	assertTrue (message.answers()[1].name == "host.test");
+	assertTrue (message.answers()[1].ttl == 60);
+	assertTrue (DNSMessage::address(message.answers()[1]) == IPAddress("10.0.0.1"));
+}
+
+
+void DNSResolverTest::testMalformedMessage()
+{
+	// truncated header
+	std::string buffer("\x12\x34\x81\x80\x00\x01", 6);
+	DNSMessage message;
+	try
+	{
+		message.read(buffer.data(), buffer.size());
+		fail("truncated message - must throw");
+	}
+	catch (DNSException&)
+	{
+	}
+
+	// compression pointer loop
+	buffer.assign("\x12\x34\x81\x80\x00\x01\x00\x00\x00\x00\x00\x00", 12);
+	buffer.append("\xC0\x0C", 2);
+	try
+	{
+		message.read(buffer.data(), buffer.size());
+		fail("pointer loop - must throw");
+	}
+	catch (DNSException&)
+	{
+	}
+}
+
+
+void DNSResolverTest::testResolve()
+{
+	DNSTestServer server;
+	server.addRecord(DNSMessage::addressRecord("host.test", IPAddress("10.0.0.1"), 300));
+	server.addRecord(DNSMessage::addressRecord("host.test", IPAddress("10.0.0.2"), 300));
+#if defined(POCO_HAVE_IPv6)
+	server.addRecord(DNSMessage::addressRecord("host.test", IPAddress("fd00::1"), 300));
+#endif
+
+	ScopedSocketReactor reactor;
+	DNSResolver resolver(*reactor, testParams(server));
+	Future<HostEntry> future = resolver.resolve("Host.Test.");
+	const HostEntry& entry = future.get();
+	assertTrue (entry.name() == "host.test");
+	assertTrue (entry.aliases().empty());
+#if defined(POCO_HAVE_IPv6)
+	assertTrue (entry.addresses().size() == 3);
+	assertTrue (entry.addresses()[2] == IPAddress("fd00::1"));
+#else
+	assertTrue (entry.addresses().size() == 2);
+#endif
+	assertTrue (entry.addresses()[0] == IPAddress("10.0.0.1"));
+	assertTrue (entry.addresses()[1] == IPAddress("10.0.0.2"));
+	assertTrue (server.udpQueries() == 2);
+	assertTrue (resolver.pendingLookups() == 0);
+}
+
+
+void DNSResolverTest::testResolveCallback()
+{
+	DNSTestServer server;
+	server.addRecord(DNSMessage::addressRecord("host.test", IPAddress("10.0.0.1"), 300));
+
+	ScopedSocketReactor reactor;
+	DNSResolver::Params params = testParams(server);
+	params.queryIPv6 = false;
+	DNSResolver resolver(*reactor, params);
+
+	Poco::Event done;
+	HostEntry result;
+	std::exception_ptr pResultException;
+	resolver.resolve("host.test", [&](const HostEntry& entry, std::exception_ptr pException)
+		{
+			result = entry;
+			pResultException = pException;
+			done.set();
+		});
+	done.wait(5000);
+	assertTrue (!pResultException);
+	assertTrue (result.addresses().size() == 1);
+	assertTrue (result.addresses()[0] == IPAddress("10.0.0.1"));
+	assertTrue (server.udpQueries() == 1);
+
+	resolver.resolve("missing.test", [&](const HostEntry& entry, std::exception_ptr pException)
+		{
+			result = entry;
+			pResultException = pException;
+			done.set();
+		});
+	done.wait(5000);
+	assertTrue (pResultException != nullptr);
+	assertTrue (result.addresses().empty());
+}
+
+
+void DNSResolverTest::testResolveNumeric()
+{
+	DNSTestServer server;
+	ScopedSocketReactor reactor;
+	DNSResolver resolver(*reactor, testParams(server));
+
+	Future<HostEntry> future = resolver.resolve("192.168.1.1");
+	assertTrue (future.isReady());
+	assertTrue (future.get().addresses().size() == 1);
+	assertTrue (future.get().addresses()[0] == IPAddress("192.168.1.1"));
+	assertTrue (server.udpQueries() == 0);
+}
+
+
+void DNSResolverTest::testCNAME()
+{
+	DNSTestServer server;
+	server.addRecord(DNSMessage::cnameRecord("www.test", "alias.test", 300));
+	server.addRecord(DNSMessage::cnameRecord("alias.test", "host.test", 300));
+	server.addRecord(DNSMessage::addressRecord("host.test", IPAddress("10.0.0.1"), 300));
+
+	ScopedSocketReactor reactor;
+	DNSResolver resolver(*reactor, testParams(server));
+	const HostEntry entry = resolver.resolve("www.test").get();
+	assertTrue (entry.name() == "host.test");
+	assertTrue (entry.aliases().size() == 2);
+	assertTrue (entry.aliases()[0] == "www.test");
+	assertTrue (entry.aliases()[1] == "alias.test");
+	assertTrue (entry.addresses().size() == 1);
+	assertTrue (entry.addresses()[0] == IPAddress("10.0.0.1"));
+}
+
+
+void DNSResolverTest::testNotFound()
+{
+	DNSTestServer server;
+	ScopedSocketReactor reactor;
+	DNSResolver resolver(*reactor, testParams(server));
+
+	assertTrue (failsWith<HostNotFoundException>(resolver.resolve("missing.test")));
+	int queries = server.udpQueries();
+	assertTrue (queries == 2);
+
+	// negative answers are cached
+	assertTrue (failsWith<HostNotFoundException>(resolver.resolve("missing.test")));
+	assertTrue (server.udpQueries() == queries);
+	assertTrue (resolver.cacheSize() == 1);
+}
+
+
+void DNSResolverTest::testNoAddress()
+{
+	DNSTestServer server;
+	server.addRecord(DNSMessage::cnameRecord("mail.test", "host.test", 300));
+	server.addRecord(DNSMessage::cnameRecord("host.test", "other.test", 300));
+	server.addRecord(DNSMessage::soaRecord("other.test", 60, 60));
+
+	ScopedSocketReactor reactor;
+	DNSResolver resolver(*reactor, testParams(server));
+
+	assertTrue (failsWith<NoAddressFoundException>(resolver.resolve("mail.test")));
+	int queries = server.udpQueries();
+	assertTrue (failsWith<NoAddressFoundException>(resolver.resolve("mail.test")));
+	assertTrue (server.udpQueries() == queries);
+}
+
+
+void DNSResolverTest::testCache()
+{
+	DNSTestServer server;
+	server.addRecord(DNSMessage::addressRecord("host.test", IPAddress("10.0.0.1"), 300));
+
+	ScopedSocketReactor reactor;
+	DNSResolver resolver(*reactor, testParams(server));
+
+	resolver.resolve("host.test").get();
+	assertTrue (server.udpQueries() == 2);
+	assertTrue (resolver.cacheSize() == 1);
+
+	// served from the cache, without waiting for the reactor
+	Future<HostEntry> future = resolver.resolve("HOST.test");
+	assertTrue (future.isReady());
+	assertTrue (future.get().addresses()[0] == IPAddress("10.0.0.1"));
+	assertTrue (server.udpQueries() == 2);
+
+	resolver.clearCache();
+	assertTrue (resolver.cacheSize() == 0);
+	resolver.resolve("host.test").get();
+	assertTrue (server.udpQueries() == 4);
+
+	// caching disabled
+	DNSResolver::Params params = testParams(server);
+	params.cacheSize = 0;
+	DNSResolver uncached(*reactor, params);
+	uncached.resolve("host.test").get();
+	uncached.resolve("host.test").get();
+	assertTrue (server.udpQueries() == 8);
+}
+
+
+void DNSResolverTest::testCacheExpiry()
+{
+	DNSTestServer server;
+	server.addRecord(DNSMessage::addressRecord("short.test", IPAddress("10.0.0.1"), 1));
+	server.addRecord(DNSMessage::addressRecord("long.test", IPAddress("10.0.0.2"), 3600));
+
+	ScopedSocketReactor reactor;
+	DNSResolver::Params params = testParams(server);
+	params.queryIPv6 = false;
+	params.maxTTL = Poco::Timespan(2, 0);
+	DNSResolver resolver(*reactor, params);
+
+	resolver.resolve("short.test").get();
+	resolver.resolve("long.test").get();
+	assertTrue (server.udpQueries() == 2);
+
+	Poco::Thread::sleep(1200);
+	resolver.resolve("short.test").get();
+	resolver.resolve("long.test").get();
+	assertTrue (server.udpQueries() == 3);
+
+	// the TTL of long.test is limited to maxTTL
+	Poco::Thread::sleep(1000);
+	resolver.resolve("long.test").get();
+	assertTrue (server.udpQueries() == 4);
+}
+
+
+void DNSResolverTest::testCoalescing()
+{
+	DNSTestServer server;
+	server.addRecord(DNSMessage::addressRecord("host.test", IPAddress("10.0.0.1"), 300));
+	server.setDelay(100);
+
+	ScopedSocketReactor reactor;
+	DNSResolver::Params params = testParams(server);
+	params.timeout = Poco::Timespan(5, 0);
+	DNSResolver resolver(*reactor, params);
+
+	std::vector<Future<HostEntry>> futures;
+	for (int i = 0; i < 20; i++)
+	{
+		futures.push_back(resolver.resolve("host.test"));
+	}
+	assertTrue (resolver.pendingLookups() == 1);
+	for (const auto& future: futures)
+	{
+		assertTrue (future.get().addresses()[0] == IPAddress("10.0.0.1"));
+	}
+	assertTrue (server.udpQueries() == 2);
+	assertTrue (resolver.pendingLookups() == 0);
+}
+
+
+void DNSResolverTest::testTimeout()
+{
+	DNSTestServer server;
+	server.drop("host.test");
+
+	ScopedSocketReactor reactor;
+	DNSResolver::Params params = testParams(server);
+	params.timeout = Poco::Timespan(0, 100000);
+	params.attempts = 3;
+	DNSResolver resolver(*reactor, params);
+
+	assertTrue (failsWith<Poco::TimeoutException>(resolver.resolve("host.test")));
+	assertTrue (server.udpQueries() == 6);
+
+	// timeouts are not cached
+	assertTrue (resolver.cacheSize() == 0);
+}
+
+
+void DNSResolverTest::testNextServer()
+{
+	DNSTestServer server;
+	server.addRecord(DNSMessage::addressRecord("host.test", IPAddress("10.0.0.1"), 300));
+
+	// a name server that never responds
+	DatagramSocket silent(SocketAddress("127.0.0.1", 0), true);
+
+	ScopedSocketReactor reactor;
+	DNSResolver::Params params;
+	params.nameServers.push_back(silent.address());
+	params.nameServers.push_back(server.address());
+	params.timeout = Poco::Timespan(0, 100000);
+	params.attempts = 1;
+	DNSResolver resolver(*reactor, params);
+
+	const HostEntry entry = resolver.resolve("host.test").get();
+	assertTrue (entry.addresses()[0] == IPAddress("10.0.0.1"));
+	assertTrue (server.udpQueries() == 2);
+}
+
+
+void DNSResolverTest::testServerFailure()
+{
+	DNSTestServer server;
+	server.addRecord(DNSMessage::addressRecord("host.test", IPAddress("10.0.0.1"), 300));
+	server.setResponseCode(DNSMessage::RCODE_SERVFAIL);
+
+	ScopedSocketReactor reactor;
+	DNSResolver::Params params = testParams(server);
+	params.queryIPv6 = false;
+	DNSResolver resolver(*reactor, params);
+
+	Future<HostEntry> future = resolver.resolve("host.test");
+	assertTrue (failsWith<DNSException>(future));
+	assertTrue (!failsWith<HostNotFoundException>(future));
+	assertTrue (server.udpQueries() == 2);
+	assertTrue (resolver.cacheSize() == 0);
+
+	server.setResponseCode(DNSMessage::RCODE_NOERROR);
+	assertTrue (resolver.resolve("host.test").get().addresses()[0] == IPAddress("10.0.0.1"));
+}
+
+
+void DNSResolverTest::testTruncated()
+{
+	DNSTestServer server;
+	for (int i = 1; i <= 40; i++)
+	{
+		server.addRecord(DNSMessage::addressRecord("big.test", IPAddress("10.0.0." + std::to_string(i)), 300));
+	}
+	server.truncate("big.test");
+
+	ScopedSocketReactor reactor;
+	DNSResolver resolver(*reactor, testParams(server));
+	const HostEntry entry = resolver.resolve("big.test").get();
+	assertTrue (entry.addresses().size() == 40);
+	assertTrue (server.udpQueries() >= 1);
+	assertTrue (server.tcpQueries() >= 1);
+
+	// without TCP, the truncated response is used as is
+	DNSResolver::Params params = testParams(server);
+	params.useTCP = false;
+	DNSResolver udpOnly(*reactor, params);
+	assertTrue (failsWith<NoAddressFoundException>(udpOnly.resolve("big.test")));
+}
+
+
+void DNSResolverTest::testDestroy()
+{
+	DNSTestServer server;
+	server.drop("host.test");
+
+	ScopedSocketReactor reactor;
+	DNSResolver::Params params = testParams(server);
+	params.timeout = Poco::Timespan(10, 0);
+	std::unique_ptr<DNSResolver> pResolver(new DNSResolver(*reactor, params));
+	Future<HostEntry> future = pResolver->resolve("host.test");
+	pResolver.reset();
+	assertTrue (future.isReady());
+	assertTrue (failsWith<Poco::IOException>(future));
+}
+
+
+void DNSResolverTest::setUp()
+{
+}
+
+
+void DNSResolverTest::tearDown()
+{
+}
+
+
+CppUnit::Test* DNSResolverTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("DNSResolverTest");
+
+	CppUnit_addTest(pSuite, DNSResolverTest, testMessage);
+	CppUnit_addTest(pSuite, DNSResolverTest, testMessageCompression);
+	CppUnit_addTest(pSuite, DNSResolverTest, testMalformedMessage);
+	CppUnit_addTest(pSuite, DNSResolverTest, testResolve);
+	CppUnit_addTest(pSuite, DNSResolverTest, testResolveCallback);
+	CppUnit_addTest(pSuite, DNSResolverTest, testResolveNumeric);
+	CppUnit_addTest(pSuite, DNSResolverTest, testCNAME);
+	CppUnit_addTest(pSuite, DNSResolverTest, testNotFound);
+	CppUnit_addTest(pSuite, DNSResolverTest, testNoAddress);
+	CppUnit_addTest(pSuite, DNSResolverTest, testCache);
+	CppUnit_addTest(pSuite, DNSResolverTest, testCacheExpiry);
+	CppUnit_addTest(pSuite, DNSResolverTest, testCoalescing);
+	CppUnit_addTest(pSuite, DNSResolverTest, testTimeout);
+	CppUnit_addTest(pSuite, DNSResolverTest, testNextServer);
+	CppUnit_addTest(pSuite, DNSResolverTest, testServerFailure);
+	CppUnit_addTest(pSuite, DNSResolverTest, testTruncated);
+	CppUnit_addTest(pSuite, DNSResolverTest, testDestroy);
+
+	return pSuite;
+}
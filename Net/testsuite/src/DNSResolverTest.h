@@ -0,0 +1,54 @@
+//
+// DNSResolverTest.h
+//
+// Definition of the DNSResolverTest class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef DNSResolverTest_INCLUDED
+#define DNSResolverTest_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "CppUnit/TestCase.h"
+
+
+class DNSResolverTest: public CppUnit::TestCase
+{
+public:
+	DNSResolverTest(const std::string& name);
+	~DNSResolverTest();
+
+	void testMessage();
+	void testMessageCompression();
+	void testMalformedMessage();
+	void testResolve();
+	void testResolveCallback();
+	void testResolveNumeric();
+	void testCNAME();
+	void testNotFound();
+	void testNoAddress();
+	void testCache();
+	void testCacheExpiry();
+	void testCoalescing();
+	void testTimeout();
+	void testNextServer();
+	void testServerFailure();
+	void testTruncated();
+	void testDestroy();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // DNSResolverTest_INCLUDED
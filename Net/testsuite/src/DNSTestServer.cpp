@@ -0,0 +1,223 @@
+//
+// DNSTestServer.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "DNSTestServer.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/NetException.h"
+#include <iostream>
+
+
+using Poco::Net::Socket;
+using Poco::Net::StreamSocket;
+using Poco::Net::SocketAddress;
+using Poco::Net::DNSMessage;
+
+
+DNSTestServer::DNSTestServer():
+	_thread("DNSTestServer"),
+	_stop(false),
+	_udpQueries(0),
+	_tcpQueries(0),
+	_delay(0),
+	_responseCode(DNSMessage::RCODE_NOERROR)
+{
+	_udpSocket.bind(SocketAddress("127.0.0.1", 0), true);
+	_tcpSocket.bind(SocketAddress("127.0.0.1", _udpSocket.address().port()), true);
+	_tcpSocket.listen();
+	_thread.start(*this);
+	_ready.wait();
+}
+
+
+DNSTestServer::~DNSTestServer()
+{
+	_stop = true;
+	_thread.join();
+}
+
+
+SocketAddress DNSTestServer::address() const
+{
+	return _udpSocket.address();
+}
+
+
+void DNSTestServer::addRecord(const DNSMessage::Record& record)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	_records.push_back(record);
+}
+
+
+void DNSTestServer::truncate(const std::string& name)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	_truncate.insert(name);
+}
+
+
+void DNSTestServer::drop(const std::string& name)
+{
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	_drop.insert(name);
+}
+
+
+void DNSTestServer::setDelay(long milliseconds)
+{
+	_delay = milliseconds;
+}
+
+
+void DNSTestServer::setResponseCode(DNSMessage::ResponseCode code)
+{
+	_responseCode = code;
+}
+
+
+int DNSTestServer::udpQueries() const
+{
+	return _udpQueries;
+}
+
+
+int DNSTestServer::tcpQueries() const
+{
+	return _tcpQueries;
+}
+
+
+void DNSTestServer::run()
+{
+	_ready.set();
+	Poco::Timespan span(100000);
+	while (!_stop)
+	{
+		Socket::SocketList readList;
+		Socket::SocketList writeList;
+		Socket::SocketList exceptList;
+		readList.push_back(_udpSocket);
+		readList.push_back(_tcpSocket);
+		if (Socket::select(readList, writeList, exceptList, span) == 0) continue;
+
+		for (auto& socket: readList)
+		{
+			try
+			{
+				if (socket == _udpSocket)
+				{
+					char buffer[DNSMessage::MAX_UDP_SIZE];
+					SocketAddress sender;
+					int n = _udpSocket.receiveFrom(buffer, sizeof(buffer), sender);
+					_udpQueries++;
+					std::string response = respond(buffer, n, false);
+					if (!response.empty()) _udpSocket.sendTo(response.data(), static_cast<int>(response.size()), sender);
+				}
+				else
+				{
+					StreamSocket ss = _tcpSocket.acceptConnection();
+					serveTCP(ss);
+				}
+			}
+			catch (Poco::Exception& exc)
+			{
+				std::cerr << "DNSTestServer: " << exc.displayText() << std::endl;
+			}
+		}
+	}
+}
+
+
+void DNSTestServer::serveTCP(StreamSocket& socket)
+{
+	socket.setReceiveTimeout(Poco::Timespan(1, 0));
+	std::string buffer;
+	char data[1024];
+	int n;
+	while (!_stop && (n = socket.receiveBytes(data, sizeof(data))) > 0)
+	{
+		buffer.append(data, n);
+		while (buffer.size() >= 2)
+		{
+			std::size_t length = (static_cast<unsigned char>(buffer[0]) << 8) | static_cast<unsigned char>(buffer[1]);
+			if (buffer.size() < length + 2) break;
+			_tcpQueries++;
+			std::string response = respond(buffer.data() + 2, length, true);
+			buffer.erase(0, length + 2);
+			if (!response.empty())
+			{
+				std::string frame;
+				frame += static_cast<char>(response.size() >> 8);
+				frame += static_cast<char>(response.size() & 0xFF);
+				frame += response;
+				socket.sendBytes(frame.data(), static_cast<int>(frame.size()));
+			}
+		}
+	}
+}
+
+
+std::string DNSTestServer::respond(const char* data, std::size_t size, bool tcp)
+{
+	DNSMessage query;
+	query.read(data, size);
+	if (query.questions().size() != 1) return std::string();
+	const DNSMessage::Question& question = query.questions().front();
+
+	if (_delay > 0) Poco::Thread::sleep(_delay);
+
+	DNSMessage response;
+	response.setId(query.getId());
+	response.setResponse(true);
+	response.addQuestion(question.name, question.type);
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+	if (_drop.count(question.name)) return std::string();
+
+	if (_responseCode != DNSMessage::RCODE_NOERROR)
+	{
+		response.setResponseCode(static_cast<DNSMessage::ResponseCode>(_responseCode.load()));
+	}
+	else if (!tcp && _truncate.count(question.name))
+	{
+		response.setTruncated(true);
+	}
+	else
+	{
+		std::string owner = question.name;
+		bool exists = false;
+		for (bool more = true; more;)
+		{
+			more = false;
+			for (const auto& record: _records)
+			{
+				if (!DNSMessage::equalNames(record.name, owner)) continue;
+				exists = true;
+				if (record.type == DNSMessage::TYPE_CNAME)
+				{
+					response.addAnswer(record);
+					owner = record.data;
+					more = true;
+					break;
+				}
+				if (record.type == question.type) response.addAnswer(record);
+			}
+		}
+		if (response.answers().empty())
+		{
+			if (!exists) response.setResponseCode(DNSMessage::RCODE_NXDOMAIN);
+			response.addAuthority(DNSMessage::soaRecord("test", 60, 120));
+		}
+	}
+
+	std::string buffer;
+	response.write(buffer);
+	return buffer;
+}
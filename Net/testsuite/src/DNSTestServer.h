@@ -0,0 +1,96 @@
+//
+// DNSTestServer.h
+//
+// Definition of the DNSTestServer class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef DNSTestServer_INCLUDED
+#define DNSTestServer_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "Poco/Net/DNSMessage.h"
+#include "Poco/Net/DatagramSocket.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Thread.h"
+#include "Poco/Event.h"
+#include "Poco/Mutex.h"
+#include <atomic>
+#include <set>
+#include <vector>
+
+
+class DNSTestServer: public Poco::Runnable
+	/// A simple sequential DNS server for testing DNSResolver,
+	/// answering queries over UDP and TCP on the loopback
+	/// interface from a list of records.
+	///
+	/// Names without any records are answered with NXDOMAIN,
+	/// names without records of the requested type with an
+	/// empty answer. In both cases, a SOA record is included.
+{
+public:
+	DNSTestServer();
+		/// Creates the DNSTestServer.
+
+	~DNSTestServer();
+		/// Destroys the DNSTestServer.
+
+	Poco::Net::SocketAddress address() const;
+		/// Returns the address of the server. UDP and
+		/// TCP use the same port.
+
+	void addRecord(const Poco::Net::DNSMessage::Record& record);
+		/// Adds a record.
+
+	void truncate(const std::string& name);
+		/// Makes the server send truncated responses over
+		/// UDP for the given name.
+
+	void drop(const std::string& name);
+		/// Makes the server ignore queries for the given name.
+
+	void setDelay(long milliseconds);
+		/// Delays all responses by the given interval.
+
+	void setResponseCode(Poco::Net::DNSMessage::ResponseCode code);
+		/// Makes the server send the given response
+		/// code instead of answering queries.
+
+	int udpQueries() const;
+		/// Returns the number of queries received over UDP.
+
+	int tcpQueries() const;
+		/// Returns the number of queries received over TCP.
+
+	void run();
+		/// Does the work.
+
+private:
+	std::string respond(const char* data, std::size_t size, bool tcp);
+	void serveTCP(Poco::Net::StreamSocket& socket);
+
+	Poco::Net::DatagramSocket _udpSocket;
+	Poco::Net::ServerSocket _tcpSocket;
+	Poco::Thread _thread;
+	Poco::Event _ready;
+	std::atomic<bool> _stop;
+	std::atomic<int> _udpQueries;
+	std::atomic<int> _tcpQueries;
+	std::atomic<long> _delay;
+	std::atomic<int> _responseCode;
+	Poco::Net::DNSMessage::Records _records;
+	std::set<std::string> _truncate;
+	std::set<std::string> _drop;
+	mutable Poco::FastMutex _mutex;
+};
+
+
+#endif // DNSTestServer_INCLUDED
@@ -20,11 +20,14 @@
 #include "Poco/Stopwatch.h"
 #include "Poco/Thread.h"
 #include <cstring>
+#include <iostream>
 
 
 using Poco::Net::Socket;
 using Poco::Net::DatagramSocket;
 using Poco::Net::SocketAddress;
+using Poco::Net::SocketDatagram;
+using Poco::Net::SocketDatagramVec;
 using Poco::Net::IPAddress;
 #ifdef POCO_NET_HAS_INTERFACE
 	using Poco::Net::NetworkInterface;
@@ -804,6 +807,127 @@ void DatagramSocketTest::testGatherScatterVariableUNIX()
 }
 
 
+void DatagramSocketTest::testSendReceiveBatch()
+{
+	DatagramSocket receiver(SocketAddress("127.0.0.1", 0), false);
+	receiver.setReceiveTimeout(Timespan(5, 0));
+	DatagramSocket sender(SocketAddress("127.0.0.1", 0), false);
+	SocketAddress target = receiver.address();
+
+	const int count = 20;
+	std::vector<std::string> messages;
+	SocketDatagramVec out(count);
+	for (int i = 0; i < count; i++) messages.push_back("message " + std::to_string(i));
+	for (int i = 0; i < count; i++)
+	{
+		out[i].buffer = const_cast<char*>(messages[i].data());
+		out[i].length = static_cast<int>(messages[i].size());
+		out[i].pAddress = const_cast<struct sockaddr*>(target.addr());
+		out[i].addressLength = target.length();
+	}
+	assertTrue (sender.sendBatch(out) == count);
+
+	std::vector<std::string> buffers(count, std::string(256, '\0'));
+	std::vector<struct sockaddr_storage> addresses(count);
+	std::vector<std::string> received;
+	while (received.size() < count)
+	{
+		SocketDatagramVec in(count - received.size());
+		for (std::size_t i = 0; i < in.size(); i++)
+		{
+			in[i].buffer = &buffers[i][0];
+			in[i].length = static_cast<int>(buffers[i].size());
+			in[i].pAddress = reinterpret_cast<struct sockaddr*>(&addresses[i]);
+			in[i].addressLength = sizeof(struct sockaddr_storage);
+		}
+		int n = receiver.receiveBatch(in);
+		assertTrue (n > 0);
+		for (int i = 0; i < n; i++)
+		{
+			received.push_back(std::string(buffers[i].data(), in[i].length));
+			assertTrue (SocketAddress(in[i].pAddress, in[i].addressLength) == sender.address());
+			assertTrue (in[i].segmentSize == 0);
+		}
+	}
+	assertTrue (received == messages);
+
+	receiver.setBlocking(false);
+	SocketDatagramVec in(1);
+	in[0].buffer = &buffers[0][0];
+	in[0].length = static_cast<int>(buffers[0].size());
+	assertTrue (receiver.receiveBatch(in) == -1);
+}
+
+
+void DatagramSocketTest::testSendSegmented()
+{
+	DatagramSocket receiver(SocketAddress("127.0.0.1", 0), false);
+	receiver.setReceiveTimeout(Timespan(5, 0));
+	DatagramSocket sender(SocketAddress("127.0.0.1", 0), false);
+
+	const int segmentSize = 100;
+	std::string data;
+	for (int i = 0; i < 1050; i++) data += static_cast<char>('a' + i % 26);
+	assertTrue (sender.sendSegmented(data.data(), static_cast<int>(data.size()), segmentSize, receiver.address()) == data.size());
+
+	std::string received;
+	char buffer[256];
+	while (received.size() < data.size())
+	{
+		int n = receiver.receiveBytes(buffer, sizeof(buffer));
+		assertTrue (n == segmentSize || (n == 50 && received.size() == 1000));
+		received.append(buffer, n);
+	}
+	assertTrue (received == data);
+}
+
+
+void DatagramSocketTest::testUDPGRO()
+{
+	DatagramSocket receiver(SocketAddress("127.0.0.1", 0), false);
+	receiver.setReceiveTimeout(Timespan(5, 0));
+	try
+	{
+		receiver.setUDPGRO(true);
+	}
+	catch (Poco::Exception&)
+	{
+		std::cerr << "UDP GRO not supported, skipping test." << std::endl;
+		return;
+	}
+#if defined(POCO_HAVE_MMSG)
+	assertTrue (receiver.getUDPGRO());
+#endif
+
+	DatagramSocket sender(SocketAddress("127.0.0.1", 0), false);
+	const int segmentSize = 500;
+	std::string data;
+	for (int i = 0; i < 4000; i++) data += static_cast<char>('a' + i % 26);
+	assertTrue (sender.sendSegmented(data.data(), static_cast<int>(data.size()), segmentSize, receiver.address()) == data.size());
+
+	// Datagrams may or may not have been coalesced,
+	// but every segment must arrive in order.
+	std::string received;
+	std::vector<char> buffer(65536);
+	while (received.size() < data.size())
+	{
+		SocketDatagram dg;
+		dg.buffer = &buffer[0];
+		dg.length = static_cast<int>(buffer.size());
+		int n = receiver.receiveBatch(&dg, 1);
+		assertTrue (n == 1);
+		if (dg.segmentSize > 0)
+		{
+			assertTrue (dg.segmentSize == segmentSize);
+			assertTrue (dg.length % segmentSize == 0);
+		}
+		else assertTrue (dg.length == segmentSize);
+		received.append(&buffer[0], dg.length);
+	}
+	assertTrue (received == data);
+}
+
+
 void DatagramSocketTest::testClosedPortError()
 {
 	// Test for issue #4537: On Windows, sending UDP to a closed port and then
@@ -868,6 +992,9 @@ CppUnit::Test* DatagramSocketTest::suite()
 	CppUnit_addTest(pSuite, DatagramSocketTest, testGatherScatterFixed);
 	CppUnit_addTest(pSuite, DatagramSocketTest, testGatherScatterVariable);
 	CppUnit_addTest(pSuite, DatagramSocketTest, testClosedPortError);
+	CppUnit_addTest(pSuite, DatagramSocketTest, testSendReceiveBatch);
+	CppUnit_addTest(pSuite, DatagramSocketTest, testSendSegmented);
+	CppUnit_addTest(pSuite, DatagramSocketTest, testUDPGRO);
 
 	return pSuite;
 }
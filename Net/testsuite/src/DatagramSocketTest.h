@@ -37,6 +37,9 @@ public:
 	void testGatherScatterFixed();
 	void testGatherScatterVariable();
 	void testClosedPortError();
+	void testSendReceiveBatch();
+	void testSendSegmented();
+	void testUDPGRO();
 
 	void setUp();
 	void tearDown();
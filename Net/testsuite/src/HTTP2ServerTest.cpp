@@ -0,0 +1,823 @@
+//
+// HTTP2ServerTest.cpp
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HTTP2ServerTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPClientSession.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTP2ServerResponseImpl.h"
+#include "Poco/Net/HTTP2Frame.h"
+#include "Poco/Net/HPACK.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketStream.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/ThreadPool.h"
+#include "Poco/Thread.h"
+#include "Poco/Path.h"
+#include "Poco/FileStream.h"
+#include "Poco/File.h"
+#include <algorithm>
+#include <map>
+#include <sstream>
+
+
+using Poco::Net::HTTPServer;
+using Poco::Net::HTTPServerParams;
+using Poco::Net::HTTPRequestHandler;
+using Poco::Net::HTTPRequestHandlerFactory;
+using Poco::Net::HTTPClientSession;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPServerRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::HTTPServerResponse;
+using Poco::Net::HTTP2ServerResponseImpl;
+using Poco::Net::HTTPMessage;
+using Poco::Net::HTTP2Frame;
+using Poco::Net::HPACKEncoder;
+using Poco::Net::HPACKDecoder;
+using Poco::Net::HPACKHeaderList;
+using Poco::Net::StreamSocket;
+using Poco::Net::SocketStream;
+using Poco::Net::ServerSocket;
+using Poco::Net::SocketAddress;
+using Poco::StreamCopier;
+using Poco::Path;
+using Poco::File;
+using Poco::FileOutputStream;
+
+
+namespace
+{
+	static const int sendFileSize = 64000;
+
+	class EchoBodyRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			if (request.getContentLength() != HTTPMessage::UNKNOWN_CONTENT_LENGTH)
+				response.setContentLength(request.getContentLength());
+
+			response.setContentType(request.getContentType());
+
+			std::istream& istr = request.stream();
+			std::ostream& ostr = response.send();
+			StreamCopier::copyStream(istr, ostr);
+		}
+	};
+
+	class EchoHeaderRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			std::ostringstream osstr;
+			request.write(osstr);
+			int n = (int) osstr.str().length();
+			response.setContentLength(n);
+			std::ostream& ostr = response.send();
+			if (request.getMethod() != HTTPRequest::HTTP_HEAD)
+				request.write(ostr);
+		}
+	};
+
+	class BufferRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			std::string data("xxxxxxxxxx");
+			response.sendBuffer(data.data(), data.length());
+		}
+	};
+
+	class FileRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			std::string payload(sendFileSize, 'x');
+			Poco::Path testFilePath = Poco::Path::temp().append("test.http2.server.sendfile.txt");
+			const std::string fileName = testFilePath.toString();
+			{
+				FileOutputStream fout(fileName);
+				fout << payload;
+			}
+			response.sendFile(fileName, "text/plain");
+			File(fileName).remove();
+		}
+	};
+
+	class TrailerRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			std::string data("xxxxxxxxxx");
+
+			Poco::Net::MessageHeader& trailer = static_cast<HTTP2ServerResponseImpl&>(response).trailer();
+			trailer.set("Trailer-1", "Value 1");
+			trailer.set("Trailer-2", "Value 2");
+			response.send() << data;
+		}
+	};
+
+	class RequestHandlerFactory: public HTTPRequestHandlerFactory
+	{
+	public:
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			if (request.getURI() == "/echoBody")
+				return new EchoBodyRequestHandler;
+			else if (request.getURI() == "/echoHeader")
+				return new EchoHeaderRequestHandler;
+			else if (request.getURI() == "/buffer")
+				return new BufferRequestHandler;
+			else if (request.getURI() == "/trailer")
+				return new TrailerRequestHandler;
+			else if (request.getURI() == "/file")
+				return new FileRequestHandler;
+			else
+				return nullptr;
+		}
+	};
+
+	class HTTP2TestClient
+		/// A minimal HTTP/2 client for testing the server at the frame level.
+	{
+	public:
+		struct Response
+		{
+			HPACKHeaderList headers;
+			HPACKHeaderList trailer;
+			std::string body;
+			bool ended = false;
+			int resetCode = -1;
+
+			std::string get(const std::string& name) const
+			{
+				for (const auto& field: headers)
+				{
+					if (field.first == name) return field.second;
+				}
+				return std::string();
+			}
+		};
+
+		HTTP2TestClient(const SocketAddress& address, std::size_t prefaceSplit = 0):
+			_socket(address),
+			_sendWindow(HTTP2Frame::DEFAULT_WINDOW_SIZE),
+			_initialWindowSize(HTTP2Frame::DEFAULT_WINDOW_SIZE),
+			_maxConcurrentStreams(0),
+			_headerStreamId(0),
+			_goAwayCode(-1),
+			_pingAcked(false)
+		{
+			_socket.setReceiveTimeout(Poco::Timespan(10, 0));
+			std::string data(HTTP2Frame::CONNECTION_PREFACE);
+			HTTP2Frame(0, HTTP2Frame::FRAME_SETTINGS, 0, 0).append(data);
+			if (prefaceSplit > 0)
+			{
+				// send the preface in two parts
+				send(data.substr(0, prefaceSplit));
+				Poco::Thread::sleep(200);
+				data.erase(0, prefaceSplit);
+			}
+			send(data);
+		}
+
+		void sendRequest(Poco::UInt32 streamId, const std::string& method, const std::string& path, const std::string& body = std::string(), bool endStream = true)
+		{
+			HPACKHeaderList headers = {{":method", method}, {":scheme", "http"}, {":path", path}, {":authority", "localhost"}};
+			if (!body.empty()) headers.emplace_back("content-type", "text/plain");
+			sendHeaders(streamId, headers, body.empty() && endStream);
+			if (!body.empty()) sendData(streamId, body, endStream);
+		}
+
+		void sendHeaders(Poco::UInt32 streamId, const HPACKHeaderList& headers, bool endStream)
+		{
+			std::string block;
+			_encoder.encode(headers, block);
+			std::string data;
+			int flags = HTTP2Frame::FLAG_END_HEADERS | (endStream ? HTTP2Frame::FLAG_END_STREAM : 0);
+			HTTP2Frame(static_cast<Poco::UInt32>(block.size()), HTTP2Frame::FRAME_HEADERS, flags, streamId).append(data);
+			data += block;
+			send(data);
+			_streamWindows[streamId] = _initialWindowSize;
+		}
+
+		void sendData(Poco::UInt32 streamId, const std::string& body, bool endStream)
+		{
+			std::size_t offset = 0;
+			do
+			{
+				while (_sendWindow <= 0 || _streamWindows[streamId] <= 0)
+				{
+					if (!readFrame()) throw Poco::IOException("connection closed");
+				}
+				std::size_t n = std::min<std::size_t>(body.size() - offset, HTTP2Frame::DEFAULT_MAX_FRAME_SIZE);
+				n = std::min<std::size_t>(n, static_cast<std::size_t>(std::min(_sendWindow, _streamWindows[streamId])));
+				bool last = offset + n == body.size();
+				std::string data;
+				HTTP2Frame(static_cast<Poco::UInt32>(n), HTTP2Frame::FRAME_DATA, last && endStream ? HTTP2Frame::FLAG_END_STREAM : 0, streamId).append(data);
+				data.append(body, offset, n);
+				send(data);
+				_sendWindow -= n;
+				_streamWindows[streamId] -= n;
+				offset += n;
+			}
+			while (offset < body.size());
+		}
+
+		void sendPing(const std::string& payload)
+		{
+			std::string data;
+			HTTP2Frame(8, HTTP2Frame::FRAME_PING, 0, 0).append(data);
+			data += payload;
+			send(data);
+		}
+
+		const Response& receiveResponse(Poco::UInt32 streamId)
+		{
+			Response& response = _responses[streamId];
+			while (!response.ended && response.resetCode < 0)
+			{
+				if (!readFrame()) throw Poco::IOException("connection closed");
+			}
+			return response;
+		}
+
+		bool waitPingAck()
+		{
+			while (!_pingAcked)
+			{
+				if (!readFrame()) return false;
+			}
+			return true;
+		}
+
+		int waitGoAway()
+		{
+			while (_goAwayCode < 0)
+			{
+				if (!readFrame()) break;
+			}
+			return _goAwayCode;
+		}
+
+		bool waitClosed()
+		{
+			try
+			{
+				while (readFrame())
+				{
+				}
+				return true;
+			}
+			catch (Poco::Exception&)
+			{
+				return false;
+			}
+		}
+
+		Poco::UInt32 maxConcurrentStreams() const
+		{
+			return _maxConcurrentStreams;
+		}
+
+		const std::string& pingPayload() const
+		{
+			return _pingPayload;
+		}
+
+		bool readFrame()
+		{
+			char header[HTTP2Frame::HEADER_SIZE];
+			if (!receive(header, HTTP2Frame::HEADER_SIZE)) return false;
+			HTTP2Frame frame;
+			frame.read(header);
+			std::string payload(frame.length(), '\0');
+			if (frame.length() > 0 && !receive(&payload[0], frame.length())) return false;
+
+			switch (frame.type())
+			{
+			case HTTP2Frame::FRAME_DATA:
+				{
+					Response& response = _responses[frame.streamId()];
+					response.body += payload;
+					if (frame.hasFlag(HTTP2Frame::FLAG_END_STREAM)) response.ended = true;
+					if (frame.length() > 0)
+					{
+						std::string data;
+						HTTP2Frame(4, HTTP2Frame::FRAME_WINDOW_UPDATE, 0, 0).append(data);
+						HTTP2Frame::appendUInt32(data, frame.length());
+						if (!response.ended)
+						{
+							HTTP2Frame(4, HTTP2Frame::FRAME_WINDOW_UPDATE, 0, frame.streamId()).append(data);
+							HTTP2Frame::appendUInt32(data, frame.length());
+						}
+						send(data);
+					}
+				}
+				break;
+			case HTTP2Frame::FRAME_HEADERS:
+				_headerBlock = payload;
+				_headerStreamId = frame.streamId();
+				_headerEndStream = frame.hasFlag(HTTP2Frame::FLAG_END_STREAM);
+				if (frame.hasFlag(HTTP2Frame::FLAG_END_HEADERS)) handleHeaderBlock();
+				break;
+			case HTTP2Frame::FRAME_CONTINUATION:
+				_headerBlock += payload;
+				if (frame.hasFlag(HTTP2Frame::FLAG_END_HEADERS)) handleHeaderBlock();
+				break;
+			case HTTP2Frame::FRAME_RST_STREAM:
+				_responses[frame.streamId()].resetCode = static_cast<int>(HTTP2Frame::readUInt32(payload.data()));
+				break;
+			case HTTP2Frame::FRAME_SETTINGS:
+				if (!frame.hasFlag(HTTP2Frame::FLAG_ACK))
+				{
+					for (std::size_t i = 0; i + 6 <= payload.size(); i += 6)
+					{
+						int id = (static_cast<unsigned char>(payload[i]) << 8) | static_cast<unsigned char>(payload[i + 1]);
+						Poco::UInt32 value = HTTP2Frame::readUInt32(payload.data() + i + 2);
+						if (id == HTTP2Frame::SETTINGS_INITIAL_WINDOW_SIZE)
+						{
+							for (auto& p: _streamWindows) p.second += static_cast<Poco::Int64>(value) - _initialWindowSize;
+							_initialWindowSize = value;
+						}
+						else if (id == HTTP2Frame::SETTINGS_MAX_CONCURRENT_STREAMS)
+						{
+							_maxConcurrentStreams = value;
+						}
+					}
+					std::string data;
+					HTTP2Frame(0, HTTP2Frame::FRAME_SETTINGS, HTTP2Frame::FLAG_ACK, 0).append(data);
+					send(data);
+				}
+				break;
+			case HTTP2Frame::FRAME_WINDOW_UPDATE:
+				if (frame.streamId() == 0)
+					_sendWindow += HTTP2Frame::readUInt32(payload.data());
+				else
+					_streamWindows[frame.streamId()] += HTTP2Frame::readUInt32(payload.data());
+				break;
+			case HTTP2Frame::FRAME_PING:
+				if (frame.hasFlag(HTTP2Frame::FLAG_ACK))
+				{
+					_pingAcked = true;
+					_pingPayload = payload;
+				}
+				break;
+			case HTTP2Frame::FRAME_GOAWAY:
+				_goAwayCode = static_cast<int>(HTTP2Frame::readUInt32(payload.data() + 4));
+				break;
+			default:
+				break;
+			}
+			return true;
+		}
+
+	private:
+		void handleHeaderBlock()
+		{
+			HPACKHeaderList headers;
+			_decoder.decode(_headerBlock.data(), _headerBlock.size(), headers);
+			Response& response = _responses[_headerStreamId];
+			bool informational = !headers.empty() && headers[0].first == ":status" && headers[0].second[0] == '1';
+			if (!informational)
+			{
+				if (response.headers.empty())
+					response.headers = headers;
+				else
+					response.trailer = headers;
+			}
+			if (_headerEndStream) response.ended = true;
+			_headerStreamId = 0;
+		}
+
+		void send(const std::string& data)
+		{
+			_socket.sendBytes(data.data(), static_cast<int>(data.size()));
+		}
+
+		bool receive(char* buffer, std::size_t length)
+		{
+			std::size_t received = 0;
+			while (received < length)
+			{
+				int n = _socket.receiveBytes(buffer + received, static_cast<int>(length - received));
+				if (n <= 0) return false;
+				received += n;
+			}
+			return true;
+		}
+
+		StreamSocket _socket;
+		HPACKEncoder _encoder;
+		HPACKDecoder _decoder;
+		Poco::Int64 _sendWindow;
+		Poco::Int64 _initialWindowSize;
+		std::map<Poco::UInt32, Poco::Int64> _streamWindows;
+		std::map<Poco::UInt32, Response> _responses;
+		Poco::UInt32 _maxConcurrentStreams;
+		std::string _headerBlock;
+		Poco::UInt32 _headerStreamId;
+		bool _headerEndStream = false;
+		int _goAwayCode;
+		bool _pingAcked;
+		std::string _pingPayload;
+	};
+
+	HTTPServerParams::Ptr http2Params()
+	{
+		HTTPServerParams::Ptr pParams = new HTTPServerParams;
+		pParams->setHTTP2Enabled(true);
+		return pParams;
+	}
+}
+
+
+HTTP2ServerTest::HTTP2ServerTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HTTP2ServerTest::~HTTP2ServerTest()
+{
+}
+
+
+void HTTP2ServerTest::testGet()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendRequest(1, "GET", "/echoHeader");
+	const HTTP2TestClient::Response& response = client.receiveResponse(1);
+	assertTrue (response.resetCode == -1);
+	assertTrue (response.get(":status") == "200");
+	assertTrue (response.body.find("GET /echoHeader HTTP/2.0\r\n") == 0);
+	assertTrue (response.body.find("Host: localhost\r\n") != std::string::npos);
+	assertTrue (response.get("content-length") == std::to_string(response.body.size()));
+	assertTrue (!response.get("date").empty());
+	assertTrue (client.maxConcurrentStreams() == 100);
+
+	// a second request on the same connection
+	client.sendRequest(3, "GET", "/echoHeader");
+	const HTTP2TestClient::Response& response2 = client.receiveResponse(3);
+	assertTrue (response2.get(":status") == "200");
+	assertTrue (response2.body.find("GET /echoHeader HTTP/2.0\r\n") == 0);
+}
+
+
+void HTTP2ServerTest::testHead()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendRequest(1, "HEAD", "/echoHeader");
+	const HTTP2TestClient::Response& response = client.receiveResponse(1);
+	assertTrue (response.ended);
+	assertTrue (response.get(":status") == "200");
+	assertTrue (response.body.empty());
+	assertTrue (std::stoi(response.get("content-length")) > 0);
+}
+
+
+void HTTP2ServerTest::testPost()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	std::string body(5000, 'x');
+	client.sendRequest(1, "POST", "/echoBody", body);
+	const HTTP2TestClient::Response& response = client.receiveResponse(1);
+	assertTrue (response.get(":status") == "200");
+	assertTrue (response.get("content-type") == "text/plain");
+	assertTrue (response.body == body);
+}
+
+
+void HTTP2ServerTest::testLargeBodies()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	// The request body exceeds the server's stream flow control window,
+	// the response body exceeds the client's default window.
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	std::string body;
+	for (int i = 0; i < 100000; i++) body += Poco::NumberFormatter::format0(i, 10);
+	client.sendRequest(1, "POST", "/echoBody", body);
+	const HTTP2TestClient::Response& response = client.receiveResponse(1);
+	assertTrue (response.get(":status") == "200");
+	assertTrue (response.body.size() == body.size());
+	assertTrue (response.body == body);
+}
+
+
+void HTTP2ServerTest::testConcurrentStreams()
+{
+	const int streams = 50;
+	ServerSocket svs(0);
+	HTTPServerParams::Ptr pParams = http2Params();
+	pParams->setMaxThreads(streams);
+	Poco::ThreadPool threadPool(2, streams);
+	HTTPServer srv(new RequestHandlerFactory, threadPool, svs, pParams);
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	for (int i = 0; i < streams; i++)
+	{
+		client.sendRequest(2*i + 1, "POST", "/echoBody", std::string(1000 + 100*i, static_cast<char>('a' + i % 26)));
+	}
+	for (int i = streams - 1; i >= 0; i--)
+	{
+		const HTTP2TestClient::Response& response = client.receiveResponse(2*i + 1);
+		assertTrue (response.get(":status") == "200");
+		assertTrue (response.body == std::string(1000 + 100*i, static_cast<char>('a' + i % 26)));
+	}
+}
+
+
+void HTTP2ServerTest::testRefusedStream()
+{
+	ServerSocket svs(0);
+	HTTPServerParams::Ptr pParams = http2Params();
+	pParams->setHTTP2MaxConcurrentStreams(2);
+	HTTPServer srv(new RequestHandlerFactory, svs, pParams);
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendRequest(1, "POST", "/echoBody", "abc", false);
+	client.sendRequest(3, "POST", "/echoBody", "def", false);
+	client.sendRequest(5, "GET", "/echoHeader");
+	const HTTP2TestClient::Response& refused = client.receiveResponse(5);
+	assertTrue (refused.resetCode == HTTP2Frame::ERROR_REFUSED_STREAM);
+	assertTrue (client.maxConcurrentStreams() == 2);
+
+	client.sendData(1, "123", true);
+	client.sendData(3, "456", true);
+	assertTrue (client.receiveResponse(1).body == "abc123");
+	assertTrue (client.receiveResponse(3).body == "def456");
+
+	client.sendRequest(7, "GET", "/echoHeader");
+	assertTrue (client.receiveResponse(7).get(":status") == "200");
+}
+
+
+void HTTP2ServerTest::testRefusedStreamNoThread()
+{
+	ServerSocket svs(0);
+	HTTPServerParams::Ptr pParams = http2Params();
+	pParams->setMaxThreads(2);
+	HTTPServer srv(new RequestHandlerFactory, svs, pParams);
+	srv.start();
+
+	// The thread pool for streams is shared by all connections.
+	HTTP2TestClient client1(SocketAddress("127.0.0.1", svs.address().port()));
+	client1.sendRequest(1, "POST", "/echoBody", "abc", false);
+	client1.sendPing("01234567");
+	assertTrue (client1.waitPingAck());
+
+	HTTP2TestClient client2(SocketAddress("127.0.0.1", svs.address().port()));
+	client2.sendRequest(1, "POST", "/echoBody", "def", false);
+	client2.sendRequest(3, "GET", "/echoHeader");
+	assertTrue (client2.receiveResponse(3).resetCode == HTTP2Frame::ERROR_REFUSED_STREAM);
+
+	client1.sendData(1, "123", true);
+	client2.sendData(1, "456", true);
+	assertTrue (client1.receiveResponse(1).body == "abc123");
+	assertTrue (client2.receiveResponse(1).body == "def456");
+}
+
+
+void HTTP2ServerTest::testNotImpl()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendRequest(1, "GET", "/notImpl");
+	const HTTP2TestClient::Response& response = client.receiveResponse(1);
+	assertTrue (response.get(":status") == "501");
+	assertTrue (response.body.empty());
+}
+
+
+void HTTP2ServerTest::testBuffer()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendRequest(1, "GET", "/buffer");
+	const HTTP2TestClient::Response& response = client.receiveResponse(1);
+	assertTrue (response.get(":status") == "200");
+	assertTrue (response.get("content-length") == "10");
+	assertTrue (response.body == "xxxxxxxxxx");
+}
+
+
+void HTTP2ServerTest::testFile()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendRequest(1, "GET", "/file");
+	const HTTP2TestClient::Response& response = client.receiveResponse(1);
+	assertTrue (response.get(":status") == "200");
+	assertTrue (response.get("content-type") == "text/plain");
+	assertTrue (response.body == std::string(sendFileSize, 'x'));
+}
+
+
+void HTTP2ServerTest::testTrailer()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendRequest(1, "GET", "/trailer");
+	const HTTP2TestClient::Response& response = client.receiveResponse(1);
+	assertTrue (response.get(":status") == "200");
+	assertTrue (response.body == "xxxxxxxxxx");
+	assertTrue (response.trailer.size() == 2);
+	assertTrue (response.trailer[0].first == "trailer-1" && response.trailer[0].second == "Value 1");
+	assertTrue (response.trailer[1].first == "trailer-2" && response.trailer[1].second == "Value 2");
+}
+
+
+void HTTP2ServerTest::testInvalidRequest()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	// missing :path
+	client.sendHeaders(1, {{":method", "GET"}, {":scheme", "http"}}, true);
+	assertTrue (client.receiveResponse(1).resetCode == HTTP2Frame::ERROR_PROTOCOL);
+	// upper case header name
+	client.sendHeaders(3, {{":method", "GET"}, {":scheme", "http"}, {":path", "/echoHeader"}, {"X-Custom", "x"}}, true);
+	assertTrue (client.receiveResponse(3).resetCode == HTTP2Frame::ERROR_PROTOCOL);
+	// connection-specific header field
+	client.sendHeaders(5, {{":method", "GET"}, {":scheme", "http"}, {":path", "/echoHeader"}, {"connection", "close"}}, true);
+	assertTrue (client.receiveResponse(5).resetCode == HTTP2Frame::ERROR_PROTOCOL);
+
+	// the connection is still usable
+	client.sendRequest(7, "GET", "/echoHeader");
+	assertTrue (client.receiveResponse(7).get(":status") == "200");
+}
+
+
+void HTTP2ServerTest::testPing()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendPing("01234567");
+	assertTrue (client.waitPingAck());
+	assertTrue (client.pingPayload() == "01234567");
+}
+
+
+void HTTP2ServerTest::testHTTP1()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTPClientSession cs("127.0.0.1", svs.address().port());
+	std::string body(5000, 'x');
+	HTTPRequest request("POST", "/echoBody", HTTPMessage::HTTP_1_1);
+	request.setContentLength((int) body.length());
+	request.setContentType("text/plain");
+	cs.sendRequest(request) << body;
+	HTTPResponse response;
+	std::string rbody;
+	cs.receiveResponse(response) >> rbody;
+	assertTrue (response.getVersion() == HTTPMessage::HTTP_1_1);
+	assertTrue (response.getContentLength() == body.size());
+	assertTrue (rbody == body);
+}
+
+
+void HTTP2ServerTest::testSplitPreface()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()), 10);
+	client.sendRequest(1, "GET", "/echoHeader");
+	assertTrue (client.receiveResponse(1).get(":status") == "200");
+}
+
+
+void HTTP2ServerTest::testSplitHTTP1()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	// The start of the request matches the start of the HTTP/2 connection preface.
+	StreamSocket ss(SocketAddress("127.0.0.1", svs.address().port()));
+	ss.setReceiveTimeout(Poco::Timespan(10, 0));
+	std::string request("PUT /echoBody HTTP/1.1\r\nHost: localhost\r\nContent-Type: text/plain\r\nContent-Length: 3\r\n\r\nabc");
+	ss.sendBytes(request.data(), 1);
+	Poco::Thread::sleep(200);
+	ss.sendBytes(request.data() + 1, static_cast<int>(request.size() - 1));
+
+	SocketStream str(ss);
+	HTTPResponse response;
+	response.read(str);
+	assertTrue (response.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue (response.getVersion() == HTTPMessage::HTTP_1_1);
+	std::string body(static_cast<std::size_t>(response.getContentLength()), '\0');
+	str.read(&body[0], static_cast<std::streamsize>(body.size()));
+	assertTrue (body == "abc");
+}
+
+
+void HTTP2ServerTest::testStop()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new RequestHandlerFactory, svs, http2Params());
+	srv.start();
+
+	HTTP2TestClient client(SocketAddress("127.0.0.1", svs.address().port()));
+	client.sendRequest(1, "GET", "/echoHeader");
+	assertTrue (client.receiveResponse(1).get(":status") == "200");
+
+	srv.stopAll(false);
+	assertTrue (client.waitGoAway() == HTTP2Frame::ERROR_NONE);
+	assertTrue (client.waitClosed());
+}
+
+
+void HTTP2ServerTest::setUp()
+{
+}
+
+
+void HTTP2ServerTest::tearDown()
+{
+}
+
+
+CppUnit::Test* HTTP2ServerTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTP2ServerTest");
+
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testGet);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testHead);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testPost);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testLargeBodies);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testConcurrentStreams);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testRefusedStream);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testRefusedStreamNoThread);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testNotImpl);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testBuffer);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testFile);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testTrailer);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testInvalidRequest);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testPing);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testHTTP1);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testSplitPreface);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testSplitHTTP1);
+	CppUnit_addTest(pSuite, HTTP2ServerTest, testStop);
+
+	return pSuite;
+}
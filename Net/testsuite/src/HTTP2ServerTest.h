@@ -0,0 +1,54 @@
+//
+// HTTP2ServerTest.h
+//
+// Definition of the HTTP2ServerTest class.
+//
+// Copyright (c) 2025, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef HTTP2ServerTest_INCLUDED
+#define HTTP2ServerTest_INCLUDED
+
+
+#include "Poco/Net/Net.h"
+#include "CppUnit/TestCase.h"
+
+
+class HTTP2ServerTest: public CppUnit::TestCase
+{
+public:
+	HTTP2ServerTest(const std::string& name);
+	~HTTP2ServerTest();
+
+	void testGet();
+	void testHead();
+	void testPost();
+	void testLargeBodies();
+	void testConcurrentStreams();
+	void testRefusedStream();
+	void testRefusedStreamNoThread();
+	void testNotImpl();
+	void testBuffer();
+	void testFile();
+	void testTrailer();
+	void testInvalidRequest();
+	void testPing();
+	void testHTTP1();
+	void testSplitPreface();
+	void testSplitHTTP1();
+	void testStop();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+
+private:
+};
+
+
+#endif // HTTP2ServerTest_INCLUDED
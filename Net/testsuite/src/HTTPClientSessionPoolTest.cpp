@@ -0,0 +1,272 @@
+//
+// HTTPClientSessionPoolTest.cpp
+//
+// Copyright (c) 2005-2006, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "HTTPClientSessionPoolTest.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include "Poco/Net/HTTPClientSessionPool.h"
+#include "Poco/Net/HTTPServer.h"
+#include "Poco/Net/HTTPServerParams.h"
+#include "Poco/Net/HTTPRequestHandler.h"
+#include "Poco/Net/HTTPRequestHandlerFactory.h"
+#include "Poco/Net/HTTPServerRequest.h"
+#include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/HTTPRequest.h"
+#include "Poco/Net/HTTPResponse.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/StreamCopier.h"
+#include "Poco/Exception.h"
+#include "Poco/Thread.h"
+#include <sstream>
+
+
+using Poco::Net::HTTPClientSessionPool;
+using Poco::Net::HTTPClientSession;
+using Poco::Net::HTTPServer;
+using Poco::Net::HTTPServerParams;
+using Poco::Net::HTTPRequestHandler;
+using Poco::Net::HTTPRequestHandlerFactory;
+using Poco::Net::HTTPServerRequest;
+using Poco::Net::HTTPServerResponse;
+using Poco::Net::HTTPRequest;
+using Poco::Net::HTTPResponse;
+using Poco::Net::HTTPMessage;
+using Poco::Net::ServerSocket;
+using Poco::StreamCopier;
+
+
+namespace
+{
+	class HelloRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			response.setContentType("text/plain");
+			response.sendBuffer("Hello", 5);
+		}
+	};
+
+	class HelloRequestHandlerFactory: public HTTPRequestHandlerFactory
+	{
+	public:
+		HTTPRequestHandler* createRequestHandler(const HTTPServerRequest& request)
+		{
+			return new HelloRequestHandler;
+		}
+	};
+
+	std::string sendHello(HTTPClientSession& session)
+	{
+		HTTPRequest request(HTTPRequest::HTTP_GET, "/", HTTPMessage::HTTP_1_1);
+		session.sendRequest(request);
+		HTTPResponse response;
+		std::istream& rs = session.receiveResponse(response);
+		std::ostringstream ostr;
+		StreamCopier::copyStream(rs, ostr);
+		return ostr.str();
+	}
+
+	HTTPServerParams::Ptr serverParams(bool keepAlive)
+	{
+		HTTPServerParams::Ptr pParams = new HTTPServerParams;
+		pParams->setKeepAlive(keepAlive);
+		return pParams;
+	}
+}
+
+
+HTTPClientSessionPoolTest::HTTPClientSessionPoolTest(const std::string& name): CppUnit::TestCase(name)
+{
+}
+
+
+HTTPClientSessionPoolTest::~HTTPClientSessionPoolTest()
+{
+}
+
+
+void HTTPClientSessionPoolTest::testReuse()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new HelloRequestHandlerFactory, svs, serverParams(true));
+	srv.start();
+
+	HTTPClientSessionPool pool;
+	poco_socket_t sockfd;
+	{
+		HTTPClientSessionPool::Session session = pool.get("http", "127.0.0.1", svs.address().port());
+		assertTrue (session->getKeepAlive());
+		assertTrue (sendHello(*session) == "Hello");
+		sockfd = session->socket().impl()->sockfd();
+	}
+	HTTPClientSessionPool::Statistics stats = pool.statistics();
+	assertTrue (stats.created == 1);
+	assertTrue (stats.returned == 1);
+	assertTrue (stats.idle == 1);
+	assertTrue (stats.active == 0);
+
+	{
+		HTTPClientSessionPool::Session session = pool.get(Poco::URI("http://127.0.0.1:" + std::to_string(svs.address().port()) + "/"));
+		assertTrue (session->socket().impl()->sockfd() == sockfd);
+		assertTrue (sendHello(*session) == "Hello");
+		stats = pool.statistics();
+		assertTrue (stats.reused == 1);
+		assertTrue (stats.idle == 0);
+		assertTrue (stats.active == 1);
+	}
+	stats = pool.statistics();
+	assertTrue (stats.created == 1);
+	assertTrue (stats.idle == 1);
+
+	srv.stop();
+}
+
+
+void HTTPClientSessionPoolTest::testMaxSessionsPerHost()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new HelloRequestHandlerFactory, svs, serverParams(true));
+	srv.start();
+
+	HTTPClientSessionPool pool(2);
+	HTTPClientSessionPool::Session s1 = pool.get("http", "127.0.0.1", svs.address().port());
+	HTTPClientSessionPool::Session s2 = pool.get("http", "127.0.0.1", svs.address().port());
+	assertTrue (s1.get() != s2.get());
+	try
+	{
+		HTTPClientSessionPool::Session s3 = pool.get("http", "127.0.0.1", svs.address().port(), Poco::Timespan(0, 100000));
+		fail("per-host limit reached - must throw");
+	}
+	catch (Poco::TimeoutException&)
+	{
+	}
+
+	// a different host key is not affected by the limit
+	HTTPClientSessionPool::Session s4 = pool.get("http", "localhost", svs.address().port());
+	assertTrue (!s4.isNull());
+
+	assertTrue (sendHello(*s1) == "Hello");
+	HTTPClientSession* p1 = s1.get();
+	s1.release();
+	assertTrue (s1.isNull());
+	HTTPClientSessionPool::Session s3 = pool.get("http", "127.0.0.1", svs.address().port());
+	assertTrue (s3.get() == p1);
+
+	HTTPClientSessionPool::Statistics stats = pool.statistics();
+	assertTrue (stats.created == 3);
+	assertTrue (stats.reused == 1);
+	assertTrue (stats.waits == 1);
+	assertTrue (stats.timeouts == 1);
+	assertTrue (stats.active == 3);
+
+	srv.stop();
+}
+
+
+void HTTPClientSessionPoolTest::testIdleEviction()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new HelloRequestHandlerFactory, svs, serverParams(true));
+	srv.start();
+
+	HTTPClientSessionPool pool(4, Poco::Timespan(0, 200000));
+	{
+		HTTPClientSessionPool::Session session = pool.get("http", "127.0.0.1", svs.address().port());
+		assertTrue (session->getKeepAliveTimeout() == Poco::Timespan(0, 200000));
+		assertTrue (sendHello(*session) == "Hello");
+	}
+	assertTrue (pool.statistics().idle == 1);
+	assertTrue (pool.purge() == 0);
+
+	Poco::Thread::sleep(300);
+	assertTrue (pool.purge() == 1);
+	HTTPClientSessionPool::Statistics stats = pool.statistics();
+	assertTrue (stats.idle == 0);
+	assertTrue (stats.evicted == 1);
+
+	srv.stop();
+}
+
+
+void HTTPClientSessionPoolTest::testDiscard()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new HelloRequestHandlerFactory, svs, serverParams(false));
+	srv.start();
+
+	HTTPClientSessionPool pool;
+	{
+		HTTPClientSessionPool::Session session = pool.get("http", "127.0.0.1", svs.address().port());
+		assertTrue (sendHello(*session) == "Hello");
+		session.discard();
+		assertTrue (session.isNull());
+	}
+	{
+		// server does not support persistent connections
+		HTTPClientSessionPool::Session session = pool.get("http", "127.0.0.1", svs.address().port());
+		assertTrue (sendHello(*session) == "Hello");
+	}
+	HTTPClientSessionPool::Statistics stats = pool.statistics();
+	assertTrue (stats.created == 2);
+	assertTrue (stats.discarded == 2);
+	assertTrue (stats.idle == 0);
+	assertTrue (stats.active == 0);
+
+	srv.stop();
+}
+
+
+void HTTPClientSessionPoolTest::testServerClose()
+{
+	ServerSocket svs(0);
+	HTTPServer srv(new HelloRequestHandlerFactory, svs, serverParams(true));
+	srv.start();
+
+	HTTPClientSessionPool pool;
+	{
+		HTTPClientSessionPool::Session session = pool.get("http", "127.0.0.1", svs.address().port());
+		assertTrue (sendHello(*session) == "Hello");
+	}
+	assertTrue (pool.statistics().idle == 1);
+
+	srv.stopAll(true);
+	Poco::Thread::sleep(200);
+
+	HTTPClientSessionPool::Session session = pool.get("http", "127.0.0.1", svs.address().port());
+	HTTPClientSessionPool::Statistics stats = pool.statistics();
+	assertTrue (stats.reused == 0);
+	assertTrue (stats.discarded == 1);
+	assertTrue (stats.created == 2);
+}
+
+
+void HTTPClientSessionPoolTest::setUp()
+{
+}
+
+
+void HTTPClientSessionPoolTest::tearDown()
+{
+}
+
+
+CppUnit::Test* HTTPClientSessionPoolTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("HTTPClientSessionPoolTest");
+
+	CppUnit_addTest(pSuite, HTTPClientSessionPoolTest, testReuse);
+	CppUnit_addTest(pSuite, HTTPClientSessionPoolTest, testMaxSessionsPerHost);
+	CppUnit_addTest(pSuite, HTTPClientSessionPoolTest, testIdleEviction);
+	CppUnit_addTest(pSuite, HTTPClientSessionPoolTest, testDiscard);
+	CppUnit_addTest(pSuite, HTTPClientSessionPoolTest, testServerClose);
+
+	return pSuite;
+}
@@ -10,6 +10,7 @@
 
 #include "HTTPClientTestSuite.h"
 #include "HTTPClientSessionTest.h"
+#include "HTTPClientSessionPoolTest.h"
 #include "HTTPStreamFactoryTest.h"
 
 
@@ -19,6 +20,7 @@ CppUnit::Test* HTTPClientTestSuite::suite()
 
 	pSuite->addTest(HTTPClientSessionTest::suite());
 	pSuite->addTest(HTTPStreamFactoryTest::suite());
+	pSuite->addTest(HTTPClientSessionPoolTest::suite());
 
 	return pSuite;
 }
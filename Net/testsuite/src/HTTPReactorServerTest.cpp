@@ -8,7 +8,10 @@
 #include "Poco/Net/HTTPResponse.h"
 #include "Poco/Net/HTTPServerRequest.h"
 #include "Poco/Net/HTTPServerResponse.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketStream.h"
 #include "Poco/StreamCopier.h"
+#include "Poco/Exception.h"
 #include "CppUnit/TestSuite.h"
 #include "CppUnit/TestCaller.h"
 
@@ -22,6 +25,9 @@ using Poco::Net::HTTPResponse;
 using Poco::Net::HTTPMessage;
 using Poco::Net::HTTPServerRequest;
 using Poco::Net::HTTPServerResponse;
+using Poco::Net::StreamSocket;
+using Poco::Net::SocketStream;
+using Poco::Net::SocketAddress;
 using Poco::StreamCopier;
 
 namespace
@@ -53,6 +59,15 @@ namespace
 		}
 	};
 
+	class FailingRequestHandler: public HTTPRequestHandler
+	{
+	public:
+		void handleRequest(HTTPServerRequest& request, HTTPServerResponse& response)
+		{
+			throw Poco::IllegalStateException("request failed");
+		}
+	};
+
 	class RequestHandlerFactory: public HTTPRequestHandlerFactory
 	{
 	public:
@@ -62,9 +77,62 @@ namespace
 			{
 				return nullptr;
 			}
+			if (request.getURI() == "/fail")
+			{
+				return new FailingRequestHandler;
+			}
 			return new EchoBodyRequestHandler;
 		}
 	};
+
+	void sendPipelinedRequests(int port, int count, std::vector<std::string>& bodies, std::vector<HTTPResponse>& responses)
+	{
+		StreamSocket ss;
+		ss.connect(SocketAddress("127.0.0.1", port));
+		std::string requests;
+		for (int i = 0; i < count; ++i)
+		{
+			std::string body("Pipelined " + std::to_string(i));
+			requests += "POST / HTTP/1.1\r\nHost: localhost\r\nContent-Length: ";
+			requests += std::to_string(body.size());
+			requests += "\r\n\r\n";
+			requests += body;
+		}
+		ss.sendBytes(requests.data(), static_cast<int>(requests.size()));
+
+		SocketStream str(ss);
+		for (int i = 0; i < count; ++i)
+		{
+			HTTPResponse response;
+			response.read(str);
+			std::string body(static_cast<std::size_t>(response.getContentLength()), '\0');
+			str.read(&body[0], static_cast<std::streamsize>(body.size()));
+			responses.push_back(response);
+			bodies.push_back(body);
+		}
+	}
+
+	bool sendFailingRequest(int port)
+		// Sends a failing request, followed by a pipelined one.
+		// Returns true if the server responds with an error
+		// and closes the connection.
+	{
+		StreamSocket ss;
+		ss.connect(SocketAddress("127.0.0.1", port));
+		ss.setReceiveTimeout(Poco::Timespan(5, 0));
+		std::string requests("GET /fail HTTP/1.1\r\nHost: localhost\r\n\r\n");
+		requests += "POST / HTTP/1.1\r\nHost: localhost\r\nContent-Length: 5\r\n\r\nHello";
+		ss.sendBytes(requests.data(), static_cast<int>(requests.size()));
+
+		SocketStream str(ss);
+		HTTPResponse response;
+		response.read(str);
+		if (response.getStatus() != HTTPResponse::HTTP_INTERNAL_SERVER_ERROR || response.getKeepAlive())
+			return false;
+		std::string rest;
+		StreamCopier::copyToString(str, rest);
+		return str.eof() && rest.empty();
+	}
 }
 
 HTTPReactorServerTest::HTTPReactorServerTest(const std::string& name): CppUnit::TestCase(name)
@@ -512,6 +580,104 @@ void HTTPReactorServerTest::testNotImplementedResponseWithKeepAlive()
 }
 
 
+void HTTPReactorServerTest::testPipelinedRequests()
+{
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	pParams->setMaxThreads(1);
+	pParams->setReactorMode(true);
+	pParams->setSoftwareVersion("ReactorTest/1.0");
+
+	Poco::Net::HTTPReactorServer srv(0, pParams, new RequestHandlerFactory);
+	srv.start();
+
+	std::vector<std::string> bodies;
+	std::vector<HTTPResponse> responses;
+	sendPipelinedRequests(srv.port(), 5, bodies, responses);
+
+	assertEqual (5, responses.size());
+	for (int i = 0; i < 5; ++i)
+	{
+		assertTrue (responses[i].getStatus() == HTTPResponse::HTTP_OK);
+		assertEqual ("ReactorTest/1.0", responses[i].get("Server"));
+		assertEqual ("Pipelined " + std::to_string(i), bodies[i]);
+	}
+	srv.stop();
+}
+
+void HTTPReactorServerTest::testFailedRequest()
+{
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	pParams->setMaxThreads(1);
+	pParams->setReactorMode(true);
+
+	Poco::Net::HTTPReactorServer srv(0, pParams, new RequestHandlerFactory);
+	srv.start();
+
+	assertTrue (sendFailingRequest(srv.port()));
+	assertTrue (sendFailingRequest(srv.port()));
+
+	srv.stop();
+}
+
+void HTTPReactorServerTest::testFailedRequestWorkerDispatch()
+{
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	pParams->setMaxThreads(2);
+	pParams->setReactorMode(true);
+	pParams->setReactorWorkerDispatch(true);
+
+	Poco::Net::HTTPReactorServer srv(0, pParams, new RequestHandlerFactory);
+	srv.start();
+
+	assertTrue (sendFailingRequest(srv.port()));
+	assertTrue (sendFailingRequest(srv.port()));
+
+	srv.stop();
+}
+
+void HTTPReactorServerTest::testWorkerDispatch()
+{
+	HTTPServerParams* pParams = new HTTPServerParams;
+	pParams->setKeepAlive(true);
+	pParams->setMaxThreads(4);
+	pParams->setReactorMode(true);
+	pParams->setReactorWorkerDispatch(true);
+
+	Poco::Net::HTTPReactorServer srv(0, pParams, new RequestHandlerFactory);
+	srv.start();
+
+	int port = srv.port();
+
+	HTTPClientSession cs("127.0.0.1", port);
+	cs.setKeepAlive(true);
+	for (int i = 0; i < 3; ++i)
+	{
+		std::string body("Worker " + std::to_string(i));
+		HTTPRequest request("POST", "/", HTTPMessage::HTTP_1_1);
+		request.setContentLength((int) body.length());
+		cs.sendRequest(request) << body;
+		HTTPResponse response;
+		std::string rbody;
+		std::istream& rs = cs.receiveResponse(response);
+		rbody.assign((std::istreambuf_iterator<char>(rs)), std::istreambuf_iterator<char>());
+		assertTrue (rbody == body);
+	}
+
+	std::vector<std::string> bodies;
+	std::vector<HTTPResponse> responses;
+	sendPipelinedRequests(port, 10, bodies, responses);
+	assertEqual (10, responses.size());
+	for (int i = 0; i < 10; ++i)
+	{
+		assertEqual ("Pipelined " + std::to_string(i), bodies[i]);
+	}
+	srv.stop();
+}
+
+
 void HTTPReactorServerTest::setUp()
 {
 }
@@ -539,6 +705,10 @@ CppUnit::Test* HTTPReactorServerTest::suite()
 	CppUnit_addTest(pSuite, HTTPReactorServerTest, testConcurrentRequests);
 	CppUnit_addTest(pSuite, HTTPReactorServerTest, testUseSelfReactor);
 	CppUnit_addTest(pSuite, HTTPReactorServerTest, testNotImplementedResponseWithKeepAlive);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testPipelinedRequests);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testFailedRequest);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testFailedRequestWorkerDispatch);
+	CppUnit_addTest(pSuite, HTTPReactorServerTest, testWorkerDispatch);
 
 	return pSuite;
 }
@@ -24,6 +24,10 @@ public:
 	void testConcurrentRequests();
 	void testUseSelfReactor();
 	void testNotImplementedResponseWithKeepAlive();
+	void testPipelinedRequests();
+	void testFailedRequest();
+	void testFailedRequestWorkerDispatch();
+	void testWorkerDispatch();
 
 	void setUp();
 	void tearDown();
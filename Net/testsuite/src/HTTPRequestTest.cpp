@@ -202,6 +202,56 @@ void HTTPRequestTest::testInvalid3()
 }
 
 
+void HTTPRequestTest::testParse()
+{
+	std::string s("POST /test.cgi HTTP/1.1\r\nConnection: Close\r\nContent-Length:   100  \r\nContent-Type: text/plain\r\nHost: localhost:8000\r\nUser-Agent: Poco\r\n\r\nbody");
+	HTTPRequest request;
+	const char* p = request.parse(s.data(), s.data() + s.size());
+	assertTrue (request.getMethod() == HTTPRequest::HTTP_POST);
+	assertTrue (request.getURI() == "/test.cgi");
+	assertTrue (request.getVersion() == HTTPMessage::HTTP_1_1);
+	assertTrue (request.size() == 5);
+	assertTrue (request["Connection"] == "Close");
+	assertTrue (request["Host"] == "localhost:8000");
+	assertTrue (request["User-Agent"] == "Poco");
+	assertTrue (request.getContentType() == "text/plain");
+	assertTrue (request.getContentLength() == 100);
+	assertTrue (std::string(p) == "body");
+
+	s = "GET / HTTP/1.0\n\n";
+	HTTPRequest request2;
+	p = request2.parse(s.data(), s.data() + s.size());
+	assertTrue (request2.getMethod() == HTTPRequest::HTTP_GET);
+	assertTrue (request2.getURI() == "/");
+	assertTrue (request2.getVersion() == HTTPMessage::HTTP_1_0);
+	assertTrue (request2.empty());
+	assertTrue (p == s.data() + s.size());
+}
+
+
+void HTTPRequestTest::testParseInvalid()
+{
+	std::string s1(256, 'x');
+	std::string s2("GET ");
+	s2.append(8000, 'x');
+	s2.append("HTTP/1.0");
+	std::string s3("GET / HTTP/1.10");
+	const std::string* requests[] = {&s1, &s2, &s3};
+	for (const std::string* s: requests)
+	{
+		HTTPRequest request;
+		try
+		{
+			request.parse(s->data(), s->data() + s->size());
+			fail("inavalid request - must throw");
+		}
+		catch (MessageException&)
+		{
+		}
+	}
+}
+
+
 void HTTPRequestTest::testCookies()
 {
 	HTTPRequest request1;
@@ -262,6 +312,8 @@ CppUnit::Test* HTTPRequestTest::suite()
 	CppUnit_addTest(pSuite, HTTPRequestTest, testInvalid2);
 	CppUnit_addTest(pSuite, HTTPRequestTest, testInvalid3);
 	CppUnit_addTest(pSuite, HTTPRequestTest, testCookies);
+	CppUnit_addTest(pSuite, HTTPRequestTest, testParse);
+	CppUnit_addTest(pSuite, HTTPRequestTest, testParseInvalid);
 
 	return pSuite;
 }
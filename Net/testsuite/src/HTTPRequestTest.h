@@ -36,6 +36,8 @@ public:
 	void testInvalid2();
 	void testInvalid3();
 	void testCookies();
+	void testParse();
+	void testParseInvalid();
 
 	void setUp();
 	void tearDown();
@@ -152,6 +152,56 @@ void HTTPResponseTest::testInvalid3()
 }
 
 
+void HTTPResponseTest::testParse()
+{
+	std::string s("HTTP/1.0 301 Moved Permanently\r\nLocation: http://www.appinf.com/index.html\r\nServer: Poco/1.0\r\n\r\nbody");
+	HTTPResponse response;
+	const char* p = response.parse(s.data(), s.data() + s.size());
+	assertTrue (response.getStatus() == HTTPResponse::HTTP_MOVED_PERMANENTLY);
+	assertTrue (response.getReason() == "Moved Permanently");
+	assertTrue (response.getVersion() == HTTPMessage::HTTP_1_0);
+	assertTrue (response.size() == 2);
+	assertTrue (response["Location"] == "http://www.appinf.com/index.html");
+	assertTrue (response["Server"] == "Poco/1.0");
+	assertTrue (std::string(p) == "body");
+
+	s = "HTTP/1.1 200 \r\nContent-Length: 0\r\n\r\n";
+	HTTPResponse response2;
+	p = response2.parse(s.data(), s.data() + s.size());
+	assertTrue (response2.getVersion() == HTTPMessage::HTTP_1_1);
+	assertTrue (response2.getStatus() == HTTPResponse::HTTP_OK);
+	assertTrue (response2.getReason() == "");
+	assertTrue (response2.size() == 1);
+	assertTrue (response2.getContentLength() == 0);
+	assertTrue (p == s.data() + s.size());
+}
+
+
+void HTTPResponseTest::testParseInvalid()
+{
+	std::string s1(256, 'x');
+	std::string s2("HTTP/1.1 200 ");
+	s2.append(1000, 'x');
+	s2.append("\r\n\r\n");
+	std::string s3("HTTP/1.0 ");
+	s3.append(8000, 'x');
+	s3.append("\r\n\r\n");
+	const std::string* responses[] = {&s1, &s2, &s3};
+	for (const std::string* s: responses)
+	{
+		HTTPResponse response;
+		try
+		{
+			response.parse(s->data(), s->data() + s->size());
+			fail("inavalid response - must throw");
+		}
+		catch (MessageException&)
+		{
+		}
+	}
+}
+
+
 void HTTPResponseTest::testCookies()
 {
 	HTTPResponse response;
@@ -267,6 +317,8 @@ CppUnit::Test* HTTPResponseTest::suite()
 	CppUnit_addTest(pSuite, HTTPResponseTest, testCookies);
 	CppUnit_addTest(pSuite, HTTPResponseTest, testReplaceCookie);
 	CppUnit_addTest(pSuite, HTTPResponseTest, testRemoveCookie);
+	CppUnit_addTest(pSuite, HTTPResponseTest, testParse);
+	CppUnit_addTest(pSuite, HTTPResponseTest, testParseInvalid);
 
 	return pSuite;
 }
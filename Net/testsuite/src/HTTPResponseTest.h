@@ -35,6 +35,8 @@ public:
 	void testCookies();
 	void testReplaceCookie();
 	void testRemoveCookie();
+	void testParse();
+	void testParseInvalid();
 
 	void setUp();
 	void tearDown();
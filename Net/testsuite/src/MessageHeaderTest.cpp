@@ -12,11 +12,13 @@
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include "Poco/Net/MessageHeader.h"
+#include "Poco/Net/MessageHeaderScanner.h"
 #include "Poco/Net/NetException.h"
 #include <sstream>
 
 
 using Poco::Net::MessageHeader;
+using Poco::Net::MessageHeaderScanner;
 using Poco::Net::NameValueCollection;
 using Poco::Net::MessageException;
 
@@ -459,6 +461,135 @@ void MessageHeaderTest::testAutoDecode()
 }
 
 
+void MessageHeaderTest::testParse()
+{
+	static const char* headers[] =
+	{
+		"name1: value1\r\nname2: value2\r\nname3: value3\r\n\r\n",
+		"name1: value1\nname2: value2\nname3: value3\n\n",
+		"name1:\r\nname2: value2\r\nname3: value3  \r\n\r\n",
+		"name1: value1\r\nname2: value21\r\n value22\r\nname3: value3\r\n\r\n",
+		"name1: value1\nname2: value21\n\tvalue22\nname3: value3\n",
+		"name1: value1\r\nname2: value21\r\n value22\r\n value23",
+		"name1: value1\r\ninvalid line\r\nname2:value2\r\n\r\n",
+		"name1: value1\r\nname1: value2\r\n\r\n"
+	};
+	for (const char* h: headers)
+	{
+		std::string s(h);
+		std::istringstream istr(s);
+		MessageHeader mh1;
+		mh1.read(istr);
+		MessageHeader mh2;
+		mh2.parse(s.data(), s.data() + s.size());
+		assertTrue (mh1.size() == mh2.size());
+		MessageHeader::ConstIterator it1 = mh1.begin();
+		MessageHeader::ConstIterator it2 = mh2.begin();
+		for (; it1 != mh1.end(); ++it1, ++it2)
+		{
+			assertEquals (it1->first, it2->first);
+			assertEquals (it1->second, it2->second);
+		}
+	}
+
+	std::string s("name1: value1\r\nname2: value2\r\n\r\nbody");
+	MessageHeader mh;
+	const char* p = mh.parse(s.data(), s.data() + s.size());
+	assertTrue (mh.size() == 2);
+	assertTrue (std::string(p) == "body");
+
+	std::istringstream istr(httpRequestHeader);
+	MessageHeader mhRead;
+	mhRead.read(istr);
+	std::string raw(httpRequestHeader);
+	MessageHeader mhParsed;
+	mhParsed.parse(raw.data(), raw.data() + raw.size());
+	assertEquals (mhParsed.get("X-Encoded-Header-A"), "(ab)");
+	assertEquals (mhParsed.get("X-Encoded-Header-B"), mhRead.get("X-Encoded-Header-B"));
+}
+
+
+void MessageHeaderTest::testParseLimits()
+{
+	std::string s1("name1: value1\r\nname2: value2\r\nname3: value3\r\n");
+	MessageHeader mh1;
+	mh1.setFieldLimit(2);
+	try
+	{
+		mh1.parse(s1.data(), s1.data() + s1.size());
+		fail("Field limit exceeded - must throw");
+	}
+	catch (MessageException&)
+	{
+	}
+
+	std::string s2("name1: value1\r\n");
+	MessageHeader mh2;
+	mh2.setNameLengthLimit(2);
+	try
+	{
+		mh2.parse(s2.data(), s2.data() + s2.size());
+		fail("Name length limit exceeded - must throw");
+	}
+	catch (MessageException&)
+	{
+	}
+
+	MessageHeader mh3;
+	mh3.setValueLengthLimit(2);
+	try
+	{
+		mh3.parse(s2.data(), s2.data() + s2.size());
+		fail("Value length limit exceeded - must throw");
+	}
+	catch (MessageException&)
+	{
+	}
+
+	std::string s4("name1: value1\r\nname2: ");
+	s4.append(9000, 'x');
+	MessageHeader mh4;
+	try
+	{
+		mh4.parse(s4.data(), s4.data() + s4.size());
+		fail("malformed message - must throw");
+	}
+	catch (MessageException&)
+	{
+	}
+}
+
+
+void MessageHeaderTest::testScanner()
+{
+	std::string s(100, 'x');
+	for (std::size_t i = 0; i < s.size(); i++)
+	{
+		std::string t(s);
+		t[i] = ':';
+		assertTrue (MessageHeaderScanner::find(t.data(), t.data() + t.size(), ':') == t.data() + i);
+		assertTrue (MessageHeaderScanner::find(t.data(), t.data() + i, ':') == t.data() + i);
+		t[i] = '\n';
+		assertTrue (MessageHeaderScanner::find(t.data(), t.data() + t.size(), '\r', '\n') == t.data() + i);
+		assertTrue (MessageHeaderScanner::findSpace(t.data(), t.data() + t.size()) == t.data() + i);
+		t[i] = ' ';
+		assertTrue (MessageHeaderScanner::findSpace(t.data(), t.data() + t.size()) == t.data() + i);
+		t[i] = '\x85';
+		assertTrue (MessageHeaderScanner::findSpace(t.data(), t.data() + t.size()) == t.data() + t.size());
+	}
+
+	std::string h("name1: value1\r\nname2: value2\r\n\r\nbody");
+	assertTrue (MessageHeaderScanner::findHeaderEnd(h.data(), h.data() + h.size()) == h.data() + h.size() - 4);
+	assertTrue (MessageHeaderScanner::findHeaderEnd(h.data(), h.data() + h.size() - 5) == nullptr);
+	h = "name1: value1\n\n";
+	assertTrue (MessageHeaderScanner::findHeaderEnd(h.data(), h.data() + h.size()) == h.data() + h.size());
+	h = "name1: value1\r\n value2\r\n";
+	assertTrue (MessageHeaderScanner::findHeaderEnd(h.data(), h.data() + h.size()) == nullptr);
+	h = "\r\n";
+	assertTrue (MessageHeaderScanner::findHeaderEnd(h.data(), h.data() + h.size()) == nullptr);
+}
+
+
 void MessageHeaderTest::setUp()
 {
 }
@@ -491,6 +622,9 @@ CppUnit::Test* MessageHeaderTest::suite()
 	CppUnit_addTest(pSuite, MessageHeaderTest, testFieldLimit);
 	CppUnit_addTest(pSuite, MessageHeaderTest, testDecodeWord);
 	CppUnit_addTest(pSuite, MessageHeaderTest, testAutoDecode);
+	CppUnit_addTest(pSuite, MessageHeaderTest, testParse);
+	CppUnit_addTest(pSuite, MessageHeaderTest, testParseLimits);
+	CppUnit_addTest(pSuite, MessageHeaderTest, testScanner);
 
 	return pSuite;
 }
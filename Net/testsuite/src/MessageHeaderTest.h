@@ -44,6 +44,9 @@ public:
 	void testValueLengthLimit();
 	void testDecodeWord();
 	void testAutoDecode();
+	void testParse();
+	void testParseLimits();
+	void testScanner();
 
 	void setUp();
 	void tearDown();
@@ -18,6 +18,7 @@
 #include "Poco/Timestamp.h"
 #include "Poco/Stopwatch.h"
 #include <iostream>
+#include <thread>
 
 using Poco::Net::SocketProactor;
 using Poco::Net::StreamSocket;
@@ -209,6 +210,180 @@ void SocketProactorTest::testUDPSocketProactor()
 }
 
 
+void SocketProactorTest::testTCPSocketProactorIOUring()
+{
+	if (!SocketProactor::isIOUringAvailable())
+	{
+		std::cerr << "io_uring not available, test skipped" << std::endl;
+		return;
+	}
+
+	EchoServer echoServer;
+	SocketProactor proactor(false, SocketProactor::IO_ENGINE_IO_URING);
+	assertTrue (proactor.ioEngine() == SocketProactor::IO_ENGINE_IO_URING);
+	StreamSocket s;
+	s.connect(SocketAddress("127.0.0.1", echoServer.port()));
+	std::string hello = "hello proactor world";
+	std::atomic<bool> sent(false), sendPassed(false);
+	auto onSendCompletion = [&](std::error_code err, int bytes)
+	{
+		sendPassed = (err.value() == 0) && (bytes == hello.length());
+		sent = true;
+	};
+	proactor.addSend(s, SocketProactor::Buffer(hello.begin(), hello.end()), onSendCompletion);
+	SocketProactor::Buffer buf(hello.size(), 0);
+	std::atomic<bool> received(false), receivePassed(false);
+	auto onRecvCompletion = [&](std::error_code err, int bytes)
+	{
+		receivePassed = (err.value() == 0) &&
+						(bytes == hello.length()) &&
+						(std::string(buf.begin(), buf.end()) == hello);
+		received = true;
+	};
+	proactor.addReceive(s, buf, onRecvCompletion);
+	assertTrue (proactor.hasSocketHandlers());
+	Stopwatch sw;
+	sw.start();
+	while (!received)
+	{
+		if (sw.elapsedSeconds() > 1)
+			fail("SocketProactor receive completion timed out.", __LINE__, __FILE__);
+		proactor.poll();
+	}
+
+	assertTrue (sent);
+	assertTrue (sendPassed);
+	assertTrue (received);
+	assertTrue (receivePassed);
+	assertFalse (proactor.hasSocketHandlers());
+
+	std::atomic<bool> error(false), errorPassed(false);
+	auto onError = [&](std::error_code err, int bytes)
+	{
+		errorPassed = (err.value() != 0) && (bytes == 0);
+		error = true;
+	};
+
+	StreamSocket errSock(SocketAddress::IPv4);
+	errSock.connectNB(SocketAddress("127.0.0.1", 0xFFEE));
+	Thread::sleep(100);
+	proactor.addSend(errSock, SocketProactor::Buffer(hello.begin(), hello.end()), onError);
+	sw.restart();
+	while (!error)
+	{
+		if (sw.elapsedSeconds() > 1)
+			fail("SocketProactor send completion timed out.", __LINE__, __FILE__);
+		proactor.poll();
+	}
+	assertTrue (errorPassed);
+}
+
+
+void SocketProactorTest::testUDPSocketProactorIOUring()
+{
+	if (!SocketProactor::isIOUringAvailable())
+	{
+		std::cerr << "io_uring not available, test skipped" << std::endl;
+		return;
+	}
+
+	UDPEchoServer echoServer;
+	DatagramSocket s(SocketAddress::IPv4);
+	SocketProactor proactor(false, SocketProactor::IO_ENGINE_IO_URING);
+	std::string hello = "hello proactor world";
+	const int count = 16;
+	std::atomic<int> sent(0), received(0), passed(0);
+	SocketAddress addr("127.0.0.1", echoServer.port());
+	for (int i = 0; i < count; ++i)
+	{
+		proactor.addSendTo(s,
+			SocketProactor::Buffer(hello.begin(), hello.end()),
+			SocketAddress(addr),
+			[&](std::error_code err, int bytes)
+			{
+				if (err.value() == 0 && bytes == hello.length()) ++sent;
+			});
+	}
+
+	// empty buffers are sized by the proactor
+	std::vector<SocketProactor::Buffer> bufs(count);
+	std::vector<SocketAddress> addrs(count);
+	for (int i = 0; i < count; ++i)
+	{
+		SocketProactor::Buffer& buf = bufs[i];
+		SocketAddress& sa = addrs[i];
+		proactor.addReceiveFrom(s, buf, sa, [&, i](std::error_code err, int bytes)
+		{
+			if ((err.value() == 0) &&
+				(bytes == hello.length()) &&
+				(sa.port() == echoServer.port()) &&
+				(std::string(buf.begin(), buf.begin() + bytes) == hello))
+			{
+				++passed;
+			}
+			++received;
+		});
+	}
+
+	Stopwatch sw;
+	sw.start();
+	while (received < count)
+	{
+		if (sw.elapsedSeconds() > 2)
+			fail("SocketProactor receiveFrom timed out.", __LINE__, __FILE__);
+		proactor.poll();
+	}
+
+	assertEqual (count, sent.load());
+	assertEqual (count, passed.load());
+	assertEqual (SocketProactor::DEFAULT_RECEIVE_BUFFER_SIZE, bufs[0].size());
+}
+
+
+void SocketProactorTest::testIOUringCompletionThread()
+{
+	if (!SocketProactor::isIOUringAvailable())
+	{
+		std::cerr << "io_uring not available, test skipped" << std::endl;
+		return;
+	}
+
+	EchoServer echoServer;
+	SocketProactor proactor(true, SocketProactor::IO_ENGINE_IO_URING);
+	StreamSocket s;
+	s.connect(SocketAddress("127.0.0.1", echoServer.port()));
+	std::string hello = "hello proactor world";
+
+	// completion handlers are called by the thread calling poll(),
+	// unless they have been marked as blocking
+	std::atomic<bool> sent(false), received(false);
+	std::thread::id sendThread, receiveThread;
+	proactor.addSend(s, SocketProactor::Buffer(hello.begin(), hello.end()), [&](std::error_code err, int bytes)
+	{
+		sendThread = std::this_thread::get_id();
+		sent = true;
+	});
+	SocketProactor::Buffer buf(hello.size(), 0);
+	proactor.addReceive(s, buf, [&](std::error_code err, int bytes)
+	{
+		receiveThread = std::this_thread::get_id();
+		received = true;
+	}, true);
+
+	Stopwatch sw;
+	sw.start();
+	while (!sent || !received)
+	{
+		if (sw.elapsedSeconds() > 1)
+			fail("SocketProactor completion timed out.", __LINE__, __FILE__);
+		proactor.poll();
+	}
+	assertTrue (sendThread == std::this_thread::get_id());
+	assertTrue (receiveThread != std::this_thread::get_id());
+	assertTrue (std::string(buf.begin(), buf.end()) == hello);
+}
+
+
 void SocketProactorTest::testSocketProactorStartStop()
 {
 	UDPEchoServer echoServer;
@@ -348,6 +523,9 @@ CppUnit::Test* SocketProactorTest::suite()
 	CppUnit_addTest(pSuite, SocketProactorTest, testTCPSocketProactor);
 	CppUnit_addTest(pSuite, SocketProactorTest, testUDPSocketProactor);
 	CppUnit_addTest(pSuite, SocketProactorTest, testSocketProactorStartStop);
+	CppUnit_addTest(pSuite, SocketProactorTest, testTCPSocketProactorIOUring);
+	CppUnit_addTest(pSuite, SocketProactorTest, testUDPSocketProactorIOUring);
+	CppUnit_addTest(pSuite, SocketProactorTest, testIOUringCompletionThread);
 	CppUnit_addTest(pSuite, SocketProactorTest, testWork);
 	CppUnit_addTest(pSuite, SocketProactorTest, testTimedWork);
 
@@ -33,6 +33,9 @@ public:
 	void testTCPSocketProactor();
 	void testUDPSocketProactor();
 	void testSocketProactorStartStop();
+	void testTCPSocketProactorIOUring();
+	void testUDPSocketProactorIOUring();
+	void testIOUringCompletionThread();
 
 	void testWork();
 	void testTimedWork();
@@ -23,6 +23,7 @@
 #include "Poco/Stopwatch.h"
 #include "Poco/Exception.h"
 #include "Poco/Thread.h"
+#include "Poco/Event.h"
 #include <sstream>
 #include <chrono>
 
@@ -41,6 +42,7 @@ using Poco::Net::WritableNotification;
 using Poco::Net::TimeoutNotification;
 using Poco::Net::ErrorNotification;
 using Poco::Net::ShutdownNotification;
+using Poco::Net::SocketTimeoutNotification;
 using Poco::NObserver;
 using Poco::Stopwatch;
 using Poco::IllegalStateException;
@@ -511,6 +513,57 @@ namespace
 		NObserver<ConcurrentRemovalHandler, WritableNotification> _ow;
 		int _removeCount;
 	};
+
+	class IdleTimeoutHandler
+	{
+	public:
+		IdleTimeoutHandler(const StreamSocket& socket, SocketReactor& reactor):
+			_socket(socket),
+			_reactor(reactor),
+			_or(*this, &IdleTimeoutHandler::onReadable),
+			_ot(*this, &IdleTimeoutHandler::onSocketTimeout),
+			_timeouts(0)
+		{
+			_reactor.addEventHandler(_socket, _or);
+			_reactor.addEventHandler(_socket, _ot);
+		}
+
+		~IdleTimeoutHandler()
+		{
+			_reactor.remove(_socket);
+		}
+
+		void onReadable(const AutoPtr<ReadableNotification>& pNf)
+		{
+			char buffer[64];
+			_socket.receiveBytes(buffer, sizeof(buffer));
+		}
+
+		void onSocketTimeout(const AutoPtr<SocketTimeoutNotification>& pNf)
+		{
+			poco_assert (pNf->socket() == _socket);
+			++_timeouts;
+			_event.set();
+		}
+
+		int timeouts() const
+		{
+			return _timeouts;
+		}
+
+		bool waitTimeout(long milliseconds)
+		{
+			return _event.tryWait(milliseconds);
+		}
+
+	private:
+		StreamSocket _socket;
+		SocketReactor& _reactor;
+		NObserver<IdleTimeoutHandler, ReadableNotification> _or;
+		NObserver<IdleTimeoutHandler, SocketTimeoutNotification> _ot;
+		std::atomic<int> _timeouts;
+		Poco::Event _event;
+	};
 }
 
 
@@ -896,6 +949,66 @@ void SocketReactorTest::testConcurrentHandlerRemoval()
 }
 
 
+void SocketReactorTest::testSocketTimeout()
+{
+	SocketAddress ssa;
+	ServerSocket ss(ssa);
+	ScopedSocketReactor reactor;
+
+	SocketAddress sa("127.0.0.1", ss.address().port());
+	StreamSocket sock(sa);
+	StreamSocket accepted = ss.acceptConnection();
+
+	IdleTimeoutHandler handler(accepted, *reactor);
+	reactor->setSocketTimeout(accepted, Poco::Timespan(0, 300000));
+	assertTrue (reactor->getSocketTimeout(accepted) == Poco::Timespan(0, 300000));
+
+	// activity restarts the timeout
+	for (int i = 0; i < 5; i++)
+	{
+		sock.sendBytes("x", 1);
+		Thread::sleep(100);
+	}
+	assertTrue (handler.timeouts() == 0);
+
+	// the timeout fires once, after the last activity
+	Stopwatch sw;
+	sw.start();
+	assertTrue (handler.waitTimeout(2000));
+	sw.stop();
+	assertTrue (sw.elapsed() >= 150000);
+	assertTrue (handler.timeouts() == 1);
+	assertFalse (handler.waitTimeout(500));
+	assertTrue (handler.timeouts() == 1);
+
+	// the next activity re-arms the timeout
+	sock.sendBytes("x", 1);
+	assertTrue (handler.waitTimeout(2000));
+	assertTrue (handler.timeouts() == 2);
+
+	reactor->setSocketTimeout(accepted, 0);
+	assertTrue (reactor->getSocketTimeout(accepted) == 0);
+	sock.sendBytes("x", 1);
+	assertFalse (handler.waitTimeout(600));
+	assertTrue (handler.timeouts() == 2);
+}
+
+
+void SocketReactorTest::testSocketTimeoutUnregistered()
+{
+	SocketAddress ssa;
+	ServerSocket ss(ssa);
+	ScopedSocketReactor reactor;
+
+	SocketAddress sa("127.0.0.1", ss.address().port());
+	StreamSocket sock(sa);
+
+	// the timeout is ignored for a socket without event handlers
+	reactor->setSocketTimeout(sock, Poco::Timespan(0, 300000));
+	assertTrue (reactor->getSocketTimeout(sock) == 0);
+}
+
+
 void SocketReactorTest::onReadable(const Poco::AutoPtr<Poco::Net::ReadableNotification>& pNf)
 {
 }
@@ -931,6 +1044,8 @@ CppUnit::Test* SocketReactorTest::suite()
 	CppUnit_addTest(pSuite, SocketReactorTest, testSocketReactorWakeup);
 	CppUnit_addTest(pSuite, SocketReactorTest, testSocketReactorRemove);
 	CppUnit_addTest(pSuite, SocketReactorTest, testConcurrentHandlerRemoval);
+	CppUnit_addTest(pSuite, SocketReactorTest, testSocketTimeout);
+	CppUnit_addTest(pSuite, SocketReactorTest, testSocketTimeoutUnregistered);
 
 	return pSuite;
 }
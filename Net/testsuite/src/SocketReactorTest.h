@@ -43,6 +43,8 @@ public:
 	void testSocketReactorWakeup();
 	void testSocketReactorRemove();
 	void testConcurrentHandlerRemoval();
+	void testSocketTimeout();
+	void testSocketTimeoutUnregistered();
 
 	void setUp();
 	void tearDown();
@@ -25,6 +25,7 @@ public:
 	~UDPServerTest();
 
 	void testServer();
+	void testServerBatch();
 
 	void setUp();
 	void tearDown();
@@ -21,13 +21,18 @@
 #include "Poco/Net/NetSSL.h"
 #include "Poco/Net/SocketDefs.h"
 #include "Poco/Net/InvalidCertificateHandler.h"
+#include "Poco/Net/SessionCache.h"
+#include "Poco/Net/SessionTicketKey.h"
 #include "Poco/Crypto/X509Certificate.h"
 #include "Poco/Crypto/EVPPKey.h"
 #include "Poco/Crypto/RSAKey.h"
 #include "Poco/RefCountedObject.h"
 #include "Poco/SharedPtr.h"
 #include "Poco/AutoPtr.h"
+#include "Poco/RWLock.h"
 #include <openssl/ssl.h>
+#include <atomic>
+#include <vector>
 #include <cstdlib>
 
 
@@ -426,6 +431,80 @@ public:
 		///
 		/// The feature can be disabled by calling this method.
 
+	void setSessionTicketKeys(const std::vector<SessionTicketKey>& keys);
+		/// Sets the keys used to encrypt and decrypt stateless
+		/// session tickets (RFC 5077) on the server.
+		///
+		/// New tickets are encrypted with the first key. Tickets
+		/// encrypted with any of the keys are accepted; a client
+		/// presenting a ticket encrypted with one of the other keys
+		/// is issued a new ticket encrypted with the first key.
+		///
+		/// By default, OpenSSL uses random keys created for every
+		/// SSL_CTX, so tickets issued by one server process cannot
+		/// be used to resume the session with another one. To share
+		/// tickets among multiple servers, e.g. behind a load balancer,
+		/// all servers must use the same keys.
+		///
+		/// Passing an empty vector reverts to the built-in keys
+		/// of OpenSSL.
+		///
+		/// This method may only be called on SERVER_USE Context objects.
+
+	void rotateSessionTicketKey(const SessionTicketKey& key, std::size_t maxKeys = 2);
+		/// Makes the given key the one used to encrypt new session
+		/// tickets. The previous keys are kept for decrypting
+		/// existing tickets, up to a total of maxKeys keys; older
+		/// keys are discarded.
+		///
+		/// Should be called periodically (e.g., every few hours),
+		/// with the same key on all servers sharing tickets,
+		/// to limit the impact of a compromised key.
+		///
+		/// This method may only be called on SERVER_USE Context objects.
+
+	std::size_t sessionTicketKeyCount() const;
+		/// Returns the number of session ticket keys set with
+		/// setSessionTicketKeys() or rotateSessionTicketKey().
+
+	void setSessionCache(SessionCache::Ptr pCache);
+		/// Sets an external session cache for the server, which
+		/// replaces the internal session cache of OpenSSL.
+		///
+		/// The external cache allows server processes to share
+		/// sessions for session ID based (stateful) resumption, see
+		/// SharedMemorySessionCache. Stateless session tickets do
+		/// not need a cache, but TLSv1.3 tickets refer to a cached
+		/// session if stateless session resumption has been disabled
+		/// with disableStatelessSessionResumption().
+		///
+		/// Session caching must also be enabled with the two-argument
+		/// version of enableSessionCache(), with the same session ID
+		/// context on all servers sharing the cache.
+		///
+		/// Passing a null pointer removes the external cache.
+		/// The cache should be set before the Context is used
+		/// for the first connection.
+		///
+		/// This method may only be called on SERVER_USE Context objects.
+
+	SessionCache::Ptr getSessionCache() const;
+		/// Returns the external session cache, or a null pointer
+		/// if none has been set.
+
+	Poco::UInt64 fullHandshakes() const;
+		/// Returns the number of full handshakes completed by
+		/// connections using this Context.
+
+	Poco::UInt64 resumedHandshakes() const;
+		/// Returns the number of abbreviated handshakes completed by
+		/// connections using this Context, in which a previous session
+		/// has been resumed, either from a session cache or from a
+		/// session ticket.
+
+	void resetHandshakeCounters();
+		/// Resets the full and resumed handshake counters to zero.
+
 	void disableProtocols(int protocols);
 		/// Disables the given protocols.
 		///
@@ -478,6 +557,48 @@ public:
 		/// but no close_notify alert is sent to the peer. This behaviour violates the TLS standard.
 		/// The default is a normal shutdown behaviour as described by the TLS standard.
 
+	void enableKernelTLS(bool flag = true);
+		/// Enables or disables kernel TLS (kTLS) offload (SSL_OP_ENABLE_KTLS)
+		/// for connections using this Context.
+		///
+		/// With kTLS, OpenSSL passes the keys negotiated in the handshake
+		/// to the operating system kernel, which then encrypts and decrypts
+		/// the TLS records. This allows SecureStreamSocket::sendFile() to
+		/// send files with SSL_sendfile(), without copying the file contents
+		/// through user space.
+		///
+		/// kTLS is only used if OpenSSL has been built with kTLS support,
+		/// the operating system supports it (on Linux, the tls kernel module
+		/// must be available), and the kernel supports the negotiated cipher
+		/// (e.g., AES-GCM). Otherwise, the connection transparently falls back
+		/// to encryption in user space.
+		///
+		/// Kernel TLS is disabled by default.
+
+	bool kernelTLSEnabled() const;
+		/// Returns true if kernel TLS offload has been enabled
+		/// with enableKernelTLS() and is supported by OpenSSL.
+
+	void setALPNProtocols(const std::vector<std::string>& protocols);
+		/// Sets the application layer protocols (e.g., "h2" and "http/1.1")
+		/// for Application-Layer Protocol Negotiation (ALPN, RFC 7301),
+		/// in order of preference.
+		///
+		/// A client Context offers the given protocols to the server.
+		/// A server Context selects the first of the given protocols that
+		/// is also offered by the client. If no protocol matches, or the
+		/// client does not support ALPN, the handshake completes without
+		/// a negotiated protocol.
+		///
+		/// The negotiated protocol can be obtained with
+		/// SecureStreamSocket::alpnProtocol() after the handshake.
+		///
+		/// Must be called before the Context is used to create connections.
+		/// An empty list disables ALPN.
+
+	const std::vector<std::string>& getALPNProtocols() const;
+		/// Returns the application layer protocols set with setALPNProtocols().
+
 private:
 	void init(const Params& params);
 		/// Initializes the Context with the given parameters.
@@ -492,12 +613,49 @@ private:
 	void createSSLContext();
 		/// Create a SSL_CTX object according to Context configuration.
 
+	void updateSessionCacheMode(bool enable);
+		/// Sets the session cache mode, taking the external session cache into account.
+
+	void countHandshake(bool resumed);
+		/// Updates the handshake counters.
+
+	static Context* fromSSL(SSL* pSSL);
+		/// Returns the Context the given SSL object has been created from.
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	static int onTicketKey(SSL* pSSL, unsigned char* keyName, unsigned char* iv, EVP_CIPHER_CTX* pCipherContext, EVP_MAC_CTX* pMACContext, int enc);
+#else
+	static int onTicketKey(SSL* pSSL, unsigned char* keyName, unsigned char* iv, EVP_CIPHER_CTX* pCipherContext, HMAC_CTX* pMACContext, int enc);
+#endif
+		/// Encrypts or decrypts session tickets with the session ticket keys.
+
+	static int onNewSession(SSL* pSSL, SSL_SESSION* pSession);
+		/// Adds a new session to the external session cache.
+
+	static SSL_SESSION* onGetSession(SSL* pSSL, const unsigned char* id, int idLength, int* pCopy);
+		/// Looks up a session in the external session cache.
+
+	static void onRemoveSession(SSL_CTX* pSSLContext, SSL_SESSION* pSession);
+		/// Removes a session from the external session cache.
+
+	static int onALPNSelect(SSL* pSSL, const unsigned char** pOut, unsigned char* pOutLength, const unsigned char* pIn, unsigned int inLength, void* pArg);
+		/// Selects the application layer protocol from the protocols offered by the client.
+
 	Usage _usage;
 	VerificationMode _mode;
 	SSL_CTX* _pSSLContext;
 	bool _extendedCertificateVerification;
 	bool _ocspStaplingResponseVerification;
 	InvalidCertificateHandlerPtr _pInvalidCertificateHandler;
+	std::vector<SessionTicketKey> _ticketKeys;
+	mutable Poco::RWLock _ticketKeyLock;
+	SessionCache::Ptr _pSessionCache;
+	std::atomic<Poco::UInt64> _fullHandshakes;
+	std::atomic<Poco::UInt64> _resumedHandshakes;
+	std::vector<std::string> _alpnProtocols;
+	std::string _alpnProtocolList;
+
+	friend class SecureSocketImpl;
 };
 
 
@@ -510,6 +668,12 @@ inline Context::Usage Context::usage() const
 }
 
 
+inline const std::vector<std::string>& Context::getALPNProtocols() const
+{
+	return _alpnProtocols;
+}
+
+
 inline bool Context::isForServerUse() const
 {
 	return _usage == SERVER_USE
@@ -551,6 +715,33 @@ inline Context::InvalidCertificateHandlerPtr Context::getInvalidCertificateHandl
 }
 
 
+inline SessionCache::Ptr Context::getSessionCache() const
+{
+	return _pSessionCache;
+}
+
+
+inline Poco::UInt64 Context::fullHandshakes() const
+{
+	return _fullHandshakes.load(std::memory_order_relaxed);
+}
+
+
+inline Poco::UInt64 Context::resumedHandshakes() const
+{
+	return _resumedHandshakes.load(std::memory_order_relaxed);
+}
+
+
+inline void Context::countHandshake(bool resumed)
+{
+	if (resumed)
+		_resumedHandshakes.fetch_add(1, std::memory_order_relaxed);
+	else
+		_fullHandshakes.fetch_add(1, std::memory_order_relaxed);
+}
+
+
 } } // namespace Poco::Net
 
 
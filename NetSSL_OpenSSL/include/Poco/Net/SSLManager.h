@@ -97,6 +97,8 @@ class NetSSL_API SSLManager
 	///            <disableProtocols>sslv2,sslv3,tlsv1,tlsv1_1,tlsv1_2,tlsv1_3</disableProtocols>
 	///            <dhParamsFile>dh.pem</dhParamsFile>
 	///            <ecdhCurve>prime256v1</ecdhCurve>
+	///            <kernelTLS>true|false</kernelTLS>
+	///            <alpnProtocols>h2,http/1.1</alpnProtocols>
 	///          </server|client>
 	///          <fips>false</fips>
 	///       </openSSL>
@@ -151,6 +153,10 @@ class NetSSL_API SSLManager
 	///      If not specified or empty, the default parameters are used.
 	///    - ecdhCurve (string): Specifies the name of the curve to use for ECDH, based
 	///      on the curve names specified in RFC 4492. Defaults to "prime256v1".
+	///    - kernelTLS (boolean): Enable or disable kernel TLS (kTLS) offload, if supported by
+	///      OpenSSL and the operating system. See Context::enableKernelTLS() for details.
+	///    - alpnProtocols (string): A comma-separated list of application layer protocols
+	///      for ALPN, in order of preference. See Context::setALPNProtocols() for details.
 	///    - fips: Enable or disable OpenSSL FIPS mode. Only supported if the OpenSSL version
 	///      that this library is built against supports FIPS mode.
 	///
@@ -356,6 +362,8 @@ private:
 	static const std::string CFG_DISABLE_PROTOCOLS;
 	static const std::string CFG_DH_PARAMS_FILE;
 	static const std::string CFG_ECDH_CURVE;
+	static const std::string CFG_KERNEL_TLS;
+	static const std::string CFG_ALPN_PROTOCOLS;
 
 #ifdef OPENSSL_FIPS
 	static const std::string CFG_FIPS_MODE;
@@ -24,6 +24,7 @@
 #include "Poco/Net/X509Certificate.h"
 #include "Poco/Net/Session.h"
 #include "Poco/Mutex.h"
+#include "Poco/FileStream.h"
 #include <openssl/bio.h>
 #include <openssl/ssl.h>
 
@@ -180,6 +181,24 @@ public:
 		/// Returns the number of bytes available from the
 		/// SSL buffer for immediate reading.
 
+	std::streamsize sendFile(Poco::FileInputStream& fileInputStream, std::streamoff offset, std::streamsize count);
+		/// Sends the contents of a file with SSL_sendfile(), if kernel
+		/// TLS is active for sending (see usesKernelTLS()). Completes
+		/// the handshake first, if necessary.
+		///
+		/// If count is != 0, sends the given number of bytes, otherwise
+		/// sends all bytes, starting from the given offset.
+		///
+		/// Returns the number of bytes sent, or -1 without sending
+		/// anything if kernel TLS is not active.
+
+	bool usesKernelTLS() const;
+		/// Returns true iff the encryption of sent records has been
+		/// offloaded to the kernel (see Context::enableKernelTLS()).
+		///
+		/// Kernel TLS is enabled during the handshake, so this
+		/// always returns false before the handshake has been completed.
+
 	int completeHandshake();
 		/// Completes the SSL handshake.
 		///
@@ -232,6 +251,12 @@ public:
 		/// Returns true iff a reused session was negotiated during
 		/// the handshake.
 
+	std::string alpnProtocol() const;
+		/// Returns the application layer protocol negotiated with ALPN
+		/// during the handshake (see Context::setALPNProtocols()), or an
+		/// empty string if no protocol has been negotiated or the handshake
+		/// has not been completed yet.
+
 	SocketImpl* socket();
 		/// Returns the underlying SocketImpl.
 		
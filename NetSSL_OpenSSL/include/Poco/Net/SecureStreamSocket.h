@@ -268,6 +268,24 @@ public:
 		/// Returns true iff a reused session was negotiated during
 		/// the handshake.
 
+	std::string alpnProtocol() const;
+		/// Returns the application layer protocol (e.g., "h2") negotiated
+		/// with ALPN during the handshake, or an empty string if no protocol
+		/// has been negotiated or the handshake has not been completed yet.
+		///
+		/// The protocols offered by a client, or accepted by a server, are
+		/// set with Context::setALPNProtocols().
+
+	bool usesKernelTLS() const;
+		/// Returns true iff the encryption of sent records has been
+		/// offloaded to the kernel (kTLS) during the handshake.
+		///
+		/// Kernel TLS must be enabled in the Context with
+		/// Context::enableKernelTLS(). If active, sendFile() sends
+		/// files with SSL_sendfile(), without copying the file contents
+		/// through user space. Otherwise, sendFile() reads and sends the
+		/// file blockwise.
+
 	void abort();
 		/// Aborts the SSL connection by closing the underlying
 		/// TCP connection. No orderly SSL shutdown is performed.
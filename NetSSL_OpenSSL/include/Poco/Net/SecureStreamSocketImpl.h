@@ -102,6 +102,18 @@ public:
 		///
 		/// Throws a Poco::InvalidAccessException.
 
+	std::streamsize sendFile(Poco::FileInputStream& fileInputStream, std::streamoff offset = 0, std::streamsize count = 0) override;
+		/// Sends the contents of a file over the socket.
+		///
+		/// If kernel TLS is active (see usesKernelTLS()), the file is
+		/// sent with SSL_sendfile(), so that the file contents are
+		/// encrypted and sent by the kernel. Otherwise, the file is
+		/// read and sent blockwise.
+
+	bool usesKernelTLS() const;
+		/// Returns true iff the encryption of sent records has been
+		/// offloaded to the kernel (see Context::enableKernelTLS()).
+
 	int available() override;
 		/// Returns the number of bytes available that can be read
 		/// without causing the socket to block.
@@ -207,6 +219,10 @@ public:
 		/// Returns true iff a reused session was negotiated during
 		/// the handshake.
 
+	std::string alpnProtocol() const;
+		/// Returns the application layer protocol negotiated with ALPN,
+		/// or an empty string if none has been negotiated.
+
 	// SocketImpl
 	virtual void setBlocking(bool flag) override;
 	virtual bool getBlocking() const override;
@@ -280,6 +296,18 @@ inline bool SecureStreamSocketImpl::sessionWasReused()
 }
 
 
+inline std::string SecureStreamSocketImpl::alpnProtocol() const
+{
+	return _impl.alpnProtocol();
+}
+
+
+inline bool SecureStreamSocketImpl::usesKernelTLS() const
+{
+	return _impl.usesKernelTLS();
+}
+
+
 inline int SecureStreamSocketImpl::lastError()
 {
 	return SocketImpl::lastError();
@@ -0,0 +1,79 @@
+//
+// SessionCache.h
+//
+// Library: NetSSL_OpenSSL
+// Package: SSLCore
+// Module:  SessionCache
+//
+// Definition of the SessionCache class.
+//
+// Copyright (c) 2006-2010, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef NetSSL_SessionCache_INCLUDED
+#define NetSSL_SessionCache_INCLUDED
+
+
+#include "Poco/Net/NetSSL.h"
+#include "Poco/Timestamp.h"
+#include "Poco/SharedPtr.h"
+#include <string>
+
+
+namespace Poco {
+namespace Net {
+
+
+class NetSSL_API SessionCache
+	/// SessionCache is the interface for an external server-side
+	/// SSL/TLS session cache, which can be shared by multiple
+	/// server processes (e.g., behind a load balancer), so that
+	/// a client can resume its session with any of them.
+	///
+	/// A SessionCache is installed with Context::setSessionCache().
+	/// Sessions are passed to and from the cache in serialized
+	/// (DER) form, keyed by their session ID.
+	///
+	/// Implementations must be thread-safe, as the methods are
+	/// called from the handshakes of all connections using the
+	/// Context.
+{
+public:
+	using Ptr = Poco::SharedPtr<SessionCache>;
+
+	SessionCache();
+		/// Creates the SessionCache.
+
+	virtual ~SessionCache();
+		/// Destroys the SessionCache.
+
+	virtual void add(const std::string& id, const std::string& session, const Poco::Timestamp& expires) = 0;
+		/// Stores the serialized session with the given session ID.
+		/// The session can be discarded after the given expiration time.
+		///
+		/// The cache may silently discard sessions, e.g. if it is full.
+
+	virtual bool get(const std::string& id, std::string& session) = 0;
+		/// Looks up the session with the given session ID.
+		///
+		/// Returns true and stores the serialized session in session
+		/// if the session has been found and has not yet expired,
+		/// otherwise returns false.
+
+	virtual void remove(const std::string& id) = 0;
+		/// Removes the session with the given ID from the cache, if present.
+
+private:
+	SessionCache(const SessionCache&);
+	SessionCache& operator = (const SessionCache&);
+};
+
+
+} } // namespace Poco::Net
+
+
+#endif // NetSSL_SessionCache_INCLUDED
@@ -0,0 +1,109 @@
+//
+// SessionTicketKey.h
+//
+// Library: NetSSL_OpenSSL
+// Package: SSLCore
+// Module:  SessionTicketKey
+//
+// Definition of the SessionTicketKey class.
+//
+// Copyright (c) 2006-2010, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef NetSSL_SessionTicketKey_INCLUDED
+#define NetSSL_SessionTicketKey_INCLUDED
+
+
+#include "Poco/Net/NetSSL.h"
+#include <string>
+
+
+namespace Poco {
+namespace Net {
+
+
+class NetSSL_API SessionTicketKey
+	/// A key used by a server for encrypting and authenticating
+	/// stateless session tickets (RFC 5077).
+	///
+	/// A key consists of a 16 byte key name, which identifies the key
+	/// in the tickets it has issued, a 32 byte HMAC-SHA256 key and
+	/// a 32 byte AES-256 key. The serialized form is the 80 byte
+	/// concatenation of key name, HMAC key and AES key, which is
+	/// the same format as used by nginx' ssl_session_ticket_key
+	/// files (e.g., created with "openssl rand 80").
+	///
+	/// To allow clients to resume their sessions with any server
+	/// behind a load balancer, all servers must use the same keys.
+	/// See Context::setSessionTicketKeys().
+{
+public:
+	enum
+	{
+		NAME_SIZE = 16,
+		HMAC_KEY_SIZE = 32,
+		AES_KEY_SIZE = 32,
+		KEY_SIZE = NAME_SIZE + HMAC_KEY_SIZE + AES_KEY_SIZE
+	};
+
+	SessionTicketKey();
+		/// Creates a new random SessionTicketKey.
+
+	explicit SessionTicketKey(const std::string& key);
+		/// Creates a SessionTicketKey from its 80 byte serialized form.
+		///
+		/// Throws an InvalidArgumentException if key does not
+		/// have the correct size.
+
+	~SessionTicketKey();
+		/// Destroys the SessionTicketKey and clears the key material.
+
+	const unsigned char* name() const;
+		/// Returns the 16 byte key name.
+
+	const unsigned char* hmacKey() const;
+		/// Returns the 32 byte HMAC-SHA256 key.
+
+	const unsigned char* aesKey() const;
+		/// Returns the 32 byte AES-256 key.
+
+	std::string serialize() const;
+		/// Returns the 80 byte serialized form of the key.
+
+	bool hasName(const unsigned char* name) const;
+		/// Returns true iff the key has the given 16 byte key name.
+
+private:
+	unsigned char _key[KEY_SIZE];
+};
+
+
+//
+// inlines
+//
+inline const unsigned char* SessionTicketKey::name() const
+{
+	return _key;
+}
+
+
+inline const unsigned char* SessionTicketKey::hmacKey() const
+{
+	return _key + NAME_SIZE;
+}
+
+
+inline const unsigned char* SessionTicketKey::aesKey() const
+{
+	return _key + NAME_SIZE + HMAC_KEY_SIZE;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // NetSSL_SessionTicketKey_INCLUDED
@@ -0,0 +1,143 @@
+//
+// SharedMemorySessionCache.h
+//
+// Library: NetSSL_OpenSSL
+// Package: SSLCore
+// Module:  SharedMemorySessionCache
+//
+// Definition of the SharedMemorySessionCache class.
+//
+// Copyright (c) 2006-2010, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef NetSSL_SharedMemorySessionCache_INCLUDED
+#define NetSSL_SharedMemorySessionCache_INCLUDED
+
+
+#include "Poco/Net/NetSSL.h"
+#include "Poco/Net/SessionCache.h"
+#include "Poco/SharedMemory.h"
+#include "Poco/NamedMutex.h"
+
+
+namespace Poco {
+namespace Net {
+
+
+class NetSSL_API SharedMemorySessionCache: public SessionCache
+	/// A SessionCache that keeps the sessions in a named shared
+	/// memory segment, so that all server processes on a host
+	/// opening the cache with the same name share their sessions.
+	/// Access to the segment is serialized with a NamedMutex
+	/// of the same name.
+	///
+	/// The cache consists of a fixed number of fixed-size slots,
+	/// organized as a 4-way set-associative table indexed by
+	/// a hash of the session ID. If all slots of a set are in
+	/// use, the session that expires first is replaced.
+	/// Sessions that are larger than the slot size (e.g., because
+	/// they contain a long client certificate chain) are not cached.
+	///
+	/// Typically, the parent process creates the cache
+	/// (with server = true) before forking the worker processes,
+	/// or each worker process opens the segment created by
+	/// a master process with server = false. All processes must
+	/// use the same capacity and maximum session size.
+	/// The segment is removed when the process that has created
+	/// it destroys its cache.
+{
+public:
+	enum
+	{
+		DEFAULT_CAPACITY = 4096,
+		DEFAULT_MAX_SESSION_SIZE = 2048
+	};
+
+	SharedMemorySessionCache(const std::string& name, std::size_t capacity = DEFAULT_CAPACITY, std::size_t maxSessionSize = DEFAULT_MAX_SESSION_SIZE, bool server = true);
+		/// Creates or opens the shared memory session cache with the given name.
+		///
+		/// The name is used for the SharedMemory segment as well
+		/// as for the NamedMutex, and should be a valid Unix filename
+		/// without slashes.
+		///
+		/// capacity is the number of sessions the cache can hold,
+		/// and is rounded up to a multiple of 4. maxSessionSize is the
+		/// maximum size of a serialized session in bytes.
+		///
+		/// If server is true, the shared memory segment is created if it
+		/// does not exist yet. A segment is removed when the cache that has
+		/// created it is destroyed (see SharedMemory), but never by caches
+		/// that have opened an existing segment. If server is false, the
+		/// segment must already exist, otherwise a NotFoundException is thrown.
+		///
+		/// Throws an InvalidArgumentException if an existing segment has
+		/// been created with a different capacity or maximum session size.
+		/// An existing segment is never resized or reinitialized, as this
+		/// would break the processes using it.
+
+	~SharedMemorySessionCache();
+		/// Destroys the SharedMemorySessionCache.
+
+	void add(const std::string& id, const std::string& session, const Poco::Timestamp& expires);
+	bool get(const std::string& id, std::string& session);
+	void remove(const std::string& id);
+
+	void clear();
+		/// Removes all sessions from the cache.
+
+	std::size_t size();
+		/// Returns the number of sessions in the cache
+		/// that have not expired yet.
+
+	std::size_t capacity() const;
+		/// Returns the maximum number of sessions in the cache.
+
+	std::size_t maxSessionSize() const;
+		/// Returns the maximum size of a serialized session.
+
+private:
+	struct Header;
+	struct Slot;
+
+	enum
+	{
+		WAYS = 4
+	};
+
+	void open(const std::string& name, bool server);
+	void reset();
+	Slot* slot(std::size_t index) const;
+	Slot* find(const std::string& id, std::size_t& first) const;
+	char* data(Slot* pSlot) const;
+
+	std::size_t _capacity;
+	std::size_t _maxSessionSize;
+	std::size_t _slotSize;
+	Poco::SharedMemory _memory;
+	Poco::NamedMutex _mutex;
+};
+
+
+//
+// inlines
+//
+inline std::size_t SharedMemorySessionCache::capacity() const
+{
+	return _capacity;
+}
+
+
+inline std::size_t SharedMemorySessionCache::maxSessionSize() const
+{
+	return _maxSessionSize;
+}
+
+
+} } // namespace Poco::Net
+
+
+#endif // NetSSL_SharedMemorySessionCache_INCLUDED
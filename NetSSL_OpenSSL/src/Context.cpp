@@ -23,15 +23,18 @@
 #include "Poco/Timestamp.h"
 #include "Poco/Format.h"
 #include "Poco/Error.h"
+#include <cstring>
 #include <openssl/bio.h>
 #include <openssl/bn.h>
 #include <openssl/dh.h>
 #include <openssl/err.h>
 #include <openssl/ssl.h>
 #include <openssl/x509v3.h>
+#include <openssl/rand.h>
 #if OPENSSL_VERSION_NUMBER >= 0x30000000L
 #include <openssl/core_names.h>
 #include <openssl/decoder.h>
+#include <openssl/params.h>
 #endif // OPENSSL_VERSION_NUMBER >= 0x30000000L
 
 
@@ -56,7 +59,9 @@ Context::Context(Usage usage, const Params& params):
 	_mode(params.verificationMode),
 	_pSSLContext(nullptr),
 	_extendedCertificateVerification(true),
-	_ocspStaplingResponseVerification(false)
+	_ocspStaplingResponseVerification(false),
+	_fullHandshakes(0),
+	_resumedHandshakes(0)
 {
 	init(params);
 }
@@ -75,7 +80,9 @@ Context::Context(
 	_mode(verificationMode),
 	_pSSLContext(nullptr),
 	_extendedCertificateVerification(true),
-	_ocspStaplingResponseVerification(false)
+	_ocspStaplingResponseVerification(false),
+	_fullHandshakes(0),
+	_resumedHandshakes(0)
 {
 	Params params;
 	params.privateKeyFile = privateKeyFile;
@@ -100,7 +107,9 @@ Context::Context(
 	_mode(verificationMode),
 	_pSSLContext(nullptr),
 	_extendedCertificateVerification(true),
-	_ocspStaplingResponseVerification(false)
+	_ocspStaplingResponseVerification(false),
+	_fullHandshakes(0),
+	_resumedHandshakes(0)
 {
 	Params params;
 	params.caLocation = caLocation;
@@ -251,6 +260,61 @@ void Context::setQuietShutdown(bool flag)
 	SSL_CTX_set_quiet_shutdown(_pSSLContext, flag ? 1 : 0);
 }
 
+void Context::enableKernelTLS(bool flag)
+{
+	if (flag)
+	{
+#if defined(SSL_OP_ENABLE_KTLS)
+		SSL_CTX_set_options(_pSSLContext, SSL_OP_ENABLE_KTLS);
+#endif
+	}
+	else
+	{
+#if defined(SSL_OP_ENABLE_KTLS)
+		SSL_CTX_clear_options(_pSSLContext, SSL_OP_ENABLE_KTLS);
+#endif
+	}
+}
+
+bool Context::kernelTLSEnabled() const
+{
+#if defined(SSL_OP_ENABLE_KTLS)
+	return (SSL_CTX_get_options(_pSSLContext) & SSL_OP_ENABLE_KTLS) != 0;
+#else
+	return false;
+#endif
+}
+
+void Context::setALPNProtocols(const std::vector<std::string>& protocols)
+{
+	// protocol list in wire format: each name preceded by its length
+	std::string protocolList;
+	for (const auto& protocol: protocols)
+	{
+		if (protocol.empty() || protocol.size() > 255)
+			throw Poco::InvalidArgumentException("Invalid ALPN protocol name", protocol);
+		protocolList += static_cast<char>(protocol.size());
+		protocolList += protocol;
+	}
+
+	if (isForServerUse())
+	{
+		SSL_CTX_set_alpn_select_cb(_pSSLContext, protocols.empty() ? nullptr : &Context::onALPNSelect, nullptr);
+	}
+	else
+	{
+		// note: unlike most OpenSSL functions, SSL_CTX_set_alpn_protos() returns 0 on success
+		if (SSL_CTX_set_alpn_protos(_pSSLContext, reinterpret_cast<const unsigned char*>(protocolList.data()), static_cast<unsigned>(protocolList.size())) != 0)
+		{
+			std::string msg = Utility::getLastError();
+			throw SSLContextException("Cannot set ALPN protocols", msg);
+		}
+	}
+	_alpnProtocols = protocols;
+	_alpnProtocolList = protocolList;
+}
+
+
 void Context::useCertificate(const Poco::Crypto::X509Certificate& certificate)
 {
 	int errCode = SSL_CTX_use_certificate(_pSSLContext, const_cast<X509*>(certificate.certificate()));
@@ -318,14 +382,7 @@ void Context::usePrivateKey(const Poco::Crypto::EVPPKey& pkey)
 
 void Context::enableSessionCache(bool flag)
 {
-	if (flag)
-	{
-		SSL_CTX_set_session_cache_mode(_pSSLContext, isForServerUse() ? SSL_SESS_CACHE_SERVER : SSL_SESS_CACHE_CLIENT);
-	}
-	else
-	{
-		SSL_CTX_set_session_cache_mode(_pSSLContext, SSL_SESS_CACHE_OFF);
-	}
+	updateSessionCacheMode(flag);
 }
 
 
@@ -333,14 +390,7 @@ void Context::enableSessionCache(bool flag, const std::string& sessionIdContext)
 {
 	poco_assert (isForServerUse());
 
-	if (flag)
-	{
-		SSL_CTX_set_session_cache_mode(_pSSLContext, SSL_SESS_CACHE_SERVER);
-	}
-	else
-	{
-		SSL_CTX_set_session_cache_mode(_pSSLContext, SSL_SESS_CACHE_OFF);
-	}
+	updateSessionCacheMode(flag);
 
 	unsigned length = static_cast<unsigned>(sessionIdContext.length());
 	if (length > SSL_MAX_SSL_SESSION_ID_LENGTH) length = SSL_MAX_SSL_SESSION_ID_LENGTH;
@@ -410,6 +460,71 @@ void Context::disableStatelessSessionResumption()
 }
 
 
+void Context::setSessionTicketKeys(const std::vector<SessionTicketKey>& keys)
+{
+	poco_assert (isForServerUse());
+
+	Poco::ScopedWriteRWLock lock(_ticketKeyLock);
+	_ticketKeys = keys;
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	SSL_CTX_set_tlsext_ticket_key_evp_cb(_pSSLContext, _ticketKeys.empty() ? nullptr : &Context::onTicketKey);
+#else
+	SSL_CTX_set_tlsext_ticket_key_cb(_pSSLContext, _ticketKeys.empty() ? nullptr : &Context::onTicketKey);
+#endif
+}
+
+
+void Context::rotateSessionTicketKey(const SessionTicketKey& key, std::size_t maxKeys)
+{
+	poco_assert (isForServerUse());
+	poco_assert (maxKeys > 0);
+
+	Poco::ScopedWriteRWLock lock(_ticketKeyLock);
+	_ticketKeys.insert(_ticketKeys.begin(), key);
+	if (_ticketKeys.size() > maxKeys) _ticketKeys.resize(maxKeys);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	SSL_CTX_set_tlsext_ticket_key_evp_cb(_pSSLContext, &Context::onTicketKey);
+#else
+	SSL_CTX_set_tlsext_ticket_key_cb(_pSSLContext, &Context::onTicketKey);
+#endif
+}
+
+
+std::size_t Context::sessionTicketKeyCount() const
+{
+	Poco::ScopedReadRWLock lock(_ticketKeyLock);
+	return _ticketKeys.size();
+}
+
+
+void Context::setSessionCache(SessionCache::Ptr pCache)
+{
+	poco_assert (isForServerUse());
+
+	_pSessionCache = pCache;
+	if (pCache)
+	{
+		SSL_CTX_sess_set_new_cb(_pSSLContext, &Context::onNewSession);
+		SSL_CTX_sess_set_get_cb(_pSSLContext, &Context::onGetSession);
+		SSL_CTX_sess_set_remove_cb(_pSSLContext, &Context::onRemoveSession);
+	}
+	else
+	{
+		SSL_CTX_sess_set_new_cb(_pSSLContext, nullptr);
+		SSL_CTX_sess_set_get_cb(_pSSLContext, nullptr);
+		SSL_CTX_sess_set_remove_cb(_pSSLContext, nullptr);
+	}
+	updateSessionCacheMode(sessionCacheEnabled());
+}
+
+
+void Context::resetHandshakeCounters()
+{
+	_fullHandshakes.store(0, std::memory_order_relaxed);
+	_resumedHandshakes.store(0, std::memory_order_relaxed);
+}
+
+
 void Context::disableProtocols(int protocols)
 {
 	if (protocols & PROTO_SSLV2)
@@ -589,6 +704,156 @@ void Context::createSSLContext()
 }
 
 
+void Context::updateSessionCacheMode(bool enable)
+{
+	long mode = SSL_SESS_CACHE_OFF;
+	if (enable)
+	{
+		if (!isForServerUse())
+			mode = SSL_SESS_CACHE_CLIENT;
+		else if (_pSessionCache)
+			mode = SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL;
+		else
+			mode = SSL_SESS_CACHE_SERVER;
+	}
+	SSL_CTX_set_session_cache_mode(_pSSLContext, mode);
+}
+
+
+Context* Context::fromSSL(SSL* pSSL)
+{
+	return reinterpret_cast<Context*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(pSSL), SSLManager::instance().contextIndex()));
+}
+
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+int Context::onTicketKey(SSL* pSSL, unsigned char* keyName, unsigned char* iv, EVP_CIPHER_CTX* pCipherContext, EVP_MAC_CTX* pMACContext, int enc)
+#else
+int Context::onTicketKey(SSL* pSSL, unsigned char* keyName, unsigned char* iv, EVP_CIPHER_CTX* pCipherContext, HMAC_CTX* pMACContext, int enc)
+#endif
+{
+	Context* pContext = fromSSL(pSSL);
+	if (!pContext) return -1;
+
+	Poco::ScopedReadRWLock lock(pContext->_ticketKeyLock);
+	if (pContext->_ticketKeys.empty()) return 0;
+
+	const EVP_CIPHER* pCipher = EVP_aes_256_cbc();
+	std::size_t index = 0;
+	if (enc)
+	{
+		if (RAND_bytes(iv, EVP_CIPHER_iv_length(pCipher)) != 1) return -1;
+		std::memcpy(keyName, pContext->_ticketKeys[0].name(), SessionTicketKey::NAME_SIZE);
+	}
+	else
+	{
+		while (index < pContext->_ticketKeys.size() && !pContext->_ticketKeys[index].hasName(keyName)) index++;
+		// unknown key: full handshake, a new ticket will be issued
+		if (index == pContext->_ticketKeys.size()) return 0;
+	}
+	const SessionTicketKey& key = pContext->_ticketKeys[index];
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+	OSSL_PARAM params[3];
+	params[0] = OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, const_cast<unsigned char*>(key.hmacKey()), SessionTicketKey::HMAC_KEY_SIZE);
+	params[1] = OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, const_cast<char*>("SHA256"), 0);
+	params[2] = OSSL_PARAM_construct_end();
+	if (EVP_MAC_CTX_set_params(pMACContext, params) != 1) return -1;
+#else
+	if (HMAC_Init_ex(pMACContext, key.hmacKey(), SessionTicketKey::HMAC_KEY_SIZE, EVP_sha256(), nullptr) != 1) return -1;
+#endif
+	if (EVP_CipherInit_ex(pCipherContext, pCipher, nullptr, key.aesKey(), iv, enc) != 1) return -1;
+
+	// renew tickets encrypted with an older key
+	return index == 0 ? 1 : 2;
+}
+
+
+int Context::onNewSession(SSL* pSSL, SSL_SESSION* pSession)
+{
+	Context* pContext = fromSSL(pSSL);
+	if (!pContext || !pContext->_pSessionCache) return 0;
+
+	try
+	{
+		unsigned idLength = 0;
+		const unsigned char* pId = SSL_SESSION_get_id(pSession, &idLength);
+		int length = i2d_SSL_SESSION(pSession, nullptr);
+		if (idLength == 0 || length <= 0) return 0;
+
+		std::string session(static_cast<std::size_t>(length), '\0');
+		unsigned char* pData = reinterpret_cast<unsigned char*>(&session[0]);
+		i2d_SSL_SESSION(pSession, &pData);
+		Poco::Timestamp expires = Poco::Timestamp::fromEpochTime(SSL_SESSION_get_time(pSession) + SSL_SESSION_get_timeout(pSession));
+		pContext->_pSessionCache->add(std::string(reinterpret_cast<const char*>(pId), idLength), session, expires);
+	}
+	catch (...)
+	{
+		// a failing cache must not fail the handshake
+	}
+	// the session is not kept, so OpenSSL releases its reference
+	return 0;
+}
+
+
+SSL_SESSION* Context::onGetSession(SSL* pSSL, const unsigned char* id, int idLength, int* pCopy)
+{
+	*pCopy = 0;
+	Context* pContext = fromSSL(pSSL);
+	if (!pContext || !pContext->_pSessionCache || idLength <= 0) return nullptr;
+
+	try
+	{
+		std::string session;
+		if (pContext->_pSessionCache->get(std::string(reinterpret_cast<const char*>(id), idLength), session))
+		{
+			const unsigned char* pData = reinterpret_cast<const unsigned char*>(session.data());
+			return d2i_SSL_SESSION(nullptr, &pData, static_cast<long>(session.size()));
+		}
+	}
+	catch (...)
+	{
+	}
+	return nullptr;
+}
+
+
+void Context::onRemoveSession(SSL_CTX* pSSLContext, SSL_SESSION* pSession)
+{
+	Context* pContext = reinterpret_cast<Context*>(SSL_CTX_get_ex_data(pSSLContext, SSLManager::instance().contextIndex()));
+	if (!pContext || !pContext->_pSessionCache) return;
+
+	try
+	{
+		unsigned idLength = 0;
+		const unsigned char* pId = SSL_SESSION_get_id(pSession, &idLength);
+		if (idLength > 0)
+			pContext->_pSessionCache->remove(std::string(reinterpret_cast<const char*>(pId), idLength));
+	}
+	catch (...)
+	{
+	}
+}
+
+
+int Context::onALPNSelect(SSL* pSSL, const unsigned char** pOut, unsigned char* pOutLength, const unsigned char* pIn, unsigned int inLength, void* pArg)
+{
+	Context* pContext = fromSSL(pSSL);
+	if (!pContext || pContext->_alpnProtocolList.empty()) return SSL_TLSEXT_ERR_NOACK;
+
+	unsigned char* pSelected = nullptr;
+	unsigned char selectedLength = 0;
+	int rc = SSL_select_next_proto(&pSelected, &selectedLength,
+		reinterpret_cast<const unsigned char*>(pContext->_alpnProtocolList.data()), static_cast<unsigned>(pContext->_alpnProtocolList.size()),
+		pIn, inLength);
+	if (rc != OPENSSL_NPN_NEGOTIATED) return SSL_TLSEXT_ERR_NOACK;
+
+	*pOut = pSelected;
+	*pOutLength = selectedLength;
+	return SSL_TLSEXT_ERR_OK;
+}
+
+
 void Context::initDH(KeyDHGroup keyDHGroup, const std::string& dhParamsFile)
 {
 #ifndef OPENSSL_NO_DH
@@ -69,6 +69,8 @@ const std::string SSLManager::CFG_REQUIRE_TLSV1_3("requireTLSv1_3");
 const std::string SSLManager::CFG_DISABLE_PROTOCOLS("disableProtocols");
 const std::string SSLManager::CFG_DH_PARAMS_FILE("dhParamsFile");
 const std::string SSLManager::CFG_ECDH_CURVE("ecdhCurve");
+const std::string SSLManager::CFG_KERNEL_TLS("kernelTLS");
+const std::string SSLManager::CFG_ALPN_PROTOCOLS("alpnProtocols");
 #ifdef OPENSSL_FIPS
 const std::string SSLManager::CFG_FIPS_MODE("openSSL.fips");
 const bool        SSLManager::VAL_FIPS_MODE(false);
@@ -547,6 +549,26 @@ void SSLManager::initDefaultContext(bool server)
 		else
 			_ptrDefaultClientContext->preferServerCiphers();
 	}
+
+	bool kernelTLS = config.getBool(prefix + CFG_KERNEL_TLS, false);
+	if (kernelTLS)
+	{
+		if (server)
+			_ptrDefaultServerContext->enableKernelTLS();
+		else
+			_ptrDefaultClientContext->enableKernelTLS();
+	}
+
+	std::string alpnProtocolList = config.getString(prefix + CFG_ALPN_PROTOCOLS, "");
+	Poco::StringTokenizer alpnTok(alpnProtocolList, ";,", Poco::StringTokenizer::TOK_TRIM | Poco::StringTokenizer::TOK_IGNORE_EMPTY);
+	if (alpnTok.count() > 0)
+	{
+		std::vector<std::string> alpnProtocols(alpnTok.begin(), alpnTok.end());
+		if (server)
+			_ptrDefaultServerContext->setALPNProtocols(alpnProtocols);
+		else
+			_ptrDefaultClientContext->setALPNProtocols(alpnProtocols);
+	}
 }
 
 
@@ -97,8 +97,10 @@ void SecureSocketImpl::acceptSSL()
 	* the SSL_accept(). If a client finishes all its job before server
 	* sends the tickets, SSL_accept() fails with EPIPE errno. Since we
 	* are not interested in a session resumption, we can not to send the
-	* tickets. */
-	if (1 != SSL_set_num_tickets(_pSSL, 0))
+	* tickets. If session ticket keys or an external session cache have
+	* been set up, a single ticket is sent to enable resumption. */
+	const bool resumable = _pContext->sessionTicketKeyCount() > 0 || _pContext->getSessionCache();
+	if (1 != SSL_set_num_tickets(_pSSL, resumable ? 1 : 0))
 	{
 		::BIO_free(pBIO);
 		throw SSLException("Cannot create SSL object");
@@ -192,6 +194,7 @@ void SecureSocketImpl::connectSSL(bool performHandshake)
 		{
 			int ret = ::SSL_connect(_pSSL);
 			handleError(ret);
+			if (ret == 1) _pContext->countHandshake(::SSL_session_reused(_pSSL) != 0);
 			verifyPeerCertificate();
 		}
 		else
@@ -391,6 +394,87 @@ int SecureSocketImpl::available() const
 }
 
 
+std::streamsize SecureSocketImpl::sendFile(Poco::FileInputStream& fileInputStream, std::streamoff offset, std::streamsize count)
+{
+	poco_assert (_pSocket->initialized());
+	poco_check_ptr (_pSSL);
+
+	{
+		LockT l(_mutex);
+
+		if (_needHandshake)
+		{
+			int rc = completeHandshake();
+			if (rc == 1)
+				verifyPeerCertificate();
+			else if (rc == 0)
+				throw SSLConnectionUnexpectedlyClosedException();
+			else
+				return -1;
+		}
+	}
+	if (!usesKernelTLS()) return -1;
+
+#if defined(BIO_get_ktls_send)
+	if (count == 0) count = fileInputStream.size() - offset;
+	const auto sendTimeout = _pSocket->getSendTimeout();
+	std::streamsize sent = 0;
+	while (count > 0)
+	{
+		ossl_ssize_t rc;
+		LockT l(_mutex);
+		Poco::Timestamp tsStart;
+		while (true)
+		{
+			rc = ::SSL_sendfile(_pSSL, fileInputStream.nativeHandle(), offset, static_cast<std::size_t>(count), 0);
+			if (!mustRetry(static_cast<int>(rc)))
+				break;
+
+			if (tsStart.isElapsed(sendTimeout.totalMicroseconds()))
+				throw Poco::TimeoutException();
+		}
+		if (rc <= 0)
+		{
+			int err = handleError(static_cast<int>(rc));
+			if (err == 0) throw SSLConnectionUnexpectedlyClosedException();
+			throw SSLException("SSL_sendfile() failed");
+		}
+		sent += rc;
+		offset += rc;
+		count -= rc;
+	}
+	return sent;
+#else
+	return -1;
+#endif
+}
+
+
+bool SecureSocketImpl::usesKernelTLS() const
+{
+#if defined(BIO_get_ktls_send)
+	LockT l(_mutex);
+
+	return !_needHandshake && BIO_get_ktls_send(::SSL_get_wbio(_pSSL)) == 1;
+#else
+	return false;
+#endif
+}
+
+
+std::string SecureSocketImpl::alpnProtocol() const
+{
+	LockT l(_mutex);
+
+	if (!_pSSL || _needHandshake) return std::string();
+
+	const unsigned char* pProtocol = nullptr;
+	unsigned length = 0;
+	::SSL_get0_alpn_selected(_pSSL, &pProtocol, &length);
+	return std::string(reinterpret_cast<const char*>(pProtocol), length);
+}
+
+
 int SecureSocketImpl::completeHandshake()
 {
 	poco_assert (_pSocket->initialized());
@@ -413,6 +497,7 @@ int SecureSocketImpl::completeHandshake()
 		return handleError(rc);
 	}
 	_needHandshake = false;
+	_pContext->countHandshake(::SSL_session_reused(_pSSL) != 0);
 	return rc;
 }
 
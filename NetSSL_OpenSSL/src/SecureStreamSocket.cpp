@@ -292,6 +292,18 @@ bool SecureStreamSocket::sessionWasReused()
 }
 
 
+std::string SecureStreamSocket::alpnProtocol() const
+{
+	return static_cast<const SecureStreamSocketImpl*>(impl())->alpnProtocol();
+}
+
+
+bool SecureStreamSocket::usesKernelTLS() const
+{
+	return static_cast<const SecureStreamSocketImpl*>(impl())->usesKernelTLS();
+}
+
+
 void SecureStreamSocket::abort()
 {
 	static_cast<SecureStreamSocketImpl*>(impl())->abort();
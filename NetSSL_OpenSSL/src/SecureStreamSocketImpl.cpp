@@ -145,6 +145,20 @@ void SecureStreamSocketImpl::sendUrgent(unsigned char data)
 }
 
 
+std::streamsize SecureStreamSocketImpl::sendFile(Poco::FileInputStream& fileInputStream, std::streamoff offset, std::streamsize count)
+{
+	if (!getBlocking()) throw NetException("sendFile() not supported for non-blocking sockets");
+
+	std::streamsize sent = _impl.sendFile(fileInputStream, offset, count);
+	if (sent < 0)
+	{
+		// kernel TLS not active; read and encrypt the file in user space
+		sent = StreamSocketImpl::sendFile(fileInputStream, offset, count);
+	}
+	return sent;
+}
+
+
 int SecureStreamSocketImpl::available()
 {
 	return _impl.available();
@@ -0,0 +1,62 @@
+//
+// SessionTicketKey.cpp
+//
+// Library: NetSSL_OpenSSL
+// Package: SSLCore
+// Module:  SessionTicketKey
+//
+// Copyright (c) 2006-2010, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/SessionTicketKey.h"
+#include "Poco/Net/SSLException.h"
+#include "Poco/Net/Utility.h"
+#include "Poco/Exception.h"
+#include <openssl/crypto.h>
+#include <openssl/rand.h>
+#include <cstring>
+
+
+namespace Poco {
+namespace Net {
+
+
+SessionTicketKey::SessionTicketKey()
+{
+	if (RAND_bytes(_key, KEY_SIZE) != 1)
+		throw SSLException("Cannot generate session ticket key", Utility::getLastError());
+}
+
+
+SessionTicketKey::SessionTicketKey(const std::string& key)
+{
+	if (key.size() != KEY_SIZE)
+		throw Poco::InvalidArgumentException("Session ticket key must have 80 bytes");
+
+	std::memcpy(_key, key.data(), KEY_SIZE);
+}
+
+
+SessionTicketKey::~SessionTicketKey()
+{
+	OPENSSL_cleanse(_key, KEY_SIZE);
+}
+
+
+std::string SessionTicketKey::serialize() const
+{
+	return std::string(reinterpret_cast<const char*>(_key), KEY_SIZE);
+}
+
+
+bool SessionTicketKey::hasName(const unsigned char* name) const
+{
+	return std::memcmp(_key, name, NAME_SIZE) == 0;
+}
+
+
+} } // namespace Poco::Net
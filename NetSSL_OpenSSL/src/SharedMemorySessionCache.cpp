@@ -0,0 +1,247 @@
+//
+// SharedMemorySessionCache.cpp
+//
+// Library: NetSSL_OpenSSL
+// Package: SSLCore
+// Module:  SharedMemorySessionCache
+//
+// Copyright (c) 2006-2010, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Net/SharedMemorySessionCache.h"
+#include "Poco/Exception.h"
+#include "Poco/ScopedLock.h"
+#include <openssl/ssl.h>
+#include <cstring>
+
+
+namespace Poco {
+namespace Net {
+
+
+struct SharedMemorySessionCache::Header
+{
+	Poco::UInt32 magic;
+	Poco::UInt32 version;
+	Poco::UInt64 capacity;
+	Poco::UInt64 maxSessionSize;
+};
+
+
+struct SharedMemorySessionCache::Slot
+{
+	Poco::Int64 expires;
+	Poco::UInt32 length;
+	Poco::UInt32 idLength;
+	unsigned char id[SSL_MAX_SSL_SESSION_ID_LENGTH];
+};
+
+
+namespace
+{
+	const Poco::UInt32 CACHE_MAGIC   = 0x504F5353; // "POSS"
+	const Poco::UInt32 CACHE_VERSION = 1;
+
+	std::size_t alignedSize(std::size_t size)
+	{
+		return (size + 7) & ~std::size_t(7);
+	}
+
+	Poco::UInt64 hashId(const std::string& id)
+	{
+		// FNV-1a
+		Poco::UInt64 h = 14695981039346656037ULL;
+		for (auto c: id)
+		{
+			h ^= static_cast<unsigned char>(c);
+			h *= 1099511628211ULL;
+		}
+		return h;
+	}
+}
+
+
+SharedMemorySessionCache::SharedMemorySessionCache(const std::string& name, std::size_t capacity, std::size_t maxSessionSize, bool server):
+	_capacity(capacity == 0 ? static_cast<std::size_t>(WAYS) : static_cast<std::size_t>((capacity + WAYS - 1)/WAYS*WAYS)),
+	_maxSessionSize(maxSessionSize),
+	_slotSize(alignedSize(sizeof(Slot) + maxSessionSize)),
+	_mutex(name)
+{
+	open(name, server);
+}
+
+
+SharedMemorySessionCache::~SharedMemorySessionCache()
+{
+}
+
+
+void SharedMemorySessionCache::open(const std::string& name, bool server)
+{
+	Poco::NamedMutex::ScopedLock lock(_mutex);
+
+	// Look at the header of an existing segment first. An existing
+	// segment is never resized, as this would make accesses beyond its
+	// new end fail in processes that have it mapped already.
+	bool exists = false;
+	try
+	{
+		Poco::SharedMemory header(name, sizeof(Header), Poco::SharedMemory::AM_READ, nullptr, false);
+		const Header* pHeader = reinterpret_cast<const Header*>(header.begin());
+		if (pHeader->magic != 0)
+		{
+			if (pHeader->magic != CACHE_MAGIC || pHeader->version != CACHE_VERSION)
+				throw Poco::InvalidArgumentException("Shared memory segment is not a session cache", name);
+			if (pHeader->capacity != _capacity || pHeader->maxSessionSize != _maxSessionSize)
+				throw Poco::InvalidArgumentException("Shared session cache has been created with a different capacity or maximum session size", name);
+			exists = true;
+		}
+	}
+	catch (Poco::SystemException&)
+	{
+	}
+
+	const std::size_t size = alignedSize(sizeof(Header)) + _capacity*_slotSize;
+	if (exists)
+	{
+		// only the process that has created the segment removes it
+		_memory = Poco::SharedMemory(name, size, Poco::SharedMemory::AM_WRITE, nullptr, false);
+	}
+	else if (server)
+	{
+		_memory = Poco::SharedMemory(name, size, Poco::SharedMemory::AM_WRITE, nullptr, true);
+		Header* pHeader = reinterpret_cast<Header*>(_memory.begin());
+		pHeader->magic = CACHE_MAGIC;
+		pHeader->version = CACHE_VERSION;
+		pHeader->capacity = _capacity;
+		pHeader->maxSessionSize = _maxSessionSize;
+		reset();
+	}
+	else throw Poco::NotFoundException("Shared session cache does not exist", name);
+}
+
+
+void SharedMemorySessionCache::reset()
+{
+	for (std::size_t i = 0; i < _capacity; i++)
+	{
+		Slot* pSlot = slot(i);
+		pSlot->expires = 0;
+		pSlot->length = 0;
+		pSlot->idLength = 0;
+	}
+}
+
+
+inline SharedMemorySessionCache::Slot* SharedMemorySessionCache::slot(std::size_t index) const
+{
+	return reinterpret_cast<Slot*>(_memory.begin() + alignedSize(sizeof(Header)) + index*_slotSize);
+}
+
+
+inline char* SharedMemorySessionCache::data(Slot* pSlot) const
+{
+	return reinterpret_cast<char*>(pSlot) + sizeof(Slot);
+}
+
+
+SharedMemorySessionCache::Slot* SharedMemorySessionCache::find(const std::string& id, std::size_t& first) const
+{
+	first = static_cast<std::size_t>(hashId(id) % (_capacity/WAYS))*WAYS;
+	for (std::size_t i = first; i < first + WAYS; i++)
+	{
+		Slot* pSlot = slot(i);
+		if (pSlot->idLength == id.size() && std::memcmp(pSlot->id, id.data(), id.size()) == 0)
+			return pSlot;
+	}
+	return nullptr;
+}
+
+
+void SharedMemorySessionCache::add(const std::string& id, const std::string& session, const Poco::Timestamp& expires)
+{
+	if (id.empty() || id.size() > SSL_MAX_SSL_SESSION_ID_LENGTH || session.size() > _maxSessionSize) return;
+
+	Poco::NamedMutex::ScopedLock lock(_mutex);
+
+	std::size_t first;
+	Slot* pSlot = find(id, first);
+	if (!pSlot)
+	{
+		// use a free slot, or replace the one expiring first
+		pSlot = slot(first);
+		for (std::size_t i = first + 1; i < first + WAYS && pSlot->idLength != 0; i++)
+		{
+			Slot* pCandidate = slot(i);
+			if (pCandidate->idLength == 0 || pCandidate->expires < pSlot->expires)
+				pSlot = pCandidate;
+		}
+	}
+	pSlot->expires = expires.epochTime();
+	pSlot->length = static_cast<Poco::UInt32>(session.size());
+	pSlot->idLength = static_cast<Poco::UInt32>(id.size());
+	std::memcpy(pSlot->id, id.data(), id.size());
+	std::memcpy(data(pSlot), session.data(), session.size());
+}
+
+
+bool SharedMemorySessionCache::get(const std::string& id, std::string& session)
+{
+	if (id.empty() || id.size() > SSL_MAX_SSL_SESSION_ID_LENGTH) return false;
+
+	Poco::NamedMutex::ScopedLock lock(_mutex);
+
+	std::size_t first;
+	Slot* pSlot = find(id, first);
+	if (!pSlot) return false;
+
+	if (pSlot->expires <= Poco::Timestamp().epochTime())
+	{
+		pSlot->idLength = 0;
+		return false;
+	}
+	session.assign(data(pSlot), pSlot->length);
+	return true;
+}
+
+
+void SharedMemorySessionCache::remove(const std::string& id)
+{
+	if (id.empty() || id.size() > SSL_MAX_SSL_SESSION_ID_LENGTH) return;
+
+	Poco::NamedMutex::ScopedLock lock(_mutex);
+
+	std::size_t first;
+	Slot* pSlot = find(id, first);
+	if (pSlot) pSlot->idLength = 0;
+}
+
+
+void SharedMemorySessionCache::clear()
+{
+	Poco::NamedMutex::ScopedLock lock(_mutex);
+
+	reset();
+}
+
+
+std::size_t SharedMemorySessionCache::size()
+{
+	Poco::NamedMutex::ScopedLock lock(_mutex);
+
+	const Poco::Int64 now = Poco::Timestamp().epochTime();
+	std::size_t n = 0;
+	for (std::size_t i = 0; i < _capacity; i++)
+	{
+		const Slot* pSlot = slot(i);
+		if (pSlot->idLength != 0 && pSlot->expires > now) n++;
+	}
+	return n;
+}
+
+
+} } // namespace Poco::Net
@@ -366,6 +366,124 @@ void SecureStreamSocketTest::testSendFileRange()
 }
 
 
+void SecureStreamSocketTest::testSendFileKernelTLS()
+{
+	SecureServerSocket svs(0);
+	TCPServer srv(new TCPServerConnectionFactoryImpl<CopyToStringConnection>(), svs);
+	srv.start();
+
+	Context::Ptr pContext = new Context(
+		Context::CLIENT_USE,
+		Application::instance().config().getString("openSSL.client.privateKeyFile"),
+		Application::instance().config().getString("openSSL.client.privateKeyFile"),
+		Application::instance().config().getString("openSSL.client.caConfig"),
+		Context::VERIFY_RELAXED,
+		9,
+		true,
+		"ALL:!ADH:!LOW:!EXP:!MD5:@STRENGTH");
+	assertTrue (!pContext->kernelTLSEnabled());
+	pContext->enableKernelTLS();
+#if defined(SSL_OP_ENABLE_KTLS)
+	assertTrue (pContext->kernelTLSEnabled());
+#endif
+
+	SecureStreamSocket ss(SocketAddress("127.0.0.1", srv.port()), pContext);
+
+	std::string fileData;
+
+	Poco::TemporaryFile file;
+	Poco::FileOutputStream ostr(file.path());
+	std::string data("0123456789abcdef");
+	for (int i = 0; i < 10000; i++)
+	{
+		ostr.write(data.data(), data.size());
+		fileData += data;
+	}
+	ostr.close();
+
+	const std::streamoff offset = 4000;
+	const std::streamsize count = 100000;
+
+	// Whether the kernel takes over the encryption depends on the
+	// operating system; if it does not, sendFile() must fall back
+	// to sending the file blockwise.
+	Poco::FileInputStream istr(file.path());
+	std::streamsize n = ss.sendFile(istr, offset, count);
+	assertTrue (n == count);
+	n = ss.sendFile(istr);
+	assertTrue (n == file.getSize());
+
+	istr.close();
+	ss.close();
+
+	Poco::Thread::sleep(200);
+	while (srv.currentConnections() > 0)
+	{
+		Poco::Thread::sleep(100);
+	}
+	srv.stop();
+
+	assertTrue (CopyToStringConnection::data() == fileData.substr(offset, count) + fileData);
+}
+
+
+void SecureStreamSocketTest::testALPN()
+{
+	Context::Ptr pServerContext = new Context(
+		Context::SERVER_USE,
+		Application::instance().config().getString("openSSL.server.privateKeyFile"),
+		Application::instance().config().getString("openSSL.server.privateKeyFile"),
+		Application::instance().config().getString("openSSL.server.caConfig"),
+		Context::VERIFY_NONE,
+		9,
+		true,
+		"ALL:!ADH:!LOW:!EXP:!MD5:@STRENGTH");
+	pServerContext->setALPNProtocols({"h2", "http/1.1"});
+	assertTrue (pServerContext->getALPNProtocols().size() == 2);
+
+	SecureServerSocket svs(0, 64, pServerContext);
+	TCPServer srv(new TCPServerConnectionFactoryImpl<EchoConnection>(), svs);
+	srv.start();
+
+	std::vector<std::vector<std::string>> offers = {{"http/1.1"}, {"h2", "http/1.1"}, {"spdy/3"}, {}};
+	std::vector<std::string> expected = {"http/1.1", "h2", "", ""};
+	for (std::size_t i = 0; i < offers.size(); i++)
+	{
+		Context::Ptr pClientContext = new Context(
+			Context::CLIENT_USE,
+			Application::instance().config().getString("openSSL.client.privateKeyFile"),
+			Application::instance().config().getString("openSSL.client.privateKeyFile"),
+			Application::instance().config().getString("openSSL.client.caConfig"),
+			Context::VERIFY_RELAXED,
+			9,
+			true,
+			"ALL:!ADH:!LOW:!EXP:!MD5:@STRENGTH");
+		if (!offers[i].empty()) pClientContext->setALPNProtocols(offers[i]);
+
+		SecureStreamSocket ss(SocketAddress("127.0.0.1", srv.port()), pClientContext);
+		int n = ss.sendBytes("hello", 5);
+		assertTrue (n == 5);
+		char buffer[256];
+		n = ss.receiveBytes(buffer, sizeof(buffer));
+		assertTrue (n == 5);
+		assertTrue (std::string(buffer, n) == "hello");
+		assertTrue (ss.alpnProtocol() == expected[i]);
+		ss.close();
+	}
+
+	try
+	{
+		pServerContext->setALPNProtocols({""});
+		fail("empty protocol name - must throw");
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
+
+	srv.stop();
+}
+
+
 void SecureStreamSocketTest::setUp()
 {
 }
@@ -386,6 +504,8 @@ CppUnit::Test* SecureStreamSocketTest::suite()
 	CppUnit_addTest(pSuite, SecureStreamSocketTest, testSendFile);
 	CppUnit_addTest(pSuite, SecureStreamSocketTest, testSendFileLarge);
 	CppUnit_addTest(pSuite, SecureStreamSocketTest, testSendFileRange);
+	CppUnit_addTest(pSuite, SecureStreamSocketTest, testSendFileKernelTLS);
+	CppUnit_addTest(pSuite, SecureStreamSocketTest, testALPN);
 
 	return pSuite;
 }
@@ -30,6 +30,8 @@ public:
 	void testSendFile();
 	void testSendFileLarge();
 	void testSendFileRange();
+	void testSendFileKernelTLS();
+	void testALPN();
 
 	void setUp();
 	void tearDown();
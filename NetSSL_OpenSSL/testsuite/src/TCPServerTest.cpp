@@ -21,6 +21,8 @@
 #include "Poco/Net/RejectCertificateHandler.h"
 #include "Poco/Net/AcceptCertificateHandler.h"
 #include "Poco/Net/Session.h"
+#include "Poco/Net/SessionTicketKey.h"
+#include "Poco/Net/SharedMemorySessionCache.h"
 #include "Poco/Net/SSLManager.h"
 #include "Poco/Util/Application.h"
 #include "Poco/Util/AbstractConfiguration.h"
@@ -40,6 +42,9 @@ using Poco::Net::SecureServerSocket;
 using Poco::Net::SocketAddress;
 using Poco::Net::Context;
 using Poco::Net::Session;
+using Poco::Net::SessionTicketKey;
+using Poco::Net::SessionCache;
+using Poco::Net::SharedMemorySessionCache;
 using Poco::Net::SSLManager;
 using Poco::Thread;
 using Poco::Util::Application;
@@ -413,6 +418,281 @@ void TCPServerTest::testReuseSession()
 }
 
 
+void TCPServerTest::testSessionTickets()
+{
+	// ensure OpenSSL machinery is fully setup
+	Context::Ptr pDefaultServerContext = SSLManager::instance().defaultServerContext();
+	Context::Ptr pDefaultClientContext = SSLManager::instance().defaultClientContext();
+
+	// two servers sharing their ticket keys, e.g. behind a load balancer
+	SessionTicketKey key1;
+	SessionTicketKey key2;
+	std::vector<SessionTicketKey> keys(1, key1);
+
+	Context::Ptr pServerContext1 = new Context(
+		Context::SERVER_USE,
+		Application::instance().config().getString("openSSL.server.privateKeyFile"),
+		Application::instance().config().getString("openSSL.server.privateKeyFile"),
+		Application::instance().config().getString("openSSL.server.caConfig"),
+		Context::VERIFY_NONE,
+		9,
+		true,
+		"ALL:!ADH:!LOW:!EXP:!MD5:@STRENGTH");
+	pServerContext1->disableProtocols(Context::PROTO_TLSV1_3);
+	pServerContext1->setSessionTicketKeys(keys);
+
+	Context::Ptr pServerContext2 = new Context(
+		Context::SERVER_USE,
+		Application::instance().config().getString("openSSL.server.privateKeyFile"),
+		Application::instance().config().getString("openSSL.server.privateKeyFile"),
+		Application::instance().config().getString("openSSL.server.caConfig"),
+		Context::VERIFY_NONE,
+		9,
+		true,
+		"ALL:!ADH:!LOW:!EXP:!MD5:@STRENGTH");
+	pServerContext2->disableProtocols(Context::PROTO_TLSV1_3);
+	pServerContext2->setSessionTicketKeys(keys);
+
+	SecureServerSocket svs1(0, 64, pServerContext1);
+	TCPServer srv1(new TCPServerConnectionFactoryImpl<EchoConnection>(), svs1);
+	srv1.start();
+	SecureServerSocket svs2(0, 64, pServerContext2);
+	TCPServer srv2(new TCPServerConnectionFactoryImpl<EchoConnection>(), svs2);
+	srv2.start();
+
+	Context::Ptr pClientContext = new Context(
+		Context::CLIENT_USE,
+		Application::instance().config().getString("openSSL.client.privateKeyFile"),
+		Application::instance().config().getString("openSSL.client.privateKeyFile"),
+		Application::instance().config().getString("openSSL.client.caConfig"),
+		Context::VERIFY_RELAXED,
+		9,
+		true,
+		"ALL:!ADH:!LOW:!EXP:!MD5:@STRENGTH");
+	pClientContext->enableSessionCache(true);
+
+	SocketAddress sa1("127.0.0.1", svs1.address().port());
+	SocketAddress sa2("127.0.0.1", svs2.address().port());
+	std::string data("hello, world");
+	char buffer[256];
+
+	SecureStreamSocket ss1(sa1, pClientContext);
+	ss1.sendBytes(data.data(), (int) data.size());
+	int n = ss1.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (std::string(buffer, n) == data);
+	assertTrue (!ss1.sessionWasReused());
+	assertTrue (pServerContext1->fullHandshakes() == 1);
+	assertTrue (pServerContext1->resumedHandshakes() == 0);
+
+	Session::Ptr pSession = ss1.currentSession();
+	if (!pSession || !pSession->isResumable())
+	{
+		std::cerr << "WARNING: Server did not return a session or session is not resumable. Aborting test." << std::endl;
+		return;
+	}
+	ss1.close();
+
+	// the ticket issued by the first server is accepted by the second one
+	ss1.useSession(pSession);
+	ss1.connect(sa2);
+	ss1.sendBytes(data.data(), (int) data.size());
+	n = ss1.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (std::string(buffer, n) == data);
+	assertTrue (ss1.sessionWasReused());
+	assertTrue (pServerContext2->fullHandshakes() == 0);
+	assertTrue (pServerContext2->resumedHandshakes() == 1);
+	assertTrue (pClientContext->fullHandshakes() == 1);
+	assertTrue (pClientContext->resumedHandshakes() == 1);
+	ss1.close();
+
+	// after rotation, tickets encrypted with the previous key are still accepted
+	pServerContext2->rotateSessionTicketKey(key2);
+	assertTrue (pServerContext2->sessionTicketKeyCount() == 2);
+	ss1.useSession(pSession);
+	ss1.connect(sa2);
+	ss1.sendBytes(data.data(), (int) data.size());
+	n = ss1.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (std::string(buffer, n) == data);
+	assertTrue (ss1.sessionWasReused());
+	assertTrue (pServerContext2->resumedHandshakes() == 2);
+	ss1.close();
+
+	// once the previous key has been discarded, a full handshake is required
+	pServerContext2->rotateSessionTicketKey(SessionTicketKey(), 1);
+	assertTrue (pServerContext2->sessionTicketKeyCount() == 1);
+	ss1.useSession(pSession);
+	ss1.connect(sa2);
+	ss1.sendBytes(data.data(), (int) data.size());
+	n = ss1.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (std::string(buffer, n) == data);
+	assertTrue (!ss1.sessionWasReused());
+	assertTrue (pServerContext2->fullHandshakes() == 1);
+	ss1.close();
+
+	pServerContext2->resetHandshakeCounters();
+	assertTrue (pServerContext2->fullHandshakes() == 0);
+	assertTrue (pServerContext2->resumedHandshakes() == 0);
+
+	SessionTicketKey key3(key1.serialize());
+	assertTrue (key3.hasName(key1.name()));
+	assertTrue (!key3.hasName(key2.name()));
+
+	srv1.stop();
+	srv2.stop();
+}
+
+
+void TCPServerTest::testSharedSessionCache()
+{
+	// ensure OpenSSL machinery is fully setup
+	Context::Ptr pDefaultServerContext = SSLManager::instance().defaultServerContext();
+	Context::Ptr pDefaultClientContext = SSLManager::instance().defaultClientContext();
+
+	Poco::SharedPtr<SharedMemorySessionCache> pCache1 = new SharedMemorySessionCache("PocoNetSSLTestSessionCache", 64);
+	Poco::SharedPtr<SharedMemorySessionCache> pCache2 = new SharedMemorySessionCache("PocoNetSSLTestSessionCache", 64, SharedMemorySessionCache::DEFAULT_MAX_SESSION_SIZE, false);
+	assertTrue (pCache1->capacity() == 64);
+	assertTrue (pCache1->size() == 0);
+
+	try
+	{
+		SharedMemorySessionCache cache("PocoNetSSLTestSessionCache", 64, 1024, false);
+		fail("cache geometry mismatch - must throw");
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
+
+	// a server does not resize an existing segment
+	try
+	{
+		SharedMemorySessionCache cache("PocoNetSSLTestSessionCache", 128);
+		fail("cache geometry mismatch - must throw");
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
+
+	try
+	{
+		SharedMemorySessionCache cache("PocoNetSSLTestNoSessionCache", 64, SharedMemorySessionCache::DEFAULT_MAX_SESSION_SIZE, false);
+		fail("no such cache - must throw");
+	}
+	catch (Poco::NotFoundException&)
+	{
+	}
+
+	// only the server that has created the segment removes it
+	{
+		SharedMemorySessionCache cache("PocoNetSSLTestSessionCache", 64);
+	}
+	SharedMemorySessionCache cache3("PocoNetSSLTestSessionCache", 64, SharedMemorySessionCache::DEFAULT_MAX_SESSION_SIZE, false);
+
+	// both "processes" share the same cache
+	pCache1->add("session1", "data1", Poco::Timestamp() + 10*Poco::Timestamp::resolution());
+	pCache1->add("session2", "data2", Poco::Timestamp() - Poco::Timestamp::resolution());
+	std::string session;
+	assertTrue (pCache2->get("session1", session));
+	assertTrue (session == "data1");
+	assertTrue (cache3.get("session1", session));
+	assertTrue (session == "data1");
+	assertTrue (!pCache2->get("session2", session));
+	assertTrue (!pCache2->get("session3", session));
+	pCache2->remove("session1");
+	assertTrue (!pCache1->get("session1", session));
+	assertTrue (pCache1->size() == 0);
+
+	Context::Ptr pServerContext1 = new Context(
+		Context::SERVER_USE,
+		Application::instance().config().getString("openSSL.server.privateKeyFile"),
+		Application::instance().config().getString("openSSL.server.privateKeyFile"),
+		Application::instance().config().getString("openSSL.server.caConfig"),
+		Context::VERIFY_NONE,
+		9,
+		true,
+		"ALL:!ADH:!LOW:!EXP:!MD5:@STRENGTH");
+	pServerContext1->disableProtocols(Context::PROTO_TLSV1_3);
+	pServerContext1->disableStatelessSessionResumption();
+	pServerContext1->enableSessionCache(true, "TestSuite");
+	pServerContext1->setSessionCache(pCache1);
+
+	Context::Ptr pServerContext2 = new Context(
+		Context::SERVER_USE,
+		Application::instance().config().getString("openSSL.server.privateKeyFile"),
+		Application::instance().config().getString("openSSL.server.privateKeyFile"),
+		Application::instance().config().getString("openSSL.server.caConfig"),
+		Context::VERIFY_NONE,
+		9,
+		true,
+		"ALL:!ADH:!LOW:!EXP:!MD5:@STRENGTH");
+	pServerContext2->disableProtocols(Context::PROTO_TLSV1_3);
+	pServerContext2->disableStatelessSessionResumption();
+	pServerContext2->enableSessionCache(true, "TestSuite");
+	pServerContext2->setSessionCache(pCache2);
+
+	SecureServerSocket svs1(0, 64, pServerContext1);
+	TCPServer srv1(new TCPServerConnectionFactoryImpl<EchoConnection>(), svs1);
+	srv1.start();
+	SecureServerSocket svs2(0, 64, pServerContext2);
+	TCPServer srv2(new TCPServerConnectionFactoryImpl<EchoConnection>(), svs2);
+	srv2.start();
+
+	Context::Ptr pClientContext = new Context(
+		Context::CLIENT_USE,
+		Application::instance().config().getString("openSSL.client.privateKeyFile"),
+		Application::instance().config().getString("openSSL.client.privateKeyFile"),
+		Application::instance().config().getString("openSSL.client.caConfig"),
+		Context::VERIFY_RELAXED,
+		9,
+		true,
+		"ALL:!ADH:!LOW:!EXP:!MD5:@STRENGTH");
+	pClientContext->enableSessionCache(true);
+
+	SocketAddress sa1("127.0.0.1", svs1.address().port());
+	SocketAddress sa2("127.0.0.1", svs2.address().port());
+	std::string data("hello, world");
+	char buffer[256];
+
+	SecureStreamSocket ss1(sa1, pClientContext);
+	ss1.sendBytes(data.data(), (int) data.size());
+	int n = ss1.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (std::string(buffer, n) == data);
+	assertTrue (!ss1.sessionWasReused());
+	assertTrue (pServerContext1->fullHandshakes() == 1);
+
+	Session::Ptr pSession = ss1.currentSession();
+	if (!pSession || !pSession->isResumable())
+	{
+		std::cerr << "WARNING: Server did not return a session or session is not resumable. Aborting test." << std::endl;
+		return;
+	}
+	ss1.close();
+	assertTrue (pCache2->size() == 1);
+
+	// the session created by the first server is resumed by the second one
+	ss1.useSession(pSession);
+	ss1.connect(sa2);
+	ss1.sendBytes(data.data(), (int) data.size());
+	n = ss1.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (std::string(buffer, n) == data);
+	assertTrue (ss1.sessionWasReused());
+	assertTrue (pServerContext2->resumedHandshakes() == 1);
+	ss1.close();
+
+	pCache1->clear();
+	ss1.useSession(pSession);
+	ss1.connect(sa2);
+	ss1.sendBytes(data.data(), (int) data.size());
+	n = ss1.receiveBytes(buffer, sizeof(buffer));
+	assertTrue (std::string(buffer, n) == data);
+	assertTrue (!ss1.sessionWasReused());
+	assertTrue (pServerContext2->fullHandshakes() == 1);
+	ss1.close();
+
+	srv1.stop();
+	srv2.stop();
+}
+
+
 void TCPServerTest::testContextInvalidCertificateHandler()
 {
 	SecureServerSocket svs(0);
@@ -476,6 +756,8 @@ CppUnit::Test* TCPServerTest::suite()
 	CppUnit_addTest(pSuite, TCPServerTest, testMultiConnections);
 	CppUnit_addTest(pSuite, TCPServerTest, testReuseSocket);
 	CppUnit_addTest(pSuite, TCPServerTest, testReuseSession);
+	CppUnit_addTest(pSuite, TCPServerTest, testSessionTickets);
+	CppUnit_addTest(pSuite, TCPServerTest, testSharedSessionCache);
 	CppUnit_addTest(pSuite, TCPServerTest, testContextInvalidCertificateHandler);
 
 	return pSuite;
@@ -29,6 +29,8 @@ public:
 	void testMultiConnections();
 	void testReuseSocket();
 	void testReuseSession();
+	void testSessionTickets();
+	void testSharedSessionCache();
 	void testContextInvalidCertificateHandler();
 
 	void setUp();
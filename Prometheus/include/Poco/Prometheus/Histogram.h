@@ -19,8 +19,10 @@
 
 
 #include "Poco/Prometheus/LabeledMetricImpl.h"
+#include "Poco/Prometheus/AtomicFloat.h"
 #include "Poco/Clock.h"
 #include "Poco/Mutex.h"
+#include <atomic>
 #include <vector>
 
 
@@ -42,11 +44,34 @@ struct Prometheus_API HistogramData
 
 
 class Prometheus_API HistogramSample
+	/// The sample of a Histogram.
+	///
+	/// Observations do not acquire a lock. Bucket counters and the
+	/// sum are kept in a number of cache line aligned stripes,
+	/// and every thread updates the stripe it has been assigned
+	/// to using relaxed atomic operations. The stripes are merged
+	/// when data() is called, i.e., at scrape time.
+	///
+	/// The bucket for an observed value is found with a binary search
+	/// over the upper bounds. If the histogram uses the exponential
+	/// layout (see Histogram::nativeBuckets()), the bucket index
+	/// is computed directly from the value.
 {
 public:
+	enum
+	{
+		NO_SCHEMA = 0x7FFF
+			/// Schema value for histograms with explicitly given bucket bounds.
+	};
+
 	explicit HistogramSample(const std::vector<double>& bucketBounds);
 		/// Creates the HistogramSample.
 
+	HistogramSample(const std::vector<double>& bucketBounds, int schema);
+		/// Creates the HistogramSample for bucket bounds using the
+		/// exponential layout with the given schema (see Histogram::nativeBuckets()),
+		/// or NO_SCHEMA.
+
 	~HistogramSample() = default;
 		/// Destroys the HistogramSample.
 
@@ -63,16 +88,49 @@ public:
 
 	HistogramData data() const;
 		/// Returns the histogram's data.
+		///
+		/// The bucket counts and the total count are always consistent
+		/// with each other. As observations are not serialized, the sum
+		/// may include observations made while data() runs that are not
+		/// yet reflected in the counts.
 
 	const std::vector<double>& bucketBounds() const;
 		/// Returns the buckets upper bounds;
 
+	std::size_t bucketIndex(double value) const;
+		/// Returns the index of the bucket the given value belongs to.
+		/// Returns bucketBounds().size() for the implicit +Inf bucket.
+
 private:
+	enum
+	{
+		CACHE_LINE_SIZE = 64,
+		COUNTERS_PER_LINE = CACHE_LINE_SIZE/sizeof(Poco::UInt64),
+		MAX_STRIPES = 16
+	};
+
+	struct alignas(CACHE_LINE_SIZE) CounterLine
+	{
+		std::atomic<Poco::UInt64> counters[COUNTERS_PER_LINE];
+	};
+
+	struct alignas(CACHE_LINE_SIZE) SumLine
+	{
+		AtomicFloat<double> sum;
+	};
+
+	std::atomic<Poco::UInt64>& counter(std::size_t stripe, std::size_t bucket);
+	const std::atomic<Poco::UInt64>& counter(std::size_t stripe, std::size_t bucket) const;
+	static std::size_t stripeCount();
+	static std::size_t threadStripe();
+
 	const std::vector<double>& _bucketBounds;
-	std::vector<Poco::UInt64> _bucketCounts;
-	Poco::UInt64 _count = 0;
-	double _sum = 0.0;
-	mutable Poco::FastMutex _mutex;
+	const int _schema;
+	int _minKey;
+	std::size_t _stripeMask;
+	std::size_t _linesPerStripe;
+	std::vector<CounterLine> _counters;
+	std::vector<SumLine> _sums;
 
 	HistogramSample() = delete;
 	HistogramSample(const HistogramSample&) = delete;
@@ -105,8 +163,28 @@ class Prometheus_API Histogram: public LabeledMetricImpl<HistogramSample>
 	///
 	/// To observe a value with a Histogram (without labels):
 	///     simpleHistogram.observe(1.5);
+	///
+	/// Instead of giving the bucket bounds explicitly, the helpers
+	/// linearBuckets() and exponentialBuckets() can be used to
+	/// generate them. Alternatively, nativeBuckets() sets up an
+	/// exponential layout similar to Prometheus native histograms,
+	/// where each bucket bound is the previous one multiplied by
+	/// 2^(2^-schema). With that layout, finding the bucket
+	/// for an observation does not require a search.
+	///
+	/// Observing values does not acquire a lock. See HistogramSample
+	/// for details. For a Histogram without labels, the sample is
+	/// created on the first observation and kept, so that observe()
+	/// does not need to look up the sample.
 {
 public:
+	enum
+	{
+		MIN_SCHEMA = -4,
+		MAX_SCHEMA = 8,
+		MAX_NATIVE_BUCKETS = 4096
+	};
+
 	struct Params
 	{
 		std::string help;
@@ -157,12 +235,45 @@ public:
 		/// Must only be set once, immediately after creating
 		/// the Histogram.
 
+	Histogram& nativeBuckets(int schema, double min, double max);
+		/// Sets up an exponential bucket layout with the given schema,
+		/// similar to the layout of Prometheus native histograms.
+		///
+		/// The bucket upper bounds are the powers of 2^(2^-schema)
+		/// covering the range from min to max. Schema must be in range
+		/// MIN_SCHEMA (factor 65536 between buckets) to MAX_SCHEMA (factor
+		/// approximately 1.0027), min must be greater than zero, and
+		/// the layout must not exceed MAX_NATIVE_BUCKETS buckets.
+		/// Throws a Poco::InvalidArgumentException otherwise.
+		///
+		/// Must only be set once, immediately after creating
+		/// the Histogram.
+
 	const std::vector<double> buckets() const;
 		/// Returns the configured bucket upper bounds.
 
+	int schema() const;
+		/// Returns the schema if the exponential layout set up with
+		/// nativeBuckets() is used, otherwise HistogramSample::NO_SCHEMA.
+
+	static std::vector<double> linearBuckets(double start, double width, int count);
+		/// Returns count bucket upper bounds, with the lowest
+		/// being start and each following bound being width
+		/// larger than the previous one.
+
+	static std::vector<double> exponentialBuckets(double start, double factor, int count);
+		/// Returns count bucket upper bounds, with the lowest
+		/// being start and each following bound being the
+		/// previous one multiplied by factor.
+		///
+		/// Start must be greater than zero, and factor must be
+		/// greater than one.
+
 	void observe(double value);
 		/// Observes the given amount, by increasing the count
 		/// in the respective bucket.
+		///
+		/// Can only be used if no labels have been defined.
 
 	void observe(Poco::Clock::ClockVal v);
 		/// Converts the given Clock time in microseconds to
@@ -173,6 +284,8 @@ public:
 
 	HistogramData data() const;
 		/// Returns the histogram's data.
+		///
+		/// Can only be used if no labels have been defined.
 
 	// LabeledMetricImpl
 	std::unique_ptr<HistogramSample> createSample() const override;
@@ -181,7 +294,13 @@ public:
 	void exportTo(Exporter& exporter) const override;
 
 private:
+	HistogramSample& sample() const;
+	HistogramSample& createUnlabeledSample() const;
+
 	std::vector<double> _bucketBounds;
+	int _schema = HistogramSample::NO_SCHEMA;
+	mutable std::atomic<HistogramSample*> _pSample{nullptr};
+	mutable std::unique_ptr<HistogramSample> _pUniqueSample;
 	mutable Poco::FastMutex _mutex;
 };
 
@@ -197,16 +316,15 @@ inline const std::vector<double>& HistogramSample::bucketBounds() const
 }
 
 
-inline HistogramData HistogramSample::data() const
+inline std::atomic<Poco::UInt64>& HistogramSample::counter(std::size_t stripe, std::size_t bucket)
 {
-	Poco::FastMutex::ScopedLock lock(_mutex);
+	return _counters[stripe*_linesPerStripe + bucket/COUNTERS_PER_LINE].counters[bucket % COUNTERS_PER_LINE];
+}
 
-	HistogramData data;
-	data.bucketCounts = _bucketCounts;
-	data.count = _count;
-	data.sum = _sum;
 
-	return data;
+inline const std::atomic<Poco::UInt64>& HistogramSample::counter(std::size_t stripe, std::size_t bucket) const
+{
+	return _counters[stripe*_linesPerStripe + bucket/COUNTERS_PER_LINE].counters[bucket % COUNTERS_PER_LINE];
 }
 
 
@@ -230,7 +348,21 @@ inline const std::vector<double> Histogram::buckets() const
 }
 
 
+inline int Histogram::schema() const
+{
+	return _schema;
+}
+
+
+inline HistogramSample& Histogram::sample() const
+{
+	HistogramSample* pSample = _pSample.load(std::memory_order_acquire);
+	if (pSample) return *pSample;
+	else return createUnlabeledSample();
+}
+
+
 } } // namespace Poco::Prometheus
 
 
-#endif // Prometheus_Gauge_INCLUDED
+#endif // Prometheus_Histogram_INCLUDED
@@ -16,6 +16,10 @@
 #include "Poco/Prometheus/Gauge.h"
 #include "Poco/Prometheus/Exporter.h"
 #include "Poco/NumberFormatter.h"
+#include "Poco/Environment.h"
+#include "Poco/Exception.h"
+#include <algorithm>
+#include <cmath>
 
 using namespace std::string_literals;
 
@@ -25,26 +29,113 @@ namespace Prometheus {
 
 
 HistogramSample::HistogramSample(const std::vector<double>& bucketBounds):
+	HistogramSample(bucketBounds, NO_SCHEMA)
+{
+}
+
+
+HistogramSample::HistogramSample(const std::vector<double>& bucketBounds, int schema):
 	_bucketBounds(bucketBounds),
-	_bucketCounts(bucketBounds.size(), 0)
+	_schema(schema),
+	_minKey(0),
+	_stripeMask(stripeCount() - 1),
+	_linesPerStripe((bucketBounds.size() + COUNTERS_PER_LINE)/COUNTERS_PER_LINE),
+	_counters(stripeCount()*_linesPerStripe),
+	_sums(stripeCount())
 {
+	for (auto& line: _counters)
+	{
+		for (auto& c: line.counters)
+		{
+			c.store(0, std::memory_order_relaxed);
+		}
+	}
+	if (_schema != NO_SCHEMA && !_bucketBounds.empty())
+	{
+		_minKey = static_cast<int>(std::lround(std::ldexp(std::log2(_bucketBounds.front()), _schema)));
+	}
 }
 
 
 void HistogramSample::observe(double value)
 {
-	Poco::FastMutex::ScopedLock lock(_mutex);
+	const std::size_t stripe = threadStripe() & _stripeMask;
+	counter(stripe, bucketIndex(value)).fetch_add(1, std::memory_order_relaxed);
+	_sums[stripe].sum += value;
+}
+
+
+std::size_t HistogramSample::bucketIndex(double value) const
+{
+	const std::size_t n = _bucketBounds.size();
+	if (n == 0 || !(value <= _bucketBounds.back())) return n; // also catches NaN
+	if (value <= _bucketBounds.front()) return 0;
+
+	if (_schema != NO_SCHEMA)
+	{
+		// The upper bound of bucket key k is 2^(k*2^-schema), so the key
+		// for value is ceil(log2(value)*2^schema). Correct for rounding
+		// errors in log2() for values very close to a bound.
+		const int key = static_cast<int>(std::ceil(std::ldexp(std::log2(value), _schema)));
+		std::size_t i = static_cast<std::size_t>(std::min(std::max(key - _minKey, 0), static_cast<int>(n - 1)));
+		if (value > _bucketBounds[i]) ++i;
+		else if (i > 0 && value <= _bucketBounds[i - 1]) --i;
+		return i;
+	}
+	else
+	{
+		return static_cast<std::size_t>(std::lower_bound(_bucketBounds.begin(), _bucketBounds.end(), value) - _bucketBounds.begin());
+	}
+}
 
+
+HistogramData HistogramSample::data() const
+{
 	const std::size_t n = _bucketBounds.size();
-	for (std::size_t i = 0; i < n; i++)
+	const std::size_t stripes = _stripeMask + 1;
+
+	HistogramData data;
+	data.bucketCounts.resize(n, 0);
+	data.count = 0;
+	data.sum = 0.0;
+	for (std::size_t s = 0; s < stripes; s++)
 	{
-		if (value <= _bucketBounds[i])
+		data.sum += _sums[s].sum.value();
+	}
+
+	Poco::UInt64 cumulative = 0;
+	for (std::size_t i = 0; i <= n; i++)
+	{
+		for (std::size_t s = 0; s < stripes; s++)
 		{
-			_bucketCounts[i]++;
+			cumulative += counter(s, i).load(std::memory_order_relaxed);
 		}
+		if (i < n) data.bucketCounts[i] = cumulative;
 	}
-	_sum += value;
-	_count++;
+	data.count = cumulative;
+
+	return data;
+}
+
+
+std::size_t HistogramSample::stripeCount()
+{
+	static const std::size_t count = []()
+	{
+		std::size_t n = 1;
+		const std::size_t cpus = Poco::Environment::processorCount();
+		while (n < cpus && n < MAX_STRIPES) n <<= 1;
+		return n;
+	}();
+	return count;
+}
+
+
+std::size_t HistogramSample::threadStripe()
+{
+	static std::atomic<std::size_t> nextStripe(0);
+	thread_local const std::size_t stripe = nextStripe.fetch_add(1, std::memory_order_relaxed);
+	return stripe;
 }
 
 
@@ -87,31 +178,106 @@ Histogram::Histogram(const std::string& name, const Params& params, Registry* pR
 Histogram& Histogram::buckets(const std::vector<double>& bucketBounds)
 {
 	_bucketBounds = bucketBounds;
+	_schema = HistogramSample::NO_SCHEMA;
 	return *this;
 }
 
 
+Histogram& Histogram::nativeBuckets(int schema, double min, double max)
+{
+	if (schema < MIN_SCHEMA || schema > MAX_SCHEMA) throw Poco::InvalidArgumentException("Histogram schema out of range"s);
+	if (!(min > 0.0) || !(max >= min)) throw Poco::InvalidArgumentException("Invalid histogram range"s);
+
+	const int minKey = static_cast<int>(std::floor(std::ldexp(std::log2(min), schema)));
+	const int maxKey = static_cast<int>(std::ceil(std::ldexp(std::log2(max), schema)));
+	if (maxKey - minKey + 1 > MAX_NATIVE_BUCKETS) throw Poco::InvalidArgumentException("Too many histogram buckets"s);
+
+	std::vector<double> bounds;
+	bounds.reserve(maxKey - minKey + 1);
+	for (int key = minKey; key <= maxKey; key++)
+	{
+		bounds.push_back(std::exp2(std::ldexp(static_cast<double>(key), -schema)));
+	}
+	_bucketBounds.swap(bounds);
+	_schema = schema;
+	return *this;
+}
+
+
+std::vector<double> Histogram::linearBuckets(double start, double width, int count)
+{
+	if (count < 1) throw Poco::InvalidArgumentException("Histogram bucket count must be at least 1"s);
+	if (!(width > 0.0)) throw Poco::InvalidArgumentException("Histogram bucket width must be greater than zero"s);
+
+	std::vector<double> bounds;
+	bounds.reserve(count);
+	for (int i = 0; i < count; i++)
+	{
+		bounds.push_back(start + i*width);
+	}
+	return bounds;
+}
+
+
+std::vector<double> Histogram::exponentialBuckets(double start, double factor, int count)
+{
+	if (count < 1) throw Poco::InvalidArgumentException("Histogram bucket count must be at least 1"s);
+	if (!(start > 0.0)) throw Poco::InvalidArgumentException("Histogram bucket start must be greater than zero"s);
+	if (!(factor > 1.0)) throw Poco::InvalidArgumentException("Histogram bucket factor must be greater than one"s);
+
+	std::vector<double> bounds;
+	bounds.reserve(count);
+	double bound = start;
+	for (int i = 0; i < count; i++)
+	{
+		bounds.push_back(bound);
+		bound *= factor;
+	}
+	return bounds;
+}
+
+
 void Histogram::observe(double value)
 {
-	labels(EMPTY_LABEL).observe(value);
+	sample().observe(value);
 }
 
 
 void Histogram::observe(Poco::Clock::ClockVal v)
 {
-	labels(EMPTY_LABEL).observe(double(v)/Poco::Clock::resolution());
+	sample().observe(double(v)/Poco::Clock::resolution());
 }
 
 
 HistogramData Histogram::data() const
 {
-	return labels(EMPTY_LABEL).data();
+	return sample().data();
+}
+
+
+HistogramSample& Histogram::createUnlabeledSample() const
+{
+	// The sample cannot be created in the constructor, as
+	// the buckets may still be changed after construction.
+	if (!labelNames().empty())
+		throw Poco::InvalidArgumentException(Poco::format("Metric %s requires label values for %s"s, name(), Poco::cat(", "s, labelNames().begin(), labelNames().end())));
+
+	Poco::FastMutex::ScopedLock lock(_mutex);
+
+	HistogramSample* pSample = _pSample.load(std::memory_order_relaxed);
+	if (!pSample)
+	{
+		_pUniqueSample = createSample();
+		pSample = _pUniqueSample.get();
+		_pSample.store(pSample, std::memory_order_release);
+	}
+	return *pSample;
 }
 
 
 std::unique_ptr<HistogramSample> Histogram::createSample() const
 {
-	return std::make_unique<HistogramSample>(_bucketBounds);
+	return std::make_unique<HistogramSample>(_bucketBounds, _schema);
 }
 
 
@@ -127,24 +293,32 @@ void Histogram::exportTo(Exporter& exporter) const
 	std::vector<std::string> bucketLabels = labelNames();
 	bucketLabels.push_back("le"s);
 	const std::size_t n = _bucketBounds.size();
-	forEach<HistogramSample>(
-		[&](const std::vector<std::string>& labelValues, const HistogramSample& sample)
+	auto writeSample = [&](const std::vector<std::string>& labelValues, const HistogramSample& sample)
+	{
+		std::vector<std::string> bucketLabelValues = labelValues;
+		bucketLabelValues.push_back(""s);
+		const HistogramData data = sample.data();
+		for (std::size_t i = 0; i < n; i++)
 		{
-			std::vector<std::string> bucketLabelValues = labelValues;
-			bucketLabelValues.push_back(""s);
-			const HistogramData data = sample.data();
-			for (std::size_t i = 0; i < n; i++)
-			{
-				bucketLabelValues.back() = Poco::NumberFormatter::format(_bucketBounds[i]);
-
-				exporter.writeSample(bucket, bucketLabels, bucketLabelValues, data.bucketCounts[i]);
-			}
-			bucketLabelValues.back() = "+Inf"s;
-			exporter.writeSample(bucket, bucketLabels, bucketLabelValues, data.count);
-			exporter.writeSample(sum, labelNames(), labelValues, data.sum);
-			exporter.writeSample(count, labelNames(), labelValues, data.count);
+			bucketLabelValues.back() = Poco::NumberFormatter::format(_bucketBounds[i]);
+
+			exporter.writeSample(bucket, bucketLabels, bucketLabelValues, data.bucketCounts[i]);
 		}
-	);
+		bucketLabelValues.back() = "+Inf"s;
+		exporter.writeSample(bucket, bucketLabels, bucketLabelValues, data.count);
+		exporter.writeSample(sum, labelNames(), labelValues, data.sum);
+		exporter.writeSample(count, labelNames(), labelValues, data.count);
+	};
+
+	if (labelNames().empty())
+	{
+		const HistogramSample* pSample = _pSample.load(std::memory_order_acquire);
+		if (pSample) writeSample(EMPTY_LABEL, *pSample);
+	}
+	else
+	{
+		forEach<HistogramSample>(writeSample);
+	}
 }
 
 
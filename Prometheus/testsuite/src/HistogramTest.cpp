@@ -15,7 +15,11 @@
 #include "Poco/Prometheus/Registry.h"
 #include "Poco/Prometheus/TextExporter.h"
 #include "Poco/Exception.h"
+#include "Poco/Thread.h"
+#include "Poco/Runnable.h"
 #include <sstream>
+#include <algorithm>
+#include <cmath>
 
 
 using namespace Poco::Prometheus;
@@ -95,6 +99,15 @@ void HistogramTest::testLabels()
 
 	assertEqual(2, data2.count);
 	assertEqualDelta(8.0, data2.sum, 0.001);
+
+	try
+	{
+		histo.observe(1.0);
+		fail("histogram has labels - must throw"s);
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
 }
 
 
@@ -154,6 +167,160 @@ void HistogramTest::testExport()
 }
 
 
+void HistogramTest::testBucketHelpers()
+{
+	const std::vector<double> linear = Histogram::linearBuckets(1.0, 0.5, 4);
+	assertEqual(4, linear.size());
+	assertEqualDelta(1.0, linear[0], 0.0);
+	assertEqualDelta(1.5, linear[1], 0.0);
+	assertEqualDelta(2.0, linear[2], 0.0);
+	assertEqualDelta(2.5, linear[3], 0.0);
+
+	const std::vector<double> exponential = Histogram::exponentialBuckets(0.001, 10.0, 4);
+	assertEqual(4, exponential.size());
+	assertEqualDelta(0.001, exponential[0], 1e-12);
+	assertEqualDelta(0.01, exponential[1], 1e-12);
+	assertEqualDelta(0.1, exponential[2], 1e-12);
+	assertEqualDelta(1.0, exponential[3], 1e-12);
+
+	try
+	{
+		Histogram::exponentialBuckets(0.0, 2.0, 4);
+		fail("start must be greater than zero - must throw"s);
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
+
+	try
+	{
+		Histogram::linearBuckets(0.0, 1.0, 0);
+		fail("count must be at least one - must throw"s);
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
+}
+
+
+void HistogramTest::testNativeBuckets()
+{
+	Histogram histo("histo"s);
+	histo.nativeBuckets(0, 0.25, 16.0);
+	assertEqual(0, histo.schema());
+
+	const std::vector<double> bounds = histo.buckets();
+	assertEqual(7, bounds.size());
+	assertEqualDelta(0.25, bounds[0], 0.0);
+	assertEqualDelta(1.0, bounds[2], 0.0);
+	assertEqualDelta(16.0, bounds[6], 0.0);
+
+	histo.observe(0.1);
+	histo.observe(1.0);
+	histo.observe(1.0001);
+	histo.observe(3.0);
+	histo.observe(100.0);
+	histo.observe(std::nan(""));
+
+	const auto data = histo.data();
+	assertEqual(7, data.bucketCounts.size());
+	assertEqual(1, data.bucketCounts[0]);
+	assertEqual(1, data.bucketCounts[1]);
+	assertEqual(2, data.bucketCounts[2]);
+	assertEqual(3, data.bucketCounts[3]);
+	assertEqual(4, data.bucketCounts[4]);
+	assertEqual(4, data.bucketCounts[6]);
+	assertEqual(6, data.count);
+
+	Histogram fine("fine"s, nullptr);
+	fine.nativeBuckets(3, 0.001, 1000.0);
+	const std::vector<double> fineBounds = fine.buckets();
+	for (std::size_t i = 1; i < fineBounds.size(); i++)
+	{
+		assertEqualDelta(std::pow(2.0, 0.125), fineBounds[i]/fineBounds[i - 1], 1e-9);
+	}
+
+	// the computed bucket must match a search over the bounds, also at and around the bounds
+	HistogramSample& sample = fine.labels({});
+	for (std::size_t i = 0; i < fineBounds.size(); i++)
+	{
+		const double b = fineBounds[i];
+		const double values[] = {b, std::nextafter(b, 0.0), std::nextafter(b, 2*b), b*1.01};
+		for (double v: values)
+		{
+			const std::size_t expected = std::lower_bound(fineBounds.begin(), fineBounds.end(), v) - fineBounds.begin();
+			assertEqual(expected, sample.bucketIndex(v));
+		}
+	}
+
+	try
+	{
+		histo.nativeBuckets(9, 1.0, 2.0);
+		fail("schema out of range - must throw"s);
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
+
+	try
+	{
+		histo.nativeBuckets(0, 0.0, 2.0);
+		fail("min must be greater than zero - must throw"s);
+	}
+	catch (Poco::InvalidArgumentException&)
+	{
+	}
+}
+
+
+namespace
+{
+	class Observer: public Poco::Runnable
+	{
+	public:
+		Observer(Histogram& histo, int count):
+			_histo(histo),
+			_count(count)
+		{
+		}
+
+		void run()
+		{
+			for (int i = 0; i < _count; i++)
+			{
+				_histo.observe(static_cast<double>(i % 4));
+			}
+		}
+
+	private:
+		Histogram& _histo;
+		int _count;
+	};
+}
+
+
+void HistogramTest::testConcurrentObserve()
+{
+	const int THREADS = 4;
+	const int COUNT = 25000;
+
+	Histogram histo("histo"s);
+	histo.buckets({0.0, 1.0, 2.0});
+
+	Observer observer(histo, COUNT);
+	Poco::Thread threads[THREADS];
+	for (auto& t: threads) t.start(observer);
+	for (auto& t: threads) t.join();
+
+	const auto data = histo.data();
+	assertEqual(THREADS*COUNT/4, data.bucketCounts[0]);
+	assertEqual(THREADS*COUNT/2, data.bucketCounts[1]);
+	assertEqual(3*THREADS*COUNT/4, data.bucketCounts[2]);
+	assertEqual(THREADS*COUNT, data.count);
+	assertEqualDelta(1.5*THREADS*COUNT, data.sum, 0.0);
+}
+
+
 void HistogramTest::setUp()
 {
 	Registry::defaultRegistry().clear();
@@ -173,6 +340,9 @@ CppUnit::Test* HistogramTest::suite()
 	CppUnit_addTest(pSuite, HistogramTest, testBuckets);
 	CppUnit_addTest(pSuite, HistogramTest, testLabels);
 	CppUnit_addTest(pSuite, HistogramTest, testExport);
+	CppUnit_addTest(pSuite, HistogramTest, testBucketHelpers);
+	CppUnit_addTest(pSuite, HistogramTest, testNativeBuckets);
+	CppUnit_addTest(pSuite, HistogramTest, testConcurrentObserve);
 
 	return pSuite;
 }
@@ -27,6 +27,9 @@ public:
 	void testBuckets();
 	void testLabels();
 	void testExport();
+	void testBucketHelpers();
+	void testNativeBuckets();
+	void testConcurrentObserve();
 
 	void setUp();
 	void tearDown();
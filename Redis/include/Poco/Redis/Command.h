@@ -105,6 +105,11 @@ public:
 	static Command hgetall(const std::string& hash);
 		/// Creates and returns an HGETALL command.
 
+	static Command hello(Int64 protocolVersion);
+		/// Creates and returns a HELLO command, which switches the connection
+		/// to the given protocol version (2 for RESP2, 3 for RESP3).
+		/// Available for Redis 6.0.
+
 	static Command hincrby(const std::string& hash, const std::string& field, Int64 by = 1);
 		/// Creates and returns an HINCRBY command.
 
@@ -0,0 +1,225 @@
+//
+// PipelinedClient.h
+//
+// Library: Redis
+// Package: Redis
+// Module:  PipelinedClient
+//
+// Definition of the PipelinedClient class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef Redis_PipelinedClient_INCLUDED
+#define Redis_PipelinedClient_INCLUDED
+
+
+#include "Poco/Redis/Redis.h"
+#include "Poco/Redis/Array.h"
+#include "Poco/Redis/Error.h"
+#include "Poco/Redis/Exception.h"
+#include "Poco/Redis/RedisEventArgs.h"
+#include "Poco/Redis/RedisStream.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/BasicEvent.h"
+#include "Poco/Thread.h"
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+
+
+namespace Poco {
+namespace Redis {
+
+
+class Redis_API PipelinedClient
+	/// A connection to a Redis server that is shared by many callers,
+	/// with replies delivered asynchronously.
+	///
+	/// Commands can be sent from any thread, without waiting for the
+	/// replies to preceding commands. They are written to the connection
+	/// in the order they are sent, and the replies, which Redis sends in
+	/// the same order, are matched to the commands by a first-in first-out
+	/// queue. While one thread writes to the socket, commands sent by other
+	/// threads are collected, and then written together, so that concurrent
+	/// callers share network round trips and system calls.
+	///
+	/// Replies are read by a reader thread owned by the PipelinedClient,
+	/// and delivered either through a callback, which is called by the
+	/// reader thread, or through a std::future:
+	///
+	///     PipelinedClient client(Net::SocketAddress("localhost", 6379));
+	///     std::future<Int64> counter = client.execute<Int64>(Command::incr("counter"));
+	///     client.send(Command::get("key"), [](const RedisType::Ptr& pReply)
+	///         {
+	///             ...
+	///         });
+	///     Int64 value = counter.get();
+	///
+	/// Callbacks must not block, as no further replies are delivered
+	/// while a callback runs. In particular, a callback must not wait
+	/// for the future of another command sent to the same PipelinedClient.
+	///
+	/// By default, the connection uses the RESP2 protocol. Call hello(3)
+	/// to switch to RESP3, which adds booleans, doubles, maps, sets and
+	/// push messages (see RedisType::createRedisType()). Push messages,
+	/// such as client-side caching invalidation messages, are not
+	/// replies to a command and are reported through the redisPush event.
+	///
+	/// Commands that do not send a reply, or send more than one reply,
+	/// like SUBSCRIBE in RESP2 or MONITOR, must not be used with
+	/// PipelinedClient. Use Client and AsyncReader for these.
+{
+public:
+	using Ptr = SharedPtr<PipelinedClient>;
+
+	using Callback = std::function<void(const RedisType::Ptr& pReply)>;
+		/// The callback for a reply. If the command could not
+		/// be sent, or the connection has been lost before the
+		/// reply has been received, the callback receives an
+		/// Error describing the failure.
+
+	BasicEvent<RedisEventArgs> redisPush;
+		/// Fired by the reader thread when a RESP3 push message is received.
+
+	BasicEvent<RedisEventArgs> redisException;
+		/// Fired by the reader thread when the connection fails.
+
+	explicit PipelinedClient(const Net::SocketAddress& address);
+		/// Creates the PipelinedClient and connects it to the
+		/// Redis server at the given address.
+
+	PipelinedClient(const std::string& host, int port);
+		/// Creates the PipelinedClient and connects it to the
+		/// Redis server at the given host and port.
+
+	explicit PipelinedClient(const Net::StreamSocket& socket);
+		/// Creates the PipelinedClient using the given,
+		/// connected socket.
+
+	~PipelinedClient();
+		/// Closes the connection and destroys the PipelinedClient.
+
+	void send(const Array& command, Callback callback);
+		/// Sends the command, and calls the given callback
+		/// with the reply.
+
+	std::future<RedisType::Ptr> send(const Array& command);
+		/// Sends the command, and returns a future for the reply.
+		/// As with Client::sendCommand(), a Redis error is
+		/// returned as reply.
+
+	template <typename T>
+	std::future<T> execute(const Array& command)
+		/// Sends the command, and returns a future for the reply,
+		/// converted to the given type. See Client::execute().
+		///
+		/// If the reply is a Redis error, or the command failed,
+		/// getting the result throws a RedisException. If the
+		/// reply cannot be converted, it throws a BadCastException.
+	{
+		std::shared_ptr<std::promise<T>> pPromise = std::make_shared<std::promise<T>>();
+		std::future<T> result = pPromise->get_future();
+		send(command, [pPromise](const RedisType::Ptr& pReply)
+			{
+				try
+				{
+					pPromise->set_value(extract<T>(pReply));
+				}
+				catch (...)
+				{
+					pPromise->set_exception(std::current_exception());
+				}
+			});
+		return result;
+	}
+
+	Array hello(Int64 protocolVersion = 3);
+		/// Sends a HELLO command to switch the connection to the given
+		/// protocol version, waits for the reply and returns it.
+		/// For RESP3, the reply is a map with information about the
+		/// server, returned as Array with keys and values alternately.
+		///
+		/// Throws a RedisException if the server does not support
+		/// the protocol version (or the HELLO command, before Redis 6.0).
+
+	void close();
+		/// Shuts down the connection and waits for the reader thread
+		/// to finish. Replies to commands that have not been received
+		/// yet are reported as errors.
+		///
+		/// Must not be called from a callback or event delegate.
+
+	bool isConnected() const;
+		/// Returns true if the connection is open.
+
+	std::size_t pending() const;
+		/// Returns the number of commands waiting for a reply.
+
+	Net::SocketAddress address() const;
+		/// Returns the address of the Redis server.
+
+	template <typename T>
+	static T extract(const RedisType::Ptr& pReply)
+		/// Converts the reply to the given type.
+		/// Throws a RedisException if the reply is a Redis error,
+		/// or a BadCastException if the reply has another type.
+	{
+		if (pReply->type() == RedisTypeTraits<Error>::TypeId)
+		{
+			const Type<Error>* pError = dynamic_cast<const Type<Error>*>(pReply.get());
+			throw RedisException(pError->value().getMessage());
+		}
+		if (pReply->type() == RedisTypeTraits<T>::TypeId)
+		{
+			const Type<T>* pType = dynamic_cast<const Type<T>*>(pReply.get());
+			if (pType != nullptr) return pType->value();
+		}
+		throw BadCastException();
+	}
+
+private:
+	void start();
+	void write(std::unique_lock<std::mutex>& lock);
+	void run();
+	void fail(const std::string& message);
+	RedisType::Ptr readReply();
+
+	PipelinedClient(const PipelinedClient&);
+	PipelinedClient& operator = (const PipelinedClient&);
+
+	Net::StreamSocket _socket;
+	Net::SocketAddress _address;
+	RedisInputStream _input;
+	Poco::Thread _reader;
+	mutable std::mutex _mutex;
+	std::deque<Callback> _pending;
+	std::string _writeBuffer;
+	bool _writing;
+	bool _connected;
+	bool _closing;
+};
+
+
+//
+// inlines
+//
+
+
+inline Net::SocketAddress PipelinedClient::address() const
+{
+	return _address;
+}
+
+
+} } // namespace Poco::Redis
+
+
+#endif // Redis_PipelinedClient_INCLUDED
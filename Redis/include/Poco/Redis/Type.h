@@ -25,6 +25,7 @@
 #include "Poco/Nullable.h"
 #include "Poco/Redis/Redis.h"
 #include "Poco/Redis/RedisStream.h"
+#include <limits>
 
 
 namespace Poco {
@@ -42,7 +43,10 @@ public:
 		REDIS_SIMPLE_STRING, /// Redis Simple String
 		REDIS_BULK_STRING,   /// Redis Bulkstring
 		REDIS_ARRAY,         /// Redis Array
-		REDIS_ERROR          /// Redis Error
+		REDIS_ERROR,         /// Redis Error
+		REDIS_BOOLEAN,       /// Redis Boolean (RESP3)
+		REDIS_DOUBLE,        /// Redis Double (RESP3)
+		REDIS_PUSH           /// Redis Push (RESP3), an out-of-band Array
 	};
 
 	using Ptr = SharedPtr<RedisType>;
@@ -68,6 +72,15 @@ public:
 	bool isSimpleString() const;
 		/// Returns true when the value is a simple string.
 
+	bool isBoolean() const;
+		/// Returns true when the value is a RESP3 boolean.
+
+	bool isDouble() const;
+		/// Returns true when the value is a RESP3 double.
+
+	bool isPush() const;
+		/// Returns true when the value is a RESP3 push message.
+
 	virtual int type() const = 0;
 		/// Returns the type of the value.
 
@@ -85,6 +98,22 @@ public:
 		///     - '$': a bulk string (BulkString)
 		///     - '*': an array (Array)
 		///     - ':': a signed 64 bit integer (Int64)
+		///
+		/// and, for replies in the RESP3 protocol (see Command::hello()):
+		///
+		///     - '#': a boolean (bool)
+		///     - ',': a double (double)
+		///     - '_': a null, as null bulk string (BulkString)
+		///     - '=': a verbatim string, as bulk string without
+		///       the format prefix (BulkString)
+		///     - '(': a big number, as simple string (std::string)
+		///     - '!': a bulk error (Error)
+		///     - '%': a map, as Array containing keys and values
+		///       alternately (Array)
+		///     - '~': a set (Array)
+		///     - '>': a push message (Array, with type REDIS_PUSH)
+		///
+		/// Returns a null pointer for an unknown marker.
 };
 
 
@@ -123,6 +152,24 @@ inline bool RedisType::isSimpleString() const
 }
 
 
+inline bool RedisType::isBoolean() const
+{
+	return type() == REDIS_BOOLEAN;
+}
+
+
+inline bool RedisType::isDouble() const
+{
+	return type() == REDIS_DOUBLE;
+}
+
+
+inline bool RedisType::isPush() const
+{
+	return type() == REDIS_PUSH;
+}
+
+
 template<typename T>
 struct RedisTypeTraits
 {
@@ -174,6 +221,67 @@ struct RedisTypeTraits<std::string>
 };
 
 
+template<>
+struct RedisTypeTraits<bool>
+{
+	enum
+	{
+		TypeId = RedisType::REDIS_BOOLEAN
+	};
+
+	static const char marker = '#';
+
+	static std::string toString(const bool& value)
+	{
+		return marker + std::string(value ? "t" : "f") + LineEnding::NEWLINE_CRLF;
+	}
+
+	static void read(RedisInputStream& input, bool& value)
+	{
+		value = input.getline() == "t";
+	}
+};
+
+
+template<>
+struct RedisTypeTraits<double>
+{
+	enum
+	{
+		TypeId = RedisType::REDIS_DOUBLE
+	};
+
+	static const char marker = ',';
+
+	static std::string toString(const double& value)
+	{
+		std::string number;
+		if (value != value)
+			number = "nan";
+		else if (value == std::numeric_limits<double>::infinity())
+			number = "inf";
+		else if (value == -std::numeric_limits<double>::infinity())
+			number = "-inf";
+		else
+			number = NumberFormatter::format(value);
+		return marker + number + LineEnding::NEWLINE_CRLF;
+	}
+
+	static void read(RedisInputStream& input, double& value)
+	{
+		std::string number = input.getline();
+		if (number == "inf")
+			value = std::numeric_limits<double>::infinity();
+		else if (number == "-inf")
+			value = -std::numeric_limits<double>::infinity();
+		else if (number == "nan")
+			value = std::numeric_limits<double>::quiet_NaN();
+		else
+			value = NumberParser::parseFloat(number);
+	}
+};
+
+
 using BulkString = Nullable<std::string>;
 	/// A bulk string is a string that can contain a NULL value.
 	/// So, BulkString is an alias for Nullable<std::string>.
@@ -179,6 +179,16 @@ Command Command::hgetall(const std::string& hash)
 }
 
 
+Command Command::hello(Int64 protocolVersion)
+{
+	Command cmd("HELLO");
+
+	cmd << NumberFormatter::format(protocolVersion);
+
+	return cmd;
+}
+
+
 Command Command::hincrby(const std::string& hash, const std::string& field, Int64 by)
 {
 	Command cmd("HINCRBY");
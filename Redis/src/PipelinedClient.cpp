@@ -0,0 +1,300 @@
+//
+// PipelinedClient.cpp
+//
+// Library: Redis
+// Package: Redis
+// Module:  PipelinedClient
+//
+// Implementation of the PipelinedClient class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "Poco/Redis/PipelinedClient.h"
+#include "Poco/Redis/Command.h"
+#include "Poco/ErrorHandler.h"
+
+
+namespace Poco {
+namespace Redis {
+
+
+PipelinedClient::PipelinedClient(const Net::SocketAddress& address):
+	_socket(address),
+	_address(address),
+	_input(_socket),
+	_writing(false),
+	_connected(true),
+	_closing(false)
+{
+	start();
+}
+
+
+PipelinedClient::PipelinedClient(const std::string& host, int port):
+	PipelinedClient(Net::SocketAddress(host, port))
+{
+}
+
+
+PipelinedClient::PipelinedClient(const Net::StreamSocket& socket):
+	_socket(socket),
+	_address(socket.peerAddress()),
+	_input(_socket),
+	_writing(false),
+	_connected(true),
+	_closing(false)
+{
+	start();
+}
+
+
+PipelinedClient::~PipelinedClient()
+{
+	try
+	{
+		close();
+	}
+	catch (...)
+	{
+		poco_unexpected();
+	}
+}
+
+
+void PipelinedClient::start()
+{
+	_socket.setNoDelay(true);
+	_reader.setName("PipelinedClient");
+	_reader.startFunc([this]() { run(); });
+}
+
+
+void PipelinedClient::send(const Array& command, Callback callback)
+{
+	std::string request = command.toString();
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	if (!_connected)
+	{
+		lock.unlock();
+		callback(new Type<Error>(Error("Not connected to Redis server")));
+		return;
+	}
+	_pending.push_back(std::move(callback));
+	_writeBuffer.append(request);
+	if (!_writing) write(lock);
+}
+
+
+std::future<RedisType::Ptr> PipelinedClient::send(const Array& command)
+{
+	std::shared_ptr<std::promise<RedisType::Ptr>> pPromise = std::make_shared<std::promise<RedisType::Ptr>>();
+	std::future<RedisType::Ptr> result = pPromise->get_future();
+	send(command, [pPromise](const RedisType::Ptr& pReply)
+		{
+			pPromise->set_value(pReply);
+		});
+	return result;
+}
+
+
+void PipelinedClient::write(std::unique_lock<std::mutex>& lock)
+{
+	// The calling thread becomes the writer and sends everything in the
+	// write buffer, including commands appended by other threads while
+	// it is writing. Commands are appended to the write buffer and their
+	// callbacks to the pending queue under the same lock, so the order
+	// of both always matches.
+
+	_writing = true;
+	std::string buffer;
+	while (!_writeBuffer.empty())
+	{
+		buffer.swap(_writeBuffer);
+		lock.unlock();
+		try
+		{
+			const char* data = buffer.data();
+			std::size_t remaining = buffer.size();
+			while (remaining > 0)
+			{
+				int n = _socket.sendBytes(data, static_cast<int>(remaining));
+				if (n <= 0) throw RedisException("Failed to send command to Redis server");
+				data += n;
+				remaining -= n;
+			}
+		}
+		catch (...)
+		{
+			// The reader thread will notice the shutdown and
+			// fail all commands waiting for a reply.
+			try
+			{
+				_socket.shutdown();
+			}
+			catch (...)
+			{
+			}
+			lock.lock();
+			_writeBuffer.clear();
+			_writing = false;
+			return;
+		}
+		buffer.clear();
+		lock.lock();
+	}
+	_writing = false;
+}
+
+
+Array PipelinedClient::hello(Int64 protocolVersion)
+{
+	return execute<Array>(Command::hello(protocolVersion)).get();
+}
+
+
+void PipelinedClient::close()
+{
+	if (_reader.isRunning())
+	{
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_closing = true;
+		}
+		try
+		{
+			_socket.shutdown();
+		}
+		catch (...)
+		{
+		}
+		_reader.join();
+	}
+}
+
+
+bool PipelinedClient::isConnected() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _connected;
+}
+
+
+std::size_t PipelinedClient::pending() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _pending.size();
+}
+
+
+void PipelinedClient::run()
+{
+	for (;;)
+	{
+		RedisType::Ptr pReply;
+		try
+		{
+			pReply = readReply();
+		}
+		catch (Exception& exc)
+		{
+			bool closing = false;
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				closing = _closing;
+			}
+			fail(exc.displayText());
+			if (!closing)
+			{
+				RedisEventArgs args(&exc);
+				redisException.notify(this, args);
+			}
+			break;
+		}
+
+		if (pReply->isPush())
+		{
+			RedisEventArgs args(pReply);
+			try
+			{
+				redisPush.notify(this, args);
+			}
+			catch (Exception& exc)
+			{
+				ErrorHandler::handle(exc);
+			}
+			continue;
+		}
+
+		Callback callback;
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (_pending.empty()) continue; // unsolicited reply
+			callback = std::move(_pending.front());
+			_pending.pop_front();
+		}
+		try
+		{
+			callback(pReply);
+		}
+		catch (Exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (std::exception& exc)
+		{
+			ErrorHandler::handle(exc);
+		}
+		catch (...)
+		{
+			ErrorHandler::handle();
+		}
+	}
+}
+
+
+void PipelinedClient::fail(const std::string& message)
+{
+	std::deque<Callback> pending;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_connected = false;
+		pending.swap(_pending);
+	}
+	for (auto& callback: pending)
+	{
+		try
+		{
+			callback(new Type<Error>(Error(message)));
+		}
+		catch (...)
+		{
+			ErrorHandler::handle();
+		}
+	}
+}
+
+
+RedisType::Ptr PipelinedClient::readReply()
+{
+	int c = _input.get();
+	if (c == -1)
+	{
+		throw RedisException("Lost connection to Redis server");
+	}
+	RedisType::Ptr result = RedisType::createRedisType(c);
+	if (result.isNull())
+	{
+		throw RedisException("Invalid Redis type returned");
+	}
+	result->read(_input);
+	return result;
+}
+
+
+} } // namespace Poco::Redis
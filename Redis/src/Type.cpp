@@ -17,12 +17,102 @@
 #include "Poco/Redis/Type.h"
 #include "Poco/Redis/Error.h"
 #include "Poco/Redis/Array.h"
+#include "Poco/Redis/Exception.h"
 
 
 namespace Poco {
 namespace Redis {
 
 
+namespace
+{
+	//
+	// RESP3 types that are represented by one of the RESP2 types,
+	// but differ in the wire format.
+	//
+
+	class NullType: public Type<BulkString>
+		/// RESP3 null ("_\r\n"), represented as a null BulkString.
+	{
+	public:
+		void read(RedisInputStream& input)
+		{
+			value().clear();
+			input.getline();
+		}
+	};
+
+
+	class VerbatimStringType: public Type<BulkString>
+		/// RESP3 verbatim string ("=15\r\ntxt:Some string\r\n"),
+		/// represented as a BulkString without the format prefix.
+	{
+	public:
+		void read(RedisInputStream& input)
+		{
+			RedisTypeTraits<BulkString>::read(input, value());
+			if (!value().isNull())
+			{
+				const std::string& s = value().value();
+				if (s.size() >= 4 && s[3] == ':') value().assign(s.substr(4));
+			}
+		}
+	};
+
+
+	class BulkErrorType: public Type<Error>
+		/// RESP3 bulk error ("!21\r\nSYNTAX invalid syntax\r\n").
+	{
+	public:
+		void read(RedisInputStream& input)
+		{
+			BulkString message;
+			RedisTypeTraits<BulkString>::read(input, message);
+			value().setMessage(message.value(""));
+		}
+	};
+
+
+	class AggregateType: public Type<Array>
+		/// RESP3 map, set and push types, represented as Array.
+		/// The elements of a map are read as keys and values
+		/// alternately.
+	{
+	public:
+		AggregateType(int typeId, int elementsPerEntry):
+			_typeId(typeId),
+			_elementsPerEntry(elementsPerEntry)
+		{
+		}
+
+		int type() const
+		{
+			return _typeId;
+		}
+
+		void read(RedisInputStream& input)
+		{
+			value().clear();
+
+			const Int64 length = NumberParser::parse64(input.getline())*_elementsPerEntry;
+			for (Int64 i = 0; i < length; ++i)
+			{
+				RedisType::Ptr element = RedisType::createRedisType(input.get());
+				if (element.isNull())
+					throw RedisException("Wrong answer received from Redis server");
+
+				element->read(input);
+				value().addRedisType(element);
+			}
+		}
+
+	private:
+		int _typeId;
+		int _elementsPerEntry;
+	};
+}
+
+
 RedisType::RedisType()
 {
 }
@@ -54,6 +144,33 @@ RedisType::Ptr RedisType::createRedisType(char marker)
 	case RedisTypeTraits<Error>::marker :
 		result = new Type<Error>();
 		break;
+	case RedisTypeTraits<bool>::marker :
+		result = new Type<bool>();
+		break;
+	case RedisTypeTraits<double>::marker :
+		result = new Type<double>();
+		break;
+	case '_' :
+		result = new NullType();
+		break;
+	case '=' :
+		result = new VerbatimStringType();
+		break;
+	case '(' :
+		result = new Type<std::string>();
+		break;
+	case '!' :
+		result = new BulkErrorType();
+		break;
+	case '%' :
+		result = new AggregateType(REDIS_ARRAY, 2);
+		break;
+	case '~' :
+		result = new AggregateType(REDIS_ARRAY, 1);
+		break;
+	case '>' :
+		result = new AggregateType(REDIS_PUSH, 1);
+		break;
 	}
 	return result;
 }
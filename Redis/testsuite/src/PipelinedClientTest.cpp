@@ -0,0 +1,443 @@
+//
+// PipelinedClientTest.cpp
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#include "PipelinedClientTest.h"
+#include "Poco/Redis/PipelinedClient.h"
+#include "Poco/Redis/Command.h"
+#include "Poco/Redis/RedisStream.h"
+#include "Poco/Net/ServerSocket.h"
+#include "Poco/Net/StreamSocket.h"
+#include "Poco/Net/SocketAddress.h"
+#include "Poco/Delegate.h"
+#include "Poco/NumberFormatter.h"
+#include "Poco/NumberParser.h"
+#include "Poco/Thread.h"
+#include "CppUnit/TestCaller.h"
+#include "CppUnit/TestSuite.h"
+#include <atomic>
+#include <map>
+#include <vector>
+
+
+using namespace Poco::Redis;
+using Poco::Net::ServerSocket;
+using Poco::Net::StreamSocket;
+using Poco::Net::SocketAddress;
+using Poco::NumberFormatter;
+using Poco::NumberParser;
+using Poco::Int64;
+
+
+namespace
+{
+	class RedisStub
+		/// A minimal Redis server, handling a single connection.
+		///
+		/// Besides a few regular commands (PING, HELLO, SET, GET,
+		/// INCR and QUIT), it supports:
+		///   - TYPES: replies with an array containing all RESP3 types.
+		///   - NOTIFY <message>: sends a push message, followed by +OK.
+		///   - DROP: closes the connection without a reply.
+	{
+	public:
+		RedisStub():
+			_server(SocketAddress("127.0.0.1", 0)),
+			_resp3(false)
+		{
+			_thread.startFunc([this]() { run(); });
+		}
+
+		~RedisStub()
+		{
+			_thread.join();
+		}
+
+		SocketAddress address() const
+		{
+			return _server.address();
+		}
+
+	private:
+		void run()
+		{
+			StreamSocket socket = _server.acceptConnection();
+			RedisInputStream input(socket);
+			RedisOutputStream output(socket);
+			for (;;)
+			{
+				int c = input.get();
+				if (c == -1) break;
+				Array command;
+				RedisTypeTraits<Array>::read(input, command);
+				std::vector<std::string> args;
+				for (std::size_t i = 0; i < command.size(); i++)
+				{
+					args.push_back(command.get<BulkString>(i).value());
+				}
+				if (args[0] == "DROP") break;
+
+				std::string reply = execute(args);
+				output.write(reply.data(), reply.size());
+				if (args[0] == "QUIT") break;
+				if (input.rdbuf()->in_avail() == 0) output.flush();
+			}
+			output.flush();
+			socket.shutdown();
+		}
+
+		std::string execute(const std::vector<std::string>& args)
+		{
+			const std::string& name = args[0];
+			if (name == "PING")
+			{
+				return "+PONG\r\n";
+			}
+			else if (name == "HELLO")
+			{
+				if (args[1] == "3")
+				{
+					_resp3 = true;
+					return "%2\r\n$6\r\nserver\r\n$5\r\nredis\r\n$5\r\nproto\r\n:3\r\n";
+				}
+				else if (args[1] == "2")
+				{
+					_resp3 = false;
+					return "*4\r\n$6\r\nserver\r\n$5\r\nredis\r\n$5\r\nproto\r\n:2\r\n";
+				}
+				else return "-NOPROTO unsupported protocol version\r\n";
+			}
+			else if (name == "SET")
+			{
+				_values[args[1]] = args[2];
+				return "+OK\r\n";
+			}
+			else if (name == "GET")
+			{
+				auto it = _values.find(args[1]);
+				if (it == _values.end()) return _resp3 ? "_\r\n" : "$-1\r\n";
+				return RedisTypeTraits<BulkString>::toString(it->second);
+			}
+			else if (name == "INCR")
+			{
+				Int64 value = 1;
+				auto it = _values.find(args[1]);
+				if (it != _values.end()) value += NumberParser::parse64(it->second);
+				_values[args[1]] = NumberFormatter::format(value);
+				return RedisTypeTraits<Int64>::toString(value);
+			}
+			else if (name == "QUIT")
+			{
+				return "+OK\r\n";
+			}
+			else if (name == "TYPES")
+			{
+				return "*9\r\n"
+					"#t\r\n"
+					",3.5\r\n"
+					",-inf\r\n"
+					"_\r\n"
+					"(3492890328409238509324850943850943825024385\r\n"
+					"=15\r\ntxt:Some string\r\n"
+					"~2\r\n:1\r\n:2\r\n"
+					"%1\r\n+key\r\n:7\r\n"
+					"!21\r\nSYNTAX invalid syntax\r\n";
+			}
+			else if (name == "NOTIFY")
+			{
+				return ">2\r\n$7\r\nmessage\r\n" + RedisTypeTraits<BulkString>::toString(args[1]) + "+OK\r\n";
+			}
+			return "-ERR unknown command '" + name + "'\r\n";
+		}
+
+		ServerSocket _server;
+		Poco::Thread _thread;
+		std::map<std::string, std::string> _values;
+		bool _resp3;
+	};
+
+
+	class PushHandler
+	{
+	public:
+		void onPush(const void* pSender, RedisEventArgs& args)
+		{
+			Type<Array>* pPush = dynamic_cast<Type<Array>*>(args.message().get());
+			if (pPush)
+			{
+				messages.push_back(pPush->value().get<BulkString>(1).value());
+			}
+		}
+
+		void onException(const void* pSender, RedisEventArgs& args)
+		{
+			exceptions++;
+		}
+
+		std::vector<std::string> messages;
+		std::atomic<int> exceptions{0};
+	};
+}
+
+
+PipelinedClientTest::PipelinedClientTest(const std::string& name):
+	CppUnit::TestCase(name)
+{
+}
+
+
+PipelinedClientTest::~PipelinedClientTest()
+{
+}
+
+
+void PipelinedClientTest::testFutures()
+{
+	RedisStub stub;
+	PipelinedClient client(stub.address());
+
+	std::future<std::string> ping = client.execute<std::string>(Command::ping());
+	std::vector<std::future<Int64>> counters;
+	for (int i = 0; i < 1000; i++)
+	{
+		counters.push_back(client.execute<Int64>(Command::incr("counter")));
+	}
+	std::future<RedisType::Ptr> value = client.send(Command::get("counter"));
+
+	assertTrue (ping.get() == "PONG");
+	for (int i = 0; i < 1000; i++)
+	{
+		assertTrue (counters[i].get() == i + 1);
+	}
+	RedisType::Ptr pValue = value.get();
+	assertTrue (pValue->isBulkString());
+	assertTrue (pValue->toString() == "$4\r\n1000\r\n");
+	assertTrue (client.pending() == 0);
+}
+
+
+void PipelinedClientTest::testCallbacks()
+{
+	RedisStub stub;
+	PipelinedClient client(stub.address());
+
+	std::vector<Int64> results;
+	Poco::Event done;
+	for (int i = 0; i < 100; i++)
+	{
+		client.send(Command::incr("counter"), [&results, &done](const RedisType::Ptr& pReply)
+			{
+				results.push_back(PipelinedClient::extract<Int64>(pReply));
+				if (results.size() == 100) done.set();
+			});
+	}
+	assertTrue (done.tryWait(10000));
+	for (int i = 0; i < 100; i++)
+	{
+		assertTrue (results[i] == i + 1);
+	}
+}
+
+
+void PipelinedClientTest::testConcurrentCallers()
+{
+	const int THREADS = 4;
+	const int COMMANDS = 250;
+
+	RedisStub stub;
+	PipelinedClient client(stub.address());
+
+	std::atomic<int> failures(0);
+	std::vector<Poco::Thread> threads(THREADS);
+	for (int t = 0; t < THREADS; t++)
+	{
+		threads[t].startFunc([&client, &failures, t]()
+			{
+				const std::string counter = "counter-" + NumberFormatter::format(t);
+				std::vector<std::future<Int64>> counters;
+				std::vector<std::future<BulkString>> values;
+				for (int i = 0; i < COMMANDS; i++)
+				{
+					const std::string key = "key-" + NumberFormatter::format(t) + "-" + NumberFormatter::format(i);
+					counters.push_back(client.execute<Int64>(Command::incr(counter)));
+					client.send(Command::set(key, NumberFormatter::format(i)), [](const RedisType::Ptr&) {});
+					values.push_back(client.execute<BulkString>(Command::get(key)));
+				}
+				for (int i = 0; i < COMMANDS; i++)
+				{
+					if (counters[i].get() != i + 1) failures++;
+					if (values[i].get().value() != NumberFormatter::format(i)) failures++;
+				}
+			});
+	}
+	for (auto& thread: threads) thread.join();
+	assertTrue (failures == 0);
+	assertTrue (client.pending() == 0);
+}
+
+
+void PipelinedClientTest::testError()
+{
+	RedisStub stub;
+	PipelinedClient client(stub.address());
+
+	std::future<std::string> unknown = client.execute<std::string>(Command("NOSUCHCOMMAND"));
+	std::future<Int64> mismatch = client.execute<Int64>(Command::ping());
+	std::future<RedisType::Ptr> raw = client.send(Command("NOSUCHCOMMAND"));
+	std::future<std::string> ping = client.execute<std::string>(Command::ping());
+
+	try
+	{
+		unknown.get();
+		fail("must throw");
+	}
+	catch (RedisException& exc)
+	{
+		assertTrue (exc.message() == "ERR unknown command 'NOSUCHCOMMAND'");
+	}
+	try
+	{
+		mismatch.get();
+		fail("must throw");
+	}
+	catch (Poco::BadCastException&)
+	{
+	}
+	assertTrue (raw.get()->isError());
+	assertTrue (ping.get() == "PONG");
+
+	try
+	{
+		client.hello(4);
+		fail("must throw");
+	}
+	catch (RedisException&)
+	{
+	}
+}
+
+
+void PipelinedClientTest::testResp3()
+{
+	RedisStub stub;
+	PipelinedClient client(stub.address());
+
+	assertTrue (client.execute<BulkString>(Command::get("missing")).get().isNull());
+
+	Array hello = client.hello(3);
+	assertTrue (hello.size() == 4);
+	assertTrue (hello.get<BulkString>(2).value() == "proto");
+	assertTrue (hello.get<Int64>(3) == 3);
+
+	assertTrue (client.execute<BulkString>(Command::get("missing")).get().isNull());
+
+	Array types = client.execute<Array>(Command("TYPES")).get();
+	assertTrue (types.size() == 9);
+	assertTrue (types.getType(0) == RedisType::REDIS_BOOLEAN);
+	assertTrue (types.get<bool>(0));
+	assertTrue (types.getType(1) == RedisType::REDIS_DOUBLE);
+	assertTrue (types.get<double>(1) == 3.5);
+	assertTrue (types.get<double>(2) == -std::numeric_limits<double>::infinity());
+	assertTrue (types.get<BulkString>(3).isNull());
+	assertTrue (types.get<std::string>(4) == "3492890328409238509324850943850943825024385");
+	assertTrue (types.get<BulkString>(5).value() == "Some string");
+
+	Array set = types.get<Array>(6);
+	assertTrue (set.size() == 2);
+	assertTrue (set.get<Int64>(1) == 2);
+
+	Array map = types.get<Array>(7);
+	assertTrue (map.size() == 2);
+	assertTrue (map.get<std::string>(0) == "key");
+	assertTrue (map.get<Int64>(1) == 7);
+
+	assertTrue (types.getType(8) == RedisType::REDIS_ERROR);
+	assertTrue (types.get<Error>(8).getMessage() == "SYNTAX invalid syntax");
+
+	assertTrue (RedisTypeTraits<bool>::toString(true) == "#t\r\n");
+	assertTrue (RedisTypeTraits<double>::toString(-std::numeric_limits<double>::infinity()) == ",-inf\r\n");
+}
+
+
+void PipelinedClientTest::testPush()
+{
+	RedisStub stub;
+	PipelinedClient client(stub.address());
+	PushHandler handler;
+	client.redisPush += Poco::delegate(&handler, &PushHandler::onPush);
+
+	client.hello(3);
+	std::future<std::string> notify = client.execute<std::string>(Command("NOTIFY") << "invalidate");
+	std::future<std::string> ping = client.execute<std::string>(Command::ping());
+
+	// The push message is not a reply, so the replies
+	// must still be matched to the right commands.
+	assertTrue (notify.get() == "OK");
+	assertTrue (ping.get() == "PONG");
+	assertTrue (handler.messages.size() == 1);
+	assertTrue (handler.messages[0] == "invalidate");
+
+	client.redisPush -= Poco::delegate(&handler, &PushHandler::onPush);
+}
+
+
+void PipelinedClientTest::testConnectionLost()
+{
+	RedisStub stub;
+	PipelinedClient client(stub.address());
+	PushHandler handler;
+	client.redisException += Poco::delegate(&handler, &PushHandler::onException);
+
+	assertTrue (client.execute<std::string>(Command::ping()).get() == "PONG");
+	assertTrue (client.isConnected());
+
+	std::future<RedisType::Ptr> drop = client.send(Command("DROP"));
+	RedisType::Ptr pReply = drop.get();
+	assertTrue (pReply->isError());
+	assertTrue (!client.isConnected());
+	assertTrue (handler.exceptions == 1);
+
+	try
+	{
+		client.execute<std::string>(Command::ping()).get();
+		fail("must throw");
+	}
+	catch (RedisException&)
+	{
+	}
+	assertTrue (client.pending() == 0);
+
+	client.redisException -= Poco::delegate(&handler, &PushHandler::onException);
+}
+
+
+void PipelinedClientTest::setUp()
+{
+}
+
+
+void PipelinedClientTest::tearDown()
+{
+}
+
+
+CppUnit::Test* PipelinedClientTest::suite()
+{
+	CppUnit::TestSuite* pSuite = new CppUnit::TestSuite("PipelinedClientTest");
+
+	CppUnit_addTest(pSuite, PipelinedClientTest, testFutures);
+	CppUnit_addTest(pSuite, PipelinedClientTest, testCallbacks);
+	CppUnit_addTest(pSuite, PipelinedClientTest, testConcurrentCallers);
+	CppUnit_addTest(pSuite, PipelinedClientTest, testError);
+	CppUnit_addTest(pSuite, PipelinedClientTest, testResp3);
+	CppUnit_addTest(pSuite, PipelinedClientTest, testPush);
+	CppUnit_addTest(pSuite, PipelinedClientTest, testConnectionLost);
+
+	return pSuite;
+}
@@ -0,0 +1,45 @@
+//
+// PipelinedClientTest.h
+//
+// Definition of the PipelinedClientTest class.
+//
+// Copyright (c) 2015, Applied Informatics Software Engineering GmbH.
+// and Contributors.
+//
+// SPDX-License-Identifier:	BSL-1.0
+//
+
+
+#ifndef PipelinedClientTest_INCLUDED
+#define PipelinedClientTest_INCLUDED
+
+
+#include "Poco/Redis/Redis.h"
+#include "CppUnit/TestCase.h"
+
+
+class PipelinedClientTest: public CppUnit::TestCase
+	/// Tests PipelinedClient and the RESP3 types against
+	/// an in-process stub server, so that no Redis server
+	/// is required.
+{
+public:
+	PipelinedClientTest(const std::string& name);
+	~PipelinedClientTest();
+
+	void testFutures();
+	void testCallbacks();
+	void testConcurrentCallers();
+	void testError();
+	void testResp3();
+	void testPush();
+	void testConnectionLost();
+
+	void setUp();
+	void tearDown();
+
+	static CppUnit::Test* suite();
+};
+
+
+#endif // PipelinedClientTest_INCLUDED
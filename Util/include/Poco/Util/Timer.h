@@ -21,8 +21,13 @@
 #include "Poco/Util/Util.h"
 #include "Poco/Util/TimerTask.h"
 #include "Poco/TimedNotificationQueue.h"
+#include "Poco/TimingWheel.h"
 #include "Poco/Thread.h"
 #include "Poco/Runnable.h"
+#include "Poco/Event.h"
+#include "Poco/Mutex.h"
+#include <atomic>
+#include <memory>
 
 
 namespace Poco {
@@ -50,10 +55,26 @@ class Util_API Timer: protected Poco::Runnable
 	///        }),
 	///        Poco::Clock());
 	///
+	/// By default, scheduled tasks are kept in a TimedNotificationQueue,
+	/// so scheduling a task is O(log n) in the number of pending tasks.
+	/// For timers with very large numbers of tasks that are often
+	/// cancelled before they run (e.g., timeouts), a Timer can be created
+	/// with the BACKEND_TIMING_WHEEL backend, which keeps tasks in a
+	/// Poco::TimingWheel with a resolution of one millisecond, where
+	/// scheduling a task is O(1).
+	///
 	/// Acknowledgement: The interface of this class has been inspired by
 	/// the java.util.Timer class from Java 1.3.
 {
 public:
+	enum Backend
+	{
+		BACKEND_QUEUE,
+			/// Tasks are kept in a TimedNotificationQueue (default).
+		BACKEND_TIMING_WHEEL
+			/// Tasks are kept in a TimingWheel.
+	};
+
 	Timer();
 		/// Creates the Timer.
 
@@ -61,6 +82,10 @@ public:
 		/// Creates the Timer, using a timer thread with
 		/// the given priority.
 
+	explicit Timer(Backend backend, Poco::Thread::Priority priority = Poco::Thread::PRIO_NORMAL);
+		/// Creates the Timer, using the given backend and
+		/// a timer thread with the given priority.
+
 	Timer(const Timer&) = delete;
 
 	Timer& operator = (const Timer&) = delete;
@@ -163,6 +188,9 @@ public:
 		/// If task execution takes longer than the given interval,
 		/// further executions are delayed.
 
+	Backend backend() const;
+		/// Returns the backend used by the Timer.
+
 	bool idle() const;
 		/// Returns true if the task queue is empty, otherwise false.
 
@@ -190,7 +218,18 @@ protected:
 	static void validateTask(const TimerTask::Ptr& pTask);
 
 private:
+	void runWheel();
+	void scheduleWheel(TimerTask::Ptr pTask, Poco::Clock clock, long interval, bool fixedRate);
+	void executeWheel(TimerTask::Ptr pTask, Poco::Clock clock, long interval, bool fixedRate, Poco::UInt32 generation);
+
 	Poco::TimedNotificationQueue _queue;
+	std::unique_ptr<Poco::TimingWheel> _pWheel;
+	Poco::Event _wakeUp;
+	std::atomic<Poco::Clock::ClockVal> _nextWakeUp;
+	std::atomic<bool> _stopped;
+	Poco::UInt32 _generation;
+	Poco::FastMutex _generationMutex;
+	Poco::FastMutex _runMutex;
 	Poco::Thread _thread;
 };
 
@@ -198,15 +237,21 @@ private:
 //
 // inlines
 //
+inline Timer::Backend Timer::backend() const
+{
+	return _pWheel ? BACKEND_TIMING_WHEEL : BACKEND_QUEUE;
+}
+
+
 inline bool Timer::idle() const
 {
-	return _queue.empty();
+	return _pWheel ? _pWheel->empty() : _queue.empty();
 }
 
 
 inline std::size_t Timer::taskCount() const
 {
-	return _queue.size();
+	return _pWheel ? _pWheel->size() : _queue.size();
 }
 
 
@@ -225,25 +225,66 @@ private:
 };
 
 
-Timer::Timer()
+namespace
+{
+	Poco::Clock toClock(const Poco::Timestamp& time)
+	{
+		Poco::Clock clock;
+		clock += time - Poco::Timestamp();
+		return clock;
+	}
+}
+
+
+Timer::Timer():
+	_nextWakeUp(0),
+	_stopped(false),
+	_generation(0)
 {
 	_thread.start(*this);
 }
 
 
-Timer::Timer(Poco::Thread::Priority priority)
+Timer::Timer(Poco::Thread::Priority priority):
+	_nextWakeUp(0),
+	_stopped(false),
+	_generation(0)
 {
 	_thread.setPriority(priority);
 	_thread.start(*this);
 }
 
 
+Timer::Timer(Backend backend, Poco::Thread::Priority priority):
+	_nextWakeUp(0),
+	_stopped(false),
+	_generation(0)
+{
+	if (backend == BACKEND_TIMING_WHEEL)
+	{
+		_pWheel.reset(new Poco::TimingWheel);
+	}
+	_thread.setPriority(priority);
+	_thread.start(*this);
+}
+
+
 Timer::~Timer()
 {
 	try
 	{
-		_queue.enqueueNotification(new StopNotification(_queue), Poco::Clock(0));
-		_thread.join();
+		if (_pWheel)
+		{
+			_stopped = true;
+			_wakeUp.set();
+			_thread.join();
+			_pWheel->clear();
+		}
+		else
+		{
+			_queue.enqueueNotification(new StopNotification(_queue), Poco::Clock(0));
+			_thread.join();
+		}
 	}
 	catch (...)
 	{
@@ -254,6 +295,21 @@ Timer::~Timer()
 
 void Timer::cancel(bool wait)
 {
+	if (_pWheel)
+	{
+		{
+			Poco::FastMutex::ScopedLock lock(_generationMutex);
+			_generation++;
+		}
+		_pWheel->clear();
+		if (wait && Poco::Thread::current() != &_thread)
+		{
+			// wait for the currently running tasks to finish
+			Poco::FastMutex::ScopedLock lock(_runMutex);
+		}
+		return;
+	}
+
 	Poco::AutoPtr<CancelNotification> pNf = new CancelNotification(_queue);
 	_queue.enqueueNotification(pNf, Poco::Clock(0));
 	if (wait)
@@ -266,14 +322,20 @@ void Timer::cancel(bool wait)
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Timestamp time)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new TaskNotification(_queue, pTask), time);
+	if (_pWheel)
+		scheduleWheel(pTask, toClock(time), -1, false);
+	else
+		_queue.enqueueNotification(new TaskNotification(_queue, pTask), time);
 }
 
 
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Clock clock)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new TaskNotification(_queue, pTask), clock);
+	if (_pWheel)
+		scheduleWheel(pTask, clock, -1, false);
+	else
+		_queue.enqueueNotification(new TaskNotification(_queue, pTask), clock);
 }
 
 
@@ -288,14 +350,20 @@ void Timer::schedule(TimerTask::Ptr pTask, long delay, long interval)
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Timestamp time, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new PeriodicTaskNotification(_queue, pTask, interval), time);
+	if (_pWheel)
+		scheduleWheel(pTask, toClock(time), interval, false);
+	else
+		_queue.enqueueNotification(new PeriodicTaskNotification(_queue, pTask, interval), time);
 }
 
 
 void Timer::schedule(TimerTask::Ptr pTask, Poco::Clock clock, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new PeriodicTaskNotification(_queue, pTask, interval), clock);
+	if (_pWheel)
+		scheduleWheel(pTask, clock, interval, false);
+	else
+		_queue.enqueueNotification(new PeriodicTaskNotification(_queue, pTask, interval), clock);
 }
 
 
@@ -314,19 +382,31 @@ void Timer::scheduleAtFixedRate(TimerTask::Ptr pTask, Poco::Timestamp time, long
 	Poco::Clock clock;
 	Poco::Timestamp::TimeDiff diff = time - tsNow;
 	clock += diff;
-	_queue.enqueueNotification(new FixedRateTaskNotification(_queue, pTask, interval, clock), clock);
+	if (_pWheel)
+		scheduleWheel(pTask, clock, interval, true);
+	else
+		_queue.enqueueNotification(new FixedRateTaskNotification(_queue, pTask, interval, clock), clock);
 }
 
 
 void Timer::scheduleAtFixedRate(TimerTask::Ptr pTask, Poco::Clock clock, long interval)
 {
 	validateTask(pTask);
-	_queue.enqueueNotification(new FixedRateTaskNotification(_queue, pTask, interval, clock), clock);
+	if (_pWheel)
+		scheduleWheel(pTask, clock, interval, true);
+	else
+		_queue.enqueueNotification(new FixedRateTaskNotification(_queue, pTask, interval, clock), clock);
 }
 
 
 void Timer::run()
 {
+	if (_pWheel)
+	{
+		runWheel();
+		return;
+	}
+
 	bool cont = true;
 	while (cont)
 	{
@@ -336,6 +416,93 @@ void Timer::run()
 }
 
 
+void Timer::runWheel()
+{
+	while (!_stopped)
+	{
+		// While the timer thread is busy, schedule() always wakes it up.
+		// Afterwards, only tasks due before the planned wake-up do.
+		_nextWakeUp = Poco::Clock::CLOCKVAL_MAX;
+		Poco::Timespan timeout = _pWheel->nextTimeout(Poco::Timespan(1, 0));
+		if (timeout > 0)
+		{
+			Poco::Clock wakeUp;
+			wakeUp += timeout.totalMicroseconds();
+			_nextWakeUp = wakeUp.raw();
+			_wakeUp.tryWait(static_cast<long>((timeout.totalMicroseconds() + 999)/1000));
+		}
+		if (!_stopped)
+		{
+			Poco::FastMutex::ScopedLock lock(_runMutex);
+			_pWheel->advance();
+		}
+	}
+}
+
+
+void Timer::scheduleWheel(TimerTask::Ptr pTask, Poco::Clock clock, long interval, bool fixedRate)
+{
+	// A negative interval denotes a one-time task.
+	Poco::UInt32 generation;
+	{
+		Poco::FastMutex::ScopedLock lock(_generationMutex);
+		generation = _generation;
+	}
+	_pWheel->schedule(clock, [this, pTask, clock, interval, fixedRate, generation]()
+		{
+			executeWheel(pTask, clock, interval, fixedRate, generation);
+		});
+	if (clock.raw() < _nextWakeUp) _wakeUp.set();
+}
+
+
+void Timer::executeWheel(TimerTask::Ptr pTask, Poco::Clock clock, long interval, bool fixedRate, Poco::UInt32 generation)
+{
+	{
+		Poco::FastMutex::ScopedLock lock(_generationMutex);
+		if (generation != _generation) return;
+	}
+	if (pTask->isCancelled()) return;
+
+	try
+	{
+		pTask->updateLastExecution();
+		pTask->run();
+	}
+	catch (Exception& exc)
+	{
+		ErrorHandler::handle(exc);
+	}
+	catch (std::exception& exc)
+	{
+		ErrorHandler::handle(exc);
+	}
+	catch (...)
+	{
+		ErrorHandler::handle();
+	}
+
+	if (interval >= 0 && !pTask->isCancelled())
+	{
+		Poco::Clock now;
+		Poco::Clock nextExecution = fixedRate ? clock : now;
+		nextExecution += static_cast<Poco::Clock::ClockDiff>(interval)*1000;
+		if (nextExecution < now) nextExecution = now;
+
+		// The generation is checked again, under the lock, so that
+		// a concurrent cancel() cannot miss the rescheduled task.
+		Poco::FastMutex::ScopedLock lock(_generationMutex);
+		if (generation == _generation)
+		{
+			_pWheel->schedule(nextExecution, [this, pTask, nextExecution, interval, fixedRate, generation]()
+				{
+					executeWheel(pTask, nextExecution, interval, fixedRate, generation);
+				});
+		}
+	}
+}
+
+
 void Timer::validateTask(const TimerTask::Ptr& pTask)
 {
 	if (pTask->isCancelled())
@@ -13,6 +13,8 @@
 #include "CppUnit/TestSuite.h"
 #include "Poco/Util/Timer.h"
 #include "Poco/Util/TimerTaskAdapter.h"
+#include <atomic>
+#include <vector>
 
 
 using Poco::Util::Timer;
@@ -336,6 +338,80 @@ void TimerTest::testIdle()
 }
 
 
+void TimerTest::testTimingWheel()
+{
+	Timer timer(Timer::BACKEND_TIMING_WHEEL);
+	assertTrue (timer.backend() == Timer::BACKEND_TIMING_WHEEL);
+	assertTrue (timer.idle());
+
+	Poco::Event done;
+	std::atomic<int> count(0);
+	std::vector<int> order;
+	Poco::FastMutex mutex;
+	for (int i = 5; i > 0; i--)
+	{
+		timer.schedule(Timer::func([&, i]()
+			{
+				Poco::FastMutex::ScopedLock lock(mutex);
+				order.push_back(i);
+				if (++count == 5) done.set();
+			}), Clock() + i*20000);
+	}
+	assertTrue (timer.taskCount() == 5);
+	done.wait();
+	assertTrue (order.size() == 5);
+	for (int i = 0; i < 5; i++)
+	{
+		assertTrue (order[i] == i + 1);
+	}
+
+	Timestamp time;
+	TimerTask::Ptr pTask = new TimerTaskAdapter<TimerTest>(*this, &TimerTest::onTimer);
+	timer.scheduleAtFixedRate(pTask, 200, 200);
+	_event.wait();
+	assertTrue (time.elapsed() >= 290000);
+	_event.wait();
+	assertTrue (time.elapsed() >= 490000);
+	_event.wait();
+	assertTrue (time.elapsed() >= 690000);
+	pTask->cancel();
+
+	// a task scheduled earlier than the pending ones must wake up the timer thread
+	timer.schedule(Timer::func([]() {}), Clock() + 10000000);
+	time.update();
+	timer.schedule(pTask = new TimerTaskAdapter<TimerTest>(*this, &TimerTest::onTimer), Clock() + 50000);
+	_event.wait();
+	assertTrue (time.elapsed() >= 140000 && time.elapsed() < 2000000);
+	assertFalse (timer.idle());
+}
+
+
+void TimerTest::testTimingWheelCancel()
+{
+	Timer timer(Timer::BACKEND_TIMING_WHEEL);
+
+	std::atomic<int> count(0);
+	for (int i = 0; i < 10000; i++)
+	{
+		timer.schedule(Timer::func([&count]() { count++; }), i % 100, 1);
+	}
+	assertTrue (timer.taskCount() <= 10000);
+	Poco::Thread::sleep(200);
+	timer.cancel(true);
+	assertTrue (timer.idle());
+	int n = count;
+	assertTrue (n > 0);
+	Poco::Thread::sleep(100);
+	assertTrue (count == n);
+
+	TimerTask::Ptr pTask = new TimerTaskAdapter<TimerTest>(*this, &TimerTest::onTimer);
+	timer.schedule(pTask, 100, 100);
+	timer.cancel(false);
+	assertFalse (_event.tryWait(400));
+	assertTrue (timer.idle());
+}
+
+
 void TimerTest::setUp()
 {
 }
@@ -369,6 +445,8 @@ CppUnit::Test* TimerTest::suite()
 	CppUnit_addTest(pSuite, TimerTest, testMultiCancelAllWaitStop);
 	CppUnit_addTest(pSuite, TimerTest, testFunc);
 	CppUnit_addTest(pSuite, TimerTest, testIdle);
+	CppUnit_addTest(pSuite, TimerTest, testTimingWheel);
+	CppUnit_addTest(pSuite, TimerTest, testTimingWheelCancel);
 
 	return pSuite;
 }
@@ -89,6 +89,18 @@ public:
 		///
 		/// See setStoreExtensions() for more information.
 
+	void setCompressionThreads(int threads);
+		/// Sets the number of threads used for compressing deflated entries.
+		/// If greater than one (or zero, for one thread per processor),
+		/// each entry is split into blocks that are compressed in parallel
+		/// (see Poco::DeflatingStreamBuf). This speeds up compressing large
+		/// files, at the cost of a slightly larger archive.
+		///
+		/// The default is one, which compresses entries on the calling thread.
+
+	int getCompressionThreads() const;
+		/// Returns the number of threads used for compressing deflated entries.
+
 private:
 	enum
 	{
@@ -116,6 +128,7 @@ private:
 	ZipArchive::DirectoryInfos64 _dirs64;
 	Poco::UInt64				 _offset;
     std::string                  _comment;
+	int                          _threads;
 
 	friend class Keep;
 	friend class Rename;
@@ -139,6 +152,12 @@ inline const std::string& Compress::getZipComment() const
 }
 
 
+inline int Compress::getCompressionThreads() const
+{
+	return _threads;
+}
+
+
 inline const std::set<std::string>& Compress::getStoreExtensions() const
 {
 	return _storeExtensions;
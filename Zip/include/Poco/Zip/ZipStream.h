@@ -42,8 +42,11 @@ public:
 	ZipStreamBuf(std::istream& istr, const ZipLocalFileHeader& fileEntry, bool reposition);
 		/// Creates the ZipStreamBuf. Set reposition to false, if you do on-the-fly decompression.
 
-	ZipStreamBuf(std::ostream& ostr, ZipLocalFileHeader& fileEntry, bool reposition);
+	ZipStreamBuf(std::ostream& ostr, ZipLocalFileHeader& fileEntry, bool reposition, int threads = 1);
 		/// Creates the ZipStreamBuf. Set reposition to false, if you do on-the-fly compression.
+		///
+		/// If threads is greater than one (or zero, for one thread per processor),
+		/// deflated entries are compressed in parallel (see Poco::DeflatingStreamBuf).
 
 	virtual ~ZipStreamBuf();
 		/// Destroys the ZipStreamBuf.
@@ -94,7 +97,7 @@ public:
 		/// Creates the basic stream and connects it
 		/// to the given input stream.
 
-	ZipIOS(std::ostream& ostr, ZipLocalFileHeader& fileEntry, bool reposition);
+	ZipIOS(std::ostream& ostr, ZipLocalFileHeader& fileEntry, bool reposition, int threads = 1);
 		/// Creates the basic stream and connects it
 		/// to the given output stream.
 
@@ -132,9 +135,12 @@ class Zip_API ZipOutputStream: public ZipIOS, public std::ostream
 	/// to one output stream.
 {
 public:
-	ZipOutputStream(std::ostream& ostr, ZipLocalFileHeader& fileEntry, bool seekableOutput);
+	ZipOutputStream(std::ostream& ostr, ZipLocalFileHeader& fileEntry, bool seekableOutput, int threads = 1);
 		/// Creates the ZipOutputStream and connects it
 		/// to the given output stream.
+		///
+		/// If threads is greater than one (or zero, for one thread per processor),
+		/// the entry is compressed in parallel (see Poco::DeflatingStreamBuf).
 
 	~ZipOutputStream();
 		/// Destroys the ZipOutputStream.
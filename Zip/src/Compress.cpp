@@ -35,7 +35,8 @@ Compress::Compress(std::ostream& out, bool seekableOut, bool forceZip64):
 	_files(),
 	_infos(),
 	_dirs(),
-	_offset(0)
+	_offset(0),
+	_threads(1)
 {
 	_storeExtensions.insert("gif");
 	_storeExtensions.insert("png");
@@ -91,7 +92,7 @@ void Compress::addEntry(std::istream& in, const Poco::DateTime& lastModifiedAt,
 		hdr.setZip64Data();
 	hdr.setStartPos(localHeaderOffset);
 
-	ZipOutputStream zipOut(_out, hdr, _seekableOut);
+	ZipOutputStream zipOut(_out, hdr, _seekableOut, _threads);
 	if (firstChar != eof)
 	{
 		zipOut.put(static_cast<char>(firstChar));
@@ -392,4 +393,12 @@ void Compress::setStoreExtensions(const std::set<std::string>& extensions)
 }
 
 
+void Compress::setCompressionThreads(int threads)
+{
+	poco_assert (threads >= 0);
+
+	_threads = threads;
+}
+
+
 } } // namespace Poco::Zip
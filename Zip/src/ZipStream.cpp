@@ -80,7 +80,7 @@ ZipStreamBuf::ZipStreamBuf(std::istream& istr, const ZipLocalFileHeader& fileEnt
 }
 
 
-ZipStreamBuf::ZipStreamBuf(std::ostream& ostr, ZipLocalFileHeader& fileEntry, bool reposition):
+ZipStreamBuf::ZipStreamBuf(std::ostream& ostr, ZipLocalFileHeader& fileEntry, bool reposition, int threads):
 	Poco::BufferedStreamBuf(STREAM_BUFFER_SIZE, std::ios::out),
 	_pIstr(nullptr),
 	_pOstr(&ostr),
@@ -119,7 +119,7 @@ ZipStreamBuf::ZipStreamBuf(std::ostream& ostr, ZipLocalFileHeader& fileEntry, bo
 				level = Z_BEST_COMPRESSION;
 			// ignore the zlib init string which is of size 2 and also ignore the 4 byte adler32 value at the end of the stream!
 			_ptrOHelper = new PartialOutputStream(*_pOstr, 2, 4, false);
-			_ptrOBuf = new Poco::DeflatingOutputStream(*_ptrOHelper, DeflatingStreamBuf::STREAM_ZLIB, level);
+			_ptrOBuf = new Poco::DeflatingOutputStream(*_ptrOHelper, DeflatingStreamBuf::STREAM_ZLIB, level, threads);
 		}
 		else if (fileEntry.getCompressionMethod() == ZipCommon::CM_STORE)
 		{
@@ -276,7 +276,7 @@ ZipIOS::ZipIOS(std::istream& istr, const ZipLocalFileHeader& fileEntry, bool rep
 }
 
 
-ZipIOS::ZipIOS(std::ostream& ostr, ZipLocalFileHeader& fileEntry, bool reposition): _buf(ostr, fileEntry, reposition)
+ZipIOS::ZipIOS(std::ostream& ostr, ZipLocalFileHeader& fileEntry, bool reposition, int threads): _buf(ostr, fileEntry, reposition, threads)
 {
 	poco_ios_init(&_buf);
 }
@@ -313,7 +313,7 @@ bool ZipInputStream::crcValid() const
 }
 
 
-ZipOutputStream::ZipOutputStream(std::ostream& ostr, ZipLocalFileHeader& fileEntry, bool seekableOutput): ZipIOS(ostr, fileEntry, seekableOutput), std::ostream(&_buf)
+ZipOutputStream::ZipOutputStream(std::ostream& ostr, ZipLocalFileHeader& fileEntry, bool seekableOutput, int threads): ZipIOS(ostr, fileEntry, seekableOutput, threads), std::ostream(&_buf)
 {
 }
 
@@ -13,11 +13,14 @@
 #include "Poco/Buffer.h"
 #include "Poco/Zip/Compress.h"
 #include "Poco/Zip/ZipManipulator.h"
+#include "Poco/Zip/ZipStream.h"
+#include "Poco/StreamCopier.h"
 #include "Poco/File.h"
 #include "Poco/FileStream.h"
 #include "CppUnit/TestCaller.h"
 #include "CppUnit/TestSuite.h"
 #include <iostream>
+#include <sstream>
 #undef min
 #include <algorithm>
 
@@ -195,6 +198,39 @@ void CompressTest::testZip64()
 }
 
 
+void CompressTest::testParallelCompress()
+{
+	std::string data;
+	for (int i = 0; data.size() < 2*MB; i++)
+	{
+		data += "This is line ";
+		data += std::to_string(i*7919 % 10007);
+		data += " of the test data.\n";
+	}
+
+	std::stringstream out;
+	Compress c(out, true);
+	assertTrue (c.getCompressionThreads() == 1);
+	c.setCompressionThreads(4);
+	assertTrue (c.getCompressionThreads() == 4);
+	std::istringstream in(data);
+	c.addFile(in, Poco::DateTime(), "data.txt", ZipCommon::CM_DEFLATE, ZipCommon::CL_MAXIMUM);
+	ZipArchive a(c.close());
+
+	ZipArchive::FileHeaders::const_iterator it = a.findHeader("data.txt");
+	assertTrue (it != a.headerEnd());
+	assertTrue (it->second.getUncompressedSize() == data.size());
+	assertTrue (it->second.getCompressedSize() < data.size()/2);
+
+	std::istringstream zipIn(out.str());
+	ZipInputStream zipIstr(zipIn, it->second);
+	std::string result;
+	Poco::StreamCopier::copyToString(zipIstr, result);
+	assertTrue (result == data);
+	assertTrue (zipIstr.crcValid());
+}
+
+
 void CompressTest::setUp()
 {
 }
@@ -216,6 +252,7 @@ CppUnit::Test* CompressTest::suite()
 	CppUnit_addTest(pSuite, CompressTest, testManipulatorReplace);
 	CppUnit_addTest(pSuite, CompressTest, testSetZipComment);
 	CppUnit_addTest(pSuite, CompressTest, testZip64);
+	CppUnit_addTest(pSuite, CompressTest, testParallelCompress);
 
 	return pSuite;
 }
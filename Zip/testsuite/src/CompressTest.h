@@ -35,6 +35,7 @@ public:
 	static const Poco::UInt64 MB = 1024*KB;
 	void createDataFile(const std::string& path, Poco::UInt64 size);
 	void testZip64();
+	void testParallelCompress();
 
 	void setUp();
 	void tearDown();
@@ -0,0 +1 @@
+globtest/src/main.c
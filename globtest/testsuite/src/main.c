@@ -0,0 +1 @@
+globtest/testsuite/src/main.c